@@ -0,0 +1,345 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_iir.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides cascades of biquad IIR filters, transposed
+  *					 direct form II in floating point and direct form I in Q31 with
+  *					 a 64 bit accumulator and optional noise shaping. A block goes
+  *					 through one stage at a time so the coefficients and the
+  *					 history of the stage stay in registers for the whole block.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_iir.h"
+#include <string.h>
+
+/**
+  * @brief  Set up a floating point coefficient bank
+  * @param  bank: bank
+  * @param  num_stages: 1 to IIR_MAX_STAGES
+  * @param  coeffs: IIR_COEFFS per stage, kept by the bank
+  * @retval HAL_OK, HAL_ERROR for a bad number of stages
+  */
+
+HAL_StatusTypeDef iirBankInitF32(IirBankF32 *bank, uint32_t num_stages, const float32_t *coeffs) {
+	if(num_stages < 1 || num_stages > IIR_MAX_STAGES)
+		return HAL_ERROR;
+	bank->num_stages = num_stages;
+	bank->pending = coeffs;
+	bank->active = coeffs;
+	return HAL_OK;
+}
+
+/**
+  * @brief  Give a bank new coefficients, used from the next iirBankLatchF32()
+  * @param  bank: bank
+  * @param  coeffs: IIR_COEFFS per stage, not to be changed while in use
+  * @retval none
+  */
+
+void iirBankSetF32(IirBankF32 *bank, const float32_t *coeffs) {
+	//The coefficients are written before the audio side can see them
+	__DMB();
+	bank->pending = coeffs;
+}
+
+/**
+  * @brief  Take the newest coefficients of a bank, called before the blocks
+  *					of the channels sharing it are processed
+  * @param  bank: bank
+  * @retval none
+  */
+
+void iirBankLatchF32(IirBankF32 *bank) {
+	bank->active = bank->pending;
+}
+
+/**
+  * @brief  Set up a floating point channel and clear its history
+  * @param  iir: channel
+  * @param  bank: coefficients
+  * @param  state: buffer of 2*num_stages values
+  * @retval none
+  */
+
+void iirInitF32(IirF32 *iir, IirBankF32 *bank, float32_t *state) {
+	iir->bank = bank;
+	iir->state = state;
+	memset(state, 0, 2*bank->num_stages*sizeof(float32_t));
+}
+
+/**
+  * @brief  Filter a block of floating point samples, in place when out is in
+  * @param  iir: channel
+  * @param  in: input samples
+  * @param  out: output samples
+  * @param  n: number of samples
+  * @param  stride: distance between samples, 1 for a mono block
+  * @retval none
+  */
+
+void iirProcessF32(IirF32 *iir, const float32_t *in, float32_t *out, uint32_t n, uint32_t stride) {
+	const float32_t *coeffs = iir->bank->active;
+	float32_t *state = iir->state;
+	const float32_t *src = in;
+	float32_t *dst;
+	float32_t b0, b1, b2, a1, a2, d1, d2, x, y;
+	uint32_t stage, i;
+
+	for(stage = 0; stage < iir->bank->num_stages; stage++) {
+		b0 = coeffs[0];
+		b1 = coeffs[1];
+		b2 = coeffs[2];
+		a1 = coeffs[3];
+		a2 = coeffs[4];
+		d1 = state[0];
+		d2 = state[1];
+		dst = out;
+		for(i = 0; i < n; i++) {
+			x = *src;
+			src += stride;
+			y = b0*x + d1;
+			d1 = b1*x - a1*y + d2;
+			d2 = b2*x - a2*y;
+			*dst = y;
+			dst += stride;
+		}
+		state[0] = d1;
+		state[1] = d2;
+		coeffs += IIR_COEFFS;
+		state += 2;
+		//The later stages work on the output in place
+		src = out;
+	}
+}
+
+/**
+  * @brief  Set up a Q31 coefficient bank
+  * @param  bank: bank
+  * @param  num_stages: 1 to IIR_MAX_STAGES
+  * @param  post_shift: the coefficients are the real ones times 2^-post_shift,
+  *					0 to 3, e.g. from iirCoeffsToQ31()
+  * @param  coeffs: IIR_COEFFS per stage in 1.31, kept by the bank
+  * @retval HAL_OK, HAL_ERROR for a bad number of stages or shift
+  */
+
+HAL_StatusTypeDef iirBankInitQ31(IirBankQ31 *bank, uint32_t num_stages, uint32_t post_shift, const int32_t *coeffs) {
+	if(num_stages < 1 || num_stages > IIR_MAX_STAGES || post_shift > 3)
+		return HAL_ERROR;
+	bank->num_stages = num_stages;
+	bank->post_shift = post_shift;
+	bank->pending = coeffs;
+	bank->active = coeffs;
+	return HAL_OK;
+}
+
+/**
+  * @brief  Give a bank new coefficients with the same post shift, used from
+  *					the next iirBankLatchQ31()
+  * @param  bank: bank
+  * @param  coeffs: IIR_COEFFS per stage, not to be changed while in use
+  * @retval none
+  */
+
+void iirBankSetQ31(IirBankQ31 *bank, const int32_t *coeffs) {
+	__DMB();
+	bank->pending = coeffs;
+}
+
+/**
+  * @brief  Take the newest coefficients of a bank, called before the blocks
+  *					of the channels sharing it are processed
+  * @param  bank: bank
+  * @retval none
+  */
+
+void iirBankLatchQ31(IirBankQ31 *bank) {
+	bank->active = bank->pending;
+}
+
+/**
+  * @brief  Set up a Q31 channel and clear its history
+  * @param  iir: channel
+  * @param  bank: coefficients
+  * @param  state: buffer of 5*num_stages values
+  * @param  noise_shaping: 1 to feed the rounding error of each stage back into
+  *					it, which moves the rounding noise away from low frequencies
+  *					where narrow low pass and shelving sections amplify it
+  * @retval none
+  */
+
+void iirInitQ31(IirQ31 *iir, IirBankQ31 *bank, int32_t *state, uint8_t noise_shaping) {
+	iir->bank = bank;
+	iir->state = state;
+	iir->noise_shaping = noise_shaping;
+	memset(state, 0, 5*bank->num_stages*sizeof(int32_t));
+}
+
+/**
+  * @brief  Filter a block of Q31 samples, in place when out is in
+  * @param  iir: channel
+  * @param  in: input samples
+  * @param  out: output samples
+  * @param  n: number of samples
+  * @param  stride: distance between samples, 1 for a mono block
+  * @retval none
+  */
+
+void iirProcessQ31(IirQ31 *iir, const int32_t *in, int32_t *out, uint32_t n, uint32_t stride) {
+	const int32_t *coeffs = iir->bank->active;
+	int32_t *state = iir->state;
+	uint32_t shift = 31 - iir->bank->post_shift;
+	uint8_t shaping = iir->noise_shaping;
+	const int32_t *src = in;
+	int32_t *dst;
+	int32_t b0, b1, b2, a1, a2, x1, x2, y1, y2, x, y;
+	int64_t acc, wide, err;
+	uint32_t stage, i;
+
+	for(stage = 0; stage < iir->bank->num_stages; stage++) {
+		b0 = coeffs[0];
+		b1 = coeffs[1];
+		b2 = coeffs[2];
+		a1 = coeffs[3];
+		a2 = coeffs[4];
+		x1 = state[0];
+		x2 = state[1];
+		y1 = state[2];
+		y2 = state[3];
+		//Without noise shaping the error term is the constant that rounds
+		err = shaping ? state[4] : ((int64_t)1 << (shift - 1));
+		dst = out;
+		for(i = 0; i < n; i++) {
+			x = *src;
+			src += stride;
+			acc = (int64_t)b0*x + (int64_t)b1*x1 + (int64_t)b2*x2 - (int64_t)a1*y1 - (int64_t)a2*y2 + err;
+			wide = acc >> shift;
+			if(shaping)
+				err = acc - (wide << shift);
+			if(wide > INT32_MAX)
+				y = INT32_MAX;
+			else if(wide < INT32_MIN)
+				y = INT32_MIN;
+			else
+				y = (int32_t)wide;
+			x2 = x1;
+			x1 = x;
+			y2 = y1;
+			y1 = y;
+			*dst = y;
+			dst += stride;
+		}
+		state[0] = x1;
+		state[1] = x2;
+		state[2] = y1;
+		state[3] = y2;
+		state[4] = shaping ? (int32_t)err : 0;
+		coeffs += IIR_COEFFS;
+		state += 5;
+		src = out;
+	}
+}
+
+/**
+  * @brief  Convert floating point coefficients to Q31 with the smallest post
+  *					shift that fits them all
+  * @param  coeffs: IIR_COEFFS per stage
+  * @param  coeffs_q31: IIR_COEFFS per stage in 1.31
+  * @param  num_stages: number of stages
+  * @retval post shift for iirBankInitQ31()
+  */
+
+uint32_t iirCoeffsToQ31(const float32_t *coeffs, int32_t *coeffs_q31, uint32_t num_stages) {
+	uint32_t i, count = num_stages*IIR_COEFFS, post_shift = 0;
+	float32_t biggest = 0.0f, c;
+
+	for(i = 0; i < count; i++)
+		if(fabsf(coeffs[i]) > biggest)
+			biggest = fabsf(coeffs[i]);
+	while(post_shift < 3 && biggest >= (float32_t)(1u << post_shift))
+		post_shift++;
+
+	for(i = 0; i < count; i++) {
+		c = coeffs[i]/(1u << post_shift)*2147483648.0f;
+		if(c >= 2147483647.0f)
+			coeffs_q31[i] = INT32_MAX;
+		else if(c <= -2147483648.0f)
+			coeffs_q31[i] = INT32_MIN;
+		else
+			coeffs_q31[i] = (int32_t)lrintf(c);
+	}
+	return post_shift;
+}
+
+#if IIR_BENCHMARK
+//Cycle counter, the host build times with a clock instead
+#ifndef IIR_CYCLES
+#define IIR_CYCLES()          (DWT->CYCCNT)
+#endif
+
+#define IIR_BENCH_SAMPLES     4096			//Samples filtered for each entry
+#define IIR_BENCH_BLOCK       64
+
+static const uint8_t bench_stages[IIR_BENCH_STAGES] = {1, 2, 4, 8};
+static float32_t bench_coeffs[8*IIR_COEFFS];
+static int32_t bench_coeffs_q31[8*IIR_COEFFS];
+static uint32_t bench_state[5*8];
+static uint32_t bench_block[IIR_BENCH_BLOCK];
+
+/**
+  * @brief  Measure the cycles per biquad per sample of the floating point
+  *					cascade and of the Q31 cascade without and with noise shaping,
+  *					for 1 to 8 stages and blocks of 64 samples
+  * @param  cycles: cycles by form (IIR_F32, IIR_Q31, IIR_Q31_SHAPED) and
+  *					number of stages
+  * @retval none
+  */
+
+void iirBenchmark(float32_t cycles[3][IIR_BENCH_STAGES]) {
+	IirBankF32 bank;
+	IirBankQ31 bank_q31;
+	IirF32 iir;
+	IirQ31 iir_q31;
+	uint32_t form, s, i, post_shift, start, total;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	//Butterworth low pass sections at fs/8, the timing does not depend on them
+	for(i = 0; i < 8; i++) {
+		bench_coeffs[i*IIR_COEFFS + 0] = 0.0976f;
+		bench_coeffs[i*IIR_COEFFS + 1] = 0.1953f;
+		bench_coeffs[i*IIR_COEFFS + 2] = 0.0976f;
+		bench_coeffs[i*IIR_COEFFS + 3] = -0.9428f;
+		bench_coeffs[i*IIR_COEFFS + 4] = 0.3333f;
+	}
+	post_shift = iirCoeffsToQ31(bench_coeffs, bench_coeffs_q31, 8);
+
+	for(form = 0; form < 3; form++) {
+		for(s = 0; s < IIR_BENCH_STAGES; s++) {
+			memset(bench_block, 0, sizeof(bench_block));
+			if(form == IIR_F32) {
+				iirBankInitF32(&bank, bench_stages[s], bench_coeffs);
+				iirInitF32(&iir, &bank, (float32_t *)bench_state);
+			} else {
+				iirBankInitQ31(&bank_q31, bench_stages[s], post_shift, bench_coeffs_q31);
+				iirInitQ31(&iir_q31, &bank_q31, (int32_t *)bench_state, form == IIR_Q31_SHAPED);
+			}
+			total = 0;
+			for(i = 0; i < IIR_BENCH_SAMPLES; i += IIR_BENCH_BLOCK) {
+				start = IIR_CYCLES();
+				if(form == IIR_F32)
+					iirProcessF32(&iir, (float32_t *)bench_block, (float32_t *)bench_block, IIR_BENCH_BLOCK, 1);
+				else
+					iirProcessQ31(&iir_q31, (int32_t *)bench_block, (int32_t *)bench_block, IIR_BENCH_BLOCK, 1);
+				total += IIR_CYCLES() - start;
+			}
+			cycles[form][s] = (float32_t)total/(IIR_BENCH_SAMPLES*bench_stages[s]);
+		}
+	}
+}
+#endif /* IIR_BENCHMARK */
@@ -0,0 +1,112 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_image.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides drawing of palette + RLE images. The CPU
+  *					 expands a band of rows into palette indices in SDRAM while
+  *					 DMA2D converts the band before from L8 through its CLUT into
+  *					 the layer format, a few transfers for the whole image.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_image.h"
+#include <string.h>
+
+extern LTDC_HandleTypeDef hLtdcHandler;
+
+static DMA2D_HandleTypeDef hDma2dImage;
+
+/**
+  * @brief  Expand one row of an RLE image into palette indices
+  * @param  data: start of the coded row
+  * @param  row: palette indices
+  * @param  width: pixels per row
+  * @retval start of the next coded row
+  */
+
+const uint8_t *rleDecodeRow(const uint8_t *data, uint8_t *row, uint32_t width) {
+	uint32_t i = 0, n;
+
+	while(i < width) {
+		n = *data++;
+		if(n & 0x80) {
+			n = (n & 0x7F) + 2;
+			if(n > width - i) n = width - i;
+			memset(&row[i], *data++, n);
+		} else {
+			n = n + 1;
+			if(n > width - i) n = width - i;
+			memcpy(&row[i], data, n);
+			data += n;
+		}
+		i += n;
+	}
+	return data;
+}
+
+/**
+  * @brief  Draw an RLE image on a layer, rows that don't fit on the layer are left out
+  * @param  layer: LTDC layer, ARGB8888 or RGB565
+  * @param  x: left edge
+  * @param  y: top edge
+  * @param  image: image made by bmp2rle
+  * @retval none
+  */
+
+void drawRleImage(uint32_t layer, uint16_t x, uint16_t y, const RleImage *image) {
+	DMA2D_CLUTCfgTypeDef clut;
+	const uint8_t *data = image->data;
+	uint32_t row, rows, count, i, band, address, bytes_per_pixel, colour_mode;
+	uint32_t xsize = hLtdcHandler.LayerCfg[layer].ImageWidth;
+
+	if(image->width > RLE_MAX_WIDTH || x + image->width > xsize || y >= hLtdcHandler.LayerCfg[layer].ImageHeight)
+		return;
+	rows = hLtdcHandler.LayerCfg[layer].ImageHeight - y;
+	if(rows > image->height) rows = image->height;
+
+	if(hLtdcHandler.LayerCfg[layer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) {
+		colour_mode = DMA2D_OUTPUT_RGB565;
+		bytes_per_pixel = 2;
+	} else {
+		colour_mode = DMA2D_OUTPUT_ARGB8888;
+		bytes_per_pixel = 4;
+	}
+	address = hLtdcHandler.LayerCfg[layer].FBStartAdress + bytes_per_pixel*(xsize*y + x);
+
+	hDma2dImage.Instance = DMA2D;
+	hDma2dImage.Init.Mode = DMA2D_M2M_PFC;
+	hDma2dImage.Init.ColorMode = colour_mode;
+	hDma2dImage.Init.OutputOffset = xsize - image->width;
+	hDma2dImage.LayerCfg[1].InputColorMode = DMA2D_INPUT_L8;
+	hDma2dImage.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+	hDma2dImage.LayerCfg[1].InputAlpha = 0xFF;
+	hDma2dImage.LayerCfg[1].InputOffset = 0;
+	if(HAL_DMA2D_Init(&hDma2dImage) != HAL_OK || HAL_DMA2D_ConfigLayer(&hDma2dImage, 1) != HAL_OK)
+		return;
+
+	//The palette goes into the foreground CLUT once per image
+	clut.pCLUT = (uint32_t *)image->palette;
+	clut.CLUTColorMode = DMA2D_CCM_ARGB8888;
+	clut.Size = image->colours - 1;
+	if(HAL_DMA2D_CLUTStartLoad(&hDma2dImage, &clut, 1) != HAL_OK)
+		return;
+	HAL_DMA2D_PollForTransfer(&hDma2dImage, 10);
+
+	for(row = 0; row < rows; row += count) {
+		//Expand the next band while the one before is converted
+		count = (rows - row < RLE_BAND_ROWS) ? rows - row : RLE_BAND_ROWS;
+		band = RLE_IMAGE_BUFFER + row*image->width;
+		for(i = 0; i < count; i++)
+			data = rleDecodeRow(data, (uint8_t *)(band + i*image->width), image->width);
+		//The band needn't start on a cache line, clean from the line it starts in
+		SCB_CleanDCache_by_Addr((uint32_t *)(band & ~31u), count*image->width + 32);
+
+		if(row > 0)
+			HAL_DMA2D_PollForTransfer(&hDma2dImage, 10);
+		if(HAL_DMA2D_Start(&hDma2dImage, band, address + bytes_per_pixel*xsize*row, image->width, count) != HAL_OK)
+			return;
+	}
+	HAL_DMA2D_PollForTransfer(&hDma2dImage, 10);
+}
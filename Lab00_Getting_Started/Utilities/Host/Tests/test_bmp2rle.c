@@ -0,0 +1,227 @@
+/**
+  ******************************************************************************
+  * @file    test_bmp2rle.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   bmp2rle.c round trips: BMPs coded by bmpToRle() and decoded by
+  *					 rleDecodeRow() give back their pixels, the arm logo codes to
+  *					 armlogo.h in a tenth of the flash of the BMP, and
+  *					 drawRleImage() draws what BSP_LCD_DrawBitmap() draws from the
+  *					 BMP in a few DMA2D transfers and less time.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_image.h"
+#include "armlogo.h"
+#include "bmp2rle.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define LOGO_BMP    "../Media/Pictures/BMP_372x126/armlogo.bmp"
+#define MAX_WIDTH   480
+#define MAX_HEIGHT  272
+#define LOGO_LAYER  0xC0400000
+
+static uint8_t bmp[54 + 4*MAX_WIDTH*MAX_HEIGHT];
+static uint32_t pixels[MAX_WIDTH*MAX_HEIGHT];
+static uint8_t row[MAX_WIDTH];
+static uint32_t reference[RK043FN48H_WIDTH*RK043FN48H_HEIGHT];
+
+/**
+  * @brief  Little endian field of a BMP header
+  */
+static void putLE(uint8_t *p, uint32_t value, int bytes) {
+	while(bytes--) {
+		*p++ = value;
+		value >>= 8;
+	}
+}
+
+/**
+  * @brief  BMP file of pixels, rows bottom up unless top_down
+  * @retval file size
+  */
+static uint32_t makeBmp(uint32_t width, uint32_t height, uint32_t bpp, int top_down) {
+	uint32_t stride = (width*(bpp/8) + 3) & ~3u, x, y, size = 54 + stride*height;
+	uint8_t *p;
+
+	memset(bmp, 0, size);
+	bmp[0] = 'B';
+	bmp[1] = 'M';
+	putLE(bmp + 2, size, 4);
+	putLE(bmp + 10, 54, 4);
+	putLE(bmp + 14, 40, 4);
+	putLE(bmp + 18, width, 4);
+	putLE(bmp + 22, top_down ? -(int32_t)height : height, 4);
+	putLE(bmp + 26, 1, 2);
+	putLE(bmp + 28, bpp, 2);
+	for(y = 0; y < height; y++) {
+		p = bmp + 54 + stride*(top_down ? y : height - 1 - y);
+		for(x = 0; x < width; x++, p += bpp/8)
+			putLE(p, pixels[y*width + x] | ((bpp == 32) ? 0xFF000000u : 0), bpp/8);
+	}
+	return size;
+}
+
+/**
+  * @brief  Decode every row and compare it with the pixels
+  * @retval number of pixels further from the original than the merged colours allow
+  */
+static uint32_t roundTrip(const RleCoded *image) {
+	const uint8_t *data = image->data;
+	uint32_t x, y, wrong = 0, a, b, dr, dg, db;
+
+	for(y = 0; y < image->height; y++) {
+		data = rleDecodeRow(data, row, image->width);
+		for(x = 0; x < image->width; x++) {
+			a = image->palette[row[x]];
+			b = pixels[y*image->width + x];
+			dr = abs((int)((a >> 16) & 0xFF) - (int)((b >> 16) & 0xFF));
+			dg = abs((int)((a >> 8) & 0xFF) - (int)((b >> 8) & 0xFF));
+			db = abs((int)(a & 0xFF) - (int)(b & 0xFF));
+			wrong += (dr*dr + dg*dg + db*db > image->worst);
+		}
+	}
+	wrong += (data != image->data + image->data_len);
+	return wrong;
+}
+
+/**
+  * @brief  Code and decode the pixels as a BMP of each kind
+  */
+static void check(const char *name, uint32_t width, uint32_t height) {
+	static const uint32_t bpps[] = {24, 32};
+	RleCoded image;
+	const char *error;
+	uint32_t b, top_down, size, wrong;
+
+	for(b = 0; b < 2; b++) {
+		for(top_down = 0; top_down <= 1; top_down++) {
+			size = makeBmp(width, height, bpps[b], top_down);
+			error = bmpToRle(bmp, size, &image);
+			HOST_CHECK(error == NULL, "%s: %s", name, error);
+			if(error != NULL)
+				continue;
+			HOST_CHECK(image.width == width && image.height == height, "%s: %ux%u, not %ux%u", name, image.width, image.height, width, height);
+			wrong = roundTrip(&image);
+			HOST_CHECK(wrong == 0, "%s, %u bit%s: %u pixels wrong", name, bpps[b], top_down ? " top down" : "", wrong);
+			if(image.source_colours <= MAX_COLOURS)
+				HOST_CHECK(image.worst == 0 && image.colours == image.source_colours, "%s: %u colours merged", name, image.source_colours - image.colours);
+			free(image.data);
+		}
+	}
+}
+
+int main(void) {
+	FILE *file;
+	RleCoded image;
+	const char *error;
+	uint32_t size, i, x, wrong, a, b, k, d, error2, transfers;
+	uint32_t *fb = (uint32_t *)LOGO_LAYER;
+	uint64_t start, elapsed, time_bmp, time_rle;
+	HostLcdStats before;
+
+	hostTestBegin("test_bmp2rle");
+
+	//Runs, literals and both at their longest, rows coded on their own
+	for(i = 0; i < 37*5; i++)
+		pixels[i] = (hostRandom() % 4 == 0) ? hostRandom() % 7 * 0x242424 : pixels[(i > 0) ? i - 1 : 0];
+	check("random runs 37x5", 37, 5);
+	for(x = 0; x < 300; x++) {
+		pixels[x] = 0x00FF8000;
+		pixels[300 + x] = x*0x010101 & 0xFF;
+		pixels[600 + x] = (x < 129) ? 0x123456 : (x < 130) ? 0x654321 : (x % 2)*0xFFFFFF;
+	}
+	check("long runs and literals 300x3", 300, 3);
+	pixels[0] = 0xABCDEF;
+	check("one pixel", 1, 1);
+	for(i = 0; i < 256*8; i++)
+		pixels[i] = ((i % 256)*0x9E3779B9u) & 0xFFFFFF;
+	check("256 colours", 256, 8);
+
+	//More colours than the palette, no pixel further off than the worst merge
+	for(i = 0; i < MAX_WIDTH*MAX_HEIGHT; i++)
+		pixels[i] = ((i*7/MAX_WIDTH) << 16) | (((i % MAX_WIDTH)/4) << 8) | 0x40;
+	size = makeBmp(MAX_WIDTH, MAX_HEIGHT, 24, 0);
+	error = bmpToRle(bmp, size, &image);
+	HOST_CHECK(error == NULL && image.source_colours > MAX_COLOURS && image.colours == MAX_COLOURS,
+						 "gradient: %u colours to %u", image.source_colours, image.colours);
+	wrong = roundTrip(&image);
+	HOST_CHECK(wrong == 0, "gradient: %u pixels off by more than the worst merge", wrong);
+	free(image.data);
+
+	//Files it can't code
+	HOST_CHECK(bmpToRle((const uint8_t *)"PNG", 3, &image) != NULL, "a non BMP file coded");
+	size = makeBmp(16, 16, 24, 0);
+	HOST_CHECK(bmpToRle(bmp, size - 1, &image) != NULL, "a short file coded");
+	putLE(bmp + 28, 8, 2);
+	HOST_CHECK(bmpToRle(bmp, size, &image) != NULL, "an 8 bit file coded");
+
+	//The logo codes to armlogo.h
+	file = fopen(LOGO_BMP, "rb");
+	HOST_CHECK(file != NULL, "no %s", LOGO_BMP);
+	if(file == NULL)
+		return hostTestEnd();
+	size = fread(bmp, 1, sizeof(bmp), file);
+	fclose(file);
+	error = bmpToRle(bmp, size, &image);
+	HOST_CHECK(error == NULL, "%s: %s", LOGO_BMP, error);
+	if(error != NULL)
+		return hostTestEnd();
+	HOST_CHECK(image.width == armlogo.width && image.height == armlogo.height && image.colours == armlogo.colours &&
+						 image.data_len == sizeof(armlogo_data) && memcmp(image.data, armlogo_data, sizeof(armlogo_data)) == 0 &&
+						 memcmp(image.palette, armlogo_palette, sizeof(armlogo_palette)) == 0, "armlogo.h is not what bmp2rle codes");
+
+	//drawRleImage() against the BMP drawn by the BSP
+	BSP_LCD_Init();
+	BSP_LCD_LayerDefaultInit(0, LOGO_LAYER);
+	BSP_LCD_SelectLayer(0);
+	BSP_LCD_Clear(0xFF0090BF);
+	BSP_LCD_DrawBitmap(50, 70, bmp);
+	memcpy(reference, fb, sizeof(reference));
+	BSP_LCD_Clear(0xFF0090BF);
+	drawRleImage(0, 50, 70, &armlogo);
+	for(i = 0, wrong = 0, error2 = 0; i < RK043FN48H_WIDTH*RK043FN48H_HEIGHT; i++) {
+		a = fb[i];
+		b = reference[i];
+		for(k = 0, d = 0; k < 24; k += 8)
+			d += (((a >> k) & 0xFF) - ((b >> k) & 0xFF))*(((a >> k) & 0xFF) - ((b >> k) & 0xFF));
+		if(d > error2) error2 = d;
+		wrong += (d > image.worst);
+	}
+	HOST_CHECK(wrong == 0, "drawRleImage: %u pixels off the BMP by more than the worst merge, squared error %u", wrong, error2);
+	HOST_CHECK(sizeof(armlogo_data) + sizeof(armlogo_palette) < size/10, "armlogo.h takes %u bytes of flash, the BMP %u",
+						 (uint32_t)(sizeof(armlogo_data) + sizeof(armlogo_palette)), size);
+
+	//A band of rows a transfer, and the best of 9 draws faster than the BSP from the BMP
+	before = hostLcdStats;
+	drawRleImage(0, 50, 70, &armlogo);
+	transfers = hostLcdStats.dma2d_transfers - before.dma2d_transfers;
+	HOST_CHECK(transfers <= (armlogo.height + RLE_BAND_ROWS - 1)/RLE_BAND_ROWS, "drawRleImage: %u DMA2D transfers for %u rows",
+						 transfers, armlogo.height);
+	for(i = 0, time_bmp = time_rle = UINT64_MAX; i < 9; i++) {
+		start = hostLcdTimeUs();
+		BSP_LCD_DrawBitmap(50, 70, bmp);
+		elapsed = hostLcdTimeUs() - start;
+		if(elapsed < time_bmp) time_bmp = elapsed;
+		start = hostLcdTimeUs();
+		drawRleImage(0, 50, 70, &armlogo);
+		elapsed = hostLcdTimeUs() - start;
+		if(elapsed < time_rle) time_rle = elapsed;
+	}
+	HOST_CHECK(time_rle < time_bmp, "drawRleImage %llu us, BSP_LCD_DrawBitmap %llu us", (unsigned long long)time_rle,
+						 (unsigned long long)time_bmp);
+
+	if(hostBenchmark()) {
+		printf("armlogo %ux%u: %u colours, BMP %u bytes, RLE %u bytes\n", image.width, image.height, image.source_colours,
+					 size, image.data_len + 4*image.colours);
+		HOST_LCD_BENCH("BSP_LCD_DrawBitmap", BSP_LCD_DrawBitmap(50, 70, bmp));
+		HOST_LCD_BENCH("drawRleImage", drawRleImage(0, 50, 70, &armlogo));
+	}
+	free(image.data);
+
+	HOST_CHECK(hostLcdStats.out_of_range == 0, "%llu writes outside the SDRAM", (unsigned long long)hostLcdStats.out_of_range);
+	return hostTestEnd();
+}
@@ -0,0 +1,176 @@
+/**
+  ******************************************************************************
+  * @file    test_capture.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   The min/max pyramid of stm32f7_capture.c against brute force:
+  *					 every level entry and random ranges of captureMinMax() while the
+  *					 capture grows, zooming with the touch screen, and golden frames
+  *					 of plotCapture() at three zoom levels.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_capture.h"
+
+#define NUM_SAMPLES 160000
+#define QUERIES     200
+
+static int16_t samples[NUM_SAMPLES];
+static Capture cap;
+
+//Set by proceed_statement() between screens so drawAxes() redraws the y axis
+extern int update_flag;
+
+/**
+  * @brief  Draw one frame on a new screen, after enough panel refreshes that
+  *					the render scheduler has one due at RENDER_DEFAULT_FPS
+  */
+#define DRAW(name, call) \
+	do { \
+		clearScreen(); \
+		clearLabels(); \
+		update_flag = 1; \
+		hostVsync(HOST_REFRESH_HZ/RENDER_DEFAULT_FPS + 1); \
+		if(hostBenchmark()) \
+			HOST_LCD_BENCH(name, call); \
+		else \
+			call; \
+	} while(0)
+
+/**
+  * @brief  Min and max of samples first to last - 1, one at a time
+  */
+static void bruteForce(uint32_t first, uint32_t last, int16_t *min, int16_t *max) {
+	uint32_t i;
+
+	*min = INT16_MAX;
+	*max = INT16_MIN;
+	for(i = first; i < last; i++) {
+		if(samples[i] < *min) *min = samples[i];
+		if(samples[i] > *max) *max = samples[i];
+	}
+}
+
+/**
+  * @brief  Every complete entry of every level against brute force
+  * @retval number of wrong entries
+  */
+static uint32_t checkLevels(void) {
+	uint32_t l, i, wrong = 0;
+	int16_t min, max;
+
+	for(l = 1; l < cap.num_levels; l++) {
+		for(i = 0; (i + 1) << l <= cap.length; i++) {
+			bruteForce(i << l, (i + 1) << l, &min, &max);
+			wrong += (cap.level[l][i].min != min || cap.level[l][i].max != max);
+		}
+	}
+	return wrong;
+}
+
+int main(void) {
+	uint32_t i, q, length = 0, first, last, wrong_ranges = 0, wrong_levels = 0, span;
+	int16_t min, max, brute_min, brute_max;
+	int changed;
+	uint64_t start;
+
+	hostTestBegin("test_capture");
+
+	//A tone sliding down in frequency, loud and quiet by turns, with noise and two full scale samples
+	for(i = 0; i < NUM_SAMPLES; i++)
+		samples[i] = (int16_t)(12000*sinf(2*PI*i/(200.0f + i/400.0f))*((i % 16000 < 8000) ? 1 : 0.3f) + 2000*hostUniform() - 1000);
+	samples[12345] = INT16_MAX;
+	samples[99999] = INT16_MIN;
+
+	hostPressButton(1);
+	stm32f7_LCD_init(16000, "Capture", GRAPH);
+	HOST_CHECK(captureInit(&cap, samples, NUM_SAMPLES) == HAL_OK, "captureInit");
+	HOST_CHECK((uint32_t)cap.level[cap.num_levels - 1] + sizeof(CaptureMinMax) <= CAPTURE_PYRAMID_BUFFER + CAPTURE_PYRAMID_SIZE,
+						 "the pyramid ends past CAPTURE_PYRAMID_SIZE");
+
+	//Grow the capture in uneven steps, the pyramid follows each one
+	while(length < NUM_SAMPLES) {
+		length += 1 + hostRandom() % 5000;
+		if(length > NUM_SAMPLES) length = NUM_SAMPLES;
+		captureAppend(&cap, length);
+		wrong_levels += checkLevels();
+		for(q = 0; q < QUERIES; q++) {
+			first = hostRandom() % (length + 1);
+			last = (q % 4 == 0) ? first + hostRandom() % 40 : hostRandom() % (length + 1);
+			if(last > length) last = length;
+			if(first > last) { i = first; first = last; last = i; }
+			captureMinMax(&cap, first, last, &min, &max);
+			bruteForce(first, last, &brute_min, &brute_max);
+			//An empty range gives min > max
+			wrong_ranges += (first < last) ? (min != brute_min || max != brute_max) : (min <= max);
+		}
+	}
+	HOST_CHECK(wrong_levels == 0, "%u pyramid entries differ from brute force", wrong_levels);
+	HOST_CHECK(wrong_ranges == 0, "%u ranges differ from brute force", wrong_ranges);
+	captureMinMax(&cap, 0, NUM_SAMPLES, &min, &max);
+	HOST_CHECK(min == INT16_MIN && max == INT16_MAX, "whole capture %d to %d", min, max);
+
+	//More samples than the pyramid holds
+	HOST_CHECK(captureInit(&cap, samples, CAPTURE_PYRAMID_SIZE) != HAL_OK, "a pyramid bigger than CAPTURE_PYRAMID_SIZE");
+	captureInit(&cap, samples, NUM_SAMPLES);
+	captureAppend(&cap, NUM_SAMPLES);
+
+	captureSetView(&cap, 0, NUM_SAMPLES);
+	DRAW("plotCapture 10 s", plotCapture(&cap, GRAPH_COLOUR));
+	hostCheckFrame("capture_all");
+	captureSetView(&cap, 10000, 4000);
+	DRAW("plotCapture 250 ms", plotCapture(&cap, GRAPH_COLOUR));
+	hostCheckFrame("capture_zoom");
+	captureSetView(&cap, 80000, 80);
+	DRAW("plotCapture 5 ms", plotCapture(&cap, GRAPH_COLOUR));
+	hostCheckFrame("capture_5ms");
+	HOST_CHECK(cap.span == 80, "a view of %u samples, not 80", cap.span);
+
+	//No closer than CAPTURE_MIN_SPAN and no further than the whole capture
+	captureSetView(&cap, 50, 1);
+	HOST_CHECK(cap.span == CAPTURE_MIN_SPAN, "a view of %u samples, not CAPTURE_MIN_SPAN", cap.span);
+	captureSetView(&cap, NUM_SAMPLES, 2*NUM_SAMPLES);
+	HOST_CHECK(cap.start == 0 && cap.span == NUM_SAMPLES, "view %u + %u past the capture", cap.start, cap.span);
+
+	//Spreading two fingers zooms in, one finger moved left pans right
+	hostTouch(2, 200, 100, 300, 100);
+	hostAdvanceTick(10);
+	captureTouch(&cap);
+	hostTouch(2, 150, 100, 350, 100);
+	hostAdvanceTick(10);
+	changed = captureTouch(&cap);
+	span = cap.span;
+	HOST_CHECK(changed && span < NUM_SAMPLES*3/4 && span > NUM_SAMPLES/4, "pinch: span %u", span);
+	hostTouch(0, 0, 0, 0, 0);
+	hostAdvanceTick(10);
+	captureTouch(&cap);
+	first = cap.start;
+	hostTouch(1, 200, 100, 0, 0);
+	hostAdvanceTick(10);
+	captureTouch(&cap);
+	hostTouch(1, 150, 100, 0, 0);
+	hostAdvanceTick(10);
+	changed = captureTouch(&cap);
+	HOST_CHECK(changed && cap.start > first && cap.span == span, "drag: view %u + %u from %u + %u", cap.start, cap.span, first, span);
+	hostTouch(0, 0, 0, 0, 0);
+
+	if(hostBenchmark()) {
+		start = hostLcdTimeUs();
+		for(q = 0; q < 100000; q++) {
+			first = hostRandom() % NUM_SAMPLES;
+			captureMinMax(&cap, first, first + hostRandom() % (NUM_SAMPLES - first), &min, &max);
+		}
+		printf("captureMinMax: %.3f us per range\n", (hostLcdTimeUs() - start)/100000.0);
+		start = hostLcdTimeUs();
+		for(q = 0; q < 1000; q++) {
+			first = hostRandom() % NUM_SAMPLES;
+			bruteForce(first, first + hostRandom() % (NUM_SAMPLES - first), &min, &max);
+		}
+		printf("brute force:   %.3f us per range\n", (hostLcdTimeUs() - start)/1000.0);
+	}
+
+	HOST_CHECK(hostLcdStats.out_of_range == 0, "%llu writes outside the SDRAM", (unsigned long long)hostLcdStats.out_of_range);
+	return hostTestEnd();
+}
@@ -0,0 +1,70 @@
+/**
+  ******************************************************************************
+  * @file    test_display.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Golden frames of the plots of stm32f7_display.c: the start
+  *					 screen, plotFFT(), plotLogFFT(), plotLMS() and plotWave() of
+  *					 short and long buffers, and the pixels each call touches.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_display.h"
+
+static float32_t buffer[4096];
+
+/**
+  * @brief  Draw one frame, after enough panel refreshes that the render
+  *					scheduler has one due at RENDER_DEFAULT_FPS
+  */
+#define DRAW(name, call) \
+	do { \
+		hostVsync(HOST_REFRESH_HZ/RENDER_DEFAULT_FPS + 1); \
+		if(hostBenchmark()) \
+			HOST_LCD_BENCH(name, call); \
+		else \
+			call; \
+	} while(0)
+
+int main(void) {
+	int i;
+
+	hostTestBegin("test_display");
+	hostPressButton(1);
+	stm32f7_LCD_init(8000, "Host test", GRAPH);
+	hostCheckFrame("display_start");
+
+	//The log and LMS graphs go first, plotWave() stops them until the button
+	for(i = 0; i < 512; i++)
+		buffer[i] = 100.0f/(1 + abs(i - 60)) + ((i % 97 == 0) ? 50 : 0);
+	DRAW("plotFFT", plotFFT(buffer, 512, AUTO_SCALING));
+	hostCheckFrame("display_fft");
+	DRAW("plotLogFFT", plotLogFFT(buffer, 512, LIVE));
+	hostCheckFrame("display_logfft");
+
+	for(i = 0; i < 64; i++)
+		buffer[i] = 0.8f*expf(-i/12.0f)*cosf(2*PI*i/16);
+	//A lab shows one kind of graph, the next starts on a clear screen
+	clearScreen();
+	clearLabels();
+	DRAW("plotLMS", plotLMS(buffer, 64, LIVE));
+	hostCheckFrame("display_lms");
+
+	for(i = 0; i < 256; i++)
+		buffer[i] = 10000*sinf(2*PI*i*5/256);
+	clearScreen();
+	clearLabels();
+	DRAW("plotWave 256", plotWave(buffer, 256, LIVE, ARRAY));
+	hostCheckFrame("display_wave");
+
+	//Longer than the graph, drawn as a min/max envelope
+	for(i = 0; i < 4096; i++)
+		buffer[i] = 10000*sinf(2*PI*i*37/4096) + 3000*sinf(2*PI*i*21/4096);
+	DRAW("plotWave 4096", plotWave(buffer, 4096, LIVE, ARRAY));
+	hostCheckFrame("display_wave4096");
+
+	HOST_CHECK(hostLcdStats.out_of_range == 0, "%llu writes outside the SDRAM", (unsigned long long)hostLcdStats.out_of_range);
+	return hostTestEnd();
+}
@@ -0,0 +1,196 @@
+/**
+  ******************************************************************************
+  * @file    test_eye.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   A PRBS through the one pole low-pass channel of the PRBS lab into
+  *					 stm32f7_eye.c: the hit map and histogram against the samples
+  *					 themselves, the eye opening against the one the channel leaves,
+  *					 no overflow on long runs plotted as the lab does, the work per
+  *					 sample of raw chips one sample long, and golden frames of the
+  *					 eye open, nearly closed and closed.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_eye.h"
+
+#define CHIP_SAMPLES  8
+#define CHIP_LEVEL    8000
+#define EYE_RANGE     10000
+#define BLOCK         128
+#define BLOCKS        400
+#define NUM_SAMPLES   (BLOCK*BLOCKS)
+
+static int16_t samples[NUM_SAMPLES];
+static uint8_t expected[GRAPH_WIDTH*EYE_ROWS];
+static uint32_t hist[EYE_HIST_BINS];
+static Eye eye;
+
+//Set by proceed_statement() between screens so drawAxes() redraws the y axis
+extern int update_flag;
+
+/**
+  * @brief  Next chip of a 16 bit maximal length sequence
+  */
+static int16_t prbsChip(void) {
+	static uint16_t shift_register = 1;
+	int feedback = ((shift_register >> 15) ^ (shift_register >> 14) ^ (shift_register >> 3) ^ (shift_register >> 1)) & 1;
+
+	shift_register = (shift_register << 1) | feedback;
+	return feedback ? CHIP_LEVEL : -CHIP_LEVEL;
+}
+
+/**
+  * @brief  NUM_SAMPLES of the PRBS through y += (x - y)/2^shift, like the lab
+  */
+static void channel(int shift) {
+	int32_t y = 0;
+	int16_t chip = 0;
+	uint32_t i;
+
+	for(i = 0; i < NUM_SAMPLES; i++) {
+		if(i % CHIP_SAMPLES == 0)
+			chip = prbsChip();
+		y += (chip - y) >> shift;
+		samples[i] = (int16_t)y;
+	}
+}
+
+/**
+  * @brief  Graph row of a sample, as eyeAddBlock() rounds it
+  */
+static int32_t rowOf(int16_t value) {
+	int32_t row = EYE_ROWS/2 - (int32_t)(((int64_t)value*eye.row_scale) >> 16);
+
+	return (row < 0) ? 0 : (row >= EYE_ROWS) ? EYE_ROWS - 1 : row;
+}
+
+/**
+  * @brief  Feed the samples in blocks and check the hit map at the column of
+	*					each phase and the histogram against the samples
+  * @retval rows free of hits around the centre at the last sample of a chip
+  */
+static int32_t feed(int shift) {
+	const uint16_t *hits = (const uint16_t *)EYE_BUFFER;
+	uint32_t i, p, r, c, wrong_hits = 0, wrong_bins = 0;
+	int32_t bin, top, bottom;
+
+	channel(shift);
+	eyeInit(&eye, CHIP_SAMPLES, EYE_RANGE);
+	for(i = 0; i < NUM_SAMPLES; i += BLOCK)
+		eyeAddBlock(&eye, &samples[i], BLOCK);
+
+	//A line starts at the column of its first sample, the last sample has no line yet
+	memset(expected, 0, sizeof(expected));
+	memset(hist, 0, sizeof(hist));
+	for(i = 0; i < NUM_SAMPLES; i++) {
+		if(i < NUM_SAMPLES - 1)
+			expected[rowOf(samples[i])*GRAPH_WIDTH + eye.column[i % (2*CHIP_SAMPLES)]] = 1;
+		bin = EYE_HIST_BINS/2 + (int32_t)(((int64_t)samples[i]*eye.bin_scale) >> 16);
+		hist[(bin < 0) ? 0 : (bin >= EYE_HIST_BINS) ? EYE_HIST_BINS - 1 : bin]++;
+	}
+	for(p = 0; p < 2*CHIP_SAMPLES; p++) {
+		c = eye.column[p];
+		for(r = 0; r < EYE_ROWS; r++)
+			wrong_hits += ((hits[r*GRAPH_WIDTH + c] != 0) != expected[r*GRAPH_WIDTH + c]);
+	}
+	for(i = 0; i < EYE_HIST_BINS; i++)
+		wrong_bins += (hist[i] != eye.hist[i]);
+	HOST_CHECK(eye.samples == NUM_SAMPLES, "shift %d: %u samples", shift, eye.samples);
+	HOST_CHECK(wrong_hits == 0, "shift %d: %u pixels at the sample columns differ from the samples", shift, wrong_hits);
+	HOST_CHECK(wrong_bins == 0, "shift %d: %u histogram bins differ from the samples", shift, wrong_bins);
+
+	//Opening where the channel has settled most, the last sample of the chip
+	c = eye.column[CHIP_SAMPLES - 1];
+	for(top = EYE_ROWS/2; top >= 0 && hits[top*GRAPH_WIDTH + c] == 0; top--);
+	for(bottom = EYE_ROWS/2; bottom < EYE_ROWS && hits[bottom*GRAPH_WIDTH + c] == 0; bottom++);
+	return (bottom > top) ? bottom - top - 1 : 0;
+}
+
+/**
+  * @brief  Rows between the inner rails after a long run and one chip the
+	*					other way, 0 once the channel closes the eye
+  */
+static int32_t expectedOpening(int shift) {
+	float32_t inner = CHIP_LEVEL*(1 - 2*powf(1 - 1.0f/(1 << shift), CHIP_SAMPLES));
+
+	return (inner > 0) ? rowOf(-(int16_t)inner) - rowOf((int16_t)inner) - 1 : 0;
+}
+
+/**
+  * @brief  Draw the eye on a new screen
+  */
+static void draw(const char *name) {
+	clearScreen();
+	update_flag = 1;
+	if(hostBenchmark())
+		HOST_LCD_BENCH(name, plotEye(&eye));
+	else
+		plotEye(&eye);
+}
+
+int main(void) {
+	static const int shifts[] = {0, 2, 3, 4};
+	static const char *frames[] = {"eye_open", "eye_lab", "eye_narrow", "eye_closed"};
+	int32_t opening, last_opening = EYE_ROWS, expect;
+	uint32_t s, i, peaks;
+	uint64_t total;
+
+	hostTestBegin("test_eye");
+	hostPressButton(1);
+	stm32f7_LCD_init(48000, "PRBS", GRAPH);
+
+	//The slower the channel the narrower the eye, closed once one chip can't cross zero
+	for(s = 0; s < 4; s++) {
+		opening = feed(shifts[s]);
+		expect = expectedOpening(shifts[s]);
+		HOST_CHECK(abs(opening - expect) <= 2, "shift %d: eye open %d rows, the channel leaves %d", shifts[s], opening, expect);
+		HOST_CHECK(opening < last_opening || opening == 0, "shift %d: eye open %d rows, no narrower than %d", shifts[s], opening, last_opening);
+		last_opening = opening;
+		draw(frames[s]);
+		hostCheckFrame(frames[s]);
+	}
+	HOST_CHECK(last_opening == 0, "the slowest channel leaves the eye open");
+
+	//Without a channel the histogram is two spikes at the chip levels
+	feed(0);
+	for(i = 0, peaks = 0; i < EYE_HIST_BINS; i++)
+		peaks += (eye.hist[i] != 0);
+	HOST_CHECK(peaks == 2 && eye.hist_max >= NUM_SAMPLES/2 - NUM_SAMPLES/16, "%u histogram bins used without a channel", peaks);
+	feed(2);
+	clearScreen();
+	update_flag = 1;
+	plotHistogram(&eye);
+	hostCheckFrame("eye_histogram");
+
+	//Far more hits than a uint16_t holds, plotted between runs the counts are halved instead
+	for(i = 0; i < 40; i++) {
+		for(s = 0; s < NUM_SAMPLES; s += BLOCK)
+			eyeAddBlock(&eye, &samples[s], BLOCK);
+		plotEye(&eye);
+	}
+	HOST_CHECK(eye.max_hits < EYE_HALVE_HITS && eye.max_hits >= EYE_HALVE_HITS/2, "max_hits %u after %u samples", eye.max_hits, eye.samples);
+	draw("plotEye halved");
+	hostCheckFrame("eye_long");
+
+	//A new chip every sample as the lab plays them, each line still crosses EYE_LINE_COLUMNS columns
+	for(i = 0; i < NUM_SAMPLES; i++)
+		samples[i] = prbsChip();
+	eyeInit(&eye, 1, EYE_RANGE);
+	for(s = 0; s < NUM_SAMPLES; s += BLOCK)
+		eyeAddBlock(&eye, &samples[s], BLOCK);
+	for(i = 0, total = 0; i < GRAPH_WIDTH*EYE_ROWS; i++)
+		total += ((const uint16_t *)EYE_BUFFER)[i];
+	HOST_CHECK(eye.columns == 2*EYE_LINE_COLUMNS && total == (uint64_t)(NUM_SAMPLES - 1)*EYE_LINE_COLUMNS,
+						 "%llu hits from %u samples one chip long over %u columns", (unsigned long long)total, NUM_SAMPLES, eye.columns);
+	draw("plotEye chips");
+	hostCheckFrame("eye_chips");
+
+	if(hostBenchmark())
+		HOST_LCD_BENCH("eyeAddBlock 128", eyeAddBlock(&eye, samples, BLOCK));
+
+	HOST_CHECK(hostLcdStats.out_of_range == 0, "%llu writes outside the SDRAM", (unsigned long long)hostLcdStats.out_of_range);
+	return hostTestEnd();
+}
@@ -0,0 +1,147 @@
+/**
+  ******************************************************************************
+  * @file    test_input.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   The debouncing and the event queue of stm32f7_input.c: contacts
+  *					 bouncing on press and release, a long press, a glitch that
+  *					 settles inside the debounce time, the tick wrapping round, a
+  *					 full queue and the touch screen events.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_display.h"
+
+/**
+  * @brief  Take every queued event
+  * @retval number of events, the last one in event
+  */
+static int drain(InputEvent *event, uint8_t *types, int max) {
+	int n = 0;
+
+	while(inputGetEvent(event)) {
+		if(n < max) types[n] = event->type;
+		n++;
+	}
+	return n;
+}
+
+int main(void) {
+	Debounce db;
+	InputEvent event;
+	TS_StateTypeDef ts;
+	uint8_t types[64];
+	uint32_t start, ms, presses;
+	int i, n, pressed_events;
+	uint64_t time_us;
+
+	hostTestBegin("test_input");
+
+	//Debouncing alone, the first edge is taken at once and the bounce after it ignored
+	debounceInit(&db, 0, 1000);
+	HOST_CHECK(debounceUpdate(&db, 1, 1000) == INPUT_BUTTON_PRESS, "first edge not taken at once");
+	for(i = 1, n = 0; i < INPUT_DEBOUNCE_MS; i++)
+		n += (debounceUpdate(&db, i % 2 == 0, 1000 + i) != INPUT_NONE);
+	HOST_CHECK(n == 0 && db.state == 1, "%d events from bounce inside %d ms", n, INPUT_DEBOUNCE_MS);
+	HOST_CHECK(debounceUpdate(&db, 1, 1030) == INPUT_NONE, "an event without an edge");
+	HOST_CHECK(debounceUpdate(&db, 0, 1100) == INPUT_BUTTON_RELEASE, "release not taken");
+
+	//A release bouncing inside the debounce time is taken once it is over
+	debounceInit(&db, 0, 0);
+	debounceUpdate(&db, 1, 5000);
+	debounceUpdate(&db, 0, 5005);
+	HOST_CHECK(db.state == 1, "released inside the debounce time");
+	HOST_CHECK(debounceUpdate(&db, 0, 5000 + INPUT_DEBOUNCE_MS - 1) == INPUT_NONE &&
+						 debounceUpdate(&db, 0, 5000 + INPUT_DEBOUNCE_MS) == INPUT_BUTTON_RELEASE, "settled release not taken after the debounce time");
+
+	//HAL_GetTick() wrapping round
+	debounceInit(&db, 0, 0xFFFFFFF0u);
+	HOST_CHECK(debounceUpdate(&db, 1, 0xFFFFFFF5u) == INPUT_BUTTON_PRESS && debounceUpdate(&db, 0, 3) == INPUT_NONE &&
+						 debounceUpdate(&db, 0, 0x10) == INPUT_BUTTON_RELEASE, "debouncing across the tick wrapping round");
+
+	//The press that starts the program is taken by stm32f7_LCD_init()
+	hostPressButton(1);
+	stm32f7_LCD_init(8000, "Input", GRAPH);
+	HOST_CHECK(CheckForUserInput() == 0, "the start press is left for the program");
+	drain(&event, types, 0);
+
+	//A bouncing press and release through the EXTI interrupt, six edges each
+	start = HAL_GetTick();
+	for(i = 0; i < 6; i++)
+		hostButtonLevel(i % 2 == 0);
+	hostButtonLevel(1);
+	hostAdvanceTick(100);
+	for(i = 0; i < 6; i++)
+		hostButtonLevel(i % 2);
+	hostButtonLevel(0);
+	n = drain(&event, types, 64);
+	HOST_CHECK(n == 2 && types[0] == INPUT_BUTTON_PRESS && types[1] == INPUT_BUTTON_RELEASE, "%d events from a bouncing press and release", n);
+	HOST_CHECK(event.tick - start == 100, "release seen at +%u ms", event.tick - start);
+	HOST_CHECK(CheckForUserInput() == 1 && CheckForUserInput() == 0, "a bouncing press counted other than once");
+
+	//A long press, the main loop polling every 10 ms: one press, held, then one release
+	hostAdvanceTick(100);
+	hostButtonLevel(1);
+	for(ms = 0, presses = 0, pressed_events = 0; ms < 3000; ms += 10) {
+		hostAdvanceTick(10);
+		presses += CheckForUserInput();
+		n = drain(&event, types, 64);
+		pressed_events += n;
+	}
+	HOST_CHECK(presses == 1 && pressed_events == 1 && types[0] == INPUT_BUTTON_PRESS,
+						 "3 s press: %u presses and %d events while held", presses, pressed_events);
+	for(i = 0; i < 4; i++)
+		hostButtonLevel(i % 2);
+	hostButtonLevel(0);
+	n = drain(&event, types, 64);
+	HOST_CHECK(n == 1 && types[0] == INPUT_BUTTON_RELEASE && CheckForUserInput() == 0, "%d events letting go of a long press", n);
+
+	//A glitch that ends released inside the debounce time, no edge is left to interrupt
+	hostAdvanceTick(100);
+	hostButtonLevel(1);
+	hostButtonLevel(0);
+	hostButtonLevel(1);
+	hostButtonLevel(0);
+	n = drain(&event, types, 64);
+	HOST_CHECK(n == 1 && types[0] == INPUT_BUTTON_PRESS, "%d events from a glitch", n);
+	hostAdvanceTick(INPUT_DEBOUNCE_MS + 5);
+	HOST_CHECK(inputGetEvent(&event) && event.type == INPUT_BUTTON_RELEASE, "the glitch release not taken by the poll");
+	CheckForUserInput();
+
+	//More events than the queue holds are dropped and counted, the presses are not
+	hostAdvanceTick(50);
+	hostPressButton(20);
+	n = drain(&event, types, 64);
+	HOST_CHECK(n == INPUT_QUEUE_SIZE && inputDropped() == 40 - INPUT_QUEUE_SIZE, "%d events queued, %u dropped", n, inputDropped());
+	for(n = 0; CheckForUserInput(); n++);
+	HOST_CHECK(n == 20, "%d presses counted from 20", n);
+
+	//Touch events, the controller read at most every INPUT_TOUCH_PERIOD_MS
+	hostAdvanceTick(20);
+	hostTouch(1, 200, 100, 0, 0);
+	HOST_CHECK(inputGetEvent(&event) && event.type == INPUT_TOUCH_DOWN && event.x == 200 && event.y == 100, "touch down");
+	hostTouch(1, 210, 100, 0, 0);
+	HOST_CHECK(!inputGetEvent(&event), "touch controller read twice in a period");
+	hostAdvanceTick(INPUT_TOUCH_PERIOD_MS);
+	HOST_CHECK(inputGetEvent(&event) && event.type == INPUT_TOUCH_MOVE && event.x == 210, "touch move");
+	hostAdvanceTick(INPUT_TOUCH_PERIOD_MS);
+	HOST_CHECK(!inputGetEvent(&event), "an event with the finger still");
+	hostTouch(2, 210, 100, 300, 150);
+	hostAdvanceTick(INPUT_TOUCH_PERIOD_MS);
+	HOST_CHECK(inputGetEvent(&event) && event.type == INPUT_TOUCH_MOVE && event.touches == 2, "second finger down");
+	hostTouch(0, 0, 0, 0, 0);
+	hostAdvanceTick(INPUT_TOUCH_PERIOD_MS);
+	HOST_CHECK(inputGetEvent(&event) && event.type == INPUT_TOUCH_UP, "touch up");
+	HOST_CHECK(inputGetTouch(&ts) && ts.touchDetected == 0, "touch state after touch up");
+
+	if(hostBenchmark()) {
+		time_us = hostLcdTimeUs();
+		for(i = 0; i < 1000000; i++)
+			CheckForUserInput();
+		printf("CheckForUserInput idle: %.1f ns\n", (hostLcdTimeUs() - time_us)*1000.0/1000000);
+	}
+
+	return hostTestEnd();
+}
@@ -0,0 +1,61 @@
+/**
+  ******************************************************************************
+  * @file    test_render.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   The render scheduler of stm32f7_render.c driven by hostVsync():
+  *					 frames come due at the rate asked for, frames the main loop
+  *					 doesn't take are dropped, and a line event that interrupts a
+  *					 HAL_LTDC call holding the handle lock keeps the frames coming.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_render.h"
+
+extern LTDC_HandleTypeDef hLtdcHandler;
+
+/**
+  * @brief  Frames drawn over a number of refreshes, taking each one due
+  */
+static uint32_t frames(uint32_t refreshes) {
+	uint32_t count = 0;
+
+	while(refreshes-- > 0) {
+		hostVsync(1);
+		if(renderBegin()) {
+			renderEnd();
+			count++;
+		}
+	}
+	return count;
+}
+
+int main(void) {
+	RenderStats stats;
+	uint32_t drawn;
+
+	hostTestBegin("test_render");
+
+	BSP_LCD_Init();
+	renderInit(RENDER_DEFAULT_FPS, 100);
+	drawn = frames(HOST_REFRESH_HZ);
+	HOST_CHECK(drawn >= RENDER_DEFAULT_FPS - 1 && drawn <= RENDER_DEFAULT_FPS + 1, "%u frames in one second at %u fps", drawn, RENDER_DEFAULT_FPS);
+
+	//A busy main loop takes one frame, the others are dropped rather than queued
+	hostVsync(HOST_REFRESH_HZ);
+	renderGetStats(&stats);
+	HOST_CHECK(renderBegin() == 1 && stats.dropped >= RENDER_DEFAULT_FPS - 2, "busy for one second: %u frames dropped", stats.dropped);
+	renderEnd();
+	HOST_CHECK(renderBegin() == 0, "a second frame without a refresh");
+
+	//The line event fires while a HAL_LTDC call holds the handle, as plotWaterfall() does on every row
+	hLtdcHandler.Lock = HAL_LOCKED;
+	hostVsync(HOST_REFRESH_HZ/RENDER_DEFAULT_FPS + 1);
+	hLtdcHandler.Lock = HAL_UNLOCKED;
+	drawn = frames(HOST_REFRESH_HZ);
+	HOST_CHECK(drawn >= RENDER_DEFAULT_FPS - 1, "%u frames in the second after a line event inside a locked HAL call", drawn);
+
+	return hostTestEnd();
+}
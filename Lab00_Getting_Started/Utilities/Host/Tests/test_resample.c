@@ -0,0 +1,174 @@
+/**
+  ******************************************************************************
+  * @file    test_resample.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   The polyphase resampler of stm32f7_resample.c against zero
+  *					 stuffing, filtering and dropping samples in double precision,
+  *					 the aliases of 48 kHz to 8 kHz and the images of 8 kHz to
+  *					 48 kHz, and the cycles per output from resampleBenchmark().
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_resample.h"
+
+#define NUM_SAMPLES 96000
+#define SKIP        1000							//Outputs left out while the filter fills
+
+static float32_t x[NUM_SAMPLES], y[6*NUM_SAMPLES], prototype[6*RESAMPLE_MAX_TAPS];
+static float32_t coeffs_f32[6*RESAMPLE_MAX_TAPS], state_f32[2*RESAMPLE_MAX_TAPS];
+static int16_t stereo[2*NUM_SAMPLES], coeffs_q15[6*RESAMPLE_MAX_TAPS], state_q15[2*RESAMPLE_MAX_TAPS];
+
+/**
+  * @brief  Amplitude of the tone at frequency (cycles per sample) in v
+  */
+static double amplitude(const float32_t *v, uint32_t n, double frequency) {
+	double re = 0, im = 0;
+	uint32_t i;
+
+	for(i = SKIP; i < n; i++) {
+		re += v[i]*cos(2*M_PI*frequency*i);
+		im += v[i]*sin(2*M_PI*frequency*i);
+	}
+	return 2*sqrt(re*re + im*im)/(n - SKIP);
+}
+
+/**
+  * @brief  Resample 3000 inputs in random blocks and compare every output with
+  *					the prototype run at up times the rate on the zero stuffed input
+  */
+static void checkExact(uint32_t up, uint32_t down, uint32_t taps) {
+	ResampleF32 rs;
+	uint32_t n = 3000, i, m, j, block, got, count = 0, extra = 0;
+	double sum, error = 0;
+	long u;
+
+	resampleDesign(prototype, up, down, taps);
+	resampleInitF32(&rs, up, down, taps, prototype, coeffs_f32, state_f32);
+	for(i = 0; i < n; i += block) {
+		block = 1 + hostRandom() % 37;
+		if(block > n - i) block = n - i;
+		got = resampleProcessF32(&rs, &x[i], &y[count], block, 1, 1);
+		extra += (got > RESAMPLE_MAX_OUTPUTS(block, up, down));
+		count += got;
+	}
+	HOST_CHECK(count == RESAMPLE_MAX_OUTPUTS(n, up, down) && extra == 0, "%u/%u: %u outputs from %u inputs", up, down, count, n);
+
+	for(m = 0; m < count; m++) {
+		sum = 0;
+		for(j = 0; j < up*taps; j++) {
+			u = (long)m*down - j;
+			if(u < 0) break;
+			if(u % up == 0) sum += prototype[j]*x[u/up];
+		}
+		error = fmax(error, fabs(sum - y[m]));
+	}
+	HOST_CHECK(error < 1e-5, "%u/%u: error %.2g", up, down, error);
+}
+
+int main(void) {
+	static const uint32_t ups[] = {1, 6, 2, 3, 5, 1}, downs[] = {6, 1, 3, 2, 7, 1};
+	static const double tones[] = {1000, 3000, 5000, 7000, 9000, 12500, 19000};
+	static const uint32_t bench_taps[] = {16, 32, 64, 128};
+	static const char *ratios[RESAMPLE_BENCH_RATIOS] = {"48k to 8k", "8k to 48k", "48k to 32k", "32k to 48k"};
+	float32_t cycles[4][2][RESAMPLE_BENCH_RATIOS], run[2][RESAMPLE_BENCH_RATIOS];
+	ResampleF32 rs_f32;
+	ResampleQ15 rs_q15;
+	uint32_t c, t, i, n, count, r, f, image, k;
+	double level, alias, passband, gain, worst, frequency;
+	int clobbered, scales;
+
+	hostTestBegin("test_resample");
+
+	HOST_CHECK(resampleInitF32(&rs_f32, 0, 1, 8, prototype, coeffs_f32, state_f32) != HAL_OK &&
+						 resampleInitF32(&rs_f32, 1, RESAMPLE_MAX_FACTOR + 1, 8, prototype, coeffs_f32, state_f32) != HAL_OK &&
+						 resampleInitF32(&rs_f32, 1, 2, RESAMPLE_MAX_TAPS + 1, prototype, coeffs_f32, state_f32) != HAL_OK,
+						 "resampleInitF32 out of range");
+
+	//Every output, the outputs of a block counted from the phase it ends on
+	for(i = 0; i < NUM_SAMPLES; i++)
+		x[i] = 0.5f*hostUniform();
+	for(c = 0; c < sizeof(ups)/sizeof(ups[0]); c++)
+		checkExact(ups[c], downs[c], 16);
+
+	//48 kHz to 8 kHz on the left slot in place, above 4 kHz is folded back and must be gone
+	resampleDesign(prototype, 1, 6, 256);
+	for(t = 0, passband = 0, alias = -200, clobbered = 0; t < sizeof(tones)/sizeof(tones[0]); t++) {
+		for(i = 0; i < NUM_SAMPLES; i++) {
+			stereo[2*i] = (int16_t)lrint(16000*sin(2*M_PI*tones[t]/48000*i));
+			stereo[2*i + 1] = -5;
+		}
+		resampleInitQ15(&rs_q15, 1, 6, 256, prototype, coeffs_q15, state_q15);
+		for(i = 0, count = 0; i < NUM_SAMPLES; i += 480)
+			count += resampleProcessQ15(&rs_q15, &stereo[2*i], &stereo[2*count], 480, 2, 2);
+		for(i = 0; i < count; i++)
+			y[i] = stereo[2*i]/16000.0f;
+		clobbered |= (stereo[2*NUM_SAMPLES - 1] != -5);
+		frequency = fmod(tones[t], 8000);
+		if(frequency > 4000) frequency = 8000 - frequency;
+		level = 20*log10(amplitude(y, count, frequency/8000) + 1e-12);
+		if(tones[t] < 4000)
+			passband = fmax(passband, fabs(level));
+		else
+			alias = fmax(alias, level);
+		if(hostBenchmark())
+			printf("48k to 8k, 256 taps: %5.0f Hz at %.2f dB\n", tones[t], level);
+	}
+	HOST_CHECK(!clobbered, "48k to 8k: the right slot written");
+	HOST_CHECK(passband < 0.1, "48k to 8k: passband %.2f dB out", passband);
+	HOST_CHECK(alias < -70, "48k to 8k: aliases at %.1f dB", alias);
+
+	//8 kHz to 48 kHz, the images of a 1 kHz tone about multiples of 8 kHz must be gone
+	n = 16000;
+	for(i = 0; i < n; i++)
+		x[i] = sinf(2*PI*1000/8000.0f*i);
+	resampleDesign(prototype, 6, 1, 32);
+	resampleInitF32(&rs_f32, 6, 1, 32, prototype, coeffs_f32, state_f32);
+	count = resampleProcessF32(&rs_f32, x, y, n, 1, 1);
+	gain = amplitude(y, count, 1000/48000.0);
+	for(image = 1, worst = -200; image < 6; image++) {
+		frequency = image*8000 - 1000;
+		worst = fmax(worst, 20*log10(amplitude(y, count, frequency/48000)/gain));
+		frequency = image*8000 + 1000;
+		if(frequency < 24000)
+			worst = fmax(worst, 20*log10(amplitude(y, count, frequency/48000)/gain));
+	}
+	HOST_CHECK(fabs(gain - 1) < 0.01 && worst < -70, "8k to 48k: gain %.3f, images at %.1f dB", gain, worst);
+
+	//The cost of an output is the taps of one phase, computing the 5 dropped outputs of 48k to 8k would be 6 times it
+	//The best of 9 runs, a run is a few microseconds on the host
+	for(t = 0; t < 4; t++) {
+		resampleBenchmark(bench_taps[t], cycles[t]);
+		for(k = 1; k < 9; k++) {
+			resampleBenchmark(bench_taps[t], run);
+			for(f = 0; f < 2; f++)
+				for(r = 0; r < RESAMPLE_BENCH_RATIOS; r++)
+					cycles[t][f][r] = fminf(cycles[t][f][r], run[f][r]);
+		}
+	}
+	for(f = 0, scales = 1; f < 2; f++)
+		for(r = 0; r < RESAMPLE_BENCH_RATIOS; r++)
+			scales &= (cycles[0][f][r] > 0 && cycles[3][f][r] > 1.5f*cycles[0][f][r]);
+	HOST_CHECK(scales, "resampleBenchmark: 128 taps per phase not 1.5 times the cost of 16");
+	HOST_CHECK(cycles[3][RESAMPLE_F32][0] < 4*cycles[3][RESAMPLE_F32][1],
+						 "resampleBenchmark: 48k to 8k %.1f cycles per output, 8k to 48k %.1f, the dropped outputs are computed",
+						 cycles[3][RESAMPLE_F32][0], cycles[3][RESAMPLE_F32][1]);
+	if(hostBenchmark()) {
+		printf("resampleBenchmark, cycles per output\ntaps/phase");
+		for(r = 0; r < RESAMPLE_BENCH_RATIOS; r++)
+			printf(" %10s", ratios[r]);
+		printf("\n");
+		for(f = 0; f < 2; f++) {
+			for(t = 0; t < 4; t++) {
+				printf("%s %6u", (f == RESAMPLE_Q15) ? "Q15" : "F32", bench_taps[t]);
+				for(r = 0; r < RESAMPLE_BENCH_RATIOS; r++)
+					printf(" %10.1f", cycles[t][f][r]);
+				printf("\n");
+			}
+		}
+	}
+
+	return hostTestEnd();
+}
@@ -0,0 +1,220 @@
+/**
+  ******************************************************************************
+  * @file    test_scope.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   The trigger engine of stm32f7_scope.c fed synthetic signals in
+  *					 blocks of random length, against a model that walks the signal
+  *					 one sample at a time: where each frame starts, the holdoff
+  *					 between triggers, the auto timeout, single frames, and the
+  *					 golden frame of plotScope().
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_scope.h"
+
+#define SIGNAL_LEN  40000
+#define MAX_FRAMES  (SIGNAL_LEN/4)
+
+typedef struct
+{
+	uint32_t start;						//Signal index of the first sample of the frame
+	uint8_t triggered;
+} Frame;
+
+static int16_t signal[SIGNAL_LEN];
+static Frame expected[MAX_FRAMES], captured[MAX_FRAMES];
+static Scope scope;
+
+/**
+  * @brief  A sine with a little noise so that no two frames are alike,
+	*					quiet between from and to when from < to
+  */
+static void makeSignal(float32_t period, float32_t amplitude, uint32_t quiet_from, uint32_t quiet_to) {
+	uint32_t i;
+
+	for(i = 0; i < SIGNAL_LEN; i++) {
+		if(i >= quiet_from && i < quiet_to)
+			signal[i] = (int16_t)(200*hostUniform() - 100);
+		else
+			signal[i] = (int16_t)(amplitude*sinf(2*PI*i/period) + 20*hostUniform());
+	}
+}
+
+/**
+  * @brief  The frames the trigger engine should take, one sample at a time
+  * @retval number of frames
+  */
+static uint32_t model(void) {
+	uint32_t count = 0, post, armed_at, next, i, t;
+	int32_t arm_level;
+	int edge_armed;
+
+	//Armed once there is enough history for the pre-trigger part
+	armed_at = scope.pre_trigger;
+	while(armed_at < SIGNAL_LEN && count < MAX_FRAMES) {
+		t = SIGNAL_LEN;
+		edge_armed = 0;
+		arm_level = (scope.trigger == SCOPE_RISING) ? scope.level - scope.hysteresis : scope.level + scope.hysteresis;
+		for(i = armed_at; i < SIGNAL_LEN; i++) {
+			if(scope.mode == SCOPE_AUTO && i - armed_at >= scope.auto_timeout)
+				break;
+			if(scope.trigger == SCOPE_LEVEL) {
+				if(signal[i] >= scope.level) { t = i; break; }
+			} else if(scope.trigger == SCOPE_RISING) {
+				if(!edge_armed) edge_armed = (signal[i] < arm_level);
+				else if(signal[i] >= scope.level) { t = i; break; }
+			} else {
+				if(!edge_armed) edge_armed = (signal[i] > arm_level);
+				else if(signal[i] <= scope.level) { t = i; break; }
+			}
+		}
+
+		if(t < SIGNAL_LEN) {
+			//The trigger sample is the first one after the pre-trigger part
+			expected[count].triggered = 1;
+			next = t + 1;
+			post = scope.frame_len - scope.pre_trigger - 1;
+		} else if(i < SIGNAL_LEN && scope.mode == SCOPE_AUTO) {
+			//No trigger in time, free-run from the sample after the timeout
+			expected[count].triggered = 0;
+			t = next = i;
+			post = scope.frame_len - scope.pre_trigger;
+		} else {
+			break;
+		}
+		if(next + post > SIGNAL_LEN)
+			break;
+		expected[count++].start = t - scope.pre_trigger;
+		if(scope.mode == SCOPE_SINGLE)
+			break;
+		armed_at = next + ((post > scope.holdoff) ? post : scope.holdoff);
+	}
+	return count;
+}
+
+/**
+  * @brief  Feed the signal in blocks of 1 to max_block samples, taking each
+	*					frame out as soon as it is ready
+  * @retval number of frames
+  */
+static uint32_t run(uint32_t max_block) {
+	uint32_t i = 0, n, count = 0, start;
+
+	while(i < SIGNAL_LEN) {
+		n = 1 + hostRandom() % max_block;
+		if(n > SIGNAL_LEN - i) n = SIGNAL_LEN - i;
+		scopeAddBlock(&scope, &signal[i], n);
+		i += n;
+		if(scope.frame_ready && count < MAX_FRAMES) {
+			//Where in the signal the frame came from
+			for(start = 0; start + scope.frame_len <= i; start++)
+				if(memcmp(&signal[start], scope.frame, scope.frame_len*sizeof(int16_t)) == 0)
+					break;
+			captured[count].start = start;
+			captured[count].triggered = scope.frame_triggered;
+			count++;
+			scope.frame_ready = 0;
+		}
+	}
+	return count;
+}
+
+/**
+  * @brief  Run the scope with the current settings and compare it with the model
+  * @retval number of frames
+  */
+static uint32_t check(const char *name, uint32_t max_block) {
+	uint32_t n_expected, n_captured, i, wrong = 0;
+
+	n_expected = model();
+	n_captured = run(max_block);
+	HOST_CHECK(n_captured == n_expected, "%s: %u frames, not %u", name, n_captured, n_expected);
+	for(i = 0; i < n_captured && i < n_expected; i++)
+		wrong += (captured[i].start != expected[i].start || captured[i].triggered != expected[i].triggered);
+	HOST_CHECK(wrong == 0, "%s: %u frames in the wrong place", name, wrong);
+	HOST_CHECK(scope.dropped == 0, "%s: %u frames dropped", name, scope.dropped);
+	return n_captured;
+}
+
+int main(void) {
+	uint32_t i, n, triggered;
+
+	hostTestBegin("test_scope");
+
+	//Rising edge, the frame starts pre_trigger samples before the crossing
+	makeSignal(100.3f, 10000, 0, 0);
+	scopeInit(&scope, 256, 64);
+	scopeSetTrigger(&scope, SCOPE_RISING, 2000, 256);
+	n = check("rising", 64);
+	HOST_CHECK(n > 100, "rising: only %u frames", n);
+	for(i = 0; i < n; i++) {
+		triggered = captured[i].start + 64;
+		HOST_CHECK(signal[triggered] >= 2000 && signal[triggered - 1] < 2000, "rising: frame %u not on the edge", i);
+	}
+
+	//Falling edge in normal mode, the hysteresis ignores the noise on the slope
+	scopeInit(&scope, 200, 20);
+	scopeSetTrigger(&scope, SCOPE_FALLING, -3000, 500);
+	scopeSetMode(&scope, SCOPE_NORMAL, 200, 0);
+	check("falling", 17);
+
+	//Level trigger, pre-trigger part as long as it can be
+	scopeInit(&scope, 300, 299);
+	scopeSetTrigger(&scope, SCOPE_LEVEL, 9000, 0);
+	scopeSetMode(&scope, SCOPE_NORMAL, 300, 0);
+	check("level", 200);
+
+	//A holdoff of several periods skips the triggers in between
+	scopeInit(&scope, 256, 128);
+	scopeSetTrigger(&scope, SCOPE_RISING, 0, 256);
+	scopeSetMode(&scope, SCOPE_NORMAL, 1000, 0);
+	n = check("holdoff", 33);
+	for(i = 1; i < n; i++)
+		HOST_CHECK(captured[i].start - captured[i - 1].start >= 1000, "holdoff: frames %u and %u only %u samples apart",
+							 i - 1, i, captured[i].start - captured[i - 1].start);
+
+	//No trigger while the signal is quiet, auto mode free-runs every timeout
+	makeSignal(97.1f, 8000, 10000, 30000);
+	scopeInit(&scope, 256, 32);
+	scopeSetTrigger(&scope, SCOPE_RISING, 4000, 256);
+	scopeSetMode(&scope, SCOPE_AUTO, 256, 2000);
+	n = check("auto", 64);
+	for(i = 0, triggered = 0; i < n; i++)
+		triggered += captured[i].triggered;
+	HOST_CHECK(triggered > 0 && triggered < n, "auto: %u of %u frames triggered", triggered, n);
+
+	//Normal mode waits through the quiet part
+	scopeInit(&scope, 256, 32);
+	scopeSetTrigger(&scope, SCOPE_RISING, 4000, 256);
+	scopeSetMode(&scope, SCOPE_NORMAL, 256, 0);
+	n = check("normal", 64);
+	for(i = 0; i < n; i++)
+		HOST_CHECK(captured[i].start + 32 < 10000 || captured[i].start + 32 >= 30000, "normal: frame %u in the quiet part", i);
+
+	//One frame, nothing more until it is armed again
+	scopeInit(&scope, 256, 32);
+	scopeSetTrigger(&scope, SCOPE_RISING, 4000, 256);
+	scopeSetMode(&scope, SCOPE_SINGLE, 256, 0);
+	n = check("single", 64);
+	HOST_CHECK(n == 1 && scope.state == SCOPE_STOPPED, "single: %u frames, state %u", n, scope.state);
+	scopeArm(&scope);
+	scopeAddBlock(&scope, signal, 2000);
+	HOST_CHECK(scope.frame_ready, "single: no frame after scopeArm()");
+
+	//A frame of the rising trigger as it is drawn
+	hostPressButton(1);
+	stm32f7_LCD_init(8000, "Host test", GRAPH);
+	makeSignal(100.3f, 10000, 0, 0);
+	scopeInit(&scope, 256, 64);
+	scopeSetTrigger(&scope, SCOPE_RISING, 2000, 256);
+	scopeAddBlock(&scope, signal, 1000);
+	hostVsync(HOST_REFRESH_HZ/RENDER_DEFAULT_FPS + 1);
+	plotScope(&scope);
+	hostCheckFrame("scope_rising");
+
+	HOST_CHECK(hostLcdStats.out_of_range == 0, "%llu writes outside the SDRAM", (unsigned long long)hostLcdStats.out_of_range);
+	return hostTestEnd();
+}
@@ -0,0 +1,154 @@
+/**
+  ******************************************************************************
+  * @file    test_tone.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   The tone detectors of stm32f7_tone.c against the DFT at each
+  *					 frequency in double precision: amplitude and phase from the
+  *					 Goertzel frames and from the tapered window of the sliding DFT
+  *					 after a long run, the phase of a one second frame, and the
+  *					 cost per detector from toneBenchmark().
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_tone.h"
+
+#define FS          48000
+#define FRAME       480
+#define NUM_TONES   3
+#define LONG_FRAME  48000
+
+static const float32_t frequencies[NUM_TONES] = {1000, 1234.5f, 15000.3f};
+static float32_t memory[TONE_MEMORY(NUM_TONES, LONG_FRAME)], window[FRAME], samples[LONG_FRAME];
+static int16_t stereo[2*4*FRAME];
+
+/**
+  * @brief  Amplitude and phase at frequency of n samples, oldest first, the
+  *					newest weighted 1 and each older one r times the next
+  */
+static void dft(const float32_t *x, uint32_t n, double frequency, double r, double *amplitude, double *phase) {
+	double re = 0, im = 0, weight = 1, sum = 0;
+	uint32_t i;
+
+	for(i = n; i-- > 0; weight *= r) {
+		re += weight*x[i]*cos(2*M_PI*frequency*i/FS);
+		im -= weight*x[i]*sin(2*M_PI*frequency*i/FS);
+		sum += weight;
+	}
+	*amplitude = 2*sqrt(re*re + im*im)/sum;
+	*phase = atan2(im, re);
+}
+
+/**
+  * @brief  Largest amplitude and phase errors of a bank against dft(), the
+  *					phase only where the amplitude is big enough to have one
+  */
+static void compare(const ToneBank *bank, const float32_t *x, double r, double *amplitude_error, double *phase_error) {
+	double amplitude, phase, difference;
+	uint32_t t;
+
+	for(t = 0; t < NUM_TONES; t++) {
+		dft(x, FRAME, frequencies[t], r, &amplitude, &phase);
+		*amplitude_error = fmax(*amplitude_error, fabs(bank->magnitude[t] - amplitude));
+		difference = remainder(bank->phase[t] - phase, 2*M_PI);
+		if(amplitude > 0.01)
+			*phase_error = fmax(*phase_error, fabs(difference));
+	}
+}
+
+int main(void) {
+	static const char *methods[2] = {"Goertzel", "sliding DFT"};
+	const float32_t nyquist = FS/2, one_second = 1000.37f;
+	float32_t cycles[2], run[2], block[96];
+	ToneBank bank;
+	uint32_t i, b, n, count;
+	double amplitude_error, phase_error, r;
+	int ready, frames;
+
+	hostTestBegin("test_tone");
+
+	HOST_CHECK(toneInit(&bank, TONE_GOERTZEL, FRAME, FS, &nyquist, 1, memory) == HAL_ERROR &&
+						 toneInit(&bank, TONE_GOERTZEL, 1, FS, frequencies, 1, memory) == HAL_ERROR &&
+						 toneInit(&bank, TONE_SLIDING + 1, FRAME, FS, frequencies, 1, memory) == HAL_ERROR &&
+						 toneInit(&bank, TONE_GOERTZEL, FRAME, FS, frequencies, TONE_MAX_DETECTORS + 1, memory) == HAL_ERROR,
+						 "toneInit out of range");
+
+	//Goertzel on one slot of four frames of a tone between the first two detectors and noise, in blocks of 37
+	toneInit(&bank, TONE_GOERTZEL, FRAME, FS, frequencies, NUM_TONES, memory);
+	for(i = 0; i < 4*FRAME; i++) {
+		stereo[2*i] = (int16_t)lrint(16000*cos(2*M_PI*1234.5*i/FS + 0.7) + 2000*hostUniform());
+		stereo[2*i + 1] = 32767;
+	}
+	for(i = 0, frames = 0, amplitude_error = phase_error = 0; i < 4*FRAME; i += n) {
+		n = (4*FRAME - i < 37) ? 4*FRAME - i : 37;
+		ready = toneProcessQ15(&bank, &stereo[2*i], n, 2);
+		frames += ready;
+		//A frame ended in this block, compare its last FRAME samples
+		if(ready) {
+			for(count = 0; count < FRAME; count++)
+				window[count] = stereo[2*((i + n)/FRAME*FRAME - FRAME + count)]/32768.0f;
+			compare(&bank, window, 1, &amplitude_error, &phase_error);
+		}
+	}
+	HOST_CHECK(frames == 4, "Goertzel: %d results from 4 frames", frames);
+	HOST_CHECK(amplitude_error < 1e-5 && phase_error < 1e-4, "Goertzel: amplitude off by %.2g, phase by %.2g rad",
+						 amplitude_error, phase_error);
+	HOST_CHECK(fabsf(bank.magnitude[1] - 16000/32768.0f) < 0.01f, "Goertzel: %.4f for a tone of %.4f",
+						 bank.magnitude[1], 16000/32768.0f);
+
+	//Several frames in one call give the last
+	toneReset(&bank);
+	ready = toneProcessQ15(&bank, stereo, 4*FRAME, 2);
+	for(count = 0; count < FRAME; count++)
+		window[count] = stereo[2*(3*FRAME + count)]/32768.0f;
+	amplitude_error = phase_error = 0;
+	compare(&bank, window, 1, &amplitude_error, &phase_error);
+	HOST_CHECK(ready == 1 && amplitude_error < 1e-5, "Goertzel: four frames in one call, the last off by %.2g", amplitude_error);
+
+	//The sliding DFT against its tapered window after every block for 40 seconds, its rounding errors must not build up
+	toneInit(&bank, TONE_SLIDING, FRAME, FS, frequencies, NUM_TONES, memory);
+	r = exp(-TONE_SLIDING_LEAK/FRAME);
+	for(b = 0, amplitude_error = phase_error = 0, frames = 0; b < 20000; b++) {
+		for(i = 0; i < 96; i++) {
+			block[i] = 0.5f*sinf(2*PI*1000.0f*((b*96 + i) % FS)/FS) + 0.15f*hostUniform();
+			samples[(b*96 + i) % FRAME] = block[i];
+		}
+		frames += toneProcessF32(&bank, block, 96, 1);
+		if(b % 1000 == 999) {
+			for(i = 0; i < FRAME; i++)
+				window[i] = samples[((b + 1)*96 + i) % FRAME];
+			compare(&bank, window, r, &amplitude_error, &phase_error);
+		}
+	}
+	HOST_CHECK(frames == 20000, "sliding DFT: %d results from 20000 blocks", frames);
+	HOST_CHECK(amplitude_error < 2e-4 && phase_error < 1e-3, "sliding DFT: amplitude off by %.2g, phase by %.2g rad after 40 s",
+						 amplitude_error, phase_error);
+	if(hostBenchmark())
+		printf("sliding DFT after 40 s: amplitude off by %.2g, phase by %.2g rad\n", amplitude_error, phase_error);
+
+	//A one second frame keeps its phase in single precision
+	toneInit(&bank, TONE_GOERTZEL, LONG_FRAME, FS, &one_second, 1, memory);
+	for(i = 0; i < LONG_FRAME; i++)
+		samples[i] = (float32_t)(0.25*cos(2*M_PI*one_second*i/FS - 1.0));
+	toneProcessF32(&bank, samples, LONG_FRAME, 1);
+	HOST_CHECK(fabsf(bank.magnitude[0] - 0.25f) < 1e-4f && fabsf(bank.phase[0] + 1.0f) < 0.01f,
+						 "one second frame: amplitude %.5f, phase %.4f rad", bank.magnitude[0], bank.phase[0]);
+
+	//The best of 5 runs, the sliding DFT does more work per sample
+	toneBenchmark(cycles);
+	for(i = 1; i < 5; i++) {
+		toneBenchmark(run);
+		cycles[TONE_GOERTZEL] = fminf(cycles[TONE_GOERTZEL], run[TONE_GOERTZEL]);
+		cycles[TONE_SLIDING] = fminf(cycles[TONE_SLIDING], run[TONE_SLIDING]);
+	}
+	HOST_CHECK(cycles[TONE_GOERTZEL] > 0 && cycles[TONE_SLIDING] > cycles[TONE_GOERTZEL],
+						 "toneBenchmark: Goertzel %.2f, sliding DFT %.2f cycles", cycles[TONE_GOERTZEL], cycles[TONE_SLIDING]);
+	if(hostBenchmark())
+		for(i = 0; i < 2; i++)
+			printf("toneBenchmark %-11s %.2f cycles per detector and sample, %.1f%% of the core for %u detectors\n", methods[i],
+						 cycles[i], 100.0f*cycles[i]*TONE_BENCH_DETECTORS*FS/SystemCoreClock, TONE_BENCH_DETECTORS);
+
+	return hostTestEnd();
+}
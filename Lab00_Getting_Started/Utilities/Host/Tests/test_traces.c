@@ -0,0 +1,103 @@
+/**
+  ******************************************************************************
+  * @file    test_traces.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Golden frames of plotTraces(): the three styles over buffers
+  *					 longer than the graph, drawn as envelopes, and short ones drawn
+  *					 sample by sample, and plotEnvelopes() fed envelopes built in
+  *					 blocks.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_display.h"
+#include "stm32f7_traces.h"
+
+#define LONG  4000
+#define SHORT 64
+
+static float32_t input[LONG], echo[LONG], impulse[SHORT], inverted[SHORT];
+static Envelope envelopes[2];
+static uint32_t blocks[RK043FN48H_WIDTH*RK043FN48H_HEIGHT], whole[RK043FN48H_WIDTH*RK043FN48H_HEIGHT];
+
+//Set by proceed_statement() between screens so drawAxes() redraws the y axis
+extern int update_flag;
+
+/**
+  * @brief  Draw one frame on a new screen, after enough panel refreshes that
+  *					the render scheduler has one due at RENDER_DEFAULT_FPS
+  */
+#define DRAW(name, call) \
+	do { \
+		clearScreen(); \
+		clearLabels(); \
+		update_flag = 1; \
+		hostVsync(HOST_REFRESH_HZ/RENDER_DEFAULT_FPS + 1); \
+		if(hostBenchmark()) \
+			HOST_LCD_BENCH(name, call); \
+		else \
+			call; \
+	} while(0)
+
+int main(void) {
+	int i;
+	uint64_t transfers;
+	float32_t max, min;
+	Trace traces[3] = {
+		{input, LONG, LCD_COLOR_BLUE, TRACE_BARS},
+		{echo, LONG, LCD_COLOR_RED, TRACE_LINE},
+		{impulse, SHORT, 0xFF008000, TRACE_DOTS}};
+	Trace short_traces[2] = {
+		{impulse, SHORT, LCD_COLOR_BLUE, TRACE_BARS},
+		{inverted, SHORT, LCD_COLOR_RED, TRACE_LINE}};
+
+	hostTestBegin("test_traces");
+	hostPressButton(1);
+	stm32f7_LCD_init(8000, "Traces", GRAPH);
+
+	//A tone and its echo 800 samples later
+	for(i = 0; i < LONG; i++) {
+		input[i] = 8000*sinf(2*PI*i/400.0f);
+		echo[i] = 0.5f*input[i] + ((i >= 800) ? 0.6f*input[i - 800] : 0);
+	}
+	for(i = 0; i < SHORT; i++) {
+		impulse[i] = 6000*cosf(2*PI*i/32.0f);
+		inverted[i] = -0.7f*impulse[i];
+	}
+
+	DRAW("plotTraces 1", plotTraces(traces, 1, LIVE));
+	hostCheckFrame("traces_one");
+	DRAW("plotTraces 3", plotTraces(traces, 3, LIVE));
+	hostCheckFrame("traces_three");
+	DRAW("plotTraces short", plotTraces(short_traces, 2, LIVE));
+	hostCheckFrame("traces_short");
+
+	//The same long traces from envelopes added a block at a time
+	max = min = input[0];
+	for(i = 0; i < 2; i++)
+		envelopeInit(&envelopes[i], LONG);
+	for(i = 0; i < LONG; i += 100) {
+		envelopeAddF32(&envelopes[0], &input[i], 100);
+		envelopeAddF32(&envelopes[1], &echo[i], 100);
+	}
+	for(i = 0; i < LONG; i++) {
+		if(input[i] > max) max = input[i];
+		if(echo[i] > max) max = echo[i];
+		if(input[i] < min) min = input[i];
+		if(echo[i] < min) min = echo[i];
+	}
+	transfers = hostLcdStats.dma2d_transfers;
+	DRAW("plotEnvelopes 2", plotEnvelopes(envelopes, traces, 2, max, min, LONG));
+	transfers = hostLcdStats.dma2d_transfers - transfers;
+	hostCheckFrame("traces_envelopes");
+	HOST_CHECK(transfers < 64, "plotEnvelopes: %llu DMA2D transfers, not one for the graph", (unsigned long long)transfers);
+	hostLcdCompose(blocks);
+	DRAW("plotTraces 2", plotTraces(traces, 2, LIVE));
+	hostLcdCompose(whole);
+	HOST_CHECK(memcmp(blocks, whole, sizeof(whole)) == 0, "envelopes added in blocks draw differently from plotTraces()");
+
+	HOST_CHECK(hostLcdStats.out_of_range == 0, "%llu writes outside the SDRAM", (unsigned long long)hostLcdStats.out_of_range);
+	return hostTestEnd();
+}
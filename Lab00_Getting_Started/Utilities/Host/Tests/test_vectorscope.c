@@ -0,0 +1,147 @@
+/**
+  ******************************************************************************
+  * @file    test_vectorscope.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   stm32f7_vectorscope.c fed a tone on both channels 0, 90 and 180
+  *					 degrees apart, in XY and in mid/side: the shape the points make,
+  *					 the correlation, the fade and golden frames of each.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_vectorscope.h"
+
+#define VECTOR_LEFT   (GRAPH_WIDTH/2 - VECTOR_HALF)		//As in stm32f7_vectorscope.c
+#define FS            48000
+#define TONE          997.0f						//Not a divisor of FS so the trace fills in
+#define AMPLITUDE     6000						//Mono stays inside the square in M/S too
+#define RANGE         10000
+#define BLOCK         128
+#define BLOCKS        40
+#define PLOT_EVERY    10
+
+static int16_t frames[2*BLOCK];
+static VectorScope vs;
+
+/**
+  * @brief  Tones on the left and right, the right phase degrees ahead, plotted
+  *					every PLOT_EVERY blocks like the lab's main loop
+  */
+static void feed(uint8_t mode, float32_t phase) {
+	uint32_t b, i, n = 0;
+	float32_t angle;
+
+	clearScreen();
+	vectorScopeInit(&vs, mode, RANGE);
+	for(b = 0; b < BLOCKS; b++) {
+		for(i = 0; i < BLOCK; i++, n++) {
+			angle = 2*PI*TONE*n/FS;
+			frames[2*i] = (int16_t)(AMPLITUDE*sinf(angle));
+			frames[2*i + 1] = (int16_t)(AMPLITUDE*sinf(angle + phase*PI/180));
+		}
+		vectorScopeAddStereo(&vs, frames, BLOCK);
+		if(b % PLOT_EVERY == PLOT_EVERY - 1) {
+			if(b == BLOCKS - 1 && hostBenchmark())
+				HOST_LCD_BENCH("plotVectorScope", plotVectorScope(&vs, 3));
+			else
+				plotVectorScope(&vs, 3);
+		}
+	}
+}
+
+/**
+  * @brief  Every lit pixel of the square against the shape the tones make,
+  *					a line at angle degrees through the centre or a circle
+  * @param  line: 1 for a line, 0 for a circle
+  * @param  angle: direction of the line
+  * @param  radius: half its length, or the radius of the circle, in pixels
+  * @retval number of pixels off the shape
+  */
+static uint32_t offShape(int line, float32_t angle, float32_t radius) {
+	const uint8_t *image = (const uint8_t *)VECTOR_BUFFER;
+	uint32_t row, column, off = 0, lit = 0;
+	float32_t dx, dy, distance, extent = 0;
+
+	for(row = 0; row < VECTOR_ROWS; row++) {
+		for(column = 0; column < GRAPH_WIDTH; column++) {
+			if(image[row*GRAPH_WIDTH + column] == 0)
+				continue;
+			lit++;
+			dx = (float32_t)column - VECTOR_LEFT - VECTOR_HALF;
+			dy = (float32_t)VECTOR_HALF - row;
+			distance = sqrtf(dx*dx + dy*dy);
+			if(distance > extent) extent = distance;
+			if(line)
+				off += (fabsf(dx*sinf(angle*PI/180) - dy*cosf(angle*PI/180)) > 1.5f);
+			else
+				off += (fabsf(distance - radius) > 2);		//Both axes round down
+		}
+	}
+	//The ends of a line reach the radius, and there is something to see
+	if(line && fabsf(extent - radius) > 1.5f) off++;
+	return (lit > 20) ? off : lit + 1;
+}
+
+int main(void) {
+	static const struct {
+		uint8_t mode;
+		float32_t phase;
+		int line;
+		float32_t angle;
+		float32_t length;					//In units of AMPLITUDE
+		float32_t correlation;
+		const char *frame;
+	} cases[] = {
+		//Equal tones lie on the diagonal in XY and on the mid axis in M/S, M = (L + R)/sqrt(2)
+		{VECTOR_XY, 0, 1, 45, 1.41421356f, 1, "vectorscope_xy_0"},
+		{VECTOR_XY, 90, 0, 0, 1, 0, "vectorscope_xy_90"},
+		{VECTOR_XY, 180, 1, -45, 1.41421356f, -1, "vectorscope_xy_180"},
+		{VECTOR_MS, 0, 1, 90, 1.41421356f, 1, "vectorscope_ms_0"},
+		{VECTOR_MS, 90, 0, 0, 1, 0, "vectorscope_ms_90"},
+		{VECTOR_MS, 180, 1, 0, 1.41421356f, -1, "vectorscope_ms_180"},
+	};
+	const uint8_t *image = (const uint8_t *)VECTOR_BUFFER;
+	float32_t pixels_per_unit = (float32_t)VECTOR_HALF/RANGE, dx = 0, dy = 0;
+	int16_t left_only[2] = {AMPLITUDE, 0};
+	uint32_t c, i, off, lit, frame;
+
+	hostTestBegin("test_vectorscope");
+	hostPressButton(1);
+	stm32f7_LCD_init(FS, "Vector scope", GRAPH);
+
+	for(c = 0; c < sizeof(cases)/sizeof(cases[0]); c++) {
+		feed(cases[c].mode, cases[c].phase);
+		off = offShape(cases[c].line, cases[c].angle, cases[c].length*AMPLITUDE*pixels_per_unit);
+		HOST_CHECK(off == 0, "%s: %u pixels off the %s", cases[c].frame, off, cases[c].line ? "line" : "circle");
+		HOST_CHECK(fabsf(vs.correlation - cases[c].correlation) < 0.02f, "%s: correlation %.3f, not %.0f",
+							 cases[c].frame, vs.correlation, cases[c].correlation);
+		hostCheckFrame(cases[c].frame);
+	}
+
+	//A left only signal keeps its length in M/S, up and to the left at 45 degrees
+	vectorScopeInit(&vs, VECTOR_MS, RANGE);
+	vectorScopeAddStereo(&vs, left_only, 1);
+	for(i = 0, lit = 0; i < GRAPH_WIDTH*VECTOR_ROWS; i++) {
+		if(image[i] == 0)
+			continue;
+		lit++;
+		dx = (float32_t)(i % GRAPH_WIDTH) - VECTOR_LEFT - VECTOR_HALF;
+		dy = (float32_t)VECTOR_HALF - i/GRAPH_WIDTH;
+	}
+	HOST_CHECK(lit == 1 && fabsf(dx + dy) <= 1 && fabsf(sqrtf(dx*dx + dy*dy) - AMPLITUDE*pixels_per_unit) <= 1.5f,
+						 "left only in M/S: %u pixels, the last at %.0f, %.0f", lit, dx, dy);
+
+	//With no new points every pixel fades out and no row is left to copy
+	feed(VECTOR_XY, 90);
+	for(frame = 0; frame < 64 && vs.top <= vs.bottom; frame++)
+		plotVectorScope(&vs, 3);
+	for(i = 0, lit = 0; i < GRAPH_WIDTH*VECTOR_ROWS; i++)
+		lit += (image[i] != 0);
+	HOST_CHECK(lit == 0 && vs.top > vs.bottom, "%u pixels lit and rows %d to %d after %u frames of fading", lit, vs.top, vs.bottom, frame);
+	HOST_CHECK(frame < 64, "still fading after %u frames", frame);
+
+	HOST_CHECK(hostLcdStats.out_of_range == 0, "%llu writes outside the SDRAM", (unsigned long long)hostLcdStats.out_of_range);
+	return hostTestEnd();
+}
@@ -0,0 +1,29 @@
+/**
+  ******************************************************************************
+  * @file    arm_math.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Host stand-in for the CMSIS-DSP header, see host_lcd.h.
+  *          Only the types used by the display modules.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _ARM_MATH_H
+#define _ARM_MATH_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <math.h>
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+typedef int8_t q7_t;
+typedef int16_t q15_t;
+typedef int32_t q31_t;
+typedef float float32_t;
+typedef double float64_t;
+
+/* Exported constants --------------------------------------------------------*/
+#define PI 3.14159265358979f
+
+#endif /* _ARM_MATH_H */
@@ -0,0 +1,242 @@
+/**
+  ******************************************************************************
+  * @file    bmp2rle.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Host tool that turns a 24 or 32 bit BMP into a palette + RLE
+  *          image header for drawRleImage() (stm32f7_image.c).
+  *
+  *          gcc -O2 bmp2rle.c -o bmp2rle
+  *          ./bmp2rle ../Media/Pictures/BMP_372x126/armlogo.bmp armlogo > armlogo.h
+  *
+  *          Built with -DBMP2RLE_NO_MAIN it is the bmpToRle() encoder of
+  *          bmp2rle.h only, Tests/test_bmp2rle.c decodes what it codes.
+  *
+  *          Images with more than 256 colours are reduced by merging the
+  *          least used colour into its nearest neighbour, the largest colour
+  *          error is reported on stderr. Each row is coded on its own:
+  *            0x80 | (n - 2), index   : n = 2..129 pixels of one colour
+  *            n - 1, n indices        : n = 1..128 pixels copied as they are
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bmp2rle.h"
+
+static uint32_t colours[1 << 16];
+static uint32_t counts[1 << 16];
+static uint32_t merged_into[1 << 16];
+static uint32_t slot[1 << 16];
+static uint32_t num_colours = 0;
+
+static uint32_t readLE(const uint8_t *p, int bytes) {
+	uint32_t v = 0;
+
+	while(bytes--) v = (v << 8) | p[bytes];
+	return v;
+}
+
+static uint32_t colourDistance(uint32_t a, uint32_t b) {
+	int dr = (int)((a >> 16) & 0xFF) - (int)((b >> 16) & 0xFF);
+	int dg = (int)((a >> 8) & 0xFF) - (int)((b >> 8) & 0xFF);
+	int db = (int)(a & 0xFF) - (int)(b & 0xFF);
+
+	return dr*dr + dg*dg + db*db;
+}
+
+static uint32_t findColour(uint32_t rgb) {
+	uint32_t i;
+
+	for(i = 0; i < num_colours; i++)
+		if(colours[i] == rgb) return i;
+	return num_colours;
+}
+
+/**
+  * @brief  Palette slot used for a colour after merging
+  */
+
+static uint32_t paletteSlot(uint32_t colour, const uint32_t *slot) {
+	while(merged_into[colour] != colour) colour = merged_into[colour];
+	return slot[colour];
+}
+
+/**
+  * @brief  Convert a BMP file into a palette + RLE image
+  * @param  bmp: the whole BMP file
+  * @param  size: its size in bytes
+  * @param  image: the image, image->data is malloc()ed
+  * @retval NULL = converted, otherwise what is wrong with the file
+  */
+
+const char *bmpToRle(const uint8_t *bmp, uint32_t size, RleCoded *image) {
+	uint8_t *row_indices, *out;
+	uint32_t offset, width, height, bpp, stride, x, y, i, j, c, best, dist, best_dist, worst = 0;
+	uint32_t live, out_len = 0, run, lit, used = 0;
+	uint32_t *pixels;
+	int32_t signed_height;
+
+	if(size < 54 || bmp[0] != 'B' || bmp[1] != 'M')
+		return "not a BMP file";
+
+	offset = readLE(bmp + 10, 4);
+	width = readLE(bmp + 18, 4);
+	signed_height = (int32_t)readLE(bmp + 22, 4);
+	height = (signed_height < 0) ? -signed_height : signed_height;
+	bpp = readLE(bmp + 28, 2);
+	if((bpp != 24 && bpp != 32) || readLE(bmp + 30, 4) != 0 || width > 0xFFFF || height > 0xFFFF)
+		return "only uncompressed 24 or 32 bit BMP files";
+	stride = (width*(bpp/8) + 3) & ~3u;
+	if(offset + stride*height > size)
+		return "file is too short";
+
+	//Pixels top to bottom as RGB888
+	num_colours = 0;
+	memset(counts, 0, sizeof(counts));
+	pixels = malloc(width*height*sizeof(uint32_t));
+	for(y = 0; y < height; y++) {
+		const uint8_t *p = bmp + offset + stride*((signed_height < 0) ? y : height - 1 - y);
+		for(x = 0; x < width; x++, p += bpp/8) {
+			pixels[y*width + x] = (p[2] << 16) | (p[1] << 8) | p[0];
+			c = findColour(pixels[y*width + x]);
+			if(c == num_colours) {
+				if(num_colours == (1 << 16)) {
+					free(pixels);
+					return "too many colours";
+				}
+				colours[num_colours++] = pixels[y*width + x];
+			}
+			counts[c]++;
+		}
+	}
+
+	//Merge the least used colour into the nearest one until the palette fits
+	for(i = 0; i < num_colours; i++) merged_into[i] = i;
+	for(live = num_colours; live > MAX_COLOURS; live--) {
+		best = num_colours;
+		for(i = 0; i < num_colours; i++)
+			if(merged_into[i] == i && (best == num_colours || counts[i] < counts[best])) best = i;
+		c = best;
+		best = num_colours;
+		best_dist = 0xFFFFFFFF;
+		for(i = 0; i < num_colours; i++) {
+			if(merged_into[i] != i || i == c) continue;
+			dist = colourDistance(colours[i], colours[c]);
+			if(dist < best_dist) { best_dist = dist; best = i; }
+		}
+		merged_into[c] = best;
+		counts[best] += counts[c];
+	}
+	for(i = 0; i < num_colours; i++) {
+		if(merged_into[i] == i) {
+			slot[i] = used;
+			image->palette[used++] = 0xFF000000u | colours[i];
+		}
+	}
+	for(i = 0; i < num_colours; i++) {
+		c = paletteSlot(i, slot);
+		dist = colourDistance(colours[i], image->palette[c]);
+		if(dist > worst) worst = dist;
+	}
+
+	//Run length code each row
+	row_indices = malloc(width);
+	out = malloc(2*width*height + 16);
+	for(y = 0; y < height; y++) {
+		for(x = 0; x < width; x++)
+			row_indices[x] = paletteSlot(findColour(pixels[y*width + x]), slot);
+		x = 0;
+		while(x < width) {
+			for(run = 1; x + run < width && run < 129 && row_indices[x + run] == row_indices[x]; run++);
+			if(run >= 2) {
+				out[out_len++] = 0x80 | (run - 2);
+				out[out_len++] = row_indices[x];
+				x += run;
+				continue;
+			}
+			//Literal up to the next pair of equal pixels
+			for(lit = 1; x + lit < width && lit < 128; lit++)
+				if(x + lit + 1 < width && row_indices[x + lit] == row_indices[x + lit + 1]) break;
+			out[out_len++] = lit - 1;
+			for(j = 0; j < lit; j++) out[out_len++] = row_indices[x + j];
+			x += lit;
+		}
+	}
+
+	free(row_indices);
+	free(pixels);
+
+	image->width = width;
+	image->height = height;
+	image->colours = used;
+	image->source_colours = num_colours;
+	image->worst = worst;
+	image->data = out;
+	image->data_len = out_len;
+	return NULL;
+}
+
+#ifndef BMP2RLE_NO_MAIN
+int main(int argc, char *argv[]) {
+	FILE *file;
+	uint8_t *bmp;
+	long size;
+	uint32_t i;
+	const char *error;
+	RleCoded image;
+
+	if(argc != 3) {
+		fprintf(stderr, "usage: %s image.bmp name > name.h\n", argv[0]);
+		return 1;
+	}
+
+	file = fopen(argv[1], "rb");
+	if(file == NULL) {
+		perror(argv[1]);
+		return 1;
+	}
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	bmp = malloc(size);
+	if(bmp == NULL || fread(bmp, 1, size, file) != (size_t)size) {
+		fprintf(stderr, "%s: not a BMP file\n", argv[1]);
+		return 1;
+	}
+	fclose(file);
+
+	error = bmpToRle(bmp, size, &image);
+	if(error != NULL) {
+		fprintf(stderr, "%s: %s\n", argv[1], error);
+		return 1;
+	}
+
+	fprintf(stderr, "%s: %ux%u, %u colours -> %u, largest error %u, %u bytes -> %u bytes\n", argv[1],
+					image.width, image.height, image.source_colours, image.colours, image.worst, (uint32_t)size, image.data_len + 4*image.colours);
+
+	printf("/**\n");
+	printf("  ******************************************************************************\n");
+	printf("  * @file    %s.h\n", argv[2]);
+	printf("  * @author  Arm University Program\n");
+	printf("  * @date    Summer 2025\n");
+	printf("  * @brief   %ux%u image, %u colour palette + RLE. Generated by\n", image.width, image.height, image.colours);
+	printf("  *          Utilities/Host/bmp2rle.c, don't edit.\n");
+	printf("  ******************************************************************************\n");
+	printf("  */\n\n");
+	printf("static const uint32_t %s_palette[%u] = {", argv[2], image.colours);
+	for(i = 0; i < image.colours; i++)
+		printf("%s0x%08X%s", (i % 8) ? " " : "\n  ", image.palette[i], (i + 1 < image.colours) ? "," : "");
+	printf("\n};\n\n");
+	printf("static const uint8_t %s_data[%u] = {", argv[2], image.data_len);
+	for(i = 0; i < image.data_len; i++)
+		printf("%s0x%02X%s", (i % 16) ? " " : "\n  ", image.data[i], (i + 1 < image.data_len) ? "," : "");
+	printf("\n};\n\n");
+	printf("static const RleImage %s = {%u, %u, %u, %s_palette, %s_data};\n", argv[2], image.width, image.height, image.colours, argv[2], argv[2]);
+
+	return 0;
+}
+#endif
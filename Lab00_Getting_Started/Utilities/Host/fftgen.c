@@ -0,0 +1,86 @@
+/**
+  ******************************************************************************
+  * @file    fftgen.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Host tool that writes the twiddle and bit reversal tables of
+  *          stm32f7_fft.c.
+  *
+  *          gcc -O2 fftgen.c -lm -o fftgen
+  *          ./fftgen > ../../Projects/STM32746G-Discovery/<project>/Inc/fft_tables.h
+  *
+  *          The cosine is computed in double precision and rounded once to
+  *          float, one table serves every FFT length up to FFT_MAX_SIZE.
+  *          The fixed point FFTs get the same angles rounded to 1.31 and,
+  *          packed in pairs for the dual 16 bit multiplies, to 1.15.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define MAX_SIZE   4096								//Largest real FFT, FFT_MAX_SIZE
+#define LOG2_HALF  11								//log2 of the largest complex FFT
+
+/**
+  * @brief  Round to a fixed point fraction, +1.0 saturates
+  * @param  x: -1.0 to 1.0
+  * @param  one: 32768.0 or 2147483648.0
+  * @retval fraction
+  */
+
+static int64_t fraction(double x, double one) {
+	double y = floor(x*one + 0.5);
+
+	if(y > one - 1) y = one - 1;
+	if(y < -(one - 1)) y = -(one - 1);
+	return (int64_t)y;
+}
+
+int main(void) {
+	uint32_t i, j, bit, re, im;
+
+	printf("/**\n");
+	printf("  ******************************************************************************\n");
+	printf("  * @file    fft_tables.h\n");
+	printf("  * @author  Arm University Program\n");
+	printf("  * @date    Summer 2025\n");
+	printf("  * @brief   Twiddle and bit reversal tables of stm32f7_fft.c for real FFTs\n");
+	printf("  *          of up to %u points. Generated by Utilities/Host/fftgen.c,\n", MAX_SIZE);
+	printf("  *          don't edit.\n");
+	printf("  ******************************************************************************\n");
+	printf("  */\n\n");
+
+	printf("//cos(2*pi*k/%u), -sin(2*pi*k/%u) is %u entries further on\n", MAX_SIZE, MAX_SIZE, MAX_SIZE/4);
+	printf("static float32_t fft_cos[%u] FFT_TABLE_SECTION = {", MAX_SIZE);
+	for(i = 0; i < MAX_SIZE; i++)
+		printf("%s%.9ef%s", (i % 6) ? " " : "\n  ", cos(2.0*M_PI*i/MAX_SIZE), (i + 1 < MAX_SIZE) ? "," : "");
+	printf("\n};\n\n");
+
+	printf("//fft_cos in 1.31, const so it stays in flash\n");
+	printf("static const int32_t fft_cos_q31[%u] = {", MAX_SIZE);
+	for(i = 0; i < MAX_SIZE; i++)
+		printf("%s%11d%s", (i % 8) ? " " : "\n  ", (int32_t)fraction(cos(2.0*M_PI*i/MAX_SIZE), 2147483648.0), (i + 1 < MAX_SIZE) ? "," : "");
+	printf("\n};\n\n");
+
+	printf("//cos(2*pi*k/%u) in the low and -sin in the high half, 1.15, in flash\n", MAX_SIZE);
+	printf("static const uint32_t fft_twiddle_q15[%u] = {", 3*MAX_SIZE/4);
+	for(i = 0; i < 3*MAX_SIZE/4; i++) {
+		re = (uint16_t)fraction(cos(2.0*M_PI*i/MAX_SIZE), 32768.0);
+		im = (uint16_t)fraction(-sin(2.0*M_PI*i/MAX_SIZE), 32768.0);
+		printf("%s0x%08X%s", (i % 8) ? " " : "\n  ", (im << 16) | re, (i + 1 < 3*MAX_SIZE/4) ? "," : "");
+	}
+	printf("\n};\n\n");
+
+	printf("//%u bit reversed indices, shifted right for shorter FFTs\n", LOG2_HALF);
+	printf("static uint16_t fft_bitrev[%u] FFT_TABLE_SECTION = {", MAX_SIZE/2);
+	for(i = 0; i < MAX_SIZE/2; i++) {
+		for(j = 0, bit = 0; bit < LOG2_HALF; bit++)
+			j |= ((i >> bit) & 1) << (LOG2_HALF - 1 - bit);
+		printf("%s%4u%s", (i % 16) ? " " : "\n  ", j, (i + 1 < MAX_SIZE/2) ? "," : "");
+	}
+	printf("\n};\n");
+	return 0;
+}
@@ -0,0 +1,122 @@
+/**
+  ******************************************************************************
+  * @file    host_lcd.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for host_lcd.c module
+  *
+  *          host_lcd.c lets the display modules (stm32f7_display.c,
+  *          stm32f7_glyph.c, stm32f7_envelope.c, stm32f7_waterfall.c, ...)
+  *          run on a Linux PC. It provides the BSP_LCD, BSP_TS, DMA2D and LTDC
+  *          functions they call, backed by memory mapped at the board's SDRAM
+  *          address, and writes the screen the LTDC would show as a PPM image.
+  *
+  *          The Makefile in this directory builds the modules of a project
+  *          with the tests in Tests/ (see host_test.h), make test runs them.
+  *          By hand, from Utilities/Host, the same build of a host main() is:
+  *
+  *          P=../../Projects/STM32746G-Discovery/Getting_Started
+  *          gcc -O2 -no-pie -DSTM32F746xx -DUSE_HAL_DRIVER -I. -I$P/Inc
+  *              -I../../Drivers/CMSIS/Device/ST/STM32F7xx/Include
+  *              -I../../Drivers/STM32F7xx_HAL_Driver/Inc
+  *              -I../../Drivers/BSP/STM32746G-Discovery
+  *              -I../../Drivers/BSP/Components/Common
+  *              -I../../Utilities/Log -I../../Utilities/Fonts
+  *              host_main.c $P/Src/stm32f7_display.c $P/Src/stm32f7_glyph.c
+  *              $P/Src/stm32f7_envelope.c $P/Src/stm32f7_waterfall.c
+  *              $P/Src/stm32f7_image.c $P/Src/stm32f7_traces.c
+  *              $P/Src/stm32f7_capture.c $P/Src/stm32f7_render.c
+  *              $P/Src/stm32f7_input.c $P/Src/stm32f7_decibel.c
+  *              $P/Src/stm32f7_persist.c $P/Src/stm32f7_vectorscope.c
+  *              ../../Utilities/Log/lcd_log.c host_lcd.c
+  *              ../../Utilities/Fonts/font*.c -lm -o display_host
+  *
+  *          Utilities/Host has to come first in the include path, its
+  *          core_cm7.h and arm_math.h stand in for the Keil pack headers and
+  *          its lcd_log_conf.h configures lcd_log.c.
+  *          -no-pie keeps static buffers below 4 GB, the display modules pass
+  *          their addresses to DMA2D as uint32_t like on the board.
+  *
+  *          The DWT cycle counter does not count on the host. The benchmarks
+  *          take their clock from a macro, -D'FIR_CYCLES()=hostCycles()'
+  *          times firBenchmark() (stm32f7_fir.c) with the wall clock, the
+  *          Makefile does the same for every module with a benchmark.
+  *          The FFTs are in the tree (stm32f7_fft.c), no CMSIS-DSP is needed.
+  *
+  *          Nothing interrupts the host program, hostVsync() stands in for the
+  *          panel refreshes that drive the render scheduler (stm32f7_render.c).
+  *          Live plots only draw once a refresh has made a frame due.
+  *          Setting hLtdcHandler.Lock to HAL_LOCKED fires the line event as
+  *          if it had interrupted a HAL_LTDC call of the main loop.
+  *          hostPressButton(), hostButtonLevel() and hostTouch() call the EXTI
+  *          callback the way the button and touch interrupts would.
+  *          hostStorage() sets what the QSPI flash and the SD card hold.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __HOST_LCD_H
+#define __HOST_LCD_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7xx_hal.h"
+#include "stm32746g_discovery.h"
+#include "stm32746g_discovery_lcd.h"
+#include "stm32746g_discovery_qspi.h"
+#include "stm32746g_discovery_sd.h"
+#include "stm32746g_discovery_sdram.h"
+#include "stm32746g_discovery_ts.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define HOST_CORE_CLOCK       216000000u	//SystemCoreClock of the board
+#define HOST_REFRESH_HZ       60					//Panel refreshes per second in hostVsync()
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Work done by the emulated hardware, reset with hostLcdResetStats()
+  */
+typedef struct
+{
+	uint64_t fill_pixels;				//Pixels written by DMA2D register to memory fills
+	uint64_t copy_pixels;				//Pixels written by DMA2D memory to memory transfers
+	uint64_t blend_pixels;			//Pixels written by DMA2D blending
+	uint64_t cpu_pixels;				//Pixels written one at a time by BSP_LCD_DrawPixel()
+	uint64_t dma2d_transfers;		//DMA2D transfers started
+	uint64_t layer_reloads;			//LTDC layer configuration changes
+	uint64_t scanout_bytes;			//Bytes the LTDC read from the enabled layers in hostVsync()
+	uint64_t out_of_range;			//Writes outside SDRAM, dropped
+} HostLcdStats;
+
+/* Exported variables --------------------------------------------------------*/
+extern HostLcdStats hostLcdStats;
+
+/* Exported macros -----------------------------------------------------------*/
+/**
+  * @brief  Time a call and print its cost, e.g.
+  *         HOST_LCD_BENCH("plotWave", plotWave(buffer, 256, 0, 0));
+  */
+#define HOST_LCD_BENCH(name, call) \
+	do { \
+		HostLcdStats bench_before = hostLcdStats; \
+		uint64_t bench_start = hostLcdTimeUs(); \
+		call; \
+		hostLcdPrintBench((name), &bench_before, hostLcdTimeUs() - bench_start); \
+	} while(0)
+
+/* Exported functions ------------------------------------------------------- */
+void hostLcdOpen(void);
+int hostLcdWritePPM(const char *path);
+void hostLcdCompose(uint32_t *argb);
+void hostPressButton(uint32_t presses);
+void hostButtonLevel(uint8_t level);
+void hostAdvanceTick(uint32_t ms);
+void hostWaitForInterrupt(void);
+void hostTouch(uint8_t touches, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+void hostVsync(uint32_t frames);
+void hostStorage(const uint8_t *qspi, uint32_t qspi_bytes, const uint8_t *sd, uint32_t sd_bytes);
+void hostLcdResetStats(void);
+uint64_t hostLcdTimeUs(void);
+void hostLcdPrintBench(const char *name, const HostLcdStats *before, uint64_t time_us);
+
+#endif /* __HOST_LCD_H */
@@ -0,0 +1,189 @@
+/**
+  ******************************************************************************
+  * @file    host_test.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides the checks of the host tests, counting the
+  *					 failures, comparing the screen with the golden frames and a
+  *					 random generator that gives the same signals on every host.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include <math.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *test_name = "test";
+static uint32_t checks = 0;
+static uint32_t failures = 0;
+static uint32_t random_state = 0x12345678u;
+
+/**
+  * @brief  Start a test program, the frames it draws are written to
+  *					HOST_OUTPUT_DIR
+  * @param  name: name printed with the results
+  * @retval none
+  */
+
+void hostTestBegin(const char *name) {
+	test_name = name;
+	checks = 0;
+	failures = 0;
+	random_state = 0x12345678u;
+	hostLcdOpen();
+}
+
+/**
+  * @brief  Print the result of the test program
+  * @param  none
+  * @retval exit status of the program, 0 when every check passed
+  */
+
+int hostTestEnd(void) {
+	printf("%s: %u checks, %u failed\n", test_name, checks, failures);
+	return failures ? 1 : 0;
+}
+
+/**
+  * @brief  Count a check, print it when it fails
+  * @param  passed: result of the check
+  * @param  file, line: where the check is
+  * @param  format: printf format of the message, then its arguments
+  * @retval passed
+  */
+
+int hostCheck(int passed, const char *file, int line, const char *format, ...) {
+	va_list args;
+
+	checks++;
+	if(!passed) {
+		failures++;
+		printf("%s:%d: FAILED: ", file, line);
+		va_start(args, format);
+		vprintf(format, args);
+		va_end(args);
+		printf("\n");
+	}
+	return passed;
+}
+
+/**
+  * @brief  Read a binary PPM of the screen size
+  * @param  path: file name
+  * @param  rgb: 3 bytes per pixel
+  * @retval 0 = read, -1 = missing or not a frame of the screen
+  */
+
+static int readPPM(const char *path, uint8_t *rgb) {
+	int width = 0, height = 0, depth = 0, ok;
+	FILE *file = fopen(path, "rb");
+
+	if(file == NULL)
+		return -1;
+	ok = (fscanf(file, "P6 %d %d %d", &width, &height, &depth) == 3) && (fgetc(file) != EOF)
+		&& (width == RK043FN48H_WIDTH) && (height == RK043FN48H_HEIGHT) && (depth == 255)
+		&& (fread(rgb, 3, RK043FN48H_WIDTH*RK043FN48H_HEIGHT, file) == RK043FN48H_WIDTH*RK043FN48H_HEIGHT);
+	fclose(file);
+	return ok ? 0 : -1;
+}
+
+/**
+  * @brief  Write the screen to HOST_OUTPUT_DIR and compare it with the golden
+  *					frame of the same name. With HOST_GOLDEN=update in the
+  *					environment (make golden) the screen becomes the golden frame.
+  * @param  frame: name of the frame, without directory or .ppm
+  * @retval 1 when the screen matches
+  */
+
+int hostCheckFrame(const char *frame) {
+	static uint8_t drawn[3*RK043FN48H_WIDTH*RK043FN48H_HEIGHT];
+	static uint8_t golden[3*RK043FN48H_WIDTH*RK043FN48H_HEIGHT];
+	const char *update = getenv("HOST_GOLDEN");
+	char output_path[256], golden_path[256];
+	uint32_t i, differ = 0, first = 0;
+
+	snprintf(output_path, sizeof(output_path), "%s%s.ppm", HOST_OUTPUT_DIR, frame);
+	snprintf(golden_path, sizeof(golden_path), "%s%s.ppm", HOST_GOLDEN_DIR, frame);
+	if(!HOST_CHECK(hostLcdWritePPM(output_path) == 0 && readPPM(output_path, drawn) == 0, "can't write %s", output_path))
+		return 0;
+
+	if(update != NULL && strcmp(update, "update") == 0) {
+		return HOST_CHECK(hostLcdWritePPM(golden_path) == 0, "can't write %s", golden_path);
+	}
+	if(!HOST_CHECK(readPPM(golden_path, golden) == 0, "no golden frame %s, make golden writes it", golden_path))
+		return 0;
+
+	for(i = 0; i < RK043FN48H_WIDTH*RK043FN48H_HEIGHT; i++) {
+		if(memcmp(&drawn[3*i], &golden[3*i], 3) != 0) {
+			if(differ++ == 0)
+				first = i;
+		}
+	}
+	return HOST_CHECK(differ == 0, "%s: %u pixels differ from %s, the first at x %u y %u", output_path, differ,
+										golden_path, first % RK043FN48H_WIDTH, first / RK043FN48H_WIDTH);
+}
+
+/**
+  * @brief  Whether to print timings, set by make bench (HOST_BENCH in the
+  *					environment)
+  * @param  none
+  * @retval 1 for timings
+  */
+
+int hostBenchmark(void) {
+	return getenv("HOST_BENCH") != NULL;
+}
+
+/**
+  * @brief  xorshift32, the same sequence on every host unlike rand()
+  * @param  none
+  * @retval 32 random bits
+  */
+
+uint32_t hostRandom(void) {
+	random_state ^= random_state << 13;
+	random_state ^= random_state >> 17;
+	random_state ^= random_state << 5;
+	return random_state;
+}
+
+/**
+  * @brief  Uniform noise
+  * @param  none
+  * @retval -1.0 to 1.0
+  */
+
+float hostUniform(void) {
+	return (float)((int32_t)hostRandom())*(1.0f/2147483648.0f);
+}
+
+/**
+  * @brief  Gaussian noise by the sum of 12 uniform values
+  * @param  none
+  * @retval standard deviation 1
+  */
+
+float hostGauss(void) {
+	float sum = 0;
+	int i;
+
+	for(i = 0; i < 12; i++)
+		sum += (float)(hostRandom() >> 8)*(1.0f/16777216.0f);
+	return sum - 6.0f;
+}
+
+/**
+  * @brief  Signal to error ratio
+  * @param  signal: signal energy
+  * @param  error: error energy
+  * @retval ratio in dB, 400 dB for no error
+  */
+
+double hostSnr(double signal, double error) {
+	if(error <= 0)
+		return 400.0;
+	return 10.0*log10(signal/error);
+}
@@ -48,7 +48,10 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include  <stdio.h>
+#include  <stdarg.h>
+#include  <string.h>
 #include  "lcd_log.h"
+#include  "stm32f7_glyph.h"
 
 /** @addtogroup Utilities
   * @{
@@ -86,6 +89,9 @@
 /* Define the display window settings */
 #define     YWINDOW_MIN         4
 
+/* Longest text formatted at once by LCD_LOG_Printf() */
+#define     LCD_LOG_PRINTF_SIZE 128
+
 /** @defgroup LCD_LOG_Private_Macros
 * @{
 */ 
@@ -113,6 +119,14 @@ FunctionalState LCD_Lock;
 FunctionalState LCD_Scrolled;
 uint16_t LCD_ScrollBackStep;
 
+/* Cache line shown in the first row of the text zone, valid while
+   LCD_DisplayValid is ENABLE */
+uint16_t LCD_DisplayedTop;
+FunctionalState LCD_DisplayValid;
+
+extern LTDC_HandleTypeDef hLtdcHandler;
+static DMA2D_HandleTypeDef hDma2dLog;
+
 /**
 * @}
 */ 
@@ -121,6 +135,11 @@ uint16_t LCD_ScrollBackStep;
 /** @defgroup LCD_LOG_Private_FunctionPrototypes
 * @{
 */ 
+static uint32_t LCD_LOG_LineLength(void);
+static void LCD_LOG_LeaveScroll(void);
+static void LCD_LOG_NewLine(void);
+static ErrorStatus LCD_LOG_ScrollTextZone(void);
+static void LCD_LOG_DisplayLine(uint16_t line, LCD_LOG_line *cache);
 
 /**
 * @}
@@ -167,6 +186,9 @@ void LCD_LOG_DeInit(void)
   LCD_Lock = DISABLE;
   LCD_Scrolled = DISABLE;
   LCD_ScrollBackStep = 0;
+  
+  LCD_DisplayedTop = 0;
+  LCD_DisplayValid = DISABLE;
 }
 
 /**
@@ -242,74 +264,106 @@ void LCD_LOG_ClearTextZone(void)
  */
 LCD_LOG_PUTCHAR
 {
-  
-  sFONT *cFont = BSP_LCD_GetFont();
-  uint32_t idx;
-  
   if(LCD_Lock == DISABLE)
   {
-    if(LCD_ScrollActive == ENABLE)
-    {
-      LCD_CacheBuffer_yptr_bottom = LCD_CacheBuffer_yptr_bottom_bak;
-      LCD_CacheBuffer_yptr_top    = LCD_CacheBuffer_yptr_top_bak;
-      LCD_ScrollActive = DISABLE;
-      LCD_Scrolled = DISABLE;
-      LCD_ScrollBackStep = 0;
-      
-    }
+    LCD_LOG_LeaveScroll();
     
-    if(( LCD_CacheBuffer_xptr < (BSP_LCD_GetXSize()) /cFont->Width ) &&  ( ch != '\n'))
+    if(( LCD_CacheBuffer_xptr < LCD_LOG_LineLength() ) &&  ( ch != '\n'))
     {
       LCD_CacheBuffer[LCD_CacheBuffer_yptr_bottom].line[LCD_CacheBuffer_xptr++] = (uint16_t)ch;
     }   
     else 
     {
-      if(LCD_CacheBuffer_yptr_top >= LCD_CacheBuffer_yptr_bottom)
-      {
-        
-        if(LCD_CacheBuffer_yptr_invert == DISABLE)
-        {
-          LCD_CacheBuffer_yptr_top++;
-          
-          if(LCD_CacheBuffer_yptr_top == LCD_CACHE_DEPTH)
-          {
-            LCD_CacheBuffer_yptr_top = 0;  
-          }
-        }
-        else
-        {
-          LCD_CacheBuffer_yptr_invert= DISABLE;
-        }
-      }
-      
-      for(idx = LCD_CacheBuffer_xptr ; idx < (BSP_LCD_GetXSize()) /cFont->Width; idx++)
-      {
-        LCD_CacheBuffer[LCD_CacheBuffer_yptr_bottom].line[LCD_CacheBuffer_xptr++] = ' ';
-      }   
-      LCD_CacheBuffer[LCD_CacheBuffer_yptr_bottom].color = LCD_LineColor;  
-      
-      LCD_CacheBuffer_xptr = 0;
-      
-      LCD_LOG_UpdateDisplay (); 
-      
-      LCD_CacheBuffer_yptr_bottom ++; 
-      
-      if (LCD_CacheBuffer_yptr_bottom == LCD_CACHE_DEPTH) 
-      {
-        LCD_CacheBuffer_yptr_bottom = 0;
-        LCD_CacheBuffer_yptr_top = 1;    
-        LCD_CacheBuffer_yptr_invert = ENABLE;
-      }
+      LCD_LOG_NewLine();
       
       if( ch != '\n')
       {
         LCD_CacheBuffer[LCD_CacheBuffer_yptr_bottom].line[LCD_CacheBuffer_xptr++] = (uint16_t)ch;
       }
-      
     }
   }
   return ch;
 }
+
+/**
+  * @brief  Write a block of text to the LCD, a run of characters at a time
+  *         rather than one call per character as through printf
+  * @param  text: characters to be displayed, '\n' ends a line
+  * @param  length: number of characters
+  * @retval None
+  */
+void LCD_LOG_Write(const uint8_t *text, uint32_t length)
+{
+  uint32_t width, run;
+  const uint8_t *newline;
+  
+  if(LCD_Lock == ENABLE)
+  {
+    return;
+  }
+  
+  LCD_LOG_LeaveScroll();
+  width = LCD_LOG_LineLength();
+  
+  while(length > 0)
+  {
+    if(*text == '\n')
+    {
+      LCD_LOG_NewLine();
+      text++;
+      length--;
+      continue;
+    }
+    
+    /* A full line wraps like it does through printf */
+    if(LCD_CacheBuffer_xptr >= width)
+    {
+      LCD_LOG_NewLine();
+    }
+    
+    /* Copy up to the end of the line or the next newline */
+    run = width - LCD_CacheBuffer_xptr;
+    if(run > length)
+    {
+      run = length;
+    }
+    newline = memchr(text, '\n', run);
+    if(newline != NULL)
+    {
+      run = newline - text;
+    }
+    memcpy(&LCD_CacheBuffer[LCD_CacheBuffer_yptr_bottom].line[LCD_CacheBuffer_xptr], text, run);
+    LCD_CacheBuffer_xptr += run;
+    text += run;
+    length -= run;
+  }
+}
+
+/**
+  * @brief  Format text like printf and write it to the LCD in one block
+  * @param  format: printf format string, the text is cut at
+  *         LCD_LOG_PRINTF_SIZE - 1 characters
+  * @retval None
+  */
+void LCD_LOG_Printf(const char *format, ...)
+{
+  char text[LCD_LOG_PRINTF_SIZE];
+  va_list args;
+  int length;
+  
+  va_start(args, format);
+  length = vsnprintf(text, sizeof(text), format, args);
+  va_end(args);
+  
+  if(length > 0)
+  {
+    if(length >= (int)sizeof(text))
+    {
+      length = sizeof(text) - 1;
+    }
+    LCD_LOG_Write((uint8_t *)text, length);
+  }
+}
   
 /**
   * @brief  Update the text area display
@@ -325,9 +379,12 @@ void LCD_LOG_UpdateDisplay (void)
   if((LCD_CacheBuffer_yptr_bottom  < (YWINDOW_SIZE -1)) && 
      (LCD_CacheBuffer_yptr_bottom  >= LCD_CacheBuffer_yptr_top))
   {
-    BSP_LCD_SetTextColor(LCD_CacheBuffer[cnt + LCD_CacheBuffer_yptr_bottom].color);
-    BSP_LCD_DisplayStringAtLine ((YWINDOW_MIN + LCD_CacheBuffer_yptr_bottom),
-                           (uint8_t *)(LCD_CacheBuffer[cnt + LCD_CacheBuffer_yptr_bottom].line));
+    LCD_LOG_DisplayLine(YWINDOW_MIN + LCD_CacheBuffer_yptr_bottom,
+                        &LCD_CacheBuffer[cnt + LCD_CacheBuffer_yptr_bottom]);
+    
+    /* The lines above were drawn as they came */
+    LCD_DisplayedTop = 0;
+    LCD_DisplayValid = ENABLE;
   }
   else
   {
@@ -342,22 +399,187 @@ void LCD_LOG_UpdateDisplay (void)
       length = LCD_CacheBuffer_yptr_bottom;
     }
     
-    ptr = length - YWINDOW_SIZE + 1;
+    ptr = (length - YWINDOW_SIZE + 1) % LCD_CACHE_DEPTH;
     
-    for  (cnt = 0 ; cnt < YWINDOW_SIZE ; cnt ++)
+    if((LCD_DisplayValid == ENABLE) && (LCD_DisplayedTop == ptr))
+    {
+      /* Only the last line is new, e.g. the window has just filled up */
+      cnt = YWINDOW_SIZE - 1;
+    }
+    else if((LCD_DisplayValid == ENABLE) &&
+            (((LCD_DisplayedTop + 1) % LCD_CACHE_DEPTH) == ptr) &&
+            (LCD_LOG_ScrollTextZone() == SUCCESS))
+    {
+      /* Moved up one line by DMA2D, only the new line is drawn */
+      cnt = YWINDOW_SIZE - 1;
+    }
+    
+    for  ( ; cnt < YWINDOW_SIZE ; cnt ++)
     {
       
       index = (cnt + ptr )% LCD_CACHE_DEPTH ;
       
-      BSP_LCD_SetTextColor(LCD_CacheBuffer[index].color);
-      BSP_LCD_DisplayStringAtLine ((cnt + YWINDOW_MIN), 
-                             (uint8_t *)(LCD_CacheBuffer[index].line));
+      LCD_LOG_DisplayLine(cnt + YWINDOW_MIN, &LCD_CacheBuffer[index]);
       
     }
+    
+    LCD_DisplayedTop = ptr;
+    LCD_DisplayValid = ENABLE;
   }
   
 }
 
+/**
+  * @brief  Draw a cache line on a line of the text zone with the glyph atlas,
+  *         a DMA2D fill and one DMA2D blend per character instead of one
+  *         BSP_LCD_DrawPixel() per font bit as BSP_LCD_DisplayStringAtLine().
+  *         Before initGlyphAtlas() the line is drawn by the BSP.
+  * @param  line: line of the screen
+  * @param  cache: cache line to draw
+  * @retval None
+  */
+static void LCD_LOG_DisplayLine(uint16_t line, LCD_LOG_line *cache)
+{
+  BSP_LCD_SetTextColor(cache->color);
+  drawString(LCD_LOG_LAYER, 0, LINE(line), (const char *)cache->line, LEFT_MODE);
+}
+
+/**
+  * @brief  Number of characters that fit on a line of the text zone
+  * @param  None
+  * @retval Characters per line
+  */
+static uint32_t LCD_LOG_LineLength(void)
+{
+  uint32_t width = BSP_LCD_GetXSize() / BSP_LCD_GetFont()->Width;
+  
+  /* Keep the terminating zero of the cache line */
+  if(width > sizeof(LCD_CacheBuffer[0].line) - 1)
+  {
+    width = sizeof(LCD_CacheBuffer[0].line) - 1;
+  }
+  return width;
+}
+
+/**
+  * @brief  Go back to the end of the log when new text comes in while
+  *         scrolled back
+  * @param  None
+  * @retval None
+  */
+static void LCD_LOG_LeaveScroll(void)
+{
+  if(LCD_ScrollActive == ENABLE)
+  {
+    LCD_CacheBuffer_yptr_bottom = LCD_CacheBuffer_yptr_bottom_bak;
+    LCD_CacheBuffer_yptr_top    = LCD_CacheBuffer_yptr_top_bak;
+    LCD_ScrollActive = DISABLE;
+    LCD_Scrolled = DISABLE;
+    LCD_ScrollBackStep = 0;
+  }
+}
+
+/**
+  * @brief  End the current line, display it and start the next one
+  * @param  None
+  * @retval None
+  */
+static void LCD_LOG_NewLine(void)
+{
+  uint32_t width = LCD_LOG_LineLength();
+  
+  if(LCD_CacheBuffer_yptr_top >= LCD_CacheBuffer_yptr_bottom)
+  {
+    
+    if(LCD_CacheBuffer_yptr_invert == DISABLE)
+    {
+      LCD_CacheBuffer_yptr_top++;
+      
+      if(LCD_CacheBuffer_yptr_top == LCD_CACHE_DEPTH)
+      {
+        LCD_CacheBuffer_yptr_top = 0;  
+      }
+    }
+    else
+    {
+      LCD_CacheBuffer_yptr_invert= DISABLE;
+    }
+  }
+  
+  if(LCD_CacheBuffer_xptr < width)
+  {
+    memset(&LCD_CacheBuffer[LCD_CacheBuffer_yptr_bottom].line[LCD_CacheBuffer_xptr], ' ', width - LCD_CacheBuffer_xptr);
+  }
+  LCD_CacheBuffer[LCD_CacheBuffer_yptr_bottom].color = LCD_LineColor;  
+  
+  LCD_CacheBuffer_xptr = 0;
+  
+  LCD_LOG_UpdateDisplay (); 
+  
+  LCD_CacheBuffer_yptr_bottom ++; 
+  
+  if (LCD_CacheBuffer_yptr_bottom == LCD_CACHE_DEPTH) 
+  {
+    LCD_CacheBuffer_yptr_bottom = 0;
+    LCD_CacheBuffer_yptr_top = 1;    
+    LCD_CacheBuffer_yptr_invert = ENABLE;
+  }
+}
+
+/**
+  * @brief  Move the text zone up one line with a DMA2D memory to memory
+  *         transfer, leaving the last line to be drawn
+  * @param  None
+  * @retval SUCCESS, or ERROR when the text zone has to be redrawn
+  */
+static ErrorStatus LCD_LOG_ScrollTextZone(void)
+{
+  uint32_t height = BSP_LCD_GetFont()->Height;
+  uint32_t xsize = BSP_LCD_GetXSize();
+  uint32_t mode, bpp, address, size;
+  
+  if(hLtdcHandler.LayerCfg[LCD_LOG_LAYER].PixelFormat == LTDC_PIXEL_FORMAT_RGB565)
+  {
+    mode = DMA2D_OUTPUT_RGB565;
+    bpp = 2;
+  }
+  else
+  {
+    mode = DMA2D_OUTPUT_ARGB8888;
+    bpp = 4;
+  }
+  address = hLtdcHandler.LayerCfg[LCD_LOG_LAYER].FBStartAdress + bpp * xsize * YWINDOW_MIN * height;
+  size = bpp * xsize * YWINDOW_SIZE * height;
+  
+  /* Lines in a font missing from the glyph atlas are drawn by the CPU,
+     write them back before DMA2D reads them and so that no dirty line
+     lands on the moved text later */
+  SCB_CleanDCache_by_Addr((uint32_t *)address, size);
+  
+  /* Rows are copied in increasing address order, moving up is safe in place */
+  hDma2dLog.Instance = DMA2D;
+  hDma2dLog.Init.Mode = DMA2D_M2M;
+  hDma2dLog.Init.ColorMode = mode;
+  hDma2dLog.Init.OutputOffset = 0;
+  hDma2dLog.LayerCfg[1].InputColorMode = mode;
+  hDma2dLog.LayerCfg[1].InputOffset = 0;
+  hDma2dLog.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+  hDma2dLog.LayerCfg[1].InputAlpha = 0xFF;
+  
+  if((HAL_DMA2D_Init(&hDma2dLog) != HAL_OK) ||
+     (HAL_DMA2D_ConfigLayer(&hDma2dLog, 1) != HAL_OK) ||
+     (HAL_DMA2D_Start(&hDma2dLog, address + bpp * xsize * height, address, xsize, (YWINDOW_SIZE - 1) * height) != HAL_OK) ||
+     (HAL_DMA2D_PollForTransfer(&hDma2dLog, 20) != HAL_OK))
+  {
+    return ERROR;
+  }
+  
+  /* Drop the cached copies of the text that DMA2D moved, the lines of the
+     text zone start and end on a 32 byte cache line boundary */
+  SCB_InvalidateDCache_by_Addr((uint32_t *)address, bpp * xsize * (YWINDOW_SIZE - 1) * height);
+  return SUCCESS;
+}
+
 #if( LCD_SCROLL_ENABLED == 1)
 /**
   * @brief  Display previous text frame
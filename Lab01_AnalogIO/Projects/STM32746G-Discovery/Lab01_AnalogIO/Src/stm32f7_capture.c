@@ -0,0 +1,265 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_capture.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides a viewer for captures far longer than the graph
+  *					 is wide. A min/max pyramid is built in SDRAM as the samples
+  *					 arrive, level l holding the range of each block of 2^l samples.
+  *					 Any window is then drawn from a few pyramid entries per column,
+  *					 so zooming from the whole capture down to a few samples costs
+  *					 the same. One finger drag pans, two fingers pinch to zoom.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_capture.h"
+
+static Envelope capture_envelope;
+
+/**
+  * @brief  Start a pyramid over a capture buffer, the view shows the whole buffer
+  * @param  cap: capture
+  * @param  samples: capture buffer, filled from the start as the capture runs
+  * @param  num_samples: size of the capture buffer
+  * @retval HAL_ERROR when the pyramid does not fit in CAPTURE_PYRAMID_SIZE
+  */
+
+HAL_StatusTypeDef captureInit(Capture *cap, const int16_t *samples, uint32_t num_samples) {
+	uint32_t l, entries, total = 0;
+	CaptureMinMax *next = (CaptureMinMax *)CAPTURE_PYRAMID_BUFFER;
+	TS_StateTypeDef ts;
+
+	if(num_samples == 0)
+		return HAL_ERROR;
+
+	cap->samples = samples;
+	cap->num_samples = num_samples;
+	cap->length = 0;
+	cap->level[0] = NULL;
+
+	//Halve until one entry covers the whole buffer
+	for(l = 1, entries = num_samples; entries > 1; l++) {
+		if(l == CAPTURE_MAX_LEVELS)
+			return HAL_ERROR;
+		entries = (entries + 1) >> 1;
+		total += entries;
+		if(total*sizeof(CaptureMinMax) > CAPTURE_PYRAMID_SIZE)
+			return HAL_ERROR;
+		cap->level[l] = next;
+		next += entries;
+	}
+	cap->num_levels = l;
+
+	cap->touches = 0;
+	captureSetView(cap, 0, num_samples);
+
+	//The touch screen is started by inputInit()
+	if(!inputGetTouch(&ts))
+		return HAL_ERROR;
+	return HAL_OK;
+}
+
+/**
+  * @brief  Add the samples that arrived to the pyramid, only the entries
+  *					covering new samples are updated
+  * @param  cap: capture
+  * @param  length: samples now valid at the start of the buffer
+  * @retval none
+  */
+
+void captureAppend(Capture *cap, uint32_t length) {
+	uint32_t l, i, end, children;
+	const int16_t *samples = cap->samples;
+	CaptureMinMax *entry, *child;
+	int16_t a, b;
+
+	if(length > cap->num_samples) length = cap->num_samples;
+	if(length <= cap->length)
+		return;
+
+	//Level 1 from the samples, the last entry may only have one
+	end = (length + 1) >> 1;
+	for(i = cap->length >> 1; i < end; i++) {
+		a = samples[2*i];
+		b = (2*i + 1 < length) ? samples[2*i + 1] : a;
+		entry = &cap->level[1][i];
+		entry->min = (a < b) ? a : b;
+		entry->max = (a < b) ? b : a;
+	}
+
+	//Each level from the one below, the last entry may only have one child
+	for(l = 2; l < cap->num_levels; l++) {
+		children = end;
+		end = (children + 1) >> 1;
+		for(i = cap->length >> l; i < end; i++) {
+			entry = &cap->level[l][i];
+			child = &cap->level[l - 1][2*i];
+			*entry = child[0];
+			if(2*i + 1 < children) {
+				if(child[1].min < entry->min) entry->min = child[1].min;
+				if(child[1].max > entry->max) entry->max = child[1].max;
+			}
+		}
+	}
+
+	cap->length = length;
+}
+
+/**
+  * @brief  Range of the samples first to last-1, from the largest aligned
+  *					blocks that fit, at most two per level
+  * @param  cap: capture
+  * @param  first: first sample
+  * @param  last: sample after the last one, limited to the samples added
+  * @param  min: smallest sample
+  * @param  max: largest sample, below min when the range is empty
+  * @retval none
+  */
+
+void captureMinMax(const Capture *cap, uint32_t first, uint32_t last, int16_t *min, int16_t *max) {
+	uint32_t l = 0;
+	int16_t lo = INT16_MAX, hi = INT16_MIN, value;
+	const CaptureMinMax *entry;
+
+	if(last > cap->length) last = cap->length;
+	if(first >= last) {
+		*min = 1;
+		*max = 0;
+		return;
+	}
+
+	while(first < last) {
+		//Climb while the next block is aligned and fits, step down at the end of the range
+		while(l + 1 < cap->num_levels && (first & ((2u << l) - 1)) == 0 && first + (2u << l) <= last)
+			l++;
+		while(first + (1u << l) > last)
+			l--;
+
+		if(l == 0) {
+			value = cap->samples[first];
+			if(value < lo) lo = value;
+			if(value > hi) hi = value;
+		} else {
+			entry = &cap->level[l][first >> l];
+			if(entry->min < lo) lo = entry->min;
+			if(entry->max > hi) hi = entry->max;
+		}
+		first += 1u << l;
+	}
+
+	*min = lo;
+	*max = hi;
+}
+
+/**
+  * @brief  Set the window shown by plotCapture(), limited to the buffer
+  * @param  cap: capture
+  * @param  start: first sample shown
+  * @param  span: samples shown across the graph
+  * @retval none
+  */
+
+void captureSetView(Capture *cap, uint32_t start, uint32_t span) {
+	uint32_t min_span = (cap->num_samples < CAPTURE_MIN_SPAN) ? cap->num_samples : CAPTURE_MIN_SPAN;
+
+	if(span < min_span) span = min_span;
+	if(span > cap->num_samples) span = cap->num_samples;
+	if(start > cap->num_samples - span) start = cap->num_samples - span;
+	cap->start = start;
+	cap->span = span;
+}
+
+/**
+  * @brief  Follow the touch screen, one finger drags the window, two fingers
+  *					zoom around the point between them
+  * @param  cap: capture
+  * @retval 1 when the view changed and the graph has to be drawn again
+  */
+
+int captureTouch(Capture *cap) {
+	TS_StateTypeDef ts;
+	int64_t start, span, anchor, was, now;
+	uint32_t old_start = cap->start, old_span = cap->span;
+	int touches;
+
+	//The report read by the input module, no I2C transfer here
+	if(!inputGetTouch(&ts))
+		return 0;
+	touches = (ts.touchDetected > 2) ? 2 : ts.touchDetected;
+
+	//A new gesture starts whenever the number of fingers changes
+	if(touches != cap->touches) {
+		cap->touches = touches;
+		cap->touch_x[0] = ts.touchX[0];
+		cap->touch_x[1] = ts.touchX[1];
+		cap->touch_start = cap->start;
+		cap->touch_span = cap->span;
+		return 0;
+	}
+
+	if(touches == 1) {
+		//The sample under the finger stays under the finger
+		start = (int64_t)cap->touch_start - ((int64_t)ts.touchX[0] - cap->touch_x[0])*cap->touch_span/GRAPH_WIDTH;
+		span = cap->touch_span;
+	} else if(touches == 2) {
+		was = (int64_t)cap->touch_x[1] - cap->touch_x[0];
+		now = (int64_t)ts.touchX[1] - ts.touchX[0];
+		if(was < 0) was = -was;
+		if(now < 0) now = -now;
+		if(was < CAPTURE_MIN_PINCH || now < CAPTURE_MIN_PINCH)
+			return 0;
+		span = cap->touch_span*was/now;
+
+		//The sample between the fingers stays between the fingers
+		anchor = (int64_t)cap->touch_start + ((int64_t)cap->touch_x[0] + cap->touch_x[1] - 2*FIRST_DATA_PIXEL)*cap->touch_span/(2*GRAPH_WIDTH);
+		start = anchor - ((int64_t)ts.touchX[0] + ts.touchX[1] - 2*FIRST_DATA_PIXEL)*span/(2*GRAPH_WIDTH);
+	} else {
+		return 0;
+	}
+
+	if(span > cap->num_samples) span = cap->num_samples;
+	if(span < 1) span = 1;
+	if(start < 0) start = 0;
+	captureSetView(cap, (uint32_t)start, (uint32_t)span);
+	return cap->start != old_start || cap->span != old_span;
+}
+
+/**
+  * @brief  Draw the current window of the capture, with the scale of the
+  *					whole capture so zooming and panning keep the same scale
+  * @param  cap: capture
+  * @param  colour: ARGB8888 colour of the line
+  * @retval none
+  */
+
+void plotCapture(Capture *cap, uint32_t colour) {
+	Trace trace;
+	uint32_t x, first, last;
+	int16_t min, max;
+	int16_t all_min, all_max;
+
+	captureMinMax(cap, 0, cap->length, &all_min, &all_max);
+	if(all_min > all_max)
+		return;
+
+	//Same column split as the Envelope module, columns past the captured samples stay empty
+	envelopeInit(&capture_envelope, cap->span);
+	first = cap->start;
+	for(x = 0; x < GRAPH_WIDTH; x++) {
+		last = cap->start + (uint32_t)(((uint64_t)(x + 1)*cap->span + GRAPH_WIDTH - 1)/GRAPH_WIDTH);
+		captureMinMax(cap, first, last, &min, &max);
+		if(min <= max) {
+			capture_envelope.min[x] = min;
+			capture_envelope.max[x] = max;
+		}
+		first = last;
+	}
+	capture_envelope.count = cap->span;
+
+	trace.data = NULL;
+	trace.num_samples = cap->span;
+	trace.colour = colour;
+	trace.style = TRACE_LINE;
+	plotEnvelopes(&capture_envelope, &trace, 1, all_max, all_min, cap->span);
+}
@@ -0,0 +1,131 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_decibel.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides block conversions of magnitudes and powers to
+  *					 decibels for the log graphs. log2 is the exponent of the float
+  *					 plus a polynomial of the mantissa, single precision all the way,
+  *					 20*log10(x) is then 6.0206*log2(x).
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_decibel.h"
+
+#define DECIBEL_MAGNITUDE     6.02059991f		//20*log10(2)
+#define DECIBEL_POWER         3.01029996f		//10*log10(2)
+
+//Minimax fits of log2(1 + t) for t in [0, 1)
+#if DECIBEL_ORDER == 2
+#define DECIBEL_POLY(t)       (4.939213861e-03f + (t)*(1.334970236e+00f + (t)*-3.448486328e-01f))
+#elif DECIBEL_ORDER == 3
+#define DECIBEL_POLY(t)       (6.370380870e-04f + (t)*(1.418880701e+00f + (t)*(-5.771294832e-01f + (t)*1.582488120e-01f)))
+#elif DECIBEL_ORDER == 4
+#define DECIBEL_POLY(t)       (8.758031618e-05f + (t)*(1.437704563e+00f + (t)*(-6.749432683e-01f + (t)*(3.186794519e-01f + (t)*-8.161587268e-02f))))
+#elif DECIBEL_ORDER == 5
+#define DECIBEL_POLY(t)       (1.253701339e-05f + (t)*(1.441684604e+00f + (t)*(-7.079927921e-01f + (t)*(4.136303663e-01f + (t)*(-1.921958178e-01f + (t)*4.487364367e-02f)))))
+#else
+#error "DECIBEL_ORDER must be 2 to 5"
+#endif
+
+/**
+  * @brief  gain*log2(x) for a block, no lower than floor
+  * @param  in: values, 0 and denormals come out as floor, the sign is ignored
+  * @param  out: results, may be in
+  * @param  n: number of values
+  * @param  gain: decibels per octave
+  * @param  floor: lowest result
+  * @retval none
+  */
+
+static void scaledLog2(const float32_t *in, float32_t *out, uint32_t n, float32_t gain, float32_t floor) {
+	union { float32_t f; uint32_t u; } bits;
+	float32_t exponent, t, v;
+	uint32_t i;
+
+	for(i = 0; i < n; i++) {
+		bits.f = in[i];
+		exponent = (float32_t)((int32_t)((bits.u >> 23) & 0xFF) - 127);
+		bits.u = (bits.u & 0x007FFFFF) | 0x3F800000;
+		t = bits.f - 1.0f;
+		v = (exponent + DECIBEL_POLY(t))*gain;
+		//A zero has exponent -127, far below any floor
+		out[i] = (v > floor) ? v : floor;
+	}
+}
+
+/**
+  * @brief  20*log10 of a block of magnitudes
+  * @param  magnitude: n magnitudes
+  * @param  db: n levels, may be magnitude
+  * @param  n: number of values
+  * @param  floor_db: level of zeros and anything below it
+  * @retval none
+  */
+
+void decibelFromMagnitude(const float32_t *magnitude, float32_t *db, uint32_t n, float32_t floor_db) {
+	scaledLog2(magnitude, db, n, DECIBEL_MAGNITUDE, floor_db);
+}
+
+/**
+  * @brief  10*log10 of a block of powers
+  * @param  power: n powers
+  * @param  db: n levels, may be power
+  * @param  n: number of values
+  * @param  floor_db: level of zeros and anything below it
+  * @retval none
+  */
+
+void decibelFromPower(const float32_t *power, float32_t *db, uint32_t n, float32_t floor_db) {
+	scaledLog2(power, db, n, DECIBEL_POWER, floor_db);
+}
+
+#if DECIBEL_BENCHMARK
+//Cycle counter, the host build times with a clock instead
+#ifndef DECIBEL_CYCLES
+#define DECIBEL_CYCLES()      (DWT->CYCCNT)
+#endif
+
+static float32_t bench_in[DECIBEL_BENCH_BINS];
+static float32_t bench_out[DECIBEL_BENCH_BINS];
+
+/**
+  * @brief  Time decibelFromMagnitude() against 20*log10() from the C library
+  *					on magnitudes spread over 16 decades
+  * @param  cycles: cycles per bin, this module then the C library
+  * @param  max_error: largest difference in dB
+  * @retval none
+  */
+
+void decibelBenchmark(float32_t cycles[2], float32_t *max_error) {
+	uint32_t i, start, total;
+	float32_t error;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	for(i = 0; i < DECIBEL_BENCH_BINS; i++)
+		bench_in[i] = powf(10.0f, -8.0f + 16.0f*i/DECIBEL_BENCH_BINS);
+
+	start = DECIBEL_CYCLES();
+	decibelFromMagnitude(bench_in, bench_out, DECIBEL_BENCH_BINS, -200.0f);
+	total = DECIBEL_CYCLES() - start;
+	cycles[0] = (float32_t)total/DECIBEL_BENCH_BINS;
+
+	*max_error = 0;
+	for(i = 0; i < DECIBEL_BENCH_BINS; i++) {
+		error = fabsf(bench_out[i] - (float32_t)(20*log10(bench_in[i])));
+		if(error > *max_error) *max_error = error;
+	}
+
+	//The way plotLogFFT() used to do it
+	start = DECIBEL_CYCLES();
+	for(i = 0; i < DECIBEL_BENCH_BINS; i++)
+		bench_out[i] = 20*log10(bench_in[i]);
+	total = DECIBEL_CYCLES() - start;
+	cycles[1] = (float32_t)total/DECIBEL_BENCH_BINS;
+}
+#endif /* DECIBEL_BENCHMARK */
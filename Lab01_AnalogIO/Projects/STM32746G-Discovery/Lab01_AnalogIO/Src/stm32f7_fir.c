@@ -0,0 +1,381 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_fir.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides block FIR filters in Q15, Q31 and floating
+  *					 point. The history is a circular buffer written twice so the
+  *					 taps always run over contiguous memory, and two outputs are
+  *					 computed in each pass over the taps so every coefficient and
+  *					 sample loaded is used twice. The Q15 filter uses the dual
+  *					 16 bit multiply accumulate (SMLALD) with a 64 bit accumulator.
+  *					 Only the CMSIS core intrinsics are used, not CMSIS-DSP.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_fir.h"
+#include <string.h>
+
+/**
+  * @brief  Round a 1.30 sum of products to 1.15 with saturation
+  * @param  acc: sum of products
+  * @retval 1.15 sample
+  */
+
+static inline int16_t roundQ15(int64_t acc) {
+	acc = (acc + (1 << 14)) >> 15;
+	if(acc > 32767) return 32767;
+	if(acc < -32768) return -32768;
+	return (int16_t)acc;
+}
+
+/**
+  * @brief  Round a 2.62 sum of products to 1.31 with saturation
+  * @param  acc: sum of products
+  * @retval 1.31 sample
+  */
+
+static inline int32_t roundQ31(int64_t acc) {
+	acc = (acc >> 30) + 1;
+	acc >>= 1;
+	if(acc > INT32_MAX) return INT32_MAX;
+	if(acc < INT32_MIN) return INT32_MIN;
+	return (int32_t)acc;
+}
+
+/**
+  * @brief  Set up a Q15 FIR filter and clear its history
+  * @param  fir: filter
+  * @param  coeffs: num_taps coefficients in 1.15, h[0] first, kept by the filter
+  * @param  num_taps: 1 to FIR_MAX_TAPS
+  * @param  state: buffer of 2*num_taps samples
+  * @retval HAL_OK, HAL_ERROR for a bad number of taps
+  */
+
+HAL_StatusTypeDef firInitQ15(FirQ15 *fir, const int16_t *coeffs, uint32_t num_taps, int16_t *state) {
+	if(num_taps < 1 || num_taps > FIR_MAX_TAPS)
+		return HAL_ERROR;
+	fir->num_taps = num_taps;
+	fir->index = 0;
+	fir->coeffs = coeffs;
+	fir->state = state;
+	memset(state, 0, 2*num_taps*sizeof(int16_t));
+	return HAL_OK;
+}
+
+/**
+  * @brief  Set up a Q31 FIR filter and clear its history
+  * @param  fir: filter
+  * @param  coeffs: num_taps coefficients in 1.31, h[0] first, kept by the
+  *					filter. The sum of their magnitudes has to stay below 2.
+  * @param  num_taps: 1 to FIR_MAX_TAPS
+  * @param  state: buffer of 2*num_taps samples
+  * @retval HAL_OK, HAL_ERROR for a bad number of taps
+  */
+
+HAL_StatusTypeDef firInitQ31(FirQ31 *fir, const int32_t *coeffs, uint32_t num_taps, int32_t *state) {
+	if(num_taps < 1 || num_taps > FIR_MAX_TAPS)
+		return HAL_ERROR;
+	fir->num_taps = num_taps;
+	fir->index = 0;
+	fir->coeffs = coeffs;
+	fir->state = state;
+	memset(state, 0, 2*num_taps*sizeof(int32_t));
+	return HAL_OK;
+}
+
+/**
+  * @brief  Set up a floating point FIR filter and clear its history
+  * @param  fir: filter
+  * @param  coeffs: num_taps coefficients, h[0] first, kept by the filter
+  * @param  num_taps: 1 to FIR_MAX_TAPS
+  * @param  state: buffer of 2*num_taps samples
+  * @retval HAL_OK, HAL_ERROR for a bad number of taps
+  */
+
+HAL_StatusTypeDef firInitF32(FirF32 *fir, const float32_t *coeffs, uint32_t num_taps, float32_t *state) {
+	if(num_taps < 1 || num_taps > FIR_MAX_TAPS)
+		return HAL_ERROR;
+	fir->num_taps = num_taps;
+	fir->index = 0;
+	fir->coeffs = coeffs;
+	fir->state = state;
+	memset(state, 0, 2*num_taps*sizeof(float32_t));
+	return HAL_OK;
+}
+
+/**
+  * @brief  Filter a block of Q15 samples, in place when out is in
+  * @param  fir: filter
+  * @param  in: input samples
+  * @param  out: output samples
+  * @param  n: number of samples
+  * @param  stride: distance between samples, 1 for a mono block, 2 for one
+  *					slot of an interleaved stereo buffer
+  * @retval none
+  */
+
+void firProcessQ15(FirQ15 *fir, const int16_t *in, int16_t *out, uint32_t n, uint32_t stride) {
+	uint32_t taps = fir->num_taps, index = fir->index, k;
+	const int16_t *h = fir->coeffs;
+	int16_t *state = fir->state;
+	const int16_t *w;
+	int64_t acc0, acc1;
+	int16_t x;
+
+	while(n > 0) {
+		x = in[0];
+		index = (index == 0) ? taps - 1 : index - 1;
+		state[index] = x;
+		state[index + taps] = x;
+
+		if(n >= 2 && index > 0) {
+			//Two outputs, the window of the second starts one sample earlier
+			//The copy of the second sample waits, its slot holds the oldest
+			//sample of the first output
+			x = in[stride];
+			index--;
+			state[index] = x;
+			w = &state[index];
+			acc0 = 0;
+			acc1 = 0;
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+			{
+				uint32_t pair, next, shifted, coeff_pair;
+
+				memcpy(&pair, &w[0], 4);
+				for(k = 0; k + 1 < taps; k += 2) {
+					memcpy(&coeff_pair, &h[k], 4);
+					memcpy(&next, &w[k + 2], 4);
+					//w[k+1] and w[k+2] from the two loads
+					shifted = (pair >> 16) | (next << 16);
+					acc1 = (int64_t)__SMLALD(pair, coeff_pair, (uint64_t)acc1);
+					acc0 = (int64_t)__SMLALD(shifted, coeff_pair, (uint64_t)acc0);
+					pair = next;
+				}
+			}
+#else
+			//One product at a time, two -32768*-32768 products overflow an int32_t
+			for(k = 0; k + 1 < taps; k += 2) {
+				acc1 += (int32_t)h[k]*w[k];
+				acc1 += (int32_t)h[k + 1]*w[k + 1];
+				acc0 += (int32_t)h[k]*w[k + 1];
+				acc0 += (int32_t)h[k + 1]*w[k + 2];
+			}
+#endif
+			if(k < taps) {
+				acc1 += (int32_t)h[k]*w[k];
+				acc0 += (int32_t)h[k]*w[k + 1];
+			}
+			state[index + taps] = x;
+			out[0] = roundQ15(acc0);
+			out[stride] = roundQ15(acc1);
+			in += 2*stride;
+			out += 2*stride;
+			n -= 2;
+		} else {
+			w = &state[index];
+			acc0 = 0;
+			for(k = 0; k < taps; k++)
+				acc0 += (int32_t)h[k]*w[k];
+			out[0] = roundQ15(acc0);
+			in += stride;
+			out += stride;
+			n--;
+		}
+	}
+	fir->index = index;
+}
+
+/**
+  * @brief  Filter a block of Q31 samples, in place when out is in
+  * @param  fir: filter
+  * @param  in: input samples
+  * @param  out: output samples
+  * @param  n: number of samples
+  * @param  stride: distance between samples, 1 for a mono block
+  * @retval none
+  */
+
+void firProcessQ31(FirQ31 *fir, const int32_t *in, int32_t *out, uint32_t n, uint32_t stride) {
+	uint32_t taps = fir->num_taps, index = fir->index, k;
+	const int32_t *h = fir->coeffs;
+	int32_t *state = fir->state;
+	const int32_t *w;
+	int64_t acc0, acc1;
+	int32_t x, previous, next, coeff;
+
+	while(n > 0) {
+		x = in[0];
+		index = (index == 0) ? taps - 1 : index - 1;
+		state[index] = x;
+		state[index + taps] = x;
+
+		if(n >= 2 && index > 0) {
+			//The copy of the second sample waits, its slot holds the oldest
+			//sample of the first output
+			x = in[stride];
+			index--;
+			state[index] = x;
+			w = &state[index];
+			acc0 = 0;
+			acc1 = 0;
+			//Each sample loaded serves both outputs, 32x32 into 64 bit (SMLAL)
+			previous = w[0];
+			for(k = 0; k < taps; k++) {
+				coeff = h[k];
+				next = w[k + 1];
+				acc1 += (int64_t)coeff*previous;
+				acc0 += (int64_t)coeff*next;
+				previous = next;
+			}
+			state[index + taps] = x;
+			out[0] = roundQ31(acc0);
+			out[stride] = roundQ31(acc1);
+			in += 2*stride;
+			out += 2*stride;
+			n -= 2;
+		} else {
+			w = &state[index];
+			acc0 = 0;
+			for(k = 0; k < taps; k++)
+				acc0 += (int64_t)h[k]*w[k];
+			out[0] = roundQ31(acc0);
+			in += stride;
+			out += stride;
+			n--;
+		}
+	}
+	fir->index = index;
+}
+
+/**
+  * @brief  Filter a block of floating point samples, in place when out is in
+  * @param  fir: filter
+  * @param  in: input samples
+  * @param  out: output samples
+  * @param  n: number of samples
+  * @param  stride: distance between samples, 1 for a mono block
+  * @retval none
+  */
+
+void firProcessF32(FirF32 *fir, const float32_t *in, float32_t *out, uint32_t n, uint32_t stride) {
+	uint32_t taps = fir->num_taps, index = fir->index, k;
+	const float32_t *h = fir->coeffs;
+	float32_t *state = fir->state;
+	const float32_t *w;
+	float32_t acc0, acc1, x, previous, next, coeff;
+
+	while(n > 0) {
+		x = in[0];
+		index = (index == 0) ? taps - 1 : index - 1;
+		state[index] = x;
+		state[index + taps] = x;
+
+		if(n >= 2 && index > 0) {
+			//The copy of the second sample waits, its slot holds the oldest
+			//sample of the first output
+			x = in[stride];
+			index--;
+			state[index] = x;
+			w = &state[index];
+			acc0 = 0.0f;
+			acc1 = 0.0f;
+			previous = w[0];
+			for(k = 0; k < taps; k++) {
+				coeff = h[k];
+				next = w[k + 1];
+				acc1 += coeff*previous;
+				acc0 += coeff*next;
+				previous = next;
+			}
+			state[index + taps] = x;
+			out[0] = acc0;
+			out[stride] = acc1;
+			in += 2*stride;
+			out += 2*stride;
+			n -= 2;
+		} else {
+			w = &state[index];
+			acc0 = 0.0f;
+			for(k = 0; k < taps; k++)
+				acc0 += h[k]*w[k];
+			out[0] = acc0;
+			in += stride;
+			out += stride;
+			n--;
+		}
+	}
+	fir->index = index;
+}
+
+#if FIR_BENCHMARK
+//Cycle counter, the host build times with a clock instead
+#ifndef FIR_CYCLES
+#define FIR_CYCLES()          (DWT->CYCCNT)
+#endif
+
+#define FIR_BENCH_SAMPLES     4096		//Samples filtered for each entry
+#define FIR_BENCH_MAX_TAPS    1024
+
+static const uint16_t bench_taps[FIR_BENCH_TAPS] = {8, 32, 128, 512, 1024};
+static const uint16_t bench_blocks[FIR_BENCH_BLOCKS] = {16, 64, 256, 512};
+static int16_t bench_q15[FIR_BENCH_MAX_TAPS];
+static int32_t bench_q31[FIR_BENCH_MAX_TAPS];
+static float32_t bench_f32[FIR_BENCH_MAX_TAPS];
+static uint32_t bench_state[2*FIR_BENCH_MAX_TAPS];
+static uint32_t bench_block[512];
+
+/**
+  * @brief  Measure the cycles per sample of the three filters for 8 to 1024
+  *					taps and blocks of 16 to 512 samples
+  * @param  cycles: cycles per sample by format (FIR_Q15, FIR_Q31, FIR_F32),
+  *					number of taps and block size
+  * @retval none
+  */
+
+void firBenchmark(float32_t cycles[3][FIR_BENCH_TAPS][FIR_BENCH_BLOCKS]) {
+	FirQ15 fir_q15;
+	FirQ31 fir_q31;
+	FirF32 fir_f32;
+	uint32_t format, t, b, i, block, start, total;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	//Small values, the timing does not depend on them
+	for(i = 0; i < FIR_BENCH_MAX_TAPS; i++) {
+		bench_q15[i] = (int16_t)(i*37 % 64 - 32);
+		bench_q31[i] = (int32_t)bench_q15[i] << 16;
+		bench_f32[i] = bench_q15[i]/32768.0f;
+	}
+
+	for(format = 0; format < 3; format++) {
+		for(t = 0; t < FIR_BENCH_TAPS; t++) {
+			for(b = 0; b < FIR_BENCH_BLOCKS; b++) {
+				block = bench_blocks[b];
+				for(i = 0; i < 512; i++)
+					bench_block[i] = 0;
+				firInitQ15(&fir_q15, bench_q15, bench_taps[t], (int16_t *)bench_state);
+				firInitQ31(&fir_q31, bench_q31, bench_taps[t], (int32_t *)bench_state);
+				firInitF32(&fir_f32, bench_f32, bench_taps[t], (float32_t *)bench_state);
+				total = 0;
+				for(i = 0; i < FIR_BENCH_SAMPLES; i += block) {
+					start = FIR_CYCLES();
+					if(format == FIR_Q15)
+						firProcessQ15(&fir_q15, (int16_t *)bench_block, (int16_t *)bench_block, block, 1);
+					else if(format == FIR_Q31)
+						firProcessQ31(&fir_q31, (int32_t *)bench_block, (int32_t *)bench_block, block, 1);
+					else
+						firProcessF32(&fir_f32, (float32_t *)bench_block, (float32_t *)bench_block, block, 1);
+					total += FIR_CYCLES() - start;
+				}
+				cycles[format][t][b] = (float32_t)total/FIR_BENCH_SAMPLES;
+			}
+		}
+	}
+}
+#endif /* FIR_BENCHMARK */
@@ -11,8 +11,10 @@
 #define RECORD_SAMPLES       (AUDIO_FREQ * RECORD_DURATION * AUDIO_IN_CHANNEL_NBR)
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
-static uint16_t RecordBuffer[RECORD_SAMPLES];
+static uint16_t RecordBuffer[RECORD_SAMPLES] __attribute__((aligned(32)));	//Cache line aligned for the invalidate
+static __IO uint8_t RecordHalf     = 0;
 static __IO uint8_t RecordComplete = 0;
+static Capture RecordCapture;
 static __IO uint8_t PlayComplete   = 0;
 
 /* Private function prototypes -----------------------------------------------*/
@@ -23,6 +25,11 @@ static void Error_Handler(void);
 void BSP_AUDIO_OUT_ClockConfig(SAI_HandleTypeDef *hsai, uint32_t AudioFreq, void *Params);
 
 /* Private functions ---------------------------------------------------------*/
+void BSP_AUDIO_IN_HalfTransfer_CallBack(void)
+{
+    RecordHalf = 1;
+}
+
 void BSP_AUDIO_IN_TransferComplete_CallBack(void)
 {
     RecordComplete = 1;
@@ -46,17 +53,33 @@ int main(void)
   /* Configure the System clock to have a frequency of 216 MHz */
   SystemClock_Config();
 	
-	stm32f7_LCD_init(AUDIO_FREQ, SOURCE_FILE_NAME, NOGRAPH);
+	stm32f7_LCD_init(AUDIO_FREQ, SOURCE_FILE_NAME, GRAPH);
 	
   /* Infinite loop */
   while (1)
   {
 		/* Start record */
+		captureInit(&RecordCapture, (int16_t *)RecordBuffer, RECORD_SAMPLES);
 		BSP_AUDIO_IN_InitEx(INPUT_DEVICE_DIGITAL_MICROPHONE_2, AUDIO_FREQ, AUDIO_IN_BIT_RES, AUDIO_IN_CHANNEL_NBR);
 		BSP_AUDIO_IN_Record(RecordBuffer, RECORD_SAMPLES);
-		while (RecordComplete == 0);
+		while (RecordComplete == 0)
+		{
+			/* Show the first half while the second one is recorded */
+			if (RecordHalf)
+			{
+				RecordHalf = 0;
+				SCB_InvalidateDCache_by_Addr((uint32_t *)RecordBuffer, sizeof(RecordBuffer) / 2);
+				captureAppend(&RecordCapture, RECORD_SAMPLES / 2);
+				plotCapture(&RecordCapture, GRAPH_COLOUR);
+			}
+		}
 		BSP_AUDIO_IN_Stop(CODEC_PDWN_SW);
 		RecordComplete = 0;
+		RecordHalf = 0;
+
+		SCB_InvalidateDCache_by_Addr((uint32_t *)RecordBuffer, sizeof(RecordBuffer));
+		captureAppend(&RecordCapture, RECORD_SAMPLES);
+		plotCapture(&RecordCapture, GRAPH_COLOUR);
 
 		/* Start playback */
 		BSP_AUDIO_OUT_Init(OUTPUT_DEVICE_HEADPHONE, 70, AUDIO_FREQ);
@@ -65,7 +88,13 @@ int main(void)
 		BSP_AUDIO_OUT_SetAudioFrameSlot(CODEC_AUDIOFRAME_SLOT_02);
 
 		BSP_AUDIO_OUT_Play(RecordBuffer, RECORD_SAMPLES * sizeof(uint16_t));
-		while (PlayComplete == 0);
+
+		/* Drag to pan and pinch to zoom the recording while it plays */
+		while (PlayComplete == 0)
+		{
+			if (captureTouch(&RecordCapture))
+				plotCapture(&RecordCapture, GRAPH_COLOUR);
+		}
 		BSP_AUDIO_OUT_Stop(CODEC_PDWN_SW);
 		PlayComplete = 0;
   }
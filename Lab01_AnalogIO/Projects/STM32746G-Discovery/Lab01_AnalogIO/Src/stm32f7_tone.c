@@ -0,0 +1,357 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_tone.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides banks of tone detectors for measuring a few
+  *					 chosen frequencies without an FFT. The Goertzel algorithm costs
+  *					 one multiply and two adds per sample and detector and gives a
+  *					 result per frame, the sliding DFT costs about four times that
+  *					 and gives the DFT of the last frame after every block. A small
+  *					 leak keeps the rounding errors of the sliding DFT from
+  *					 building up.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_tone.h"
+#include <string.h>
+
+#define TONE_COEFFS           6					//Per detector, see toneInit()
+#define TONE_CHUNK            64				//Samples converted to float at a time
+
+/**
+  * @brief  Set up a bank of detectors
+  * @param  bank: bank
+  * @param  method: TONE_GOERTZEL or TONE_SLIDING
+  * @param  frame_len: samples per DFT, 2 or more, the frequency resolution is
+  *					fs/frame_len
+  * @param  fs: sampling frequency in Hz
+  * @param  frequencies: num_tones frequencies in Hz, above 0 and below fs/2
+  * @param  num_tones: 1 to TONE_MAX_DETECTORS
+  * @param  memory: TONE_MEMORY(num_tones, frame_len) floats
+  * @retval HAL_OK, HAL_ERROR for a bad method, size or frequency
+  */
+
+HAL_StatusTypeDef toneInit(ToneBank *bank, uint8_t method, uint32_t frame_len, float32_t fs, const float32_t *frequencies, uint32_t num_tones, float32_t *memory) {
+	float32_t *coeffs;
+	float64_t w, cycles, r;
+	uint32_t t;
+
+	if(method > TONE_SLIDING || frame_len < 2 || num_tones < 1 || num_tones > TONE_MAX_DETECTORS)
+		return HAL_ERROR;
+	for(t = 0; t < num_tones; t++) {
+		if(frequencies[t] <= 0 || frequencies[t] >= fs/2)
+			return HAL_ERROR;
+	}
+
+	bank->method = method;
+	bank->num_tones = num_tones;
+	bank->frame_len = frame_len;
+	bank->coeffs = memory;
+	bank->state = bank->coeffs + TONE_COEFFS*num_tones;
+	bank->magnitude = bank->state + 2*num_tones;
+	bank->phase = bank->magnitude + num_tones;
+	bank->history = bank->phase + num_tones;
+
+	//Weights r^k, k = 0 for the newest sample, for the sliding DFT
+	r = (method == TONE_SLIDING) ? exp(-TONE_SLIDING_LEAK/frame_len) : 1.0;
+	bank->leak = (float32_t)pow(r, frame_len - 1);
+	if(method == TONE_SLIDING)
+		bank->scale = (float32_t)(2*(1 - r)/(1 - pow(r, frame_len)));
+	else
+		bank->scale = 2.0f/frame_len;
+
+	//Recurrence, cos and sin of w, then of w*(frame_len - 1) from the fraction
+	//of a cycle so long frames keep their phase in single precision
+	for(t = 0; t < num_tones; t++) {
+		coeffs = &bank->coeffs[TONE_COEFFS*t];
+		w = 6.283185307179586*frequencies[t]/fs;
+		cycles = (float64_t)frequencies[t]*(frame_len - 1)/fs;
+		cycles -= floor(cycles);
+		coeffs[0] = (float32_t)((method == TONE_SLIDING) ? r*cos(w) : 2*cos(w));
+		coeffs[1] = (float32_t)(r*sin(w));
+		coeffs[2] = (float32_t)cos(w);
+		coeffs[3] = (float32_t)sin(w);
+		coeffs[4] = (float32_t)cos(6.283185307179586*cycles);
+		coeffs[5] = (float32_t)sin(6.283185307179586*cycles);
+	}
+
+	toneReset(bank);
+	return HAL_OK;
+}
+
+/**
+  * @brief  Clear the frame in progress, the history and the results
+  * @param  bank: bank
+  * @retval none
+  */
+
+void toneReset(ToneBank *bank) {
+	memset(bank->state, 0, 4*bank->num_tones*sizeof(float32_t));
+	if(bank->method == TONE_SLIDING)
+		memset(bank->history, 0, bank->frame_len*sizeof(float32_t));
+	bank->count = 0;
+}
+
+/**
+  * @brief  Run the Goertzel recurrences over samples of one frame
+  * @param  bank: bank
+  * @param  x: samples
+  * @param  n: number of samples, no further than the end of the frame
+  * @retval none
+  */
+
+static void goertzel(ToneBank *bank, const float32_t *x, uint32_t n) {
+	const float32_t *coeffs = bank->coeffs;
+	float32_t *state = bank->state;
+	float32_t c, s0, s1, s2;
+	uint32_t t, i;
+
+	//One detector at a time keeps its state in registers for the whole run
+	for(t = 0; t < bank->num_tones; t++) {
+		c = coeffs[0];
+		s1 = state[0];
+		s2 = state[1];
+		for(i = 0; i < n; i++) {
+			s0 = x[i] + c*s1 - s2;
+			s2 = s1;
+			s1 = s0;
+		}
+		state[0] = s1;
+		state[1] = s2;
+		coeffs += TONE_COEFFS;
+		state += 2;
+	}
+}
+
+/**
+  * @brief  Finish a Goertzel frame, X(w) = (s1 - e^-jw s2) e^-jw(N-1)
+  * @param  bank: bank
+  * @retval none
+  */
+
+static void goertzelResults(ToneBank *bank) {
+	const float32_t *coeffs = bank->coeffs;
+	float32_t *state = bank->state;
+	float32_t yr, yi, xr, xi;
+	uint32_t t;
+
+	for(t = 0; t < bank->num_tones; t++) {
+		yr = state[0] - coeffs[2]*state[1];
+		yi = coeffs[3]*state[1];
+		xr = yr*coeffs[4] + yi*coeffs[5];
+		xi = yi*coeffs[4] - yr*coeffs[5];
+		bank->magnitude[t] = bank->scale*sqrtf(xr*xr + xi*xi);
+		bank->phase[t] = atan2f(xi, xr);
+		state[0] = 0;
+		state[1] = 0;
+		coeffs += TONE_COEFFS;
+		state += 2;
+	}
+}
+
+/**
+  * @brief  Slide the DFTs over samples,
+  *					S(n) = r e^jw (S(n-1) - r^(N-1) x(n-N)) + x(n) e^-jw(N-1)
+  * @param  bank: bank
+  * @param  x: samples
+  * @param  n: number of samples, no further than the end of the history
+  * @retval none
+  */
+
+static void sliding(ToneBank *bank, const float32_t *x, uint32_t n) {
+	const float32_t *coeffs = bank->coeffs;
+	const float32_t *old = &bank->history[bank->count];
+	float32_t *state = bank->state;
+	float32_t a, b, cn, sn, leak = bank->leak, re, im, tr;
+	uint32_t t, i;
+
+	for(t = 0; t < bank->num_tones; t++) {
+		a = coeffs[0];
+		b = coeffs[1];
+		cn = coeffs[4];
+		sn = coeffs[5];
+		re = state[0];
+		im = state[1];
+		for(i = 0; i < n; i++) {
+			tr = re - leak*old[i];
+			re = a*tr - b*im + x[i]*cn;
+			im = a*im + b*tr - x[i]*sn;
+		}
+		state[0] = re;
+		state[1] = im;
+		coeffs += TONE_COEFFS;
+		state += 2;
+	}
+	//The samples leave the window frame_len samples from now
+	memcpy(&bank->history[bank->count], x, n*sizeof(float32_t));
+}
+
+/**
+  * @brief  Results of the sliding DFTs, the phase is that of the oldest sample
+  *					of the window
+  * @param  bank: bank
+  * @retval none
+  */
+
+static void slidingResults(ToneBank *bank) {
+	const float32_t *state = bank->state;
+	uint32_t t;
+
+	for(t = 0; t < bank->num_tones; t++) {
+		bank->magnitude[t] = bank->scale*sqrtf(state[0]*state[0] + state[1]*state[1]);
+		bank->phase[t] = atan2f(state[1], state[0]);
+		state += 2;
+	}
+}
+
+/**
+  * @brief  Run the detectors over contiguous samples
+  * @param  bank: bank
+  * @param  x: samples
+  * @param  n: number of samples
+  * @retval 1 when the results are new, 0 otherwise
+  */
+
+static int processChunk(ToneBank *bank, const float32_t *x, uint32_t n) {
+	uint32_t count;
+	int ready = 0;
+
+	while(n > 0) {
+		//Up to the end of the frame or of the history
+		count = bank->frame_len - bank->count;
+		if(count > n) count = n;
+		if(bank->method == TONE_GOERTZEL)
+			goertzel(bank, x, count);
+		else
+			sliding(bank, x, count);
+		bank->count += count;
+		x += count;
+		n -= count;
+		if(bank->count == bank->frame_len) {
+			bank->count = 0;
+			if(bank->method == TONE_GOERTZEL) {
+				goertzelResults(bank);
+				ready = 1;
+			}
+		}
+	}
+	return ready;
+}
+
+/**
+  * @brief  Add a block of Q15 samples, e.g. one slot of the DMA buffer
+  * @param  bank: bank
+  * @param  data: samples
+  * @param  n: number of samples, any size
+  * @param  stride: distance between samples, 2 for one slot of the
+  *					interleaved buffer
+  * @retval 1 when bank->magnitude and bank->phase are new, for TONE_GOERTZEL
+  *					when a frame ended in the block, the last one if more did,
+  *					for TONE_SLIDING after every block
+  */
+
+int toneProcessQ15(ToneBank *bank, const int16_t *data, uint32_t n, uint32_t stride) {
+	float32_t x[TONE_CHUNK];
+	uint32_t count, i;
+	int ready = 0;
+
+	while(n > 0) {
+		count = (n < TONE_CHUNK) ? n : TONE_CHUNK;
+		for(i = 0; i < count; i++) {
+			x[i] = (float32_t)*data*(1.0f/32768.0f);
+			data += stride;
+		}
+		ready |= processChunk(bank, x, count);
+		n -= count;
+	}
+	if(bank->method == TONE_SLIDING && ready == 0) {
+		slidingResults(bank);
+		ready = 1;
+	}
+	return ready;
+}
+
+/**
+  * @brief  Add a block of floating point samples, full scale is 1.0
+  * @param  bank: bank
+  * @param  data: samples
+  * @param  n: number of samples, any size
+  * @param  stride: distance between samples
+  * @retval as for toneProcessQ15()
+  */
+
+int toneProcessF32(ToneBank *bank, const float32_t *data, uint32_t n, uint32_t stride) {
+	float32_t x[TONE_CHUNK];
+	uint32_t count, i;
+	int ready = 0;
+
+	if(stride == 1) {
+		ready = processChunk(bank, data, n);
+	} else {
+		while(n > 0) {
+			count = (n < TONE_CHUNK) ? n : TONE_CHUNK;
+			for(i = 0; i < count; i++) {
+				x[i] = *data;
+				data += stride;
+			}
+			ready |= processChunk(bank, x, count);
+			n -= count;
+		}
+	}
+	if(bank->method == TONE_SLIDING && ready == 0) {
+		slidingResults(bank);
+		ready = 1;
+	}
+	return ready;
+}
+
+#if TONE_BENCHMARK
+//Cycle counter, the host build times with a clock instead
+#ifndef TONE_CYCLES
+#define TONE_CYCLES()         (DWT->CYCCNT)
+#endif
+
+#define TONE_BENCH_FRAME      480				//10 ms at 48 kHz
+#define TONE_BENCH_BLOCK      96
+#define TONE_BENCH_SAMPLES    48000
+
+static float32_t bench_memory[TONE_MEMORY(TONE_BENCH_DETECTORS, TONE_BENCH_FRAME)];
+static int16_t bench_block[TONE_BENCH_BLOCK];
+
+/**
+  * @brief  Measure the cost of TONE_BENCH_DETECTORS detectors over one second
+  *					at 48 kHz in blocks of 96 samples
+  * @param  cycles: cycles per detector and sample, TONE_GOERTZEL then
+  *					TONE_SLIDING
+  * @retval none
+  */
+
+void toneBenchmark(float32_t cycles[2]) {
+	ToneBank bank;
+	float32_t frequencies[TONE_BENCH_DETECTORS];
+	uint32_t method, i, start, total;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	for(i = 0; i < TONE_BENCH_DETECTORS; i++)
+		frequencies[i] = 300.0f + 350.0f*i;
+	for(i = 0; i < TONE_BENCH_BLOCK; i++)
+		bench_block[i] = (int16_t)(i*683);
+
+	for(method = TONE_GOERTZEL; method <= TONE_SLIDING; method++) {
+		toneInit(&bank, method, TONE_BENCH_FRAME, 48000.0f, frequencies, TONE_BENCH_DETECTORS, bench_memory);
+		total = 0;
+		for(i = 0; i < TONE_BENCH_SAMPLES; i += TONE_BENCH_BLOCK) {
+			start = TONE_CYCLES();
+			toneProcessQ15(&bank, bench_block, TONE_BENCH_BLOCK, 1);
+			total += TONE_CYCLES() - start;
+		}
+		cycles[method] = (float32_t)total/((float32_t)TONE_BENCH_SAMPLES*TONE_BENCH_DETECTORS);
+	}
+}
+#endif /* TONE_BENCHMARK */
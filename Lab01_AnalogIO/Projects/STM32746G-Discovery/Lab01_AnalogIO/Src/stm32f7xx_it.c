@@ -51,6 +51,20 @@ void DMA2_Stream4_IRQHandler(void)
 		HAL_DMA_IRQHandler(haudio_out_sai.hdmatx);
 }
 
+extern LTDC_HandleTypeDef hLtdcHandler;
+
+void LTDC_IRQHandler(void)
+{
+    HAL_LTDC_IRQHandler(&hLtdcHandler);
+}
+
+//User button and touch screen, stm32f7_input.c
+void EXTI15_10_IRQHandler(void)
+{
+    HAL_GPIO_EXTI_IRQHandler(KEY_BUTTON_PIN);
+    HAL_GPIO_EXTI_IRQHandler(TS_INT_PIN);
+}
+
 
 /******************************************************************************/
 /*            Cortex-M7 Processor Exceptions Handlers                         */
@@ -1,6 +1,11 @@
-#include "armlogo.h"
+#ifndef __STM32F7_DISPLAY_H
+#define __STM32F7_DISPLAY_H
+
 #include "arm_math.h"
 #include "stm32746g_discovery_lcd.h"
+#include "stm32f7_glyph.h"
+#include "stm32f7_input.h"
+#include "stm32f7_render.h"
 #include "stm32f7xx_hal.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -25,6 +30,18 @@
   */
 #define LCD_FRAME_BUFFER          SDRAM_DEVICE_ADDR
 
+/**
+  * @brief  Pixel format of the graph layer (LTDC_ACTIVE_LAYER)
+  * RGB565 halves the SDRAM traffic of the graph layer scanout and fills. The
+  * colours stay ARGB8888 constants, DMA2D converts them for an RGB565 layer.
+  */
+#define GRAPH_LAYER_ARGB8888      0
+#define GRAPH_LAYER_RGB565        1
+
+#ifndef GRAPH_LAYER_FORMAT
+#define GRAPH_LAYER_FORMAT        GRAPH_LAYER_RGB565
+#endif
+
 /**
   * @brief  Camera frame buffer start address
   * Assuming LCD frame buffer is of size 480x800 and format ARGB8888 (32 bits per pixel).
@@ -51,9 +68,12 @@
 #define WAVE 3
 #define LOGFFT 4
 
+#define CLEAR_PERIOD_MS 1600 //Bar graphs drawn over the old bars are cleared this often
+
 #define FFT_YCENTRE 260
 #define GRAPH_YCENTRE 140
 #define LOGFFT_YCENTRE 68
+#define LOGFFT_RANGE_DB 140.0f //plotLogFFT() draws zeros this far below the largest bin
 
 #define BACKGROUND_COLOUR LCD_COLOR_WHITE
 #define GRAPH_COLOUR LCD_COLOR_BLUE
@@ -74,12 +94,15 @@
 #define NO_AUTO_SCALING 0
 
 void init_LCD(int16_t sample_frequency, char *name, int16_t io_method, int graph);
+void initGraphLayer(void);
 void stm32f7_LCD_init(int16_t sample_frequency, char *name, int graph);
 void clearScreen(void);
+void drawAxes(int ycentre, int ymax, int ymin, float max, float min, float dB_per_divs, int size, int xpos, int type);
 void plotWave(float32_t * data_buffer, int size, int live, int complex);
 void plotWaveNoAutoScale(float32_t * data_buffer, int num_samples);
 void plotSamples(int16_t * data_buffer, int num_samples, int num_plots);
 void plotSamplesIntr(int16_t data_sample, int num_plots);
+void plotLongSamples(int16_t * data_buffer, uint32_t num_samples);
 void plotFFT(float32_t * data_buffer, int size, int auto_scaling);
 void plotLogFFT(float32_t * data_buffer, int size, int live);
 void plotLMS(float32_t * data_buffer, int size, int live);
@@ -87,4 +110,6 @@ int checkButtonFlag(void);
 void changeButtonFlag(int value);
 void proceed_statement(void);
 
-uint8_t CheckForUserInput(void);
\ No newline at end of file
+uint8_t CheckForUserInput(void);
+
+#endif /* __STM32F7_DISPLAY_H */
\ No newline at end of file
@@ -9,12 +9,16 @@
   */
 
 /* Includes ------------------------------------------------------------------*/
-#include "stm32f7_display.h"
+#include "stm32f7_envelope.h"
+#include "stm32f7_decibel.h"
+#include "stm32f7_image.h"
+#include "armlogo.h"
 
-int refresh_counter = 0;	//Control the refresh rate
-//If the program is intr, this factor will be larger
-//because the intr program will run faster than dma program
-int refresh_counter_factor = 1;
+#define LOGFFT_CHUNK 64		//Bins plotLogFFT() converts to decibels at a time
+
+//Tick of the last clearScreen(), the bar graphs that are not cleared every
+//frame are rubbed out every CLEAR_PERIOD_MS
+static uint32_t clear_tick = 0;
 
 int button_flag = 0;	//A flag to control the button state
 int stop = 0;	//A flag to stop drawing the graph to make a static graph
@@ -26,25 +30,43 @@ int fixymax, fixymin = 0; //A variable to save the ymax and ymin which use in dr
 //use it in drawAxes(), initialise to a random value
 uint16_t frequency = 0;
 
-//A temporary buffer to store data from the main
+//Peak envelope of the buffers that are longer than the graph
+//use in plotWave(), plotWaveNoAutoScale() and plotLongSamples()
+static Envelope wave_envelope;
+
+//Peak envelope filled one sample at a time from the main
 //use in plotSamplesIntr()
-int16_t temp_buffer[256];
-int16_t temp_buffer_ptr = 0;
+static Envelope intr_envelope;
 
 /**
-  * @brief  Check for user input.
+  * @brief  Check for user input, never waits for the button to be released.
   * @param  None
-  * @retval Input state (1 : active / 0 : Inactive)
+  * @retval Input state (1 : pressed since the last check / 0 : Inactive)
   */
  uint8_t CheckForUserInput(void)
 {
-  if (BSP_PB_GetState(BUTTON_KEY) != RESET)
-  {
-//    HAL_Delay(10);
-    while (BSP_PB_GetState(BUTTON_KEY) != RESET);
-    return 1 ;
-  }
-  return 0;
+  return inputButtonPressed();
+}
+
+/**
+  * @brief  Draw a vertical bar between two y locations on the selected layer,
+	*					the line is a DMA2D fill so it works for any layer pixel format
+  * @param  x: bar x location
+  * @param  y1: y location of one end
+  * @param  y2: y location of the other end
+  * @retval none
+  */
+
+static void drawBar(int x, int y1, int y2) {
+	int top = (y1 < y2) ? y1 : y2;
+	int bottom = (y1 < y2) ? y2 : y1;
+
+	//Safety measure to avoid the bars go outside the screen
+	if(top < 0) top = 0;
+	if(bottom > (int)BSP_LCD_GetYSize() - 1) bottom = BSP_LCD_GetYSize() - 1;
+	if(x < 0 || x >= (int)BSP_LCD_GetXSize() || top > bottom) return;
+
+	BSP_LCD_DrawVLine(x, top, bottom - top + 1);
 }
 
 /**
@@ -80,6 +102,7 @@ void drawGrid(char * name) {
 	//Go back to the graph layer for the remaining graph drawing
 	BSP_LCD_SelectLayer(LTDC_ACTIVE_LAYER);
 	BSP_LCD_Clear(BACKGROUND_COLOUR);
+	invalidateLabels();
 	BSP_LCD_SetTransparency(1, 200);
 }
 
@@ -97,7 +120,7 @@ void drawGrid(char * name) {
   */
 
 void drawAxes (int ycentre, int ymax, int ymin, float max, float min, float dB_per_divs, int size, int xpos, int type) {
-	uint32_t axes_value [20];
+	char axes_value [LABEL_MAX_LEN + 1];
 
 	int i = 0;
 	
@@ -112,35 +135,34 @@ void drawAxes (int ycentre, int ymax, int ymin, float max, float min, float dB_p
 
 		//Clear the y-axis area
 		BSP_LCD_SetTextColor(BACKGROUND_COLOUR);
-		BSP_LCD_FillRect(0, HEADER_HEIGHT, FIRST_DATA_PIXEL, 272);
+		BSP_LCD_FillRect(0, HEADER_HEIGHT, FIRST_DATA_PIXEL, 272 - HEADER_HEIGHT);
+		forgetLabels(0, HEADER_HEIGHT, FIRST_DATA_PIXEL, 272 - HEADER_HEIGHT);
 		BSP_LCD_SetTextColor(TEXT_COLOUR);
 		BSP_LCD_SetBackColor(BACKGROUND_COLOUR);		
 
 		if(dB_per_divs != 0) {
-			sprintf((char*)axes_value, "%.3f dB/div", dB_per_divs);
-			BSP_LCD_DisplayStringAt(0, 20, (uint8_t * ) &axes_value, LEFT_MODE);	
+			i = formatFloat(axes_value, dB_per_divs, 3);
+			strcpy(axes_value + i, " dB/div");
+			drawLabel(0, 20, axes_value, LEFT_MODE);	
 			
 			if(ycentre != FFT_YCENTRE) {
 				//Display 0
-				sprintf((char*)axes_value, "%c", '0');
-				BSP_LCD_DisplayStringAt(0, ycentre, (uint8_t * ) &axes_value, LEFT_MODE);					
+				drawLabel(0, ycentre, "0", LEFT_MODE);					
 			}
 			
 		} else {
 			//Display 0
-			
-			sprintf((char*)axes_value, "%c", '0');
-			BSP_LCD_DisplayStringAt(0, ycentre, (uint8_t * ) &axes_value, LEFT_MODE);	
+			drawLabel(0, ycentre, "0", LEFT_MODE);	
 			
 			if((ycentre - ymax) > 5) { 
-				sprintf((char*)axes_value, "%.3f", max);
-				BSP_LCD_DisplayStringAt(0, ymax, (uint8_t * ) &axes_value, LEFT_MODE);
+				formatFloat(axes_value, max, 3);
+				drawLabel(0, ymax, axes_value, LEFT_MODE);
 			}		
 			
 			if((ymin - ycentre) > 5) { 
 				//BSP_LCD_SetTextColor(LCD_COLOR_YELLOW);	//for debugging
-				sprintf((char*)axes_value, "%.3f", min);
-				BSP_LCD_DisplayStringAt(0, ymin, (uint8_t * ) &axes_value, LEFT_MODE);
+				formatFloat(axes_value, min, 3);
+				drawLabel(0, ymin, axes_value, LEFT_MODE);
 			}
 		}
 		update_flag = 0;
@@ -152,69 +174,66 @@ void drawAxes (int ycentre, int ymax, int ymin, float max, float min, float dB_p
 		
 		case LMS:
 			BSP_LCD_SetTextColor(TEXT_COLOUR);
-			BSP_LCD_DisplayStringAt(0, 0, (uint8_t * ) "sample value", LEFT_MODE);		
+			drawLabel(0, 0, "sample value", LEFT_MODE);		
 
 			BSP_LCD_SetTextColor(TEXT_COLOUR);
 			BSP_LCD_SetBackColor(BACKGROUND_COLOUR);
 		
 			BSP_LCD_SetTextColor(TEXT_COLOUR);
-			BSP_LCD_DisplayStringAt(20, GRAPH_VER_END_PIXEL - 15, (uint8_t * ) "Time(s)", RIGHT_MODE);
-			//BSP_LCD_DisplayStringAt(20, 50, (uint8_t * ) "LMS Graph", RIGHT_MODE); //Uncomment this if the graph name is needed on screen
+			drawLabel(20, GRAPH_VER_END_PIXEL - 15, "Time(s)", RIGHT_MODE);
+			//drawLabel(20, 50, "LMS Graph", RIGHT_MODE); //Uncomment this if the graph name is needed on screen
 			
-			sprintf((char*)axes_value, "%c", '0');
-			BSP_LCD_DisplayStringAt(FIRST_DATA_PIXEL+3, GRAPH_VER_END_PIXEL+2, (uint8_t * ) &axes_value, LEFT_MODE);
+			drawLabel(FIRST_DATA_PIXEL+3, GRAPH_VER_END_PIXEL+2, "0", LEFT_MODE);
 			
 			for(i = 1; i < 5; i++) {
-				sprintf((char*)axes_value, "%.3f", (float)64*i/frequency);
-				BSP_LCD_DisplayStringAt(FIRST_DATA_PIXEL+64*i+3, GRAPH_VER_END_PIXEL+2, (uint8_t * ) &axes_value, LEFT_MODE);
+				//Time of each grid line in milliseconds, shown in seconds
+				formatFixed(axes_value, frequency ? (int32_t)((64000u*i + frequency/2)/frequency) : 0, 3);
+				drawLabel(FIRST_DATA_PIXEL+64*i+3, GRAPH_VER_END_PIXEL+2, axes_value, LEFT_MODE);
 			}
 			break;
 			
 		case FFT:
 
 			BSP_LCD_SetTextColor(TEXT_COLOUR);
-			BSP_LCD_DisplayStringAt(0, 0, (uint8_t * ) "Magnitude", LEFT_MODE);
+			drawLabel(0, 0, "Magnitude", LEFT_MODE);
 		
 			BSP_LCD_SetTextColor(TEXT_COLOUR);
-			BSP_LCD_DisplayStringAt(20, GRAPH_VER_END_PIXEL - 15, (uint8_t * ) "Frequency(Hz)", RIGHT_MODE);	
-			//BSP_LCD_DisplayStringAt(20, 50, (uint8_t * ) "FFT Graph", RIGHT_MODE);	//Uncomment this if the graph name is needed on screen
+			drawLabel(20, GRAPH_VER_END_PIXEL - 15, "Frequency(Hz)", RIGHT_MODE);	
+			//drawLabel(20, 50, "FFT Graph", RIGHT_MODE);	//Uncomment this if the graph name is needed on screen
 		
-			sprintf((char*)axes_value, "%c", '0');
-			BSP_LCD_DisplayStringAt(FIRST_DATA_PIXEL, GRAPH_VER_END_PIXEL+2, (uint8_t * ) &axes_value, LEFT_MODE);		
+			drawLabel(FIRST_DATA_PIXEL, GRAPH_VER_END_PIXEL+2, "0", LEFT_MODE);		
 		
-			sprintf((char*)axes_value, "%d", frequency/2);
-			BSP_LCD_DisplayStringAt(xpos, GRAPH_VER_END_PIXEL+2, (uint8_t * ) &axes_value, LEFT_MODE);
+			formatInt(axes_value, frequency/2);
+			drawLabel(xpos, GRAPH_VER_END_PIXEL+2, axes_value, LEFT_MODE);
 		
 			break;
 		
 		case WAVE:
 			BSP_LCD_SetTextColor(TEXT_COLOUR);
-			BSP_LCD_DisplayStringAt(0, 0, (uint8_t * ) "sample value", LEFT_MODE);
+			drawLabel(0, 0, "sample value", LEFT_MODE);
 		
 			BSP_LCD_SetTextColor(TEXT_COLOUR);
-			BSP_LCD_DisplayStringAt(20, GRAPH_VER_END_PIXEL - 15, (uint8_t * ) "sample number", RIGHT_MODE);	
-			//BSP_LCD_DisplayStringAt(20, 50, (uint8_t * ) "Input signal", RIGHT_MODE);	//Uncomment this if the graph name is needed on screen
+			drawLabel(20, GRAPH_VER_END_PIXEL - 15, "sample number", RIGHT_MODE);	
+			//drawLabel(20, 50, "Input signal", RIGHT_MODE);	//Uncomment this if the graph name is needed on screen
 		
-			sprintf((char*)axes_value, "%c", '0');
-			BSP_LCD_DisplayStringAt(FIRST_DATA_PIXEL, GRAPH_VER_END_PIXEL+2, (uint8_t * ) &axes_value, LEFT_MODE);		
+			drawLabel(FIRST_DATA_PIXEL, GRAPH_VER_END_PIXEL+2, "0", LEFT_MODE);		
 		
-			sprintf((char*)axes_value, "%d", size);
-			BSP_LCD_DisplayStringAt(xpos, GRAPH_VER_END_PIXEL+2, (uint8_t * ) &axes_value, LEFT_MODE);
+			formatInt(axes_value, size);
+			drawLabel(xpos, GRAPH_VER_END_PIXEL+2, axes_value, LEFT_MODE);
 			break;
 		
 		case LOGFFT:
 			BSP_LCD_SetTextColor(TEXT_COLOUR);
-			BSP_LCD_DisplayStringAt(0, 0, (uint8_t * ) "Magnitude(dB)", LEFT_MODE);
-			//BSP_LCD_DisplayStringAt(20, 50, (uint8_t * ) "FFT Graph", RIGHT_MODE);	//Uncomment this if the graph name is needed on screen
+			drawLabel(0, 0, "Magnitude(dB)", LEFT_MODE);
+			//drawLabel(20, 50, "FFT Graph", RIGHT_MODE);	//Uncomment this if the graph name is needed on screen
 		
 			BSP_LCD_SetTextColor(TEXT_COLOUR);
-			BSP_LCD_DisplayStringAt(20, GRAPH_VER_END_PIXEL - 15, (uint8_t * ) "Frequency(Hz)", RIGHT_MODE);	
+			drawLabel(20, GRAPH_VER_END_PIXEL - 15, "Frequency(Hz)", RIGHT_MODE);	
 
-			sprintf((char*)axes_value, "%c", '0');
-			BSP_LCD_DisplayStringAt(FIRST_DATA_PIXEL, GRAPH_VER_END_PIXEL+2, (uint8_t * ) &axes_value, LEFT_MODE);		
+			drawLabel(FIRST_DATA_PIXEL, GRAPH_VER_END_PIXEL+2, "0", LEFT_MODE);		
 		
-			sprintf((char*)axes_value, "%d", frequency/2);
-			BSP_LCD_DisplayStringAt(xpos, GRAPH_VER_END_PIXEL+2, (uint8_t * ) &axes_value, LEFT_MODE);			
+			formatInt(axes_value, frequency/2);
+			drawLabel(xpos, GRAPH_VER_END_PIXEL+2, axes_value, LEFT_MODE);			
 			break;
 	}
 		
@@ -230,8 +249,8 @@ void drawAxes (int ycentre, int ymax, int ymin, float max, float min, float dB_p
 	*														variable frequency
   * @param  name: get the program name from the main and use in
 	*								the drawGrid()
-  * @param  io_method: IO_METHOD_DMA = slower refresh rate,
-	*										 IO_METHOD_INTR = faster refresh rate
+  * @param  io_method: 0 draws the live plots at RENDER_DEFAULT_FPS, any other
+	*										value at RENDER_MAX_FPS
   * @param  graph: GRAPH = display graph, NOGRAPH = display start screen only
   * @retval none
   */
@@ -242,9 +261,10 @@ void init_LCD(int16_t sample_frequency, char *name, int16_t io_method, int graph
 
 	// Set up the LCD
 	BSP_LCD_Init();
+	initGlyphAtlas();
 	
 	BSP_LCD_LayerDefaultInit(0, 0xC0400000); //Initialise the logo layer
-	BSP_LCD_LayerDefaultInit(LTDC_ACTIVE_LAYER, LCD_FRAME_BUFFER);
+	initGraphLayer();
 	
 	BSP_LCD_DisplayOn();
 	
@@ -258,28 +278,45 @@ void init_LCD(int16_t sample_frequency, char *name, int16_t io_method, int graph
 	BSP_LCD_SetTransparency(0, 255);
 	BSP_LCD_SetTransparency(1, 150);
 	
-	BSP_LCD_SelectLayer(0);
-	/* Draw Bitmap Logo*/
-	BSP_LCD_DrawBitmap(50, 70, (uint8_t *)armlogo);
+	/* Draw the palette + RLE logo */
+	drawRleImage(0, 50, 70, &armlogo);
 
 	BSP_LCD_SelectLayer(LTDC_ACTIVE_LAYER);	
 	 /* Set the LCD Text Color */
 	BSP_LCD_SetTextColor(TEXT_COLOUR);
 	
 	 /* Display LCD messages */
-	BSP_LCD_DisplayStringAt(0, 10, (uint8_t *)"STM32F746G DSP Education Kit", CENTER_MODE);
+	drawString(LTDC_ACTIVE_LAYER, 0, 10, "STM32F746G DSP Education Kit", CENTER_MODE);
 	if(strlen(name) > 28) BSP_LCD_SetFont(&Font16);
-	BSP_LCD_DisplayStringAt(0, 50, (uint8_t *)name, CENTER_MODE);
+	drawString(LTDC_ACTIVE_LAYER, 0, 50, name, CENTER_MODE);
 	BSP_LCD_SetFont(&Font24);
-	if(io_method == 0) {
-		refresh_counter_factor = 100;
-	}
 	if(graph == 1){
-		BSP_LCD_DisplayStringAt(0, 200, (uint8_t *)"Press User Button to start", CENTER_MODE);
-		while(CheckForUserInput() != 1){}	
+		drawString(LTDC_ACTIVE_LAYER, 0, 200, "Press User Button to start", CENTER_MODE);
+		//Sleep until an interrupt, the button one or the tick
+		while(CheckForUserInput() != 1){
+			__WFI();
+		}
 			
 		drawGrid(name);
 	}
+
+	//Live plots are drawn at a steady frame rate from now on
+	renderInit((io_method == 0) ? RENDER_DEFAULT_FPS : RENDER_MAX_FPS, RENDER_DEFAULT_BUDGET);
+}
+
+/**
+  * @brief  Initialise the graph layer (LTDC_ACTIVE_LAYER) over the whole screen
+	*					in the GRAPH_LAYER_FORMAT pixel format
+  * @param  none
+  * @retval none
+  */
+
+void initGraphLayer(void) {
+#if GRAPH_LAYER_FORMAT == GRAPH_LAYER_RGB565
+	BSP_LCD_LayerRgb565Init(LTDC_ACTIVE_LAYER, LCD_FRAME_BUFFER);
+#else
+	BSP_LCD_LayerDefaultInit(LTDC_ACTIVE_LAYER, LCD_FRAME_BUFFER);
+#endif
 }
 
 /**
@@ -290,14 +327,11 @@ void init_LCD(int16_t sample_frequency, char *name, int16_t io_method, int graph
   */
 
 void clearScreen () {
-	unsigned i = 0;
-	
-	refresh_counter = 0;
+	clear_tick = HAL_GetTick();
 	
-	for(i = FIRST_DATA_PIXEL; i < GRAPH_WIDTH+FIRST_DATA_PIXEL; i++) {	
-		BSP_LCD_SetTextColor(BACKGROUND_COLOUR);
-		BSP_LCD_DrawVLine(i, 0, GRAPH_VER_END_PIXEL);	
-	}
+	//One fill for the whole area rather than a DMA2D transfer per column
+	BSP_LCD_SetTextColor(BACKGROUND_COLOUR);
+	BSP_LCD_FillRect(FIRST_DATA_PIXEL, 0, GRAPH_WIDTH, GRAPH_VER_END_PIXEL);
 }
 
 /**
@@ -311,22 +345,22 @@ void clearScreen () {
   */
 
 void debug_display(int ymax, int ymin, float max, float min, float biggestmag, float yscalefactor) {
-	uint8_t axes_debug_value [20];
+	uint8_t axes_debug_value [32];
 
 	BSP_LCD_SetFont(&Font12);
 	
-	sprintf((char*)axes_debug_value, "ymax: %d", ymax);
-	BSP_LCD_DisplayStringAt(10, 20, (uint8_t * ) &axes_debug_value, RIGHT_MODE);
-	sprintf((char*)axes_debug_value, "ymin: %d", ymin);
-	BSP_LCD_DisplayStringAt(10, 30, (uint8_t * ) &axes_debug_value, RIGHT_MODE);
-	sprintf((char*)axes_debug_value, "max: %g", max);
-	BSP_LCD_DisplayStringAt(10, 40, (uint8_t * ) &axes_debug_value, RIGHT_MODE);
-	sprintf((char*)axes_debug_value, "min: %g", min);
-	BSP_LCD_DisplayStringAt(10, 50, (uint8_t * ) &axes_debug_value, RIGHT_MODE);
-	sprintf((char*)axes_debug_value, "ycentre: %g", biggestmag);
-	BSP_LCD_DisplayStringAt(10, 60, (uint8_t * ) &axes_debug_value, RIGHT_MODE);	
-	sprintf((char*)axes_debug_value, "yscalefactor: %g", yscalefactor);
-	BSP_LCD_DisplayStringAt(10, 70, (uint8_t * ) &axes_debug_value, RIGHT_MODE);	
+	snprintf((char*)axes_debug_value, sizeof(axes_debug_value), "ymax: %d", ymax);
+	drawString(LTDC_ACTIVE_LAYER, 10, 20, (char *)axes_debug_value, RIGHT_MODE);
+	snprintf((char*)axes_debug_value, sizeof(axes_debug_value), "ymin: %d", ymin);
+	drawString(LTDC_ACTIVE_LAYER, 10, 30, (char *)axes_debug_value, RIGHT_MODE);
+	snprintf((char*)axes_debug_value, sizeof(axes_debug_value), "max: %g", max);
+	drawString(LTDC_ACTIVE_LAYER, 10, 40, (char *)axes_debug_value, RIGHT_MODE);
+	snprintf((char*)axes_debug_value, sizeof(axes_debug_value), "min: %g", min);
+	drawString(LTDC_ACTIVE_LAYER, 10, 50, (char *)axes_debug_value, RIGHT_MODE);
+	snprintf((char*)axes_debug_value, sizeof(axes_debug_value), "ycentre: %g", biggestmag);
+	drawString(LTDC_ACTIVE_LAYER, 10, 60, (char *)axes_debug_value, RIGHT_MODE);	
+	snprintf((char*)axes_debug_value, sizeof(axes_debug_value), "yscalefactor: %g", yscalefactor);
+	drawString(LTDC_ACTIVE_LAYER, 10, 70, (char *)axes_debug_value, RIGHT_MODE);	
 }
 
 /**
@@ -339,19 +373,16 @@ void debug_display(int ymax, int ymin, float max, float min, float biggestmag, f
   */
 
 void plotWave(float32_t * data_buffer, int num_samples, int live, int complex) {
-	int16_t i;
+	int i;
 	int16_t xvalue;              // x in pixels
 	int16_t ymax = HEADER_HEIGHT;
 	int16_t ymin = GRAPH_VER_END_PIXEL;                  // max and min y values in pixels
 	float32_t max, min = data_buffer[0]; // max and min y values passed to function
 	float32_t biggestmag, yscalefactor;
-	float x_spacing = 1;
 	int step = 1;
 	
 	if(complex) step = 2;
 	
-	x_spacing = GRAPH_WIDTH / (num_samples*step);
-	
 	// initialise some variables
 	max = data_buffer[0];
 	min = data_buffer[0];
@@ -363,10 +394,17 @@ void plotWave(float32_t * data_buffer, int num_samples, int live, int complex) {
 		//If static data is needed, the graph will only be drawn once
 		stop = 1;
 
-		// determine min and max values
-		for(i = 0; i < num_samples*step; i++) {		
-			if(min >= data_buffer[i])	min = data_buffer[i];
-			if(max <= data_buffer[i]) max = data_buffer[i];
+		//More samples than columns, only the peak envelope of each column can be shown
+		if(num_samples*step > GRAPH_WIDTH) {
+			envelopeInit(&wave_envelope, num_samples*step);
+			envelopeAddF32(&wave_envelope, data_buffer, num_samples*step);
+			envelopeRange(&wave_envelope, &min, &max);
+		} else {
+			// determine min and max values
+			for(i = 0; i < num_samples*step; i++) {		
+				if(min >= data_buffer[i])	min = data_buffer[i];
+				if(max <= data_buffer[i]) max = data_buffer[i];
+			}
 		}
 
 		//Determine the largest value and limit the graph size by using yscalefactor
@@ -377,31 +415,36 @@ void plotWave(float32_t * data_buffer, int num_samples, int live, int complex) {
 		ymin = GRAPH_YCENTRE - min*yscalefactor;
 		ymax = GRAPH_YCENTRE - max*yscalefactor;		
 		
-		for(i = 0; i < num_samples*step; i++) {
-			//Clear the previous bar before drawing the new bar on the screen
-			BSP_LCD_SetTextColor(BACKGROUND_COLOUR);	
-			BSP_LCD_DrawLine(xvalue, 0, xvalue, 272);
-			
-			//if the data is complex values, real values and imaginary values will
-			//display in different colour
-			if(complex) {
-				if(i % 2 == 0)
+		if(num_samples*step > GRAPH_WIDTH) {
+			//Real and imaginary values share the columns, draw them in one colour
+			drawEnvelope(&wave_envelope, GRAPH_YCENTRE, yscalefactor, GRAPH_COLOUR, 1);
+		} else {
+			for(i = 0; i < num_samples*step; i++) {
+				xvalue = FIRST_DATA_PIXEL + i*GRAPH_WIDTH/(num_samples*step);
+				
+				//Clear the previous bar before drawing the new bar on the screen
+				BSP_LCD_SetTextColor(BACKGROUND_COLOUR);	
+				drawBar(xvalue, 0, GRAPH_VER_END_PIXEL+1);
+				
+				//if the data is complex values, real values and imaginary values will
+				//display in different colour
+				if(complex) {
+					if(i % 2 == 0)
+						BSP_LCD_SetTextColor(GRAPH_COLOUR);		
+					else
+						BSP_LCD_SetTextColor(IMAGINARY_COLOUR);	
+				} else
 					BSP_LCD_SetTextColor(GRAPH_COLOUR);		
-				else
-					BSP_LCD_SetTextColor(IMAGINARY_COLOUR);	
-			} else
-				BSP_LCD_SetTextColor(GRAPH_COLOUR);		
-			
-			//Draw the bars
-			BSP_LCD_DrawLine(xvalue, GRAPH_YCENTRE, xvalue, GRAPH_YCENTRE - data_buffer[i]*yscalefactor);
-
-			xvalue += x_spacing;
+				
+				//Draw the bars
+				drawBar(xvalue, GRAPH_YCENTRE, GRAPH_YCENTRE - data_buffer[i]*yscalefactor);
+			}
 		}
 		
 		//debug_display(ymax,ymin,max,min,data_buffer[10],data_buffer[20]);
 		
-		//Draw the axes values and labels
-		drawAxes (GRAPH_YCENTRE, ymax, ymin, max, min, 0, num_samples, xvalue, WAVE);
+		//Draw the axes values and labels, the last data always ends at the right edge of the graph
+		drawAxes (GRAPH_YCENTRE, ymax, ymin, max, min, 0, num_samples, FIRST_DATA_PIXEL + GRAPH_WIDTH, WAVE);
 	}
 }
 
@@ -413,47 +456,54 @@ void plotWave(float32_t * data_buffer, int num_samples, int live, int complex) {
   */
 
 void plotWaveNoAutoScale(float32_t * data_buffer, int num_samples) {
-	unsigned i = 0;
+	int i = 0;
 	int xcoor = FIRST_DATA_PIXEL;
 	
 	int ymax = 20;
 	int ymin = GRAPH_VER_END_PIXEL;
-	float max, min = data_buffer[0];
+	float max = data_buffer[0], min = data_buffer[0];
 	
 	float yscalefactor = 270;
 	
-	float x_spacing = 1;
-
-	x_spacing = GRAPH_WIDTH / num_samples;	
-
-		
-	for(i = 0; i < num_samples; i++) {
-		//Clear the previous bar before drawing the new bar on the screen
-		BSP_LCD_SetTextColor(BACKGROUND_COLOUR);
-		BSP_LCD_DrawLine(xcoor, 0, xcoor, 272);
+	//More samples than columns, only the peak envelope of each column can be shown
+	if(num_samples > GRAPH_WIDTH) {
+		envelopeInit(&wave_envelope, num_samples);
+		envelopeAddF32(&wave_envelope, data_buffer, num_samples);
+		envelopeRange(&wave_envelope, &min, &max);
+		drawEnvelope(&wave_envelope, GRAPH_YCENTRE, 1/yscalefactor, GRAPH_COLOUR, 1);
+		
+		ymin = GRAPH_YCENTRE - min/yscalefactor;
+		ymax = GRAPH_YCENTRE - max/yscalefactor;
+	} else {
+		for(i = 0; i < num_samples; i++) {
+			xcoor = FIRST_DATA_PIXEL + i*GRAPH_WIDTH/num_samples;
 			
-		//Draw the bars
-		BSP_LCD_SetTextColor(GRAPH_COLOUR);		
-		BSP_LCD_DrawLine(xcoor, GRAPH_YCENTRE, xcoor, GRAPH_YCENTRE - data_buffer[i]/yscalefactor);
-		
-		// determine min and max values	to draw the y-axis
-		if(min >= data_buffer[i]){
-			ymin = GRAPH_YCENTRE - data_buffer[i]/yscalefactor;
-			min = data_buffer[i];
-		} 
-		if(max <= data_buffer[i]){
-			ymax = GRAPH_YCENTRE - data_buffer[i]/yscalefactor;
-			max = data_buffer[i];
+			//Clear the previous bar before drawing the new bar on the screen
+			BSP_LCD_SetTextColor(BACKGROUND_COLOUR);
+			drawBar(xcoor, 0, GRAPH_VER_END_PIXEL+1);
+				
+			//Draw the bars
+			BSP_LCD_SetTextColor(GRAPH_COLOUR);		
+			drawBar(xcoor, GRAPH_YCENTRE, GRAPH_YCENTRE - data_buffer[i]/yscalefactor);
+			
+			// determine min and max values	to draw the y-axis
+			if(min >= data_buffer[i]){
+				ymin = GRAPH_YCENTRE - data_buffer[i]/yscalefactor;
+				min = data_buffer[i];
+			} 
+			if(max <= data_buffer[i]){
+				ymax = GRAPH_YCENTRE - data_buffer[i]/yscalefactor;
+				max = data_buffer[i];
+			}
 		}
-		
-		//Safety measure to avoid the bars go outside the grid area
-		if(ymax < HEADER_HEIGHT) ymax = HEADER_HEIGHT;
-		if(ymin > GRAPH_VER_END_PIXEL) ymin = GRAPH_VER_END_PIXEL;
-		
-		xcoor += x_spacing;
 	}
+	
+	//Safety measure to avoid the bars go outside the grid area
+	if(ymax < HEADER_HEIGHT) ymax = HEADER_HEIGHT;
+	if(ymin > GRAPH_VER_END_PIXEL) ymin = GRAPH_VER_END_PIXEL;
+	
 	//debug_display(ymax,ymin,max,min,20,yscalefactor);
-	drawAxes (GRAPH_YCENTRE, ymax, ymin, max, min, 0, num_samples, xcoor, WAVE);
+	drawAxes (GRAPH_YCENTRE, ymax, ymin, max, min, 0, num_samples, FIRST_DATA_PIXEL + GRAPH_WIDTH, WAVE);
 
 }
 
@@ -467,21 +517,19 @@ void plotWaveNoAutoScale(float32_t * data_buffer, int num_samples) {
   */
 
 void plotSamples(int16_t * data_buffer, int num_samples, int num_plots) {
-	int16_t i;
+	int i;
 	int16_t xvalue;              // x in pixels
 	int16_t ymax = HEADER_HEIGHT;
 	int16_t ymin = GRAPH_VER_END_PIXEL;                  // max and min y values in pixels
 	float32_t max, min = data_buffer[0]; // max and min y values passed to function
 	float32_t biggestmag, yscalefactor;
 	int counter = 0;
-	float x_spacing = 1;
 
 	// initialise some variables
 	max = data_buffer[0];
 	min = data_buffer[0];
 	xvalue = FIRST_DATA_PIXEL;
 
-	x_spacing = GRAPH_WIDTH / num_plots;
 	// determine min and max values
 	for(i = 0; i < num_samples; i++) {		
 		if(min >= data_buffer[i])	min = data_buffer[i];
@@ -490,74 +538,94 @@ void plotSamples(int16_t * data_buffer, int num_samples, int num_plots) {
 
 	//Determine the largest value and limit the graph size by using yscalefactor
 	biggestmag = (max*max > min*min) ? max : -min;
+	if(biggestmag == 0) biggestmag = 1;
 		
 	yscalefactor = 100/(biggestmag); // 100 is +/- pixels from centre of screen
 	ymin = GRAPH_YCENTRE - min*yscalefactor;
 	ymax = GRAPH_YCENTRE - max*yscalefactor;		
 		
 	for(i = 0; i < num_plots; i++) {
+		xvalue = FIRST_DATA_PIXEL + i*GRAPH_WIDTH/num_plots;
+		
 		//Draw the bars
 		BSP_LCD_SetTextColor(GRAPH_COLOUR);		
-		BSP_LCD_DrawLine(xvalue, GRAPH_YCENTRE, xvalue, GRAPH_YCENTRE - data_buffer[counter]*yscalefactor);
+		drawBar(xvalue, GRAPH_YCENTRE, GRAPH_YCENTRE - data_buffer[counter]*yscalefactor);
 
 		if(counter >= num_samples - 1)
 			counter = 0;
 		else
 			counter ++;
-
-		xvalue += x_spacing;
 	}
 	//Draw the axes values and labels
-	drawAxes (GRAPH_YCENTRE, ymax, ymin, max, min, 0, num_plots, xvalue, WAVE);
+	drawAxes (GRAPH_YCENTRE, ymax, ymin, max, min, 0, num_plots, FIRST_DATA_PIXEL + GRAPH_WIDTH, WAVE);
+}
+
+/**
+  * @brief  Draw a buffer of any length, each column shows the peak envelope
+	*					of the samples that fall into it
+  * @param  data_buffer: a pointer that points to the data that need to plot
+  * @param  num_samples: number of the plotted data buffer
+  * @retval none
+  */
+
+void plotLongSamples(int16_t * data_buffer, uint32_t num_samples) {
+	int16_t ymax, ymin;                  // max and min y values in pixels
+	float32_t max, min;                  // max and min y values passed to function
+	float32_t biggestmag, yscalefactor;
+
+	envelopeInit(&wave_envelope, num_samples);
+	envelopeAddQ15(&wave_envelope, data_buffer, num_samples);
+	envelopeRange(&wave_envelope, &min, &max);
+
+	//Determine the largest value and limit the graph size by using yscalefactor
+	biggestmag = (max*max > min*min) ? max : -min;
+	if(biggestmag == 0) biggestmag = 1;
+
+	yscalefactor = 100/(biggestmag); // 100 is +/- pixels from centre of screen
+	ymin = GRAPH_YCENTRE - min*yscalefactor;
+	ymax = GRAPH_YCENTRE - max*yscalefactor;
+
+	drawEnvelope(&wave_envelope, GRAPH_YCENTRE, yscalefactor, GRAPH_COLOUR, 1);
+	drawAxes (GRAPH_YCENTRE, ymax, ymin, max, min, 0, num_samples, FIRST_DATA_PIXEL + GRAPH_WIDTH, WAVE);
 }
 
 /**
-  * @brief  Save data_sample to the temporary buffer
-  * @brief  Draw the graph from the temporary buffer only when enough data points have got
+  * @brief  Save data_sample to the peak envelope
+  * @brief  Draw the graph from the envelope only when enough data points have got
   * @param  data_sumple: a pointer that points to the data that need to plot
-  * @param  num_plots: how many data points needed to plot
+  * @param  num_plots: how many data points needed to plot, may be larger than the graph
   * @retval none
   */
 
 void plotSamplesIntr(int16_t data_sample, int num_plots) {
-	float x_spacing = 1;
-	unsigned int i = 0;
-
-	int xvalue = FIRST_DATA_PIXEL;
 	int ymax = 20;
 	int ymin = GRAPH_VER_END_PIXEL;
-	float max, min = data_sample;
+	float max, min;
 	float32_t biggestmag, yscalefactor;
 
 	if(stop == 0){
-		x_spacing = GRAPH_WIDTH / num_plots;
-		temp_buffer[temp_buffer_ptr] = data_sample;
-		temp_buffer_ptr++;
-		if(temp_buffer_ptr >= num_plots){
-			temp_buffer_ptr = 0;
+		//Start a new graph
+		if(intr_envelope.num_samples != (uint32_t)num_plots || envelopeComplete(&intr_envelope))
+			envelopeInit(&intr_envelope, num_plots);
+		
+		envelopeAddQ15(&intr_envelope, &data_sample, 1);
+		
+		if(envelopeComplete(&intr_envelope)){
 			stop = 1;
 
-			for(i = 0; i < num_plots; i++) {		
-				if(min >= temp_buffer[i]) min = temp_buffer[i];
-				if(max <= temp_buffer[i]) max = temp_buffer[i];
-			}
+			envelopeRange(&intr_envelope, &min, &max);
 
 			//Determine the largest value and limit the graph size by using yscalefactor
 			biggestmag = (max*max >= min*min) ? max : -min;
+			if(biggestmag == 0) biggestmag = 1;
 					
 			yscalefactor = 100/(biggestmag); // 100 is +/- pixels from centre of screen
 			ymin = GRAPH_YCENTRE - min*yscalefactor;
 			ymax = GRAPH_YCENTRE - max*yscalefactor;	
 			
-			BSP_LCD_SetTextColor(GRAPH_COLOUR);						
-			for(i = 0; i < num_plots; i++) {
-				//Draw the bars
-				BSP_LCD_SetTextColor(GRAPH_COLOUR);		
-				BSP_LCD_DrawLine(xvalue, GRAPH_YCENTRE, xvalue, GRAPH_YCENTRE - temp_buffer[i]*yscalefactor);		
-				xvalue += x_spacing;			
-			}
+			drawEnvelope(&intr_envelope, GRAPH_YCENTRE, yscalefactor, GRAPH_COLOUR, 0);
 			
-			drawAxes (GRAPH_YCENTRE, ymax, ymin, max, min, 0, num_plots, xvalue, WAVE);
+			drawAxes (GRAPH_YCENTRE, ymax, ymin, max, min, 0, num_plots, FIRST_DATA_PIXEL + GRAPH_WIDTH, WAVE);
 		}
 	}	
 }
@@ -579,20 +647,18 @@ void plotFFT(float32_t * data_buffer, int num_samples, int auto_scale){
 	float32_t max, min; // max and min y values passed to function
 	float32_t biggestmag, yscalefactor;
 
-	float x_spacing = 1;
+	//Draw only when the render scheduler has a frame due
+	if(renderBegin() == 0)
+		return;
 
-	x_spacing = GRAPH_WIDTH / num_samples;	
-	
 	// initialise some variables
 	max = data_buffer[0];
 	min = data_buffer[0];
 	xvalue = FIRST_DATA_PIXEL;
 	
-	//Refresh the screen in a specific rate, larger the number, slower refresh rate
-	if(refresh_counter > 40) {
+	//The bars are drawn over the old ones, rub them out every CLEAR_PERIOD_MS
+	if(HAL_GetTick() - clear_tick >= CLEAR_PERIOD_MS)
 		clearScreen();
-		refresh_counter = 0;
-	}
 				
 	// determine min and max values
 	for(i = 0; i < num_samples; i++) {		
@@ -629,22 +695,21 @@ void plotFFT(float32_t * data_buffer, int num_samples, int auto_scale){
 	
 	//Draw the bars, only draw half of the data buffer because the other half data is duplicated
 	for(i = 0; i < num_samples/2; i++) {		
-		BSP_LCD_DrawLine(xvalue, FFT_YCENTRE, xvalue, FFT_YCENTRE - data_buffer[i]*yscalefactor);
-		BSP_LCD_DrawLine(xvalue, FFT_YCENTRE, xvalue, FFT_YCENTRE - data_buffer[i]*yscalefactor);
-
-		xvalue += x_spacing*2;
+		xvalue = FIRST_DATA_PIXEL + 2*i*GRAPH_WIDTH/num_samples;
+		drawBar(xvalue, FFT_YCENTRE, FFT_YCENTRE - data_buffer[i]*yscalefactor);
 	}
+	xvalue = FIRST_DATA_PIXEL + GRAPH_WIDTH;
 	
 	//debug_display(ymax,ymin,max,min,biggestmag,yscalefactor);
 	//Draw the axes values and labels	
 	drawAxes (FFT_YCENTRE, ymax, ymin, max, min, 0, num_samples, xvalue, FFT);
-	refresh_counter ++;
-
+	renderEnd();
 }
 
 /**
   * @brief  Plot the FFT graph in decibel according to the data buffer
-  * @param  data_buffer: a pointer that points to the data that need to plot
+  * @param  data_buffer: a pointer that points to the magnitudes to plot, the
+  *											 buffer is not changed
   * @param  num_samples: number of the plotted data buffer
   * @param  live: LIVE = plot the graph live
 	*								STATIC = will only draw the graph once
@@ -662,67 +727,75 @@ void plotLogFFT(float32_t *(data_buffer), int num_samples, int live){
 	int16_t ycentre = FFT_YCENTRE;
 	int negative = 0;
 	int pixels_from_centre = 180;
-
-	float x_spacing = 1;
-
-	x_spacing = GRAPH_WIDTH / num_samples;	
+	float32_t db[LOGFFT_CHUNK];		// decibels of a run of bins
+	float32_t peak = 0, floor_db;
+	int j, count;
 	
-	//the data can't be zero as it has to be used in log calculation afterwards
-	if(data_buffer[0] == 0)
-		return;
-
 	if(stop == 0) {
+		//Zeros and bins far below the largest are drawn at a floor instead of -infinity
+		for(i = 0; i < num_samples; i++) {
+			if(peak < data_buffer[i]) peak = data_buffer[i];
+		}
+		if(peak <= 0)
+			return;
+		decibelFromMagnitude(&peak, &floor_db, 1, -1000.0f);
+		floor_db -= LOGFFT_RANGE_DB;
+
+		//Live graphs are drawn when the render scheduler has a frame due, over a cleared graph
 		if(live == 0){
 			stop = 1;
-		}	else
+		}	else {
 			stop = 0;
-		//Refresh the screen in a specific rate, larger the number, slower refresh rate	
-		if(refresh_counter > 100*refresh_counter_factor) {
+			if(renderBegin() == 0)
+				return;
 			clearScreen();
-			refresh_counter = 0;
 		}
 		
-		if(refresh_counter == 0){
+		// initialise some variables
+		decibelFromMagnitude(data_buffer, db, 1, floor_db);
+		max = db[0];
+		min = db[0];
+
+		for(i = 0; i < num_samples; i += LOGFFT_CHUNK) {
+			//Calculate the decibel of the data
+			count = (num_samples - i < LOGFFT_CHUNK) ? num_samples - i : LOGFFT_CHUNK;
+			decibelFromMagnitude(&data_buffer[i], db, count, floor_db);
 			
-			// initialise some variables
-			max = 20 * log10(data_buffer[0]);
-			min = 20 * log10(data_buffer[0]);
-
-			for(i = 0; i < num_samples; i++) {		
-				if(data_buffer[i] == 0)
-					return;
-				//Calculate the decibel of the data
-				data_buffer[i] = 20 * log10(data_buffer[i]);
-				
+			for(j = 0; j < count; j++) {
 				//Determine where is the y-axis centre
-				if(data_buffer[i] < 0) negative++;
+				if(db[j] < 0) negative++;
 				
-				if(min >= data_buffer[i])	min = data_buffer[i];
-				if(max <= data_buffer[i]) max = data_buffer[i];
-			}
-			if(max*max > min*min) biggestmag = max; else biggestmag = -min;
-			
-			if(negative != num_samples && negative != 0) {
-				pixels_from_centre = 100;
-				ycentre = GRAPH_YCENTRE;
-			} else if (negative == num_samples){
-				pixels_from_centre = 150;
-				ycentre = LOGFFT_YCENTRE;
-			} else {
-				pixels_from_centre = 200;
-				ycentre = FFT_YCENTRE;
+				if(min >= db[j])	min = db[j];
+				if(max <= db[j]) max = db[j];
 			}
+		}
+		if(max*max > min*min) biggestmag = max; else biggestmag = -min;
+		
+		if(negative != num_samples && negative != 0) {
+			pixels_from_centre = 100;
+			ycentre = GRAPH_YCENTRE;
+		} else if (negative == num_samples){
+			pixels_from_centre = 150;
+			ycentre = LOGFFT_YCENTRE;
+		} else {
+			pixels_from_centre = 200;
+			ycentre = FFT_YCENTRE;
+		}
 
-			yscalefactor = pixels_from_centre/(biggestmag); // pixels_from_centre is +/- pixels from centre of screen
-			ymin = ycentre - min*yscalefactor;
-			ymax = ycentre - max*yscalefactor;	
+		yscalefactor = pixels_from_centre/(biggestmag); // pixels_from_centre is +/- pixels from centre of screen
+		ymin = ycentre - min*yscalefactor;
+		ymax = ycentre - max*yscalefactor;	
 
-			dB_per_divs = (max - min)*48/abs(ymin - ymax);
-			
-			BSP_LCD_SetTextColor(GRAPH_COLOUR);	
+		dB_per_divs = (max - min)*48/abs(ymin - ymax);
+		
+		BSP_LCD_SetTextColor(GRAPH_COLOUR);	
+		
+		for(i = 0; i < num_samples/2; i += LOGFFT_CHUNK) {		
+			count = (num_samples/2 - i < LOGFFT_CHUNK) ? num_samples/2 - i : LOGFFT_CHUNK;
+			decibelFromMagnitude(&data_buffer[i], db, count, floor_db);
 			
-			for(i = 0; i < num_samples/2; i++) {		
-				yvalue = ycentre - data_buffer[i]*yscalefactor;
+			for(j = 0; j < count; j++) {
+				yvalue = ycentre - db[j]*yscalefactor;
 				
 				//Determine if the plotting out of the graph area, if yes plot it at the bottom of the graph
 				if(yvalue > GRAPH_VER_END_PIXEL){
@@ -731,43 +804,44 @@ void plotLogFFT(float32_t *(data_buffer), int num_samples, int live){
 					yvalue = HEADER_HEIGHT;
 				}
 				
-				BSP_LCD_DrawLine(xvalue, GRAPH_VER_END_PIXEL, xvalue, yvalue);
-
-				xvalue += x_spacing*2;
+				xvalue = FIRST_DATA_PIXEL + 2*(i + j)*GRAPH_WIDTH/num_samples;
+				drawBar(xvalue, GRAPH_VER_END_PIXEL, yvalue);
 			}
+		}
+		xvalue = FIRST_DATA_PIXEL + GRAPH_WIDTH;
 
-			//Determine the largest value and limit the graph size by using yscalefactor	
+		//Determine the largest value and limit the graph size by using yscalefactor	
 /*			if(max*max > min*min) biggestmag = max; else biggestmag = -min;
+		
+		//As the ycenter move up so less pixels from centre of screen
+		if(ycenter == LOGFFT_YCENTRE) yscalefactor = 40/(biggestmag); // 40 is +/- pixels from centre of screen
+		else yscalefactor = 200/(biggestmag); // 200 is +/- pixels from centre of screen
+		ymin = ycenter - min*yscalefactor;
+		ymax = ycenter - max*yscalefactor;	
+
+		dB_per_divs = (max - min)*48/abs(ymin - ymax);
+		BSP_LCD_SetTextColor(GRAPH_COLOUR);	
+		
+		for(i = 0; i < num_samples/2; i++) {		
+			yvalue = ycenter - data_buffer[i]*yscalefactor;
 			
-			//As the ycenter move up so less pixels from centre of screen
-			if(ycenter == LOGFFT_YCENTRE) yscalefactor = 40/(biggestmag); // 40 is +/- pixels from centre of screen
-			else yscalefactor = 200/(biggestmag); // 200 is +/- pixels from centre of screen
-			ymin = ycenter - min*yscalefactor;
-			ymax = ycenter - max*yscalefactor;	
-
-			dB_per_divs = (max - min)*48/abs(ymin - ymax);
-			BSP_LCD_SetTextColor(GRAPH_COLOUR);	
+			//Determine if the plotting out of the graph area, if yes plot it at the bottom of the graph
+			if(yvalue > GRAPH_VER_END_PIXEL){
+				yvalue = GRAPH_VER_END_PIXEL;
+			}	else if (yvalue < HEADER_HEIGHT) {
+				yvalue = HEADER_HEIGHT;
+			}
 			
-			for(i = 0; i < num_samples/2; i++) {		
-				yvalue = ycenter - data_buffer[i]*yscalefactor;
-				
-				//Determine if the plotting out of the graph area, if yes plot it at the bottom of the graph
-				if(yvalue > GRAPH_VER_END_PIXEL){
-					yvalue = GRAPH_VER_END_PIXEL;
-				}	else if (yvalue < HEADER_HEIGHT) {
-					yvalue = HEADER_HEIGHT;
-				}
-				
-				BSP_LCD_DrawLine(xvalue, GRAPH_VER_END_PIXEL, xvalue, yvalue);
+			drawBar(xvalue, GRAPH_VER_END_PIXEL, yvalue);
 
-				xvalue += x_spacing*2;
-			}*/
+			xvalue += x_spacing*2;
+		}*/
 
-			//debug_display(ymax, ymin, max, min, ycentre, yscalefactor);	
-			drawAxes (ycentre, ymax, ymin, max, min, dB_per_divs, num_samples, xvalue, LOGFFT);
-			negative = 0;
-		}
-		refresh_counter ++;
+		//debug_display(ymax, ymin, max, min, ycentre, yscalefactor);	
+		drawAxes (ycentre, ymax, ymin, max, min, dB_per_divs, num_samples, xvalue, LOGFFT);
+		negative = 0;
+		if(live != 0)
+			renderEnd();
 	}
 }
 
@@ -787,15 +861,18 @@ void plotLMS(float32_t * data_buffer, int num_samples, int live) {
 	float32_t max, min;                  // max and min y values passed to function
 	float32_t biggestmag, yscalefactor;
 
-	float x_spacing = 1;
-
-	x_spacing = GRAPH_WIDTH / num_samples;	
-	
 	if(stop == 0){	
+		//Live graphs are drawn when the render scheduler has a frame due
 		if(live == 0)
 			stop = 1;
-		else
+		else {
 			stop = 0;
+			if(renderBegin() == 0)
+				return;
+			//The bars are drawn over the old ones, rub them out every CLEAR_PERIOD_MS
+			if(HAL_GetTick() - clear_tick >= CLEAR_PERIOD_MS)
+				clearScreen();
+		}
 		
 		// initialise some variables
 		max = data_buffer[0];
@@ -828,19 +905,15 @@ void plotLMS(float32_t * data_buffer, int num_samples, int live) {
 				yvalue = HEADER_HEIGHT;
 			}
 			
-			BSP_LCD_DrawLine(xvalue, GRAPH_YCENTRE, xvalue, yvalue);
-			xvalue += x_spacing;
+			xvalue = FIRST_DATA_PIXEL + i*GRAPH_WIDTH/num_samples;
+			drawBar(xvalue, GRAPH_YCENTRE, yvalue);
 		}
+		xvalue = FIRST_DATA_PIXEL + GRAPH_WIDTH;
 		
 		drawAxes (GRAPH_YCENTRE, ymax, ymin, max, min, 0, num_samples, xvalue, LMS);
 
-		//Refresh the screen in a specific rate, larger the number, slower refresh rate	
-		if(refresh_counter > 100) {
-			clearScreen();
-			refresh_counter = 0;
-		} 
-
-		refresh_counter ++;
+		if(live != 0)
+			renderEnd();
 	}
 }
 
@@ -866,9 +939,10 @@ int checkButtonFlag() {
 
 	//If user press the button, the whole screen will be cleared and change the state
 	if(CheckForUserInput() == 1) {
-		refresh_counter = 0;
+		clear_tick = HAL_GetTick();
 		stop = 0;
 		BSP_LCD_Clear(BACKGROUND_COLOUR);
+		invalidateLabels();
 		button_flag++;
 	} 
 
@@ -896,7 +970,7 @@ int checkButtonFlag() {
   */
 
 void stm32f7_LCD_init(int16_t sample_frequency, char *name, int graph){	
-	BSP_PB_Init(BUTTON_KEY, BUTTON_MODE_GPIO); // configure the  blue user pushbutton in GPIO mode
+	inputInit(); // the blue user pushbutton and the touch screen interrupt
 	BSP_LED_Init(LED1);   // initialise LED on GPIO pin P   (also accessible on arduino header)
 	BSP_SDRAM_Init();
 	init_LCD(sample_frequency, name, 0, graph);
@@ -917,7 +991,9 @@ void proceed_statement(){
 	
 	BSP_LCD_SetFont(&Font12);
 	
-	BSP_LCD_DisplayStringAt(100, 10, (uint8_t * ) "Push button to next screen", LEFT_MODE);
+	drawString(LTDC_ACTIVE_LAYER, 100, 10, "Push button to next screen", LEFT_MODE);
 	
-	while(CheckForUserInput() != 1){}	
+	while(CheckForUserInput() != 1){
+		__WFI();
+	}
 }
\ No newline at end of file
@@ -0,0 +1,530 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_glyph.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides fast text drawing for the graph labels.
+  *					 The Font12/16/24 bitmaps are expanded once into an A8 atlas in
+  *					 SDRAM and every glyph is blended into the frame buffer with DMA2D,
+  *					 instead of one BSP_LCD_DrawPixel() call per font bit.
+  *					 Labels are formatted without printf and only redrawn when the
+  *					 text, font or colours at a screen position change.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_glyph.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+	sFONT *font;
+	uint32_t atlas;	//Address of the first glyph (' ') in the atlas
+	uint8_t ready;
+} GlyphFont;
+
+typedef struct
+{
+	uint8_t valid;
+	uint16_t x, y;
+	Text_AlignModeTypdef mode;
+	sFONT *font;
+	uint32_t text_colour, back_colour;
+	uint16_t column, width;	//Screen area covered by the last drawing
+	char text[LABEL_MAX_LEN + 1];
+} LabelEntry;
+
+/* Private variables ---------------------------------------------------------*/
+extern LTDC_HandleTypeDef hLtdcHandler;
+
+static DMA2D_HandleTypeDef hDma2dGlyph;
+
+static GlyphFont glyph_fonts[] = {
+	{&Font12, 0, 0},
+	{&Font16, 0, 0},
+	{&Font24, 0, 0},
+};
+#define NUM_GLYPH_FONTS (sizeof(glyph_fonts) / sizeof(glyph_fonts[0]))
+
+static LabelEntry label_cache[LABEL_CACHE_SIZE];
+static uint8_t label_next = 0;
+static uint32_t label_layer = LTDC_ACTIVE_LAYER;
+
+static const int32_t pow10_table[] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Find the atlas entry of a font
+  * @param  font: font to look for
+  * @retval atlas entry, NULL if the font was not pre-rendered
+  */
+
+static GlyphFont *findFont(sFONT *font) {
+	unsigned i;
+
+	for(i = 0; i < NUM_GLYPH_FONTS; i++) {
+		if(glyph_fonts[i].font == font && glyph_fonts[i].ready)
+			return &glyph_fonts[i];
+	}
+	return NULL;
+}
+
+/**
+  * @brief  Work out the first column of a string the same way as BSP_LCD_DisplayStringAt()
+  * @param  Xpos: x position passed by the caller
+  * @param  size: number of characters
+  * @param  width: font width
+  * @param  Mode: LEFT_MODE/ CENTER_MODE/ RIGHT_MODE
+  * @retval first pixel column of the string
+  */
+
+static uint16_t stringColumn(uint16_t Xpos, uint32_t size, uint16_t width, Text_AlignModeTypdef Mode) {
+	uint32_t xsize = BSP_LCD_GetXSize() / width;
+	uint16_t ref_column;
+
+	switch(Mode) {
+		case CENTER_MODE:
+			ref_column = Xpos + ((xsize - size) * width) / 2;
+			break;
+		case RIGHT_MODE:
+			ref_column = - Xpos + ((xsize - size) * width);
+			break;
+		case LEFT_MODE:
+		default:
+			ref_column = Xpos;
+			break;
+	}
+
+	//Same safety measure as the BSP, keep the string on the screen
+	if((ref_column < 1) || (ref_column >= 0x8000))
+		ref_column = 1;
+
+	return ref_column;
+}
+
+/**
+  * @brief  Get the DMA2D output colour mode of a LTDC layer
+  * @param  layer: LTDC layer index
+  * @param  bytes_per_pixel: returns 2 for RGB565 or 4 for ARGB8888
+  * @retval DMA2D output colour mode
+  */
+
+static uint32_t layerColourMode(uint32_t layer, uint32_t *bytes_per_pixel) {
+	if(hLtdcHandler.LayerCfg[layer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) {
+		*bytes_per_pixel = 2;
+		return DMA2D_OUTPUT_RGB565;
+	}
+	*bytes_per_pixel = 4;
+	return DMA2D_OUTPUT_ARGB8888;
+}
+
+/**
+  * @brief  Fill a rectangle of a layer with DMA2D register to memory mode
+  * @param  layer: LTDC layer index
+  * @param  x, y: top-left corner
+  * @param  width, height: rectangle size in pixels
+  * @param  colour: ARGB8888 fill colour
+  * @retval none
+  */
+
+static void fillArea(uint32_t layer, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint32_t colour) {
+	uint32_t bpp;
+	uint32_t colour_mode = layerColourMode(layer, &bpp);
+	uint32_t address = hLtdcHandler.LayerCfg[layer].FBStartAdress + bpp * (BSP_LCD_GetXSize() * y + x);
+
+	if(y >= BSP_LCD_GetYSize())
+		return;
+	if(y + height > BSP_LCD_GetYSize()) height = BSP_LCD_GetYSize() - y;
+	if(width == 0 || height == 0)
+		return;
+
+	hDma2dGlyph.Instance = DMA2D;
+	hDma2dGlyph.Init.Mode = DMA2D_R2M;
+	hDma2dGlyph.Init.ColorMode = colour_mode;
+	hDma2dGlyph.Init.OutputOffset = BSP_LCD_GetXSize() - width;
+
+	if(HAL_DMA2D_Init(&hDma2dGlyph) == HAL_OK) {
+		if(HAL_DMA2D_Start(&hDma2dGlyph, colour, address, width, height) == HAL_OK)
+			HAL_DMA2D_PollForTransfer(&hDma2dGlyph, 10);
+	}
+}
+
+/**
+  * @brief  Blend glyphs from the atlas into a layer. The text box must already
+  *					hold the background colour.
+  * @param  layer: LTDC layer index
+  * @param  glyphs: atlas entry of the font
+  * @param  column, Ypos: top-left corner of the first glyph
+  * @param  text: characters to draw
+  * @param  count: number of characters to draw
+  * @param  height: number of glyph rows to draw
+  * @param  colour: ARGB8888 text colour
+  * @retval none
+  */
+
+static void blendGlyphs(uint32_t layer, GlyphFont *glyphs, uint16_t column, uint16_t Ypos,
+												const char *text, uint32_t count, uint16_t height, uint32_t colour) {
+	uint32_t bpp, i;
+	uint16_t width = glyphs->font->Width;
+	uint32_t glyph_size = width * glyphs->font->Height;
+	uint32_t colour_mode = layerColourMode(layer, &bpp);
+	uint32_t address = hLtdcHandler.LayerCfg[layer].FBStartAdress + bpp * (BSP_LCD_GetXSize() * Ypos + column);
+	uint8_t c;
+
+	hDma2dGlyph.Instance = DMA2D;
+	hDma2dGlyph.Init.Mode = DMA2D_M2M_BLEND;
+	hDma2dGlyph.Init.ColorMode = colour_mode;
+	hDma2dGlyph.Init.OutputOffset = BSP_LCD_GetXSize() - width;
+
+	//Foreground: A8 glyph coverage, the colour comes from the layer register
+	hDma2dGlyph.LayerCfg[1].InputColorMode = DMA2D_INPUT_A8;
+	hDma2dGlyph.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+	hDma2dGlyph.LayerCfg[1].InputAlpha = colour;
+	hDma2dGlyph.LayerCfg[1].InputOffset = 0;
+
+	//Background: the frame buffer itself (input colour modes share the output encoding)
+	hDma2dGlyph.LayerCfg[0].InputColorMode = colour_mode;
+	hDma2dGlyph.LayerCfg[0].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+	hDma2dGlyph.LayerCfg[0].InputAlpha = 0xFF;
+	hDma2dGlyph.LayerCfg[0].InputOffset = BSP_LCD_GetXSize() - width;
+
+	if(HAL_DMA2D_Init(&hDma2dGlyph) != HAL_OK)
+		return;
+	if(HAL_DMA2D_ConfigLayer(&hDma2dGlyph, 0) != HAL_OK || HAL_DMA2D_ConfigLayer(&hDma2dGlyph, 1) != HAL_OK)
+		return;
+
+	for(i = 0; i < count; i++) {
+		c = (uint8_t)text[i];
+		//Spaces are already drawn by the background fill
+		if(c != ' ' && c >= GLYPH_FIRST_CHAR && c <= GLYPH_LAST_CHAR) {
+			if(HAL_DMA2D_BlendingStart(&hDma2dGlyph, glyphs->atlas + (c - GLYPH_FIRST_CHAR) * glyph_size,
+																 address, address, width, height) == HAL_OK)
+				HAL_DMA2D_PollForTransfer(&hDma2dGlyph, 10);
+		}
+		address += bpp * width;
+	}
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  Expand the Font12, Font16 and Font24 bitmaps into the A8 glyph atlas.
+  *					SDRAM must be initialised before calling this function.
+  * @param  none
+  * @retval none
+  */
+
+void initGlyphAtlas(void) {
+	uint32_t address = GLYPH_ATLAS_BUFFER;
+	uint32_t line;
+	unsigned f, c, row, j;
+	uint16_t width, height, bytes_per_row, offset;
+	const uint8_t *pchar;
+	uint8_t *dst;
+
+	for(f = 0; f < NUM_GLYPH_FONTS; f++) {
+		width = glyph_fonts[f].font->Width;
+		height = glyph_fonts[f].font->Height;
+		bytes_per_row = (width + 7) / 8;
+		offset = 8 * bytes_per_row - width;
+
+		glyph_fonts[f].atlas = address;
+		pchar = glyph_fonts[f].font->table;
+		dst = (uint8_t *)address;
+
+		for(c = 0; c < GLYPH_NUM_CHARS; c++) {
+			for(row = 0; row < height; row++) {
+				//Same bit layout as DrawChar() in the BSP
+				switch(bytes_per_row) {
+					case 1:
+						line = pchar[0];
+						break;
+					case 2:
+						line = (pchar[0] << 8) | pchar[1];
+						break;
+					default:
+						line = (pchar[0] << 16) | (pchar[1] << 8) | pchar[2];
+						break;
+				}
+				for(j = 0; j < width; j++)
+					*dst++ = (line & (1 << (width - j + offset - 1))) ? 0xFF : 0x00;
+				pchar += bytes_per_row;
+			}
+		}
+
+		glyph_fonts[f].ready = 1;
+		address += GLYPH_NUM_CHARS * width * height;
+	}
+
+	//DMA2D reads the atlas straight from SDRAM
+	SCB_CleanDCache_by_Addr((uint32_t *)GLYPH_ATLAS_BUFFER, address - GLYPH_ATLAS_BUFFER);
+
+	invalidateLabels();
+}
+
+/**
+  * @brief  Display a string with the current BSP font and colours. Drop-in
+  *					replacement for BSP_LCD_DisplayStringAt(); fonts that are not in
+  *					the atlas are passed on to the BSP.
+  * @param  layer: LTDC layer to draw on, must be the selected BSP layer
+  * @param  Xpos: x position in pixel
+  * @param  Ypos: y position in pixel
+  * @param  text: string to display
+  * @param  Mode: LEFT_MODE/ CENTER_MODE/ RIGHT_MODE
+  * @retval none
+  */
+
+void drawString(uint32_t layer, uint16_t Xpos, uint16_t Ypos, const char *text, Text_AlignModeTypdef Mode) {
+	sFONT *font = BSP_LCD_GetFont();
+	GlyphFont *glyphs = findFont(font);
+	uint32_t size = strlen(text);
+	uint32_t count, height;
+	uint16_t column;
+
+	if(glyphs == NULL) {
+		BSP_LCD_DisplayStringAt(Xpos, Ypos, (uint8_t *)text, Mode);
+		return;
+	}
+	if(Ypos >= BSP_LCD_GetYSize())
+		return;
+
+	column = stringColumn(Xpos, size, font->Width, Mode);
+	if(column >= BSP_LCD_GetXSize())
+		return;
+
+	//Clip the string to the screen instead of wrapping to the next line
+	count = (BSP_LCD_GetXSize() - column) / font->Width;
+	if(count > size) count = size;
+	height = font->Height;
+	if(Ypos + height > BSP_LCD_GetYSize()) height = BSP_LCD_GetYSize() - Ypos;
+
+	fillArea(layer, column, Ypos, count * font->Width, height, BSP_LCD_GetBackColor());
+	blendGlyphs(layer, glyphs, column, Ypos, text, count, height, BSP_LCD_GetTextColor());
+}
+
+/**
+  * @brief  Display a label on the label layer, skip the drawing if the same
+  *					text is already on the screen at this position
+  * @param  Xpos: x position in pixel
+  * @param  Ypos: y position in pixel
+  * @param  text: string to display, truncated to LABEL_MAX_LEN characters
+  * @param  Mode: LEFT_MODE/ CENTER_MODE/ RIGHT_MODE
+  * @retval none
+  */
+
+void drawLabel(uint16_t Xpos, uint16_t Ypos, const char *text, Text_AlignModeTypdef Mode) {
+	sFONT *font = BSP_LCD_GetFont();
+	uint32_t text_colour = BSP_LCD_GetTextColor();
+	uint32_t back_colour = BSP_LCD_GetBackColor();
+	LabelEntry *entry = NULL;
+	uint32_t size = strlen(text);
+	uint16_t column;
+	unsigned i;
+
+	if(size > LABEL_MAX_LEN) size = LABEL_MAX_LEN;
+
+	for(i = 0; i < LABEL_CACHE_SIZE; i++) {
+		if(label_cache[i].valid && label_cache[i].x == Xpos && label_cache[i].y == Ypos && label_cache[i].mode == Mode) {
+			entry = &label_cache[i];
+			break;
+		}
+	}
+
+	if(entry != NULL) {
+		if(entry->font == font && entry->text_colour == text_colour && entry->back_colour == back_colour &&
+			 strncmp(entry->text, text, size) == 0 && entry->text[size] == '\0')
+			return;
+
+		//Rub out the old label, it may be wider or in another font
+		if(entry->width != 0)
+			fillArea(label_layer, entry->column, Ypos, entry->width, entry->font->Height, back_colour);
+	} else {
+		entry = &label_cache[label_next];
+		label_next = (label_next + 1) % LABEL_CACHE_SIZE;
+	}
+
+	memcpy(entry->text, text, size);
+	entry->text[size] = '\0';
+	entry->valid = 1;
+	entry->x = Xpos;
+	entry->y = Ypos;
+	entry->mode = Mode;
+	entry->font = font;
+	entry->text_colour = text_colour;
+	entry->back_colour = back_colour;
+
+	column = stringColumn(Xpos, size, font->Width, Mode);
+	entry->column = column;
+	entry->width = 0;
+	if(column < BSP_LCD_GetXSize()) {
+		entry->width = size * font->Width;
+		if(column + entry->width > BSP_LCD_GetXSize())
+			entry->width = (BSP_LCD_GetXSize() - column) / font->Width * font->Width;
+	}
+
+	drawString(label_layer, Xpos, Ypos, entry->text, Mode);
+}
+
+/**
+  * @brief  Forget every cached label. Must be called whenever the graph layer
+  *					is cleared behind the labels.
+  * @param  none
+  * @retval none
+  */
+
+void invalidateLabels(void) {
+	unsigned i;
+
+	for(i = 0; i < LABEL_CACHE_SIZE; i++)
+		label_cache[i].valid = 0;
+	label_next = 0;
+}
+
+/**
+  * @brief  Forget the cached labels that overlap a rectangle. Must be called
+  *					whenever that part of the layer is cleared behind the labels.
+  * @param  x, y: top-left corner
+  * @param  width, height: rectangle size in pixels
+  * @retval none
+  */
+
+void forgetLabels(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+	unsigned i;
+	LabelEntry *entry;
+
+	for(i = 0; i < LABEL_CACHE_SIZE; i++) {
+		entry = &label_cache[i];
+		if(entry->valid && entry->column < x + width && entry->column + entry->width > x &&
+			 entry->y < y + height && entry->y + entry->font->Height > y)
+			entry->valid = 0;
+	}
+}
+
+/**
+  * @brief  Rub out every cached label with its background colour and forget them
+  * @param  none
+  * @retval none
+  */
+
+void clearLabels(void) {
+	unsigned i;
+
+	for(i = 0; i < LABEL_CACHE_SIZE; i++) {
+		if(label_cache[i].valid && label_cache[i].width != 0)
+			fillArea(label_layer, label_cache[i].column, label_cache[i].y, label_cache[i].width,
+							 label_cache[i].font->Height, label_cache[i].back_colour);
+	}
+	invalidateLabels();
+}
+
+/**
+  * @brief  Choose the layer drawLabel() draws on, LTDC_ACTIVE_LAYER by default.
+  *					The layer must be the selected BSP layer while labels are drawn.
+  * @param  layer: LTDC layer
+  * @retval none
+  */
+
+void setLabelLayer(uint32_t layer) {
+	label_layer = layer;
+	invalidateLabels();
+}
+
+/**
+  * @brief  Format an integer in decimal, replacement for sprintf("%d")
+  * @param  buf: output buffer, at least 12 characters
+  * @param  value: value to format
+  * @retval number of characters written, not counting the terminator
+  */
+
+int formatInt(char *buf, int32_t value) {
+	char digits[10];
+	uint32_t magnitude;
+	int n = 0, len = 0;
+
+	if(value < 0) {
+		buf[len++] = '-';
+		magnitude = 0u - (uint32_t)value;
+	} else
+		magnitude = (uint32_t)value;
+
+	do {
+		digits[n++] = '0' + magnitude % 10;
+		magnitude /= 10;
+	} while(magnitude != 0);
+
+	while(n > 0)
+		buf[len++] = digits[--n];
+	buf[len] = '\0';
+
+	return len;
+}
+
+/**
+  * @brief  Format a fixed-point number, e.g. value = -1250 and decimals = 3 gives "-1.250"
+  * @param  buf: output buffer, at least 13 characters
+  * @param  value: number scaled by 10^decimals
+  * @param  decimals: number of fractional digits, 0 to 6
+  * @retval number of characters written, not counting the terminator
+  */
+
+int formatFixed(char *buf, int32_t value, uint8_t decimals) {
+	uint32_t magnitude, scale, frac;
+	int len = 0;
+
+	if(decimals > 6) decimals = 6;
+	if(decimals == 0)
+		return formatInt(buf, value);
+
+	scale = pow10_table[decimals];
+	if(value < 0) {
+		buf[len++] = '-';
+		magnitude = 0u - (uint32_t)value;
+	} else
+		magnitude = (uint32_t)value;
+
+	len += formatInt(buf + len, (int32_t)(magnitude / scale));
+	buf[len++] = '.';
+
+	//Fractional digits with leading zeros
+	frac = magnitude % scale;
+	while(decimals > 0) {
+		scale /= 10;
+		buf[len++] = '0' + frac / scale;
+		frac %= scale;
+		decimals--;
+	}
+	buf[len] = '\0';
+
+	return len;
+}
+
+/**
+  * @brief  Format a float with a fixed number of decimals, replacement for sprintf("%.3f")
+  *					for the axis labels. Values are rounded to the nearest last digit and
+  *					saturate at +/-2^31 / 10^decimals.
+  * @param  buf: output buffer, at least 13 characters
+  * @param  value: value to format
+  * @param  decimals: number of fractional digits, 0 to 6
+  * @retval number of characters written, not counting the terminator
+  */
+
+int formatFloat(char *buf, float value, uint8_t decimals) {
+	float scaled;
+
+	if(decimals > 6) decimals = 6;
+	if(value != value) {
+		strcpy(buf, "nan");
+		return 3;
+	}
+	scaled = value * (float)pow10_table[decimals];
+	scaled += (scaled < 0) ? -0.5f : 0.5f;
+
+	if(scaled >= 2147483647.0f)
+		return formatFixed(buf, 2147483647, decimals);
+	if(scaled <= -2147483647.0f)
+		return formatFixed(buf, -2147483647, decimals);
+
+	return formatFixed(buf, (int32_t)scaled, decimals);
+}
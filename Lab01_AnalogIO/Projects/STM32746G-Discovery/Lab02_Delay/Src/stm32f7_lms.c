@@ -0,0 +1,464 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_lms.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides adaptive FIR filters for the adaptive filter
+  *					 lab. The normalised LMS filters run in time, the history is
+  *					 written twice as in stm32f7_fir.c so the taps run over
+  *					 contiguous memory. The frequency domain filter is the multi
+  *					 delay block filter: the taps are cut into blocks as in
+  *					 stm32f7_conv.c, each block of input is filtered and the
+  *					 weights updated with FFTs of twice the block, and the step
+  *					 of every bin is normalised by the power of the input in it.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_lms.h"
+#include <string.h>
+
+#define LMS_CHUNK             64				//Q15 samples converted at a time
+
+/**
+  * @brief  Set up an adaptive filter, the weights start at zero
+  * @param  lms: filter
+  * @param  method: LMS_SAMPLE, LMS_BLOCK or LMS_FREQUENCY
+  * @param  num_taps: 1 to LMS_MAX_TAPS
+  * @param  block: samples per update, ignored by LMS_SAMPLE, a power of 2
+  *					from LMS_MIN_BLOCK to LMS_MAX_BLOCK for LMS_FREQUENCY, also
+  *					its latency
+  * @param  mu: step, see lmsSetStep()
+  * @param  memory: LMS_MEMORY(num_taps, block) floats
+  * @retval HAL_OK, HAL_ERROR for a bad method, size or step
+  */
+
+HAL_StatusTypeDef lmsInit(Lms *lms, uint8_t method, uint32_t num_taps, uint32_t block, float32_t mu, float32_t *memory) {
+	if(method > LMS_FREQUENCY || num_taps < 1 || num_taps > LMS_MAX_TAPS || mu <= 0 || mu >= 2)
+		return HAL_ERROR;
+	if(method == LMS_SAMPLE)
+		block = 1;
+	if(block < 1 || (method == LMS_FREQUENCY && (block < LMS_MIN_BLOCK || block > LMS_MAX_BLOCK || (block & (block - 1)) != 0)))
+		return HAL_ERROR;
+
+	lms->method = method;
+	lms->num_taps = num_taps;
+	lms->block = block;
+	lms->mu = mu;
+	lms->weights = memory;
+	if(method == LMS_FREQUENCY) {
+		fftInit(&lms->fft, 2*block);
+		lms->fft_len = 2*block;
+		lms->partitions = LMS_PARTITIONS(block, num_taps);
+		lms->delta = LMS_REGULARISATION*lms->fft_len;
+		lms->response = lms->weights + lms->partitions*block;
+		lms->delay_line = lms->response + lms->partitions*lms->fft_len;
+		lms->work = lms->delay_line + lms->partitions*lms->fft_len;
+		lms->accumulator = lms->work + lms->fft_len;
+		lms->frame = lms->accumulator + lms->fft_len;
+		lms->desired = lms->frame + lms->fft_len;
+		lms->output = lms->desired + block;
+		lms->error = lms->output + block;
+		lms->bin_power = lms->error + block;
+	} else {
+		lms->fft_len = 0;
+		lms->partitions = 1;
+		lms->delta = LMS_REGULARISATION*num_taps;
+		lms->history = lms->weights + num_taps;
+		lms->gradient = lms->history + 2*num_taps;
+	}
+
+	lmsReset(lms);
+	return HAL_OK;
+}
+
+/**
+  * @brief  Clear the weights and the history
+  * @param  lms: filter
+  * @retval none
+  */
+
+void lmsReset(Lms *lms) {
+	uint32_t size;
+
+	if(lms->method == LMS_FREQUENCY) {
+		//Weights, spectra, buffers and bin powers follow each other
+		size = 5*lms->partitions*lms->block + 10*lms->block + 1;
+		memset(lms->weights, 0, size*sizeof(float32_t));
+	} else {
+		memset(lms->weights, 0, 4*lms->num_taps*sizeof(float32_t));
+	}
+	lms->index = 0;
+	lms->count = 0;
+	lms->updates = 0;
+	lms->power = 0;
+}
+
+/**
+  * @brief  Change the step, e.g. from the main loop while audio runs
+  * @param  lms: filter
+  * @param  mu: above 0 and below 2, larger converges faster and leaves more
+  *					misadjustment
+  * @retval HAL_OK, HAL_ERROR for a step out of range
+  */
+
+HAL_StatusTypeDef lmsSetStep(Lms *lms, float32_t mu) {
+	if(mu <= 0 || mu >= 2)
+		return HAL_ERROR;
+	lms->mu = mu;
+	return HAL_OK;
+}
+
+/**
+  * @brief  Sum of products of two vectors, four at a time to keep the
+  *					floating point pipeline busy
+  * @param  a: vector
+  * @param  b: vector
+  * @param  n: length
+  * @retval sum
+  */
+
+static float32_t dot(const float32_t *a, const float32_t *b, uint32_t n) {
+	float32_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+	uint32_t k;
+
+	for(k = 0; k + 4 <= n; k += 4) {
+		acc0 += a[k]*b[k];
+		acc1 += a[k + 1]*b[k + 1];
+		acc2 += a[k + 2]*b[k + 2];
+		acc3 += a[k + 3]*b[k + 3];
+	}
+	for(; k < n; k++)
+		acc0 += a[k]*b[k];
+	return (acc0 + acc1) + (acc2 + acc3);
+}
+
+/**
+  * @brief  a += g*b
+  * @param  a: vector
+  * @param  g: gain
+  * @param  b: vector
+  * @param  n: length
+  * @retval none
+  */
+
+static void scaleAdd(float32_t *a, float32_t g, const float32_t *b, uint32_t n) {
+	uint32_t k;
+
+	for(k = 0; k + 4 <= n; k += 4) {
+		a[k] += g*b[k];
+		a[k + 1] += g*b[k + 1];
+		a[k + 2] += g*b[k + 2];
+		a[k + 3] += g*b[k + 3];
+	}
+	for(; k < n; k++)
+		a[k] += g*b[k];
+}
+
+/**
+  * @brief  Filter and adapt in time, LMS_SAMPLE and LMS_BLOCK
+  * @param  lms: filter
+  * @param  x: input samples
+  * @param  d: desired samples
+  * @param  y: output samples or NULL
+  * @param  e: error samples or NULL
+  * @param  n: number of samples
+  * @param  stride: distance between samples
+  * @retval 1 when the weights changed
+  */
+
+static int lmsTime(Lms *lms, const float32_t *x, const float32_t *d, float32_t *y, float32_t *e, uint32_t n, uint32_t stride) {
+	uint32_t taps = lms->num_taps, index = lms->index, i;
+	float32_t *history = lms->history, *window;
+	float32_t power = lms->power, mu = lms->mu, xn, old, yn, en;
+	int updated = 0;
+
+	for(i = 0; i < n; i++) {
+		xn = x[i*stride];
+		index = (index == 0) ? taps - 1 : index - 1;
+		old = history[index];
+		history[index] = xn;
+		history[index + taps] = xn;
+		window = &history[index];
+		//A running sum of the power, recomputed once round the history so the
+		//rounding errors don't build up
+		if(index == 0)
+			power = dot(window, window, taps);
+		else
+			power += xn*xn - old*old;
+
+		yn = dot(lms->weights, window, taps);
+		en = d[i*stride] - yn;
+		if(y != NULL) y[i*stride] = yn;
+		if(e != NULL) e[i*stride] = en;
+
+		if(lms->method == LMS_SAMPLE) {
+			scaleAdd(lms->weights, mu*en/(power + lms->delta), window, taps);
+			lms->updates++;
+			updated = 1;
+		} else {
+			scaleAdd(lms->gradient, en, window, taps);
+			if(++lms->count == lms->block) {
+				scaleAdd(lms->weights, mu/(power + lms->delta), lms->gradient, taps);
+				memset(lms->gradient, 0, taps*sizeof(float32_t));
+				lms->count = 0;
+				lms->updates++;
+				updated = 1;
+			}
+		}
+	}
+	lms->index = index;
+	lms->power = power;
+	return updated;
+}
+
+/**
+  * @brief  Multiply accumulate two spectra in the fftProcess() packing, the
+  *					first one conjugated when conjugate is 1
+  * @param  acc: accumulated spectrum
+  * @param  x: spectrum
+  * @param  h: spectrum
+  * @param  len: fft_len
+  * @param  conjugate: 1 to use the conjugate of x
+  * @retval none
+  */
+
+static void spectrumMac(float32_t *acc, const float32_t *x, const float32_t *h, uint32_t len, uint8_t conjugate) {
+	uint32_t k;
+	float32_t xr, xi, hr, hi;
+
+	acc[0] += x[0]*h[0];
+	acc[1] += x[1]*h[1];
+	for(k = 2; k < len; k += 2) {
+		xr = x[k];
+		xi = conjugate ? -x[k + 1] : x[k + 1];
+		hr = h[k];
+		hi = h[k + 1];
+		acc[k] += xr*hr - xi*hi;
+		acc[k + 1] += xr*hi + xi*hr;
+	}
+}
+
+/**
+  * @brief  One block of the frequency domain filter, the frame holds the
+  *					input and desired holds the desired samples
+  * @param  lms: filter
+  * @retval none
+  */
+
+static void lmsFrequencyBlock(Lms *lms) {
+	uint32_t block = lms->block, len = lms->fft_len, slot, partition, k;
+	float32_t *work = lms->work, *acc = lms->accumulator, *power = lms->bin_power;
+	float32_t *x, *w, re, im, step, a;
+
+	//Spectrum of the last two input blocks into the delay line
+	lms->index = (lms->index == 0) ? lms->partitions - 1 : lms->index - 1;
+	x = &lms->delay_line[lms->index*len];
+	fftProcess(&lms->fft, lms->frame, x, FFT_FORWARD);
+	memcpy(lms->frame, &lms->frame[block], block*sizeof(float32_t));
+
+	//Smoothed power of each bin, from the first block alone after a reset
+	a = (lms->updates == 0) ? 1.0f : LMS_POWER_SMOOTHING;
+	power[0] += a*(x[0]*x[0] - power[0]);
+	power[block] += a*(x[1]*x[1] - power[block]);
+	for(k = 1; k < block; k++) {
+		re = x[2*k];
+		im = x[2*k + 1];
+		power[k] += a*(re*re + im*im - power[k]);
+	}
+
+	//Output, overlap-save as in stm32f7_conv.c, the second half is y
+	memset(acc, 0, len*sizeof(float32_t));
+	slot = lms->index;
+	for(partition = 0; partition < lms->partitions; partition++) {
+		spectrumMac(acc, &lms->delay_line[slot*len], &lms->response[partition*len], len, 0);
+		slot = (slot + 1 == lms->partitions) ? 0 : slot + 1;
+	}
+	fftProcess(&lms->fft, acc, work, FFT_INVERSE);
+	for(k = 0; k < block; k++) {
+		lms->output[k] = work[block + k];
+		lms->error[k] = lms->desired[k] - work[block + k];
+	}
+
+	//Spectrum of the error padded in front, divided by the input power
+	memset(work, 0, block*sizeof(float32_t));
+	memcpy(&work[block], lms->error, block*sizeof(float32_t));
+	fftProcess(&lms->fft, work, acc, FFT_FORWARD);
+	acc[0] /= power[0] + lms->delta;
+	acc[1] /= power[block] + lms->delta;
+	for(k = 1; k < block; k++) {
+		a = 1.0f/(power[k] + lms->delta);
+		acc[2*k] *= a;
+		acc[2*k + 1] *= a;
+	}
+
+	//Each partition correlates the error with its input, the first half of
+	//the correlation updates its taps in time, which keeps the weights a
+	//linear rather than circular convolution. The step matches the time
+	//domain filter, the power of a bin is 2*block times the sample power.
+	step = 2.0f*lms->mu/lms->partitions;
+	slot = lms->index;
+	for(partition = 0; partition < lms->partitions; partition++) {
+		memset(work, 0, len*sizeof(float32_t));
+		spectrumMac(work, &lms->delay_line[slot*len], acc, len, 1);
+		fftProcess(&lms->fft, work, work, FFT_INVERSE);
+		w = &lms->weights[partition*block];
+		scaleAdd(w, step, work, block);
+		memcpy(work, w, block*sizeof(float32_t));
+		memset(&work[block], 0, block*sizeof(float32_t));
+		fftProcess(&lms->fft, work, &lms->response[partition*len], FFT_FORWARD);
+		slot = (slot + 1 == lms->partitions) ? 0 : slot + 1;
+	}
+	lms->updates++;
+}
+
+/**
+  * @brief  Filter and adapt in the frequency domain, y and e of the last block
+  *					go out as the samples of this block come in
+  * @param  lms: filter
+  * @param  x: input samples
+  * @param  d: desired samples
+  * @param  y: output samples or NULL
+  * @param  e: error samples or NULL
+  * @param  n: number of samples
+  * @param  stride: distance between samples
+  * @retval 1 when the weights changed
+  */
+
+static int lmsFrequency(Lms *lms, const float32_t *x, const float32_t *d, float32_t *y, float32_t *e, uint32_t n, uint32_t stride) {
+	uint32_t i, count = lms->count;
+	float32_t xn, dn;
+	int updated = 0;
+
+	for(i = 0; i < n; i++) {
+		//Read before writing, the output may replace the input
+		xn = x[i*stride];
+		dn = d[i*stride];
+		if(y != NULL) y[i*stride] = lms->output[count];
+		if(e != NULL) e[i*stride] = lms->error[count];
+		lms->frame[lms->block + count] = xn;
+		lms->desired[count] = dn;
+		if(++count == lms->block) {
+			lmsFrequencyBlock(lms);
+			count = 0;
+			updated = 1;
+		}
+	}
+	lms->count = count;
+	return updated;
+}
+
+/**
+  * @brief  Filter a block of floating point samples and adapt the weights
+  * @param  lms: filter
+  * @param  x: input samples
+  * @param  d: desired samples
+  * @param  y: output samples, or NULL when not needed
+  * @param  e: error samples, or NULL when not needed, may be x or d
+  * @param  n: number of samples, any size
+  * @param  stride: distance between samples, 2 for one slot of the
+  *					interleaved buffer
+  * @retval 1 when the weights changed
+  */
+
+int lmsProcess(Lms *lms, const float32_t *x, const float32_t *d, float32_t *y, float32_t *e, uint32_t n, uint32_t stride) {
+	if(lms->method == LMS_FREQUENCY)
+		return lmsFrequency(lms, x, d, y, e, n, stride);
+	return lmsTime(lms, x, d, y, e, n, stride);
+}
+
+/**
+  * @brief  Filter a block of Q15 samples and adapt the weights, y and e
+  *					saturate at full scale
+  * @param  lms: filter
+  * @param  x: input samples
+  * @param  d: desired samples
+  * @param  y: output samples, or NULL when not needed
+  * @param  e: error samples, or NULL when not needed, may be x or d
+  * @param  n: number of samples, any size
+  * @param  stride: distance between samples, 2 for one slot of the
+  *					interleaved buffer
+  * @retval 1 when the weights changed
+  */
+
+int lmsProcessQ15(Lms *lms, const int16_t *x, const int16_t *d, int16_t *y, int16_t *e, uint32_t n, uint32_t stride) {
+	float32_t xf[LMS_CHUNK], df[LMS_CHUNK], yf[LMS_CHUNK], ef[LMS_CHUNK], v;
+	uint32_t count, i;
+	int updated = 0;
+
+	while(n > 0) {
+		count = (n < LMS_CHUNK) ? n : LMS_CHUNK;
+		for(i = 0; i < count; i++) {
+			xf[i] = x[i*stride]*(1.0f/32768.0f);
+			df[i] = d[i*stride]*(1.0f/32768.0f);
+		}
+		updated |= lmsProcess(lms, xf, df, yf, ef, count, 1);
+		for(i = 0; i < count; i++) {
+			if(y != NULL) {
+				v = yf[i]*32768.0f;
+				if(v > 32767.0f) v = 32767.0f;
+				if(v < -32768.0f) v = -32768.0f;
+				y[i*stride] = (int16_t)lrintf(v);
+			}
+			if(e != NULL) {
+				v = ef[i]*32768.0f;
+				if(v > 32767.0f) v = 32767.0f;
+				if(v < -32768.0f) v = -32768.0f;
+				e[i*stride] = (int16_t)lrintf(v);
+			}
+		}
+		x += count*stride;
+		d += count*stride;
+		if(y != NULL) y += count*stride;
+		if(e != NULL) e += count*stride;
+		n -= count;
+	}
+	return updated;
+}
+
+#if LMS_BENCHMARK
+//Cycle counter, the host build times with a clock instead
+#ifndef LMS_CYCLES
+#define LMS_CYCLES()          (DWT->CYCCNT)
+#endif
+
+#define LMS_BENCH_SAMPLES     4096			//Samples filtered for each method
+
+static float32_t bench_memory[LMS_MEMORY(LMS_BENCH_TAPS, LMS_BENCH_BLOCK)];
+static float32_t bench_x[LMS_BENCH_BLOCK], bench_d[LMS_BENCH_BLOCK], bench_e[LMS_BENCH_BLOCK];
+
+/**
+  * @brief  Measure the cycles per sample of the three methods adapting
+  *					LMS_BENCH_TAPS taps in blocks of LMS_BENCH_BLOCK samples.
+  *					At 216 MHz and 48 kHz there are 4500 cycles per sample.
+  * @param  cycles: cycles per sample, LMS_SAMPLE, LMS_BLOCK then
+  *					LMS_FREQUENCY
+  * @retval none
+  */
+
+void lmsBenchmark(float32_t cycles[3]) {
+	Lms lms;
+	uint32_t method, i, start, total;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	for(i = 0; i < LMS_BENCH_BLOCK; i++) {
+		bench_x[i] = ((i*37 % 64) - 32.0f)/64.0f;
+		bench_d[i] = ((i*11 % 64) - 32.0f)/64.0f;
+	}
+
+	for(method = LMS_SAMPLE; method <= LMS_FREQUENCY; method++) {
+		lmsInit(&lms, method, LMS_BENCH_TAPS, LMS_BENCH_BLOCK, 0.5f, bench_memory);
+		total = 0;
+		for(i = 0; i < LMS_BENCH_SAMPLES; i += LMS_BENCH_BLOCK) {
+			start = LMS_CYCLES();
+			lmsProcess(&lms, bench_x, bench_d, NULL, bench_e, LMS_BENCH_BLOCK, 1);
+			total += LMS_CYCLES() - start;
+		}
+		cycles[method] = (float32_t)total/LMS_BENCH_SAMPLES;
+	}
+}
+#endif /* LMS_BENCHMARK */
@@ -0,0 +1,41 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_envelope.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_envelope.c module
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_ENVELOPE_H
+#define __STM32F7_ENVELOPE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_display.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Peak envelope of a buffer decimated onto the graph columns.
+  *					Sample i of num_samples lands in column i*GRAPH_WIDTH/num_samples,
+  *					a column that got no sample has min > max.
+  */
+typedef struct
+{
+	uint32_t num_samples;	//Number of samples mapped onto the graph
+	uint32_t count;				//Number of samples added so far
+	uint32_t column;			//Column receiving the next sample
+	uint32_t next_edge;		//First sample of the next column
+	float32_t min[GRAPH_WIDTH];
+	float32_t max[GRAPH_WIDTH];
+} Envelope;
+
+/* Exported functions ------------------------------------------------------- */
+void envelopeInit(Envelope *env, uint32_t num_samples);
+void envelopeAddQ15(Envelope *env, const int16_t *data, uint32_t n);
+void envelopeAddF32(Envelope *env, const float32_t *data, uint32_t n);
+int envelopeComplete(const Envelope *env);
+void envelopeRange(const Envelope *env, float32_t *min, float32_t *max);
+void drawEnvelope(const Envelope *env, int ycentre, float32_t yscalefactor, uint32_t colour, int clear);
+
+#endif /* __STM32F7_ENVELOPE_H */
@@ -0,0 +1,110 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_iir.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_iir.c module
+  *
+  *          Both slots of the interleaved buffer through one set of
+  *          coefficients that the main loop can change while audio runs:
+  *
+  *          static IirBankF32 bank;
+  *          static IirF32 left, right;
+  *          static float32_t left_state[2*STAGES], right_state[2*STAGES];
+  *          iirBankInitF32(&bank, STAGES, coeffs);
+  *          iirInitF32(&left, &bank, left_state);
+  *          iirInitF32(&right, &bank, right_state);
+  *          ...
+  *          void process_half(float32_t *buf, uint32_t ns)
+  *          {
+  *            iirBankLatchF32(&bank);
+  *            iirProcessF32(&left, buf, buf, ns/2, 2);
+  *            iirProcessF32(&right, buf + 1, buf + 1, ns/2, 2);
+  *          }
+  *          ...
+  *          iirBankSetF32(&bank, new_coeffs);         //In the main loop
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_IIR_H
+#define __STM32F7_IIR_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "arm_math.h"
+#include "stm32f7xx_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define IIR_MAX_STAGES        16
+#define IIR_COEFFS            5					//b0, b1, b2, a1, a2 per stage
+
+#define IIR_F32               0					//Transposed direct form II, float
+#define IIR_Q31               1					//Direct form I, 1.31, 64 bit accumulator
+#define IIR_Q31_SHAPED        2					//IIR_Q31 with the rounding error fed back
+
+/**
+  * @brief  iirBenchmark() is only built when IIR_BENCHMARK is defined to 1,
+  * e.g. in the project options
+  */
+#ifndef IIR_BENCHMARK
+#define IIR_BENCHMARK         0
+#endif
+#define IIR_BENCH_STAGES      4					//1, 2, 4 and 8 stages
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Coefficient bank, shared by any number of channels
+  * Each stage is b0, b1, b2, a1, a2 with the signs of
+  * y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2], as MATLAB
+  * gives them. New coefficients wait in pending until the audio side takes
+  * them with iirBankLatch...() before a block, so a block and the channels
+  * sharing the bank never mix two sets.
+  */
+typedef struct
+{
+	uint32_t num_stages;
+	const float32_t * volatile pending;	//Set by iirBankSetF32()
+	const float32_t *active;						//Used by iirProcessF32()
+} IirBankF32;
+
+typedef struct
+{
+	uint32_t num_stages;
+	uint32_t post_shift;								//Coefficients are scaled by 2^-post_shift
+	const int32_t * volatile pending;
+	const int32_t *active;
+} IirBankQ31;
+
+/**
+  * @brief  One channel of a biquad cascade, its own history and a bank
+  */
+typedef struct
+{
+	IirBankF32 *bank;
+	float32_t *state;						//d1, d2 per stage
+} IirF32;
+
+typedef struct
+{
+	IirBankQ31 *bank;
+	int32_t *state;							//x1, x2, y1, y2 and the rounding error per stage
+	uint8_t noise_shaping;			//Feed the rounding error of each stage back
+} IirQ31;
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef iirBankInitF32(IirBankF32 *bank, uint32_t num_stages, const float32_t *coeffs);
+void iirBankSetF32(IirBankF32 *bank, const float32_t *coeffs);
+void iirBankLatchF32(IirBankF32 *bank);
+void iirInitF32(IirF32 *iir, IirBankF32 *bank, float32_t *state);
+void iirProcessF32(IirF32 *iir, const float32_t *in, float32_t *out, uint32_t n, uint32_t stride);
+HAL_StatusTypeDef iirBankInitQ31(IirBankQ31 *bank, uint32_t num_stages, uint32_t post_shift, const int32_t *coeffs);
+void iirBankSetQ31(IirBankQ31 *bank, const int32_t *coeffs);
+void iirBankLatchQ31(IirBankQ31 *bank);
+void iirInitQ31(IirQ31 *iir, IirBankQ31 *bank, int32_t *state, uint8_t noise_shaping);
+void iirProcessQ31(IirQ31 *iir, const int32_t *in, int32_t *out, uint32_t n, uint32_t stride);
+uint32_t iirCoeffsToQ31(const float32_t *coeffs, int32_t *coeffs_q31, uint32_t num_stages);
+#if IIR_BENCHMARK
+void iirBenchmark(float32_t cycles[3][IIR_BENCH_STAGES]);
+#endif
+
+#endif /* __STM32F7_IIR_H */
@@ -0,0 +1,49 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_image.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_image.c module
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_IMAGE_H
+#define __STM32F7_IMAGE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32746g_discovery_lcd.h"
+#include "stm32f7xx_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define RLE_MAX_WIDTH         480			//Widest image
+
+/**
+  * @brief  Decoded image start address
+  * The palette indices live in SDRAM after the vector scope buffer
+  * (0xC0690000), one L8 byte per pixel, up to a whole screen.
+  */
+#define RLE_IMAGE_BUFFER      ((uint32_t)(SDRAM_DEVICE_ADDR + 0x006A0000))
+#define RLE_BAND_ROWS         32			//Rows decoded for each DMA2D transfer
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Palette + RLE image made by Utilities/Host/bmp2rle.c, rows top to
+  *         bottom, each row coded on its own:
+  *           0x80 | (n - 2), index   : n = 2..129 pixels of one colour
+  *           n - 1, n indices        : n = 1..128 pixels copied as they are
+  */
+typedef struct
+{
+	uint16_t width;
+	uint16_t height;
+	uint16_t colours;						//Palette entries, up to 256
+	const uint32_t *palette;		//ARGB8888
+	const uint8_t *data;
+} RleImage;
+
+/* Exported functions ------------------------------------------------------- */
+void drawRleImage(uint32_t layer, uint16_t x, uint16_t y, const RleImage *image);
+const uint8_t *rleDecodeRow(const uint8_t *data, uint8_t *row, uint32_t width);
+
+#endif /* __STM32F7_IMAGE_H */
@@ -0,0 +1,50 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_render.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_render.c module
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_RENDER_H
+#define __STM32F7_RENDER_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "arm_math.h"
+#include "stm32f7xx_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define RENDER_DEFAULT_FPS    25			//Frame rate started by stm32f7_LCD_init()
+#define RENDER_DEFAULT_BUDGET 30			//Percent of the CPU the frames may take
+#define RENDER_MAX_FPS        60			//The panel refreshes at about 60 Hz
+
+/**
+  * @brief  LTDC line event priority, the lowest
+  * Audio in (AUDIO_IN_IRQ_PREPRIO) has the same priority and audio out
+  * (AUDIO_OUT_IRQ_PREPRIO) preempts it. The line event handler only updates a
+  * few counters and sets a flag, the frames are drawn from the main loop, so
+  * an audio in transfer waits at most for that short handler.
+  */
+#define RENDER_IRQ_PRIORITY   0x0F
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+	uint32_t target_fps;				//Frame rate asked for in renderInit()
+	uint32_t budget;						//Percent of the CPU the frames may take
+	uint32_t frames;						//Frames rendered since renderInit()
+	uint32_t dropped;						//Frames skipped, main loop busy or over budget
+	float32_t fps;							//Frames rendered per second over the last second
+	uint32_t render_us;					//Time of the last frame
+	uint32_t max_render_us;			//Longest frame since renderInit()
+} RenderStats;
+
+/* Exported functions ------------------------------------------------------- */
+void renderInit(uint32_t fps, uint32_t budget);
+int renderBegin(void);
+void renderEnd(void);
+void renderGetStats(RenderStats *stats);
+
+#endif /* __STM32F7_RENDER_H */
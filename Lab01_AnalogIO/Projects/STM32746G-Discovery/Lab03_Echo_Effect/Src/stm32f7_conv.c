@@ -0,0 +1,327 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_conv.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides a uniformly partitioned overlap-save
+  *					 convolver for impulse responses too long for the direct FIR
+  *					 filters of stm32f7_fir.c. Each block costs one forward and one
+  *					 inverse real FFT of twice the block plus a complex multiply
+  *					 accumulate per response partition, instead of one multiply
+  *					 accumulate per tap and sample. The FFTs are those of
+  *					 stm32f7_fft.c.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_conv.h"
+#include "stm32746g_discovery_sd.h"
+#include <string.h>
+
+/**
+  * @brief  Set up a convolver for a response of up to num_taps taps, the
+  *					response is all zero until one is set or loaded
+  * @param  conv: convolver
+  * @param  block: samples per call, a power of 2 from CONV_MIN_BLOCK to
+  *					CONV_MAX_BLOCK, also the latency
+  * @param  num_taps: longest response
+  * @param  memory: CONV_MEMORY(block, num_taps) floats, in SDRAM
+  *					(CONV_SDRAM_BUFFER) for long responses
+  * @retval HAL_OK, HAL_ERROR for a bad block size or number of taps
+  */
+
+HAL_StatusTypeDef convInit(Convolver *conv, uint32_t block, uint32_t num_taps, float32_t *memory) {
+	if(block < CONV_MIN_BLOCK || block > CONV_MAX_BLOCK || (block & (block - 1)) != 0 || num_taps < 1)
+		return HAL_ERROR;
+	if(fftInit(&conv->fft, 2*block) != HAL_OK)
+		return HAL_ERROR;
+
+	conv->block = block;
+	conv->fft_len = 2*block;
+	conv->partitions = CONV_PARTITIONS(block, num_taps);
+	conv->response = memory;
+	conv->delay_line = conv->response + conv->partitions*conv->fft_len;
+	conv->work = conv->delay_line + conv->partitions*conv->fft_len;
+	conv->accumulator = conv->work + conv->fft_len;
+	conv->frame = conv->accumulator + conv->fft_len;
+
+	memset(conv->response, 0, conv->partitions*conv->fft_len*sizeof(float32_t));
+	convReset(conv);
+	return HAL_OK;
+}
+
+/**
+  * @brief  Clear the input history, the response is kept
+  * @param  conv: convolver
+  * @retval none
+  */
+
+void convReset(Convolver *conv) {
+	memset(conv->delay_line, 0, conv->partitions*conv->fft_len*sizeof(float32_t));
+	memset(conv->frame, 0, conv->block*sizeof(float32_t));
+	conv->current = 0;
+}
+
+/**
+  * @brief  Transform the partition in the first half of the work buffer into
+  *					its place in the response spectra
+  * @param  conv: convolver
+  * @param  partition: partition number
+  * @param  taps: taps in the work buffer, the rest of the partition is zero
+  * @retval none
+  */
+
+static void setPartition(Convolver *conv, uint32_t partition, uint32_t taps) {
+	memset(&conv->work[taps], 0, (conv->fft_len - taps)*sizeof(float32_t));
+	fftProcess(&conv->fft, conv->work, &conv->response[partition*conv->fft_len], FFT_FORWARD);
+}
+
+/**
+  * @brief  Set the impulse response, not while convProcess() runs
+  * @param  conv: convolver
+  * @param  response: taps, h[0] first
+  * @param  num_taps: up to the number given to convInit(), a shorter
+  *					response is padded with zeros
+  * @retval HAL_OK, HAL_ERROR when the response is too long
+  */
+
+HAL_StatusTypeDef convSetResponse(Convolver *conv, const float32_t *response, uint32_t num_taps) {
+	uint32_t partition, taps;
+
+	if(num_taps > conv->partitions*conv->block)
+		return HAL_ERROR;
+	for(partition = 0; partition < conv->partitions; partition++) {
+		taps = (num_taps > conv->block) ? conv->block : num_taps;
+		memcpy(conv->work, response, taps*sizeof(float32_t));
+		setPartition(conv, partition, taps);
+		response += taps;
+		num_taps -= taps;
+	}
+	return HAL_OK;
+}
+
+/**
+  * @brief  Load the impulse response from a flash or card one partition at a
+  *					time, not while convProcess() runs. The taps are stored as
+  *					little endian 32 bit floats, h[0] first.
+  * @param  conv: convolver
+  * @param  read: BSP_QSPI_Read() after BSP_QSPI_Init(), or convReadSd()
+  * @param  address: byte address of h[0]
+  * @param  num_taps: up to the number given to convInit()
+  * @retval HAL_OK, HAL_ERROR when the response is too long or a read failed
+  */
+
+HAL_StatusTypeDef convLoadResponse(Convolver *conv, ConvRead read, uint32_t address, uint32_t num_taps) {
+	uint32_t partition, taps;
+
+	if(num_taps > conv->partitions*conv->block)
+		return HAL_ERROR;
+	for(partition = 0; partition < conv->partitions; partition++) {
+		taps = (num_taps > conv->block) ? conv->block : num_taps;
+		if(taps > 0 && read((uint8_t *)conv->work, address, taps*sizeof(float32_t)) != 0)
+			return HAL_ERROR;
+		setPartition(conv, partition, taps);
+		address += taps*sizeof(float32_t);
+		num_taps -= taps;
+	}
+	return HAL_OK;
+}
+
+/**
+  * @brief  Read bytes from the SD card for convLoadResponse(), e.g. a response
+  *					written raw to the card at a block boundary. Must call
+  *					BSP_SD_Init() first.
+  * @param  data: destination
+  * @param  address: byte address on the card
+  * @param  size: bytes
+  * @retval MSD_OK when it worked
+  */
+
+uint8_t convReadSd(uint8_t *data, uint32_t address, uint32_t size) {
+	static uint32_t sector[BLOCKSIZE/4];
+	uint32_t offset, count;
+
+	while(size > 0) {
+		if(BSP_SD_ReadBlocks(sector, address/BLOCKSIZE, 1, SD_DATATIMEOUT) != MSD_OK)
+			return MSD_ERROR;
+		//Wait for the card to finish before the next block
+		while(BSP_SD_GetCardState() != SD_TRANSFER_OK);
+		offset = address % BLOCKSIZE;
+		count = (size < BLOCKSIZE - offset) ? size : BLOCKSIZE - offset;
+		memcpy(data, (uint8_t *)sector + offset, count);
+		data += count;
+		address += count;
+		size -= count;
+	}
+	return MSD_OK;
+}
+
+/**
+  * @brief  Multiply accumulate two spectra in the fftProcess() packing,
+  *					the first pair holds the real bins 0 and fft_len/2
+  * @param  acc: accumulated spectrum
+  * @param  x: input spectrum
+  * @param  h: response spectrum
+  * @param  len: fft_len
+  * @retval none
+  */
+
+static void spectrumMac(float32_t *acc, const float32_t *x, const float32_t *h, uint32_t len) {
+	uint32_t k;
+	float32_t xr, xi, hr, hi;
+
+	acc[0] += x[0]*h[0];
+	acc[1] += x[1]*h[1];
+	for(k = 2; k < len; k += 2) {
+		xr = x[k];
+		xi = x[k + 1];
+		hr = h[k];
+		hi = h[k + 1];
+		acc[k] += xr*hr - xi*hi;
+		acc[k + 1] += xr*hi + xi*hr;
+	}
+}
+
+/**
+  * @brief  Filter the block in the second half of the work buffer, the
+  *					output replaces it
+  * @param  conv: convolver
+  * @retval none
+  */
+
+static void convBlock(Convolver *conv) {
+	uint32_t block = conv->block, len = conv->fft_len, slot, partition;
+
+	//Overlap-save frame, the last block then this one
+	memcpy(conv->work, conv->frame, block*sizeof(float32_t));
+	memcpy(conv->frame, &conv->work[block], block*sizeof(float32_t));
+
+	conv->current = (conv->current == 0) ? conv->partitions - 1 : conv->current - 1;
+	fftProcess(&conv->fft, conv->work, &conv->delay_line[conv->current*len], FFT_FORWARD);
+
+	//Partition p of the response meets the input from p blocks ago
+	memset(conv->accumulator, 0, len*sizeof(float32_t));
+	slot = conv->current;
+	for(partition = 0; partition < conv->partitions; partition++) {
+		spectrumMac(conv->accumulator, &conv->delay_line[slot*len], &conv->response[partition*len], len);
+		slot = (slot + 1 == conv->partitions) ? 0 : slot + 1;
+	}
+
+	//The first half wrapped around, the second half is the output
+	fftProcess(&conv->fft, conv->accumulator, conv->work, FFT_INVERSE);
+}
+
+/**
+  * @brief  Filter one block of floating point samples, in place when out is in
+  * @param  conv: convolver
+  * @param  in: block samples
+  * @param  out: block samples
+  * @param  stride: distance between samples, 1 for a mono block
+  * @retval none
+  */
+
+void convProcess(Convolver *conv, const float32_t *in, float32_t *out, uint32_t stride) {
+	uint32_t i;
+	float32_t *samples = &conv->work[conv->block];
+
+	for(i = 0; i < conv->block; i++)
+		samples[i] = in[i*stride];
+	convBlock(conv);
+	for(i = 0; i < conv->block; i++)
+		out[i*stride] = samples[i];
+}
+
+/**
+  * @brief  Filter one block of Q15 samples, in place when out is in
+  * @param  conv: convolver
+  * @param  in: block samples
+  * @param  out: block samples
+  * @param  stride: distance between samples, 2 for one slot of an
+  *					interleaved stereo buffer
+  * @retval none
+  */
+
+void convProcessQ15(Convolver *conv, const int16_t *in, int16_t *out, uint32_t stride) {
+	uint32_t i;
+	float32_t *samples = &conv->work[conv->block], y;
+
+	for(i = 0; i < conv->block; i++)
+		samples[i] = in[i*stride];
+	convBlock(conv);
+	for(i = 0; i < conv->block; i++) {
+		y = samples[i];
+		if(y > 32767.0f) y = 32767.0f;
+		if(y < -32768.0f) y = -32768.0f;
+		out[i*stride] = (int16_t)lrintf(y);
+	}
+}
+
+#if CONV_BENCHMARK
+#include "stm32f7_fir.h"
+
+//Cycle counter, the host build times with a clock instead
+#ifndef CONV_CYCLES
+#define CONV_CYCLES()         (DWT->CYCCNT)
+#endif
+
+#define CONV_BENCH_SAMPLES    4096			//Samples filtered for each entry
+
+static const uint16_t bench_taps[CONV_BENCH_TAPS] = {256, 512, 1024, 2048, 4096, 8192, 16384};
+static float32_t bench_block[CONV_MAX_BLOCK];
+
+/**
+  * @brief  Measure the cycles per sample of the direct FIR filter and the
+  *					partitioned convolver for 256 to 16384 taps. Both take the
+  *					input a block at a time, the latency of both is one block.
+  *					Uses CONV_SDRAM_BUFFER.
+  * @param  block: samples per block, as for convInit()
+  * @param  cycles: cycles per sample by method (CONV_DIRECT, CONV_PARTITIONED)
+  *					and number of taps, 0 when the method can't be set up
+  * @retval none
+  */
+
+void convBenchmark(uint32_t block, float32_t cycles[2][CONV_BENCH_TAPS]) {
+	Convolver conv;
+	FirF32 fir;
+	float32_t *memory = (float32_t *)CONV_SDRAM_BUFFER, *coeffs, *state;
+	uint32_t t, i, taps, start, total;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	for(t = 0; t < CONV_BENCH_TAPS; t++) {
+		taps = bench_taps[t];
+		cycles[CONV_DIRECT][t] = 0.0f;
+		cycles[CONV_PARTITIONED][t] = 0.0f;
+		if(convInit(&conv, block, taps, memory) != HAL_OK)
+			continue;
+		coeffs = memory + CONV_MEMORY(block, taps);
+		state = coeffs + taps;
+		//A decaying response, the timing does not depend on it
+		for(i = 0; i < taps; i++)
+			coeffs[i] = ((i*37 % 64) - 32.0f)/(32.0f*(i + 1));
+		convSetResponse(&conv, coeffs, taps);
+		memset(bench_block, 0, sizeof(bench_block));
+
+		if(firInitF32(&fir, coeffs, taps, state) == HAL_OK) {
+			total = 0;
+			for(i = 0; i < CONV_BENCH_SAMPLES; i += block) {
+				start = CONV_CYCLES();
+				firProcessF32(&fir, bench_block, bench_block, block, 1);
+				total += CONV_CYCLES() - start;
+			}
+			cycles[CONV_DIRECT][t] = (float32_t)total/CONV_BENCH_SAMPLES;
+		}
+
+		total = 0;
+		for(i = 0; i < CONV_BENCH_SAMPLES; i += block) {
+			start = CONV_CYCLES();
+			convProcess(&conv, bench_block, bench_block, 1);
+			total += CONV_CYCLES() - start;
+		}
+		cycles[CONV_PARTITIONED][t] = (float32_t)total/CONV_BENCH_SAMPLES;
+	}
+}
+#endif /* CONV_BENCHMARK */
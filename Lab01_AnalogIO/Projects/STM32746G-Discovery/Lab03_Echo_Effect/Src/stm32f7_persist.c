@@ -0,0 +1,284 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_persist.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides display modes for noisy signals that change
+  *					 every frame. plotPersist() keeps an intensity per graph pixel
+  *					 that fades like the phosphor of an analogue scope, so a trace
+  *					 drawn in the same place over many frames stands out from noise.
+  *					 averageAdd() averages spectra before they are plotted.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_persist.h"
+
+extern LTDC_HandleTypeDef hLtdcHandler;
+
+static Envelope persist_envelope;
+static DMA2D_HandleTypeDef hDma2dPersist;
+static uint32_t persist_clut[256];
+
+static int persist_type = 0;				//WAVE or FFT, 0 before the first frame
+static float32_t persist_mag = 0;		//Magnitude at the edge of the scale
+static int16_t persist_top = 0;			//Rows holding a non zero intensity,
+static int16_t persist_bottom = -1;	//empty when top > bottom
+
+/**
+  * @brief  Average a frame of spectrum magnitudes
+  * @param  avg: average
+  * @param  num_bins: bins per frame, up to AVERAGE_MAX_BINS
+  * @param  mode: AVERAGE_EXPONENTIAL or AVERAGE_LINEAR
+  * @param  frames: frames per average for AVERAGE_LINEAR, time constant in
+  *					frames for AVERAGE_EXPONENTIAL
+  * @retval none
+  */
+
+void averageInit(Average *avg, uint32_t num_bins, uint8_t mode, uint32_t frames) {
+	uint32_t i;
+
+	if(num_bins > AVERAGE_MAX_BINS) num_bins = AVERAGE_MAX_BINS;
+	if(frames < 1) frames = 1;
+	avg->mode = mode;
+	avg->num_bins = num_bins;
+	avg->frames = frames;
+	avg->count = 0;
+	for(i = 0; i < num_bins; i++)
+		avg->power[i] = 0;
+}
+
+/**
+  * @brief  Add a frame of magnitudes, e.g. from fftMagnitude(), to the average
+  * @param  avg: average
+  * @param  magnitude: num_bins magnitudes
+  * @param  out: num_bins averaged magnitudes, only written when 1 is returned
+  * @retval 1 when out holds a new average and the graph needs drawing, 0 otherwise
+  */
+
+int averageAdd(Average *avg, const float32_t *magnitude, float32_t *out) {
+	uint32_t i, n = avg->num_bins;
+	float32_t *power = avg->power;
+	float32_t weight, scale;
+
+	if(avg->mode == AVERAGE_LINEAR) {
+		for(i = 0; i < n; i++)
+			power[i] += magnitude[i]*magnitude[i];
+		if(++avg->count < avg->frames)
+			return 0;
+
+		scale = 1.0f/avg->count;
+		for(i = 0; i < n; i++) {
+			out[i] = sqrtf(power[i]*scale);
+			power[i] = 0;
+		}
+		avg->count = 0;
+		return 1;
+	}
+
+	//Exponential, the first frames are weighted 1/count so the start is not biased to zero
+	if(avg->count < avg->frames) avg->count++;
+	weight = 1.0f/avg->count;
+	for(i = 0; i < n; i++) {
+		power[i] += (magnitude[i]*magnitude[i] - power[i])*weight;
+		out[i] = sqrtf(power[i]);
+	}
+	return 1;
+}
+
+/**
+  * @brief  Phosphor colours from the background at 0 to the graph colour at 255
+  * @param  none
+  * @retval none
+  */
+
+static void buildPalette(void) {
+	uint32_t i, c, shift, back, fore, colour;
+
+	for(i = 0; i < 256; i++) {
+		colour = 0xFF000000u;
+		for(shift = 0; shift < 24; shift += 8) {
+			back = (BACKGROUND_COLOUR >> shift) & 0xFF;
+			fore = (GRAPH_COLOUR >> shift) & 0xFF;
+			c = (back*(255 - i) + fore*i + 127)/255;
+			colour |= c << shift;
+		}
+		persist_clut[i] = colour;
+	}
+}
+
+/**
+  * @brief  Fade every pixel of the rows still lit and find which ones stay lit.
+  *					Four pixels are faded per word, each loses 1/2^shift of its
+  *					intensity and at least one step so the trail ends.
+  * @param  shift: decay shift
+  * @retval none
+  */
+
+static void decayRows(uint8_t shift) {
+	uint32_t *word, w, lit;
+	uint32_t mask = (0xFFu >> shift)*0x01010101u;
+	int16_t row, top = PERSIST_ROWS, bottom = -1;
+	int i;
+
+	for(row = persist_top; row <= persist_bottom; row++) {
+		word = (uint32_t *)(PERSIST_BUFFER + (uint32_t)row*GRAPH_WIDTH);
+		lit = 0;
+		for(i = 0; i < GRAPH_WIDTH/4; i++) {
+			w = word[i];
+			if(w == 0)
+				continue;
+			w -= (w >> shift) & mask;
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+			w = __UQSUB8(w, 0x01010101u);
+#else
+			//Subtract one from the non zero bytes
+			w -= ((w | ((w & 0x7F7F7F7Fu) + 0x7F7F7F7Fu)) >> 7) & 0x01010101u;
+#endif
+			word[i] = w;
+			lit |= w;
+		}
+		if(lit) {
+			if(row < top) top = row;
+			bottom = row;
+		}
+	}
+	persist_top = top;
+	persist_bottom = bottom;
+}
+
+/**
+  * @brief  Forget the persistence, the next plotPersist() starts a new scale
+  * @param  none
+  * @retval none
+  */
+
+void clearPersist(void) {
+	memset((void *)PERSIST_BUFFER, 0, GRAPH_WIDTH*PERSIST_ROWS);
+	persist_type = 0;
+	persist_mag = 0;
+	persist_top = 0;
+	persist_bottom = PERSIST_ROWS - 1;
+}
+
+/**
+  * @brief  Plot a buffer over the faded previous frames. The scale only
+  *					grows, so old frames stay where they were drawn.
+  * @param  data_buffer: a pointer that points to the data that need to plot
+  * @param  num_samples: number of the plotted data buffer
+  * @param  type: WAVE, samples around the centre line, or FFT, the first half
+  *					of the buffer from the bottom of the graph like plotFFT()
+  * @param  decay_shift: PERSIST_SLOW, PERSIST_MEDIUM, PERSIST_FAST or any shift 1 to 7
+  * @retval none
+  */
+
+void plotPersist(float32_t * data_buffer, int num_samples, int type, uint8_t decay_shift) {
+	int x, y, count, ycentre, pixels, old_top, old_bottom, first, last;
+	int16_t ymax, ymin, top, bottom, prev_top = 1, prev_bottom = 0;
+	float32_t min, max, mag, yscalefactor;
+	uint8_t *row;
+	uint32_t address, bytes_per_pixel, xsize = BSP_LCD_GetXSize();
+	DMA2D_CLUTCfgTypeDef clut;
+
+	if(type != FFT) type = WAVE;
+	if(decay_shift < 1) decay_shift = 1;
+	if(decay_shift > 7) decay_shift = 7;
+	count = (type == FFT) ? num_samples/2 : num_samples;
+	if(count < 1)
+		return;
+
+	envelopeInit(&persist_envelope, count);
+	envelopeAddF32(&persist_envelope, data_buffer, count);
+	envelopeRange(&persist_envelope, &min, &max);
+	mag = (max*max > min*min) ? max : -min;
+	if(mag == 0) mag = 1;
+
+	//A new kind of plot or a signal outgrowing the scale starts again
+	if(type != persist_type || mag > persist_mag) {
+		if(persist_mag == 0) buildPalette();
+		clearPersist();
+		persist_type = type;
+		persist_mag = mag*PERSIST_HEADROOM;
+	}
+	if(type == FFT) {
+		ycentre = FFT_YCENTRE;
+		pixels = 200;
+	} else {
+		ycentre = GRAPH_YCENTRE;
+		pixels = 100;
+	}
+	yscalefactor = pixels/persist_mag;
+
+	old_top = persist_top;
+	old_bottom = persist_bottom;
+	decayRows(decay_shift);
+
+	//Light the new frame at full intensity, joined column to column
+	for(x = 0; x < GRAPH_WIDTH; x++) {
+		if(persist_envelope.min[x] > persist_envelope.max[x])
+			continue;
+		top = ycentre - (int)(persist_envelope.max[x]*yscalefactor);
+		bottom = ycentre - (int)(persist_envelope.min[x]*yscalefactor);
+		if(prev_top <= prev_bottom) {
+			if(top > prev_bottom) top = prev_bottom;
+			if(bottom < prev_top) bottom = prev_top;
+		}
+		prev_top = top;
+		prev_bottom = bottom;
+		if(top < HEADER_HEIGHT) top = HEADER_HEIGHT;
+		if(bottom > GRAPH_VER_END_PIXEL) bottom = GRAPH_VER_END_PIXEL;
+
+		row = (uint8_t *)PERSIST_BUFFER + (top - HEADER_HEIGHT)*GRAPH_WIDTH + x;
+		for(y = top; y <= bottom; y++, row += GRAPH_WIDTH)
+			*row = 255;
+		if(top - HEADER_HEIGHT < persist_top) persist_top = top - HEADER_HEIGHT;
+		if(bottom - HEADER_HEIGHT > persist_bottom) persist_bottom = bottom - HEADER_HEIGHT;
+	}
+
+	//Only the rows lit before or now can have changed
+	first = (old_top < persist_top) ? old_top : persist_top;
+	last = (old_bottom > persist_bottom) ? old_bottom : persist_bottom;
+	if(first <= last) {
+		if(hLtdcHandler.LayerCfg[LTDC_ACTIVE_LAYER].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) {
+			hDma2dPersist.Init.ColorMode = DMA2D_OUTPUT_RGB565;
+			bytes_per_pixel = 2;
+		} else {
+			hDma2dPersist.Init.ColorMode = DMA2D_OUTPUT_ARGB8888;
+			bytes_per_pixel = 4;
+		}
+		hDma2dPersist.Instance = DMA2D;
+		hDma2dPersist.Init.Mode = DMA2D_M2M_PFC;
+		hDma2dPersist.Init.OutputOffset = xsize - GRAPH_WIDTH;
+		hDma2dPersist.LayerCfg[1].InputColorMode = DMA2D_INPUT_L8;
+		hDma2dPersist.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+		hDma2dPersist.LayerCfg[1].InputAlpha = 0xFF;
+		hDma2dPersist.LayerCfg[1].InputOffset = 0;
+		if(HAL_DMA2D_Init(&hDma2dPersist) != HAL_OK || HAL_DMA2D_ConfigLayer(&hDma2dPersist, 1) != HAL_OK)
+			return;
+
+		//Other modules load their own palettes into the foreground CLUT
+		clut.pCLUT = persist_clut;
+		clut.CLUTColorMode = DMA2D_CCM_ARGB8888;
+		clut.Size = 255;
+		if(HAL_DMA2D_CLUTStartLoad(&hDma2dPersist, &clut, 1) != HAL_OK)
+			return;
+		HAL_DMA2D_PollForTransfer(&hDma2dPersist, 10);
+
+		SCB_CleanDCache_by_Addr((uint32_t *)(PERSIST_BUFFER + first*GRAPH_WIDTH), (last - first + 1)*GRAPH_WIDTH);
+		address = hLtdcHandler.LayerCfg[LTDC_ACTIVE_LAYER].FBStartAdress +
+							bytes_per_pixel*(xsize*(HEADER_HEIGHT + first) + FIRST_DATA_PIXEL);
+		if(HAL_DMA2D_Start(&hDma2dPersist, PERSIST_BUFFER + first*GRAPH_WIDTH, address, GRAPH_WIDTH, last - first + 1) != HAL_OK)
+			return;
+		HAL_DMA2D_PollForTransfer(&hDma2dPersist, 20);
+	}
+
+	if(type == FFT) {
+		ymax = ycentre - pixels;
+		ymin = ycentre;
+		drawAxes(ycentre, ymax, ymin, persist_mag, 0, 0, num_samples, FIRST_DATA_PIXEL + GRAPH_WIDTH, FFT);
+	} else {
+		ymax = ycentre - pixels;
+		ymin = ycentre + pixels;
+		drawAxes(ycentre, ymax, ymin, persist_mag, -persist_mag, 0, num_samples, FIRST_DATA_PIXEL + GRAPH_WIDTH, WAVE);
+	}
+}
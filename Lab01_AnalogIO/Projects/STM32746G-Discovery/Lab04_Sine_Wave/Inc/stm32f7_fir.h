@@ -0,0 +1,90 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_fir.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_fir.c module
+  *
+  *          Drop-in use in the half-buffer callback of a DMA loop, filtering
+  *          the left slot of the interleaved buffer in place:
+  *
+  *          static int16_t fir_state[2*NUM_TAPS];
+  *          static FirQ15 fir;
+  *          firInitQ15(&fir, coeffs, NUM_TAPS, fir_state);
+  *          ...
+  *          void process_half(int16_t *buf, uint32_t ns)
+  *          {
+  *            firProcessQ15(&fir, buf, buf, ns/2, 2);
+  *          }
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_FIR_H
+#define __STM32F7_FIR_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "arm_math.h"
+#include "stm32f7xx_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define FIR_MAX_TAPS          16384			//Past 1024 stm32f7_conv.c is much cheaper
+
+#define FIR_Q15               0				//16 bit samples and coefficients, 1.15
+#define FIR_Q31               1				//32 bit samples and coefficients, 1.31
+#define FIR_F32               2				//Single precision floating point
+
+/**
+  * @brief  firBenchmark() and its buffers are only built when FIR_BENCHMARK
+  * is defined to 1, e.g. in the project options
+  */
+#ifndef FIR_BENCHMARK
+#define FIR_BENCHMARK         0
+#endif
+#define FIR_BENCH_TAPS        5				//8, 32, 128, 512 and 1024 taps
+#define FIR_BENCH_BLOCKS      4				//16, 64, 256 and 512 samples per block
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  FIR filter state
+  * The state buffer holds 2*num_taps samples, every sample is written twice,
+  * num_taps apart, so the last num_taps inputs are always contiguous and the
+  * history never has to be moved. The coefficients are in time order, h[0]
+  * multiplies the newest input.
+  */
+typedef struct
+{
+	uint32_t num_taps;
+	uint32_t index;							//Where the newest input is, counts down
+	const int16_t *coeffs;
+	int16_t *state;
+} FirQ15;
+
+typedef struct
+{
+	uint32_t num_taps;
+	uint32_t index;
+	const int32_t *coeffs;
+	int32_t *state;
+} FirQ31;
+
+typedef struct
+{
+	uint32_t num_taps;
+	uint32_t index;
+	const float32_t *coeffs;
+	float32_t *state;
+} FirF32;
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef firInitQ15(FirQ15 *fir, const int16_t *coeffs, uint32_t num_taps, int16_t *state);
+HAL_StatusTypeDef firInitQ31(FirQ31 *fir, const int32_t *coeffs, uint32_t num_taps, int32_t *state);
+HAL_StatusTypeDef firInitF32(FirF32 *fir, const float32_t *coeffs, uint32_t num_taps, float32_t *state);
+void firProcessQ15(FirQ15 *fir, const int16_t *in, int16_t *out, uint32_t n, uint32_t stride);
+void firProcessQ31(FirQ31 *fir, const int32_t *in, int32_t *out, uint32_t n, uint32_t stride);
+void firProcessF32(FirF32 *fir, const float32_t *in, float32_t *out, uint32_t n, uint32_t stride);
+#if FIR_BENCHMARK
+void firBenchmark(float32_t cycles[3][FIR_BENCH_TAPS][FIR_BENCH_BLOCKS]);
+#endif
+
+#endif /* __STM32F7_FIR_H */
@@ -0,0 +1,230 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_waterfall.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides a scrolling spectrogram (waterfall) display.
+  *					 Each spectrum becomes one colour-mapped row of an L8 layer over the
+  *					 graph area. Scrolling only moves the layer start address over a
+  *					 ring of rows in SDRAM, no pixel is copied per frame.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_waterfall.h"
+#include "stm32f7_decibel.h"
+#include "stm32f7_envelope.h"
+
+extern LTDC_HandleTypeDef hLtdcHandler;
+extern uint16_t frequency;
+
+static Envelope waterfall_envelope;	//Peak of the spectrum bins in each column
+static uint8_t waterfall_row[GRAPH_WIDTH];
+static uint32_t waterfall_clut[256];
+
+static int waterfall_active = 0;
+static uint32_t waterfall_top = 0;		//Ring row shown at the top of the window
+static float32_t waterfall_peak = 0;
+
+/**
+  * @brief  Build the colour lookup table, black - blue - cyan - yellow - red - white
+  * @param  none
+  * @retval none
+  */
+
+static void buildPalette(void) {
+	static const uint8_t anchors[][4] = {
+		//index, red, green, blue
+		{0, 0, 0, 0},
+		{64, 0, 0, 192},
+		{128, 0, 192, 255},
+		{176, 255, 255, 0},
+		{224, 255, 64, 0},
+		{255, 255, 255, 255},
+	};
+	uint32_t i, a = 0, span, pos, red, green, blue;
+
+	for(i = 0; i < 256; i++) {
+		if(i > anchors[a + 1][0]) a++;
+		span = anchors[a + 1][0] - anchors[a][0];
+		pos = i - anchors[a][0];
+		red = (anchors[a][1]*(span - pos) + anchors[a + 1][1]*pos)/span;
+		green = (anchors[a][2]*(span - pos) + anchors[a + 1][2]*pos)/span;
+		blue = (anchors[a][3]*(span - pos) + anchors[a + 1][3]*pos)/span;
+		//CLUT entries are RGB888
+		waterfall_clut[i] = (red << 16) | (green << 8) | blue;
+	}
+}
+
+/**
+  * @brief  Switch the graph layer to an L8 window over the graph area reading
+	*					from the waterfall ring, the labels move to the logo layer
+  * @param  none
+  * @retval none
+  */
+
+static void enterWaterfall(void) {
+	LTDC_LayerCfgTypeDef layer_cfg;
+	char axes_value[LABEL_MAX_LEN + 1];
+
+	buildPalette();
+
+	//Start with a black ring, the window shows WATERFALL_ROWS rows from waterfall_top
+	memset((void *)WATERFALL_BUFFER, 0, 2*WATERFALL_RING_ROWS*GRAPH_WIDTH);
+	SCB_CleanDCache_by_Addr((uint32_t *)WATERFALL_BUFFER, 2*WATERFALL_RING_ROWS*GRAPH_WIDTH);
+	waterfall_top = 0;
+	waterfall_peak = 0;
+
+	layer_cfg = hLtdcHandler.LayerCfg[LTDC_ACTIVE_LAYER];
+	layer_cfg.WindowX0 = FIRST_DATA_PIXEL;
+	layer_cfg.WindowX1 = FIRST_DATA_PIXEL + GRAPH_WIDTH;
+	layer_cfg.WindowY0 = HEADER_HEIGHT;
+	layer_cfg.WindowY1 = HEADER_HEIGHT + WATERFALL_ROWS;
+	layer_cfg.PixelFormat = LTDC_PIXEL_FORMAT_L8;
+	layer_cfg.FBStartAdress = WATERFALL_BUFFER;
+	layer_cfg.Alpha = 255;
+	layer_cfg.ImageWidth = GRAPH_WIDTH;
+	layer_cfg.ImageHeight = WATERFALL_ROWS;
+	HAL_LTDC_ConfigLayer(&hLtdcHandler, &layer_cfg, LTDC_ACTIVE_LAYER);
+	HAL_LTDC_ConfigCLUT(&hLtdcHandler, waterfall_clut, 256, LTDC_ACTIVE_LAYER);
+	HAL_LTDC_EnableCLUT(&hLtdcHandler, LTDC_ACTIVE_LAYER);
+
+	//The graph layer can't be drawn on any more, draw the labels on the logo layer
+	BSP_LCD_SelectLayer(0);
+	setLabelLayer(0);
+	BSP_LCD_SetFont(&Font12);
+	BSP_LCD_SetTextColor(BACKGROUND_COLOUR);
+	BSP_LCD_FillRect(0, HEADER_HEIGHT, FIRST_DATA_PIXEL, 272 - HEADER_HEIGHT);
+	BSP_LCD_SetTextColor(TEXT_COLOUR);
+	BSP_LCD_SetBackColor(BACKGROUND_COLOUR);
+
+	drawLabel(0, 0, "Spectrogram", LEFT_MODE);
+	drawLabel(0, HEADER_HEIGHT, "now", LEFT_MODE);
+	drawLabel(0, GRAPH_VER_END_PIXEL - 12, "older", LEFT_MODE);
+	drawLabel(20, GRAPH_VER_END_PIXEL - 15, "Frequency(Hz)", RIGHT_MODE);
+	drawLabel(FIRST_DATA_PIXEL, GRAPH_VER_END_PIXEL+2, "0", LEFT_MODE);
+	formatInt(axes_value, frequency/2);
+	drawLabel(FIRST_DATA_PIXEL + GRAPH_WIDTH, GRAPH_VER_END_PIXEL+2, axes_value, LEFT_MODE);
+
+	waterfall_active = 1;
+}
+
+/**
+  * @brief  Give the full screen graph layer back to the other plot functions
+  * @param  none
+  * @retval none
+  */
+
+void exitWaterfall(void) {
+	if(waterfall_active == 0)
+		return;
+
+	//Take the waterfall labels off the logo layer
+	clearLabels();
+
+	HAL_LTDC_DisableCLUT(&hLtdcHandler, LTDC_ACTIVE_LAYER);
+	initGraphLayer();
+	BSP_LCD_SetTransparency(LTDC_ACTIVE_LAYER, 200);
+
+	BSP_LCD_SelectLayer(LTDC_ACTIVE_LAYER);
+	BSP_LCD_Clear(BACKGROUND_COLOUR);
+	setLabelLayer(LTDC_ACTIVE_LAYER);
+
+	waterfall_active = 0;
+}
+
+/**
+  * @brief  Convert magnitudes into 8-bit palette indices,
+	*					index = saturate((value - floor)*scale) where value is the magnitude
+	*					or its decibel value. Four indices are packed into each word store.
+  * @param  mag: magnitudes
+  * @param  index: palette indices
+  * @param  n: number of magnitudes
+  * @param  floor: value shown as index 0
+  * @param  scale: indices per unit of value
+  * @param  log_scale: WATERFALL_LOG = value is 20*log10(mag), WATERFALL_LINEAR = value is mag
+  * @retval none
+  */
+
+void magnitudeToPalette(const float32_t *mag, uint8_t *index, uint32_t n, float32_t floor, float32_t scale, int log_scale) {
+	float32_t v[4];
+	uint32_t i, k, count, word;
+
+	for(i = 0; i < n; i += 4) {
+		count = (n - i < 4) ? n - i : 4;
+		if(log_scale)
+			decibelFromMagnitude(&mag[i], v, count, floor);
+		else
+			memcpy(v, &mag[i], count*sizeof(float32_t));
+		for(k = 0; k < 4; k++) {
+			if(k >= count) v[k] = floor;
+			v[k] = (v[k] - floor)*scale;
+			if(v[k] < 0) v[k] = 0;
+			if(v[k] > 255) v[k] = 255;
+		}
+		word = (uint32_t)v[0] | ((uint32_t)v[1] << 8) | ((uint32_t)v[2] << 16) | ((uint32_t)v[3] << 24);
+		if(i + 4 <= n)
+			memcpy(&index[i], &word, 4);
+		else
+			for(k = 0; i + k < n; k++) index[i + k] = (uint8_t)(word >> (8*k));
+	}
+}
+
+/**
+  * @brief  Add the spectrum as the newest row at the top of the waterfall,
+	*					older rows move down by one line
+  * @param  data_buffer: a pointer that points to the magnitudes, only the first half is plotted
+	*											 because the other half is duplicated
+  * @param  num_samples: number of the plotted data buffer
+  * @param  log_scale: WATERFALL_LOG = colour by decibel, WATERFALL_LINEAR = colour by magnitude
+  * @retval none
+  */
+
+void plotWaterfall(float32_t * data_buffer, int num_samples, int log_scale) {
+	uint32_t i;
+	uint8_t *row;
+	float32_t max = 0, floor, scale;
+
+	if(num_samples < 2)
+		return;
+
+	if(waterfall_active == 0)
+		enterWaterfall();
+
+	//Peak of the bins in each column, columns without a bin repeat the left one
+	envelopeInit(&waterfall_envelope, num_samples/2);
+	envelopeAddF32(&waterfall_envelope, data_buffer, num_samples/2);
+	for(i = 0; i < GRAPH_WIDTH; i++) {
+		if(waterfall_envelope.min[i] > waterfall_envelope.max[i])
+			waterfall_envelope.max[i] = waterfall_envelope.max[i - 1];
+		if(waterfall_envelope.max[i] > max) max = waterfall_envelope.max[i];
+	}
+
+	//Follow the peak quickly upwards and slowly downwards
+	waterfall_peak *= WATERFALL_PEAK_DECAY;
+	if(max > waterfall_peak) waterfall_peak = max;
+	if(waterfall_peak <= 0) waterfall_peak = 1;
+
+	if(log_scale) {
+		floor = 20*log10f(waterfall_peak) - WATERFALL_RANGE_DB;
+		scale = 255/WATERFALL_RANGE_DB;
+	} else {
+		floor = 0;
+		scale = 255/waterfall_peak;
+	}
+	magnitudeToPalette(waterfall_envelope.max, waterfall_row, GRAPH_WIDTH, floor, scale, log_scale);
+
+	//The new top row is stored twice, WATERFALL_RING_ROWS apart, so the window
+	//starting at any ring row is contiguous. Neither copy is inside the window
+	//being shown until the address is reloaded.
+	waterfall_top = (waterfall_top == 0) ? WATERFALL_RING_ROWS - 1 : waterfall_top - 1;
+	row = (uint8_t *)(WATERFALL_BUFFER + waterfall_top*GRAPH_WIDTH);
+	memcpy(row, waterfall_row, GRAPH_WIDTH);
+	memcpy(row + WATERFALL_RING_ROWS*GRAPH_WIDTH, waterfall_row, GRAPH_WIDTH);
+	SCB_CleanDCache_by_Addr((uint32_t *)row, GRAPH_WIDTH);
+	SCB_CleanDCache_by_Addr((uint32_t *)(row + WATERFALL_RING_ROWS*GRAPH_WIDTH), GRAPH_WIDTH);
+
+	//Scroll at the next vertical blanking so the frame never tears
+	HAL_LTDC_SetAddress_NoReload(&hLtdcHandler, (uint32_t)row, LTDC_ACTIVE_LAYER);
+	HAL_LTDC_Reload(&hLtdcHandler, LTDC_RELOAD_VERTICAL_BLANKING);
+}
@@ -0,0 +1,121 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_lms.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_lms.c module
+  *
+  *          Identify the system between the left slot of the interleaved
+  *          buffer (input) and the right slot (its output), send the error
+  *          back out of the left slot and show the weights:
+  *
+  *          static Lms lms;
+  *          static float32_t memory[LMS_MEMORY(512, 64)];
+  *          lmsInit(&lms, LMS_FREQUENCY, 512, 64, 0.5f, memory);
+  *          ...
+  *          void process_half(int16_t *buf, uint32_t ns)
+  *          {
+  *            lmsProcessQ15(&lms, buf, buf + 1, NULL, buf, ns/2, 2);
+  *          }
+  *          ...
+  *          plotLMS(lms.weights, 512, LIVE);          //In the main loop
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_LMS_H
+#define __STM32F7_LMS_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "arm_math.h"
+#include "stm32f7_fft.h"
+#include "stm32f7xx_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define LMS_MAX_TAPS          4096
+
+#define LMS_SAMPLE            0					//Normalised LMS, the weights move every sample
+#define LMS_BLOCK             1					//The gradients of a block summed, one update per block
+#define LMS_FREQUENCY         2					//Partitioned, constrained frequency domain filter
+
+#define LMS_MIN_BLOCK         16				//LMS_FREQUENCY, the FFT is twice the block
+#define LMS_MAX_BLOCK         2048
+
+/**
+  * @brief  Input power below which the normalisation stops growing the step,
+  * per tap and full scale squared, -60 dBFS
+  */
+#define LMS_REGULARISATION    1e-6f
+
+/**
+  * @brief  Weight of the last block in the power of each bin of LMS_FREQUENCY
+  */
+#define LMS_POWER_SMOOTHING   0.1f
+
+/**
+  * @brief  Floats of memory for a filter of num_taps taps adapted in blocks of
+  * block samples, enough for every method
+  */
+#define LMS_PARTITIONS(block, taps) (((taps) + (block) - 1)/(block))
+#define LMS_MEMORY(taps, block)     (5*LMS_PARTITIONS(block, taps)*(block) + 10*(block) + 1)
+
+/**
+  * @brief  lmsBenchmark() is only built when LMS_BENCHMARK is defined to 1,
+  * e.g. in the project options
+  */
+#ifndef LMS_BENCHMARK
+#define LMS_BENCHMARK         0
+#endif
+#define LMS_BENCH_TAPS        512
+#define LMS_BENCH_BLOCK       64
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Adaptive FIR filter, y = w*x follows the desired signal d and
+  * e = d - y is the error. The step mu is normalised by the input power and
+  * lies between 0 and 2, 1 converges fastest on white noise. LMS_BLOCK sums
+  * the gradients of a block, so an input with most of its power in a few
+  * bins needs a smaller step; LMS_FREQUENCY normalises every bin and doesn't.
+  * LMS_SAMPLE and LMS_BLOCK give y and e in the same call, LMS_FREQUENCY one
+  * block later and at a fraction of the cost for long filters. weights always
+  * holds the taps in time, w[0] first.
+  */
+typedef struct
+{
+	uint8_t method;							//LMS_SAMPLE, LMS_BLOCK or LMS_FREQUENCY
+	uint32_t num_taps;
+	uint32_t block;							//Samples per update
+	uint32_t partitions;				//LMS_FREQUENCY, blocks of taps
+	uint32_t fft_len;						//LMS_FREQUENCY, 2*block
+	uint32_t index;							//Newest sample of the history, or spectrum of the delay line
+	uint32_t count;							//Samples into the block
+	uint32_t updates;						//Weight updates since the reset
+	volatile float32_t mu;			//Step, set by lmsSetStep()
+	float32_t power;						//Input power over the taps
+	float32_t delta;						//Regularisation of the power
+	RealFft fft;
+	float32_t *weights;					//num_taps, partitions*block for LMS_FREQUENCY
+	float32_t *history;					//2*num_taps, the input written twice
+	float32_t *gradient;				//num_taps, LMS_BLOCK
+	float32_t *response;				//partitions spectra of the weights
+	float32_t *delay_line;			//partitions spectra of the input
+	float32_t *work;						//fft_len
+	float32_t *accumulator;			//fft_len
+	float32_t *frame;						//fft_len, the last input block and this one
+	float32_t *desired;					//block
+	float32_t *output;					//block, y of the last block
+	float32_t *error;						//block, e of the last block
+	float32_t *bin_power;				//block + 1
+} Lms;
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef lmsInit(Lms *lms, uint8_t method, uint32_t num_taps, uint32_t block, float32_t mu, float32_t *memory);
+void lmsReset(Lms *lms);
+HAL_StatusTypeDef lmsSetStep(Lms *lms, float32_t mu);
+int lmsProcess(Lms *lms, const float32_t *x, const float32_t *d, float32_t *y, float32_t *e, uint32_t n, uint32_t stride);
+int lmsProcessQ15(Lms *lms, const int16_t *x, const int16_t *d, int16_t *y, int16_t *e, uint32_t n, uint32_t stride);
+#if LMS_BENCHMARK
+void lmsBenchmark(float32_t cycles[3]);
+#endif
+
+#endif /* __STM32F7_LMS_H */
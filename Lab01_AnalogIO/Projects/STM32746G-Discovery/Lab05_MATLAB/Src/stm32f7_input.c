@@ -0,0 +1,288 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_input.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides interrupt driven user input. The user button
+  *					 interrupts on both edges and is debounced in the interrupt,
+  *					 the touch screen interrupt only marks that the controller has
+  *					 something to report and the main loop reads it. Both feed an
+  *					 event queue, reading it never waits for the user.
+  *					 Must call inputInit() before the other functions,
+  *					 stm32f7_LCD_init() does.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_input.h"
+#include "stm32746g_discovery_lcd.h"
+#include <string.h>
+
+//The button and the touch screen share one EXTI interrupt
+#define INPUT_IRQn EXTI15_10_IRQn
+
+static InputEvent input_queue[INPUT_QUEUE_SIZE];
+static __IO uint32_t queue_write = 0;		//Free running, masked when used
+static __IO uint32_t queue_read = 0;
+static __IO uint32_t queue_dropped = 0;	//Events lost to a full queue
+static __IO uint32_t button_presses = 0;	//Presses not taken by inputButtonPressed() yet
+static Debounce button;
+static uint8_t input_running = 0;
+static uint8_t touch_ready = 0;					//Touch controller found
+static __IO uint8_t touch_irq = 0;			//Set by the interrupt, the controller has a report
+static uint32_t touch_tick;							//Last time the controller was read
+static TS_StateTypeDef touch_state;			//Last report
+
+/**
+  * @brief  Start the debounced state of a switch
+  * @param  db: debounced state
+  * @param  level: level of the switch now, 1 pressed
+  * @param  now: HAL_GetTick()
+  * @retval none
+  */
+
+void debounceInit(Debounce *db, uint8_t level, uint32_t now) {
+	db->state = level;
+	db->tick = now - INPUT_DEBOUNCE_MS;
+}
+
+/**
+  * @brief  Take a new level of the switch, on each edge and whenever the
+  *					level may have settled after one
+  * @param  db: debounced state
+  * @param  level: level of the switch now, 1 pressed
+  * @param  now: HAL_GetTick()
+  * @retval INPUT_BUTTON_PRESS or INPUT_BUTTON_RELEASE when the debounced
+  *					level changed, INPUT_NONE otherwise
+  */
+
+uint8_t debounceUpdate(Debounce *db, uint8_t level, uint32_t now) {
+	if(level == db->state)
+		return INPUT_NONE;
+
+	//Still bouncing from the last accepted edge
+	if(now - db->tick < INPUT_DEBOUNCE_MS)
+		return INPUT_NONE;
+
+	db->state = level;
+	db->tick = now;
+	return level ? INPUT_BUTTON_PRESS : INPUT_BUTTON_RELEASE;
+}
+
+/**
+  * @brief  Add an event to the queue, called with the input interrupt masked
+  *					or from it
+  * @param  type: INPUT_BUTTON_PRESS, ...
+  * @param  ts: touch report for touch events, NULL for the button
+  * @retval none
+  */
+
+static void pushEvent(uint8_t type, const TS_StateTypeDef *ts) {
+	InputEvent *event;
+
+	if(queue_write - queue_read >= INPUT_QUEUE_SIZE) {
+		queue_dropped++;
+		return;
+	}
+	event = &input_queue[queue_write & (INPUT_QUEUE_SIZE - 1)];
+	event->type = type;
+	event->tick = HAL_GetTick();
+	if(ts != NULL) {
+		event->touches = ts->touchDetected;
+		event->x = ts->touchX[0];
+		event->y = ts->touchY[0];
+	} else {
+		event->touches = 0;
+		event->x = 0;
+		event->y = 0;
+	}
+	//The event is written before the reader can see it
+	__DMB();
+	queue_write++;
+}
+
+/**
+  * @brief  Debounce the button level now
+  * @param  now: HAL_GetTick()
+  * @retval none
+  */
+
+static void buttonUpdate(uint32_t now) {
+	uint8_t level = (BSP_PB_GetState(BUTTON_KEY) != RESET);
+
+	switch(debounceUpdate(&button, level, now)) {
+		case INPUT_BUTTON_PRESS:
+			button_presses++;
+			pushEvent(INPUT_BUTTON_PRESS, NULL);
+			break;
+		case INPUT_BUTTON_RELEASE:
+			pushEvent(INPUT_BUTTON_RELEASE, NULL);
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+  * @brief  Read the touch controller and queue what changed
+  * @param  now: HAL_GetTick()
+  * @retval none
+  */
+
+static void touchUpdate(uint32_t now) {
+	TS_StateTypeDef ts;
+	uint8_t type = INPUT_NONE;
+
+	//Cleared first, a report arriving during the read is not lost
+	touch_irq = 0;
+	touch_tick = now;
+	if(BSP_TS_GetState(&ts) != TS_OK)
+		return;
+	BSP_TS_ITClear();
+
+	if(ts.touchDetected && !touch_state.touchDetected) {
+		type = INPUT_TOUCH_DOWN;
+	} else if(!ts.touchDetected && touch_state.touchDetected) {
+		type = INPUT_TOUCH_UP;
+	} else if(ts.touchDetected && (ts.touchDetected != touch_state.touchDetected ||
+	          ts.touchX[0] != touch_state.touchX[0] || ts.touchY[0] != touch_state.touchY[0] ||
+	          ts.touchX[1] != touch_state.touchX[1] || ts.touchY[1] != touch_state.touchY[1])) {
+		type = INPUT_TOUCH_MOVE;
+	}
+	touch_state = ts;
+
+	if(type != INPUT_NONE) {
+		HAL_NVIC_DisableIRQ(INPUT_IRQn);
+		pushEvent(type, &ts);
+		HAL_NVIC_EnableIRQ(INPUT_IRQn);
+	}
+}
+
+/**
+  * @brief  Set the user button and the touch screen to interrupt
+  * @param  none
+  * @retval none
+  */
+
+void inputInit(void) {
+	GPIO_InitTypeDef gpio_init_structure;
+
+	input_running = 0;
+	queue_read = queue_write;
+	queue_dropped = 0;
+	button_presses = 0;
+
+	//The BSP only interrupts on the falling edge, the release, both are wanted
+	BSP_PB_Init(BUTTON_KEY, BUTTON_MODE_EXTI);
+	gpio_init_structure.Pin = KEY_BUTTON_PIN;
+	gpio_init_structure.Mode = GPIO_MODE_IT_RISING_FALLING;
+	gpio_init_structure.Pull = GPIO_NOPULL;
+	gpio_init_structure.Speed = GPIO_SPEED_FAST;
+	HAL_GPIO_Init(KEY_BUTTON_GPIO_PORT, &gpio_init_structure);
+
+	HAL_NVIC_DisableIRQ(INPUT_IRQn);
+	debounceInit(&button, BSP_PB_GetState(BUTTON_KEY) != RESET, HAL_GetTick());
+
+	//Without a touch controller there are only button events
+	memset(&touch_state, 0, sizeof(touch_state));
+	touch_irq = 0;
+	touch_tick = HAL_GetTick();
+	touch_ready = (BSP_TS_Init(RK043FN48H_WIDTH, RK043FN48H_HEIGHT) == TS_OK && BSP_TS_ITConfig() == TS_OK);
+
+	input_running = 1;
+	HAL_NVIC_EnableIRQ(INPUT_IRQn);
+}
+
+/**
+  * @brief  EXTI callback of the button and the touch screen interrupt
+  * @param  GPIO_Pin: pin that interrupted
+  * @retval none
+  */
+
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
+	if(!input_running)
+		return;
+	if(GPIO_Pin == KEY_BUTTON_PIN)
+		buttonUpdate(HAL_GetTick());
+	else if(GPIO_Pin == TS_INT_PIN)
+		touch_irq = 1;
+}
+
+/**
+  * @brief  Finish what the interrupts started, called by the functions that
+  *					read the input. A button level that settled after the bounce
+  *					is taken, the touch controller is read after an interrupt and
+  *					while fingers are down, at most every INPUT_TOUCH_PERIOD_MS.
+  * @param  none
+  * @retval none
+  */
+
+void inputPoll(void) {
+	uint32_t now;
+
+	if(!input_running)
+		return;
+	now = HAL_GetTick();
+
+	HAL_NVIC_DisableIRQ(INPUT_IRQn);
+	if(now - button.tick >= INPUT_DEBOUNCE_MS)
+		buttonUpdate(now);
+	HAL_NVIC_EnableIRQ(INPUT_IRQn);
+
+	if(touch_ready && (touch_irq || touch_state.touchDetected) && now - touch_tick >= INPUT_TOUCH_PERIOD_MS)
+		touchUpdate(now);
+}
+
+/**
+  * @brief  Take the oldest event from the queue, never waits
+  * @param  event: the event
+  * @retval 1 when there was an event, 0 when the queue is empty
+  */
+
+int inputGetEvent(InputEvent *event) {
+	inputPoll();
+	if(queue_read == queue_write)
+		return 0;
+	*event = input_queue[queue_read & (INPUT_QUEUE_SIZE - 1)];
+	queue_read++;
+	return 1;
+}
+
+/**
+  * @brief  Take one press of the user button, the presses are counted apart
+  *					from the queue so the other events can be left there
+  * @param  none
+  * @retval 1 when the button was pressed since the press last taken, 0 otherwise
+  */
+
+int inputButtonPressed(void) {
+	inputPoll();
+	if(button_presses == 0)
+		return 0;
+	HAL_NVIC_DisableIRQ(INPUT_IRQn);
+	button_presses--;
+	HAL_NVIC_EnableIRQ(INPUT_IRQn);
+	return 1;
+}
+
+/**
+  * @brief  Get the last touch report, the controller is not read here
+  * @param  ts: copy of the report
+  * @retval 1 when there is a touch controller, 0 otherwise
+  */
+
+int inputGetTouch(TS_StateTypeDef *ts) {
+	inputPoll();
+	*ts = touch_state;
+	return touch_ready;
+}
+
+/**
+  * @brief  Number of events lost because the queue was full
+  * @param  none
+  * @retval events lost since inputInit()
+  */
+
+uint32_t inputDropped(void) {
+	return queue_dropped;
+}
@@ -0,0 +1,336 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_resample.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides polyphase sample rate conversion by a ratio
+  *					 up/down (L/M) in Q15 and floating point, e.g. 48 kHz to 8 kHz
+  *					 (1/6) or 8 kHz to 48 kHz (6/1) with a proper reconstruction
+  *					 filter instead of a zero-order hold. The low pass runs at up
+  *					 times the input rate but only the outputs that are kept are
+  *					 computed, the zeros stuffed in by the up-sampling are never
+  *					 multiplied.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_resample.h"
+#include <string.h>
+
+#define RESAMPLE_KAISER_BETA  8.0f			//About 80 dB of stop band rejection
+#define RESAMPLE_KAISER_DB    80.0f
+
+/**
+  * @brief  Modified Bessel function of the first kind, order 0
+  * @param  x: argument
+  * @retval I0(x)
+  */
+
+static float32_t besselI0(float32_t x) {
+	float32_t sum = 1.0f, term = 1.0f;
+	uint32_t k;
+
+	for(k = 1; k < 50 && term > 1e-9f*sum; k++) {
+		term *= (x*x)/(4.0f*k*k);
+		sum += term;
+	}
+	return sum;
+}
+
+/**
+  * @brief  Design the prototype low pass, a Kaiser windowed sinc with its
+  *					stop band starting at the lower of the two Nyquist frequencies
+  *					and a gain of up. Too few taps for the ratio move the pass band
+  *					edge down to a quarter of that rate and the stop band above it.
+  * @param  prototype: up*taps coefficients at up times the input rate
+  * @param  up: L
+  * @param  down: M
+  * @param  taps: taps per phase
+  * @retval none
+  */
+
+void resampleDesign(float32_t *prototype, uint32_t up, uint32_t down, uint32_t taps) {
+	uint32_t len = up*taps, j;
+	float32_t nyquist = 0.5f/((up > down) ? up : down);
+	float32_t transition, cutoff, centre, t, r, window_scale;
+
+	//Kaiser's estimate of the transition width for this length and rejection
+	transition = (RESAMPLE_KAISER_DB - 7.95f)/(14.36f*len);
+	cutoff = nyquist - 0.5f*transition;
+	if(cutoff < 0.5f*nyquist)
+		cutoff = 0.5f*nyquist;
+
+	centre = 0.5f*(len - 1);
+	window_scale = 1.0f/besselI0(RESAMPLE_KAISER_BETA);
+	for(j = 0; j < len; j++) {
+		t = j - centre;
+		r = (len > 1) ? t/(centre + 0.5f) : 0.0f;
+		prototype[j] = up*2.0f*cutoff*window_scale*besselI0(RESAMPLE_KAISER_BETA*sqrtf(1.0f - r*r));
+		if(t != 0.0f)
+			prototype[j] *= sinf(2.0f*PI*cutoff*t)/(2.0f*PI*cutoff*t);
+	}
+}
+
+/**
+  * @brief  Check the ratio and the taps of a resampler
+  * @param  up: L
+  * @param  down: M
+  * @param  taps: taps per phase
+  * @retval HAL_OK, HAL_ERROR when out of range
+  */
+
+static HAL_StatusTypeDef checkRatio(uint32_t up, uint32_t down, uint32_t taps) {
+	if(up < 1 || up > RESAMPLE_MAX_FACTOR || down < 1 || down > RESAMPLE_MAX_FACTOR)
+		return HAL_ERROR;
+	if(taps < 1 || taps > RESAMPLE_MAX_TAPS)
+		return HAL_ERROR;
+	return HAL_OK;
+}
+
+/**
+  * @brief  Set up a Q15 resampler and clear its history
+  * @param  rs: resampler
+  * @param  up: L, 1 to RESAMPLE_MAX_FACTOR
+  * @param  down: M, 1 to RESAMPLE_MAX_FACTOR
+  * @param  taps: taps per phase, 1 to RESAMPLE_MAX_TAPS
+  * @param  prototype: up*taps coefficients, e.g. from resampleDesign()
+  * @param  coeffs: buffer of up*taps, filled with the phases in 1.15
+  * @param  state: buffer of 2*taps samples
+  * @retval HAL_OK, HAL_ERROR for a bad ratio or number of taps
+  */
+
+HAL_StatusTypeDef resampleInitQ15(ResampleQ15 *rs, uint32_t up, uint32_t down, uint32_t taps, const float32_t *prototype, int16_t *coeffs, int16_t *state) {
+	uint32_t p, k;
+	float32_t c;
+
+	if(checkRatio(up, down, taps) != HAL_OK)
+		return HAL_ERROR;
+	for(p = 0; p < up; p++) {
+		for(k = 0; k < taps; k++) {
+			c = prototype[p + k*up]*32768.0f;
+			if(c > 32767.0f) c = 32767.0f;
+			if(c < -32768.0f) c = -32768.0f;
+			coeffs[p*taps + k] = (int16_t)lrintf(c);
+		}
+	}
+	rs->up = up;
+	rs->down = down;
+	rs->taps = taps;
+	rs->index = 0;
+	rs->phase = 0;
+	rs->coeffs = coeffs;
+	rs->state = state;
+	memset(state, 0, 2*taps*sizeof(int16_t));
+	return HAL_OK;
+}
+
+/**
+  * @brief  Set up a floating point resampler and clear its history
+  * @param  rs: resampler
+  * @param  up: L, 1 to RESAMPLE_MAX_FACTOR
+  * @param  down: M, 1 to RESAMPLE_MAX_FACTOR
+  * @param  taps: taps per phase, 1 to RESAMPLE_MAX_TAPS
+  * @param  prototype: up*taps coefficients, e.g. from resampleDesign()
+  * @param  coeffs: buffer of up*taps, filled with the phases
+  * @param  state: buffer of 2*taps samples
+  * @retval HAL_OK, HAL_ERROR for a bad ratio or number of taps
+  */
+
+HAL_StatusTypeDef resampleInitF32(ResampleF32 *rs, uint32_t up, uint32_t down, uint32_t taps, const float32_t *prototype, float32_t *coeffs, float32_t *state) {
+	uint32_t p, k;
+
+	if(checkRatio(up, down, taps) != HAL_OK)
+		return HAL_ERROR;
+	for(p = 0; p < up; p++)
+		for(k = 0; k < taps; k++)
+			coeffs[p*taps + k] = prototype[p + k*up];
+	rs->up = up;
+	rs->down = down;
+	rs->taps = taps;
+	rs->index = 0;
+	rs->phase = 0;
+	rs->coeffs = coeffs;
+	rs->state = state;
+	memset(state, 0, 2*taps*sizeof(float32_t));
+	return HAL_OK;
+}
+
+/**
+  * @brief  One Q15 output, the dot product of a phase with the history
+  * @param  h: phase coefficients
+  * @param  w: history, newest first
+  * @param  taps: taps per phase
+  * @retval 1.15 sample
+  */
+
+static int16_t dotQ15(const int16_t *h, const int16_t *w, uint32_t taps) {
+	int64_t acc = 0;
+	uint32_t k = 0;
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+	uint32_t coeff_pair, sample_pair;
+
+	for(; k + 1 < taps; k += 2) {
+		memcpy(&coeff_pair, &h[k], 4);
+		memcpy(&sample_pair, &w[k], 4);
+		acc = (int64_t)__SMLALD(coeff_pair, sample_pair, (uint64_t)acc);
+	}
+#endif
+	for(; k < taps; k++)
+		acc += (int32_t)h[k]*w[k];
+
+	acc = (acc + (1 << 14)) >> 15;
+	if(acc > 32767) return 32767;
+	if(acc < -32768) return -32768;
+	return (int16_t)acc;
+}
+
+/**
+  * @brief  Convert a block of Q15 samples. In place (out is in) works when
+  *					down is up or more and the strides are the same.
+  * @param  rs: resampler
+  * @param  in: input samples
+  * @param  out: room for RESAMPLE_MAX_OUTPUTS(n, up, down) samples
+  * @param  n: number of input samples
+  * @param  in_stride: distance between input samples, 2 for one slot of an
+  *					interleaved stereo buffer
+  * @param  out_stride: distance between output samples
+  * @retval number of output samples
+  */
+
+uint32_t resampleProcessQ15(ResampleQ15 *rs, const int16_t *in, int16_t *out, uint32_t n, uint32_t in_stride, uint32_t out_stride) {
+	uint32_t taps = rs->taps, index = rs->index, phase = rs->phase, count = 0;
+	int16_t x;
+
+	while(n-- > 0) {
+		x = *in;
+		in += in_stride;
+		index = (index == 0) ? taps - 1 : index - 1;
+		rs->state[index] = x;
+		rs->state[index + taps] = x;
+
+		//Every output that falls before the next input
+		while(phase < rs->up) {
+			*out = dotQ15(&rs->coeffs[phase*taps], &rs->state[index], taps);
+			out += out_stride;
+			count++;
+			phase += rs->down;
+		}
+		phase -= rs->up;
+	}
+	rs->index = index;
+	rs->phase = phase;
+	return count;
+}
+
+/**
+  * @brief  Convert a block of floating point samples. In place (out is in)
+  *					works when down is up or more and the strides are the same.
+  * @param  rs: resampler
+  * @param  in: input samples
+  * @param  out: room for RESAMPLE_MAX_OUTPUTS(n, up, down) samples
+  * @param  n: number of input samples
+  * @param  in_stride: distance between input samples
+  * @param  out_stride: distance between output samples
+  * @retval number of output samples
+  */
+
+uint32_t resampleProcessF32(ResampleF32 *rs, const float32_t *in, float32_t *out, uint32_t n, uint32_t in_stride, uint32_t out_stride) {
+	uint32_t taps = rs->taps, index = rs->index, phase = rs->phase, count = 0, k;
+	const float32_t *h, *w;
+	float32_t x, acc0, acc1;
+
+	while(n-- > 0) {
+		x = *in;
+		in += in_stride;
+		index = (index == 0) ? taps - 1 : index - 1;
+		rs->state[index] = x;
+		rs->state[index + taps] = x;
+
+		while(phase < rs->up) {
+			h = &rs->coeffs[phase*taps];
+			w = &rs->state[index];
+			//Two sums so the adds don't wait on each other
+			acc0 = 0.0f;
+			acc1 = 0.0f;
+			for(k = 0; k + 1 < taps; k += 2) {
+				acc0 += h[k]*w[k];
+				acc1 += h[k + 1]*w[k + 1];
+			}
+			if(k < taps)
+				acc0 += h[k]*w[k];
+			*out = acc0 + acc1;
+			out += out_stride;
+			count++;
+			phase += rs->down;
+		}
+		phase -= rs->up;
+	}
+	rs->index = index;
+	rs->phase = phase;
+	return count;
+}
+
+#if RESAMPLE_BENCHMARK
+//Cycle counter, the host build times with a clock instead
+#ifndef RESAMPLE_CYCLES
+#define RESAMPLE_CYCLES()     (DWT->CYCCNT)
+#endif
+
+#define RESAMPLE_BENCH_INPUTS 4800			//Input samples for each entry
+#define RESAMPLE_BENCH_BLOCK  480				//Input samples per call
+
+static const uint16_t bench_up[RESAMPLE_BENCH_RATIOS] = {1, 6, 2, 3};
+static const uint16_t bench_down[RESAMPLE_BENCH_RATIOS] = {6, 1, 3, 2};
+static float32_t bench_prototype[6*RESAMPLE_MAX_TAPS];
+static uint32_t bench_coeffs[6*RESAMPLE_MAX_TAPS];
+static uint32_t bench_state[2*RESAMPLE_MAX_TAPS];
+static uint32_t bench_in[RESAMPLE_BENCH_BLOCK];
+static uint32_t bench_out[RESAMPLE_MAX_OUTPUTS(RESAMPLE_BENCH_BLOCK, 6, 1)];
+
+/**
+  * @brief  Measure the cycles per output sample of both formats for 48 kHz
+  *					to 8 kHz, 8 kHz to 48 kHz, 48 kHz to 32 kHz and 32 kHz to 48 kHz
+  * @param  taps: taps per phase
+  * @param  cycles: cycles per output sample by format (RESAMPLE_Q15,
+  *					RESAMPLE_F32) and ratio, 0 when taps is out of range
+  * @retval none
+  */
+
+void resampleBenchmark(uint32_t taps, float32_t cycles[2][RESAMPLE_BENCH_RATIOS]) {
+	ResampleQ15 rs_q15;
+	ResampleF32 rs_f32;
+	uint32_t format, r, i, start, total, outputs;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	memset(bench_in, 0, sizeof(bench_in));
+	for(r = 0; r < RESAMPLE_BENCH_RATIOS; r++) {
+		cycles[RESAMPLE_Q15][r] = 0.0f;
+		cycles[RESAMPLE_F32][r] = 0.0f;
+		if(checkRatio(bench_up[r], bench_down[r], taps) != HAL_OK)
+			continue;
+		resampleDesign(bench_prototype, bench_up[r], bench_down[r], taps);
+		for(format = 0; format < 2; format++) {
+			if(format == RESAMPLE_Q15)
+				resampleInitQ15(&rs_q15, bench_up[r], bench_down[r], taps, bench_prototype, (int16_t *)bench_coeffs, (int16_t *)bench_state);
+			else
+				resampleInitF32(&rs_f32, bench_up[r], bench_down[r], taps, bench_prototype, (float32_t *)bench_coeffs, (float32_t *)bench_state);
+			total = 0;
+			outputs = 0;
+			for(i = 0; i < RESAMPLE_BENCH_INPUTS; i += RESAMPLE_BENCH_BLOCK) {
+				start = RESAMPLE_CYCLES();
+				if(format == RESAMPLE_Q15)
+					outputs += resampleProcessQ15(&rs_q15, (int16_t *)bench_in, (int16_t *)bench_out, RESAMPLE_BENCH_BLOCK, 1, 1);
+				else
+					outputs += resampleProcessF32(&rs_f32, (float32_t *)bench_in, (float32_t *)bench_out, RESAMPLE_BENCH_BLOCK, 1, 1);
+				total += RESAMPLE_CYCLES() - start;
+			}
+			cycles[format][r] = (float32_t)total/outputs;
+		}
+	}
+}
+#endif /* RESAMPLE_BENCHMARK */
@@ -0,0 +1,215 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_spectrum.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides a streaming spectrum estimate for the
+  *					 spectrum graphs. The frame length and the overlap do not depend
+  *					 on the DMA block size, each hop runs one windowed real FFT
+  *					 (stm32f7_fft.c) and the magnitudes are averaged with
+  *					 averageAdd() (stm32f7_persist.c), calibrated in dBFS.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_spectrum.h"
+#include "stm32f7_decibel.h"
+#include <string.h>
+
+#define SPECTRUM_TERMS        5
+
+//Cosine terms of the windows, w[i] = a0 - a1 cos(2 pi i/N) + a2 cos(4 pi i/N) - ...
+static const float32_t window_terms[3][SPECTRUM_TERMS] = {
+	{0.5f, 0.5f, 0.0f, 0.0f, 0.0f},
+	{0.35875f, 0.48829f, 0.14128f, 0.01168f, 0.0f},
+	{0.21557895f, 0.41663158f, 0.277263158f, 0.083578947f, 0.006947368f},
+};
+
+/**
+  * @brief  Set up a spectrum estimate
+  * @param  sp: spectrum
+  * @param  frame_len: points per FFT, a power of 2 from SPECTRUM_MIN_SIZE to
+  *					SPECTRUM_MAX_SIZE, the estimate has frame_len/2 bins
+  * @param  hop: new samples per FFT, 1 to frame_len, frame_len/2 for 50 %
+  *					overlap
+  * @param  window: SPECTRUM_HANN, SPECTRUM_BLACKMAN or SPECTRUM_FLATTOP
+  * @param  average_mode: AVERAGE_LINEAR for Welch's method, a new estimate
+  *					every frames FFTs, or AVERAGE_EXPONENTIAL, a new estimate every
+  *					FFT
+  * @param  frames: FFTs per estimate or time constant in FFTs
+  * @param  memory: SPECTRUM_MEMORY(frame_len) floats
+  * @retval HAL_OK, HAL_ERROR for a bad frame length, hop or window
+  */
+
+HAL_StatusTypeDef spectrumInit(Spectrum *sp, uint32_t frame_len, uint32_t hop, uint8_t window, uint8_t average_mode, uint32_t frames, float32_t *memory) {
+	const float32_t *terms = window_terms[window];
+	float32_t sum = 0, sum_squares = 0, w, scale;
+	uint32_t i, k;
+
+	if(frame_len < SPECTRUM_MIN_SIZE || frame_len > SPECTRUM_MAX_SIZE || (frame_len & (frame_len - 1)) != 0)
+		return HAL_ERROR;
+	if(hop < 1 || hop > frame_len || window > SPECTRUM_FLATTOP)
+		return HAL_ERROR;
+	fftInit(&sp->fft, frame_len);
+
+	sp->frame_len = frame_len;
+	sp->hop = hop;
+	sp->window = memory;
+	sp->history = memory + frame_len;
+	sp->work = memory + 2*frame_len;
+
+	//Periodic windows, the FFT sees them repeat every frame_len samples
+	for(i = 0; i < frame_len; i++) {
+		w = terms[0];
+		for(k = 1; k < SPECTRUM_TERMS; k++)
+			w += ((k & 1) ? -terms[k] : terms[k])*cosf(2.0f*PI*k*i/frame_len);
+		sp->window[i] = w;
+		sum += w;
+		sum_squares += w*w;
+	}
+
+	//A sine of amplitude A peaks at A sum/2 in its bin
+	scale = 2.0f/sum;
+	for(i = 0; i < frame_len; i++)
+		sp->window[i] *= scale;
+	sp->enbw = frame_len*sum_squares/(sum*sum);
+
+	averageInit(&sp->average, frame_len/2, average_mode, frames);
+	spectrumReset(sp);
+	return HAL_OK;
+}
+
+/**
+  * @brief  Clear the input history and the average
+  * @param  sp: spectrum
+  * @retval none
+  */
+
+void spectrumReset(Spectrum *sp) {
+	memset(sp->history, 0, sp->frame_len*sizeof(float32_t));
+	sp->index = 0;
+	//The first FFT waits for a full frame
+	sp->due = sp->frame_len;
+	averageInit(&sp->average, sp->average.num_bins, sp->average.mode, sp->average.frames);
+}
+
+/**
+  * @brief  Window and transform the last frame_len samples and add the
+  *					magnitudes to the average
+  * @param  sp: spectrum
+  * @param  out: frame_len/2 averaged magnitudes, only written when 1 is returned
+  * @retval 1 when out holds a new estimate, 0 otherwise
+  */
+
+static int transformFrame(Spectrum *sp, float32_t *out) {
+	uint32_t n = sp->frame_len, first = n - sp->index, i;
+	const float32_t *history = sp->history, *window = sp->window;
+	float32_t *work = sp->work;
+
+	//The oldest sample is at index
+	for(i = 0; i < first; i++)
+		work[i] = history[sp->index + i]*window[i];
+	for(; i < n; i++)
+		work[i] = history[i - first]*window[i];
+
+	fftProcess(&sp->fft, work, work, FFT_FORWARD);
+	fftMagnitude(work, work, n);
+	//DC has no image at negative frequencies to fold in
+	work[0] *= 0.5f;
+	return averageAdd(&sp->average, work, out);
+}
+
+/**
+  * @brief  Move on after count samples went into the history
+  * @param  sp: spectrum
+  * @param  count: samples, up to sp->due
+  * @param  out: as for transformFrame()
+  * @retval 1 when out holds a new estimate, 0 otherwise
+  */
+
+static int advance(Spectrum *sp, uint32_t count, float32_t *out) {
+	sp->index = (sp->index + count) & (sp->frame_len - 1);
+	sp->due -= count;
+	if(sp->due > 0)
+		return 0;
+	sp->due = sp->hop;
+	return transformFrame(sp, out);
+}
+
+/**
+  * @brief  Add a block of Q15 samples, e.g. one slot of the DMA buffer
+  * @param  sp: spectrum
+  * @param  data: samples
+  * @param  n: number of samples, any size
+  * @param  stride: distance between samples, 2 for one slot of the
+  *					interleaved buffer
+  * @param  out: frame_len/2 magnitudes, 1 for a full scale sine, only written
+  *					when 1 is returned. When a block completes more than one
+  *					estimate it holds the last.
+  * @retval 1 when out holds a new estimate, 0 otherwise
+  */
+
+int spectrumAddQ15(Spectrum *sp, const int16_t *data, uint32_t n, uint32_t stride, float32_t *out) {
+	float32_t *history;
+	uint32_t count, i;
+	int ready = 0;
+
+	while(n > 0) {
+		//Up to the next FFT or the end of the history, whichever comes first
+		count = sp->frame_len - sp->index;
+		if(count > sp->due) count = sp->due;
+		if(count > n) count = n;
+		history = &sp->history[sp->index];
+		for(i = 0; i < count; i++) {
+			history[i] = (float32_t)*data*(1.0f/32768.0f);
+			data += stride;
+		}
+		n -= count;
+		ready |= advance(sp, count, out);
+	}
+	return ready;
+}
+
+/**
+  * @brief  Add a block of floating point samples, full scale is 1.0
+  * @param  sp: spectrum
+  * @param  data: samples
+  * @param  n: number of samples, any size
+  * @param  stride: distance between samples
+  * @param  out: as for spectrumAddQ15()
+  * @retval 1 when out holds a new estimate, 0 otherwise
+  */
+
+int spectrumAddF32(Spectrum *sp, const float32_t *data, uint32_t n, uint32_t stride, float32_t *out) {
+	float32_t *history;
+	uint32_t count, i;
+	int ready = 0;
+
+	while(n > 0) {
+		count = sp->frame_len - sp->index;
+		if(count > sp->due) count = sp->due;
+		if(count > n) count = n;
+		history = &sp->history[sp->index];
+		for(i = 0; i < count; i++) {
+			history[i] = *data;
+			data += stride;
+		}
+		n -= count;
+		ready |= advance(sp, count, out);
+	}
+	return ready;
+}
+
+/**
+  * @brief  Magnitudes from spectrumAdd...() in dBFS, SPECTRUM_FLOOR_DB for
+  *					empty bins. The noise density in dBFS/Hz is the level minus
+  *					10*log10(sp->enbw*fs/frame_len).
+  * @param  magnitude: n magnitudes
+  * @param  dbfs: n levels, may be magnitude
+  * @param  n: number of bins
+  * @retval none
+  */
+
+void spectrumDbfs(const float32_t *magnitude, float32_t *dbfs, uint32_t n) {
+	decibelFromMagnitude(magnitude, dbfs, n, SPECTRUM_FLOOR_DB);
+}
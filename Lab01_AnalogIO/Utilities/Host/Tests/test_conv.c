@@ -0,0 +1,126 @@
+/**
+  ******************************************************************************
+  * @file    test_conv.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   The partitioned convolver of stm32f7_conv.c against direct
+  *					 convolution in double precision for 256 to 16384 taps, the
+  *					 direct FIR filter alongside, the stereo Q15 path, and the cost
+  *					 per sample and latency of both from convBenchmark().
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_conv.h"
+#include "stm32f7_fir.h"
+
+#define NUM_SAMPLES 20480
+#define BLOCK       256
+#define FS          48000
+
+static float32_t x[NUM_SAMPLES], y_conv[NUM_SAMPLES], y_fir[NUM_SAMPLES], h[FIR_MAX_TAPS], fir_state[2*FIR_MAX_TAPS];
+static double reference[NUM_SAMPLES];
+static int16_t stereo[2*NUM_SAMPLES];
+
+/**
+  * @brief  SNR of an output against the reference
+  */
+static double snr(const float32_t *y) {
+	double signal = 0, error = 0;
+	uint32_t i;
+
+	for(i = 0; i < NUM_SAMPLES; i++) {
+		signal += reference[i]*reference[i];
+		error += (y[i] - reference[i])*(y[i] - reference[i]);
+	}
+	return hostSnr(signal, error);
+}
+
+int main(void) {
+	static const uint32_t blocks[] = {64, 256, 1024};
+	static float32_t cycles[3][2][CONV_BENCH_TAPS], run[2][CONV_BENCH_TAPS];
+	float32_t *memory = (float32_t *)CONV_SDRAM_BUFFER;
+	Convolver conv;
+	FirF32 fir;
+	uint32_t t, taps, i, k, b, m, r, wrong;
+	double snr_conv, snr_fir, speedup;
+	int cheaper;
+
+	hostTestBegin("test_conv");
+
+	HOST_CHECK(convInit(&conv, 24, 100, memory) != HAL_OK && convInit(&conv, CONV_MIN_BLOCK/2, 100, memory) != HAL_OK &&
+						 convInit(&conv, 2*CONV_MAX_BLOCK, 100, memory) != HAL_OK, "convInit with a block that is not a power of 2 in range");
+
+	//Noise through decaying random responses, the taps of convBenchmark()
+	for(i = 0; i < NUM_SAMPLES; i++)
+		x[i] = 0.5f*hostUniform();
+	for(t = 0, taps = 256; t < CONV_BENCH_TAPS; t++, taps *= 2) {
+		for(k = 0; k < taps; k++)
+			h[k] = hostUniform()*expf(-4.0f*k/taps);
+		for(i = 0; i < NUM_SAMPLES; i++) {
+			reference[i] = 0;
+			for(k = 0; k < taps && k <= i; k++)
+				reference[i] += (double)h[k]*x[i - k];
+		}
+
+		convInit(&conv, BLOCK, taps, memory);
+		convSetResponse(&conv, h, taps);
+		for(i = 0; i < NUM_SAMPLES; i += BLOCK)
+			convProcess(&conv, &x[i], &y_conv[i], 1);
+		firInitF32(&fir, h, taps, fir_state);
+		firProcessF32(&fir, x, y_fir, NUM_SAMPLES, 1);
+
+		//Both have the output of a block at the end of the call that takes it, no extra delay
+		snr_conv = snr(y_conv);
+		snr_fir = snr(y_fir);
+		HOST_CHECK(snr_conv > 110 && snr_fir > 110, "%u taps: SNR partitioned %.1f dB, direct %.1f dB", taps, snr_conv, snr_fir);
+		if(hostBenchmark())
+			printf("%5u taps: SNR partitioned %.1f dB, direct %.1f dB\n", taps, snr_conv, snr_fir);
+	}
+
+	//Q15 in place on one slot of a stereo buffer, half the input and a quarter 299 samples later
+	for(k = 0; k < 300; k++)
+		h[k] = (k == 0) ? 0.5f : (k == 299) ? 0.25f : 0;
+	convInit(&conv, 64, 300, memory);
+	convSetResponse(&conv, h, 300);
+	for(i = 0; i < NUM_SAMPLES; i++) {
+		stereo[2*i] = (int16_t)(x[i]*40000);
+		stereo[2*i + 1] = 777;
+		reference[i] = 0.5*stereo[2*i] + ((i >= 299) ? 0.25*stereo[2*(i - 299)] : 0);
+	}
+	for(i = 0; i < NUM_SAMPLES; i += 64)
+		convProcessQ15(&conv, &stereo[2*i], &stereo[2*i], 2);
+	for(i = 0, wrong = 0; i < NUM_SAMPLES; i++)
+		wrong += (stereo[2*i + 1] != 777 || fabs(stereo[2*i] - reference[i]) > 1);
+	HOST_CHECK(wrong == 0, "Q15 stereo: %u samples wrong", wrong);
+
+	//The direct filter grows with the taps, the convolver with their logarithm, the best of 3 runs
+	for(b = 0; b < 3; b++) {
+		convBenchmark(blocks[b], cycles[b]);
+		for(r = 1; r < 3; r++) {
+			convBenchmark(blocks[b], run);
+			for(m = 0; m < 2; m++)
+				for(t = 0; t < CONV_BENCH_TAPS; t++)
+					cycles[b][m][t] = fminf(cycles[b][m][t], run[m][t]);
+		}
+	}
+	for(b = 0, cheaper = 1; b < 3; b++) {
+		cheaper &= (cycles[b][CONV_DIRECT][CONV_BENCH_TAPS - 1] > 20*cycles[b][CONV_DIRECT][0]);
+		cheaper &= (cycles[b][CONV_PARTITIONED][CONV_BENCH_TAPS - 1] < cycles[b][CONV_DIRECT][CONV_BENCH_TAPS - 1]/4);
+	}
+	HOST_CHECK(cheaper, "convBenchmark: 16384 taps partitioned not 4 times cheaper than direct");
+	if(hostBenchmark()) {
+		printf("convBenchmark, cycles per sample\n");
+		for(b = 0; b < 3; b++) {
+			printf("block %4u, latency %.2f ms at %u Hz\n", blocks[b], 1000.0f*blocks[b]/FS, FS);
+			for(t = 0, taps = 256; t < CONV_BENCH_TAPS; t++, taps *= 2) {
+				speedup = cycles[b][CONV_DIRECT][t]/cycles[b][CONV_PARTITIONED][t];
+				printf("  %5u taps  direct %9.1f  partitioned %7.1f  x%.1f\n", taps,
+							 cycles[b][CONV_DIRECT][t], cycles[b][CONV_PARTITIONED][t], speedup);
+			}
+		}
+	}
+
+	return hostTestEnd();
+}
@@ -0,0 +1,81 @@
+/**
+  ******************************************************************************
+  * @file    test_decibel.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   The decibel conversions of stm32f7_decibel.c against log10() in
+  *					 double precision over 36 decades, zeros, denormals and the
+  *					 floor, the cost against the C library from decibelBenchmark(),
+  *					 and a static plotLogFFT() leaving the buffer alone once drawn.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_decibel.h"
+#include "stm32f7_display.h"
+#include <string.h>
+
+#define NUM_VALUES  36000
+#define FLOOR_DB    -200.0f
+#define MAX_ERROR   0.004f								//DECIBEL_ORDER 3
+
+static float32_t value[NUM_VALUES], db[NUM_VALUES], magnitude[512];
+
+int main(void) {
+	static const float32_t special[6] = {0.0f, -0.0f, 1e-40f, 1e-12f, -0.5f, 1.0f};
+	static const float32_t expected[6] = {FLOOR_DB, FLOOR_DB, FLOOR_DB, FLOOR_DB, -6.0206f, 0.0f};
+	float32_t cycles[2], run[2], max_error, error_magnitude = 0, error_power = 0;
+	uint32_t i, wrong;
+	HostLcdStats before;
+	uint8_t *frame = (uint8_t *)SDRAM_DEVICE_ADDR;
+	static uint8_t drawn[4*480*272];
+
+	hostTestBegin("test_decibel");
+
+	//Every mantissa gets the same polynomial, 1000 values a decade from 1e-18 to 1e18
+	for(i = 0; i < NUM_VALUES; i++)
+		value[i] = (float32_t)pow(10, -18 + i/1000.0);
+	decibelFromMagnitude(value, db, NUM_VALUES, FLOOR_DB - 200);
+	for(i = 0; i < NUM_VALUES; i++)
+		error_magnitude = fmaxf(error_magnitude, fabsf(db[i] - (float32_t)(20*log10(value[i]))));
+	decibelFromPower(value, value, NUM_VALUES, FLOOR_DB - 200);
+	for(i = 0; i < NUM_VALUES; i++)
+		error_power = fmaxf(error_power, fabsf(value[i] - (float32_t)(10*log10(pow(10, -18 + i/1000.0)))));
+	HOST_CHECK(error_magnitude < MAX_ERROR && error_power < MAX_ERROR/2, "error magnitude %.5f dB, power %.5f dB", error_magnitude, error_power);
+
+	//Zeros, denormals and anything under the floor give the floor, the sign is ignored
+	decibelFromMagnitude(special, db, 6, FLOOR_DB);
+	for(i = 0, wrong = 0; i < 6; i++)
+		wrong += (fabsf(db[i] - expected[i]) > MAX_ERROR);
+	HOST_CHECK(wrong == 0, "zeros, denormals and the floor: %.4f %.4f %.4f %.4f %.4f %.4f",
+						 db[0], db[1], db[2], db[3], db[4], db[5]);
+
+	//The best of 9 runs
+	decibelBenchmark(cycles, &max_error);
+	for(i = 1; i < 9; i++) {
+		decibelBenchmark(run, &max_error);
+		cycles[0] = fminf(cycles[0], run[0]);
+		cycles[1] = fminf(cycles[1], run[1]);
+	}
+	HOST_CHECK(max_error < MAX_ERROR, "decibelBenchmark: error %.5f dB", max_error);
+	HOST_CHECK(cycles[0] > 0 && cycles[0] < cycles[1], "decibelBenchmark: %.1f cycles a bin, not under %.1f for 20*log10()",
+						 cycles[0], cycles[1]);
+	if(hostBenchmark())
+		printf("decibelBenchmark: %.2f cycles a bin, 20*log10() %.2f, largest error %.5f dB\n", cycles[0], cycles[1], max_error);
+
+	//A static graph is drawn once, the calls after it don't read the magnitudes
+	hostPressButton(1);
+	stm32f7_LCD_init(8000, "Decibel", GRAPH);
+	for(i = 0; i < 512; i++)
+		magnitude[i] = 1000.0f/(1 + i);
+	plotLogFFT(magnitude, 512, STATIC);
+	memcpy(drawn, frame, sizeof(drawn));
+	before = hostLcdStats;
+	plotLogFFT(NULL, 512, STATIC);
+	HOST_CHECK(memcmp(drawn, frame, sizeof(drawn)) == 0 && hostLcdStats.cpu_pixels == before.cpu_pixels,
+						 "a static plotLogFFT() drawn again");
+
+	HOST_CHECK(hostLcdStats.out_of_range == 0, "%llu writes outside the SDRAM", (unsigned long long)hostLcdStats.out_of_range);
+	return hostTestEnd();
+}
@@ -0,0 +1,143 @@
+/**
+  ******************************************************************************
+  * @file    test_envelope.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   envelopeAddQ15() and envelopeAddF32() against a brute force min
+  *					 and max of every graph column, for buffers shorter and longer
+  *					 than the graph added whole or in chunks, and their speed.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_envelope.h"
+
+#define MAX_SAMPLES 80000
+
+static int16_t samples_q15[MAX_SAMPLES];
+static float32_t samples_f32[MAX_SAMPLES];
+static float32_t column_min[GRAPH_WIDTH], column_max[GRAPH_WIDTH];
+static uint8_t column_used[GRAPH_WIDTH];
+static Envelope env;
+
+/**
+  * @brief  Min and max of every column, one sample at a time
+  */
+static void bruteForce(uint32_t num_samples) {
+	uint32_t i, column;
+
+	memset(column_used, 0, sizeof(column_used));
+	for(i = 0; i < num_samples; i++) {
+		column = (uint64_t)i*GRAPH_WIDTH/num_samples;
+		if(!column_used[column] || samples_f32[i] < column_min[column]) column_min[column] = samples_f32[i];
+		if(!column_used[column] || samples_f32[i] > column_max[column]) column_max[column] = samples_f32[i];
+		column_used[column] = 1;
+	}
+}
+
+/**
+  * @brief  Compare the envelope with the brute force columns
+  * @retval number of wrong columns
+  */
+static uint32_t compare(void) {
+	uint32_t column, wrong = 0;
+
+	for(column = 0; column < GRAPH_WIDTH; column++) {
+		if(column_used[column])
+			wrong += (env.min[column] != column_min[column] || env.max[column] != column_max[column]);
+		else
+			wrong += !(env.min[column] > env.max[column]);
+	}
+	return wrong;
+}
+
+/**
+  * @brief  Add the buffer in chunks of 1 to max_chunk samples
+  */
+static void addChunks(uint32_t num_samples, uint32_t max_chunk, int q15) {
+	uint32_t i = 0, n;
+
+	envelopeInit(&env, num_samples);
+	while(i < num_samples) {
+		n = 1 + hostRandom() % max_chunk;
+		if(n > num_samples - i) n = num_samples - i;
+		if(q15)
+			envelopeAddQ15(&env, &samples_q15[i], n);
+		else
+			envelopeAddF32(&env, &samples_f32[i], n);
+		i += n;
+	}
+}
+
+int main(void) {
+	static const uint32_t sizes[] = {1, 2, 5, 100, 255, 256, 257, 511, 512, 1000, 4097, 80000};
+	static const uint32_t chunks[] = {1, 7, 64, 1000};
+	uint32_t s, c, i, n, wrong, runs;
+	float32_t min, max, low, high;
+	uint64_t start;
+
+	hostTestBegin("test_envelope");
+	for(s = 0; s < sizeof(sizes)/sizeof(sizes[0]); s++) {
+		n = sizes[s];
+		for(i = 0; i < n; i++) {
+			samples_q15[i] = (int16_t)hostRandom();
+			samples_f32[i] = samples_q15[i];
+		}
+		bruteForce(n);
+
+		envelopeInit(&env, n);
+		envelopeAddQ15(&env, samples_q15, n);
+		wrong = compare();
+		HOST_CHECK(wrong == 0, "Q15, %u samples at once: %u columns wrong", n, wrong);
+		HOST_CHECK(envelopeComplete(&env), "Q15, %u samples: not complete", n);
+
+		envelopeRange(&env, &min, &max);
+		for(i = 1, low = high = samples_f32[0]; i < n; i++) {
+			if(samples_f32[i] < low) low = samples_f32[i];
+			if(samples_f32[i] > high) high = samples_f32[i];
+		}
+		HOST_CHECK(min == low && max == high, "%u samples: range %g to %g, not %g to %g", n, min, max, low, high);
+
+		envelopeInit(&env, n);
+		envelopeAddF32(&env, samples_f32, n);
+		wrong = compare();
+		HOST_CHECK(wrong == 0, "F32, %u samples at once: %u columns wrong", n, wrong);
+
+		for(c = 0; c < sizeof(chunks)/sizeof(chunks[0]); c++) {
+			addChunks(n, chunks[c], 1);
+			wrong = compare();
+			HOST_CHECK(wrong == 0, "Q15, %u samples in chunks up to %u: %u columns wrong", n, chunks[c], wrong);
+			HOST_CHECK(envelopeComplete(&env), "Q15, %u samples in chunks: not complete", n);
+			addChunks(n, chunks[c], 0);
+			wrong = compare();
+			HOST_CHECK(wrong == 0, "F32, %u samples in chunks up to %u: %u columns wrong", n, chunks[c], wrong);
+		}
+	}
+
+	//Not complete until the last sample is in
+	envelopeInit(&env, 1000);
+	envelopeAddQ15(&env, samples_q15, 999);
+	HOST_CHECK(!envelopeComplete(&env), "complete after 999 of 1000 samples");
+
+	if(hostBenchmark()) {
+		runs = 200;
+		start = hostLcdTimeUs();
+		for(i = 0; i < runs; i++) {
+			envelopeInit(&env, MAX_SAMPLES);
+			envelopeAddQ15(&env, samples_q15, MAX_SAMPLES);
+		}
+		printf("envelopeAddQ15 %u samples: %.2f ns/sample\n", MAX_SAMPLES, 1000.0*(hostLcdTimeUs() - start)/runs/MAX_SAMPLES);
+		start = hostLcdTimeUs();
+		for(i = 0; i < runs; i++) {
+			envelopeInit(&env, MAX_SAMPLES);
+			envelopeAddF32(&env, samples_f32, MAX_SAMPLES);
+		}
+		printf("envelopeAddF32 %u samples: %.2f ns/sample\n", MAX_SAMPLES, 1000.0*(hostLcdTimeUs() - start)/runs/MAX_SAMPLES);
+		start = hostLcdTimeUs();
+		for(i = 0; i < runs; i++)
+			bruteForce(MAX_SAMPLES);
+		printf("brute force   %u samples: %.2f ns/sample\n", MAX_SAMPLES, 1000.0*(hostLcdTimeUs() - start)/runs/MAX_SAMPLES);
+	}
+	return hostTestEnd();
+}
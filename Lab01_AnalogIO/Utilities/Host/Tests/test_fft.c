@@ -0,0 +1,251 @@
+/**
+  ******************************************************************************
+  * @file    test_fft.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   The real FFT of stm32f7_fft.c against a DFT in double precision
+  *					 for every length from 32 to 4096 points: every bin of the
+  *					 packed spectrum, the inverse of an exact spectrum, in place and
+  *					 out of place, the magnitudes and powers, and the cycles and SNR
+  *					 from fftBenchmark().
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_fft.h"
+#include <string.h>
+
+static float32_t signal[FFT_MAX_SIZE], spectrum[FFT_MAX_SIZE], in_place[FFT_MAX_SIZE], back[FFT_MAX_SIZE];
+static float32_t magnitude[FFT_MAX_SIZE/2], power[FFT_MAX_SIZE/2];
+static double re[FFT_MAX_SIZE/2 + 1], im[FFT_MAX_SIZE/2 + 1], cosine[FFT_MAX_SIZE], sine[FFT_MAX_SIZE], fixed[FFT_MAX_SIZE];
+static int32_t q31[FFT_MAX_SIZE], words[FFT_MAX_SIZE/2];
+
+/**
+  * @brief  Bins 0 to len/2 of the DFT of signal, the angles from a table of
+  *					len steps so every one is exact
+  */
+static void dft(uint32_t len) {
+	uint32_t k, n;
+
+	for(n = 0; n < len; n++) {
+		cosine[n] = cos(2*M_PI*n/len);
+		sine[n] = sin(2*M_PI*n/len);
+	}
+	for(k = 0; k <= len/2; k++) {
+		re[k] = im[k] = 0;
+		for(n = 0; n < len; n++) {
+			re[k] += signal[n]*cosine[(k*n) % len];
+			im[k] -= signal[n]*sine[(k*n) % len];
+		}
+	}
+}
+
+/**
+  * @brief  Real and imaginary parts of bin k of a packed spectrum
+  */
+static void bin(const float32_t *packed, uint32_t len, uint32_t k, double *r, double *i) {
+	if(k == 0) {
+		*r = packed[0];
+		*i = 0;
+	} else if(k == len/2) {
+		*r = packed[1];
+		*i = 0;
+	} else {
+		*r = packed[2*k];
+		*i = packed[2*k + 1];
+	}
+}
+
+/**
+  * @brief  SNR of a packed spectrum in double against the DFT in re and im
+  */
+static double spectrumSnr(const double *packed, uint32_t len) {
+	double bins = 0, error = 0, r, j;
+	uint32_t k;
+
+	for(k = 0; k <= len/2; k++) {
+		r = (k == len/2) ? packed[1] : packed[2*k];
+		j = (k == 0 || k == len/2) ? 0 : packed[2*k + 1];
+		bins += re[k]*re[k] + im[k]*im[k];
+		error += (r - re[k])*(r - re[k]) + (j - im[k])*(j - im[k]);
+	}
+	return hostSnr(bins, error);
+}
+
+int main(void) {
+	static const char *directions[2] = {"forward", "inverse"}, *formats[2] = {"Q15", "Q31"};
+	float32_t cycles[2][FFT_BENCH_SIZES], run[2][FFT_BENCH_SIZES], snr[FFT_BENCH_SIZES], run_snr[FFT_BENCH_SIZES];
+	float32_t cycles_fixed[2][FFT_BENCH_SIZES], run_fixed[2][FFT_BENCH_SIZES], snr_fixed[2][2][FFT_BENCH_SIZES];
+	float32_t run_snr_fixed[2][2][FFT_BENCH_SIZES];
+	RealFft fft;
+	int16_t *q15 = (int16_t *)words;							//Word aligned
+	uint32_t len, k, n, s, d, i, f, scaling, quiet, bits;
+	int32_t exponent;
+	double r, j, bins, error, samples, error_inverse, snr_forward, snr_inverse, error_magnitude, level[2][2], snr_float;
+	int same, accurate, growing, halved;
+
+	hostTestBegin("test_fft");
+
+	HOST_CHECK(fftInit(&fft, FFT_MIN_SIZE/2) == HAL_ERROR && fftInit(&fft, 2*FFT_MAX_SIZE) == HAL_ERROR &&
+						 fftInit(&fft, 96) == HAL_ERROR, "fftInit with a length that is not a power of 2 in range");
+
+	for(len = FFT_MIN_SIZE; len <= FFT_MAX_SIZE; len *= 2) {
+		fftInit(&fft, len);
+		for(n = 0; n < len; n++)
+			signal[n] = 0.5f*hostUniform();
+		dft(len);
+
+		//Every bin of the forward transform, out of place then in place
+		fftProcess(&fft, signal, spectrum, FFT_FORWARD);
+		memcpy(in_place, signal, len*sizeof(float32_t));
+		fftProcess(&fft, in_place, in_place, FFT_FORWARD);
+		same = (memcmp(in_place, spectrum, len*sizeof(float32_t)) == 0);
+		for(k = 0, bins = error = 0; k <= len/2; k++) {
+			bin(spectrum, len, k, &r, &j);
+			bins += re[k]*re[k] + im[k]*im[k];
+			error += (r - re[k])*(r - re[k]) + (j - im[k])*(j - im[k]);
+		}
+		snr_forward = hostSnr(bins, error);
+
+		//The inverse of the exact spectrum is the signal
+		spectrum[0] = (float32_t)re[0];
+		spectrum[1] = (float32_t)re[len/2];
+		for(k = 1; k < len/2; k++) {
+			spectrum[2*k] = (float32_t)re[k];
+			spectrum[2*k + 1] = (float32_t)im[k];
+		}
+		fftProcess(&fft, spectrum, back, FFT_INVERSE);
+		for(n = 0, samples = error_inverse = 0; n < len; n++) {
+			samples += signal[n]*signal[n];
+			error_inverse += (back[n] - signal[n])*(back[n] - signal[n]);
+		}
+		snr_inverse = hostSnr(samples, error_inverse);
+		HOST_CHECK(same, "%u points: in place differs from out of place", len);
+		HOST_CHECK(snr_forward > 130 && snr_inverse > 130, "%u points: SNR forward %.1f dB, inverse %.1f dB", len, snr_forward, snr_inverse);
+		if(hostBenchmark())
+			printf("%4u points: SNR forward %.1f dB, inverse %.1f dB\n", len, snr_forward, snr_inverse);
+
+		//Magnitudes and powers of bins 0 to len/2 - 1, bin 0 taking the real part alone
+		fftMagnitude(spectrum, magnitude, len);
+		fftPower(spectrum, power, len);
+		for(k = 0, error_magnitude = 0; k < len/2; k++) {
+			bin(spectrum, len, k, &r, &j);
+			error_magnitude = fmax(error_magnitude, fabs(magnitude[k] - sqrt(r*r + j*j))/(1 + sqrt(r*r + j*j)));
+			error_magnitude = fmax(error_magnitude, fabs(power[k] - (r*r + j*j))/(1 + r*r + j*j));
+		}
+		HOST_CHECK(error_magnitude < 1e-5, "%u points: magnitude or power off by %.2g", len, error_magnitude);
+	}
+
+	//The best of 5 runs, the SNR is the same every time
+	fftBenchmark(cycles, snr);
+	for(i = 1; i < 5; i++) {
+		fftBenchmark(run, run_snr);
+		for(d = 0; d < 2; d++)
+			for(s = 0; s < FFT_BENCH_SIZES; s++)
+				cycles[d][s] = fminf(cycles[d][s], run[d][s]);
+	}
+	for(s = 0, accurate = 1, growing = 1; s < FFT_BENCH_SIZES; s++) {
+		accurate &= (snr[s] > 130);
+		for(d = 0; d < 2; d++)
+			growing &= (cycles[d][s] > 0 && (s == 0 || cycles[d][s] > cycles[d][s - 1]));
+	}
+	HOST_CHECK(accurate, "fftBenchmark: SNR under 130 dB");
+	HOST_CHECK(growing && cycles[FFT_FORWARD][FFT_BENCH_SIZES - 1] > 30*cycles[FFT_FORWARD][0],
+						 "fftBenchmark: 4096 points not 30 times the cost of 64");
+	if(hostBenchmark()) {
+		printf("fftBenchmark, cycles per transform\npoints");
+		for(s = 0; s < FFT_BENCH_SIZES; s++)
+			printf(" %9u", 64u << s);
+		printf("\n");
+		for(d = 0; d < 2; d++) {
+			printf("%-7s", directions[d]);
+			for(s = 0; s < FFT_BENCH_SIZES; s++)
+				printf(" %9.0f", cycles[d][s]);
+			printf("\n");
+		}
+		printf("SNR dB ");
+		for(s = 0; s < FFT_BENCH_SIZES; s++)
+			printf(" %9.1f", snr[s]);
+		printf("\n");
+	}
+
+	//Block floating point keeps the low bits of a quiet signal where halving every stage drops them,
+	//and neither overflows at full scale. Q31 gets the Q15 samples in its top half
+	for(len = FFT_MIN_SIZE, bits = 5; len <= FFT_MAX_SIZE; len *= 2, bits++) {
+		fftInit(&fft, len);
+		for(quiet = 0; quiet < 2; quiet++) {
+			for(n = 0; n < len; n++)
+				signal[n] = lrintf((quiet ? 127 : 32767)*hostUniform())/32768.0f;
+			dft(len);
+			fftProcess(&fft, signal, spectrum, FFT_FORWARD);
+			for(n = 0; n < len; n++)
+				fixed[n] = spectrum[n];
+			snr_float = spectrumSnr(fixed, len);
+			for(scaling = FFT_SCALE_BLOCK, halved = 1; scaling <= FFT_SCALE_FIXED; scaling++) {
+				for(n = 0; n < len; n++) {
+					q15[n] = (int16_t)lrintf(signal[n]*32768);
+					q31[n] = q15[n]*65536;
+				}
+				exponent = fftProcessQ15(&fft, q15, q15, scaling);
+				halved &= (scaling == FFT_SCALE_BLOCK || exponent == (int32_t)bits + 1);
+				for(n = 0; n < len; n++)
+					fixed[n] = ldexp(q15[n], exponent)/32768;
+				level[FFT_Q15][scaling] = spectrumSnr(fixed, len);
+				exponent = fftProcessQ31(&fft, q31, q31, scaling);
+				halved &= (scaling == FFT_SCALE_BLOCK || exponent == (int32_t)bits + 1);
+				for(n = 0; n < len; n++)
+					fixed[n] = ldexp(q31[n], exponent)/2147483648.0;
+				level[FFT_Q31][scaling] = spectrumSnr(fixed, len);
+			}
+			HOST_CHECK(halved, "%u points: FFT_SCALE_FIXED exponent not %u", len, bits + 1);
+			HOST_CHECK(level[FFT_Q15][FFT_SCALE_BLOCK] > 50 && level[FFT_Q15][FFT_SCALE_BLOCK] > level[FFT_Q15][FFT_SCALE_FIXED] + (quiet ? 35 : 5) &&
+								 level[FFT_Q31][FFT_SCALE_BLOCK] > 145 && level[FFT_Q31][FFT_SCALE_BLOCK] > level[FFT_Q31][FFT_SCALE_FIXED] + 5 &&
+								 level[FFT_Q31][FFT_SCALE_BLOCK] > snr_float + 5,
+								 "%u points %s: SNR Q15 %.1f dB, halved %.1f dB, Q31 %.1f dB, halved %.1f dB, float %.1f dB", len,
+								 quiet ? "-48 dBFS" : "full scale", level[FFT_Q15][FFT_SCALE_BLOCK], level[FFT_Q15][FFT_SCALE_FIXED],
+								 level[FFT_Q31][FFT_SCALE_BLOCK], level[FFT_Q31][FFT_SCALE_FIXED], snr_float);
+			if(hostBenchmark())
+				printf("%4u points %-10s SNR Q15 %5.1f dB, halved %5.1f dB, Q31 %5.1f dB, halved %5.1f dB, float %5.1f dB\n", len,
+							 quiet ? "-48 dBFS" : "full scale", level[FFT_Q15][FFT_SCALE_BLOCK], level[FFT_Q15][FFT_SCALE_FIXED],
+							 level[FFT_Q31][FFT_SCALE_BLOCK], level[FFT_Q31][FFT_SCALE_FIXED], snr_float);
+		}
+	}
+
+	//The best of 5 runs in Q15 and Q31, the SNR is the same every time
+	fftBenchmarkFixed(cycles_fixed, snr_fixed);
+	for(i = 1; i < 5; i++) {
+		fftBenchmarkFixed(run_fixed, run_snr_fixed);
+		for(f = FFT_Q15; f <= FFT_Q31; f++)
+			for(s = 0; s < FFT_BENCH_SIZES; s++)
+				cycles_fixed[f][s] = fminf(cycles_fixed[f][s], run_fixed[f][s]);
+	}
+	for(s = 0, accurate = 1, growing = 1; s < FFT_BENCH_SIZES; s++)
+		for(f = FFT_Q15; f <= FFT_Q31; f++) {
+			accurate &= (snr_fixed[f][FFT_SCALE_BLOCK][s] > ((f == FFT_Q15) ? 50 : 135) &&
+									 snr_fixed[f][FFT_SCALE_BLOCK][s] > snr_fixed[f][FFT_SCALE_FIXED][s] + 10);
+			growing &= (cycles_fixed[f][s] > 0 && (s == 0 || cycles_fixed[f][s] > cycles_fixed[f][s - 1]));
+		}
+	HOST_CHECK(accurate, "fftBenchmarkFixed: block floating point SNR under 50 dB in Q15, 135 dB in Q31 or 10 dB over halving");
+	HOST_CHECK(growing, "fftBenchmarkFixed: cycles not growing with the length");
+	if(hostBenchmark()) {
+		printf("fftBenchmarkFixed, block floating point against halving every stage\npoints     ");
+		for(s = 0; s < FFT_BENCH_SIZES; s++)
+			printf(" %9u", 64u << s);
+		printf("\n");
+		for(f = FFT_Q15; f <= FFT_Q31; f++) {
+			printf("%s cycles ", formats[f]);
+			for(s = 0; s < FFT_BENCH_SIZES; s++)
+				printf(" %9.0f", cycles_fixed[f][s]);
+			printf("\n%s SNR dB ", formats[f]);
+			for(s = 0; s < FFT_BENCH_SIZES; s++)
+				printf(" %9.1f", snr_fixed[f][FFT_SCALE_BLOCK][s]);
+			printf("\n%s halved ", formats[f]);
+			for(s = 0; s < FFT_BENCH_SIZES; s++)
+				printf(" %9.1f", snr_fixed[f][FFT_SCALE_FIXED][s]);
+			printf("\n");
+		}
+	}
+
+	return hostTestEnd();
+}
@@ -0,0 +1,152 @@
+/**
+  ******************************************************************************
+  * @file    test_fir.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   The three filters of stm32f7_fir.c against a double precision
+  *					 direct form with the same quantised coefficients and inputs,
+  *					 for odd and even taps and blocks, with a stride of 2, at full
+  *					 scale and saturating, and the firBenchmark() matrix.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_fir.h"
+
+#define NUM_SAMPLES 3000
+#define UNTOUCHED   1234							//The other slot of the stereo Q15 buffer
+
+static double x[NUM_SAMPLES], h[FIR_MAX_TAPS];
+static int16_t h_q15[FIR_MAX_TAPS], state_q15[2*FIR_MAX_TAPS], buffer_q15[2*NUM_SAMPLES];
+static int32_t h_q31[FIR_MAX_TAPS], state_q31[2*FIR_MAX_TAPS], buffer_q31[NUM_SAMPLES];
+static float32_t h_f32[FIR_MAX_TAPS], state_f32[2*FIR_MAX_TAPS], buffer_f32[NUM_SAMPLES];
+
+/**
+  * @brief  Random taps summing to 0.95 in magnitude so no output saturates
+  */
+static void makeTaps(uint32_t taps) {
+	uint32_t k;
+	double sum = 0;
+
+	for(k = 0; k < taps; k++) {
+		h[k] = hostUniform();
+		sum += fabs(h[k]);
+	}
+	for(k = 0; k < taps; k++) {
+		h[k] *= 0.95/sum;
+		h_q15[k] = (int16_t)lrint(h[k]*32768);
+		h_q31[k] = (int32_t)lrint(h[k]*2147483648.0);
+		h_f32[k] = (float32_t)h[k];
+	}
+}
+
+/**
+  * @brief  Filter the input in blocks with the three filters and compare with
+  *					the direct form
+  */
+static void check(uint32_t taps, uint32_t block) {
+	FirQ15 fir_q15;
+	FirQ31 fir_q31;
+	FirF32 fir_f32;
+	uint32_t i, k, n;
+	double ref_q15, ref_q31, ref, error_q15 = 0, error_q31 = 0, error_f32 = 0;
+	int clobbered = 0;
+
+	firInitQ15(&fir_q15, h_q15, taps, state_q15);
+	firInitQ31(&fir_q31, h_q31, taps, state_q31);
+	firInitF32(&fir_f32, h_f32, taps, state_f32);
+	for(i = 0; i < NUM_SAMPLES; i++) {
+		buffer_q15[2*i] = (int16_t)lrint(x[i]*32767);
+		buffer_q15[2*i + 1] = UNTOUCHED;
+		buffer_q31[i] = (int32_t)lrint(x[i]*2147483647.0);
+		buffer_f32[i] = (float32_t)x[i];
+	}
+	for(i = 0; i < NUM_SAMPLES; i += block) {
+		n = (block < NUM_SAMPLES - i) ? block : NUM_SAMPLES - i;
+		firProcessQ15(&fir_q15, &buffer_q15[2*i], &buffer_q15[2*i], n, 2);
+		firProcessQ31(&fir_q31, &buffer_q31[i], &buffer_q31[i], n, 1);
+		firProcessF32(&fir_f32, &buffer_f32[i], &buffer_f32[i], n, 1);
+	}
+
+	for(i = 0; i < NUM_SAMPLES; i++) {
+		ref_q15 = ref_q31 = ref = 0;
+		for(k = 0; k < taps && k <= i; k++) {
+			ref_q15 += h_q15[k]/32768.0*lrint(x[i - k]*32767)/32768.0;
+			ref_q31 += h_q31[k]/2147483648.0*lrint(x[i - k]*2147483647.0)/2147483648.0;
+			ref += h[k]*x[i - k];
+		}
+		clobbered |= (buffer_q15[2*i + 1] != UNTOUCHED);
+		error_q15 = fmax(error_q15, fabs(buffer_q15[2*i]/32768.0 - ref_q15));
+		error_q31 = fmax(error_q31, fabs(buffer_q31[i]/2147483648.0 - ref_q31));
+		error_f32 = fmax(error_f32, fabs(buffer_f32[i] - ref));
+	}
+	HOST_CHECK(!clobbered, "%u taps, blocks of %u: the other stereo slot written", taps, block);
+	HOST_CHECK(error_q15 <= 0.5/32768 && error_q31 <= 1e-9 && error_f32 <= 1e-5,
+						 "%u taps, blocks of %u: errors Q15 %.2f LSB, Q31 %.2g, F32 %.2g",
+						 taps, block, error_q15*32768, error_q31, error_f32);
+}
+
+int main(void) {
+	static const uint32_t taps[] = {1, 2, 3, 7, 8, 31, 32, 128, 513, 1024};
+	static const uint32_t blocks[] = {1, 2, 3, 16, 17, 64, 512};
+	static const char *formats[3] = {"Q15", "Q31", "F32"};
+	static const uint16_t bench_taps[FIR_BENCH_TAPS] = {8, 32, 128, 512, 1024};
+	static const uint16_t bench_blocks[FIR_BENCH_BLOCKS] = {16, 64, 256, 512};
+	static float32_t cycles[3][FIR_BENCH_TAPS][FIR_BENCH_BLOCKS];
+	FirQ15 fir_q15;
+	int16_t h_full[4] = {-32768, -32768, -32768, -32768}, v[6];
+	uint32_t t, b, i, f;
+	int slower;
+
+	hostTestBegin("test_fir");
+
+	HOST_CHECK(firInitQ15(&fir_q15, h_q15, 0, state_q15) == HAL_ERROR &&
+						 firInitQ15(&fir_q15, h_q15, FIR_MAX_TAPS + 1, state_q15) == HAL_ERROR, "firInitQ15 out of range");
+
+	for(i = 0; i < NUM_SAMPLES; i++)
+		x[i] = 0.9f*hostUniform();
+	for(t = 0; t < sizeof(taps)/sizeof(taps[0]); t++) {
+		makeTaps(taps[t]);
+		for(b = 0; b < sizeof(blocks)/sizeof(blocks[0]); b++)
+			check(taps[t], blocks[b]);
+	}
+
+	//-32768 times -32768 twice is 2^31, one past an int32_t, it saturates
+	for(t = 2; t <= 4; t++) {
+		for(i = 0; i < 6; i++)
+			v[i] = -32768;
+		firInitQ15(&fir_q15, h_full, t, state_q15);
+		firProcessQ15(&fir_q15, v, v, 6, 1);
+		HOST_CHECK(v[t - 1] == 32767 && v[5] == 32767, "%u taps of -32768 on -32768: %d %d", t, v[t - 1], v[5]);
+	}
+	h_full[0] = h_full[1] = 32767;
+	v[0] = v[1] = 32767;
+	v[2] = v[3] = -32768;
+	firInitQ15(&fir_q15, h_full, 2, state_q15);
+	firProcessQ15(&fir_q15, v, v, 4, 1);
+	HOST_CHECK(v[1] == 32767 && v[3] == -32768, "saturation: %d %d", v[1], v[3]);
+
+	//More taps cost more for every format and block size
+	firBenchmark(cycles);
+	for(f = 0, slower = 1; f < 3; f++)
+		for(b = 0; b < FIR_BENCH_BLOCKS; b++)
+			slower &= (cycles[f][FIR_BENCH_TAPS - 1][b] > 10*cycles[f][0][b] && cycles[f][0][b] > 0);
+	HOST_CHECK(slower, "firBenchmark: 1024 taps not 10 times the cost of 8");
+	if(hostBenchmark()) {
+		printf("firBenchmark, cycles per sample\n    taps");
+		for(b = 0; b < FIR_BENCH_BLOCKS; b++)
+			printf("  block %3u", bench_blocks[b]);
+		printf("\n");
+		for(f = 0; f < 3; f++) {
+			for(t = 0; t < FIR_BENCH_TAPS; t++) {
+				printf("%s %4u", formats[f], bench_taps[t]);
+				for(b = 0; b < FIR_BENCH_BLOCKS; b++)
+					printf(" %10.1f", cycles[f][t][b]);
+				printf("\n");
+			}
+		}
+	}
+
+	return hostTestEnd();
+}
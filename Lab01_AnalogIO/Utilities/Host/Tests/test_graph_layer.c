@@ -0,0 +1,116 @@
+/**
+  ******************************************************************************
+  * @file    test_graph_layer.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   The RGB565 graph layer against ARGB8888: the same plot drawn
+  *					 in both pixel formats gives the same pixels once quantised, the
+  *					 screens differ by no more than the RGB565 step, and the LTDC
+  *					 scanout reads half the bytes of the graph layer.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_display.h"
+
+#define PIXELS (RK043FN48H_WIDTH*RK043FN48H_HEIGHT)
+
+extern LTDC_HandleTypeDef hLtdcHandler;
+
+//Not in stm32f7_display.h, stm32f7_LCD_init() draws the grid after the button
+void drawGrid(char * name);
+
+static float32_t buffer[256];
+static uint16_t graph_rgb565[PIXELS];
+static uint32_t graph_argb8888[PIXELS];
+static uint32_t screen_rgb565[PIXELS], screen_argb8888[PIXELS];
+
+/**
+  * @brief  The same grid, labels and wave on a cleared graph layer
+  */
+static void drawScene(void) {
+	int i;
+
+	BSP_LCD_SetTransparency(LTDC_ACTIVE_LAYER, 150);
+	BSP_LCD_SelectLayer(LTDC_ACTIVE_LAYER);
+	BSP_LCD_Clear(BACKGROUND_COLOUR);
+	clearLabels();
+	drawGrid("Host test");
+
+	//plotWave() only redraws the y labels when the range changes
+	for(i = 0; i < 256; i++)
+		buffer[i] = 100*sinf(2*PI*i/256);
+	hostVsync(HOST_REFRESH_HZ/RENDER_DEFAULT_FPS + 1);
+	plotWave(buffer, 256, LIVE, ARRAY);
+
+	for(i = 0; i < 256; i++)
+		buffer[i] = 10000*sinf(2*PI*i*5/256) + 2500*sinf(2*PI*i*17/256);
+	hostVsync(HOST_REFRESH_HZ/RENDER_DEFAULT_FPS + 1);
+	plotWave(buffer, 256, LIVE, ARRAY);
+}
+
+/**
+  * @brief  Scanout bytes of one second of panel refreshes
+  */
+static uint64_t scanout(void) {
+	hostLcdResetStats();
+	hostVsync(HOST_REFRESH_HZ);
+	return hostLcdStats.scanout_bytes;
+}
+
+int main(void) {
+	uint32_t i, k, wrong, worst, step;
+	uint32_t pixel;
+	uint64_t bytes_rgb565, bytes_argb8888;
+
+	hostTestBegin("test_graph_layer");
+	hostPressButton(1);
+	stm32f7_LCD_init(8000, "Host test", GRAPH);
+	HOST_CHECK(hLtdcHandler.LayerCfg[LTDC_ACTIVE_LAYER].PixelFormat == LTDC_PIXEL_FORMAT_RGB565, "the graph layer is not RGB565");
+
+	drawScene();
+	memcpy(graph_rgb565, (void *)LCD_FRAME_BUFFER, sizeof(graph_rgb565));
+	hostLcdCompose(screen_rgb565);
+	bytes_rgb565 = scanout();
+
+	//The same again with the graph layer the BSP way
+	BSP_LCD_LayerDefaultInit(LTDC_ACTIVE_LAYER, LCD_FRAME_BUFFER);
+	drawScene();
+	memcpy(graph_argb8888, (void *)LCD_FRAME_BUFFER, sizeof(graph_argb8888));
+	hostLcdCompose(screen_argb8888);
+	bytes_argb8888 = scanout();
+
+	//Fills, lines and glyphs give the same colour, quantised by DMA2D
+	for(i = 0, wrong = 0; i < PIXELS; i++) {
+		pixel = graph_argb8888[i];
+		wrong += (graph_rgb565[i] != (((pixel >> 8) & 0xF800) | ((pixel >> 5) & 0x07E0) | ((pixel >> 3) & 0x001F)));
+	}
+	HOST_CHECK(wrong == 0, "%u graph layer pixels differ from the ARGB8888 ones", wrong);
+
+	//On the screen the graph layer is blended at 150/255, each channel within the
+	//RGB565 step of 8 (red, blue) or 4 (green)
+	for(i = 0, worst = 0, wrong = 0; i < PIXELS; i++) {
+		for(k = 0; k < 24; k += 8) {
+			step = (k == 8) ? 4 : 8;
+			pixel = abs((int)((screen_rgb565[i] >> k) & 0xFF) - (int)((screen_argb8888[i] >> k) & 0xFF));
+			if(pixel > worst) worst = pixel;
+			wrong += (pixel >= step);
+		}
+	}
+	HOST_CHECK(wrong == 0, "%u screen channels off by the RGB565 step or more, worst %u", wrong, worst);
+
+	//The logo layer stays ARGB8888, the graph layer halves
+	HOST_CHECK(bytes_argb8888 - bytes_rgb565 == (uint64_t)HOST_REFRESH_HZ*PIXELS*2,
+						 "scanout %llu bytes/s RGB565, %llu ARGB8888", (unsigned long long)bytes_rgb565, (unsigned long long)bytes_argb8888);
+	if(hostBenchmark()) {
+		printf("scanout with an ARGB8888 graph layer: %6.1f MB/s\n", bytes_argb8888/1e6);
+		printf("scanout with an RGB565 graph layer:   %6.1f MB/s\n", bytes_rgb565/1e6);
+		HOST_LCD_BENCH("grid and plots ARGB8888", drawScene());
+		initGraphLayer();
+		HOST_LCD_BENCH("grid and plots RGB565", drawScene());
+	}
+
+	HOST_CHECK(hostLcdStats.out_of_range == 0, "%llu writes outside the SDRAM", (unsigned long long)hostLcdStats.out_of_range);
+	return hostTestEnd();
+}
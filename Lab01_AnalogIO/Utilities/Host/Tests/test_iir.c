@@ -0,0 +1,288 @@
+/**
+  ******************************************************************************
+  * @file    test_iir.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   The biquad cascades of stm32f7_iir.c against direct form I in
+  *					 double precision with the same quantised coefficients, wide and
+  *					 narrow low pass and peaking sections, with and without noise
+  *					 shaping, the decay to silence, stability on long noise, the
+  *					 coefficients changing between blocks and the cycles per
+  *					 biquad from iirBenchmark().
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_iir.h"
+#include <stdlib.h>
+
+#define NUM_SAMPLES 48000
+#define BLOCK       64
+#define UNTOUCHED   7										//The other slot of the stereo buffers
+
+static double x[NUM_SAMPLES], reference[NUM_SAMPLES], coeffs[IIR_MAX_STAGES*IIR_COEFFS];
+static float32_t coeffs_f32[IIR_MAX_STAGES*IIR_COEFFS], state_f32[2*IIR_MAX_STAGES], buffer_f32[2*NUM_SAMPLES];
+static int32_t coeffs_q31[IIR_MAX_STAGES*IIR_COEFFS], state_q31[5*IIR_MAX_STAGES], buffer_q31[2*NUM_SAMPLES];
+
+/**
+  * @brief  Low pass section at frequency (cycles per sample), from the
+  *					Audio EQ Cookbook
+  */
+static void lowPass(double frequency, double q, double *c) {
+	double w = 2*M_PI*frequency, alpha = sin(w)/(2*q), a0 = 1 + alpha;
+
+	c[0] = (1 - cos(w))/2/a0;
+	c[1] = (1 - cos(w))/a0;
+	c[2] = c[0];
+	c[3] = -2*cos(w)/a0;
+	c[4] = (1 - alpha)/a0;
+}
+
+/**
+  * @brief  Peaking section of gain dB at frequency (cycles per sample)
+  */
+static void peaking(double frequency, double q, double gain, double *c) {
+	double A = pow(10, gain/40), w = 2*M_PI*frequency, alpha = sin(w)/(2*q), a0 = 1 + alpha/A;
+
+	c[0] = (1 + alpha*A)/a0;
+	c[1] = -2*cos(w)/a0;
+	c[2] = (1 - alpha*A)/a0;
+	c[3] = -2*cos(w)/a0;
+	c[4] = (1 - alpha/A)/a0;
+}
+
+/**
+  * @brief  Direct form I cascade in double precision
+  */
+static void directForm(const double *c, uint32_t stages, const double *in, double *out, uint32_t n) {
+	double state[IIR_MAX_STAGES][4] = {{0}}, v, y;
+	uint32_t i, s;
+
+	for(i = 0; i < n; i++) {
+		v = in[i];
+		for(s = 0; s < stages; s++, c += IIR_COEFFS) {
+			y = c[0]*v + c[1]*state[s][0] + c[2]*state[s][1] - c[3]*state[s][2] - c[4]*state[s][3];
+			state[s][1] = state[s][0];
+			state[s][0] = v;
+			state[s][3] = state[s][2];
+			state[s][2] = y;
+			v = y;
+		}
+		c -= stages*IIR_COEFFS;
+		out[i] = v;
+	}
+}
+
+/**
+  * @brief  Filter x with the three forms on one slot of a stereo buffer and
+  *					compare each with the double cascade of its own coefficients
+  * @param  snr: SNR of IIR_F32, IIR_Q31 and IIR_Q31_SHAPED
+  * @retval 1 when the other slot is left alone
+  */
+static int accuracy(uint32_t stages, double snr[3]) {
+	static double quantised[IIR_MAX_STAGES*IIR_COEFFS], x_q31[NUM_SAMPLES];
+	IirBankF32 bank;
+	IirBankQ31 bank_q31;
+	IirF32 iir;
+	IirQ31 iir_q31;
+	uint32_t i, k, post_shift, shaping;
+	double signal, error;
+	int untouched = 1;
+
+	for(k = 0; k < stages*IIR_COEFFS; k++)
+		coeffs_f32[k] = (float32_t)coeffs[k];
+	post_shift = iirCoeffsToQ31(coeffs_f32, coeffs_q31, stages);
+
+	for(k = 0; k < stages*IIR_COEFFS; k++)
+		quantised[k] = coeffs_f32[k];
+	directForm(quantised, stages, x, reference, NUM_SAMPLES);
+	iirBankInitF32(&bank, stages, coeffs_f32);
+	iirInitF32(&iir, &bank, state_f32);
+	for(i = 0; i < NUM_SAMPLES; i++) {
+		buffer_f32[2*i] = (float32_t)x[i];
+		buffer_f32[2*i + 1] = UNTOUCHED;
+	}
+	for(i = 0; i < NUM_SAMPLES; i += BLOCK)
+		iirProcessF32(&iir, &buffer_f32[2*i], &buffer_f32[2*i], BLOCK, 2);
+	for(i = 0, signal = error = 0; i < NUM_SAMPLES; i++) {
+		signal += reference[i]*reference[i];
+		error += (buffer_f32[2*i] - reference[i])*(buffer_f32[2*i] - reference[i]);
+		untouched &= (buffer_f32[2*i + 1] == UNTOUCHED);
+	}
+	snr[IIR_F32] = hostSnr(signal, error);
+
+	for(k = 0; k < stages*IIR_COEFFS; k++)
+		quantised[k] = coeffs_q31[k]/2147483648.0*(1 << post_shift);
+	for(i = 0; i < NUM_SAMPLES; i++)
+		x_q31[i] = lrint(x[i]*2147483648.0)/2147483648.0;
+	directForm(quantised, stages, x_q31, reference, NUM_SAMPLES);
+	for(shaping = 0; shaping < 2; shaping++) {
+		iirBankInitQ31(&bank_q31, stages, post_shift, coeffs_q31);
+		iirInitQ31(&iir_q31, &bank_q31, state_q31, shaping);
+		for(i = 0; i < NUM_SAMPLES; i++) {
+			buffer_q31[2*i] = (int32_t)lrint(x[i]*2147483648.0);
+			buffer_q31[2*i + 1] = UNTOUCHED;
+		}
+		for(i = 0; i < NUM_SAMPLES; i += BLOCK)
+			iirProcessQ31(&iir_q31, &buffer_q31[2*i], &buffer_q31[2*i], BLOCK, 2);
+		for(i = 0, signal = error = 0; i < NUM_SAMPLES; i++) {
+			signal += reference[i]*reference[i];
+			error += (buffer_q31[2*i]/2147483648.0 - reference[i])*(buffer_q31[2*i]/2147483648.0 - reference[i]);
+			untouched &= (buffer_q31[2*i + 1] == UNTOUCHED);
+		}
+		snr[IIR_Q31 + shaping] = hostSnr(signal, error);
+	}
+	return untouched;
+}
+
+int main(void) {
+	static const char *forms[3] = {"F32 DF2T", "Q31 DF1", "Q31 DF1 shaped"};
+	static const uint8_t bench_stages[IIR_BENCH_STAGES] = {1, 2, 4, 8};
+	static const struct {
+		const char *name;
+		uint32_t stages;
+		double least[3];										//SNR in dB of each form
+	} filters[] = {
+		{"low pass fs/10, 4 stages", 4, {120, 155, 160}},
+		{"low pass fs/1000, 4 stages", 4, {65, 100, 135}},
+		{"peaking +12 dB at fs/500", 1, {70, 110, 145}},
+	};
+	float32_t cycles[3][IIR_BENCH_STAGES], run[3][IIR_BENCH_STAGES], a_coeffs[IIR_COEFFS], b_coeffs[IIR_COEFFS];
+	float32_t left_state[2], right_state[2], d1, d2, y;
+	double snr[3], c[IIR_COEFFS], peak, r, theta;
+	IirBankF32 bank;
+	IirBankQ31 bank_q31;
+	IirF32 iir, left, right;
+	IirQ31 iir_q31;
+	uint32_t f, s, i, k, block, shaping, wrong;
+	int32_t tail[2];
+	int bounded, cheaper;
+
+	hostTestBegin("test_iir");
+
+	HOST_CHECK(iirBankInitF32(&bank, 0, coeffs_f32) == HAL_ERROR && iirBankInitF32(&bank, IIR_MAX_STAGES + 1, coeffs_f32) == HAL_ERROR &&
+						 iirBankInitQ31(&bank_q31, 2, 4, coeffs_q31) == HAL_ERROR, "iirBankInit out of range");
+
+	//Noise and a low tone, well inside full scale
+	for(i = 0; i < NUM_SAMPLES; i++)
+		x[i] = 0.125*hostUniform() + 0.2*sin(2*M_PI*0.001*i);
+
+	for(f = 0; f < sizeof(filters)/sizeof(filters[0]); f++) {
+		for(s = 0; s < filters[f].stages; s++) {
+			if(f == 0)
+				lowPass(0.1, 0.54 + 0.3*s, &coeffs[s*IIR_COEFFS]);
+			else if(f == 1)
+				lowPass(0.001, 0.54 + 0.3*s, &coeffs[s*IIR_COEFFS]);
+			else
+				peaking(0.002, 4, 12, &coeffs[s*IIR_COEFFS]);
+		}
+		HOST_CHECK(accuracy(filters[f].stages, snr), "%s: the other stereo slot written", filters[f].name);
+		HOST_CHECK(snr[IIR_F32] > filters[f].least[IIR_F32] && snr[IIR_Q31] > filters[f].least[IIR_Q31] &&
+							 snr[IIR_Q31_SHAPED] > filters[f].least[IIR_Q31_SHAPED],
+							 "%s: SNR F32 %.1f dB, Q31 %.1f dB, shaped %.1f dB", filters[f].name, snr[IIR_F32], snr[IIR_Q31], snr[IIR_Q31_SHAPED]);
+		if(hostBenchmark())
+			printf("%-27s SNR F32 %.1f dB, Q31 %.1f dB, shaped %.1f dB\n", filters[f].name, snr[IIR_F32], snr[IIR_Q31], snr[IIR_Q31_SHAPED]);
+	}
+	//The narrow low pass amplifies the rounding noise most, shaping takes it away
+	lowPass(0.001, 0.54, coeffs);
+	accuracy(1, snr);
+	HOST_CHECK(snr[IIR_Q31_SHAPED] > snr[IIR_Q31] + 6, "low pass fs/1000: shaped %.1f dB, not better than %.1f dB",
+						 snr[IIR_Q31_SHAPED], snr[IIR_Q31]);
+
+	//A burst then silence: rounding alone sticks in a dead band the DC gain of the narrow
+	//low pass makes tens of thousands of LSB wide, shaping decays to zero
+	for(s = 0; s < 4; s++)
+		lowPass(0.001, 0.54 + 0.3*s, &coeffs[s*IIR_COEFFS]);
+	for(k = 0; k < 4*IIR_COEFFS; k++)
+		coeffs_f32[k] = (float32_t)coeffs[k];
+	iirBankInitQ31(&bank_q31, 4, iirCoeffsToQ31(coeffs_f32, coeffs_q31, 4), coeffs_q31);
+	for(shaping = 0; shaping < 2; shaping++) {
+		iirInitQ31(&iir_q31, &bank_q31, state_q31, shaping);
+		for(i = 0; i < NUM_SAMPLES; i++)
+			buffer_q31[i] = (i < 100) ? (int32_t)(hostRandom() % 2000000000) - 1000000000 : 0;
+		iirProcessQ31(&iir_q31, buffer_q31, buffer_q31, NUM_SAMPLES, 1);
+		for(i = NUM_SAMPLES - 100, tail[shaping] = 0; i < NUM_SAMPLES; i++)
+			tail[shaping] = (abs(buffer_q31[i]) > tail[shaping]) ? abs(buffer_q31[i]) : tail[shaping];
+	}
+	HOST_CHECK(tail[0] < (1 << 17) && tail[1] <= 1, "silence after a burst: %d LSB, shaped %d LSB", tail[0], tail[1]);
+	if(hostBenchmark())
+		printf("silence after a burst: %d LSB, shaped %d LSB\n", tail[0], tail[1]);
+
+	//8 all-pass sections with random poles up to 0.999 stay bounded on 1.2 million samples
+	for(s = 0; s < 8; s++) {
+		r = 0.5 + 0.499*(hostUniform() + 1)/2;
+		theta = M_PI*(hostUniform() + 1)/2;
+		coeffs_f32[s*IIR_COEFFS + 0] = (float32_t)(r*r);
+		coeffs_f32[s*IIR_COEFFS + 1] = (float32_t)(-2*r*cos(theta));
+		coeffs_f32[s*IIR_COEFFS + 2] = 1.0f;
+		coeffs_f32[s*IIR_COEFFS + 3] = (float32_t)(-2*r*cos(theta));
+		coeffs_f32[s*IIR_COEFFS + 4] = (float32_t)(r*r);
+	}
+	iirBankInitF32(&bank, 8, coeffs_f32);
+	iirInitF32(&iir, &bank, state_f32);
+	for(block = 0, peak = 0, bounded = 1; block < 200; block++) {
+		for(i = 0; i < NUM_SAMPLES/8; i++)
+			buffer_f32[i] = 0.5f*hostUniform();
+		iirProcessF32(&iir, buffer_f32, buffer_f32, NUM_SAMPLES/8, 1);
+		for(i = 0; i < NUM_SAMPLES/8; i++) {
+			bounded &= isfinite(buffer_f32[i]);
+			peak = fmax(peak, fabs(buffer_f32[i]));
+		}
+	}
+	HOST_CHECK(bounded && peak < 10, "8 all-pass sections: peak %.2f", peak);
+
+	//Two channels share a bank, new coefficients set between them apply to both from the next latch
+	lowPass(0.01, 0.7, c);
+	for(k = 0; k < IIR_COEFFS; k++)
+		a_coeffs[k] = (float32_t)c[k];
+	lowPass(0.2, 0.7, c);
+	for(k = 0; k < IIR_COEFFS; k++)
+		b_coeffs[k] = (float32_t)c[k];
+	iirBankInitF32(&bank, 1, a_coeffs);
+	iirInitF32(&left, &bank, left_state);
+	iirInitF32(&right, &bank, right_state);
+	for(i = 0; i < 16*BLOCK; i++)
+		buffer_f32[2*i] = buffer_f32[2*i + 1] = (float32_t)x[i];
+	for(block = 0; block < 16; block++) {
+		iirBankLatchF32(&bank);
+		iirProcessF32(&left, &buffer_f32[2*BLOCK*block], &buffer_f32[2*BLOCK*block], BLOCK, 2);
+		if(block == 5)
+			iirBankSetF32(&bank, b_coeffs);
+		iirProcessF32(&right, &buffer_f32[2*BLOCK*block + 1], &buffer_f32[2*BLOCK*block + 1], BLOCK, 2);
+	}
+	for(i = 0, d1 = d2 = 0, wrong = 0; i < 16*BLOCK; i++) {
+		const float32_t *h = (i < 6*BLOCK) ? a_coeffs : b_coeffs;
+		y = h[0]*(float32_t)x[i] + d1;
+		d1 = h[1]*(float32_t)x[i] - h[3]*y + d2;
+		d2 = h[2]*(float32_t)x[i] - h[4]*y;
+		wrong += (buffer_f32[2*i] != y || buffer_f32[2*i + 1] != y);
+	}
+	HOST_CHECK(wrong == 0, "coefficients changed between blocks: %u samples wrong", wrong);
+
+	//The best of 9 runs, the cost of a biquad does not grow with the stages
+	iirBenchmark(cycles);
+	for(k = 1; k < 9; k++) {
+		iirBenchmark(run);
+		for(f = 0; f < 3; f++)
+			for(s = 0; s < IIR_BENCH_STAGES; s++)
+				cycles[f][s] = fminf(cycles[f][s], run[f][s]);
+	}
+	for(f = 0, cheaper = 1; f < 3; f++)
+		cheaper &= (cycles[f][0] > 0 && cycles[f][IIR_BENCH_STAGES - 1] < 1.5f*cycles[f][0]);
+	HOST_CHECK(cheaper, "iirBenchmark: a biquad of 8 stages costs more than 1.5 times one alone");
+	if(hostBenchmark()) {
+		printf("iirBenchmark, cycles per biquad per sample\n%-15s", "stages");
+		for(s = 0; s < IIR_BENCH_STAGES; s++)
+			printf(" %6u", bench_stages[s]);
+		printf("\n");
+		for(f = 0; f < 3; f++) {
+			printf("%-15s", forms[f]);
+			for(s = 0; s < IIR_BENCH_STAGES; s++)
+				printf(" %6.2f", cycles[f][s]);
+			printf("\n");
+		}
+	}
+
+	return hostTestEnd();
+}
@@ -0,0 +1,237 @@
+/**
+  ******************************************************************************
+  * @file    test_lcd_log.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   The text zone of lcd_log.c, scrolled up a line at a time by DMA2D,
+  *					 against the same lines drawn from scratch with drawString():
+  *					 byte for byte after logging through printf, LCD_LOG_Write()
+  *					 and LCD_LOG_Printf(), after scrolling back and forward, in
+  *					 RGB565 and ARGB8888, and the cost of a logged line drawn from
+  *					 the glyph atlas against drawing it pixel by pixel.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "lcd_log.h"
+#include "stm32f7_glyph.h"
+#include <string.h>
+
+#define LOG_LAYER_ADDRESS   SDRAM_DEVICE_ADDR
+#define YWINDOW_MIN         4								//As in lcd_log.c
+#define LCD_LOG_PRINTF_SIZE 128
+#define FRAME_BYTES         (4*RK043FN48H_WIDTH*RK043FN48H_HEIGHT)
+#define MAX_LINES           2000
+#define COST_LINES          20
+
+typedef struct
+{
+	char text[sizeof(((LCD_LOG_line *)0)->line)];
+	uint32_t colour;
+} Line;
+
+//Every line completed so far, as the log should wrap it
+static Line lines[MAX_LINES];
+static uint32_t num_lines, column;
+static uint8_t logged[FRAME_BYTES], reference[FRAME_BYTES];
+
+/**
+  * @brief  Characters per line of the text zone
+  */
+static uint32_t lineLength(void) {
+	return BSP_LCD_GetXSize()/LCD_LOG_TEXT_FONT.Width;
+}
+
+/**
+  * @brief  Follow the text into lines: a newline or a character past the end
+  *					of the line ends one, in the colour of the moment
+  */
+static void model(const char *text) {
+	for(; *text != 0; text++) {
+		if(*text == '\n' || column >= lineLength()) {
+			memset(&lines[num_lines].text[column], ' ', lineLength() - column);
+			lines[num_lines].text[lineLength()] = 0;
+			lines[num_lines].colour = LCD_LineColor;
+			num_lines++;
+			column = 0;
+		}
+		if(*text != '\n')
+			lines[num_lines].text[column++] = *text;
+	}
+}
+
+/**
+  * @brief  Log a line of text one of three ways, some wrap, some hold a
+  *					newline, some change colour
+  */
+static void logLine(uint32_t i) {
+	char text[LCD_LOG_PRINTF_SIZE];
+	int length, k;
+
+	length = snprintf(text, sizeof(text), "line %u: sample %u", i, (i*7919) % 1000);
+	if(i % 13 == 0)
+		for(k = 0; k < 60; k++) text[length++] = 'a' + k % 26;
+	if(i % 17 == 0)
+		length += sprintf(text + length, " two\nparts");
+	text[length++] = '\n';
+	text[length] = 0;
+
+	LCD_LineColor = (i % 5 == 0) ? LCD_COLOR_RED : LCD_LOG_TEXT_COLOR;
+	model(text);
+	if(i % 3 == 0) {
+		for(k = 0; k < length; k++)
+			__io_putchar(text[k]);
+	} else if(i % 3 == 1) {
+		LCD_LOG_Write((uint8_t *)text, length);
+	} else {
+		LCD_LOG_Printf("%s", text);
+	}
+}
+
+/**
+  * @brief  Draw the screen from scratch with the lines that should show,
+  *					the text zone ending back lines before the last one
+  * @retval number of bytes of the frame buffer that differ
+  */
+static uint32_t compare(uint32_t back) {
+	uint8_t *fb = (uint8_t *)LOG_LAYER_ADDRESS;
+	uint32_t row, first, last = num_lines - 1 - back, i, differ = 0;
+
+	memcpy(logged, fb, FRAME_BYTES);
+	BSP_LCD_Clear(LCD_LOG_BACKGROUND_COLOR);
+	LCD_LOG_SetHeader((uint8_t *)"Log test");
+	LCD_LOG_SetFooter((uint8_t *)"lcd_log.c against drawString()");
+	first = (last + 1 >= YWINDOW_SIZE) ? last + 1 - YWINDOW_SIZE : 0;
+	for(row = 0; first + row <= last; row++) {
+		BSP_LCD_SetTextColor(lines[first + row].colour);
+		drawString(LCD_LOG_LAYER, 0, LINE(YWINDOW_MIN + row), lines[first + row].text, LEFT_MODE);
+	}
+	memcpy(reference, fb, FRAME_BYTES);
+
+	//Carry on logging over what the log drew
+	memcpy(fb, logged, FRAME_BYTES);
+	for(i = 0; i < FRAME_BYTES; i++)
+		differ += (logged[i] != reference[i]);
+	return differ;
+}
+
+/**
+  * @brief  Log, scroll and log again on the layer as it is set up
+  */
+static void run(const char *format) {
+	uint32_t i, back, differ, steps;
+	HostLcdStats before;
+
+	num_lines = 0;
+	column = 0;
+	LCD_LOG_Init();
+	LCD_LOG_SetHeader((uint8_t *)"Log test");
+	LCD_LOG_SetFooter((uint8_t *)"lcd_log.c against drawString()");
+
+	//The text zone filling up, then scrolling, then the cache wrapping round
+	for(i = 0; i < 10; i++)
+		logLine(i);
+	differ = compare(0);
+	HOST_CHECK(differ == 0, "%s: %u bytes differ with %u lines", format, differ, num_lines);
+	before = hostLcdStats;
+	for(; i < 400; i++)
+		logLine(i);
+	differ = compare(0);
+	HOST_CHECK(differ == 0, "%s: %u bytes differ with %u lines", format, differ, num_lines);
+	HOST_CHECK(hostLcdStats.copy_pixels > before.copy_pixels &&
+						 hostLcdStats.cpu_pixels - before.cpu_pixels < 2ull*(num_lines - 10)*RK043FN48H_WIDTH*LCD_LOG_TEXT_FONT.Height,
+						 "%s: the text zone is redrawn rather than moved up", format);
+
+	//Once the cache has wrapped round the first step back keeps the last screen, as ST's lcd_log.c always has
+	differ = (LCD_LOG_ScrollBack() == SUCCESS) ? compare(0) : FRAME_BYTES;
+	HOST_CHECK(differ == 0, "%s: %u bytes differ after the first step back", format, differ);
+
+	//Back 19 more lines, forward 8, back 5 more, each one a screen of its own
+	for(back = 0, steps = 0; steps < 19; steps++)
+		back += (LCD_LOG_ScrollBack() == SUCCESS);
+	differ = compare(back);
+	HOST_CHECK(back == 19 && differ == 0, "%s: %u bytes differ scrolled back %u lines", format, differ, back);
+	for(steps = 0; steps < 8; steps++)
+		back -= (LCD_LOG_ScrollForward() == SUCCESS);
+	differ = compare(back);
+	HOST_CHECK(back == 11 && differ == 0, "%s: %u bytes differ scrolled back %u lines", format, differ, back);
+	for(steps = 0; steps < 5; steps++)
+		back += (LCD_LOG_ScrollBack() == SUCCESS);
+	differ = compare(back);
+	HOST_CHECK(back == 16 && differ == 0, "%s: %u bytes differ scrolled back %u lines", format, differ, back);
+
+	//New text goes back to the end of the log
+	for(; i < 430; i++)
+		logLine(i);
+	differ = compare(0);
+	HOST_CHECK(differ == 0, "%s: %u bytes differ after scrolling and %u lines", format, differ, num_lines);
+
+	//Forward all the way is the end of the log again, and the next line moves it up
+	for(steps = 0; steps < 5; steps++)
+		LCD_LOG_ScrollBack();
+	while(LCD_LOG_ScrollForward() == SUCCESS);
+	logLine(i++);
+	differ = compare(0);
+	HOST_CHECK(differ == 0, "%s: %u bytes differ after scrolling forward to the end", format, differ);
+}
+
+/**
+  * @brief  Best of 9 times to log COST_LINES lines with the text zone full,
+  *					so every line moves it up and draws the new line
+  * @retval microseconds
+  */
+static uint64_t logCost(void) {
+	static const char text[] = "line 400: sample 600, level -12.5 dBFS\n";
+	uint64_t start, elapsed, best = UINT64_MAX;
+	uint32_t i, r;
+
+	LCD_LOG_Init();
+	for(i = 0; i < YWINDOW_SIZE; i++)
+		LCD_LOG_Write((const uint8_t *)text, sizeof(text) - 1);
+	for(r = 0; r < 9; r++) {
+		start = hostLcdTimeUs();
+		for(i = 0; i < COST_LINES; i++)
+			LCD_LOG_Write((const uint8_t *)text, sizeof(text) - 1);
+		elapsed = hostLcdTimeUs() - start;
+		if(elapsed < best) best = elapsed;
+	}
+	return best;
+}
+
+int main(void) {
+	uint64_t time_bsp, time_atlas, cpu_pixels;
+	HostLcdStats before;
+
+	hostTestBegin("test_lcd_log");
+	BSP_LCD_Init();
+	BSP_LCD_LayerRgb565Init(LCD_LOG_LAYER, LOG_LAYER_ADDRESS);
+	BSP_LCD_SelectLayer(LCD_LOG_LAYER);
+
+	//A logged line drawn with BSP_LCD_DisplayStringAtLine() before the glyph atlas is there, then from the atlas
+	time_bsp = logCost();
+	initGlyphAtlas();
+	before = hostLcdStats;
+	time_atlas = logCost();
+	cpu_pixels = hostLcdStats.cpu_pixels - before.cpu_pixels;
+	HOST_CHECK(cpu_pixels == 0 && time_atlas < time_bsp, "a logged line costs %.1f us and %llu CPU pixels from the glyph atlas, %.1f us drawn pixel by pixel",
+						 (double)time_atlas/COST_LINES, (unsigned long long)cpu_pixels, (double)time_bsp/COST_LINES);
+
+	BSP_LCD_LayerRgb565Init(LCD_LOG_LAYER, LOG_LAYER_ADDRESS);
+	BSP_LCD_SelectLayer(LCD_LOG_LAYER);
+	run("RGB565");
+
+	BSP_LCD_LayerDefaultInit(LCD_LOG_LAYER, LOG_LAYER_ADDRESS);
+	BSP_LCD_SelectLayer(LCD_LOG_LAYER);
+	run("ARGB8888");
+
+	if(hostBenchmark()) {
+		printf("logged line %.1f us from the glyph atlas, %.1f us drawn pixel by pixel\n", (double)time_atlas/COST_LINES, (double)time_bsp/COST_LINES);
+		HOST_LCD_BENCH("__io_putchar 40 characters", logLine(3));
+		HOST_LCD_BENCH("LCD_LOG_Write 40 characters", logLine(4));
+		HOST_LCD_BENCH("LCD_LOG_Printf 40 characters", logLine(5));
+	}
+
+	HOST_CHECK(hostLcdStats.out_of_range == 0, "%llu writes outside the SDRAM", (unsigned long long)hostLcdStats.out_of_range);
+	return hostTestEnd();
+}
@@ -0,0 +1,121 @@
+/**
+  ******************************************************************************
+  * @file    test_lms.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   The adaptive filters of stm32f7_lms.c identifying a known 512
+  *					 tap response from white noise, each method to the precision of
+  *					 single floats: the echo return loss enhancement and the
+  *					 misalignment of the weights, the Q15 path on the two slots of a
+  *					 stereo buffer, and the cost per sample from lmsBenchmark().
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_lms.h"
+
+#define FS          48000
+#define TAPS        512
+#define BLOCK       64
+#define CHUNK       96										//Samples per call, not a multiple of BLOCK
+#define NUM_SAMPLES (4*FS)
+#define Q15_TAPS    64
+
+static float32_t memory[LMS_MEMORY(TAPS, BLOCK)], h[TAPS], x[NUM_SAMPLES], d[NUM_SAMPLES], e[CHUNK];
+static int16_t stereo[2*CHUNK];
+
+int main(void) {
+	static const char *methods[3] = {"sample", "block", "frequency"};
+	float32_t cycles[3], run[3], fx[Q15_TAPS];
+	Lms lms;
+	uint32_t m, i, j, k, r;
+	double sum, desired, error, misalignment, response, erle[4], residual;
+	int converging;
+
+	hostTestBegin("test_lms");
+
+	HOST_CHECK(lmsInit(&lms, LMS_FREQUENCY, TAPS, 24, 0.5f, memory) == HAL_ERROR && lmsInit(&lms, LMS_SAMPLE, TAPS, BLOCK, 2.0f, memory) == HAL_ERROR &&
+						 lmsInit(&lms, LMS_SAMPLE, 0, BLOCK, 0.5f, memory) == HAL_ERROR && lmsInit(&lms, LMS_BLOCK + 2, TAPS, BLOCK, 0.5f, memory) == HAL_ERROR,
+						 "lmsInit out of range");
+
+	//A decaying random response driven by white noise at -20 dBFS, no noise on the output
+	for(k = 0; k < TAPS; k++)
+		h[k] = 0.3f*hostGauss()*expf(-(float32_t)k/80);
+	for(i = 0; i < NUM_SAMPLES; i++)
+		x[i] = 0.1f*hostGauss();
+	for(i = 0; i < NUM_SAMPLES; i++) {
+		for(k = 0, sum = 0; k < TAPS && k <= i; k++)
+			sum += (double)h[k]*x[i - k];
+		d[i] = (float32_t)sum;
+	}
+	for(k = 0, response = 0; k < TAPS; k++)
+		response += h[k]*h[k];
+
+	//The error falls each second until it reaches the rounding of single floats
+	for(m = LMS_SAMPLE; m <= LMS_FREQUENCY; m++) {
+		lmsInit(&lms, m, TAPS, BLOCK, 0.5f, memory);
+		for(i = 0, desired = error = 0; i < NUM_SAMPLES; i += CHUNK) {
+			lmsProcess(&lms, &x[i], &d[i], NULL, e, CHUNK, 1);
+			for(j = 0; j < CHUNK; j++) {
+				desired += d[i + j]*d[i + j];
+				error += e[j]*e[j];
+			}
+			if((i + CHUNK) % FS == 0) {
+				erle[(i + CHUNK)/FS - 1] = hostSnr(desired, error);
+				desired = error = 0;
+			}
+		}
+		for(k = 0, misalignment = 0; k < TAPS; k++)
+			misalignment += (lms.weights[k] - h[k])*(lms.weights[k] - h[k]);
+		misalignment = -hostSnr(response, misalignment);
+		for(r = 1, converging = 1; r < 3; r++)
+			converging &= (erle[r] > erle[r - 1] + 10 || erle[r - 1] > 120);
+		HOST_CHECK(converging && erle[3] > 120 && misalignment < -115, "%s: ERLE %.1f, %.1f, %.1f, %.1f dB, misalignment %.1f dB",
+							 methods[m], erle[0], erle[1], erle[2], erle[3], misalignment);
+		HOST_CHECK(lms.updates == ((m == LMS_SAMPLE) ? NUM_SAMPLES : NUM_SAMPLES/BLOCK), "%s: %u updates", methods[m], lms.updates);
+		if(hostBenchmark())
+			printf("%-9s ERLE %6.1f %6.1f %6.1f %6.1f dB each second, misalignment %.1f dB\n",
+						 methods[m], erle[0], erle[1], erle[2], erle[3], misalignment);
+	}
+
+	//Q15 in place, input on the left slot and the system output on the right, the error back on the left
+	for(m = LMS_SAMPLE; m <= LMS_FREQUENCY; m++) {
+		lmsInit(&lms, m, Q15_TAPS, 16, 0.5f, memory);
+		for(k = 0; k < Q15_TAPS; k++)
+			fx[k] = 0;
+		for(r = 0, residual = 0; r < 2000; r++) {
+			for(i = 0; i < CHUNK; i++) {
+				for(k = Q15_TAPS - 1; k > 0; k--)
+					fx[k] = fx[k - 1];
+				fx[0] = 0.1f*hostUniform();
+				for(k = 0, sum = 0; k < Q15_TAPS; k++)
+					sum += h[k]*fx[k];
+				stereo[2*i] = (int16_t)lrintf(fx[0]*32768);
+				stereo[2*i + 1] = (int16_t)lrint(sum*32768);
+			}
+			lmsProcessQ15(&lms, stereo, stereo + 1, NULL, stereo, CHUNK, 2);
+			if(r >= 1900)
+				for(i = 0; i < CHUNK; i++)
+					residual += (double)stereo[2*i]*stereo[2*i];
+		}
+		residual = sqrt(residual/(100*CHUNK));
+		HOST_CHECK(residual < 1, "%s Q15: error %.2f LSB rms after convergence", methods[m], residual);
+	}
+
+	//The best of 3 runs, the frequency domain filter is the cheapest for 512 taps
+	lmsBenchmark(cycles);
+	for(r = 1; r < 3; r++) {
+		lmsBenchmark(run);
+		for(m = 0; m < 3; m++)
+			cycles[m] = fminf(cycles[m], run[m]);
+	}
+	HOST_CHECK(cycles[LMS_FREQUENCY] > 0 && cycles[LMS_FREQUENCY] < cycles[LMS_SAMPLE]/2 && cycles[LMS_FREQUENCY] < cycles[LMS_BLOCK]/2,
+						 "lmsBenchmark: frequency %.1f cycles per sample, sample %.1f, block %.1f",
+						 cycles[LMS_FREQUENCY], cycles[LMS_SAMPLE], cycles[LMS_BLOCK]);
+	if(hostBenchmark())
+		for(m = 0; m < 3; m++)
+			printf("lmsBenchmark %-9s %.1f cycles per sample, %u taps, blocks of %u\n", methods[m], cycles[m], LMS_BENCH_TAPS, LMS_BENCH_BLOCK);
+
+	return hostTestEnd();
+}
@@ -0,0 +1,178 @@
+/**
+  ******************************************************************************
+  * @file    test_persist.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Noisy spectra through the exponential and linear averages of
+  *					 stm32f7_persist.c drawn frame after frame on the linear and dB
+  *					 graphs: the noise power they settle on, how much they smooth it,
+  *					 and golden frames of each sequence and of plotPersist().
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_display.h"
+#include "stm32f7_persist.h"
+
+#define BINS        512
+#define TONE_BIN    40
+#define TONE_LEVEL  6.0f
+#define FRAMES      64
+#define NOISE_FIRST 100					//Bins well away from the tone
+#define NOISE_LAST  400
+
+static float32_t magnitude[BINS], averaged[BINS], wave[256];
+static Average avg;
+
+//Set by proceed_statement() between screens
+extern int stop, update_flag;
+
+/**
+  * @brief  Start a new screen the way proceed_statement() does
+  */
+static void newScreen(void) {
+	stop = 0;
+	update_flag = 1;
+	clearScreen();
+	clearLabels();
+}
+
+/**
+  * @brief  Magnitudes of a tone in complex noise of unit variance per part,
+	*					the noise power of each bin is 2 on average
+  */
+static void spectrum(void) {
+	int i;
+	float32_t re, im;
+
+	for(i = 0; i < BINS; i++) {
+		re = hostGauss();
+		im = hostGauss();
+		if(i == TONE_BIN || i == BINS - TONE_BIN) re += TONE_LEVEL;
+		magnitude[i] = sqrtf(re*re + im*im);
+	}
+}
+
+/**
+  * @brief  Mean and spread of the power of the noise bins
+  */
+static void noisePower(const float32_t *mag, double *mean, double *spread) {
+	int i;
+	double sum = 0, sum2 = 0, p;
+
+	for(i = NOISE_FIRST; i < NOISE_LAST; i++) {
+		p = (double)mag[i]*mag[i];
+		sum += p;
+		sum2 += p*p;
+	}
+	*mean = sum/(NOISE_LAST - NOISE_FIRST);
+	*spread = sqrt(sum2/(NOISE_LAST - NOISE_FIRST) - *mean*(*mean));
+}
+
+/**
+  * @brief  Average FRAMES spectra and draw each new average, log or linear
+  * @retval number of averages drawn
+  */
+static int sequence(uint8_t mode, uint32_t frames, int log_graph) {
+	int f, drawn = 0;
+
+	newScreen();
+	averageInit(&avg, BINS, mode, frames);
+	for(f = 0; f < FRAMES; f++) {
+		spectrum();
+		if(!averageAdd(&avg, magnitude, averaged))
+			continue;
+		drawn++;
+		hostVsync(HOST_REFRESH_HZ/RENDER_DEFAULT_FPS + 1);
+		if(log_graph)
+			plotLogFFT(averaged, BINS, LIVE);
+		else
+			plotFFT(averaged, BINS, AUTO_SCALING);
+	}
+	return drawn;
+}
+
+int main(void) {
+	int f, i, drawn, lit;
+	double mean, spread, raw_spread;
+	uint8_t *persist = (uint8_t *)PERSIST_BUFFER;
+
+	hostTestBegin("test_persist");
+	hostPressButton(1);
+	stm32f7_LCD_init(8000, "Persist", GRAPH);
+
+	//The raw spectrum, the power of one bin spreads as much as its mean
+	spectrum();
+	noisePower(magnitude, &mean, &raw_spread);
+	HOST_CHECK(fabs(mean - 2) < 0.3 && raw_spread > 1.5, "raw: noise power %.3f spread %.3f", mean, raw_spread);
+
+	//Linear: one average every 16 frames, the spread down by 4
+	averageInit(&avg, BINS, AVERAGE_LINEAR, 16);
+	for(f = 0; f < 16; f++) {
+		spectrum();
+		drawn = averageAdd(&avg, magnitude, averaged);
+		HOST_CHECK(drawn == (f == 15), "linear: average ready after %d frames", f + 1);
+	}
+	noisePower(averaged, &mean, &spread);
+	HOST_CHECK(fabs(mean - 2) < 0.15 && spread < raw_spread/3, "linear: noise power %.3f spread %.3f", mean, spread);
+	HOST_CHECK(fabsf(averaged[TONE_BIN] - sqrtf(TONE_LEVEL*TONE_LEVEL + 2)) < 0.3f, "linear: tone %.3f", averaged[TONE_BIN]);
+
+	//Exponential: a new average every frame, settled after a few time constants
+	averageInit(&avg, BINS, AVERAGE_EXPONENTIAL, 16);
+	for(f = 0, drawn = 0; f < 200; f++) {
+		spectrum();
+		drawn += averageAdd(&avg, magnitude, averaged);
+	}
+	noisePower(averaged, &mean, &spread);
+	HOST_CHECK(drawn == 200, "exponential: %d averages from 200 frames", drawn);
+	HOST_CHECK(fabs(mean - 2) < 0.2 && spread < raw_spread/3, "exponential: noise power %.3f spread %.3f", mean, spread);
+
+	//The sequences as they are drawn, the last frame of each is checked
+	HOST_CHECK(sequence(AVERAGE_LINEAR, 16, 1) == FRAMES/16, "linear sequence on the dB graph");
+	hostCheckFrame("persist_linear_db");
+	HOST_CHECK(sequence(AVERAGE_EXPONENTIAL, 16, 1) == FRAMES, "exponential sequence on the dB graph");
+	hostCheckFrame("persist_exponential_db");
+	sequence(AVERAGE_LINEAR, 1, 1);
+	hostCheckFrame("persist_raw_db");
+	sequence(AVERAGE_LINEAR, 16, 0);
+	hostCheckFrame("persist_linear");
+	sequence(AVERAGE_EXPONENTIAL, 16, 0);
+	hostCheckFrame("persist_exponential");
+	sequence(AVERAGE_LINEAR, 1, 0);
+	hostCheckFrame("persist_raw");
+
+	//A drifting noisy tone leaves a trail
+	newScreen();
+	for(f = 0; f < 40; f++) {
+		for(i = 0; i < 256; i++)
+			wave[i] = 4000*sinf(2*PI*i/64.0f + 0.05f*f) + 1500*hostGauss();
+		if(f == 39 && hostBenchmark())
+			HOST_LCD_BENCH("plotPersist WAVE", plotPersist(wave, 256, WAVE, PERSIST_MEDIUM));
+		else
+			plotPersist(wave, 256, WAVE, PERSIST_MEDIUM);
+	}
+	hostCheckFrame("persist_wave");
+	newScreen();
+	for(f = 0; f < 40; f++) {
+		spectrum();
+		plotPersist(magnitude, BINS, FFT, PERSIST_SLOW);
+	}
+	hostCheckFrame("persist_fft");
+
+	//Once the spectrum stops, the last frame fades out except the new ones
+	for(i = 0; i < BINS; i++)
+		magnitude[i] = (i == 2) ? 30 : 0;
+	for(f = 0; f < 300; f++)
+		plotPersist(magnitude, BINS, FFT, PERSIST_SLOW);
+	for(i = 0, lit = 0; i < GRAPH_WIDTH*PERSIST_ROWS; i++)
+		lit += (persist[i] != 0);
+	HOST_CHECK(lit > 0 && lit < 3*PERSIST_ROWS, "%d pixels still lit after 300 frames of one bin", lit);
+	clearPersist();
+	for(i = 0, lit = 0; i < GRAPH_WIDTH*PERSIST_ROWS; i++)
+		lit += (persist[i] != 0);
+	HOST_CHECK(lit == 0, "%d pixels lit after clearPersist()", lit);
+
+	HOST_CHECK(hostLcdStats.out_of_range == 0, "%llu writes outside the SDRAM", (unsigned long long)hostLcdStats.out_of_range);
+	return hostTestEnd();
+}
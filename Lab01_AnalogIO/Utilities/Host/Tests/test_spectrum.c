@@ -0,0 +1,152 @@
+/**
+  ******************************************************************************
+  * @file    test_spectrum.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   stm32f7_spectrum.c on known tones and noise: the level of a tone
+  *					 at and between bins for each window, the side lobes of the
+  *					 Blackman-Harris window, a full scale Q15 tone, DC, the number
+  *					 of estimates and their independence from the block size, and
+  *					 the level and spread of white noise with Welch averaging.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_spectrum.h"
+#include <string.h>
+
+#define NUM_SAMPLES 48000
+#define UNTOUCHED   12345							//The other slot of the stereo buffer
+
+static Spectrum sp;
+static float32_t memory[SPECTRUM_MEMORY(SPECTRUM_MAX_SIZE)], level[SPECTRUM_MAX_SIZE/2], first[SPECTRUM_MAX_SIZE/2];
+static float32_t dbfs[SPECTRUM_MAX_SIZE/2], mono[NUM_SAMPLES];
+static int16_t stereo[2*NUM_SAMPLES];
+
+/**
+  * @brief  Feed the samples in blocks, from the stereo Q15 buffer or the
+  *					mono float one
+  * @retval number of estimates
+  */
+static int feed(uint32_t n, uint32_t block, int q15) {
+	uint32_t i, count;
+	int estimates = 0;
+
+	for(i = 0; i < n; i += count) {
+		count = (n - i < block) ? n - i : block;
+		if(q15)
+			estimates += spectrumAddQ15(&sp, &stereo[2*i], count, 2, level);
+		else
+			estimates += spectrumAddF32(&sp, &mono[i], count, 1, level);
+	}
+	return estimates;
+}
+
+/**
+  * @brief  Highest bin in dBFS
+  */
+static float32_t peak(uint32_t bins, uint32_t *at) {
+	uint32_t k;
+
+	spectrumDbfs(level, dbfs, bins);
+	for(k = 1, *at = 0; k < bins; k++)
+		if(dbfs[k] > dbfs[*at])
+			*at = k;
+	return dbfs[*at];
+}
+
+int main(void) {
+	static const char *windows[3] = {"Hann", "Blackman-Harris", "flat top"};
+	static const float32_t scalloping[3] = {1.42f, 0.83f, 0.0f};
+	uint32_t w, half, at, i, k, frames, count, differ;
+	float32_t top, side_lobe;
+	double power, square, mean, spread, expected;
+	int estimates;
+
+	hostTestBegin("test_spectrum");
+
+	HOST_CHECK(spectrumInit(&sp, 100, 50, SPECTRUM_HANN, AVERAGE_LINEAR, 4, memory) == HAL_ERROR &&
+						 spectrumInit(&sp, 1024, 0, SPECTRUM_HANN, AVERAGE_LINEAR, 4, memory) == HAL_ERROR &&
+						 spectrumInit(&sp, 1024, 512, 3, AVERAGE_LINEAR, 4, memory) == HAL_ERROR, "spectrumInit out of range");
+
+	//A -20 dBFS tone on bin 100 and half way to 101, 1024 points half overlapped, 4 frames an estimate.
+	//The phase in double, sinf() alone puts the side lobes at -70 dB
+	for(w = 0; w < 3; w++) {
+		for(half = 0; half < 2; half++) {
+			spectrumInit(&sp, 1024, 512, w, AVERAGE_LINEAR, 4, memory);
+			for(i = 0; i < NUM_SAMPLES; i++)
+				mono[i] = (float32_t)(0.1*sin(2*M_PI*(100 + 0.5*half)/1024*i + 0.3));
+			estimates = feed(NUM_SAMPLES, 48, 0);
+			top = peak(512, &at);
+			HOST_CHECK(estimates == ((NUM_SAMPLES - 1024)/512 + 1)/4, "%s: %d estimates", windows[w], estimates);
+			HOST_CHECK(at >= 100 && at <= 100 + half && fabsf(top + 20 + half*scalloping[w]) < 0.02f, "%s, tone at bin %.1f: %.3f dBFS at bin %u",
+								 windows[w], 100 + 0.5f*half, top, at);
+			//Every bin from 5 away is in the side lobes, under -92 dB
+			if(w == SPECTRUM_BLACKMAN && half == 0) {
+				for(k = 0, side_lobe = SPECTRUM_FLOOR_DB; k < 512; k++)
+					if(k + 5 <= 100 || k >= 105)
+						side_lobe = fmaxf(side_lobe, dbfs[k] - top);
+				HOST_CHECK(side_lobe < -92, "Blackman-Harris side lobes at %.1f dB", side_lobe);
+			}
+			if(hostBenchmark())
+				printf("%-15s tone at bin %5.1f: %7.3f dBFS, noise bandwidth %.3f bins\n", windows[w], 100 + 0.5f*half, top, sp.enbw);
+		}
+	}
+
+	//A full scale Q15 tone on one slot is 0 dBFS, exponential averaging gives an estimate every FFT
+	spectrumInit(&sp, 2048, 512, SPECTRUM_BLACKMAN, AVERAGE_EXPONENTIAL, 1, memory);
+	for(i = 0; i < NUM_SAMPLES; i++) {
+		stereo[2*i] = (int16_t)lrint(32767*sin(2*M_PI*300/2048*i));
+		stereo[2*i + 1] = UNTOUCHED;
+	}
+	estimates = feed(NUM_SAMPLES, 256, 1);
+	memcpy(first, level, sizeof(first));
+	top = peak(1024, &at);
+	HOST_CHECK(estimates == (NUM_SAMPLES - 2048)/512 + 1, "Q15: %d estimates", estimates);
+	HOST_CHECK(at == 300 && fabsf(top) < 0.01f && dbfs[0] < -120, "Q15 full scale tone: %.3f dBFS at bin %u, DC %.1f dBFS", top, at, dbfs[0]);
+
+	//The same samples in blocks of 37 give the same estimates
+	spectrumReset(&sp);
+	feed(NUM_SAMPLES, 37, 1);
+	for(k = 0, differ = 0; k < 1024; k++)
+		differ += (fabsf(level[k] - first[k]) > 1e-6f*first[k]);
+	HOST_CHECK(differ == 0, "blocks of 37 against 256: %u bins differ", differ);
+
+	//DC at a quarter of full scale
+	spectrumInit(&sp, 2048, 1024, SPECTRUM_FLATTOP, AVERAGE_LINEAR, 2, memory);
+	for(i = 0; i < NUM_SAMPLES; i++)
+		mono[i] = 0.25f;
+	feed(NUM_SAMPLES, 480, 0);
+	spectrumDbfs(level, dbfs, 4);
+	HOST_CHECK(fabsf(dbfs[0] - 20*log10f(0.25f)) < 0.02f, "DC of 0.25: %.3f dBFS", dbfs[0]);
+
+	//White noise: the mean power is sigma^2 times the noise bandwidth, averaging frames narrows the spread
+	for(frames = 1; frames <= 16; frames *= 4) {
+		spectrumInit(&sp, 512, 256, SPECTRUM_HANN, AVERAGE_LINEAR, frames, memory);
+		for(count = 0, power = square = 0; count < 20; count++) {
+			for(i = 0; i < NUM_SAMPLES; i++)
+				mono[i] = 0.1f*hostGauss();
+			if(feed(NUM_SAMPLES, 64, 0) == 0)
+				continue;
+			for(k = 10; k < 246; k++) {
+				power += level[k]*level[k];
+				square += (double)level[k]*level[k]*level[k]*level[k];
+			}
+		}
+		mean = power/(20*236);
+		spread = sqrt(square/(20*236) - mean*mean)/mean;
+		expected = 0.1*0.1*sp.enbw*4/512;
+		HOST_CHECK(fabs(mean/expected - 1) < 0.1 && fabs(spread*sqrt(frames) - 1) < 0.2,
+							 "noise, %u frames: power %.3g for %.3g, spread %.3f", frames, mean, expected, spread);
+		if(hostBenchmark())
+			printf("noise, %2u frames: power %.3g for %.3g, spread %.3f for %.3f\n", frames, mean, expected, spread, 1/sqrt(frames));
+	}
+
+	if(hostBenchmark()) {
+		spectrumInit(&sp, 1024, 512, SPECTRUM_HANN, AVERAGE_LINEAR, 1, memory);
+		HOST_LCD_BENCH("spectrumAddF32 512 samples, one 1024 point estimate", spectrumAddF32(&sp, mono, 512, 1, level));
+	}
+
+	return hostTestEnd();
+}
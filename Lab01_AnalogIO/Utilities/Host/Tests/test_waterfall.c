@@ -0,0 +1,109 @@
+/**
+  ******************************************************************************
+  * @file    test_waterfall.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Golden frames of plotWaterfall() in log and linear colour and of
+  *					 the graph given back by exitWaterfall(), and magnitudeToPalette()
+  *					 against one value at a time.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32f7_display.h"
+#include "stm32f7_waterfall.h"
+#include "stm32f7_decibel.h"
+
+#define ROWS 100
+
+static float32_t buffer[512];
+static float32_t magnitude[GRAPH_WIDTH];
+static uint8_t index_fast[GRAPH_WIDTH], index_slow[GRAPH_WIDTH];
+
+/**
+  * @brief  A tone sweeping up one bin per row over a fixed tone
+  */
+static void sweep(int row) {
+	int i;
+
+	for(i = 0; i < 512; i++)
+		buffer[i] = 1.0f + 100.0f/(1 + abs(i - (60 + row))) + 50.0f/(1 + abs(i - 200));
+}
+
+/**
+  * @brief  magnitudeToPalette() one value at a time
+  */
+static void paletteReference(uint32_t n, float32_t floor, float32_t scale, int log_scale) {
+	uint32_t i;
+	float32_t v;
+
+	for(i = 0; i < n; i++) {
+		if(log_scale)
+			decibelFromMagnitude(&magnitude[i], &v, 1, floor);
+		else
+			v = magnitude[i];
+		v = (v - floor)*scale;
+		if(v < 0) v = 0;
+		if(v > 255) v = 255;
+		index_slow[i] = (uint8_t)v;
+	}
+}
+
+int main(void) {
+	static const uint32_t lengths[] = {1, 3, 4, 5, 7, GRAPH_WIDTH};
+	uint32_t i, l, wrong;
+	int row, log_scale;
+
+	hostTestBegin("test_waterfall");
+	hostPressButton(1);
+	stm32f7_LCD_init(8000, "Host test", GRAPH);
+
+	for(row = 0; row < ROWS; row++) {
+		sweep(row);
+		plotWaterfall(buffer, 512, WATERFALL_LOG);
+		hostVsync(1);
+	}
+	hostCheckFrame("waterfall_log");
+
+	for(row = 0; row < ROWS; row++) {
+		sweep(row);
+		plotWaterfall(buffer, 512, WATERFALL_LINEAR);
+		hostVsync(1);
+	}
+	hostCheckFrame("waterfall_linear");
+
+	//Back to the RGB graph layer, no trace of the waterfall or its labels
+	exitWaterfall();
+	for(i = 0; i < 256; i++)
+		buffer[i] = 10000*sinf(2*PI*i*5/256);
+	hostVsync(HOST_REFRESH_HZ/RENDER_DEFAULT_FPS + 1);
+	plotWave(buffer, 256, LIVE, ARRAY);
+	hostCheckFrame("waterfall_exit");
+
+	//Every tail length of the four index stores
+	for(i = 0; i < GRAPH_WIDTH; i++)
+		magnitude[i] = (i % 17 == 0) ? 0 : 1000*hostUniform();
+	for(log_scale = 0; log_scale <= 1; log_scale++) {
+		for(l = 0; l < sizeof(lengths)/sizeof(lengths[0]); l++) {
+			memset(index_fast, 0xA5, sizeof(index_fast));
+			memset(index_slow, 0xA5, sizeof(index_slow));
+			if(log_scale) {
+				magnitudeToPalette(magnitude, index_fast, lengths[l], 0.0f, 255/WATERFALL_RANGE_DB, log_scale);
+				paletteReference(lengths[l], 0.0f, 255/WATERFALL_RANGE_DB, log_scale);
+			} else {
+				magnitudeToPalette(magnitude, index_fast, lengths[l], 0.0f, 255/1000.0f, log_scale);
+				paletteReference(lengths[l], 0.0f, 255/1000.0f, log_scale);
+			}
+			for(i = 0, wrong = 0; i < GRAPH_WIDTH; i++)
+				wrong += (index_fast[i] != index_slow[i]);
+			HOST_CHECK(wrong == 0, "magnitudeToPalette %s, %u values: %u indices wrong", log_scale ? "log" : "linear", lengths[l], wrong);
+		}
+	}
+
+	if(hostBenchmark())
+		HOST_LCD_BENCH("plotWaterfall", plotWaterfall(buffer, 512, WATERFALL_LOG));
+
+	HOST_CHECK(hostLcdStats.out_of_range == 0, "%llu writes outside the SDRAM", (unsigned long long)hostLcdStats.out_of_range);
+	return hostTestEnd();
+}
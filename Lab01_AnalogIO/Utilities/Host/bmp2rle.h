@@ -0,0 +1,39 @@
+/**
+  ******************************************************************************
+  * @file    bmp2rle.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for bmp2rle.c, the encoder without the command line
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __BMP2RLE_H
+#define __BMP2RLE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define MAX_COLOURS 256
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Palette + RLE image in the RleImage coding of stm32f7_image.h
+  */
+typedef struct
+{
+	uint32_t width;
+	uint32_t height;
+	uint32_t colours;							//Palette entries
+	uint32_t palette[MAX_COLOURS];	//ARGB8888
+	uint8_t *data;								//Coded rows, malloc()ed
+	uint32_t data_len;
+	uint32_t source_colours;			//Colours in the BMP before merging
+	uint32_t worst;								//Largest squared RGB error of a merged colour
+} RleCoded;
+
+/* Exported functions ------------------------------------------------------- */
+const char *bmpToRle(const uint8_t *bmp, uint32_t size, RleCoded *image);
+
+#endif /* __BMP2RLE_H */
@@ -0,0 +1,79 @@
+/**
+  ******************************************************************************
+  * @file    core_cm7.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Host stand-in for the CMSIS Cortex-M7 core header, see host_lcd.h.
+  *          The intrinsics do nothing and the core peripherals are plain
+  *          structures defined in host_lcd.c.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __CORE_CM7_H_GENERIC
+#define __CORE_CM7_H_GENERIC
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+#define __I volatile const
+#define __O volatile
+#define __IO volatile
+#define __IM volatile const
+#define __OM volatile
+#define __IOM volatile
+#define __STATIC_INLINE static inline
+#define __ASM __asm
+#define __NOP()
+#define __DSB()
+#define __ISB()
+#define __DMB()
+void hostWaitForInterrupt(void);
+#define __WFI() hostWaitForInterrupt()
+uint32_t hostCycles(void);
+#define __WFE()
+#define __SEV()
+#define __NVIC_PRIO_BITS_ 4
+static inline uint32_t __get_PRIMASK(void){return 0;}
+static inline void __set_PRIMASK(uint32_t x){(void)x;}
+static inline void __disable_irq(void){}
+static inline void __enable_irq(void){}
+static inline uint32_t __CLZ(uint32_t x){return x?__builtin_clz(x):32;}
+static inline uint32_t __RBIT(uint32_t x){uint32_t r=0;for(int i=0;i<32;i++){r=(r<<1)|(x&1);x>>=1;}return r;}
+static inline uint32_t __REV(uint32_t x){return __builtin_bswap32(x);}
+typedef struct { __IO uint32_t CPUID, ICSR, VTOR, AIRCR, SCR, CCR; __IO uint8_t SHPR[12]; __IO uint32_t SHCSR, CFSR, HFSR, DFSR, MMFAR, BFAR, AFSR, ID_PFR[2], ID_DFR, ID_AFR, ID_MFR[4], ID_ISAR[5]; uint32_t R0[1]; __IO uint32_t CLIDR, CTR, CCSIDR, CSSELR, CPACR; } SCB_Type;
+typedef struct { __IO uint32_t CTRL, LOAD, VAL, CALIB; } SysTick_Type;
+typedef struct { __IO uint32_t CTRL, CYCCNT, CPICNT, EXCCNT, SLEEPCNT, LSUCNT, FOLDCNT, PCSR, LAR; } DWT_Type;
+typedef struct { __IO uint32_t DHCSR, DCRSR, DCRDR, DEMCR; } CoreDebug_Type;
+typedef struct { __IO uint32_t TYPE, CTRL, RNR, RBAR, RASR; } MPU_Type;
+extern SCB_Type SCB_stub; extern SysTick_Type SysTick_stub; extern DWT_Type DWT_stub; extern CoreDebug_Type CoreDebug_stub; extern MPU_Type MPU_stub;
+#define SCB (&SCB_stub)
+#define SysTick (&SysTick_stub)
+#define DWT (&DWT_stub)
+#define CoreDebug (&CoreDebug_stub)
+#define MPU (&MPU_stub)
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL<<24)
+#define DWT_CTRL_CYCCNTENA_Msk 1UL
+#define SCB_CCR_DC_Msk (1UL<<16)
+static inline void NVIC_SetPriority(int irq, uint32_t p){(void)irq;(void)p;}
+static inline void NVIC_EnableIRQ(int irq){(void)irq;}
+static inline void NVIC_DisableIRQ(int irq){(void)irq;}
+static inline void NVIC_SystemReset(void){}
+static inline uint32_t NVIC_GetPriorityGrouping(void){return 0;}
+static inline uint32_t NVIC_EncodePriority(uint32_t a,uint32_t b,uint32_t c){return a+b+c;}
+static inline void NVIC_SetPriorityGrouping(uint32_t a){(void)a;}
+static inline void NVIC_ClearPendingIRQ(int irq){(void)irq;}
+static inline void NVIC_SetPendingIRQ(int irq){(void)irq;}
+static inline uint32_t NVIC_GetPendingIRQ(int irq){(void)irq;return 0;}
+static inline uint32_t NVIC_GetActive(int irq){(void)irq;return 0;}
+static inline void NVIC_DecodePriority(uint32_t a,uint32_t b,uint32_t*c,uint32_t*d){(void)a;(void)b;(void)c;(void)d;}
+static inline uint32_t NVIC_GetPriority(int irq){(void)irq;return 0;}
+static inline uint32_t SysTick_Config(uint32_t t){(void)t;return 0;}
+static inline void SCB_EnableICache(void){}
+static inline void SCB_EnableDCache(void){}
+static inline void SCB_CleanDCache(void){}
+static inline void SCB_CleanDCache_by_Addr(void*a,int32_t s){(void)a;(void)s;}
+static inline void SCB_InvalidateDCache_by_Addr(void*a,int32_t s){(void)a;(void)s;}
+static inline void SCB_CleanInvalidateDCache_by_Addr(void*a,int32_t s){(void)a;(void)s;}
+
+#endif /* __CORE_CM7_H_GENERIC */
@@ -0,0 +1,992 @@
+/**
+  ******************************************************************************
+  * @file    host_lcd.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides a host (Linux) stand-in for the LCD hardware
+  *					 used by the display modules. The BSP_LCD functions follow the
+  *					 STM32746G-Discovery BSP, DMA2D transfers run in software and
+  *					 hostLcdCompose() mixes the two layers the way the LTDC does.
+  *					 The SDRAM is anonymous memory mapped at SDRAM_DEVICE_ADDR so
+  *					 the frame buffer addresses used on the board work unchanged.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#define _GNU_SOURCE
+#include "host_lcd.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+
+#define HOST_LAYERS 2
+
+LTDC_HandleTypeDef hLtdcHandler;
+HostLcdStats hostLcdStats;
+
+//Core peripherals referenced by the CMSIS inline functions
+SCB_Type SCB_stub;
+SysTick_Type SysTick_stub;
+DWT_Type DWT_stub;
+CoreDebug_Type CoreDebug_stub;
+MPU_Type MPU_stub;
+LTDC_TypeDef LTDC_stub;									//hLtdcHandler.Instance, the line interrupt registers
+uint32_t SystemCoreClock = HOST_CORE_CLOCK;
+
+static LCD_DrawPropTypeDef DrawProp[HOST_LAYERS];
+static uint32_t ActiveLayer = 0;
+
+//Layer registers the LTDC scans out, the handle holds the shadow copy
+static LTDC_LayerCfgTypeDef ltdc_layer[HOST_LAYERS];
+static uint8_t ltdc_enabled[HOST_LAYERS];
+static uint8_t ltdc_clut_enabled[HOST_LAYERS];
+static uint32_t ltdc_clut[HOST_LAYERS][256];
+
+//DMA2D background (0) and foreground (1) CLUTs
+static uint32_t dma2d_clut[2][256];
+
+//User button pin, presses wait in button_presses until it interrupts
+static uint32_t button_presses = 0;
+static uint8_t button_level = 0;
+static uint8_t button_exti = 0;
+static TS_StateTypeDef touch_state;
+static uint8_t touch_exti = 0;
+static uint32_t tick_offset = 0;
+static int sdram_open = 0;
+static const uint8_t *qspi_image = NULL;
+static uint32_t qspi_size = 0;
+static const uint8_t *sd_image = NULL;
+static uint32_t sd_size = 0;
+
+static uint32_t bytesPerPixel(uint32_t mode);
+
+/**
+  * @brief  Map the SDRAM window, the frame buffers live at their board addresses
+  * @param  none
+  * @retval none
+  */
+
+void hostLcdOpen(void) {
+	void *sdram;
+
+	if(sdram_open)
+		return;
+
+#ifdef MAP_FIXED_NOREPLACE
+	sdram = mmap((void *)(uintptr_t)SDRAM_DEVICE_ADDR, SDRAM_DEVICE_SIZE, PROT_READ | PROT_WRITE,
+							 MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+#else
+	sdram = mmap((void *)(uintptr_t)SDRAM_DEVICE_ADDR, SDRAM_DEVICE_SIZE, PROT_READ | PROT_WRITE,
+							 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#endif
+	if(sdram != (void *)(uintptr_t)SDRAM_DEVICE_ADDR) {
+		fprintf(stderr, "host_lcd: can't map the SDRAM at 0x%08X\n", (unsigned)SDRAM_DEVICE_ADDR);
+		exit(1);
+	}
+	sdram_open = 1;
+}
+
+/**
+  * @brief  Clear the work counters
+  * @param  none
+  * @retval none
+  */
+
+void hostLcdResetStats(void) {
+	memset(&hostLcdStats, 0, sizeof(hostLcdStats));
+}
+
+/**
+  * @brief  Monotonic time
+  * @param  none
+  * @retval time in microseconds
+  */
+
+uint64_t hostLcdTimeUs(void) {
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec*1000000u + (uint64_t)now.tv_nsec/1000u;
+}
+
+/**
+  * @brief  Wall clock in cycles of a HOST_CORE_CLOCK core, stands in for
+  *					DWT->CYCCNT in the benchmarks
+  * @param  none
+  * @retval cycles, wraps like the DWT counter
+  */
+
+uint32_t hostCycles(void) {
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint32_t)(((uint64_t)now.tv_sec*1000000000u + now.tv_nsec)*(HOST_CORE_CLOCK/1000000u)/1000u);
+}
+
+/**
+  * @brief  Print the time and the pixels touched since a snapshot of the counters
+  * @param  name: name of the measured call
+  * @param  before: counters before the call
+  * @param  time_us: time taken by the call
+  * @retval none
+  */
+
+void hostLcdPrintBench(const char *name, const HostLcdStats *before, uint64_t time_us) {
+	printf("%-24s %8llu us  fill %8llu  copy %8llu  blend %8llu  cpu %8llu  dma2d %6llu\n", name,
+				 (unsigned long long)time_us,
+				 (unsigned long long)(hostLcdStats.fill_pixels - before->fill_pixels),
+				 (unsigned long long)(hostLcdStats.copy_pixels - before->copy_pixels),
+				 (unsigned long long)(hostLcdStats.blend_pixels - before->blend_pixels),
+				 (unsigned long long)(hostLcdStats.cpu_pixels - before->cpu_pixels),
+				 (unsigned long long)(hostLcdStats.dma2d_transfers - before->dma2d_transfers));
+}
+
+/**
+  * @brief  Press and release the user button, each level held for 50 ms of
+  *					HAL_GetTick() so the debouncing takes it. Before the button is
+  *					set to interrupt the presses wait, __WFI() lets one of them in.
+  * @param  presses: number of presses
+  * @retval none
+  */
+
+void hostPressButton(uint32_t presses) {
+	if(!button_exti) {
+		button_presses += presses;
+		return;
+	}
+	while(presses-- > 0) {
+		hostButtonLevel(1);
+		hostAdvanceTick(50);
+		hostButtonLevel(0);
+		hostAdvanceTick(50);
+	}
+}
+
+/**
+  * @brief  Set the level of the user button pin, an edge interrupts when the
+  *					pin is set to interrupt, e.g. to play a bouncing contact
+  * @param  level: 1 pressed, 0 released
+  * @retval none
+  */
+
+void hostButtonLevel(uint8_t level) {
+	level = (level != 0);
+	if(level == button_level)
+		return;
+	button_level = level;
+	if(button_exti)
+		HAL_GPIO_EXTI_Callback(KEY_BUTTON_PIN);
+}
+
+/**
+  * @brief  __WFI(), sleep until the next interrupt. The tick interrupt comes
+  *					a millisecond later, or the user presses a waiting press.
+  * @param  none
+  * @retval none
+  */
+
+void hostWaitForInterrupt(void) {
+	if(button_exti && button_presses > 0) {
+		button_presses--;
+		hostPressButton(1);
+	} else {
+		hostAdvanceTick(1);
+	}
+}
+
+/**
+  * @brief  Move HAL_GetTick() on without waiting
+  * @param  ms: milliseconds
+  * @retval none
+  */
+
+void hostAdvanceTick(uint32_t ms) {
+	tick_offset += ms;
+}
+
+/**
+  * @brief  Set what the touch screen reports until the next call
+  * @param  touches: number of fingers, 0 to 2
+  * @param  x0, y0: first finger in pixels
+  * @param  x1, y1: second finger in pixels
+  * @retval none
+  */
+
+void hostTouch(uint8_t touches, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+	memset(&touch_state, 0, sizeof(touch_state));
+	touch_state.touchDetected = (touches > 2) ? 2 : touches;
+	touch_state.touchX[0] = x0;
+	touch_state.touchY[0] = y0;
+	touch_state.touchX[1] = x1;
+	touch_state.touchY[1] = y1;
+	if(touch_exti)
+		HAL_GPIO_EXTI_Callback(TS_INT_PIN);
+}
+
+/**
+  * @brief  Let panel refreshes go by, each one moves the cycle counter on by
+  *					one refresh period and fires the LTDC line event when it is armed
+  * @param  frames: number of refreshes
+  * @retval none
+  */
+
+void hostVsync(uint32_t frames) {
+	uint32_t i;
+	LTDC_LayerCfgTypeDef *layer;
+
+	while(frames-- > 0) {
+		DWT->CYCCNT += SystemCoreClock/HOST_REFRESH_HZ;
+		//Every refresh reads the whole window of each enabled layer
+		for(i = 0; i < HOST_LAYERS; i++) {
+			layer = &ltdc_layer[i];
+			if(ltdc_enabled[i])
+				hostLcdStats.scanout_bytes += (uint64_t)(layer->WindowX1 - layer->WindowX0)*(layer->WindowY1 - layer->WindowY0)*bytesPerPixel(layer->PixelFormat);
+		}
+		if(LTDC_stub.IER & LTDC_IT_LI) {
+			//Like HAL_LTDC_IRQHandler(), the interrupt is off again until it is re-enabled
+			LTDC_stub.IER &= ~LTDC_IT_LI;
+			HAL_LTDC_LineEventCallback(&hLtdcHandler);
+		}
+	}
+}
+
+/**
+  * @brief  Set what the QSPI flash and the SD card hold, kept by reference
+  * @param  qspi: flash contents, NULL for none
+  * @param  qspi_bytes: size
+  * @param  sd: card contents, NULL for no card
+  * @param  sd_bytes: size
+  * @retval none
+  */
+
+void hostStorage(const uint8_t *qspi, uint32_t qspi_bytes, const uint8_t *sd, uint32_t sd_bytes) {
+	qspi_image = qspi;
+	qspi_size = qspi_bytes;
+	sd_image = sd;
+	sd_size = sd_bytes;
+}
+
+/* Pixel formats -------------------------------------------------------------*/
+//DMA2D colour modes and LTDC pixel formats share the same numbers
+
+static uint32_t bytesPerPixel(uint32_t mode) {
+	switch(mode) {
+		case DMA2D_INPUT_ARGB8888: return 4;
+		case DMA2D_INPUT_RGB888: return 3;
+		case DMA2D_INPUT_RGB565:
+		case DMA2D_INPUT_ARGB1555:
+		case DMA2D_INPUT_ARGB4444:
+		case DMA2D_INPUT_AL88: return 2;
+		default: return 1;
+	}
+}
+
+static int inSdram(uintptr_t address, uint32_t size) {
+	return address >= SDRAM_DEVICE_ADDR && address + size <= (uintptr_t)SDRAM_DEVICE_ADDR + SDRAM_DEVICE_SIZE;
+}
+
+/**
+  * @brief  Read one pixel as ARGB8888
+  * @param  address: pixel address
+  * @param  mode: colour mode
+  * @param  clut: lookup table for L8, NULL to read L8 as grey
+  * @param  colour: RGB888 of A8 pixels
+  * @retval ARGB8888 colour
+  */
+
+static uint32_t readPixel(uintptr_t address, uint32_t mode, const uint32_t *clut, uint32_t colour) {
+	const uint8_t *p = (const uint8_t *)address;
+	uint32_t v, r, g, b, a;
+
+	switch(mode) {
+		case DMA2D_INPUT_ARGB8888:
+			memcpy(&v, p, 4);
+			return v;
+		case DMA2D_INPUT_RGB888:
+			return 0xFF000000u | (p[2] << 16) | (p[1] << 8) | p[0];
+		case DMA2D_INPUT_RGB565:
+			v = p[0] | (p[1] << 8);
+			r = (v >> 11) & 0x1F; g = (v >> 5) & 0x3F; b = v & 0x1F;
+			return 0xFF000000u | (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+		case DMA2D_INPUT_ARGB1555:
+			v = p[0] | (p[1] << 8);
+			a = (v & 0x8000) ? 0xFF : 0;
+			r = (v >> 10) & 0x1F; g = (v >> 5) & 0x1F; b = v & 0x1F;
+			return (a << 24) | (((r << 3) | (r >> 2)) << 16) | (((g << 3) | (g >> 2)) << 8) | ((b << 3) | (b >> 2));
+		case DMA2D_INPUT_ARGB4444:
+			v = p[0] | (p[1] << 8);
+			return (((v >> 12) & 0xF)*0x11u << 24) | (((v >> 8) & 0xF)*0x11u << 16) | (((v >> 4) & 0xF)*0x11u << 8) | ((v & 0xF)*0x11u);
+		case DMA2D_INPUT_L8:
+			if(clut) return 0xFF000000u | (clut[p[0]] & 0xFFFFFF);
+			return 0xFF000000u | (p[0]*0x010101u);
+		case DMA2D_INPUT_A8:
+			return ((uint32_t)p[0] << 24) | (colour & 0xFFFFFF);
+		default:
+			return 0xFF000000u;
+	}
+}
+
+/**
+  * @brief  Write one ARGB8888 pixel in an output colour mode
+  * @param  address: pixel address
+  * @param  mode: DMA2D_OUTPUT_ARGB8888, DMA2D_OUTPUT_RGB888 or DMA2D_OUTPUT_RGB565
+  * @param  argb: colour
+  * @retval none
+  */
+
+static void writePixel(uintptr_t address, uint32_t mode, uint32_t argb) {
+	uint8_t *p = (uint8_t *)address;
+	uint32_t v;
+
+	if(!inSdram(address, bytesPerPixel(mode))) {
+		hostLcdStats.out_of_range++;
+		return;
+	}
+	switch(mode) {
+		case DMA2D_OUTPUT_RGB888:
+			p[0] = argb; p[1] = argb >> 8; p[2] = argb >> 16;
+			break;
+		case DMA2D_OUTPUT_RGB565:
+			v = ((argb >> 8) & 0xF800) | ((argb >> 5) & 0x07E0) | ((argb >> 3) & 0x001F);
+			p[0] = v; p[1] = v >> 8;
+			break;
+		default:
+			memcpy(p, &argb, 4);
+			break;
+	}
+}
+
+/* DMA2D ---------------------------------------------------------------------*/
+
+HAL_StatusTypeDef HAL_DMA2D_Init(DMA2D_HandleTypeDef *hdma2d) {
+	hdma2d->State = HAL_DMA2D_STATE_READY;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA2D_ConfigLayer(DMA2D_HandleTypeDef *hdma2d, uint32_t LayerIdx) {
+	return (LayerIdx < 2) ? HAL_OK : HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_DMA2D_CLUTStartLoad(DMA2D_HandleTypeDef *hdma2d, DMA2D_CLUTCfgTypeDef *CLUTCfg, uint32_t LayerIdx) {
+	uint32_t i;
+
+	if(LayerIdx > 1)
+		return HAL_ERROR;
+	//Size is the number of entries minus one
+	for(i = 0; i <= CLUTCfg->Size && i < 256; i++) {
+		if(CLUTCfg->CLUTColorMode == DMA2D_CCM_RGB888)
+			dma2d_clut[LayerIdx][i] = readPixel((uintptr_t)CLUTCfg->pCLUT + 3*i, DMA2D_INPUT_RGB888, NULL, 0);
+		else
+			dma2d_clut[LayerIdx][i] = CLUTCfg->pCLUT[i];
+	}
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA2D_PollForTransfer(DMA2D_HandleTypeDef *hdma2d, uint32_t Timeout) {
+	return HAL_OK;
+}
+
+/**
+  * @brief  Foreground pixel after the alpha mode of the layer
+  */
+
+static uint32_t layerPixel(DMA2D_LayerCfgTypeDef *cfg, const uint32_t *clut, uintptr_t address) {
+	uint32_t argb, a, alpha;
+
+	if(cfg->InputColorMode == DMA2D_INPUT_L8)
+		argb = clut[*(const uint8_t *)address];
+	else
+		argb = readPixel(address, cfg->InputColorMode, NULL, cfg->InputAlpha);
+	a = argb >> 24;
+
+	//A8 keeps its alpha value in the top byte of InputAlpha and the colour below it
+	alpha = (cfg->InputColorMode == DMA2D_INPUT_A8 || cfg->InputColorMode == DMA2D_INPUT_A4) ? cfg->InputAlpha >> 24 : cfg->InputAlpha & 0xFF;
+	if(cfg->AlphaMode == DMA2D_REPLACE_ALPHA)
+		a = alpha;
+	else if(cfg->AlphaMode == DMA2D_COMBINE_ALPHA)
+		a = a*alpha/255;
+	return (a << 24) | (argb & 0xFFFFFF);
+}
+
+HAL_StatusTypeDef HAL_DMA2D_Start(DMA2D_HandleTypeDef *hdma2d, uint32_t pdata, uint32_t DstAddress, uint32_t Width, uint32_t Height) {
+	uint32_t x, y, mode = hdma2d->Init.Mode, out_mode = hdma2d->Init.ColorMode, out_bpp = bytesPerPixel(out_mode);
+	DMA2D_LayerCfgTypeDef fg = hdma2d->LayerCfg[1];
+	uint32_t in_bpp = bytesPerPixel(fg.InputColorMode), lut[256];
+	uintptr_t dst = DstAddress, src = pdata;
+	uint8_t index;
+
+	//L8 goes through the CLUT with the alpha mode applied once a transfer, as the hardware looks it up
+	if(mode != DMA2D_R2M && fg.InputColorMode == DMA2D_INPUT_L8)
+		for(x = 0; x < 256; x++) {
+			index = x;
+			lut[x] = layerPixel(&fg, dma2d_clut[1], (uintptr_t)&index);
+		}
+
+	hostLcdStats.dma2d_transfers++;
+	for(y = 0; y < Height; y++) {
+		//A whole row of L8 to ARGB8888 inside the SDRAM is one lookup a pixel
+		x = 0;
+		if(mode != DMA2D_R2M && fg.InputColorMode == DMA2D_INPUT_L8 && out_mode == DMA2D_OUTPUT_ARGB8888 && inSdram(dst, 4*Width)) {
+			for(; x < Width; x++)
+				((uint32_t *)dst)[x] = lut[((const uint8_t *)src)[x]];
+			dst += 4*Width;
+			src += Width;
+		}
+		//A whole row copied in its own format inside the SDRAM is a block copy
+		if(mode == DMA2D_M2M && fg.InputColorMode == out_mode && fg.AlphaMode == DMA2D_NO_MODIF_ALPHA &&
+			 inSdram(src, in_bpp*Width) && inSdram(dst, out_bpp*Width)) {
+			memmove((void *)dst, (const void *)src, out_bpp*Width);
+			x = Width;
+			dst += out_bpp*Width;
+			src += in_bpp*Width;
+		}
+		for(; x < Width; x++) {
+			if(mode == DMA2D_R2M) {
+				writePixel(dst, out_mode, pdata);
+			} else if(fg.InputColorMode == DMA2D_INPUT_L8) {
+				writePixel(dst, out_mode, lut[*(const uint8_t *)src]);
+				src++;
+			} else {
+				writePixel(dst, out_mode, layerPixel(&fg, dma2d_clut[1], src));
+				src += in_bpp;
+			}
+			dst += out_bpp;
+		}
+		dst += hdma2d->Init.OutputOffset*out_bpp;
+		src += fg.InputOffset*in_bpp;
+	}
+	if(mode == DMA2D_R2M)
+		hostLcdStats.fill_pixels += (uint64_t)Width*Height;
+	else
+		hostLcdStats.copy_pixels += (uint64_t)Width*Height;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA2D_BlendingStart(DMA2D_HandleTypeDef *hdma2d, uint32_t SrcAddress1, uint32_t SrcAddress2, uint32_t DstAddress, uint32_t Width, uint32_t Height) {
+	DMA2D_LayerCfgTypeDef *fg_cfg = &hdma2d->LayerCfg[1], *bg_cfg = &hdma2d->LayerCfg[0];
+	uint32_t x, y, k, fg, bg, fa, ba, mult, oa, out;
+	uint32_t fg_bpp = bytesPerPixel(fg_cfg->InputColorMode), bg_bpp = bytesPerPixel(bg_cfg->InputColorMode);
+	uint32_t out_bpp = bytesPerPixel(hdma2d->Init.ColorMode);
+	uintptr_t fg_src = SrcAddress1, bg_src = SrcAddress2, dst = DstAddress;
+
+	hostLcdStats.dma2d_transfers++;
+	for(y = 0; y < Height; y++) {
+		for(x = 0; x < Width; x++) {
+			fg = layerPixel(fg_cfg, dma2d_clut[1], fg_src);
+			bg = layerPixel(bg_cfg, dma2d_clut[0], bg_src);
+			//Reference manual blending: Aout = Af + Ab - Af*Ab, Cout = (Cf*Af + Cb*Ab - Cb*Af*Ab)/Aout
+			fa = fg >> 24;
+			ba = bg >> 24;
+			mult = fa*ba/255;
+			oa = fa + ba - mult;
+			out = oa << 24;
+			if(oa) {
+				for(k = 0; k < 24; k += 8)
+					out |= ((((fg >> k) & 0xFF)*fa + ((bg >> k) & 0xFF)*ba - ((bg >> k) & 0xFF)*mult)/oa) << k;
+			}
+			writePixel(dst, hdma2d->Init.ColorMode, out);
+			fg_src += fg_bpp;
+			bg_src += bg_bpp;
+			dst += out_bpp;
+		}
+		fg_src += fg_cfg->InputOffset*fg_bpp;
+		bg_src += bg_cfg->InputOffset*bg_bpp;
+		dst += hdma2d->Init.OutputOffset*out_bpp;
+	}
+	hostLcdStats.blend_pixels += (uint64_t)Width*Height;
+	return HAL_OK;
+}
+
+/* LTDC ----------------------------------------------------------------------*/
+
+HAL_StatusTypeDef HAL_LTDC_ConfigLayer(LTDC_HandleTypeDef *hltdc, LTDC_LayerCfgTypeDef *pLayerCfg, uint32_t LayerIdx) {
+	hltdc->LayerCfg[LayerIdx] = *pLayerCfg;
+	ltdc_layer[LayerIdx] = *pLayerCfg;
+	ltdc_enabled[LayerIdx] = 1;
+	hostLcdStats.layer_reloads++;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_LTDC_SetAlpha(LTDC_HandleTypeDef *hltdc, uint32_t Alpha, uint32_t LayerIdx) {
+	hltdc->LayerCfg[LayerIdx].Alpha = Alpha;
+	ltdc_layer[LayerIdx].Alpha = Alpha;
+	hostLcdStats.layer_reloads++;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_LTDC_ConfigCLUT(LTDC_HandleTypeDef *hltdc, uint32_t *pCLUT, uint32_t CLUTSize, uint32_t LayerIdx) {
+	if(CLUTSize > 256) CLUTSize = 256;
+	memcpy(ltdc_clut[LayerIdx], pCLUT, CLUTSize*sizeof(uint32_t));
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_LTDC_EnableCLUT(LTDC_HandleTypeDef *hltdc, uint32_t LayerIdx) {
+	ltdc_clut_enabled[LayerIdx] = 1;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_LTDC_DisableCLUT(LTDC_HandleTypeDef *hltdc, uint32_t LayerIdx) {
+	ltdc_clut_enabled[LayerIdx] = 0;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_LTDC_SetAddress_NoReload(LTDC_HandleTypeDef *hltdc, uint32_t Address, uint32_t LayerIdx) {
+	//Only the shadow copy changes until HAL_LTDC_Reload()
+	hltdc->LayerCfg[LayerIdx].FBStartAdress = Address;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_LTDC_ProgramLineEvent(LTDC_HandleTypeDef *hltdc, uint32_t Line) {
+	//Busy without arming anything while a call from the main loop holds the handle
+	__HAL_LOCK(hltdc);
+	hltdc->Instance->LIPCR = Line;
+	__HAL_LTDC_ENABLE_IT(hltdc, LTDC_IT_LI);
+	__HAL_UNLOCK(hltdc);
+	return HAL_OK;
+}
+
+__weak void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef *hltdc) {
+}
+
+HAL_StatusTypeDef HAL_LTDC_Reload(LTDC_HandleTypeDef *hltdc, uint32_t ReloadType) {
+	uint32_t i;
+
+	//There is no scanout to wait for, vertical blanking reloads happen now
+	for(i = 0; i < HOST_LAYERS; i++)
+		ltdc_layer[i] = hltdc->LayerCfg[i];
+	hostLcdStats.layer_reloads++;
+	return HAL_OK;
+}
+
+/**
+  * @brief  Mix the enabled layers over the LTDC background the way the LTDC does
+  * @param  argb: 480x272 output pixels, alpha is always 0xFF
+  * @retval none
+  */
+
+void hostLcdCompose(uint32_t *argb) {
+	uint32_t x, y, i, k, pixel, factor, out;
+	uint32_t background = (hLtdcHandler.Init.Backcolor.Red << 16) | (hLtdcHandler.Init.Backcolor.Green << 8) | hLtdcHandler.Init.Backcolor.Blue;
+	LTDC_LayerCfgTypeDef *layer;
+	uintptr_t address;
+
+	for(y = 0; y < RK043FN48H_HEIGHT; y++) {
+		for(x = 0; x < RK043FN48H_WIDTH; x++) {
+			out = background;
+			for(i = 0; i < HOST_LAYERS; i++) {
+				layer = &ltdc_layer[i];
+				if(!ltdc_enabled[i])
+					continue;
+				if(x >= layer->WindowX0 && x < layer->WindowX1 && y >= layer->WindowY0 && y < layer->WindowY1) {
+					address = layer->FBStartAdress + ((y - layer->WindowY0)*layer->ImageWidth + (x - layer->WindowX0))*bytesPerPixel(layer->PixelFormat);
+					if(!inSdram(address, bytesPerPixel(layer->PixelFormat)))
+						continue;
+					pixel = readPixel(address, layer->PixelFormat, ltdc_clut_enabled[i] ? ltdc_clut[i] : NULL, 0);
+				} else {
+					//Outside the window the layer shows its default colour
+					pixel = (layer->Alpha0 << 24) | (layer->Backcolor.Red << 16) | (layer->Backcolor.Green << 8) | layer->Backcolor.Blue;
+				}
+				factor = (layer->BlendingFactor1 == LTDC_BLENDING_FACTOR1_CA) ? layer->Alpha : (pixel >> 24)*layer->Alpha/255;
+				for(k = 0; k < 24; k += 8)
+					out = (out & ~(0xFFu << k)) | (((((pixel >> k) & 0xFF)*factor + ((out >> k) & 0xFF)*(255 - factor))/255) << k);
+			}
+			argb[y*RK043FN48H_WIDTH + x] = 0xFF000000u | out;
+		}
+	}
+}
+
+/**
+  * @brief  Write the screen as a binary PPM image
+  * @param  path: file name
+  * @retval 0 = written, -1 = failed
+  */
+
+int hostLcdWritePPM(const char *path) {
+	static uint32_t screen[RK043FN48H_WIDTH*RK043FN48H_HEIGHT];
+	static uint8_t row[3*RK043FN48H_WIDTH];
+	uint32_t x, y, pixel;
+	FILE *file;
+
+	hostLcdCompose(screen);
+
+	file = fopen(path, "wb");
+	if(file == NULL)
+		return -1;
+	fprintf(file, "P6\n%d %d\n255\n", RK043FN48H_WIDTH, RK043FN48H_HEIGHT);
+	for(y = 0; y < RK043FN48H_HEIGHT; y++) {
+		for(x = 0; x < RK043FN48H_WIDTH; x++) {
+			pixel = screen[y*RK043FN48H_WIDTH + x];
+			row[3*x] = pixel >> 16;
+			row[3*x + 1] = pixel >> 8;
+			row[3*x + 2] = pixel;
+		}
+		fwrite(row, 1, sizeof(row), file);
+	}
+	return fclose(file) == 0 ? 0 : -1;
+}
+
+/* BSP LCD -------------------------------------------------------------------*/
+
+/**
+  * @brief  DMA2D register to memory fill in the pixel format of the layer, as LL_FillBuffer()
+  */
+
+static void fillBuffer(uint32_t LayerIndex, uint32_t pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex) {
+	DMA2D_HandleTypeDef hdma2d;
+
+	memset(&hdma2d, 0, sizeof(hdma2d));
+	hdma2d.Init.Mode = DMA2D_R2M;
+	hdma2d.Init.ColorMode = (hLtdcHandler.LayerCfg[LayerIndex].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) ? DMA2D_OUTPUT_RGB565 : DMA2D_OUTPUT_ARGB8888;
+	hdma2d.Init.OutputOffset = OffLine;
+	HAL_DMA2D_Start(&hdma2d, ColorIndex, pDst, xSize, ySize);
+}
+
+static uint32_t layerAddress(uint16_t Xpos, uint16_t Ypos) {
+	uint32_t bpp = (hLtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) ? 2 : 4;
+
+	return hLtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + bpp*(BSP_LCD_GetXSize()*Ypos + Xpos);
+}
+
+uint8_t BSP_LCD_Init(void) {
+	hostLcdOpen();
+	memset(&hLtdcHandler, 0, sizeof(hLtdcHandler));
+	memset(&LTDC_stub, 0, sizeof(LTDC_stub));
+	hLtdcHandler.Instance = &LTDC_stub;
+	hLtdcHandler.LayerCfg->ImageWidth = RK043FN48H_WIDTH;
+	hLtdcHandler.LayerCfg->ImageHeight = RK043FN48H_HEIGHT;
+	hLtdcHandler.State = HAL_LTDC_STATE_READY;
+	memset(ltdc_enabled, 0, sizeof(ltdc_enabled));
+	memset(ltdc_clut_enabled, 0, sizeof(ltdc_clut_enabled));
+	ActiveLayer = 0;
+	BSP_LCD_SetFont(&LCD_DEFAULT_FONT);
+	return LCD_OK;
+}
+
+uint32_t BSP_LCD_GetXSize(void) {
+	return hLtdcHandler.LayerCfg[ActiveLayer].ImageWidth;
+}
+
+uint32_t BSP_LCD_GetYSize(void) {
+	return hLtdcHandler.LayerCfg[ActiveLayer].ImageHeight;
+}
+
+static void layerInit(uint16_t LayerIndex, uint32_t FB_Address, uint32_t PixelFormat) {
+	LTDC_LayerCfgTypeDef layer_cfg;
+
+	memset(&layer_cfg, 0, sizeof(layer_cfg));
+	layer_cfg.WindowX0 = 0;
+	layer_cfg.WindowX1 = BSP_LCD_GetXSize();
+	layer_cfg.WindowY0 = 0;
+	layer_cfg.WindowY1 = BSP_LCD_GetYSize();
+	layer_cfg.PixelFormat = PixelFormat;
+	layer_cfg.FBStartAdress = FB_Address;
+	layer_cfg.Alpha = 255;
+	layer_cfg.Alpha0 = 0;
+	layer_cfg.BlendingFactor1 = LTDC_BLENDING_FACTOR1_PAxCA;
+	layer_cfg.BlendingFactor2 = LTDC_BLENDING_FACTOR2_PAxCA;
+	layer_cfg.ImageWidth = BSP_LCD_GetXSize();
+	layer_cfg.ImageHeight = BSP_LCD_GetYSize();
+	HAL_LTDC_ConfigLayer(&hLtdcHandler, &layer_cfg, LayerIndex);
+
+	DrawProp[LayerIndex].BackColor = LCD_COLOR_WHITE;
+	DrawProp[LayerIndex].pFont = &Font24;
+	DrawProp[LayerIndex].TextColor = LCD_COLOR_BLACK;
+}
+
+void BSP_LCD_LayerDefaultInit(uint16_t LayerIndex, uint32_t FB_Address) {
+	layerInit(LayerIndex, FB_Address, LTDC_PIXEL_FORMAT_ARGB8888);
+}
+
+void BSP_LCD_LayerRgb565Init(uint16_t LayerIndex, uint32_t FB_Address) {
+	layerInit(LayerIndex, FB_Address, LTDC_PIXEL_FORMAT_RGB565);
+}
+
+void BSP_LCD_SelectLayer(uint32_t LayerIndex) {
+	ActiveLayer = LayerIndex;
+}
+
+void BSP_LCD_SetLayerVisible(uint32_t LayerIndex, FunctionalState State) {
+	ltdc_enabled[LayerIndex] = (State == ENABLE);
+}
+
+void BSP_LCD_SetTransparency(uint32_t LayerIndex, uint8_t Transparency) {
+	HAL_LTDC_SetAlpha(&hLtdcHandler, Transparency, LayerIndex);
+}
+
+void BSP_LCD_DisplayOn(void) {
+}
+
+void BSP_LCD_DisplayOff(void) {
+}
+
+void BSP_LCD_SetTextColor(uint32_t Color) {
+	DrawProp[ActiveLayer].TextColor = Color;
+}
+
+uint32_t BSP_LCD_GetTextColor(void) {
+	return DrawProp[ActiveLayer].TextColor;
+}
+
+void BSP_LCD_SetBackColor(uint32_t Color) {
+	DrawProp[ActiveLayer].BackColor = Color;
+}
+
+uint32_t BSP_LCD_GetBackColor(void) {
+	return DrawProp[ActiveLayer].BackColor;
+}
+
+void BSP_LCD_SetFont(sFONT *fonts) {
+	DrawProp[ActiveLayer].pFont = fonts;
+}
+
+sFONT *BSP_LCD_GetFont(void) {
+	return DrawProp[ActiveLayer].pFont;
+}
+
+void BSP_LCD_Clear(uint32_t Color) {
+	fillBuffer(ActiveLayer, hLtdcHandler.LayerCfg[ActiveLayer].FBStartAdress, BSP_LCD_GetXSize(), BSP_LCD_GetYSize(), 0, Color);
+}
+
+void BSP_LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length) {
+	fillBuffer(ActiveLayer, layerAddress(Xpos, Ypos), Length, 1, 0, DrawProp[ActiveLayer].TextColor);
+}
+
+void BSP_LCD_DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length) {
+	fillBuffer(ActiveLayer, layerAddress(Xpos, Ypos), 1, Length, BSP_LCD_GetXSize() - 1, DrawProp[ActiveLayer].TextColor);
+}
+
+void BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height) {
+	fillBuffer(ActiveLayer, layerAddress(Xpos, Ypos), Width, Height, BSP_LCD_GetXSize() - Width, DrawProp[ActiveLayer].TextColor);
+}
+
+void BSP_LCD_DrawRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height) {
+	BSP_LCD_DrawHLine(Xpos, Ypos, Width);
+	BSP_LCD_DrawHLine(Xpos, (Ypos + Height), Width);
+	BSP_LCD_DrawVLine(Xpos, Ypos, Height);
+	BSP_LCD_DrawVLine((Xpos + Width), Ypos, Height);
+}
+
+void BSP_LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t RGB_Code) {
+	uintptr_t address = layerAddress(Xpos, Ypos);
+
+	hostLcdStats.cpu_pixels++;
+	//Like the BSP an RGB565 layer gets the low half of the colour, not a conversion
+	if(hLtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) {
+		if(inSdram(address, 2)) *(uint16_t *)address = (uint16_t)RGB_Code;
+		else hostLcdStats.out_of_range++;
+	} else {
+		if(inSdram(address, 4)) *(uint32_t *)address = RGB_Code;
+		else hostLcdStats.out_of_range++;
+	}
+}
+
+void BSP_LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+	int deltax = abs(x2 - x1), deltay = abs(y2 - y1);
+	int x = x1, y = y1, xinc = (x2 >= x1) ? 1 : -1, yinc = (y2 >= y1) ? 1 : -1;
+	int den, num, num_add, num_pixels, curpixel;
+	int major_x = (deltax >= deltay);
+
+	den = major_x ? deltax : deltay;
+	num = den/2;
+	num_add = major_x ? deltay : deltax;
+	num_pixels = den;
+	for(curpixel = 0; curpixel <= num_pixels; curpixel++) {
+		BSP_LCD_DrawPixel(x, y, DrawProp[ActiveLayer].TextColor);
+		num += num_add;
+		if(num >= den) {
+			num -= den;
+			if(major_x) y += yinc; else x += xinc;
+		}
+		if(major_x) x += xinc; else y += yinc;
+	}
+}
+
+static void drawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c) {
+	uint32_t i, j, line;
+	uint16_t height = DrawProp[ActiveLayer].pFont->Height;
+	uint16_t width = DrawProp[ActiveLayer].pFont->Width;
+	uint8_t offset = 8*((width + 7)/8) - width;
+	const uint8_t *pchar;
+
+	for(i = 0; i < height; i++) {
+		pchar = c + (width + 7)/8*i;
+		switch((width + 7)/8) {
+			case 1: line = pchar[0]; break;
+			case 2: line = (pchar[0] << 8) | pchar[1]; break;
+			default: line = (pchar[0] << 16) | (pchar[1] << 8) | pchar[2]; break;
+		}
+		for(j = 0; j < width; j++) {
+			if(line & (1 << (width - j + offset - 1)))
+				BSP_LCD_DrawPixel(Xpos + j, Ypos, DrawProp[ActiveLayer].TextColor);
+			else
+				BSP_LCD_DrawPixel(Xpos + j, Ypos, DrawProp[ActiveLayer].BackColor);
+		}
+		Ypos++;
+	}
+}
+
+void BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii) {
+	drawChar(Xpos, Ypos, &DrawProp[ActiveLayer].pFont->table[(Ascii - ' ')*
+		DrawProp[ActiveLayer].pFont->Height*((DrawProp[ActiveLayer].pFont->Width + 7)/8)]);
+}
+
+void BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_AlignModeTypdef Mode) {
+	uint16_t ref_column = 1, i = 0;
+	uint32_t size = 0, xsize;
+	uint16_t width = DrawProp[ActiveLayer].pFont->Width;
+	uint8_t *ptr = Text;
+
+	while(*ptr++) size++;
+	xsize = BSP_LCD_GetXSize()/width;
+
+	//Same wrap-around arithmetic as the BSP, long strings start at column 1
+	switch(Mode) {
+		case CENTER_MODE: ref_column = Xpos + ((xsize - size)*width)/2; break;
+		case RIGHT_MODE: ref_column = -Xpos + ((xsize - size)*width); break;
+		default: ref_column = Xpos; break;
+	}
+	if((ref_column < 1) || (ref_column >= 0x8000))
+		ref_column = 1;
+
+	while((*Text != 0) & (((BSP_LCD_GetXSize() - (i*width)) & 0xFFFF) >= width)) {
+		BSP_LCD_DisplayChar(ref_column, Ypos, *Text);
+		ref_column += width;
+		Text++;
+		i++;
+	}
+}
+
+void BSP_LCD_DisplayStringAtLine(uint16_t Line, uint8_t *ptr) {
+	BSP_LCD_DisplayStringAt(0, LINE(Line), ptr, LEFT_MODE);
+}
+
+void BSP_LCD_ClearStringLine(uint32_t Line) {
+	uint16_t height = DrawProp[ActiveLayer].pFont->Height;
+
+	fillBuffer(ActiveLayer, layerAddress(0, Line*height), BSP_LCD_GetXSize(), height, 0, DrawProp[ActiveLayer].BackColor);
+}
+
+void BSP_LCD_DrawBitmap(uint32_t Xpos, uint32_t Ypos, uint8_t *pbmp) {
+	uint32_t index, width, height, bit_pixel, mode, x, y;
+	uintptr_t address;
+
+	index = pbmp[10] + (pbmp[11] << 8) + (pbmp[12] << 16) + (pbmp[13] << 24);
+	width = pbmp[18] + (pbmp[19] << 8) + (pbmp[20] << 16) + (pbmp[21] << 24);
+	height = pbmp[22] + (pbmp[23] << 8) + (pbmp[24] << 16) + (pbmp[25] << 24);
+	bit_pixel = pbmp[28] + (pbmp[29] << 8);
+
+	//Like the BSP the bitmap is always written as ARGB8888, bottom row first
+	address = hLtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + ((BSP_LCD_GetXSize()*Ypos) + Xpos)*4;
+	mode = (bit_pixel/8 == 4) ? DMA2D_INPUT_ARGB8888 : (bit_pixel/8 == 2) ? DMA2D_INPUT_RGB565 : DMA2D_INPUT_RGB888;
+	pbmp += index + width*(height - 1)*(bit_pixel/8);
+
+	for(y = 0; y < height; y++) {
+		for(x = 0; x < width; x++)
+			writePixel(address + 4*x, DMA2D_OUTPUT_ARGB8888, readPixel((uintptr_t)(pbmp + x*(bit_pixel/8)), mode, NULL, 0));
+		hostLcdStats.dma2d_transfers++;
+		hostLcdStats.copy_pixels += width;
+		address += BSP_LCD_GetXSize()*4;
+		pbmp -= width*(bit_pixel/8);
+	}
+}
+
+/* BSP board -----------------------------------------------------------------*/
+
+uint8_t BSP_SDRAM_Init(void) {
+	hostLcdOpen();
+	return SDRAM_OK;
+}
+
+uint8_t BSP_QSPI_Init(void) {
+	return QSPI_OK;
+}
+
+uint8_t BSP_QSPI_Read(uint8_t *pData, uint32_t ReadAddr, uint32_t Size) {
+	if(ReadAddr > qspi_size || Size > qspi_size - ReadAddr)
+		return QSPI_ERROR;
+	memcpy(pData, qspi_image + ReadAddr, Size);
+	return QSPI_OK;
+}
+
+uint8_t BSP_SD_Init(void) {
+	return (sd_image != NULL) ? MSD_OK : MSD_ERROR_SD_NOT_PRESENT;
+}
+
+uint8_t BSP_SD_ReadBlocks(uint32_t *pData, uint32_t ReadAddr, uint32_t NumOfBlocks, uint32_t Timeout) {
+	if(ReadAddr > sd_size/BLOCKSIZE || NumOfBlocks > sd_size/BLOCKSIZE - ReadAddr)
+		return MSD_ERROR;
+	memcpy(pData, sd_image + ReadAddr*BLOCKSIZE, NumOfBlocks*BLOCKSIZE);
+	return MSD_OK;
+}
+
+uint8_t BSP_SD_GetCardState(void) {
+	return SD_TRANSFER_OK;
+}
+
+void BSP_PB_Init(Button_TypeDef Button, ButtonMode_TypeDef ButtonMode) {
+	button_exti = (ButtonMode == BUTTON_MODE_EXTI);
+}
+
+uint32_t BSP_PB_GetState(Button_TypeDef Button) {
+	return button_level;
+}
+
+uint8_t BSP_TS_Init(uint16_t ts_SizeX, uint16_t ts_SizeY) {
+	return TS_OK;
+}
+
+uint8_t BSP_TS_ITConfig(void) {
+	touch_exti = 1;
+	return TS_OK;
+}
+
+void BSP_TS_ITClear(void) {
+}
+
+uint8_t BSP_TS_GetState(TS_StateTypeDef *TS_State) {
+	*TS_State = touch_state;
+	return TS_OK;
+}
+
+void BSP_LED_Init(Led_TypeDef Led) {
+}
+
+void BSP_LED_On(Led_TypeDef Led) {
+}
+
+void BSP_LED_Off(Led_TypeDef Led) {
+}
+
+void BSP_LED_Toggle(Led_TypeDef Led) {
+}
+
+/* HAL -----------------------------------------------------------------------*/
+
+uint32_t HAL_GetTick(void) {
+	return (uint32_t)(hostLcdTimeUs()/1000u) + tick_offset;
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority) {
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn) {
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn) {
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init) {
+}
+
+__weak void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
+}
+
+void HAL_Delay(uint32_t Delay) {
+	struct timespec wait;
+
+	wait.tv_sec = Delay/1000u;
+	wait.tv_nsec = (long)(Delay%1000u)*1000000L;
+	nanosleep(&wait, NULL);
+}
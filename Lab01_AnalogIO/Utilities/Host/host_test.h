@@ -0,0 +1,57 @@
+/**
+  ******************************************************************************
+  * @file    host_test.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for host_test.c module
+  *
+  *          Checks for the host tests in Tests/, built and run by the
+  *          Makefile next to this file:
+  *
+  *          make test       build and run every test, fails when one of them does
+  *          make golden     run them and write the frames they draw to Golden/
+  *          make bench      run them and print the timings as well
+  *
+  *          A test checks values with HOST_CHECK() and the screen with
+  *          hostCheckFrame(), which compares it pixel for pixel with the PPM
+  *          of the same name in Golden/. The frames were drawn by gcc on
+  *          x86-64, another compiler or C library may round a pixel the
+  *          other way, make golden then takes its frames as the reference.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __HOST_TEST_H
+#define __HOST_TEST_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_lcd.h"
+#include <stdio.h>
+
+/* Exported constants --------------------------------------------------------*/
+#ifndef HOST_GOLDEN_DIR
+#define HOST_GOLDEN_DIR       "Golden/"		//Reference frames
+#endif
+#ifndef HOST_OUTPUT_DIR
+#define HOST_OUTPUT_DIR       "Build/"		//Frames drawn by the last run
+#endif
+
+/* Exported macros -----------------------------------------------------------*/
+/**
+  * @brief  Check a condition, print the message and the place when it fails, e.g.
+  *         HOST_CHECK(error < 1e-4, "error %g", error);
+  */
+#define HOST_CHECK(condition, ...) hostCheck((condition) != 0, __FILE__, __LINE__, __VA_ARGS__)
+
+/* Exported functions ------------------------------------------------------- */
+void hostTestBegin(const char *name);
+int hostTestEnd(void);
+int hostCheck(int passed, const char *file, int line, const char *format, ...);
+int hostCheckFrame(const char *frame);
+int hostBenchmark(void);
+uint32_t hostRandom(void);
+float hostUniform(void);
+float hostGauss(void);
+double hostSnr(double signal, double error);
+
+#endif /* __HOST_TEST_H */
@@ -0,0 +1,44 @@
+/**
+  ******************************************************************************
+  * @file    lcd_log_conf.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   lcd_log configuration of the host build, see host_lcd.h. It
+  *          follows Utilities/Log/lcd_log_conf_template.h with the log on
+  *          the graph layer.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __LCD_LOG_CONF_H__
+#define __LCD_LOG_CONF_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32746g_discovery_lcd.h"
+
+/* Scroll back and forward */
+#define LCD_SCROLL_ENABLED              1
+
+/* Fonts */
+#define LCD_LOG_HEADER_FONT             Font16
+#define LCD_LOG_FOOTER_FONT             Font12
+#define LCD_LOG_TEXT_FONT               Font12
+
+/* Colours */
+#define LCD_LOG_BACKGROUND_COLOR        LCD_COLOR_WHITE
+#define LCD_LOG_TEXT_COLOR              LCD_COLOR_DARKBLUE
+#define LCD_LOG_SOLID_BACKGROUND_COLOR  LCD_COLOR_BLUE
+#define LCD_LOG_SOLID_TEXT_COLOR        LCD_COLOR_WHITE
+
+/* Layer the log is drawn on */
+#define LCD_LOG_LAYER                   1
+
+/* Cache depth */
+#define CACHE_SIZE                      100
+#define YWINDOW_SIZE                    17
+
+/* printf() goes to the LCD through __io_putchar() */
+#define LCD_LOG_PUTCHAR int __io_putchar(int ch)
+int __io_putchar(int ch);
+
+#endif /* __LCD_LOG_CONF_H__ */
@@ -69,6 +69,11 @@
   * @{
   */ 
 
+/* Layer the log is drawn on, the one selected with BSP_LCD_SelectLayer() */
+#ifndef LCD_LOG_LAYER
+ #define     LCD_LOG_LAYER       0
+#endif
+
 #if (LCD_SCROLL_ENABLED == 1)
  #define     LCD_CACHE_DEPTH     (YWINDOW_SIZE + CACHE_SIZE)
 #else
@@ -97,21 +102,21 @@ typedef struct _LCD_LOG_line
   */ 
 #define  LCD_ErrLog(...)    do { \
                                  LCD_LineColor = LCD_COLOR_RED;\
-                                 printf("ERROR: ") ;\
-                                 printf(__VA_ARGS__);\
-                                 LCD_LineColor = LCD_LOG_DEFAULT_COLOR;\
+                                 LCD_LOG_Printf("ERROR: ") ;\
+                                 LCD_LOG_Printf(__VA_ARGS__);\
+                                 LCD_LineColor = LCD_LOG_TEXT_COLOR;\
                                }while (0)
 
 #define  LCD_UsrLog(...)    do { \
 	                             LCD_LineColor = LCD_LOG_TEXT_COLOR;\
-                                 printf(__VA_ARGS__);\
+                                 LCD_LOG_Printf(__VA_ARGS__);\
                                } while (0)
 
 
 #define  LCD_DbgLog(...)    do { \
                                  LCD_LineColor = LCD_COLOR_CYAN;\
-                                 printf(__VA_ARGS__);\
-                                 LCD_LineColor = LCD_LOG_DEFAULT_COLOR;\
+                                 LCD_LOG_Printf(__VA_ARGS__);\
+                                 LCD_LineColor = LCD_LOG_TEXT_COLOR;\
                                }while (0)
 /**
   * @}
@@ -135,6 +140,8 @@ void LCD_LOG_SetHeader(uint8_t *Title);
 void LCD_LOG_SetFooter(uint8_t *Status);
 void LCD_LOG_ClearTextZone(void);
 void LCD_LOG_UpdateDisplay (void);
+void LCD_LOG_Write(const uint8_t *text, uint32_t length);
+void LCD_LOG_Printf(const char *format, ...);
 
 #if (LCD_SCROLL_ENABLED == 1)
  ErrorStatus LCD_LOG_ScrollBack(void);
@@ -81,6 +81,9 @@
 #define     LCD_LOG_SOLID_BACKGROUND_COLOR        LCD_COLOR_BLUE
 #define     LCD_LOG_SOLID_TEXT_COLOR              LCD_COLOR_WHITE
 
+/* Define the layer the log is drawn on, 0 when not defined */
+/* #define     LCD_LOG_LAYER                      1 */
+
 /* Define the cache depth */
 #define     CACHE_SIZE              100
 #define     YWINDOW_SIZE            17
@@ -0,0 +1,78 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_spectrum.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_spectrum.c module
+  *
+  *          Welch average of 8 frames of 1024 points, half overlapped, of the
+  *          left slot of the interleaved buffer:
+  *
+  *          static Spectrum sp;
+  *          static float32_t memory[SPECTRUM_MEMORY(1024)], level[512];
+  *          spectrumInit(&sp, 1024, 512, SPECTRUM_HANN, AVERAGE_LINEAR, 8, memory);
+  *          ...
+  *          void process_half(int16_t *buf, uint32_t ns)
+  *          {
+  *            if(spectrumAddQ15(&sp, buf, ns/2, 2, level))
+  *              plotLogFFT(level, 512, LIVE);
+  *          }
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_SPECTRUM_H
+#define __STM32F7_SPECTRUM_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_fft.h"
+#include "stm32f7_persist.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define SPECTRUM_MIN_SIZE     FFT_MIN_SIZE
+#define SPECTRUM_MAX_SIZE     (2*AVERAGE_MAX_BINS)
+
+#define SPECTRUM_HANN         0					//1.5 bins noise bandwidth, 1.42 dB scalloping
+#define SPECTRUM_BLACKMAN     1					//4 term Blackman-Harris, -92 dB side lobes
+#define SPECTRUM_FLATTOP      2					//Tone levels within 0.02 dB anywhere in a bin
+
+#define SPECTRUM_FLOOR_DB     -200.0f		//dBFS of an empty bin
+
+/**
+  * @brief  Floats of memory for a spectrum of frame_len points, the window,
+  * the input history and the FFT buffer
+  */
+#define SPECTRUM_MEMORY(frame_len) (3*(frame_len))
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Streaming spectrum estimate
+  * Samples go into a history of one frame, every hop samples the frame is
+  * windowed and transformed whatever the size of the blocks that came in.
+  * The magnitudes are averaged as power, over frames for Welch's method
+  * (AVERAGE_LINEAR) or with an exponential weight (AVERAGE_EXPONENTIAL).
+  * The window is scaled so that a full scale sine gives a magnitude of 1,
+  * 0 dBFS, at its bin.
+  */
+typedef struct
+{
+	RealFft fft;
+	uint32_t frame_len;					//Points per FFT
+	uint32_t hop;								//New samples per FFT, frame_len minus the overlap
+	uint32_t due;								//Samples until the next FFT
+	uint32_t index;							//Where the next sample goes in the history
+	float32_t *window;					//frame_len, scaled for dBFS
+	float32_t *history;					//frame_len, oldest at index
+	float32_t *work;						//frame_len
+	float32_t enbw;							//Noise bandwidth of the window in bins
+	Average average;
+} Spectrum;
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef spectrumInit(Spectrum *sp, uint32_t frame_len, uint32_t hop, uint8_t window, uint8_t average_mode, uint32_t frames, float32_t *memory);
+void spectrumReset(Spectrum *sp);
+int spectrumAddQ15(Spectrum *sp, const int16_t *data, uint32_t n, uint32_t stride, float32_t *out);
+int spectrumAddF32(Spectrum *sp, const float32_t *data, uint32_t n, uint32_t stride, float32_t *out);
+void spectrumDbfs(const float32_t *magnitude, float32_t *dbfs, uint32_t n);
+
+#endif /* __STM32F7_SPECTRUM_H */
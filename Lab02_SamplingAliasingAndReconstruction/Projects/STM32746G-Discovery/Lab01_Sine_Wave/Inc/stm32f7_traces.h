@@ -0,0 +1,45 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_traces.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_traces.c module
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_TRACES_H
+#define __STM32F7_TRACES_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_envelope.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define TRACE_MAX             4				//Most traces in one plot
+
+/**
+  * @brief  Off screen graph start address
+  * The graph is composed in SDRAM after the decoded image (0xC06A0000), one
+  * L8 byte per pixel, GRAPH_WIDTH pixels a row down to the bottom of the graph.
+  */
+#define TRACE_BUFFER          ((uint32_t)(SDRAM_DEVICE_ADDR + 0x006C0000))
+
+//Trace styles
+#define TRACE_BARS            0				//Bars from the centre line, like plotWave()
+#define TRACE_LINE            1				//Samples joined by a line
+#define TRACE_DOTS            2				//Samples only
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+	float32_t *data;
+	uint32_t num_samples;
+	uint32_t colour;					//ARGB8888
+	uint8_t style;						//TRACE_BARS, TRACE_LINE or TRACE_DOTS
+} Trace;
+
+/* Exported functions ------------------------------------------------------- */
+void plotTraces(const Trace *traces, int num_traces, int live);
+void plotEnvelopes(const Envelope *envelopes, const Trace *traces, int num_traces, float32_t max, float32_t min, int size);
+
+#endif /* __STM32F7_TRACES_H */
@@ -0,0 +1,63 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_capture.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_capture.c module
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_CAPTURE_H
+#define __STM32F7_CAPTURE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_traces.h"
+#include "stm32746g_discovery_ts.h"
+
+/* Exported constants --------------------------------------------------------*/
+/**
+  * @brief  Min/max pyramid start address
+  * The pyramid lives in SDRAM after the waterfall ring (0xC0600000), the
+  * persistence buffer (0xC0680000), the vector scope buffer (0xC0690000), the
+  * decoded image (0xC06A0000) and the off screen traces (0xC06C0000) up to
+  * the end of the SDRAM, one min/max pair per entry, level after level.
+  */
+#define CAPTURE_PYRAMID_BUFFER  ((uint32_t)(SDRAM_DEVICE_ADDR + 0x00700000))
+#define CAPTURE_PYRAMID_SIZE    ((uint32_t)0x00100000)
+
+#define CAPTURE_MAX_LEVELS      24				//Level 0 is the samples, level l has one entry per 2^l samples
+#define CAPTURE_MIN_SPAN        32				//Fewest samples shown across the graph
+#define CAPTURE_MIN_PINCH       16				//Closest finger spacing in pixels used for zooming
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+	int16_t min;
+	int16_t max;
+} CaptureMinMax;
+
+typedef struct
+{
+	const int16_t *samples;
+	uint32_t num_samples;				//Size of the capture buffer
+	uint32_t length;						//Samples added to the pyramid so far
+	uint32_t num_levels;
+	CaptureMinMax *level[CAPTURE_MAX_LEVELS];
+	uint32_t start;							//First sample shown
+	uint32_t span;							//Samples shown across the graph
+	uint8_t touches;						//Fingers down at the start of the gesture
+	uint16_t touch_x[2];				//Finger positions at the start of the gesture
+	uint32_t touch_start;				//View at the start of the gesture
+	uint32_t touch_span;
+} Capture;
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef captureInit(Capture *cap, const int16_t *samples, uint32_t num_samples);
+void captureAppend(Capture *cap, uint32_t length);
+void captureMinMax(const Capture *cap, uint32_t first, uint32_t last, int16_t *min, int16_t *max);
+void captureSetView(Capture *cap, uint32_t start, uint32_t span);
+int captureTouch(Capture *cap);
+void plotCapture(Capture *cap, uint32_t colour);
+
+#endif /* __STM32F7_CAPTURE_H */
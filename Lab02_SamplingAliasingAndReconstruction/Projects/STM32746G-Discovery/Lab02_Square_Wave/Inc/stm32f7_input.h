@@ -0,0 +1,63 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_input.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_input.c module
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_INPUT_H
+#define __STM32F7_INPUT_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7xx_hal.h"
+#include "stm32746g_discovery.h"
+#include "stm32746g_discovery_ts.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define INPUT_QUEUE_SIZE      16				//Events held until read, a power of 2
+#define INPUT_DEBOUNCE_MS     20				//Edges this soon after an accepted one are bounce
+#define INPUT_TOUCH_PERIOD_MS 10				//Touch controller read at most this often
+
+#define INPUT_NONE            0
+#define INPUT_BUTTON_PRESS    1
+#define INPUT_BUTTON_RELEASE  2
+#define INPUT_TOUCH_DOWN      3				//First finger down
+#define INPUT_TOUCH_MOVE      4				//Fingers moved or their number changed
+#define INPUT_TOUCH_UP        5				//Last finger lifted
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+	uint8_t type;								//INPUT_BUTTON_PRESS, ...
+	uint8_t touches;						//Fingers down, touch events only
+	uint16_t x;									//First finger, touch events only
+	uint16_t y;
+	uint32_t tick;							//HAL_GetTick() when the event was seen
+} InputEvent;
+
+/**
+  * @brief  Debounced state of a switch
+  * An edge is taken at once when the last accepted one is INPUT_DEBOUNCE_MS
+  * old, the edges in between are bounce. A level that settled differently
+  * during that time is taken by the next debounceUpdate() call.
+  */
+typedef struct
+{
+	uint8_t state;							//Debounced level, 1 pressed
+	uint32_t tick;							//HAL_GetTick() of the last accepted edge
+} Debounce;
+
+/* Exported functions ------------------------------------------------------- */
+void inputInit(void);
+void debounceInit(Debounce *db, uint8_t level, uint32_t now);
+uint8_t debounceUpdate(Debounce *db, uint8_t level, uint32_t now);
+void inputPoll(void);
+int inputGetEvent(InputEvent *event);
+int inputButtonPressed(void);
+int inputGetTouch(TS_StateTypeDef *ts);
+uint32_t inputDropped(void);
+
+#endif /* __STM32F7_INPUT_H */
@@ -0,0 +1,229 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_envelope.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides a streaming min/max (peak envelope) decimator
+  *					 which maps any number of samples onto the GRAPH_WIDTH columns
+  *					 of the graph in one pass, and draws the result.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_envelope.h"
+#include <float.h>
+
+/**
+  * @brief  First sample index that belongs to column+1
+  * @param  env: envelope
+  * @param  column: graph column
+  * @retval ceil((column+1)*num_samples/GRAPH_WIDTH)
+  */
+
+static uint32_t columnEdge(const Envelope *env, uint32_t column) {
+	uint64_t edge = (uint64_t)(column + 1) * env->num_samples + GRAPH_WIDTH - 1;
+
+	return (uint32_t)(edge / GRAPH_WIDTH);
+}
+
+/**
+  * @brief  Move to the column the next sample belongs to, skipping the
+  *					columns that get no sample when num_samples < GRAPH_WIDTH
+  * @param  env: envelope
+  * @retval none
+  */
+
+static void nextColumn(Envelope *env) {
+	while(env->count >= env->next_edge && env->column < GRAPH_WIDTH - 1) {
+		env->column++;
+		env->next_edge = columnEdge(env, env->column);
+	}
+}
+
+/**
+  * @brief  Start a new envelope, every column is marked empty
+  * @param  env: envelope
+  * @param  num_samples: number of samples that will be added
+  * @retval none
+  */
+
+void envelopeInit(Envelope *env, uint32_t num_samples) {
+	uint32_t i;
+
+	env->num_samples = num_samples;
+	env->count = 0;
+	env->column = 0;
+	env->next_edge = columnEdge(env, 0);
+
+	for(i = 0; i < GRAPH_WIDTH; i++) {
+		env->min[i] = FLT_MAX;
+		env->max[i] = -FLT_MAX;
+	}
+	nextColumn(env);
+}
+
+/**
+  * @brief  Add Q15 samples to the envelope, may be called with any block size
+  *					Two samples are compared per instruction when the DSP extension is present.
+  * @param  env: envelope
+  * @param  data: samples
+  * @param  n: number of samples, anything past num_samples is ignored
+  * @retval none
+  */
+
+void envelopeAddQ15(Envelope *env, const int16_t *data, uint32_t n) {
+	uint32_t run, k;
+	int16_t lo, hi;
+
+	while(n > 0 && env->count < env->num_samples) {
+		//Number of samples left in the current column
+		run = env->next_edge - env->count;
+		if(run > n) run = n;
+
+		lo = data[0];
+		hi = data[0];
+		k = 1;
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+		if(run >= 5) {
+			uint32_t pair, pmin, pmax;
+
+			memcpy(&pmin, &data[1], 4);
+			pmax = pmin;
+			for(k = 3; k + 1 < run; k += 2) {
+				memcpy(&pair, &data[k], 4);
+				//GE flags set per halfword where pair >= pmax, then select
+				__SSUB16(pair, pmax);
+				pmax = __SEL(pair, pmax);
+				__SSUB16(pmin, pair);
+				pmin = __SEL(pair, pmin);
+			}
+			if((int16_t)pmin < lo) lo = (int16_t)pmin;
+			if((int16_t)(pmin >> 16) < lo) lo = (int16_t)(pmin >> 16);
+			if((int16_t)pmax > hi) hi = (int16_t)pmax;
+			if((int16_t)(pmax >> 16) > hi) hi = (int16_t)(pmax >> 16);
+		}
+#endif
+		for(; k < run; k++) {
+			if(data[k] < lo) lo = data[k];
+			if(data[k] > hi) hi = data[k];
+		}
+
+		if(lo < env->min[env->column]) env->min[env->column] = lo;
+		if(hi > env->max[env->column]) env->max[env->column] = hi;
+
+		data += run;
+		n -= run;
+		env->count += run;
+		nextColumn(env);
+	}
+}
+
+/**
+  * @brief  Add floating point samples to the envelope, may be called with any block size
+  * @param  env: envelope
+  * @param  data: samples
+  * @param  n: number of samples, anything past num_samples is ignored
+  * @retval none
+  */
+
+void envelopeAddF32(Envelope *env, const float32_t *data, uint32_t n) {
+	uint32_t run, k;
+	float32_t lo0, hi0, lo1, hi1;
+
+	while(n > 0 && env->count < env->num_samples) {
+		run = env->next_edge - env->count;
+		if(run > n) run = n;
+
+		//Two independent chains so the FPU compares can overlap
+		lo0 = hi0 = lo1 = hi1 = data[0];
+		for(k = 1; k + 1 < run; k += 2) {
+			if(data[k] < lo0) lo0 = data[k];
+			if(data[k] > hi0) hi0 = data[k];
+			if(data[k + 1] < lo1) lo1 = data[k + 1];
+			if(data[k + 1] > hi1) hi1 = data[k + 1];
+		}
+		if(k < run) {
+			if(data[k] < lo0) lo0 = data[k];
+			if(data[k] > hi0) hi0 = data[k];
+		}
+		if(lo1 < lo0) lo0 = lo1;
+		if(hi1 > hi0) hi0 = hi1;
+
+		if(lo0 < env->min[env->column]) env->min[env->column] = lo0;
+		if(hi0 > env->max[env->column]) env->max[env->column] = hi0;
+
+		data += run;
+		n -= run;
+		env->count += run;
+		nextColumn(env);
+	}
+}
+
+/**
+  * @brief  Check whether all the samples have been added
+  * @param  env: envelope
+  * @retval 1 = complete, 0 = more samples expected
+  */
+
+int envelopeComplete(const Envelope *env) {
+	return env->count >= env->num_samples;
+}
+
+/**
+  * @brief  Get the smallest and largest sample of the envelope
+  * @param  env: envelope
+  * @param  min: smallest sample, 0 if the envelope is empty
+  * @param  max: largest sample, 0 if the envelope is empty
+  * @retval none
+  */
+
+void envelopeRange(const Envelope *env, float32_t *min, float32_t *max) {
+	uint32_t i;
+	float32_t lo = FLT_MAX, hi = -FLT_MAX;
+
+	for(i = 0; i < GRAPH_WIDTH; i++) {
+		if(env->min[i] > env->max[i]) continue;
+		if(env->min[i] < lo) lo = env->min[i];
+		if(env->max[i] > hi) hi = env->max[i];
+	}
+	if(lo > hi) lo = hi = 0;
+
+	*min = lo;
+	*max = hi;
+}
+
+/**
+  * @brief  Draw one bar per column from ycentre to the column extremes
+  * @param  env: envelope
+  * @param  ycentre: pixel y location of the 0 value
+  * @param  yscalefactor: pixels per unit of sample value
+  * @param  colour: bar colour
+  * @param  clear: 1 = clear the column before drawing the bar
+  * @retval none
+  */
+
+void drawEnvelope(const Envelope *env, int ycentre, float32_t yscalefactor, uint32_t colour, int clear) {
+	uint32_t i;
+	int top, bottom;
+
+	for(i = 0; i < GRAPH_WIDTH; i++) {
+		if(clear) {
+			BSP_LCD_SetTextColor(BACKGROUND_COLOUR);
+			BSP_LCD_DrawVLine(FIRST_DATA_PIXEL + i, 0, GRAPH_VER_END_PIXEL + 2);
+		}
+		if(env->min[i] > env->max[i]) continue;
+
+		top = ycentre - (int)(env->max[i]*yscalefactor);
+		bottom = ycentre - (int)(env->min[i]*yscalefactor);
+		if(top > ycentre) top = ycentre;
+		if(bottom < ycentre) bottom = ycentre;
+
+		//Safety measure to avoid the bars go outside the grid area
+		if(top < HEADER_HEIGHT) top = HEADER_HEIGHT;
+		if(bottom > GRAPH_VER_END_PIXEL) bottom = GRAPH_VER_END_PIXEL;
+		if(top > bottom) continue;
+
+		BSP_LCD_SetTextColor(colour);
+		BSP_LCD_DrawVLine(FIRST_DATA_PIXEL + i, top, bottom - top + 1);
+	}
+}
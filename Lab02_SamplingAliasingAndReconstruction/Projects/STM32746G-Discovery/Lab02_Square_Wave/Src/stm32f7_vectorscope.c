@@ -0,0 +1,303 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_vectorscope.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides an XY display of two signals, left against
+  *					 right or input against output, for phase and stereo analysis.
+  *					 Every sample pair lights one pixel of an L8 intensity buffer
+  *					 as it arrives, so the cost per pair is a few instructions and
+  *					 can run in the audio callbacks. plotVectorScope() fades the
+  *					 buffer like the persistence display and copies it to the
+  *					 graph layer with one DMA2D transfer.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_vectorscope.h"
+
+#define VECTOR_LEFT           (GRAPH_WIDTH/2 - VECTOR_HALF)		//First column of the square
+#define VECTOR_SQRT1_2        46341														//1/sqrt(2), 16.16 fixed point
+
+extern LTDC_HandleTypeDef hLtdcHandler;
+
+static DMA2D_HandleTypeDef hDma2dVector;
+static uint32_t vector_clut[256];
+
+/**
+  * @brief  Phosphor colours from the background at 0 to the graph colour at 255
+  * @param  none
+  * @retval none
+  */
+
+static void buildPalette(void) {
+	uint32_t i, c, shift, back, fore, colour;
+
+	for(i = 0; i < 256; i++) {
+		colour = 0xFF000000u;
+		for(shift = 0; shift < 24; shift += 8) {
+			back = (BACKGROUND_COLOUR >> shift) & 0xFF;
+			fore = (GRAPH_COLOUR >> shift) & 0xFF;
+			c = (back*(255 - i) + fore*i + 127)/255;
+			colour |= c << shift;
+		}
+		vector_clut[i] = colour;
+	}
+}
+
+/**
+  * @brief  Set up a vector scope, the square starts dark
+  * @param  vs: vector scope
+  * @param  mode: VECTOR_XY or VECTOR_MS
+  * @param  range: amplitude at the edges of the square
+  * @retval none
+  */
+
+void vectorScopeInit(VectorScope *vs, uint8_t mode, int16_t range) {
+	if(range < 1) range = 1;
+	vs->mode = (mode == VECTOR_MS) ? VECTOR_MS : VECTOR_XY;
+	vs->range = range;
+	vs->scale = (VECTOR_HALF << 16)/range;
+	vs->labelled = 0;
+	vs->correlation = 0;
+
+	buildPalette();
+	clearVectorScope(vs);
+}
+
+/**
+  * @brief  Forget every point drawn so far
+  * @param  vs: vector scope
+  * @retval none
+  */
+
+void clearVectorScope(VectorScope *vs) {
+	memset((void *)VECTOR_BUFFER, 0, GRAPH_WIDTH*VECTOR_ROWS);
+	vs->top = 0;
+	vs->bottom = VECTOR_ROWS - 1;
+	vs->sum_xy = 0;
+	vs->sum_xx = 0;
+	vs->sum_yy = 0;
+}
+
+/**
+  * @brief  Light the pixel of each sample pair, points outside the range stay
+  *					on the edge of the square so overload shows
+  * @param  vs: vector scope
+  * @param  x: first horizontal sample
+  * @param  y: first vertical sample
+  * @param  stride: samples from one pair to the next, 2 for interleaved frames
+  * @param  n: number of pairs
+  * @retval none
+  */
+
+static void addPoints(VectorScope *vs, const int16_t *x, const int16_t *y, uint32_t stride, uint32_t n) {
+	uint8_t *image = (uint8_t *)VECTOR_BUFFER;
+	int32_t a, b, h, v, column, row, scale = vs->scale;
+	int32_t top = vs->top, bottom = vs->bottom;
+	int64_t sum_xy = 0, sum_xx = 0, sum_yy = 0;
+	uint32_t i;
+
+	//The side and mid axes are 1/sqrt(2) of the sum and difference so a pure left signal keeps its length
+	if(vs->mode == VECTOR_MS)
+		scale = (int32_t)(((int64_t)scale*VECTOR_SQRT1_2) >> 16);
+
+	for(i = 0; i < n; i++, x += stride, y += stride) {
+		a = *x;
+		b = *y;
+		sum_xy += a*b;
+		sum_xx += a*a;
+		sum_yy += b*b;
+
+		if(vs->mode == VECTOR_MS) {
+			h = b - a;
+			v = a + b;
+		} else {
+			h = a;
+			v = b;
+		}
+		column = VECTOR_HALF + (int32_t)(((int64_t)h*scale) >> 16);
+		row = VECTOR_HALF - (int32_t)(((int64_t)v*scale) >> 16);
+		if(column < 0) column = 0;
+		if(column > 2*VECTOR_HALF) column = 2*VECTOR_HALF;
+		if(row < 0) row = 0;
+		if(row > 2*VECTOR_HALF) row = 2*VECTOR_HALF;
+
+		image[row*GRAPH_WIDTH + VECTOR_LEFT + column] = 255;
+		if(row < top) top = row;
+		if(row > bottom) bottom = row;
+	}
+
+	vs->top = top;
+	vs->bottom = bottom;
+	vs->sum_xy += sum_xy;
+	vs->sum_xx += sum_xx;
+	vs->sum_yy += sum_yy;
+}
+
+/**
+  * @brief  Add interleaved stereo frames, left then right, as the audio
+  *					DMA buffers hold them
+  * @param  vs: vector scope
+  * @param  frames: n left and right sample pairs
+  * @param  n: number of frames
+  * @retval none
+  */
+
+void vectorScopeAddStereo(VectorScope *vs, const int16_t *frames, uint32_t n) {
+	addPoints(vs, frames, frames + 1, 2, n);
+}
+
+/**
+  * @brief  Add two separate buffers, e.g. the input and output of a filter
+  * @param  vs: vector scope
+  * @param  x: n horizontal (left) samples
+  * @param  y: n vertical (right) samples
+  * @param  n: number of samples
+  * @retval none
+  */
+
+void vectorScopeAddPair(VectorScope *vs, const int16_t *x, const int16_t *y, uint32_t n) {
+	addPoints(vs, x, y, 1, n);
+}
+
+/**
+  * @brief  Fade every pixel of the rows still lit and find which ones stay lit,
+  *					four pixels per word like the persistence display
+  * @param  vs: vector scope
+  * @param  shift: decay shift
+  * @retval none
+  */
+
+static void decayRows(VectorScope *vs, uint8_t shift) {
+	uint32_t *word, w, lit;
+	uint32_t mask = (0xFFu >> shift)*0x01010101u;
+	int16_t row, top = VECTOR_ROWS, bottom = -1;
+	int16_t old_top = vs->top, old_bottom = vs->bottom;
+	int i;
+
+	for(row = old_top; row <= old_bottom; row++) {
+		word = (uint32_t *)(VECTOR_BUFFER + (uint32_t)row*GRAPH_WIDTH + VECTOR_LEFT);
+		lit = 0;
+		//The square starts on a word boundary, (2*VECTOR_HALF + 1 + 3)/4 words cover it
+		for(i = 0; i < (2*VECTOR_HALF + 4)/4; i++) {
+			w = word[i];
+			if(w == 0)
+				continue;
+			w -= (w >> shift) & mask;
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+			w = __UQSUB8(w, 0x01010101u);
+#else
+			//Subtract one from the non zero bytes
+			w -= ((w | ((w & 0x7F7F7F7Fu) + 0x7F7F7F7Fu)) >> 7) & 0x01010101u;
+#endif
+			word[i] = w;
+			lit |= w;
+		}
+		if(lit) {
+			if(row < top) top = row;
+			bottom = row;
+		}
+	}
+
+	//Keep the rows an audio callback lit during the fade
+	if(vs->top < old_top && vs->top < top) top = vs->top;
+	if(vs->bottom > old_bottom && vs->bottom > bottom) bottom = vs->bottom;
+	vs->top = top;
+	vs->bottom = bottom;
+}
+
+/**
+  * @brief  Axis names, the ends of the range and the correlation
+  * @param  vs: vector scope
+  * @retval none
+  */
+
+static void drawLabels(VectorScope *vs) {
+	char text[LABEL_MAX_LEN + 1];
+
+	BSP_LCD_SetFont(&Font12);
+	BSP_LCD_SetTextColor(TEXT_COLOUR);
+	BSP_LCD_SetBackColor(BACKGROUND_COLOUR);
+	if(!vs->labelled) {
+		clearLabels();
+		vs->labelled = 1;
+	}
+
+	drawLabel(0, 0, (vs->mode == VECTOR_MS) ? "mid" : "right", LEFT_MODE);
+	drawLabel(20, GRAPH_VER_END_PIXEL - 15, (vs->mode == VECTOR_MS) ? "side" : "left", RIGHT_MODE);
+	formatInt(text, vs->range);
+	drawLabel(0, HEADER_HEIGHT, text, LEFT_MODE);
+	drawLabel(FIRST_DATA_PIXEL + VECTOR_LEFT + 2*VECTOR_HALF, GRAPH_VER_END_PIXEL + 2, text, LEFT_MODE);
+	formatInt(text, -vs->range);
+	drawLabel(0, GRAPH_VER_END_PIXEL - 12, text, LEFT_MODE);
+	drawLabel(FIRST_DATA_PIXEL + VECTOR_LEFT, GRAPH_VER_END_PIXEL + 2, text, LEFT_MODE);
+
+	//+1 in phase, 0 at 90 degrees, -1 in antiphase
+	drawLabel(0, GRAPH_YCENTRE - 14, "correlation", LEFT_MODE);
+	formatFixed(text, (int32_t)(vs->correlation*100.0f + ((vs->correlation < 0) ? -0.5f : 0.5f)), 2);
+	drawLabel(0, GRAPH_YCENTRE, text, LEFT_MODE);
+}
+
+/**
+  * @brief  Fade the points drawn before and show the square. Call it from the
+  *					main loop at the frame rate, the points can be added from the
+  *					audio callbacks in between.
+  * @param  vs: vector scope
+  * @param  decay_shift: 1 to 7, intensity loses 1/2^shift per frame
+  * @retval none
+  */
+
+void plotVectorScope(VectorScope *vs, uint8_t decay_shift) {
+	int first = vs->top, last = vs->bottom;
+	uint32_t address, bytes_per_pixel, xsize = BSP_LCD_GetXSize();
+	float32_t power;
+	DMA2D_CLUTCfgTypeDef clut;
+
+	if(decay_shift < 1) decay_shift = 1;
+	if(decay_shift > 7) decay_shift = 7;
+
+	//Only the rows lit before the fade can have changed
+	decayRows(vs, decay_shift);
+	if(first <= last) {
+		if(hLtdcHandler.LayerCfg[LTDC_ACTIVE_LAYER].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) {
+			hDma2dVector.Init.ColorMode = DMA2D_OUTPUT_RGB565;
+			bytes_per_pixel = 2;
+		} else {
+			hDma2dVector.Init.ColorMode = DMA2D_OUTPUT_ARGB8888;
+			bytes_per_pixel = 4;
+		}
+		hDma2dVector.Instance = DMA2D;
+		hDma2dVector.Init.Mode = DMA2D_M2M_PFC;
+		hDma2dVector.Init.OutputOffset = xsize - GRAPH_WIDTH;
+		hDma2dVector.LayerCfg[1].InputColorMode = DMA2D_INPUT_L8;
+		hDma2dVector.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+		hDma2dVector.LayerCfg[1].InputAlpha = 0xFF;
+		hDma2dVector.LayerCfg[1].InputOffset = 0;
+		if(HAL_DMA2D_Init(&hDma2dVector) != HAL_OK || HAL_DMA2D_ConfigLayer(&hDma2dVector, 1) != HAL_OK)
+			return;
+
+		//Other modules load their own palettes into the foreground CLUT
+		clut.pCLUT = vector_clut;
+		clut.CLUTColorMode = DMA2D_CCM_ARGB8888;
+		clut.Size = 255;
+		if(HAL_DMA2D_CLUTStartLoad(&hDma2dVector, &clut, 1) != HAL_OK)
+			return;
+		HAL_DMA2D_PollForTransfer(&hDma2dVector, 10);
+
+		SCB_CleanDCache_by_Addr((uint32_t *)(VECTOR_BUFFER + first*GRAPH_WIDTH), (last - first + 1)*GRAPH_WIDTH);
+		address = hLtdcHandler.LayerCfg[LTDC_ACTIVE_LAYER].FBStartAdress +
+							bytes_per_pixel*(xsize*(HEADER_HEIGHT + first) + FIRST_DATA_PIXEL);
+		if(HAL_DMA2D_Start(&hDma2dVector, VECTOR_BUFFER + first*GRAPH_WIDTH, address, GRAPH_WIDTH, last - first + 1) != HAL_OK)
+			return;
+		HAL_DMA2D_PollForTransfer(&hDma2dVector, 20);
+	}
+
+	power = (float32_t)vs->sum_xx*(float32_t)vs->sum_yy;
+	if(power > 0)
+		vs->correlation = (float32_t)vs->sum_xy/sqrtf(power);
+	vs->sum_xy = 0;
+	vs->sum_xx = 0;
+	vs->sum_yy = 0;
+	drawLabels(vs);
+}
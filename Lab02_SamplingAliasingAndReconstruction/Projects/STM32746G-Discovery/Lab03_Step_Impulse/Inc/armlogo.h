@@ -1,3532 +1,719 @@
-/*
-  C-file generated by Bin2C
-  Compiled:    Aug 31 2016 at 10:53:40
+/**
+  ******************************************************************************
+  * @file    armlogo.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   372x126 image, 256 colour palette + RLE. Generated by
+  *          Utilities/Host/bmp2rle.c, don't edit.
+  ******************************************************************************
+  */
 
-  Copyright (C) 2014
-  Segger Microcontroller GmbH & Co. KG
-  www.segger.com
-
-  Solutions for real time microcontroller applications
-*/
+static const uint32_t armlogo_palette[256] = {
+  0xFF0090BF, 0xFF0190BF, 0xFF0191BF, 0xFF0291BF, 0xFF0291C0, 0xFF0391C0, 0xFF0492C0, 0xFF008FBE,
+  0xFF008DBE, 0xFF008DBD, 0xFF008CBD, 0xFF008EBE, 0xFF008FBF, 0xFF0089BB, 0xFF0088BA, 0xFF0C95C2,
+  0xFF189AC5, 0xFF209EC7, 0xFF26A0C8, 0xFF2BA3CA, 0xFF26A1C9, 0xFF1F9EC7, 0xFF169AC4, 0xFF0994C1,
+  0xFF008ABC, 0xFF008CBC, 0xFF0088BB, 0xFF0592C0, 0xFF1298C4, 0xFF1D9DC6, 0xFF249FC8, 0xFF2AA2CA,
+  0xFF29A2C9, 0xFF229FC8, 0xFF1B9CC6, 0xFF0F97C3, 0xFF008BBC, 0xFF0E96C3, 0xFF239FC8, 0xFF1398C4,
+  0xFF0793C1, 0xFF25A0C8, 0xFF1499C4, 0xFF0693C1, 0xFF4CB1D2, 0xFF78C4DD, 0xFF9FD5E7, 0xFFBFE3EF,
+  0xFFD7EDF5, 0xFFE8F5F9, 0xFFF2FAFC, 0xFFFAFDFE, 0xFFFDFEFF, 0xFFFFFFFF, 0xFFFEFEFF, 0xFFF9FDFE,
+  0xFFF1F9FB, 0xFFE4F3F8, 0xFFCFEAF3, 0xFFB1DDEB, 0xFF89CCE1, 0xFF2EA4CA, 0xFF68BDD9, 0xFF9CD4E6,
+  0xFFC4E5F0, 0xFFDEF1F7, 0xFFEEF8FB, 0xFFF7FCFD, 0xFFFCFEFE, 0xFFF5FBFD, 0xFFEBF6FA, 0xFFC0E4EF,
+  0xFF6DBFDA, 0xFF39A9CD, 0xFF0B95C2, 0xFF008ABB, 0xFF8ACCE2, 0xFFB6DFED, 0xFFD5EDF4, 0xFFEAF6FA,
+  0xFFF6FBFD, 0xFFFEFFFF, 0xFFF9FCFD, 0xFFDDF0F6, 0xFF97D2E5, 0xFF62BBD8, 0xFF4FB2D3, 0xFF7FC7DF,
+  0xFFA9DAE9, 0xFFC9E8F1, 0xFFE0F2F7, 0xFFEFF8FB, 0xFFF8FCFD, 0xFF76C3DD, 0xFF42ADD0, 0xFF5CB8D6,
+  0xFFFBFDFE, 0xFF219EC7, 0xFFD4ECF4, 0xFFABDAEA, 0xFF59B7D5, 0xFF74C3DC, 0xFFC5E6F0, 0xFF88CBE1,
+  0xFF30A5CB, 0xFFCEEAF3, 0xFF69BED9, 0xFF1C9CC6, 0xFF179AC5, 0xFFBDE2EE, 0xFFFDFEFE, 0xFFE7F5F9,
+  0xFF95D1E4, 0xFF91CFE3, 0xFFC2E4F0, 0xFFC3E5F0, 0xFFC8E7F1, 0xFF0D96C2, 0xFFC1E4EF, 0xFFD2EBF4,
+  0xFF9ED5E7, 0xFFECF7FA, 0xFF2CA3CA, 0xFFBCE2EE, 0xFFC6E6F1, 0xFFD0EAF3, 0xFF37A8CD, 0xFFAADAEA,
+  0xFFBEE3EF, 0xFF80C8DF, 0xFFD9EFF6, 0xFF41ACCF, 0xFFA3D7E8, 0xFFF3FAFC, 0xFF3CAACE, 0xFFA8D9E9,
+  0xFF2DA4CA, 0xFFB9E1ED, 0xFFB0DDEB, 0xFFAFDCEB, 0xFFBBE1EE, 0xFF1197C3, 0xFF34A7CC, 0xFF8DCDE2,
+  0xFFCDE9F2, 0xFF1A9BC5, 0xFFF2F9FC, 0xFFADDBEA, 0xFF79C5DD, 0xFFEDF7FA, 0xFF1198C3, 0xFF35A7CC,
+  0xFF8ECEE3, 0xFF0693C0, 0xFF60BAD7, 0xFFF4FAFC, 0xFF54B4D4, 0xFFE9F6FA, 0xFF61BAD7, 0xFFDCF0F6,
+  0xFF0392C0, 0xFF57B6D5, 0xFFEDF7FB, 0xFF44AED0, 0xFF0087BA, 0xFF67BDD9, 0xFF70C1DB, 0xFF0692C0,
+  0xFFB3DEEC, 0xFFD8EEF5, 0xFF1097C3, 0xFFD3ECF4, 0xFF47AFD1, 0xFF0083B8, 0xFF1E9DC6, 0xFF5EB9D6,
+  0xFF4AB0D2, 0xFF8FCEE3, 0xFFD6EDF5, 0xFFDBEFF6, 0xFFE2F2F8, 0xFFA2D7E8, 0xFF64BCD8, 0xFF169AC5,
+  0xFF1298C3, 0xFFE9F5F9, 0xFF3BAACE, 0xFF82C8E0, 0xFFBBE2EE, 0xFFFCFDFE, 0xFF77C4DD, 0xFFDDF0F7,
+  0xFFCDE9F3, 0xFFBAE1EE, 0xFFF5FAFC, 0xFFA9D9E9, 0xFFF0F9FB, 0xFF55B5D4, 0xFFF0F8FB, 0xFF45AED0,
+  0xFF1A9CC6, 0xFF53B4D4, 0xFF51B3D3, 0xFF199BC5, 0xFFE3F3F8, 0xFF40ACCF, 0xFF0A94C1, 0xFF0E96C2,
+  0xFF38A8CD, 0xFF66BCD8, 0xFFA6D8E9, 0xFF5AB7D6, 0xFF7CC6DE, 0xFF92D0E4, 0xFF63BBD8, 0xFF6CBFDA,
+  0xFF0A95C2, 0xFF87CBE1, 0xFF0086B9, 0xFF65BCD8, 0xFF9AD3E6, 0xFFD7EEF5, 0xFFCAE8F2, 0xFFCBE8F2,
+  0xFF0894C1, 0xFF0893C1, 0xFFB2DDEC, 0xFF43ADD0, 0xFFC2E5F0, 0xFF83C9E0, 0xFF5DB8D6, 0xFFA1D6E7,
+  0xFF2FA4CB, 0xFF7BC6DE, 0xFF31A6CB, 0xFF93D0E4, 0xFF6ABEDA, 0xFFE1F2F7, 0xFFF1F9FC, 0xFFB8E0ED,
+  0xFFF5FBFC, 0xFF3AA9CE, 0xFF3FABCF, 0xFFCCE9F2, 0xFFB5DFEC, 0xFFDFF1F7, 0xFF72C2DC, 0xFF6EC0DB,
+  0xFF9DD4E6, 0xFF94D1E4, 0xFF31A5CB, 0xFFE5F4F8, 0xFFE5F4F9, 0xFF6FC0DB, 0xFF7DC7DE, 0xFF84C9E0
+};
 
-static const unsigned char armlogo[140670UL + 1] = {
-  0x42, 0x4D, 0x7E, 0x25, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x0E,
-  0x00, 0x00, 0xC3, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x91, 0x02, 0xC0, 0x91, 0x03, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0x03,
-  0xC0, 0x91, 0x03, 0xC0, 0x91, 0x03, 0xC0, 0x92, 0x03, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x03, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01,
-  0xC0, 0x91, 0x03, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x02, 0xBE, 0x8F, 0x00, 0xBD, 0x8C, 0x00, 0xBC, 0x8A, 0x00, 0xBB, 0x89, 0x00, 0xBA, 0x88, 0x00, 0xBB, 0x88, 0x00, 0xBB, 0x89, 0x00, 0xBB, 0x8A, 0x00, 0xBC, 0x8A, 0x00, 0xBC, 0x8A, 0x00, 0xBC,
-  0x8A, 0x00, 0xBB, 0x89, 0x00, 0xBB, 0x88, 0x00, 0xBA, 0x88, 0x00, 0xBB, 0x88, 0x00, 0xBB, 0x8A, 0x00, 0xBD, 0x8C, 0x00, 0xBF, 0x8F, 0x00, 0xC0, 0x91, 0x03, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x02, 0xBE, 0x8E, 0x00, 0xBB, 0x89, 0x00, 0xBA,
-  0x88, 0x00, 0xBC, 0x8B, 0x00, 0xC1, 0x94, 0x09, 0xC8, 0xA0, 0x25, 0xD0, 0xAD, 0x43, 0xD7, 0xBA, 0x61, 0xDE, 0xC6, 0x7B, 0xE3, 0xCF, 0x91, 0xE7, 0xD6, 0xA1, 0xEA, 0xDB, 0xAC, 0xEB, 0xDD, 0xB1, 0xEB, 0xDD, 0xB0, 0xEB, 0xDD, 0xB0, 0xE9, 0xD8,
-  0xA6, 0xE5, 0xD2, 0x97, 0xE0, 0xC8, 0x82, 0xD9, 0xBC, 0x66, 0xD0, 0xAE, 0x45, 0xC8, 0x9F, 0x23, 0xC0, 0x92, 0x06, 0xBC, 0x8A, 0x00, 0xBA, 0x88, 0x00, 0xBC, 0x8B, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF,
-  0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90,
-  0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90,
-  0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01,
-  0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90,
-  0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01,
-  0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF,
-  0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x03, 0xBD, 0x8D, 0x00, 0xBA, 0x88, 0x00, 0xBC, 0x8B, 0x00, 0xC5, 0x9A, 0x17, 0xD2, 0xB1, 0x4C, 0xE1, 0xCB, 0x88, 0xEE, 0xE2,
-  0xBC, 0xF8, 0xF3, 0xE3, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xF7, 0xF1, 0xDF, 0xEB, 0xDD, 0xB1, 0xDC, 0xC3, 0x74, 0xCC, 0xA6, 0x33, 0xBF, 0x90, 0x01, 0xBA, 0x88, 0x00, 0xBC, 0x8B, 0x00, 0xBF, 0x91, 0x02, 0xC0, 0x92, 0x04, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F,
-  0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00,
-  0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00,
-  0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBF,
-  0x8F, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00,
-  0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBF, 0x8F, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE,
-  0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBF, 0x8F, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F,
-  0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x01, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBB, 0x89, 0x00, 0xBC, 0x8B, 0x00, 0xC7, 0x9E, 0x20, 0xDB, 0xC0, 0x6E, 0xEE, 0xE2, 0xBC, 0xFC, 0xF9, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE,
-  0xFD, 0xFB, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD8, 0xE2, 0xCC, 0x8A, 0xCB, 0xA6, 0x31, 0xBD, 0x8C, 0x00, 0xBB, 0x89, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92,
-  0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x06, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x07, 0xC1, 0x93, 0x08,
-  0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1,
-  0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x07, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x07, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1,
-  0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x07, 0xC1, 0x94, 0x08, 0xC0, 0x92, 0x04, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xC1, 0x93, 0x07,
-  0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1,
-  0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x07, 0xC1, 0x93, 0x08, 0xC0, 0x92, 0x05, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC1, 0x93, 0x06, 0xC1,
-  0x93, 0x08, 0xC1, 0x93, 0x07, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93,
-  0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x07, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x06, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x05, 0xC1, 0x93,
-  0x08, 0xC1, 0x93, 0x07, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08,
-  0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x08, 0xC1, 0x93, 0x07, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xC0, 0x92, 0x04, 0xBE, 0x8F, 0x00,
-  0xBA, 0x88, 0x00, 0xC0, 0x91, 0x03, 0xD4, 0xB4, 0x53, 0xED, 0xDF, 0xB6, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFC, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFD, 0xFE, 0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE4, 0xC2, 0xD4, 0xB5, 0x55, 0xBE, 0x8F, 0x00, 0xBB, 0x89, 0x00, 0xBF, 0x91, 0x02,
-  0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8C, 0x00, 0xE9, 0xD8, 0xA6, 0xFA, 0xF7, 0xED, 0xF7, 0xF1, 0xDE, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7,
-  0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2,
-  0xE1, 0xF7, 0xF1, 0xE0, 0xF8, 0xF4, 0xE5, 0xF3, 0xEB, 0xD1, 0xC3, 0x97, 0x0F, 0xBE, 0x8E, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0,
-  0x91, 0x02, 0xBC, 0x8C, 0x00, 0xCB, 0xA4, 0x2F, 0xF9, 0xF4, 0xE5, 0xF7, 0xF2, 0xE0, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2,
-  0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF0, 0xDD, 0xFB, 0xF9, 0xF1, 0xDE, 0xC7, 0x7D, 0xBB, 0x89, 0x00, 0xC0, 0x92, 0x04,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xBE, 0x8E, 0x00, 0xC5, 0x9A, 0x17, 0xF5, 0xEE, 0xD8, 0xF8, 0xF3, 0xE3, 0xF7,
-  0xF2, 0xE0, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2,
-  0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF1, 0xDE, 0xFB, 0xF8, 0xEE, 0xE6, 0xD4, 0x9C, 0xBC, 0x8B, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xEE, 0xE2, 0xBD, 0xF9, 0xF5, 0xE9, 0xF7, 0xF1,
-  0xDF, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1,
-  0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF1, 0xDF, 0xF9, 0xF5, 0xE9, 0xEF, 0xE3, 0xBE, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xE6, 0xD4, 0x9B, 0xFB, 0xF8, 0xEE, 0xF7, 0xF1, 0xDE,
-  0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7,
-  0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE1, 0xF7, 0xF2, 0xE0, 0xF8, 0xF3, 0xE3, 0xF5, 0xEE, 0xD8, 0xC5, 0x9A, 0x17, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBA, 0x88, 0x00, 0xC1, 0x94, 0x09, 0xDB, 0xC0, 0x6F, 0xF6,
-  0xF0, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xEC, 0xD3, 0xD5, 0xB5, 0x56, 0xBD, 0x8C, 0x00, 0xBC, 0x8B, 0x00, 0xC0,
-  0x92, 0x04, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xBC, 0x8B, 0x00, 0xF0, 0xE4, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFC, 0xFA, 0xF3, 0xC3, 0x98, 0x12, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B,
-  0x00, 0xCD, 0xA8, 0x36, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0xD0, 0x92, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC6, 0x9C, 0x1B, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xDF, 0xB6, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF6, 0xF0, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xF0, 0xDD, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBB, 0x8A, 0x00, 0xEC, 0xDF, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xC6, 0x9C, 0x1B, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xC0, 0x92, 0x04, 0xBB, 0x8A, 0x00, 0xBF, 0x90, 0x00, 0xDA, 0xBE, 0x6A, 0xF8, 0xF3, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD,
-  0xFC, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE5, 0xC2, 0xCB, 0xA5, 0x31, 0xBA, 0x88, 0x00, 0xBF, 0x90,
-  0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xBC, 0x8C, 0x00, 0xEE, 0xE2, 0xBB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD,
-  0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFA,
-  0xF6, 0xEB, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x34,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF,
-  0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFE, 0xFD, 0xF9, 0xFF, 0xFF, 0xFF, 0xE2, 0xCE, 0x8D, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF3, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD,
-  0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF,
-  0xFE, 0xFD, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xEB, 0xDC, 0xAF, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF4, 0xED, 0xD5, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF,
-  0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE,
-  0xFD, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xF5, 0xED, 0xD6, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDC, 0xAF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE,
-  0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD,
-  0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFA, 0xF3, 0xC6, 0x9B, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBE, 0x8F, 0x00, 0xBB, 0x89, 0x00, 0xD0, 0xAD, 0x43, 0xF4, 0xEC, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xC9, 0x84, 0xBE, 0x8E, 0x00, 0xBD, 0x8C, 0x00,
-  0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xBC, 0x8C, 0x00, 0xEE, 0xE2, 0xBD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98,
-  0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD,
-  0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xC0, 0x92, 0x05, 0xBC, 0x8A, 0x00, 0xC1, 0x94, 0x09, 0xE6, 0xD4, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xE8, 0xCA, 0xC6, 0x9D, 0x1E, 0xBB, 0x89, 0x00, 0xC0,
-  0x92, 0x05, 0xC0, 0x91, 0x02, 0xBC, 0x8C, 0x00, 0xEE, 0xE2, 0xBD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00,
-  0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF,
-  0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5,
-  0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB,
-  0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xC0, 0x91, 0x03, 0xBA, 0x88, 0x00, 0xCE,
-  0xAA, 0x3B, 0xF8, 0xF2, 0xE2, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFC, 0xFA, 0xF4, 0xD0, 0xAD, 0x43, 0xBA, 0x88, 0x00, 0xC1, 0x93,
-  0x06, 0xBC, 0x8C, 0x00, 0xEE, 0xE2, 0xBD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC,
-  0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91,
-  0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A,
-  0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBB, 0x89, 0x00, 0xDB, 0xC1, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xBA, 0x60, 0xBB, 0x89, 0x00, 0xBD, 0x8D, 0x00,
-  0xEE, 0xE2, 0xBD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91,
-  0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF,
-  0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBE, 0x8E, 0x00, 0xBD, 0x8D, 0x00, 0xE6, 0xD4, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xC0, 0x6F, 0xB8, 0x84, 0x00, 0xEF, 0xE3, 0xBF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB,
-  0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD,
-  0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03,
-  0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBE, 0x8E, 0x00, 0xBF, 0x90, 0x01, 0xED, 0xE0, 0xB7, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xD8, 0xBB, 0x62, 0xEB, 0xDD, 0xB1, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3,
-  0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B,
-  0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01,
-  0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB,
-  0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xC0, 0x91, 0x03, 0xBE, 0x8E, 0x00, 0xC0, 0x91, 0x03, 0xF0, 0xE5, 0xC3, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF8, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88,
-  0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xBE, 0x8F,
-  0x00, 0xBF, 0x90, 0x00, 0xEF, 0xE4, 0xC1, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0,
-  0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBD, 0x8C, 0x00, 0xEC, 0xDD, 0xB2,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B,
-  0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x03, 0xBB, 0x89, 0x00, 0xE4, 0xD0, 0x93, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA,
-  0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x05, 0xBA, 0x88, 0x00, 0xD8, 0xBC, 0x66, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98,
-  0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD,
-  0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x03, 0xBC, 0x8B, 0x00, 0xCB, 0xA5, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFE, 0xFD, 0xFC, 0xFE, 0xFD,
-  0xFB, 0xFE, 0xFE, 0xFC, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00,
-  0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF,
-  0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5,
-  0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB,
-  0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x8F, 0x00, 0xC0, 0x91, 0x03, 0xF5, 0xEE, 0xD9, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFE, 0xFD, 0xFB, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xF9, 0xFD, 0xFC, 0xF8, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC,
-  0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91,
-  0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A,
-  0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0,
-  0x92, 0x04, 0xBA, 0x88, 0x00, 0xE3, 0xCF, 0x91, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF2, 0xE2, 0xEB, 0xDC, 0xAF, 0xDE, 0xC7, 0x7D, 0xD4, 0xB5, 0x55, 0xCD, 0xA9, 0x39, 0xC9,
-  0xA2, 0x29, 0xC7, 0x9E, 0x1F, 0xC6, 0x9C, 0x1D, 0xC8, 0x9F, 0x24, 0xCB, 0xA5, 0x2F, 0xD0, 0xAE, 0x44, 0xD8, 0xBC, 0x64, 0xE3, 0xCE, 0x8F, 0xEF, 0xE4, 0xC1, 0xFB, 0xF8, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD,
-  0xFB, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91,
-  0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF,
-  0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xCE, 0xA9,
-  0x3A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFE, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF3, 0xE4, 0xE3, 0xCE, 0x8E, 0xCE, 0xAA, 0x3C, 0xC1, 0x93, 0x08, 0xBB, 0x8A, 0x00, 0xBA, 0x88, 0x00, 0xBB, 0x89, 0x00, 0xBC, 0x8B, 0x00, 0xBD, 0x8C, 0x00, 0xBD, 0x8D,
-  0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8C, 0x00, 0xBC, 0x8B, 0x00, 0xBC, 0x8A, 0x00, 0xBB, 0x88, 0x00, 0xBA, 0x88, 0x00, 0xBD, 0x8C, 0x00, 0xC4, 0x99, 0x14, 0xD3, 0xB2, 0x4F, 0xE7, 0xD6, 0xA1, 0xFB, 0xF8, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFD, 0xFB, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB,
-  0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD,
-  0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03,
-  0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBE, 0x8E, 0x00, 0xF3, 0xE9, 0xCD, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF5, 0xEE, 0xD7, 0xD7, 0xBA, 0x60, 0xC1, 0x94, 0x09, 0xBA, 0x88, 0x00, 0xBC, 0x8B, 0x00, 0xBE, 0x8F, 0x00, 0xC0, 0x91, 0x03, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02,
-  0xBF, 0x91, 0x02, 0xC0, 0x91, 0x02, 0xC0, 0x91, 0x03, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xBF, 0x91, 0x02, 0xBE, 0x8E, 0x00, 0xBB, 0x89, 0x00, 0xBB, 0x89, 0x00, 0xC4, 0x98, 0x13, 0xDB, 0xC0, 0x6F, 0xF7, 0xF1, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3,
-  0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B,
-  0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01,
-  0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB,
-  0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x88, 0x00, 0xD9, 0xBD, 0x67, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFC, 0xFA, 0xF4, 0xDB, 0xC0, 0x6E, 0xBF, 0x90, 0x00,
-  0xBB, 0x88, 0x00, 0xBE, 0x8F, 0x00, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xC0, 0x91, 0x03, 0xC0, 0x92, 0x04, 0xBE, 0x8E, 0x00, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x05, 0xDC, 0xC2, 0x72, 0xFC, 0xFA, 0xF3, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88,
-  0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBE, 0x8F, 0x00, 0xC1, 0x94, 0x0A, 0xF9, 0xF4, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xEE, 0xE1, 0xBA, 0xC5, 0x9B, 0x1A, 0xBA, 0x88, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBF,
-  0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xC0, 0x92, 0x04, 0xBF, 0x8F, 0x00, 0xBA, 0x88, 0x00, 0xC5, 0x9A, 0x18, 0xEB, 0xDD, 0xB1, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0,
-  0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBA, 0x88, 0x00, 0xDD, 0xC3, 0x76, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xC9, 0x83, 0xBC, 0x8B, 0x00, 0xBD, 0x8D, 0x00, 0xC0, 0x92, 0x05, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xC0, 0x92, 0x05, 0xBD, 0x8D, 0x00, 0xBB, 0x8A, 0x00, 0xDB, 0xC1, 0x70, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B,
-  0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBE, 0x8F, 0x00, 0xC1, 0x94, 0x09, 0xF8, 0xF4, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xBA, 0x61, 0xBA, 0x87, 0x00, 0xBF, 0x91, 0x02, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xC0, 0x91, 0x03, 0xBA, 0x87, 0x00, 0xD1, 0xAF, 0x47, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA,
-  0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0,
-  0x92, 0x04, 0xBB, 0x88, 0x00, 0xD9, 0xBD, 0x67, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xD6, 0xB7, 0x5A, 0xBA, 0x87, 0x00, 0xC0, 0x92, 0x05, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x06, 0xBA, 0x88, 0x00, 0xCD, 0xA8, 0x38, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98,
-  0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD,
-  0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBE, 0x8E,
-  0x00, 0xF3, 0xEA, 0xCF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xDA, 0xBF, 0x6B, 0xBA,
-  0x87, 0x00, 0xC0, 0x92, 0x05, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x93, 0x06, 0xBA, 0x88, 0x00, 0xCF, 0xAC, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00,
-  0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF,
-  0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5,
-  0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB,
-  0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xCF, 0xAB, 0x3F, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xE4, 0xD1, 0x94, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x06, 0xBA, 0x87, 0x00, 0xD8, 0xBC, 0x64, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC,
-  0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91,
-  0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A,
-  0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x89, 0x00, 0xE6, 0xD5, 0x9D, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xF3, 0xEA, 0xCF, 0xBE, 0x8F, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x88, 0x00, 0xE7, 0xD6, 0xA1, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91,
-  0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF,
-  0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBE, 0x8E, 0x00, 0xC2, 0x96, 0x0E, 0xFA, 0xF6, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xA4, 0x2E, 0xBC, 0x8B, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBE, 0x8E, 0x00, 0xC2, 0x95, 0x0A, 0xF8, 0xF4, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB,
-  0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD,
-  0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03,
-  0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBB, 0x89, 0x00, 0xD3, 0xB2, 0x4F, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE1, 0xCC, 0x89, 0xBA, 0x87, 0x00, 0xC0, 0x92, 0x05, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x05, 0xBB, 0x88, 0x00, 0xD5, 0xB6, 0x57, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3,
-  0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B,
-  0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01,
-  0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB,
-  0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x89, 0x00, 0xE6, 0xD4, 0x9D, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF6, 0xEA, 0xC2, 0x96, 0x0E, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8C, 0x00, 0xF0, 0xE6, 0xC5, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88,
-  0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x8F, 0x00, 0xC0, 0x92, 0x04, 0xF6, 0xF0, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF,
-  0xDD, 0xC4, 0x77, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x05, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x89, 0x00, 0xD2, 0xB1, 0x4B, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0,
-  0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91,
-  0x02, 0xBC, 0x8B, 0x00, 0xCB, 0xA5, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFB, 0xF8, 0xEE, 0xC3, 0x98, 0x12, 0xBE,
-  0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBE, 0x8F, 0x00, 0xF4, 0xEB, 0xD1, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B,
-  0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x88, 0x00,
-  0xDA, 0xBE, 0x6A, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE4, 0xD1, 0x95, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBA, 0x88, 0x00, 0xDB, 0xC1, 0x72, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA,
-  0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x89, 0x00, 0xE8, 0xD7, 0xA3, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xCD, 0xA8, 0x38, 0xBC, 0x8B, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC7, 0x9E, 0x20, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98,
-  0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD,
-  0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBE, 0x8F, 0x00, 0xF4, 0xEB, 0xD2, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xED, 0xD6, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8C, 0x00, 0xF0, 0xE5, 0xC3, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00,
-  0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF,
-  0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5,
-  0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB,
-  0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xBE, 0x8E, 0x00, 0xC5, 0x9A, 0x17, 0xFC, 0xF9, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCF, 0x91, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92,
-  0x04, 0xBA, 0x88, 0x00, 0xDF, 0xC7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC,
-  0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91,
-  0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A,
-  0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCD, 0xA8, 0x37, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xD3, 0xB2, 0x4F, 0xBB, 0x89, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00,
-  0xD0, 0xAD, 0x44, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91,
-  0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF,
-  0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x89, 0x00, 0xD5, 0xB7, 0x59, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xF8, 0xC6, 0x9D, 0x1E, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC,
-  0xFB, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB,
-  0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD,
-  0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03,
-  0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBA, 0x88, 0x00, 0xDD, 0xC5, 0x79, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5,
-  0xEE, 0xD8, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xEE, 0xD7, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3,
-  0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B,
-  0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01,
-  0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB,
-  0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x88, 0x00, 0xE4, 0xD1, 0x94, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xDE, 0xB4, 0xBC, 0x8A,
-  0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xBC, 0x8B, 0x00, 0xED, 0xE0, 0xB8, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88,
-  0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0,
-  0x91, 0x03, 0xBB, 0x8A, 0x00, 0xEA, 0xDA, 0xAB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE4, 0xD0, 0x93, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x89, 0x00, 0xE6, 0xD4, 0x9D, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0,
-  0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xBC, 0x8B,
-  0x00, 0xEE, 0xE2, 0xBC, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xDD, 0xC5, 0x79, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBA, 0x88, 0x00, 0xE1, 0xCB, 0x87, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B,
-  0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xBD, 0x8D, 0x00, 0xF1, 0xE7, 0xC8,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xD8, 0xBC, 0x66, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBA, 0x88, 0x00, 0xDD, 0xC4, 0x77, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA,
-  0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBE, 0x8E, 0x00, 0xF3, 0xEA, 0xCF, 0xFF, 0xFF, 0xFF, 0xFE,
-  0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFF, 0xFF, 0xFF, 0xD5, 0xB7, 0x5A, 0xBB, 0x89, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x88, 0x00, 0xDB, 0xC0, 0x6E, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98,
-  0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD,
-  0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x8F, 0x00, 0xF4, 0xEC, 0xD3, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xD5, 0xB6, 0x58, 0xBB, 0x89, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x88, 0x00, 0xD9, 0xBE, 0x6A, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00,
-  0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF,
-  0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5,
-  0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB,
-  0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xF4, 0xEC, 0xD3, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xD5, 0xB7, 0x58, 0xBB, 0x89, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xC0, 0x92, 0x04, 0xBA, 0x88, 0x00, 0xDB, 0xC1, 0x70, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC,
-  0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91,
-  0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A,
-  0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBE, 0x8F, 0x00, 0xF3, 0xEA, 0xCF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xD8, 0xBB, 0x62, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04,
-  0xBA, 0x88, 0x00, 0xDD, 0xC5, 0x79, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91,
-  0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF,
-  0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBD, 0x8D, 0x00, 0xF2, 0xE8, 0xCA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB,
-  0xFF, 0xFF, 0xFF, 0xDC, 0xC2, 0x72, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBA, 0x88, 0x00, 0xE1,
-  0xCB, 0x88, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB,
-  0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD,
-  0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xED, 0xE0, 0xB8, 0xBC, 0x8B, 0x00, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xED, 0xD7, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03,
-  0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8C, 0x00, 0xEF, 0xE3, 0xBE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE2,
-  0xCC, 0x8A, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x89, 0x00, 0xE7, 0xD5, 0x9E, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3,
-  0xCE, 0x8E, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B,
-  0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xED, 0xE0, 0xB9, 0xBC, 0x8B, 0x00, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01,
-  0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF6, 0xF0, 0xDC, 0xC0, 0x92, 0x04, 0xBF, 0x8F, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB,
-  0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBB, 0x8A, 0x00, 0xEB, 0xDC, 0xAF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE9, 0xD9, 0xA9, 0xBB, 0x89,
-  0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xBC, 0x8B, 0x00, 0xED, 0xE0, 0xB8, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE4, 0xD0, 0x93, 0xBB, 0x88,
-  0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEE, 0xE2, 0xBC, 0xBC, 0x8B, 0x00, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xF1, 0xDF, 0xC0, 0x93, 0x06, 0xBF, 0x8F, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0,
-  0x92, 0x04, 0xBB, 0x89, 0x00, 0xE6, 0xD3, 0x9A, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF2, 0xE9, 0xCC, 0xBE, 0x8E, 0x00, 0xBF, 0x90, 0x01,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xF5, 0xED, 0xD7, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0,
-  0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE6, 0xD3, 0x9B, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0xE5, 0xC3, 0xBD, 0x8C, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF8, 0xF3, 0xE4, 0xC1, 0x94, 0x09, 0xBE, 0x8F, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDC, 0xAF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBA, 0x88,
-  0x00, 0xDF, 0xC8, 0x80, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFB, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xBE, 0x8D, 0x00, 0xC5, 0x9A, 0x18, 0xFC, 0xFA, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B,
-  0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE9, 0xD8, 0xA6, 0xBB, 0x89, 0x00, 0xC0, 0x92, 0x03, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xF2, 0xE9, 0xCC, 0xBE, 0x8E, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xF5, 0xEE, 0xD7, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF6, 0xEA, 0xC3, 0x97, 0x0F, 0xBE, 0x8E, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xEC, 0xDF, 0xB5, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x89, 0x00, 0xD7, 0xBA, 0x62,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xCE, 0xA9, 0x3A, 0xBC, 0x8B, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xCF, 0xAB, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA,
-  0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xED, 0xDF, 0xB6, 0xBC, 0x8B, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xED, 0xD6, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x8F, 0x00, 0xC0, 0x92, 0x05, 0xF6, 0xF0, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFA, 0xF2, 0xC5, 0x9A, 0x18, 0xBE, 0x8D, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xBC, 0x8B, 0x00, 0xED, 0xE1, 0xB9, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xCF, 0xAC, 0x40, 0xFF, 0xFF, 0xFF, 0xFE,
-  0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xDC, 0xC3, 0x75, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBA, 0x88, 0x00, 0xDD, 0xC3, 0x76, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98,
-  0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xF2, 0xE8, 0xCA, 0xBE, 0x8E, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-  0xFD, 0xFF, 0xFF, 0xFF, 0xF8, 0xF3, 0xE4, 0xC1, 0x94, 0x09, 0xBE, 0x8F, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBE, 0x8F, 0x00, 0xC1, 0x93, 0x08, 0xF8, 0xF3, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xC8, 0x9F, 0x24, 0xBD, 0x8C, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8C, 0x00, 0xEF, 0xE4, 0xC0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFC, 0xFB, 0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC7, 0x9E, 0x1F, 0xFD, 0xFC, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEE, 0xE2, 0xBC, 0xBC, 0x8B, 0x00, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xED, 0xE0, 0xB8, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00,
-  0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xF2, 0xE1, 0xC1, 0x93, 0x07, 0xBE, 0x8F, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-  0xFC, 0xF9, 0xF1, 0xC4, 0x9A, 0x16, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBE, 0x8E, 0x00, 0xC2, 0x96, 0x0E, 0xFA, 0xF6, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xCC, 0xA7, 0x35, 0xBC, 0x8B, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBD, 0x8D, 0x00, 0xF2, 0xE8, 0xCA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB,
-  0xF5, 0xC6, 0x9C, 0x1A, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x8F, 0x00, 0xC0, 0x92, 0x04, 0xF6, 0xF0, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xF6, 0xC6, 0x9C, 0x1C, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xBE, 0x8E,
-  0x00, 0xC4, 0x99, 0x16, 0xFC, 0xF9, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xF8, 0xC6, 0x9D, 0x1E, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC9,
-  0xA2, 0x29, 0xBD, 0x8C, 0x00, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xBE, 0x8E, 0x00, 0xC5, 0x9A, 0x16, 0xFB, 0xF9, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xD2, 0xB1,
-  0x4D, 0xBB, 0x89, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xF4, 0xEC, 0xD4, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xF5, 0xC6, 0x9C, 0x1B,
-  0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEC, 0xDE, 0xB2, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xDA, 0xBE, 0x6A, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x89, 0x00, 0xD6, 0xB8, 0x5D,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xD0, 0xAD, 0x42, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xD0, 0xAE, 0x44, 0xBC, 0x8A,
-  0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC7, 0x9E, 0x21, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xDA, 0xBF, 0x6C, 0xBB, 0x88, 0x00,
-  0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x01, 0xBE, 0x8F, 0x00, 0xC1, 0x93, 0x07, 0xF7, 0xF2, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFA, 0xF4, 0xC5, 0x9B, 0x19, 0xBD, 0x8D, 0x00, 0xBF,
-  0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBA, 0x88, 0x00, 0xDE, 0xC6, 0x7B, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xF2, 0xE8, 0xCB, 0xBE, 0x8D, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xEE, 0xE1, 0xBB, 0xFF, 0xFF, 0xFF, 0xFE,
-  0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xDD, 0xC4, 0x76, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD,
-  0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xD9, 0xBE, 0x69, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xBC, 0x8B,
-  0x00, 0xCB, 0xA6, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE4, 0xD0, 0x93, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xBE, 0x8E, 0x00,
-  0xC4, 0x98, 0x13, 0xFB, 0xF8, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFB, 0xF8, 0xF0, 0xC4, 0x99, 0x15, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xCF, 0xAC, 0x40, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xD0, 0xAD, 0x42, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xBC, 0x8B, 0x00, 0xCB, 0xA4, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF,
-  0xFF, 0xFF, 0xED, 0xDF, 0xB5, 0xBC, 0x8B, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B,
-  0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE5, 0xD2, 0x97, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBB, 0x8A, 0x00, 0xD1, 0xAF, 0x46,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEF, 0xE3, 0xBE, 0xBC, 0x8C, 0x00, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8C, 0x00, 0xC8, 0x9F, 0x23, 0xFE,
-  0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xEC, 0xC3, 0x97, 0x10, 0xBE, 0x8E, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBE, 0x8E, 0x00, 0xC3, 0x96, 0x0E, 0xFA, 0xF6, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFC, 0xFF, 0xFF, 0xFF, 0xEE, 0xE1, 0xBA, 0xBC, 0x8B, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x89, 0x00, 0xE7, 0xD6, 0xA1, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFB, 0xF9,
-  0xF0, 0xC4, 0x99, 0x14, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xF1, 0xE8, 0xC9, 0xBD, 0x8D, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x88, 0x00, 0xD8, 0xBB, 0x63, 0xFF, 0xFF, 0xFF, 0xFE,
-  0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xF9, 0xF5, 0xE8, 0xC2, 0x96, 0x0D, 0xBE, 0x8F, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCE, 0xAA, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-  0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF8, 0xF3, 0xE4, 0xC1, 0x94, 0x09, 0xBE, 0x8F, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDC, 0xB0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD,
-  0xFF, 0xFF, 0xFF, 0xD1, 0xAF, 0x47, 0xBB, 0x89, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCA, 0xA4, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0,
-  0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xD7, 0xB9, 0x5E,
-  0xBB, 0x89, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xF5, 0xC6, 0x9C, 0x1B, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBA, 0x88, 0x00, 0xE1, 0xCB, 0x87, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xCE, 0xAA, 0x3B, 0xBC, 0x8B, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x89, 0x00, 0xD6, 0xB8, 0x5D, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD8, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xC0, 0x92, 0x04, 0xBB, 0x88, 0x00, 0xD7, 0xBB, 0x62, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xF4,
-  0xEC, 0xD4, 0xBF, 0x8F, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xED, 0xE1, 0xB9, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B,
-  0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0xE5, 0xC2, 0xBD, 0x8C, 0x00, 0xC0,
-  0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xD5, 0xB7, 0x59, 0xBB, 0x89, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8A, 0x00, 0xEB, 0xDD, 0xB1, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE0, 0xC9, 0x83, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBA, 0x88, 0x00, 0xE1, 0xCB, 0x88, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xF2, 0xE8, 0xC9, 0xBD, 0x8D, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01,
-  0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x19, 0xFC, 0xFA, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE0, 0xC8,
-  0x82, 0xBA, 0x87, 0x00, 0xC0, 0x92, 0x05, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92,
-  0x05, 0xBA, 0x88, 0x00, 0xD7, 0xBA, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA,
-  0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xCF, 0xAC, 0x40, 0xBC, 0x8A, 0x00, 0xC0, 0x92,
-  0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDC, 0xAE, 0xBB, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x8F, 0x00, 0xC0, 0x92, 0x04, 0xF6, 0xF0, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF4, 0xEC, 0xD3, 0xBF, 0x8F, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xBC, 0x8B, 0x00, 0xEE, 0xE1, 0xBA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xDF, 0xB4, 0xBC, 0x8B, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBB,
-  0x8A, 0x00, 0xEB, 0xDC, 0xAF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xCE, 0xAB, 0x3D,
-  0xBB, 0x89, 0x00, 0xC0, 0x92, 0x05, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBC, 0x8B, 0x00, 0xC8, 0x9F, 0x22,
-  0xFD, 0xFC, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98,
-  0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0xE5, 0xC3, 0xBD, 0x8C, 0x00, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xC7, 0x9E, 0x20, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xBD, 0x8C, 0x00, 0xCA, 0xA4, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xD0, 0xAD, 0x43, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBE, 0x8E, 0x00, 0xC3, 0x97, 0x10, 0xFA, 0xF7, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF,
-  0xFF, 0xFF, 0xE6, 0xD3, 0x9A, 0xBB, 0x89, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBB, 0x89, 0x00, 0xD3, 0xB2,
-  0x4F, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFA, 0xF6, 0xEB, 0xC5, 0x9A, 0x16, 0xBD,
-  0x8C, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBE, 0x8E, 0x00, 0xC0, 0x92, 0x04, 0xF4, 0xED, 0xD5, 0xFF, 0xFF, 0xFF, 0xFE,
-  0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00,
-  0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xD8, 0xBC, 0x65, 0xBA, 0x87, 0x00, 0xC0, 0x92, 0x06, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x05, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBA, 0x88, 0x00, 0xDD, 0xC4, 0x78, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xED, 0xDF, 0xB6, 0xBC, 0x8A, 0x00, 0xC0, 0x92, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x89, 0x00, 0xD3, 0xB2, 0x4F, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xDE, 0xC5,
-  0x7A, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xF6, 0xEF, 0xDB,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xF4, 0xEC, 0xD4, 0xC1, 0x93, 0x08, 0xBD, 0x8D,
-  0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBE, 0x8E, 0x00, 0xBE, 0x8E, 0x00, 0xEE, 0xE2, 0xBC, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xC9, 0xA1, 0x26, 0xBC, 0x8B, 0x00, 0xC0, 0x92, 0x05, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xC8, 0x9F, 0x23, 0xBD, 0x8C, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xD1, 0xAF, 0x47, 0xBB, 0x89, 0x00, 0xC0, 0x92, 0x05, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0,
-  0x92, 0x03, 0xBB, 0x8A, 0x00, 0xEC, 0xDD, 0xB2, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xD4, 0xB5, 0x56, 0xBB, 0x89, 0x00,
-  0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBA, 0x88, 0x00, 0xDC, 0xC2, 0x74, 0xFF, 0xFF, 0xFF, 0xFE,
-  0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xF2, 0xE8, 0xCB, 0xC1, 0x94, 0x08, 0xBC, 0x8C, 0x00,
-  0xC0, 0x92, 0x05, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x05, 0xBD, 0x8C, 0x00, 0xBF, 0x90, 0x00, 0xED, 0xE1, 0xB9, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xF6, 0xF0, 0xDC, 0xC2, 0x95, 0x0B, 0xBD, 0x8C, 0x00, 0xC0, 0x92, 0x05, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD,
-  0xFC, 0xFF, 0xFF, 0xFF, 0xEF, 0xE3, 0xBE, 0xBC, 0x8B, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x89, 0x00, 0xD3,
-  0xB3, 0x51, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xF1, 0xDE, 0xC1, 0x93, 0x06, 0xBE, 0x8E, 0x00, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8C, 0x00, 0xCA, 0xA3,
-  0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xA5, 0x30, 0xBC, 0x8B, 0x00, 0xC0, 0x91, 0x02, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBE, 0x8E, 0x00, 0xC3, 0x97, 0x0F, 0xFA, 0xF6, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD7, 0xC6, 0x9C, 0x1C, 0xBB, 0x88, 0x00, 0xC0,
-  0x92, 0x05, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x91, 0x02, 0xC0, 0x92, 0x05, 0xBB, 0x89, 0x00, 0xC4, 0x99, 0x14, 0xF2, 0xE8, 0xCA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xF3, 0xEA, 0xCE, 0xC2, 0x95, 0x0C, 0xBC, 0x8A, 0x00, 0xC0, 0x92, 0x06, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD,
-  0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB,
-  0xFF, 0xFF, 0xFF, 0xE1, 0xCC, 0x89, 0xBA, 0x87, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x8F, 0x00, 0xF4, 0xED, 0xD5, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF,
-  0xFF, 0xFF, 0xEB, 0xDC, 0xAF, 0xBC, 0x8A, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x89, 0x00, 0xEC, 0xDD, 0xB1, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF6, 0xEB, 0xC3, 0x97, 0x0F, 0xBE, 0x8E, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBA, 0x88, 0x00, 0xDE, 0xC6, 0x7C, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFB, 0xF9, 0xF1, 0xD2, 0xB0, 0x4A, 0xBA, 0x88, 0x00, 0xBE, 0x8E,
-  0x00, 0xC0, 0x92, 0x05, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xC0, 0x92, 0x05, 0xBE, 0x8E, 0x00, 0xBA,
-  0x88, 0x00, 0xD0, 0xAE, 0x46, 0xFA, 0xF6, 0xEB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xF6, 0xF0, 0xDD, 0xC9, 0xA2, 0x29, 0xBA, 0x87, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x01, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01,
-  0xC0, 0x92, 0x04, 0xC0, 0x91, 0x02, 0xBB, 0x89, 0x00, 0xBE, 0x8F, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B,
-  0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF,
-  0xFF, 0xFF, 0xDD, 0xC4, 0x77, 0xBA, 0x87, 0x00, 0xBF, 0x91, 0x02, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xC0, 0x92, 0x05, 0xB9, 0x86, 0x00, 0xE2, 0xCC, 0x8A, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF,
-  0xFF, 0xE6, 0xD3, 0x9A, 0xBB, 0x8A, 0x00, 0xBE, 0x8F, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC1, 0x93, 0x06, 0xB9, 0x86, 0x00, 0xD7, 0xBA, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0xE5, 0xC3, 0xBD, 0x8C, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBE, 0x8F, 0x00, 0xC2, 0x95, 0x0A, 0xF9, 0xF4, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0xD1, 0x96, 0xC2, 0x96, 0x0D, 0xBA, 0x88, 0x00,
-  0xBF, 0x8F, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xC0, 0x92, 0x04, 0xBE, 0x8E, 0x00, 0xBA, 0x88, 0x00, 0xC3, 0x98, 0x11, 0xE5, 0xD2, 0x98, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xDB, 0xC1, 0x6F, 0xBF, 0x8F, 0x00, 0xBB, 0x88, 0x00, 0xBE, 0x8E, 0x00, 0xC0, 0x91, 0x03, 0xC0, 0x92, 0x04,
-  0xC0, 0x91, 0x03, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x91, 0x02, 0xC0, 0x91, 0x03, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xBE, 0x8F, 0x00, 0xBB, 0x89, 0x00, 0xBC,
-  0x8B, 0x00, 0xCE, 0xAA, 0x3B, 0xF4, 0xEC, 0xD4, 0xDA, 0xBF, 0x6C, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF,
-  0xFF, 0xE1, 0xCB, 0x87, 0xBC, 0x8B, 0x00, 0xBD, 0x8D, 0x00, 0xC0, 0x92, 0x05, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0x03, 0xB9, 0x86, 0x00, 0xD8, 0xBC, 0x65, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF,
-  0xE9, 0xD9, 0xA9, 0xBF, 0x90, 0x00, 0xBC, 0x8B, 0x00, 0xC0, 0x92, 0x05, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xC0, 0x92, 0x05, 0xBA, 0x87, 0x00, 0xCF, 0xAC, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE2, 0xCC, 0x8A, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBB, 0x88, 0x00, 0xD8, 0xBB, 0x63, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFA, 0xF6, 0xE9, 0xDA, 0xBF, 0x6C, 0xC1, 0x93, 0x07, 0xBA,
-  0x88, 0x00, 0xBD, 0x8C, 0x00, 0xBF, 0x91, 0x02, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x03, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x01, 0xC0, 0x91, 0x02, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBC, 0x8B, 0x00, 0xBA, 0x88, 0x00, 0xC3, 0x97, 0x10, 0xDD, 0xC4, 0x78, 0xFB, 0xF7, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFE, 0xFE, 0xFD,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0,
-  0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xED, 0xD5, 0xD7, 0xBA, 0x61, 0xC3, 0x97, 0x0F, 0xBB, 0x8A, 0x00, 0xBB, 0x88, 0x00, 0xBC, 0x8A, 0x00, 0xBD,
-  0x8C, 0x00, 0xBE, 0x8E, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8F, 0x00, 0xBE, 0x8E, 0x00, 0xBD, 0x8D, 0x00, 0xBC, 0x8B, 0x00, 0xBB, 0x88, 0x00, 0xBB, 0x89, 0x00, 0xC2, 0x95, 0x0C, 0xD4, 0xB4, 0x54, 0xEE, 0xE2, 0xBD, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xEF, 0xD9, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF,
-  0xEE, 0xE1, 0xBA, 0xC6, 0x9C, 0x1C, 0xBA, 0x87, 0x00, 0xBE, 0x8E, 0x00, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x03, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x91, 0x01, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xBC, 0x8C, 0x00, 0xBB, 0x8A, 0x00, 0xDC, 0xC3, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xF4,
-  0xEC, 0xD3, 0xCB, 0xA5, 0x30, 0xBA, 0x88, 0x00, 0xBD, 0x8D, 0x00, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91,
-  0x01, 0xC0, 0x91, 0x03, 0xC0, 0x92, 0x04, 0xBD, 0x8D, 0x00, 0xBA, 0x87, 0x00, 0xD4, 0xB5, 0x54, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xD2, 0xB0, 0x4A, 0xBB, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xBD, 0x8D, 0x00, 0xF0, 0xE6, 0xC4, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF3, 0xE3, 0xDF, 0xC7, 0x7F, 0xC8, 0xA0,
-  0x26, 0xBD, 0x8D, 0x00, 0xBA, 0x88, 0x00, 0xBC, 0x8A, 0x00, 0xBD, 0x8D, 0x00, 0xBF, 0x8F, 0x00, 0xBF, 0x91, 0x01, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBE, 0x8F, 0x00,
-  0xBD, 0x8C, 0x00, 0xBB, 0x89, 0x00, 0xBB, 0x88, 0x00, 0xBF, 0x90, 0x00, 0xCC, 0xA7, 0x35, 0xE3, 0xCF, 0x91, 0xFA, 0xF7, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B,
-  0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xEC, 0xEA, 0xDB, 0xAB, 0xDA, 0xC0, 0x6D, 0xCF, 0xAC, 0x40, 0xC8, 0xA0, 0x24, 0xC4, 0x99,
-  0x14, 0xC2, 0x95, 0x0B, 0xC1, 0x94, 0x0A, 0xC1, 0x94, 0x0A, 0xC2, 0x96, 0x0E, 0xC6, 0x9C, 0x1C, 0xCD, 0xA8, 0x38, 0xD8, 0xBC, 0x66, 0xE9, 0xD8, 0xA6, 0xF9, 0xF5, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0xFC, 0xF8,
-  0xFF, 0xFF, 0xFF, 0xD6, 0xB7, 0x5A, 0xBB, 0x89, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFD,
-  0xFB, 0xF6, 0xDE, 0xC6, 0x7C, 0xC3, 0x97, 0x11, 0xBA, 0x88, 0x00, 0xBC, 0x8A, 0x00, 0xBE, 0x8E, 0x00, 0xBF, 0x90, 0x01, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBD, 0x8D, 0x00, 0xBB, 0x89,
-  0x00, 0xBB, 0x89, 0x00, 0xC9, 0xA2, 0x2A, 0xED, 0xDF, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xE4, 0xD0, 0x92, 0xC6, 0x9D, 0x1D, 0xBB, 0x89, 0x00, 0xBB, 0x89, 0x00, 0xBD, 0x8D, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBE, 0x8E, 0x00, 0xBB, 0x8A, 0x00,
-  0xBB, 0x88, 0x00, 0xC5, 0x9B, 0x19, 0xE6, 0xD4, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x97, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCA, 0xA3, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF0, 0xE6, 0xC5,
-  0xDF, 0xC8, 0x7F, 0xD0, 0xAE, 0x44, 0xC6, 0x9C, 0x1C, 0xC0, 0x92, 0x05, 0xBD, 0x8D, 0x00, 0xBC, 0x8A, 0x00, 0xBB, 0x8A, 0x00, 0xBB, 0x8A, 0x00, 0xBB, 0x8A, 0x00, 0xBC, 0x8B, 0x00, 0xBE, 0x8F, 0x00, 0xC2, 0x96, 0x0D, 0xC9, 0xA2, 0x29, 0xD5,
-  0xB6, 0x56, 0xE4, 0xD0, 0x94, 0xF5, 0xED, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA,
-  0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFB, 0xF8, 0xF0, 0xF9, 0xF5, 0xE7,
-  0xF8, 0xF3, 0xE4, 0xF8, 0xF3, 0xE4, 0xFA, 0xF6, 0xE9, 0xFD, 0xFB, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xF2,
-  0xE9, 0xCD, 0xBE, 0x8E, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFB, 0xF7, 0xED, 0xE5, 0xD2, 0x97, 0xD0, 0xAE, 0x45, 0xC4, 0x98, 0x13, 0xBE, 0x8E, 0x00, 0xBC, 0x8A, 0x00, 0xBB, 0x8A, 0x00, 0xBB, 0x8A, 0x00, 0xBC, 0x8B, 0x00, 0xBF, 0x90, 0x00, 0xC6, 0x9C, 0x1A, 0xD4, 0xB4, 0x53, 0xEA, 0xDB, 0xAD,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFD, 0xFC, 0xF8, 0xE9, 0xD9, 0xA7, 0xD3, 0xB3, 0x51, 0xC5, 0x9B, 0x19, 0xBF, 0x8F, 0x00, 0xBC, 0x8B, 0x00, 0xBB, 0x8A, 0x00, 0xBB, 0x8A, 0x00, 0xBC, 0x8B, 0x00, 0xBE, 0x8F, 0x00, 0xC4, 0x99, 0x14, 0xD1, 0xAF, 0x47, 0xE6, 0xD4, 0x9C, 0xFD,
-  0xFB, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF,
-  0xEA, 0xDB, 0xAD, 0xBB, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x05, 0xBA, 0x88, 0x00, 0xDD, 0xC4, 0x77, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFD, 0xFB, 0xF6, 0xF7, 0xF0, 0xDD, 0xF1, 0xE6, 0xC6, 0xEC, 0xDE, 0xB3, 0xE9, 0xDA, 0xA9, 0xE9, 0xD9, 0xA8, 0xEA, 0xDB, 0xAD, 0xEE, 0xE2, 0xBB, 0xF3, 0xEA, 0xD0, 0xF9, 0xF5, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFB, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98,
-  0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xD2, 0xB0,
-  0x4A, 0xBB, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF8, 0xEF, 0xF3, 0xE9, 0xCD, 0xEC, 0xDE, 0xB3, 0xE9, 0xD9, 0xA8, 0xEA, 0xDA, 0xAA, 0xEE, 0xE1, 0xBA, 0xF4, 0xED, 0xD5, 0xFD, 0xFB, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-  0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFA, 0xF5, 0xF4, 0xEC, 0xD3, 0xED, 0xDF, 0xB6, 0xE9, 0xD9, 0xA9, 0xE9, 0xDA, 0xA9, 0xED, 0xDF, 0xB6, 0xF3, 0xEA, 0xD0, 0xFB, 0xF9, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD,
-  0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFF, 0xFF, 0xFF, 0xD4, 0xB5, 0x55, 0xBB,
-  0x89, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xBD, 0x8C, 0x00, 0xEE, 0xE2, 0xBB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFD,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00,
-  0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFE, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE,
-  0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEF, 0xE3, 0xBE, 0xBC, 0x8B, 0x00,
-  0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFD, 0xFB, 0xFE,
-  0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFE, 0xFD, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE,
-  0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF8, 0xF3, 0xE4, 0xC1, 0x94, 0x09, 0xBE, 0x8F, 0x00, 0xBF, 0x90,
-  0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC3, 0x98, 0x12, 0xF9, 0xF5, 0xE9, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFD,
-  0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFD, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xCE, 0xAA, 0x3B, 0xBC, 0x8B, 0x00, 0xC0,
-  0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFE, 0xFE, 0xFD, 0xFE, 0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-  0xFE, 0xFE, 0xFD, 0xFE, 0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xE0, 0xC8, 0x82, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBC, 0x8A, 0x00, 0xCC, 0xA7, 0x34, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xEB, 0xDC, 0xAF, 0xBB, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFA, 0xF2, 0xC5, 0x9A, 0x16, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x05, 0xBB, 0x88, 0x00, 0xD4, 0xB4, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0xA4, 0x2E, 0xBC, 0x8C, 0x00, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD,
-  0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xDF, 0xC7, 0x7F, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xC0, 0x92, 0x05, 0xBA, 0x88, 0x00, 0xD8, 0xBC, 0x64, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE7, 0xD5, 0x9F, 0xBB, 0x89, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B,
-  0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xF7, 0xF1, 0xDE, 0xC0, 0x92, 0x05, 0xBF, 0x8F, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xC0, 0x92, 0x04, 0xBA, 0x88, 0x00, 0xD9, 0xBD, 0x68, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFC, 0xF9, 0xF2, 0xF8, 0xF2, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xC7, 0x9E, 0x21, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF,
-  0xFF, 0xE0, 0xCA, 0x85, 0xE8, 0xD7, 0xA2, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD,
-  0xFF, 0xFF, 0xFF, 0xD0, 0xAE, 0x44, 0xBB, 0x8A, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xC0, 0x92, 0x04, 0xBA, 0x88, 0x00, 0xD6, 0xB9, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xD2, 0xB0, 0x4A, 0xEB, 0xDC, 0xAE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0,
-  0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8F, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xF5, 0xED, 0xD6, 0xBE, 0x8E, 0x00,
-  0xC0, 0x93, 0x06, 0xF6, 0xEF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xE1, 0xCC, 0x89, 0xBB,
-  0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xC0, 0x92, 0x04, 0xBA, 0x88, 0x00, 0xD1, 0xAF, 0x47, 0xFD, 0xFC, 0xF9, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xDA, 0xBF, 0x6D, 0xB8, 0x83, 0x00, 0xEF, 0xE4, 0xC0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B,
-  0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xF7, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xF9, 0xF2, 0xC4, 0x99, 0x15, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF9, 0xF5, 0xE7, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xC9, 0xA2, 0x29, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xC6,
-  0x9D, 0x1E, 0xFB, 0xF8, 0xEE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF9, 0xFF, 0xFF, 0xFF, 0xEE, 0xE1, 0xBB, 0xBD, 0x8D, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0,
-  0x92, 0x05, 0xBB, 0x89, 0x00, 0xC9, 0xA1, 0x26, 0xF5, 0xEE, 0xD9, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xC1, 0x70, 0xBB, 0x89, 0x00, 0xBD, 0x8D, 0x00, 0xEE, 0xE2, 0xBD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA,
-  0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xCF, 0x90, 0xE8, 0xD7, 0xA3, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xDF, 0xC7, 0x7E, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xE8, 0xD7, 0xA3, 0xD6, 0xB8, 0x5C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xD4, 0xB4, 0x52, 0xBB, 0x89, 0x00, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xBC, 0x8A, 0x00, 0xCA, 0xA2,
-  0x2A, 0xFC, 0xF9, 0xF2, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF9, 0xFF, 0xFF, 0xFF, 0xF4, 0xEC, 0xD3, 0xC1, 0x93, 0x07, 0xBE, 0x8E, 0x00, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92,
-  0x05, 0xBC, 0x8B, 0x00, 0xC0, 0x92, 0x05, 0xE8, 0xD6, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xD8, 0xBB, 0x62, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x06, 0xBD, 0x8C, 0x00, 0xEE, 0xE2, 0xBD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98,
-  0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE1, 0xCC, 0x89, 0xBA, 0x87, 0x00, 0xED, 0xE0, 0xB9, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xF9, 0xF5, 0xE7, 0xC2, 0x95, 0x0B, 0xBE, 0x8F, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xDE, 0xB3, 0xB7, 0x82, 0x00, 0xDC, 0xC3, 0x75, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xDA, 0xBF, 0x6B, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x05, 0xBB, 0x8A, 0x00, 0xC9, 0xA1, 0x27,
-  0xFA, 0xF6, 0xEA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF9, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xD8, 0xC3, 0x97, 0x10, 0xBD, 0x8D, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03,
-  0xBE, 0x8F, 0x00, 0xBB, 0x89, 0x00, 0xD5, 0xB6, 0x57, 0xFB, 0xF7, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFC, 0xFA, 0xF3, 0xD0, 0xAE, 0x44, 0xBA, 0x88, 0x00, 0xC0,
-  0x92, 0x04, 0xC0, 0x91, 0x02, 0xBC, 0x8B, 0x00, 0xEE, 0xE2, 0xBD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00,
-  0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCF, 0x91, 0xBA, 0x87, 0x00, 0xBF, 0x8F, 0x00, 0xEA, 0xDA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xDA, 0xBF, 0x6D, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF,
-  0xEB, 0xDD, 0xB1, 0xBC, 0x8C, 0x00, 0xBB, 0x8A, 0x00, 0xD9, 0xBD, 0x67, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xC1, 0x70, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x05, 0xBC, 0x8B, 0x00, 0xC5, 0x9A, 0x18, 0xF3,
-  0xEA, 0xCF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFD, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xF1, 0xE6, 0xC6, 0xC2, 0x95, 0x0C, 0xBD, 0x8C, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xC0,
-  0x91, 0x03, 0xBB, 0x89, 0x00, 0xC4, 0x98, 0x12, 0xE7, 0xD5, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xE6, 0xC5, 0xC6, 0x9C, 0x1C, 0xBB, 0x89, 0x00, 0xC0, 0x92, 0x05, 0xBF, 0x90, 0x00, 0xC0, 0x91,
-  0x02, 0xBC, 0x8C, 0x00, 0xEE, 0xE2, 0xBD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBB, 0x89, 0x00, 0xC0, 0x91, 0x02, 0xBC, 0x8B, 0x00, 0xE2, 0xCD, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF6, 0xF0, 0xDC, 0xC0, 0x91, 0x02, 0xBF, 0x8F, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC,
-  0x8A, 0x00, 0xC1, 0x93, 0x07, 0xBA, 0x88, 0x00, 0xD2, 0xB1, 0x4B, 0xFD, 0xFC, 0xF8, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xD6, 0xB8, 0x5B, 0xBA, 0x88, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBD, 0x8C, 0x00, 0xBF, 0x90, 0x01, 0xE6, 0xD4,
-  0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xE7, 0xD5, 0x9F, 0xBF, 0x8F, 0x00, 0xBD, 0x8D, 0x00, 0xC0, 0x92, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92,
-  0x04, 0xBE, 0x8E, 0x00, 0xBB, 0x89, 0x00, 0xCD, 0xA9, 0x38, 0xEF, 0xE3, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xDD, 0xC5, 0x79, 0xBD, 0x8D, 0x00, 0xBD, 0x8C, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xBC, 0x8C, 0x00,
-  0xEE, 0xE2, 0xBD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xED, 0xC3, 0x98, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xCE, 0x8E, 0xBA, 0x88, 0x00, 0xC0, 0x93, 0x06, 0xBF, 0x90, 0x01, 0xBB, 0x88, 0x00, 0xD7, 0xBA, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD,
-  0xFB, 0xFF, 0xFF, 0xFF, 0xD6, 0xB9, 0x5D, 0xBB, 0x89, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xFA, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xDD, 0xB1, 0xBC, 0x8A, 0x00, 0xC0, 0x91,
-  0x03, 0xC0, 0x92, 0x05, 0xBB, 0x89, 0x00, 0xC8, 0x9F, 0x23, 0xF2, 0xE9, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xF2, 0xE0, 0xCC, 0xA7, 0x34, 0xBB, 0x88,
-  0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x8F, 0x00, 0xBB, 0x89, 0x00, 0xD4, 0xB4, 0x54,
-  0xFA, 0xF6, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xF6, 0xD7, 0xBA, 0x61, 0xBB, 0x89, 0x00,
-  0xBF, 0x8F, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02,
-  0xC0, 0x92, 0x04, 0xBC, 0x8B, 0x00, 0xBC, 0x8C, 0x00, 0xD1, 0xAF, 0x48, 0xEF, 0xE3, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xDC, 0xAF, 0xC8, 0xA0, 0x25, 0xBA, 0x88, 0x00, 0xBF, 0x90, 0x01, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xBC, 0x8C, 0x00, 0xEE, 0xE1, 0xBB, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFC, 0xF9, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE,
-  0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFA, 0xF6, 0xEA, 0xC3, 0x97, 0x11, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCC, 0xA7, 0x34, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE,
-  0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFD, 0xFC, 0xF8,
-  0xFF, 0xFF, 0xFF, 0xE2, 0xCD, 0x8D, 0xBB, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x01, 0xC0, 0x92, 0x04, 0xBA, 0x88, 0x00, 0xCA, 0xA3, 0x2B, 0xF3, 0xEB, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF,
-  0xF2, 0xE9, 0xCD, 0xBD, 0x8D, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xBD,
-  0x8D, 0x00, 0xC5, 0x9B, 0x1A, 0xFC, 0xF9, 0xF2, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE,
-  0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFD, 0xFC, 0xF9, 0xFF, 0xFF, 0xFF, 0xEB, 0xDC, 0xAF, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00,
-  0xC0, 0x92, 0x05, 0xBD, 0x8C, 0x00, 0xBE, 0x8F, 0x00, 0xDF, 0xC8, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0xD4, 0x9C, 0xC1, 0x94, 0x09, 0xBC, 0x8A, 0x00, 0xC0, 0x92, 0x05, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xC0, 0x92, 0x04, 0xBB, 0x89, 0x00, 0xC3, 0x96, 0x0E, 0xE3,
-  0xCF, 0x91, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xDB, 0xAD, 0xC6, 0x9C, 0x1C, 0xBB, 0x88, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x91, 0x01, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0,
-  0x91, 0x03, 0xC0, 0x91, 0x02, 0xBB, 0x8A, 0x00, 0xBC, 0x8C, 0x00, 0xCD, 0xA9, 0x3A, 0xE8, 0xD7, 0xA3, 0xFC, 0xFA, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF,
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xDF, 0xB6, 0xCE,
-  0xAA, 0x3C, 0xBB, 0x8A, 0x00, 0xBD, 0x8C, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xBC, 0x8B, 0x00, 0xF1, 0xE6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xF8, 0xC4, 0x98, 0x12, 0xBE, 0x8E, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xCD, 0xA8, 0x37, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4,
-  0xD1, 0x95, 0xBA, 0x88, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x05, 0xBC, 0x8B, 0x00, 0xBF, 0x8F, 0x00, 0xDF, 0xC7, 0x7F, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE,
-  0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xD9, 0xA8, 0xCA, 0xA4, 0x2D, 0xBF,
-  0x8F, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xC6, 0x9C,
-  0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xE1, 0xB9, 0xBB, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0,
-  0x91, 0x03, 0xBF, 0x90, 0x00, 0xBA, 0x88, 0x00, 0xC9, 0xA2, 0x28, 0xEB, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xE6, 0xC6, 0xCF, 0xAB, 0x3E, 0xBB, 0x89, 0x00, 0xBE, 0x8F, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xBE, 0x8E, 0x00, 0xBA, 0x88, 0x00, 0xC9, 0xA1,
-  0x26, 0xE7, 0xD5, 0x9F, 0xFE, 0xFD, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE4, 0xC2, 0xD0, 0xAD, 0x42, 0xBB, 0x8A, 0x00, 0xBD, 0x8D, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0x02, 0xBC, 0x8B, 0x00, 0xBB, 0x89, 0x00, 0xC5, 0x9A, 0x17, 0xD9, 0xBD, 0x68, 0xEE, 0xE2, 0xBD, 0xFD, 0xFC, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC,
-  0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFD, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFD, 0xFE,
-  0xFE, 0xFD, 0xFE, 0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF5, 0xE7, 0xE4, 0xD1, 0x95, 0xCB, 0xA5, 0x30, 0xBC, 0x8B, 0x00, 0xBC, 0x8A, 0x00, 0xC0, 0x91,
-  0x03, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xE3, 0xCF, 0x91, 0xF3, 0xEA, 0xCE, 0xF0, 0xE4, 0xC2, 0xF0, 0xE5, 0xC4,
-  0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0,
-  0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC3, 0xF1, 0xE7, 0xC8, 0xED, 0xDF, 0xB6, 0xC2, 0x96, 0x0D, 0xBE, 0x8F, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBD, 0x8C, 0x00, 0xC9, 0xA2, 0x29, 0xF1, 0xE7, 0xC8, 0xF0, 0xE5, 0xC3, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0,
-  0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xEF, 0xE4, 0xC1, 0xF4, 0xEB, 0xD2, 0xDA, 0xC0, 0x6D, 0xBC, 0x8A,
-  0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBA, 0x88, 0x00, 0xC7, 0x9E, 0x21, 0xE7, 0xD5, 0x9E, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFC, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFE, 0xFF, 0xFE, 0xFD, 0xFE,
-  0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xF7, 0xEC, 0xE5, 0xD1, 0x96, 0xCA, 0xA3, 0x2C, 0xBB, 0x89, 0x00, 0xBC, 0x8B, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xBE, 0x8E, 0x00, 0xC4, 0x99, 0x14, 0xEE, 0xE2, 0xBC,
-  0xF1, 0xE6, 0xC6, 0xF0, 0xE5, 0xC3, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0,
-  0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE5, 0xC4, 0xF0, 0xE4, 0xC1, 0xF3, 0xEA, 0xD0, 0xE1, 0xCB, 0x88, 0xBC, 0x8C, 0x00, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x01, 0xC0, 0x92, 0x04, 0xBD, 0x8C, 0x00, 0xBC, 0x8A, 0x00, 0xCD, 0xA8, 0x37, 0xEA, 0xDA, 0xAA, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFD,
-  0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFD, 0xFE, 0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xE3, 0xBE, 0xD2, 0xB1, 0x4C, 0xBD, 0x8D, 0x00, 0xBC, 0x8A, 0x00, 0xC0, 0x92, 0x04, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xC0, 0x92, 0x04, 0xBD, 0x8C, 0x00, 0xBB, 0x89, 0x00,
-  0xC7, 0x9E, 0x1F, 0xDF, 0xC8, 0x80, 0xF6, 0xEF, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFC, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFD, 0xFE, 0xFE, 0xFC, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFD, 0xFB, 0xF7, 0xEA, 0xDA, 0xAB, 0xCF, 0xAC, 0x41, 0xBD, 0x8C, 0x00, 0xBC, 0x8A, 0x00, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xC0, 0x92, 0x04, 0xBE, 0x8E, 0x00, 0xBB, 0x88, 0x00, 0xBC, 0x8B, 0x00, 0xC6, 0x9D, 0x1D, 0xD6, 0xB8, 0x5C, 0xE7, 0xD6, 0xA0, 0xF5, 0xED, 0xD7, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xEF, 0xDA, 0xE6, 0xD4, 0x9C, 0xD3, 0xB2, 0x4E, 0xC2, 0x95, 0x0C, 0xBB, 0x88, 0x00, 0xBC, 0x8B, 0x00, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBE, 0x8D, 0x00, 0xBD, 0x8C, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD,
-  0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D,
-  0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x8F, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D,
-  0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8C, 0x00, 0xBE, 0x8E, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xC0, 0x92, 0x04, 0xBD, 0x8D, 0x00, 0xBB, 0x89, 0x00, 0xC7, 0x9E, 0x21, 0xDF, 0xC8, 0x7F, 0xF4, 0xEC, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF4, 0xE7, 0xEA, 0xDA, 0xAB, 0xD5, 0xB7, 0x59, 0xC3, 0x97, 0x0F, 0xBB, 0x88, 0x00, 0xBD, 0x8C, 0x00, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD,
-  0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D,
-  0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8C, 0x00, 0xBE, 0x8E, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xC0, 0x91, 0x02, 0xC0, 0x91, 0x03, 0xBC, 0x8B, 0x00, 0xBB, 0x89, 0x00, 0xC7, 0x9E, 0x20, 0xDC, 0xC3, 0x74, 0xF0, 0xE6, 0xC5, 0xFD, 0xFC, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xEC, 0xD4, 0xE1, 0xCB, 0x88, 0xCB, 0xA5,
-  0x30, 0xBC, 0x8C, 0x00, 0xBB, 0x89, 0x00, 0xBF, 0x91, 0x01, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xC0, 0x92, 0x04, 0xBD, 0x8D, 0x00, 0xBA,
-  0x88, 0x00, 0xBF, 0x91, 0x02, 0xCE, 0xAB, 0x3E, 0xE2, 0xCD, 0x8C, 0xF3, 0xEA, 0xCE, 0xFD, 0xFC, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF8, 0xEE, 0xED, 0xE0, 0xB7, 0xD9, 0xBE, 0x69, 0xC6, 0x9C, 0x1C,
-  0xBB, 0x8A, 0x00, 0xBC, 0x8A, 0x00, 0xBF, 0x91, 0x02, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xBB, 0x89, 0x00, 0xBB, 0x89, 0x00, 0xBF, 0x90, 0x01, 0xC7, 0x9F, 0x22, 0xD2, 0xB1, 0x4C, 0xDD, 0xC4, 0x78, 0xE7, 0xD5, 0x9F, 0xEF, 0xE3,
-  0xBF, 0xF5, 0xED, 0xD7, 0xF9, 0xF5, 0xE8, 0xFC, 0xFA, 0xF2, 0xFE, 0xFD, 0xFA, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFD, 0xF9, 0xFB, 0xF9, 0xF1, 0xF8, 0xF3, 0xE4, 0xF3, 0xEA, 0xCF, 0xEB, 0xDD, 0xB1, 0xE1, 0xCC, 0x89,
-  0xD5, 0xB7, 0x5A, 0xC9, 0xA2, 0x29, 0xC0, 0x91, 0x02, 0xBB, 0x89, 0x00, 0xBB, 0x89, 0x00, 0xBE, 0x8F, 0x00, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x01, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91,
-  0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02,
-  0xBF, 0x91, 0x02, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02,
-  0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x01, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xC0, 0x92, 0x04, 0xBD, 0x8D, 0x00, 0xBA, 0x88, 0x00, 0xBF, 0x8F, 0x00, 0xCA, 0xA4, 0x2E, 0xD9, 0xBD, 0x68, 0xE6, 0xD4, 0x9C, 0xF0, 0xE5,
-  0xC4, 0xF7, 0xF1, 0xDE, 0xFB, 0xF8, 0xEE, 0xFD, 0xFC, 0xF7, 0xFE, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFD, 0xFB, 0xF5, 0xFA, 0xF6, 0xEB, 0xF6, 0xEF, 0xDA, 0xEF, 0xE4, 0xC0, 0xE6, 0xD4, 0x9C, 0xDA, 0xBF, 0x6D,
-  0xCD, 0xA9, 0x39, 0xC2, 0x95, 0x0B, 0xBB, 0x8A, 0x00, 0xBB, 0x89, 0x00, 0xBE, 0x8E, 0x00, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x01, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91,
-  0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02,
-  0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x01, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0x03, 0xBD, 0x8D, 0x00, 0xBA, 0x88, 0x00, 0xBD, 0x8D, 0x00, 0xC7, 0x9D, 0x1E, 0xD4, 0xB5, 0x54, 0xE2, 0xCC, 0x8A, 0xED, 0xDF, 0xB6, 0xF4, 0xED, 0xD5, 0xFA, 0xF6, 0xEA, 0xFD, 0xFB, 0xF6, 0xFE, 0xFE,
-  0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xF9, 0xFB, 0xF8, 0xEE, 0xF6, 0xF0, 0xDD, 0xEF, 0xE4, 0xC0, 0xE5, 0xD2, 0x97, 0xD8, 0xBB, 0x62, 0xCA, 0xA2, 0x2A, 0xBF, 0x8F, 0x00, 0xBA, 0x88, 0x00, 0xBC, 0x8B, 0x00, 0xC0, 0x91, 0x02,
-  0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xC0, 0x92, 0x04, 0xBF, 0x90,
-  0x00, 0xBC, 0x8A, 0x00, 0xBA, 0x88, 0x00, 0xBE, 0x8E, 0x00, 0xC7, 0x9E, 0x1F, 0xD3, 0xB2, 0x4F, 0xDF, 0xC7, 0x7F, 0xE9, 0xDA, 0xA9, 0xF1, 0xE8, 0xC9, 0xF7, 0xF2, 0xE0, 0xFB, 0xF8, 0xEF, 0xFD, 0xFC, 0xF8, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFD, 0xFD, 0xFC, 0xF9, 0xFB, 0xF8, 0xEF, 0xF7, 0xF2, 0xE0, 0xF1, 0xE7, 0xC7, 0xE8, 0xD7, 0xA4, 0xDD, 0xC3, 0x76, 0xD0, 0xAD, 0x42, 0xC4, 0x98, 0x12, 0xBC, 0x8B, 0x00, 0xBB, 0x88, 0x00, 0xBD, 0x8D, 0x00, 0xC0, 0x91, 0x03, 0xC0,
-  0x91, 0x03, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBD, 0x8D, 0x00, 0xBB, 0x89, 0x00, 0xBA, 0x88, 0x00, 0xBB, 0x89, 0x00, 0xBD, 0x8C, 0x00, 0xBF, 0x90, 0x01,
-  0xC2, 0x95, 0x0C, 0xC5, 0x9A, 0x18, 0xC7, 0x9E, 0x20, 0xC8, 0xA0, 0x26, 0xCA, 0xA3, 0x2B, 0xC9, 0xA1, 0x26, 0xC7, 0x9E, 0x1F, 0xC4, 0x9A, 0x16, 0xC1, 0x94, 0x09, 0xBE, 0x8F, 0x00, 0xBC, 0x8A, 0x00, 0xBA, 0x88, 0x00, 0xBB, 0x89, 0x00, 0xBD,
-  0x8C, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x00, 0xBC, 0x8C, 0x00, 0xBB, 0x88, 0x00, 0xBB, 0x89, 0x00, 0xBD, 0x8C, 0x00, 0xC0, 0x92, 0x05,
-  0xC4, 0x98, 0x12, 0xC6, 0x9D, 0x1D, 0xC8, 0x9F, 0x24, 0xCA, 0xA2, 0x2A, 0xC9, 0xA2, 0x29, 0xC8, 0x9F, 0x22, 0xC6, 0x9C, 0x1B, 0xC3, 0x97, 0x0F, 0xC0, 0x91, 0x03, 0xBD, 0x8C, 0x00, 0xBB, 0x89, 0x00, 0xBA, 0x88, 0x00, 0xBC, 0x8B, 0x00, 0xBE,
-  0x8F, 0x00, 0xC0, 0x91, 0x03, 0xC0, 0x92, 0x04, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xC0, 0x92, 0x04, 0xBF, 0x91, 0x02, 0xBD, 0x8D, 0x00, 0xBB, 0x89, 0x00, 0xBA, 0x88, 0x00, 0xBC, 0x8B, 0x00, 0xBF, 0x90, 0x00, 0xC3, 0x96, 0x0E, 0xC6, 0x9C, 0x1B, 0xC8, 0x9F, 0x23, 0xCA, 0xA2, 0x2A,
-  0xC9, 0xA1, 0x27, 0xC7, 0x9D, 0x1F, 0xC4, 0x98, 0x13, 0xC0, 0x92, 0x04, 0xBD, 0x8C, 0x00, 0xBB, 0x88, 0x00, 0xBB, 0x88, 0x00, 0xBD, 0x8C, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xC0, 0x91, 0x03,
-  0xC0, 0x92, 0x04, 0xBF, 0x90, 0x01, 0xBD, 0x8D, 0x00, 0xBB, 0x89, 0x00, 0xBA, 0x88, 0x00, 0xBB, 0x89, 0x00, 0xBD, 0x8D, 0x00, 0xC1, 0x93, 0x07, 0xC4, 0x99, 0x13, 0xC7, 0x9D, 0x1E, 0xC8, 0xA0, 0x25, 0xCA, 0xA3, 0x2B, 0xC8, 0xA0, 0x26, 0xC7,
-  0x9D, 0x1F, 0xC4, 0x99, 0x14, 0xC1, 0x93, 0x06, 0xBD, 0x8D, 0x00, 0xBB, 0x89, 0x00, 0xBA, 0x88, 0x00, 0xBC, 0x8A, 0x00, 0xBE, 0x8E, 0x00, 0xC0, 0x91, 0x03, 0xC0, 0x92, 0x04, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x91, 0x02, 0xC0, 0x91, 0x03, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBE, 0x8F, 0x00, 0xBE,
-  0x8D, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8C, 0x00, 0xBD, 0x8C, 0x00, 0xBD, 0x8C, 0x00, 0xBD, 0x8D, 0x00, 0xBE, 0x8E, 0x00, 0xBE, 0x8F, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x03, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x02, 0xBF, 0x90,
-  0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xC0, 0x91, 0x02, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xBF, 0x91, 0x02, 0xBF, 0x8F, 0x00, 0xBE, 0x8E, 0x00, 0xBD,
-  0x8D, 0x00, 0xBD, 0x8C, 0x00, 0xBD, 0x8C, 0x00, 0xBD, 0x8C, 0x00, 0xBD, 0x8C, 0x00, 0xBD, 0x8D, 0x00, 0xBE, 0x8E, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x01, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x91, 0x02, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x00, 0xBE, 0x8E, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8C, 0x00, 0xBD, 0x8C, 0x00, 0xBD, 0x8C, 0x00, 0xBD,
-  0x8D, 0x00, 0xBE, 0x8E, 0x00, 0xBF, 0x8F, 0x00, 0xBF, 0x91, 0x02, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x02, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x91, 0x02, 0xC0, 0x91, 0x03, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x03, 0xBF, 0x90, 0x01, 0xBF, 0x8F, 0x00, 0xBE, 0x8E, 0x00, 0xBD, 0x8D, 0x00, 0xBD, 0x8C, 0x00, 0xBD, 0x8C, 0x00, 0xBD, 0x8C, 0x00, 0xBD, 0x8D, 0x00, 0xBE, 0x8E,
-  0x00, 0xBF, 0x8F, 0x00, 0xBF, 0x91, 0x01, 0xC0, 0x92, 0x04, 0xC0, 0x92, 0x04, 0xC0, 0x91, 0x03, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x91, 0x01, 0xBF, 0x91,
-  0x02, 0xBF, 0x91, 0x02, 0xC0, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x91, 0x01, 0xBF, 0x91, 0x02, 0xBF, 0x91,
-  0x02, 0xC0, 0x91, 0x02, 0xC0, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xC0, 0x91, 0x02, 0xC0, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91,
-  0x01, 0xBF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0x91, 0x01, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xC0, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x02, 0xBF, 0x91, 0x01, 0xBF, 0x90, 0x01,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-  0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90,
-  0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00,
-  0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0x00
+static const uint8_t armlogo_data[10710] = {
+  0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xBB, 0x00,
+  0x80, 0x01, 0x00, 0x02, 0x80, 0x03, 0x00, 0x04, 0x80, 0x03, 0x01, 0x02, 0x01, 0xEC, 0x00, 0x01,
+  0x01, 0x02, 0x80, 0x03, 0x80, 0x04, 0x80, 0x03, 0x80, 0x01, 0xC1, 0x00, 0x00, 0x01, 0x80, 0x03,
+  0x80, 0x04, 0x02, 0x03, 0x02, 0x01, 0xA9, 0x00, 0x01, 0x01, 0x02, 0x80, 0x03, 0x00, 0x04, 0x80,
+  0x03, 0x01, 0x02, 0x01, 0xB4, 0x00, 0xB5, 0x00, 0x02, 0x01, 0x03, 0x05, 0x80, 0x06, 0x04, 0x04,
+  0x00, 0x07, 0x08, 0x09, 0x81, 0x0A, 0x04, 0x09, 0x0B, 0x07, 0x00, 0x05, 0x80, 0x06, 0x01, 0x04,
+  0x01, 0xE2, 0x00, 0x00, 0x04, 0x80, 0x06, 0x03, 0x03, 0x0C, 0x0B, 0x09, 0x82, 0x0A, 0x03, 0x09,
+  0x0B, 0x00, 0x03, 0x80, 0x06, 0x01, 0x05, 0x01, 0xB7, 0x00, 0x00, 0x03, 0x80, 0x06, 0x03, 0x05,
+  0x00, 0x0B, 0x09, 0x81, 0x0A, 0x03, 0x09, 0x0B, 0x0C, 0x03, 0x80, 0x06, 0x00, 0x04, 0xA0, 0x00,
+  0x07, 0x03, 0x05, 0x06, 0x05, 0x01, 0x0C, 0x0B, 0x09, 0x81, 0x0A, 0x03, 0x09, 0x0B, 0x0C, 0x02,
+  0x80, 0x06, 0x01, 0x05, 0x02, 0xAF, 0x00, 0xB2, 0x00, 0x00, 0x03, 0x80, 0x06, 0x18, 0x00, 0x09,
+  0x0D, 0x0E, 0x0D, 0x0A, 0x01, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x07, 0x18,
+  0x0E, 0x0D, 0x0A, 0x00, 0x06, 0x05, 0x01, 0xDC, 0x00, 0x18, 0x03, 0x06, 0x00, 0x19, 0x1A, 0x0D,
+  0x0A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x05, 0x0A, 0x0D, 0x0E, 0x24, 0x07,
+  0x05, 0x06, 0x01, 0xB1, 0x00, 0x10, 0x03, 0x06, 0x03, 0x09, 0x0D, 0x0E, 0x24, 0x00, 0x25, 0x22,
+  0x26, 0x1F, 0x14, 0x15, 0x27, 0x06, 0x0A, 0x80, 0x1A, 0x03, 0x0A, 0x00, 0x06, 0x04, 0x99, 0x00,
+  0x19, 0x01, 0x05, 0x06, 0x01, 0x09, 0x0D, 0x0E, 0x0D, 0x09, 0x28, 0x27, 0xAE, 0x29, 0x13, 0x12,
+  0x15, 0x2A, 0x2B, 0x09, 0x0D, 0x0E, 0x18, 0x0B, 0x05, 0x06, 0x03, 0xAC, 0x00, 0xAF, 0x00, 0x03,
+  0x02, 0x06, 0x04, 0x09, 0x80, 0x0D, 0x15, 0x01, 0x21, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x64, 0x20, 0x04, 0x80, 0x0D, 0x02,
+  0x07, 0x06, 0x04, 0x8A, 0x00, 0x02, 0x01, 0x03, 0x02, 0x90, 0x03, 0x00, 0x02, 0x98, 0x00, 0x91,
+  0x03, 0x02, 0x02, 0x03, 0x01, 0x86, 0x00, 0x0C, 0x03, 0x06, 0x09, 0x0E, 0x0C, 0x3D, 0x3E, 0x3F,
+  0x40, 0x41, 0x42, 0x43, 0x44, 0x80, 0x35, 0x0D, 0x44, 0x45, 0x46, 0x82, 0x47, 0x3F, 0x48, 0x49,
+  0x4A, 0x4B, 0x0D, 0x0B, 0x06, 0x04, 0x8E, 0x00, 0x00, 0x02, 0x90, 0x03, 0x02, 0x02, 0x03, 0x01,
+  0x87, 0x00, 0x80, 0x05, 0x18, 0x09, 0x0E, 0x09, 0xAE, 0x9C, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x44,
+  0x35, 0x51, 0x52, 0x42, 0x53, 0x47, 0x54, 0x55, 0x1F, 0x0C, 0x0E, 0x24, 0x04, 0x05, 0x95, 0x00,
+  0x1B, 0x03, 0x06, 0x00, 0x18, 0x0E, 0x0B, 0x15, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x34,
+  0x35, 0x34, 0x52, 0x5B, 0x5A, 0x74, 0x84, 0x5D, 0x5E, 0x1C, 0x24, 0x1A, 0x09, 0x80, 0x05, 0xAA,
+  0x00, 0xAD, 0x00, 0x09, 0x05, 0x06, 0x0B, 0x1A, 0x24, 0x1D, 0x5F, 0xE7, 0x30, 0x60, 0x91, 0x35,
+  0x05, 0x82, 0x3F, 0x56, 0x0F, 0x1A, 0x24, 0x80, 0x05, 0x88, 0x00, 0x01, 0x08, 0x0A, 0x92, 0x09,
+  0x97, 0x00, 0x00, 0x0C, 0x92, 0x09, 0x02, 0x0A, 0x0B, 0x01, 0x83, 0x00, 0x06, 0x01, 0x06, 0x09,
+  0x0D, 0x61, 0x57, 0x62, 0x90, 0x35, 0x07, 0x6F, 0x63, 0x64, 0x23, 0x1A, 0x0A, 0x05, 0x04, 0x8C,
+  0x00, 0x92, 0x09, 0x01, 0x0A, 0x0B, 0x85, 0x00, 0x07, 0x04, 0x05, 0x24, 0x0D, 0x11, 0x65, 0x66,
+  0x5C, 0x8E, 0x35, 0x06, 0x62, 0x67, 0x68, 0x19, 0x0D, 0x02, 0x05, 0x91, 0x00, 0x08, 0x04, 0x06,
+  0x09, 0x0E, 0x03, 0xF2, 0x8F, 0x69, 0x52, 0x8F, 0x35, 0x07, 0x42, 0xEF, 0x6A, 0x6B, 0x4B, 0x18,
+  0x03, 0x05, 0xA8, 0x00, 0xAB, 0x00, 0x07, 0x05, 0x04, 0x24, 0x0D, 0x6C, 0x3E, 0x6D, 0x43, 0x82,
+  0x35, 0x00, 0x44, 0x80, 0x60, 0x02, 0x44, 0x6E, 0x36, 0x81, 0x51, 0x00, 0x35, 0x81, 0x51, 0x02,
+  0x34, 0x6E, 0x44, 0x80, 0x60, 0x82, 0x35, 0x06, 0x6F, 0x70, 0x68, 0x24, 0x18, 0x05, 0x04, 0x84,
+  0x00, 0x04, 0x03, 0x09, 0x71, 0x69, 0x72, 0x8E, 0x40, 0x05, 0x73, 0x74, 0x4D, 0x75, 0x07, 0x01,
+  0x92, 0x00, 0x04, 0x03, 0x0A, 0x20, 0x74, 0x73, 0x8F, 0x40, 0x04, 0x76, 0x77, 0x48, 0x18, 0x05,
+  0x81, 0x00, 0x05, 0x05, 0x00, 0x0E, 0x61, 0x78, 0x60, 0x81, 0x35, 0x80, 0x60, 0x02, 0x44, 0x34,
+  0x36, 0x80, 0x51, 0x00, 0x35, 0x81, 0x51, 0x02, 0x36, 0x34, 0x44, 0x80, 0x60, 0x00, 0x36, 0x81,
+  0x35, 0x05, 0x79, 0x54, 0x7A, 0x0D, 0x24, 0x01, 0x88, 0x00, 0x05, 0x02, 0x0B, 0x2A, 0x7B, 0x7C,
+  0x73, 0x8E, 0x40, 0x04, 0x72, 0x7D, 0x67, 0x19, 0x04, 0x81, 0x00, 0x06, 0x01, 0x06, 0x0A, 0x18,
+  0x7E, 0x7F, 0x33, 0x81, 0x35, 0x04, 0x44, 0x60, 0x44, 0x6E, 0x36, 0x80, 0x51, 0x00, 0x35, 0x81,
+  0x51, 0x01, 0x34, 0x44, 0x80, 0x60, 0x82, 0x35, 0x05, 0x80, 0x2C, 0x09, 0x18, 0x06, 0x02, 0x8D,
+  0x00, 0x06, 0x02, 0x06, 0x0A, 0x0D, 0x15, 0x81, 0x82, 0x82, 0x35, 0x00, 0x44, 0x80, 0x60, 0x01,
+  0x44, 0x34, 0x81, 0x51, 0x00, 0x35, 0x81, 0x51, 0x01, 0x34, 0x44, 0x80, 0x60, 0x00, 0x6E, 0x81,
+  0x35, 0x06, 0x43, 0x63, 0x83, 0x0A, 0x18, 0x05, 0x04, 0xA6, 0x00, 0xA9, 0x00, 0x06, 0x05, 0x04,
+  0x4B, 0x19, 0x49, 0x84, 0x85, 0x81, 0x35, 0x80, 0x60, 0x01, 0x6E, 0x51, 0x91, 0x35, 0x02, 0x34,
+  0x60, 0x44, 0x81, 0x35, 0x05, 0x4D, 0x86, 0x4B, 0x0A, 0x06, 0x01, 0x82, 0x00, 0x02, 0x04, 0x24,
+  0x7C, 0x92, 0x35, 0x03, 0x5C, 0x1C, 0x0B, 0x02, 0x92, 0x00, 0x02, 0x05, 0x24, 0x7E, 0x93, 0x35,
+  0x02, 0x70, 0x0E, 0x06, 0x80, 0x00, 0x04, 0x1B, 0x24, 0x0C, 0x57, 0x60, 0x80, 0x35, 0x01, 0x60,
+  0x6E, 0x90, 0x35, 0x00, 0x36, 0x80, 0x60, 0x81, 0x35, 0x03, 0x87, 0x88, 0x0C, 0x01, 0x87, 0x00,
+  0x02, 0x03, 0x09, 0x22, 0x93, 0x35, 0x02, 0x89, 0x4B, 0x05, 0x80, 0x00, 0x04, 0x05, 0x00, 0x0E,
+  0x20, 0x8A, 0x81, 0x35, 0x02, 0x60, 0x44, 0x51, 0x8E, 0x35, 0x02, 0x6E, 0x60, 0x51, 0x80, 0x35,
+  0x04, 0x7C, 0xF2, 0x0D, 0x07, 0x06, 0x8B, 0x00, 0x05, 0x06, 0x0B, 0x0E, 0x14, 0x2E, 0x37, 0x80,
+  0x35, 0x03, 0x34, 0x60, 0x6E, 0x51, 0x8F, 0x35, 0x02, 0x51, 0x44, 0x60, 0x81, 0x35, 0x04, 0x72,
+  0x5E, 0x4B, 0x09, 0x06, 0xA5, 0x00, 0xA7, 0x00, 0x05, 0x03, 0x06, 0x24, 0x19, 0xAC, 0x2F, 0x81,
+  0x35, 0x02, 0x60, 0x44, 0x51, 0x98, 0x35, 0x02, 0x36, 0x60, 0x51, 0x80, 0x35, 0x04, 0x8B, 0x29,
+  0x0E, 0x01, 0x05, 0x81, 0x00, 0x04, 0x04, 0x19, 0x8C, 0x35, 0x37, 0x8E, 0x44, 0x05, 0x60, 0x35,
+  0x4F, 0x8D, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x8E, 0x35, 0x60, 0x8F, 0x44, 0x09, 0x5C,
+  0x35, 0x8F, 0x1A, 0x06, 0x01, 0x06, 0x0E, 0x13, 0x77, 0x80, 0x35, 0x01, 0x60, 0x51, 0x95, 0x35,
+  0x06, 0x36, 0x60, 0x44, 0x35, 0x90, 0x09, 0x02, 0x87, 0x00, 0x05, 0x02, 0x09, 0x91, 0x92, 0x35,
+  0x60, 0x8E, 0x44, 0x09, 0x52, 0x35, 0x8B, 0x18, 0x05, 0x00, 0x1B, 0x0A, 0x07, 0x81, 0x80, 0x35,
+  0x02, 0x34, 0x60, 0x51, 0x94, 0x35, 0x80, 0x44, 0x80, 0x35, 0x03, 0x3F, 0x17, 0x18, 0x1B, 0x88,
+  0x00, 0x05, 0x02, 0x06, 0x0D, 0x25, 0x71, 0x51, 0x80, 0x35, 0x01, 0x60, 0x34, 0x96, 0x35, 0x02,
+  0x51, 0x60, 0x6E, 0x80, 0x35, 0x04, 0x93, 0x6B, 0x1A, 0x05, 0x02, 0xA3, 0x00, 0xA6, 0x00, 0x04,
+  0x06, 0x0B, 0x0D, 0x49, 0x2F, 0x80, 0x35, 0x02, 0x34, 0x60, 0x51, 0x9E, 0x35, 0x07, 0x60, 0x6E,
+  0x35, 0x6E, 0x94, 0x09, 0x0A, 0x06, 0x80, 0x00, 0x04, 0x04, 0x19, 0x6D, 0x35, 0x44, 0x8E, 0x35,
+  0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F,
+  0x35, 0x07, 0x60, 0x35, 0x98, 0x0E, 0x99, 0x01, 0x1A, 0x9A, 0x80, 0x35, 0x01, 0x33, 0x51, 0x99,
+  0x35, 0x04, 0x60, 0x35, 0xAF, 0x0D, 0x06, 0x87, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51,
+  0x8E, 0x35, 0x08, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x1B, 0x0D, 0x26, 0x90, 0x80, 0x35, 0x00, 0x60,
+  0x99, 0x35, 0x06, 0x44, 0x6E, 0x35, 0x5A, 0x8E, 0x1A, 0x06, 0x86, 0x00, 0x04, 0x05, 0x0C, 0x0D,
+  0x9C, 0x9D, 0x80, 0x35, 0x01, 0x60, 0x51, 0x9B, 0x35, 0x80, 0x44, 0x05, 0x35, 0x50, 0x9E, 0x0D,
+  0x0C, 0x05, 0xA2, 0x00, 0xA4, 0x00, 0x04, 0x02, 0x05, 0x0D, 0x1C, 0x78, 0x80, 0x35, 0x80, 0x44,
+  0xA3, 0x35, 0x00, 0x60, 0x80, 0x35, 0x09, 0x66, 0x6B, 0x0D, 0x1B, 0x00, 0x04, 0x19, 0x6D, 0x35,
+  0x44, 0x8E, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97,
+  0x35, 0x51, 0x8F, 0x35, 0x06, 0x60, 0x35, 0x98, 0x0D, 0x04, 0x24, 0x8F, 0x80, 0x35, 0x00, 0x60,
+  0x9A, 0x35, 0x05, 0x34, 0x35, 0x9F, 0x04, 0x0C, 0x01, 0x87, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B,
+  0x35, 0x51, 0x8E, 0x35, 0x0A, 0x44, 0x35, 0x3B, 0x18, 0x28, 0x0E, 0x2C, 0x5C, 0x35, 0x33, 0x51,
+  0x9C, 0x35, 0x00, 0x33, 0x80, 0x35, 0x02, 0x5F, 0x0E, 0x05, 0x84, 0x00, 0x03, 0x06, 0x0A, 0x01,
+  0x3F, 0x80, 0x35, 0x01, 0x33, 0x51, 0x9F, 0x35, 0x00, 0x60, 0x80, 0x35, 0x03, 0x2E, 0x0C, 0x09,
+  0xA0, 0xA1, 0x00, 0xA3, 0x00, 0x07, 0x05, 0x07, 0x0D, 0xA1, 0xA2, 0x35, 0x34, 0x44, 0xA6, 0x35,
+  0x0B, 0x51, 0x33, 0x35, 0x85, 0xA3, 0x0E, 0x06, 0x04, 0x24, 0x6D, 0x35, 0x44, 0x8E, 0x35, 0x05,
+  0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35,
+  0x08, 0x60, 0x35, 0x71, 0xA4, 0x0C, 0x7F, 0x35, 0x44, 0x34, 0x9B, 0x35, 0x04, 0x60, 0x35, 0x48,
+  0x0E, 0x06, 0x88, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x05, 0x44, 0x35,
+  0x3B, 0x19, 0x4B, 0xA5, 0x80, 0x35, 0x00, 0x60, 0x9F, 0x35, 0x00, 0x44, 0x80, 0x35, 0x02, 0xA6,
+  0x1A, 0x06, 0x82, 0x00, 0x06, 0x1B, 0x24, 0x10, 0x3A, 0x35, 0x60, 0x6E, 0xA2, 0x35, 0x06, 0x34,
+  0x60, 0x35, 0x7C, 0x0F, 0x0A, 0x06, 0xA0, 0x00, 0xA2, 0x00, 0x03, 0x1B, 0x24, 0x1B, 0xB5, 0x80,
+  0x35, 0x00, 0x33, 0xAA, 0x35, 0x00, 0x60, 0x80, 0x35, 0x06, 0x55, 0x0E, 0xA7, 0x0A, 0x6D, 0x35,
+  0x44, 0x8E, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97,
+  0x35, 0x51, 0x8F, 0x35, 0x06, 0x60, 0x35, 0x3C, 0xA4, 0x89, 0x35, 0x33, 0x9C, 0x35, 0x05, 0x36,
+  0x35, 0x6F, 0x4A, 0x07, 0x01, 0x88, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35,
+  0x07, 0x44, 0x35, 0xA8, 0xAD, 0x65, 0x35, 0x51, 0x6E, 0xA1, 0x35, 0x05, 0x34, 0x36, 0x35, 0xD7,
+  0x0E, 0x06, 0x80, 0x00, 0x05, 0x1B, 0x4B, 0x14, 0x4F, 0x35, 0x37, 0xA6, 0x35, 0x05, 0x37, 0x35,
+  0xA9, 0xAA, 0x09, 0x05, 0x9F, 0x00, 0xA1, 0x00, 0x06, 0x1B, 0x0D, 0x14, 0xA9, 0x35, 0x60, 0x34,
+  0xAC, 0x35, 0x00, 0x44, 0x80, 0x35, 0x05, 0xA6, 0x0D, 0x09, 0x6D, 0x35, 0x44, 0x8E, 0x35, 0x05,
+  0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35,
+  0x05, 0x44, 0x35, 0x71, 0x84, 0x35, 0x33, 0x9D, 0x35, 0x04, 0x60, 0x35, 0x57, 0x0E, 0x06, 0x89,
+  0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x84, 0x5F, 0x35,
+  0x80, 0x34, 0xA3, 0x35, 0x04, 0x34, 0x51, 0x35, 0xC9, 0x0D, 0x80, 0x06, 0x04, 0x18, 0x1F, 0x92,
+  0x35, 0x33, 0xA8, 0x35, 0x05, 0x37, 0x35, 0xAB, 0x28, 0x0B, 0x04, 0x9E, 0x00, 0xA0, 0x00, 0x05,
+  0x06, 0x0E, 0xAC, 0x52, 0x35, 0x33, 0xAF, 0x35, 0x80, 0x34, 0x05, 0x35, 0x48, 0xAD, 0x47, 0x35,
+  0x44, 0x8E, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97,
+  0x35, 0x51, 0x91, 0x35, 0x02, 0x43, 0x35, 0x44, 0x9D, 0x35, 0x05, 0x51, 0x35, 0x92, 0x2A, 0x0B,
+  0x02, 0x89, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x05, 0x51, 0x35, 0x6F,
+  0x60, 0x35, 0x36, 0xA5, 0x35, 0x03, 0x6E, 0x35, 0x6E, 0x20, 0x80, 0x09, 0x03, 0xAE, 0x42, 0x35,
+  0x60, 0xAA, 0x35, 0x05, 0x37, 0x35, 0x8C, 0x09, 0x00, 0x01, 0x9D, 0x00, 0x9F, 0x00, 0x02, 0x06,
+  0x0E, 0xAF, 0x80, 0x35, 0x00, 0x60, 0xB1, 0x35, 0x06, 0x34, 0x51, 0x35, 0xB0, 0x8B, 0x35, 0x44,
+  0x8E, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35,
+  0x51, 0x92, 0x35, 0x00, 0x34, 0x9E, 0x35, 0x04, 0x60, 0x35, 0xB1, 0x0E, 0x06, 0x8A, 0x00, 0x05,
+  0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8F, 0x35, 0x00, 0x51, 0x80, 0x35, 0x00, 0x36, 0xA7, 0x35,
+  0x07, 0x60, 0x35, 0xB2, 0x0B, 0x99, 0xB3, 0x35, 0x33, 0xAC, 0x35, 0x04, 0x33, 0x35, 0x3C, 0x1A,
+  0x06, 0x9D, 0x00, 0x9E, 0x00, 0x02, 0x06, 0x0E, 0x3E, 0x80, 0x35, 0x00, 0x44, 0xB3, 0x35, 0x05,
+  0x34, 0x35, 0x92, 0xB4, 0x35, 0x51, 0x8E, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92,
+  0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x91, 0x35, 0x00, 0x51, 0x9E, 0x35, 0x05, 0x51, 0x35,
+  0x33, 0x61, 0x09, 0x03, 0x8A, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x90, 0x35, 0x80,
+  0x51, 0xA9, 0x35, 0x05, 0x33, 0x35, 0xFF, 0xB5, 0x35, 0x33, 0xAE, 0x35, 0x04, 0x6E, 0x35, 0xA3,
+  0x4B, 0x06, 0x9C, 0x00, 0x9D, 0x00, 0x05, 0x1B, 0x0E, 0xB6, 0x35, 0x51, 0x34, 0xB5, 0x35, 0x00,
+  0x34, 0x80, 0x35, 0x00, 0x51, 0x8F, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00,
+  0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0xB2, 0x35, 0x04, 0x60, 0x35, 0x2E, 0x0D, 0x06, 0x8B, 0x00,
+  0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0xBE, 0x35, 0x00, 0x36, 0x80, 0x35, 0x00, 0x34, 0xAF,
+  0x35, 0x05, 0x44, 0x35, 0x41, 0x1B, 0x0C, 0x01, 0x9B, 0x00, 0x9C, 0x00, 0x02, 0x1B, 0x1A, 0xC9,
+  0x80, 0x35, 0x00, 0x34, 0xB7, 0x35, 0x80, 0x51, 0x90, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B,
+  0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0xB4, 0x35, 0x02, 0x3D, 0x19, 0x04, 0x8B,
+  0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0xBF, 0x35, 0x80, 0x36, 0xB1, 0x35, 0x04, 0x33,
+  0x35, 0x57, 0x0E, 0x06, 0x9B, 0x00, 0x9B, 0x00, 0x02, 0x06, 0x18, 0x8E, 0x80, 0x35, 0x00, 0x6E,
+  0xCC, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35,
+  0x51, 0xB1, 0x35, 0x04, 0x60, 0x35, 0x8B, 0x4B, 0x05, 0x8C, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B,
+  0x35, 0x51, 0xF4, 0x35, 0x05, 0x51, 0x35, 0x32, 0xB7, 0x0B, 0x02, 0x9A, 0x00, 0x9A, 0x00, 0x05,
+  0x04, 0x09, 0xB8, 0xB9, 0x35, 0x44, 0x9C, 0x35, 0x01, 0x51, 0x34, 0x80, 0x44, 0x81, 0x60, 0x02,
+  0x44, 0x6E, 0x36, 0xA5, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05,
+  0x24, 0x97, 0x35, 0x51, 0xB1, 0x35, 0x04, 0x34, 0x35, 0xBA, 0x24, 0x05, 0x8C, 0x00, 0x05, 0x03,
+  0x09, 0x91, 0x9B, 0x35, 0x51, 0x9E, 0x35, 0x02, 0x51, 0x6E, 0x44, 0x80, 0x60, 0x02, 0x44, 0x6E,
+  0x51, 0xAB, 0x35, 0x02, 0x51, 0x6E, 0x44, 0x80, 0x60, 0x02, 0x44, 0x6E, 0x51, 0x98, 0x35, 0x04,
+  0x33, 0x35, 0xBB, 0x0E, 0x06, 0x9A, 0x00, 0x9A, 0x00, 0x04, 0x02, 0x0A, 0xBC, 0x35, 0x33, 0x99,
+  0x35, 0x03, 0x51, 0x44, 0x60, 0x6E, 0x89, 0x35, 0x02, 0x44, 0x60, 0x6E, 0xA1, 0x35, 0x05, 0x36,
+  0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0xA1, 0x35, 0x80,
+  0x51, 0x00, 0x36, 0x80, 0x34, 0x01, 0x36, 0x51, 0x86, 0x35, 0x04, 0x44, 0x35, 0x80, 0x24, 0x04,
+  0x8D, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x9B, 0x35, 0x02, 0x36, 0x60, 0x6E, 0x86,
+  0x35, 0x02, 0x44, 0xBD, 0x51, 0xA5, 0x35, 0x02, 0x51, 0x60, 0x44, 0x86, 0x35, 0x02, 0x44, 0x60,
+  0x51, 0x95, 0x35, 0x05, 0x34, 0x35, 0x39, 0x17, 0x07, 0x01, 0x99, 0x00, 0x99, 0x00, 0x04, 0x1B,
+  0x0E, 0xBE, 0x35, 0x33, 0x98, 0x35, 0x01, 0x34, 0x60, 0x82, 0x35, 0x09, 0x50, 0xBF, 0x7C, 0xA8,
+  0x58, 0x87, 0x93, 0xBC, 0x7D, 0x31, 0x82, 0x35, 0x02, 0x51, 0x60, 0x36, 0x9E, 0x35, 0x05, 0x36,
+  0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x9D, 0x35, 0x00,
+  0x36, 0x80, 0x60, 0x00, 0x34, 0x85, 0x35, 0x00, 0x36, 0x80, 0x60, 0x00, 0x36, 0x82, 0x35, 0x04,
+  0x44, 0x35, 0xB0, 0x4B, 0x05, 0x8D, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x99, 0x35,
+  0x01, 0x51, 0x60, 0x81, 0x35, 0x07, 0x5B, 0xC0, 0xA8, 0x87, 0x7F, 0xC1, 0x4E, 0x45, 0x81, 0x35,
+  0x00, 0x44, 0xA2, 0x35, 0x01, 0x51, 0x60, 0x81, 0x35, 0x07, 0xC2, 0xAB, 0x4D, 0xC3, 0x58, 0x4D,
+  0x7D, 0xC4, 0x81, 0x35, 0x00, 0x60, 0x95, 0x35, 0x04, 0xBD, 0x35, 0xC5, 0x0D, 0x06, 0x99, 0x00,
+  0x98, 0x00, 0x02, 0x05, 0x24, 0x7A, 0x80, 0x35, 0x00, 0x51, 0x96, 0x35, 0x01, 0x34, 0x60, 0x80,
+  0x35, 0x07, 0x34, 0x66, 0x57, 0xA3, 0x6B, 0x1B, 0x09, 0x18, 0x81, 0x4B, 0x06, 0x24, 0x07, 0x75,
+  0x20, 0xA1, 0xEB, 0xB2, 0x81, 0x35, 0x01, 0x60, 0x36, 0x9C, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96,
+  0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x9B, 0x35, 0x01, 0x6E, 0x60, 0x82,
+  0x35, 0x02, 0x44, 0xC6, 0x6F, 0x80, 0x39, 0x01, 0x9D, 0x43, 0x82, 0x35, 0x80, 0x44, 0x05, 0x35,
+  0x44, 0x35, 0x90, 0x0B, 0x01, 0x8E, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x98, 0x35,
+  0x00, 0x60, 0x80, 0x35, 0x05, 0xA2, 0x54, 0xC7, 0x27, 0x0B, 0x18, 0x80, 0x4B, 0x04, 0x24, 0x00,
+  0xC8, 0xC9, 0x93, 0x80, 0x35, 0x01, 0xBD, 0x51, 0x9F, 0x35, 0x00, 0x44, 0x80, 0x35, 0x05, 0x5C,
+  0x87, 0xCA, 0xCB, 0x0C, 0x24, 0x80, 0x4B, 0x08, 0x24, 0x07, 0x2A, 0xAC, 0x3F, 0x45, 0x35, 0x34,
+  0x36, 0x93, 0x35, 0x04, 0x60, 0x35, 0x93, 0x4B, 0x05, 0x99, 0x00, 0x98, 0x00, 0x04, 0x02, 0x09,
+  0x40, 0x35, 0x60, 0x96, 0x35, 0x00, 0x60, 0x80, 0x35, 0x08, 0xCC, 0x57, 0x12, 0x09, 0x0E, 0x18,
+  0x09, 0x0C, 0x02, 0x82, 0x05, 0x09, 0x04, 0x00, 0x07, 0x0A, 0x0D, 0x1A, 0x00, 0x97, 0x71, 0x95,
+  0x80, 0x35, 0x00, 0x60, 0x9B, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04,
+  0x05, 0x24, 0x97, 0x35, 0x51, 0x99, 0x35, 0x01, 0x51, 0x60, 0x80, 0x35, 0x06, 0x79, 0x63, 0x48,
+  0xCD, 0x1E, 0x2A, 0x4A, 0x80, 0xCE, 0x05, 0xCF, 0x6B, 0xD0, 0xD1, 0xD2, 0x6F, 0x80, 0x35, 0x05,
+  0x34, 0x5C, 0x35, 0xD3, 0x0D, 0x06, 0x8E, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x97,
+  0x35, 0x08, 0x60, 0x35, 0x50, 0xD4, 0x8D, 0x0E, 0x18, 0x0B, 0x01, 0x81, 0x05, 0x02, 0x04, 0x00,
+  0x09, 0x80, 0x0D, 0x04, 0x1F, 0x4D, 0x35, 0x51, 0x36, 0x9D, 0x35, 0x00, 0x60, 0x80, 0x35, 0x01,
+  0xD5, 0x1D, 0x80, 0x0D, 0x01, 0x09, 0x00, 0x82, 0x05, 0x05, 0x00, 0x0B, 0x4B, 0x1A, 0xCB, 0x3F,
+  0x80, 0x35, 0x00, 0x6E, 0x92, 0x35, 0x05, 0x36, 0x35, 0x95, 0x8D, 0x0B, 0x01, 0x98, 0x00, 0x97,
+  0x00, 0x04, 0x06, 0x1A, 0xD6, 0x35, 0x60, 0x95, 0x35, 0x80, 0x34, 0x0A, 0x35, 0x9D, 0xD7, 0x28,
+  0x0E, 0x0A, 0x03, 0x06, 0x05, 0x03, 0x01, 0x85, 0x00, 0x01, 0x01, 0x04, 0x80, 0x06, 0x08, 0x00,
+  0x24, 0x0E, 0xAA, 0x2D, 0x42, 0x35, 0x34, 0x6E, 0x99, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B,
+  0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x98, 0x35, 0x00, 0x44, 0x80, 0x35, 0x07,
+  0x4E, 0x9E, 0x23, 0x4B, 0x1A, 0x18, 0x0A, 0x0B, 0x81, 0x07, 0x07, 0x0B, 0x09, 0x24, 0x1A, 0x0D,
+  0x0F, 0x9C, 0x6D, 0x80, 0x35, 0x03, 0x82, 0x03, 0x00, 0x01, 0x8E, 0x00, 0x05, 0x03, 0x09, 0x91,
+  0x9B, 0x35, 0x51, 0x95, 0x35, 0x09, 0x51, 0x44, 0x35, 0xC1, 0x6B, 0xA4, 0x0B, 0x06, 0x05, 0x02,
+  0x84, 0x00, 0x00, 0x02, 0x80, 0x06, 0x02, 0x19, 0x4B, 0x65, 0x80, 0x35, 0x00, 0x51, 0x9B, 0x35,
+  0x05, 0x60, 0x35, 0xAB, 0x68, 0x0E, 0x09, 0x80, 0x06, 0x00, 0x02, 0x84, 0x00, 0x08, 0x02, 0x05,
+  0x06, 0x09, 0xA4, 0x9C, 0x36, 0x35, 0x6E, 0x92, 0x35, 0x04, 0x44, 0x35, 0xB0, 0x4B, 0x05, 0x98,
+  0x00, 0x96, 0x00, 0x05, 0x01, 0x07, 0xD8, 0xFC, 0x35, 0x34, 0x94, 0x35, 0x00, 0x60, 0x80, 0x35,
+  0x05, 0x54, 0x75, 0x0E, 0x0C, 0x06, 0x03, 0x8F, 0x00, 0x05, 0x05, 0x06, 0x0B, 0x0E, 0x96, 0x54,
+  0x80, 0x35, 0x00, 0x60, 0x98, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04,
+  0x05, 0x24, 0x97, 0x35, 0x51, 0x97, 0x35, 0x0B, 0x60, 0x35, 0x60, 0xA6, 0x0C, 0x1A, 0x0B, 0x05,
+  0x06, 0x05, 0x03, 0x02, 0x82, 0x01, 0x01, 0x03, 0x05, 0x80, 0x06, 0x07, 0x07, 0x0D, 0x24, 0xBA,
+  0x62, 0xD7, 0x0E, 0x06, 0x8F, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x94, 0x35, 0x07,
+  0x51, 0x34, 0x35, 0xD9, 0x24, 0x09, 0x1B, 0x02, 0x8A, 0x00, 0x80, 0x05, 0x03, 0xDA, 0xDB, 0x35,
+  0x34, 0x9A, 0x35, 0x06, 0x60, 0x35, 0xC3, 0x00, 0x24, 0x1B, 0x03, 0x8A, 0x00, 0x03, 0x03, 0x1B,
+  0xA4, 0x83, 0x80, 0x35, 0x00, 0x51, 0x91, 0x35, 0x04, 0x60, 0x35, 0x4C, 0x0E, 0x06, 0x98, 0x00,
+  0x96, 0x00, 0x04, 0x06, 0x0E, 0xD4, 0x35, 0x33, 0x94, 0x35, 0x07, 0x33, 0x35, 0x38, 0xB0, 0x0E,
+  0x0B, 0x1B, 0x01, 0x93, 0x00, 0x07, 0x02, 0x1B, 0x0B, 0x0E, 0xC7, 0x46, 0x35, 0x33, 0x97, 0x35,
+  0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x96,
+  0x35, 0x07, 0x60, 0x35, 0x53, 0x20, 0xA4, 0x00, 0x06, 0x01, 0x8B, 0x00, 0x05, 0x01, 0x06, 0x04,
+  0x0D, 0x07, 0x06, 0x91, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x94, 0x35, 0x05, 0x6E,
+  0x35, 0xBE, 0xA4, 0x03, 0x05, 0x8D, 0x00, 0x05, 0x01, 0x1B, 0xDA, 0x4C, 0x35, 0x60, 0x98, 0x35,
+  0x05, 0x60, 0x35, 0xDC, 0x4B, 0x07, 0x06, 0x8E, 0x00, 0x04, 0x2B, 0xDA, 0x9E, 0x35, 0x44, 0x91,
+  0x35, 0x04, 0x44, 0x35, 0x73, 0x0A, 0x03, 0x98, 0x00, 0x95, 0x00, 0x05, 0x01, 0x0B, 0x23, 0x46,
+  0x35, 0x36, 0x93, 0x35, 0x06, 0x33, 0x35, 0xDD, 0x6B, 0x1A, 0x1B, 0x02, 0x97, 0x00, 0x06, 0x03,
+  0x1B, 0x0D, 0x2A, 0xDE, 0x35, 0x33, 0x96, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92,
+  0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x95, 0x35, 0x06, 0x60, 0x35, 0x69, 0x0F, 0x18, 0xA7,
+  0x01, 0x90, 0x00, 0x00, 0x05, 0x93, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x93, 0x35,
+  0x05, 0x60, 0x35, 0x3C, 0xA4, 0x06, 0x01, 0x8F, 0x00, 0x05, 0x02, 0x00, 0x0C, 0x4E, 0x35, 0x6E,
+  0x96, 0x35, 0x05, 0x60, 0x35, 0x8B, 0x18, 0x00, 0x04, 0x90, 0x00, 0x04, 0x06, 0x0D, 0x3B, 0x35,
+  0x60, 0x90, 0x35, 0x05, 0x36, 0x35, 0x46, 0x23, 0x0B, 0x01, 0x97, 0x00, 0x95, 0x00, 0x04, 0x06,
+  0x0E, 0x65, 0x35, 0x60, 0x93, 0x35, 0x05, 0x33, 0x35, 0xDF, 0xE0, 0x19, 0x1B, 0x9B, 0x00, 0x05,
+  0x1B, 0x0A, 0x00, 0x89, 0x35, 0x33, 0x95, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92,
+  0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x94, 0x35, 0x05, 0x44, 0x35, 0x9F, 0x4A, 0x0A, 0x1B,
+  0x93, 0x00, 0x00, 0x01, 0x92, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x92, 0x35, 0x05,
+  0xBD, 0x35, 0x80, 0x24, 0x02, 0x01, 0x91, 0x00, 0x04, 0x06, 0x0D, 0xCA, 0x35, 0x44, 0x95, 0x35,
+  0x05, 0x6E, 0x35, 0x41, 0x2B, 0x0B, 0x04, 0x91, 0x00, 0x02, 0x05, 0x19, 0x7A, 0x95, 0x35, 0x02,
+  0x68, 0x24, 0x04, 0x97, 0x00, 0x94, 0x00, 0x05, 0x01, 0x00, 0x05, 0xB3, 0x35, 0x34, 0x92, 0x35,
+  0x05, 0x60, 0x35, 0x62, 0xE1, 0x09, 0x06, 0x9D, 0x00, 0x00, 0x06, 0x80, 0x0B, 0x02, 0x7B, 0x35,
+  0x33, 0x94, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97,
+  0x35, 0x51, 0x93, 0x35, 0x05, 0x36, 0x35, 0x33, 0x14, 0x24, 0x1B, 0xA9, 0x00, 0x05, 0x03, 0x09,
+  0x91, 0x9B, 0x35, 0x51, 0x91, 0x35, 0x05, 0x51, 0x35, 0x60, 0x26, 0x0A, 0x05, 0x95, 0x00, 0x02,
+  0xB2, 0x35, 0x6E, 0x94, 0x35, 0x04, 0x6E, 0x35, 0xAC, 0x0D, 0x1B, 0x93, 0x00, 0x04, 0xA0, 0x4B,
+  0xE2, 0x35, 0x44, 0x90, 0x35, 0x04, 0x44, 0x35, 0xC5, 0x0D, 0x06, 0x97, 0x00, 0x94, 0x00, 0x04,
+  0x05, 0x0D, 0x56, 0x35, 0x44, 0x92, 0x35, 0x05, 0x6E, 0x35, 0x46, 0xB7, 0x0A, 0x06, 0x9F, 0x00,
+  0x05, 0x05, 0x0B, 0x06, 0x4E, 0x35, 0x44, 0x93, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02,
+  0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x93, 0x35, 0x04, 0x60, 0x35, 0xDB, 0xA4, 0xA7,
+  0xAA, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x91, 0x35, 0x04, 0x60, 0x35, 0x98, 0x0E,
+  0x1B, 0x94, 0x00, 0x04, 0x06, 0x0E, 0x2D, 0x35, 0x60, 0x93, 0x35, 0x04, 0x44, 0x35, 0x4D, 0x18,
+  0xA0, 0x94, 0x00, 0x04, 0x06, 0x0D, 0x56, 0x35, 0x44, 0x90, 0x35, 0x04, 0x60, 0x35, 0x94, 0x0E,
+  0x06, 0x97, 0x00, 0x94, 0x00, 0x04, 0x05, 0x4B, 0x8B, 0x35, 0x60, 0x91, 0x35, 0x80, 0x51, 0x03,
+  0x35, 0x86, 0x0D, 0x1B, 0xA1, 0x00, 0x05, 0x06, 0x24, 0x21, 0x5C, 0x35, 0x36, 0x92, 0x35, 0x05,
+  0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x92, 0x35,
+  0x04, 0x44, 0x35, 0x73, 0x0A, 0x04, 0xAB, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x90,
+  0x35, 0x05, 0x51, 0x35, 0x33, 0x11, 0x09, 0x03, 0x94, 0x00, 0x02, 0x04, 0x0A, 0x88, 0x95, 0x35,
+  0x04, 0x6E, 0x35, 0xE3, 0x18, 0x05, 0x94, 0x00, 0x05, 0x01, 0x0B, 0xAA, 0x79, 0x35, 0x36, 0x8F,
+  0x35, 0x04, 0x60, 0x35, 0xDC, 0x0D, 0x06, 0x97, 0x00, 0x93, 0x00, 0x05, 0x02, 0x09, 0xCB, 0xC2,
+  0x35, 0x51, 0x91, 0x35, 0x04, 0x60, 0x35, 0xBB, 0xA4, 0x1B, 0xA3, 0x00, 0x04, 0x1B, 0x0E, 0x9E,
+  0x35, 0x60, 0x92, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24,
+  0x97, 0x35, 0x51, 0x92, 0x35, 0x04, 0x34, 0x35, 0xCD, 0x18, 0xA0, 0xAB, 0x00, 0x05, 0x03, 0x09,
+  0x91, 0x9B, 0x35, 0x51, 0x90, 0x35, 0x04, 0xBD, 0x35, 0x8B, 0x4B, 0x05, 0x95, 0x00, 0x05, 0x01,
+  0x0C, 0x06, 0x53, 0x35, 0x34, 0x91, 0x35, 0x03, 0x6E, 0x35, 0xAB, 0x0C, 0x97, 0x00, 0x04, 0x04,
+  0x24, 0xC1, 0x35, 0x44, 0x8F, 0x35, 0x04, 0x44, 0x35, 0xF4, 0x24, 0x05, 0x97, 0x00, 0x93, 0x00,
+  0x04, 0x06, 0x1A, 0x55, 0x35, 0x60, 0x91, 0x35, 0x05, 0x44, 0x35, 0x62, 0x0C, 0x00, 0x01, 0xA4,
+  0x00, 0x04, 0x05, 0x24, 0x89, 0x35, 0xBD, 0x91, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02,
+  0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x91, 0x35, 0x04, 0x44, 0x35, 0xE4, 0x0A, 0x04,
+  0xAC, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x90, 0x35, 0x04, 0x60, 0x35, 0x64, 0x0D,
+  0x06, 0x96, 0x00, 0x04, 0x05, 0x18, 0x3B, 0x35, 0x44, 0x91, 0x35, 0x04, 0x60, 0x35, 0xE5, 0x0E,
+  0x06, 0x96, 0x00, 0x04, 0x06, 0x0E, 0x67, 0x35, 0x60, 0x8F, 0x35, 0x04, 0x44, 0x35, 0x59, 0x09,
+  0x01, 0x97, 0x00, 0x93, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x91, 0x35, 0x04, 0x6E, 0x35,
+  0xAC, 0x0D, 0x06, 0xA5, 0x00, 0x02, 0x05, 0x24, 0x88, 0x93, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96,
+  0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x91, 0x35, 0x04, 0x60, 0x35, 0xAF,
+  0x0D, 0x06, 0xAC, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8F, 0x35, 0x05, 0x51, 0x35,
+  0x45, 0x22, 0x09, 0x02, 0x96, 0x00, 0x04, 0x06, 0x0E, 0xD9, 0x35, 0x60, 0x91, 0x35, 0x04, 0x34,
+  0x35, 0xBA, 0x24, 0x05, 0x96, 0x00, 0x04, 0x06, 0x0D, 0xE6, 0x35, 0x60, 0x8F, 0x35, 0x05, 0x6E,
+  0x35, 0xA9, 0x03, 0x00, 0x01, 0x96, 0x00, 0x92, 0x00, 0x05, 0x01, 0x0B, 0x25, 0x4F, 0x35, 0x36,
+  0x90, 0x35, 0x04, 0x44, 0x35, 0xC1, 0x24, 0x05, 0xA7, 0x00, 0x04, 0x06, 0x0D, 0xE7, 0x35, 0x60,
+  0x90, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35,
+  0x51, 0x90, 0x35, 0x05, 0x51, 0x35, 0xC4, 0x2A, 0x0B, 0x02, 0xAC, 0x00, 0x05, 0x03, 0x09, 0x91,
+  0x9B, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x44, 0x35, 0x59, 0x09, 0x01, 0x97, 0x00, 0x04, 0x06, 0x1A,
+  0xD6, 0x35, 0x60, 0x90, 0x35, 0x05, 0x36, 0x35, 0x31, 0x75, 0x07, 0x01, 0x96, 0x00, 0x04, 0x05,
+  0x24, 0x86, 0x35, 0x34, 0x8F, 0x35, 0x05, 0x34, 0x35, 0x39, 0x17, 0x07, 0x01, 0x96, 0x00, 0x92,
+  0x00, 0x04, 0x05, 0x18, 0xCD, 0x35, 0x6E, 0x91, 0x35, 0x04, 0x6E, 0x35, 0x5E, 0x18, 0x05, 0xA7,
+  0x00, 0x02, 0x04, 0x24, 0xE8, 0x92, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00,
+  0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x90, 0x35, 0x04, 0x44, 0x35, 0x4D, 0x24, 0x05, 0xAD, 0x00,
+  0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x54, 0x1A, 0x06, 0x97,
+  0x00, 0x04, 0x05, 0x4B, 0xAC, 0x35, 0x6E, 0x90, 0x35, 0x04, 0x44, 0x35, 0x80, 0x19, 0x04, 0x97,
+  0x00, 0x05, 0x03, 0x0A, 0x26, 0x44, 0x35, 0x51, 0x8E, 0x35, 0x05, 0x36, 0x35, 0x79, 0xAA, 0x0B,
+  0x01, 0x96, 0x00, 0x92, 0x00, 0x04, 0x06, 0x0E, 0xE9, 0x35, 0x60, 0x90, 0x35, 0x04, 0x44, 0x35,
+  0xDF, 0x08, 0x02, 0xA9, 0x00, 0x04, 0x05, 0x24, 0x8C, 0x35, 0x44, 0x8F, 0x35, 0x05, 0x36, 0x35,
+  0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x90, 0x35, 0x04, 0x60,
+  0x35, 0x5D, 0x0E, 0x06, 0xAD, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8F, 0x35, 0x04,
+  0x60, 0x35, 0x6A, 0x1A, 0x06, 0x97, 0x00, 0x04, 0x04, 0x24, 0xEA, 0x35, 0x51, 0x90, 0x35, 0x04,
+  0x60, 0x35, 0xEB, 0x1A, 0x06, 0x97, 0x00, 0x05, 0x02, 0x0B, 0x27, 0x42, 0x35, 0x51, 0x8E, 0x35,
+  0x05, 0x51, 0x35, 0xC6, 0x2A, 0x0B, 0x02, 0x96, 0x00, 0x92, 0x00, 0x04, 0x05, 0x18, 0xA8, 0x35,
+  0x44, 0x90, 0x35, 0x04, 0x60, 0x35, 0xEC, 0x1A, 0x06, 0xA9, 0x00, 0x04, 0x06, 0x0D, 0xE6, 0x35,
+  0x60, 0x8F, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97,
+  0x35, 0x51, 0x90, 0x35, 0x04, 0x6E, 0x35, 0x5E, 0x18, 0x05, 0xAD, 0x00, 0x05, 0x03, 0x09, 0x91,
+  0x9B, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x6E, 0x35, 0xA3, 0x18, 0x05, 0x97, 0x00, 0x05, 0x03, 0x09,
+  0x61, 0x33, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0xD7, 0x1A, 0x06, 0x97, 0x00, 0x05, 0x01,
+  0x07, 0x28, 0xED, 0x35, 0x34, 0x8E, 0x35, 0x05, 0x51, 0x35, 0x9B, 0xCB, 0x09, 0x02, 0x96, 0x00,
+  0x91, 0x00, 0x05, 0x01, 0x0C, 0x06, 0x53, 0x35, 0x34, 0x8F, 0x35, 0x05, 0x51, 0x35, 0x50, 0x6B,
+  0x09, 0x03, 0xA9, 0x00, 0x05, 0x02, 0x0B, 0x16, 0xEE, 0x35, 0x51, 0x8E, 0x35, 0x05, 0x36, 0x35,
+  0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x05, 0x51,
+  0x35, 0x5C, 0xAE, 0x09, 0x03, 0xAD, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35,
+  0x00, 0x51, 0x80, 0x35, 0x02, 0x20, 0x0A, 0x04, 0x97, 0x00, 0x05, 0x02, 0x0B, 0xB7, 0x38, 0x35,
+  0x51, 0x8F, 0x35, 0x04, 0x44, 0x35, 0x2C, 0x0D, 0x05, 0x9A, 0x00, 0x02, 0x62, 0x35, 0x6E, 0x8E,
+  0x35, 0x05, 0x51, 0x35, 0x45, 0x22, 0x09, 0x03, 0x96, 0x00, 0x91, 0x00, 0x05, 0x03, 0x09, 0x15,
+  0x52, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x44, 0x35, 0x7B, 0x24, 0x04, 0xAB, 0x00, 0x04, 0x05, 0x24,
+  0xEF, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05,
+  0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x05, 0x34, 0x35, 0xED, 0x28, 0x07, 0x01, 0xAD, 0x00, 0x05,
+  0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xEE, 0x16, 0x0B, 0x02, 0x97,
+  0x00, 0x05, 0x01, 0x0B, 0xCF, 0x9D, 0x35, 0x36, 0x8F, 0x35, 0x04, 0x51, 0x35, 0x97, 0x24, 0x05,
+  0x98, 0x00, 0x04, 0x01, 0x09, 0xDE, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09,
+  0x03, 0x96, 0x00, 0x91, 0x00, 0x04, 0x05, 0x18, 0xCD, 0x35, 0x6E, 0x90, 0x35, 0x04, 0x60, 0x35,
+  0x65, 0x0E, 0x06, 0xAB, 0x00, 0x04, 0x06, 0x0E, 0x5D, 0x35, 0x60, 0x8E, 0x35, 0x05, 0x36, 0x35,
+  0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x44,
+  0x35, 0xDE, 0x0B, 0x01, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x05,
+  0x34, 0x35, 0x39, 0x17, 0x07, 0x01, 0x97, 0x00, 0x05, 0x01, 0x07, 0xE1, 0xB4, 0x35, 0x34, 0x8E,
+  0x35, 0x05, 0x51, 0x35, 0x44, 0x1E, 0x0A, 0x03, 0x98, 0x00, 0x04, 0x03, 0x0A, 0x47, 0x35, 0x44,
+  0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x91, 0x00, 0x04, 0x06, 0x0D,
+  0x9E, 0x35, 0x60, 0x90, 0x35, 0x04, 0x36, 0x35, 0xF1, 0x24, 0x05, 0xAB, 0x00, 0x04, 0x05, 0x18,
+  0xF2, 0x35, 0x34, 0x8E, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05,
+  0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x44, 0x35, 0x4D, 0x24, 0x05, 0xAE, 0x00, 0x05, 0x03,
+  0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xB2, 0x01, 0x00, 0x01, 0x97, 0x00,
+  0x05, 0x01, 0x0C, 0x1B, 0x53, 0x35, 0x34, 0x8E, 0x35, 0x05, 0x51, 0x35, 0x32, 0x10, 0x08, 0x02,
+  0x98, 0x00, 0x04, 0x04, 0x24, 0x89, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09,
+  0x03, 0x96, 0x00, 0x91, 0x00, 0x04, 0x06, 0x0E, 0x81, 0x35, 0x60, 0x8F, 0x35, 0x05, 0x36, 0x35,
+  0xA2, 0x96, 0x0B, 0x02, 0xAB, 0x00, 0x05, 0x02, 0x08, 0x10, 0x85, 0x35, 0x51, 0x8D, 0x35, 0x05,
+  0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35,
+  0x04, 0x60, 0x35, 0xD2, 0x0D, 0xA0, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E,
+  0x35, 0x04, 0x44, 0x35, 0xF3, 0x0B, 0x01, 0x98, 0x00, 0x05, 0x01, 0x00, 0x02, 0xDD, 0x35, 0x6E,
+  0x8E, 0x35, 0x05, 0x36, 0x35, 0x4F, 0x23, 0x0B, 0x01, 0x98, 0x00, 0x04, 0x05, 0x24, 0xF4, 0x35,
+  0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x91, 0x00, 0x04, 0x06,
+  0x0D, 0xDC, 0x35, 0x60, 0x8F, 0x35, 0x04, 0x6E, 0x35, 0xF3, 0x0B, 0x01, 0xAC, 0x00, 0x00, 0x01,
+  0x80, 0x00, 0x02, 0x30, 0x35, 0x6E, 0x8D, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92,
+  0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0xDC, 0x1A, 0x06, 0xAE,
+  0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x73, 0x0A, 0x03,
+  0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x34, 0x35, 0x39, 0x17,
+  0x07, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8B, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0,
+  0xC8, 0x09, 0x03, 0x96, 0x00, 0x91, 0x00, 0x04, 0x05, 0x4B, 0x8B, 0x35, 0xBD, 0x8F, 0x35, 0x04,
+  0x60, 0x35, 0xC3, 0x0D, 0x05, 0xAD, 0x00, 0x04, 0x04, 0x24, 0xEF, 0x35, 0x44, 0x8D, 0x35, 0x05,
+  0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35,
+  0x04, 0x60, 0x35, 0xEB, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E,
+  0x35, 0x04, 0x44, 0x35, 0x7B, 0x24, 0x04, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E,
+  0x8E, 0x35, 0x05, 0x34, 0x35, 0xF5, 0x99, 0x0C, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35,
+  0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x91, 0x00, 0x04, 0x03,
+  0x0A, 0x80, 0x35, 0x44, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x4C, 0x0E, 0x06, 0xAD, 0x00, 0x04, 0x06,
+  0x0D, 0x78, 0x35, 0x60, 0x8D, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04,
+  0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05,
+  0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x89, 0x24, 0x04, 0x98, 0x00,
+  0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x34, 0x35, 0x9F, 0x06, 0x0C, 0x01,
+  0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09,
+  0x03, 0x96, 0x00, 0x91, 0x00, 0x04, 0x01, 0x09, 0xDE, 0x35, 0x44, 0x8F, 0x35, 0x04, 0x60, 0x35,
+  0xF6, 0x0E, 0x06, 0xAD, 0x00, 0x04, 0x06, 0x0E, 0x67, 0x35, 0x60, 0x8D, 0x35, 0x05, 0x36, 0x35,
+  0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60,
+  0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04,
+  0x44, 0x35, 0xEF, 0x24, 0x04, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35,
+  0x05, 0x6E, 0x35, 0x30, 0x01, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E,
+  0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x92, 0x00, 0x03, 0x07, 0x3A, 0x35,
+  0x6E, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x55, 0x1A, 0x06, 0xAD, 0x00, 0x04, 0x06, 0x0E, 0x94, 0x35,
+  0x60, 0x8D, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97,
+  0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91,
+  0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00,
+  0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04,
+  0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00,
+  0x93, 0x00, 0x02, 0xAB, 0x35, 0x6E, 0x8F, 0x35, 0x04, 0x44, 0x35, 0x64, 0x0D, 0x06, 0xAD, 0x00,
+  0x04, 0x06, 0x0E, 0xA6, 0x35, 0x60, 0x8D, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92,
+  0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE,
+  0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05,
+  0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02,
+  0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0,
+  0xC8, 0x09, 0x03, 0x96, 0x00, 0x92, 0x00, 0x03, 0x0C, 0xAB, 0x35, 0x6E, 0x8F, 0x35, 0x04, 0x44,
+  0x35, 0xA1, 0x0D, 0x06, 0xAD, 0x00, 0x04, 0x06, 0x1A, 0x6A, 0x35, 0x60, 0x8D, 0x35, 0x05, 0x36,
+  0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04,
+  0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35,
+  0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E,
+  0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44,
+  0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x92, 0x00, 0x03, 0x0B, 0x3A,
+  0x35, 0x6E, 0x8F, 0x35, 0x04, 0xBD, 0x35, 0x64, 0x0D, 0x06, 0xAD, 0x00, 0x04, 0x06, 0x1A, 0xF7,
+  0x35, 0x60, 0x8D, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24,
+  0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09,
+  0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01,
+  0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00,
+  0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96,
+  0x00, 0x91, 0x00, 0x04, 0x02, 0x09, 0x74, 0x35, 0x44, 0x8F, 0x35, 0x04, 0x60, 0x35, 0xD1, 0x1A,
+  0x06, 0xAD, 0x00, 0x04, 0x06, 0x0E, 0xBE, 0x35, 0x60, 0x8D, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96,
+  0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98,
+  0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35,
+  0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E,
+  0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05,
+  0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x91, 0x00, 0x04, 0x04, 0x24, 0x7B, 0x35, 0x44,
+  0x8F, 0x35, 0x04, 0x60, 0x35, 0x94, 0x0E, 0x06, 0xAD, 0x00, 0x04, 0x06, 0x0E, 0xD9, 0x35, 0x60,
+  0x8D, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35,
+  0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B,
+  0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01,
+  0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05,
+  0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x91,
+  0x00, 0x04, 0x05, 0x4B, 0x63, 0x35, 0x60, 0x8F, 0x35, 0x04, 0x60, 0x35, 0xEB, 0x1A, 0x06, 0xAD,
+  0x00, 0x04, 0x06, 0x0D, 0xF8, 0x35, 0x60, 0x8D, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02,
+  0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06,
+  0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18,
+  0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD,
+  0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35,
+  0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x91, 0x00, 0x04, 0x06, 0x1A, 0xF9, 0x35, 0x60, 0x8F, 0x35,
+  0x04, 0x44, 0x35, 0xA8, 0x18, 0x05, 0xAD, 0x00, 0x04, 0x04, 0x24, 0xEF, 0x35, 0x44, 0x8D, 0x35,
+  0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F,
+  0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51,
+  0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35,
+  0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A,
+  0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x91, 0x00, 0x04,
+  0x06, 0x0E, 0x94, 0x35, 0x60, 0x8F, 0x35, 0x05, 0x6E, 0x35, 0xA9, 0x02, 0x00, 0x01, 0xAB, 0x00,
+  0x05, 0x01, 0x00, 0x01, 0xDD, 0x35, 0x6E, 0x8D, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02,
+  0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06,
+  0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18,
+  0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD,
+  0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35,
+  0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x91, 0x00, 0x04, 0x06, 0x0D, 0x64, 0x35, 0x44, 0x8F, 0x35,
+  0x05, 0x51, 0x35, 0x5C, 0xAE, 0x09, 0x03, 0xAB, 0x00, 0x05, 0x02, 0x09, 0x91, 0xF0, 0x35, 0x51,
+  0x8D, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35,
+  0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B,
+  0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01,
+  0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05,
+  0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x91,
+  0x00, 0x04, 0x05, 0x24, 0x7E, 0x35, 0x51, 0x90, 0x35, 0x04, 0x44, 0x35, 0x56, 0x0D, 0x05, 0xAB,
+  0x00, 0x04, 0x05, 0x18, 0xA3, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02,
+  0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06,
+  0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18,
+  0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD,
+  0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35,
+  0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x91, 0x00, 0x05, 0x02, 0x0B, 0x6C, 0x92, 0x35, 0x51, 0x8F,
+  0x35, 0x04, 0x60, 0x35, 0x71, 0x1A, 0x06, 0xAB, 0x00, 0x04, 0x06, 0x0E, 0x57, 0x35, 0x60, 0x8E,
+  0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51,
+  0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35,
+  0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2,
+  0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18,
+  0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x93, 0x00,
+  0x03, 0x07, 0x77, 0x35, 0x6E, 0x8F, 0x35, 0x02, 0x6E, 0x35, 0xB2, 0xAD, 0x00, 0x04, 0x03, 0x0A,
+  0x73, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05,
+  0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03,
+  0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05,
+  0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98,
+  0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03,
+  0x96, 0x00, 0x92, 0x00, 0x04, 0x06, 0x0D, 0x84, 0x35, 0x60, 0x90, 0x35, 0x04, 0x36, 0x35, 0xD0,
+  0x24, 0x05, 0xA9, 0x00, 0x05, 0x03, 0x09, 0x11, 0x33, 0x35, 0x51, 0x8E, 0x35, 0x05, 0x36, 0x35,
+  0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60,
+  0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04,
+  0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35,
+  0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E,
+  0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x92, 0x00, 0x04, 0x06, 0x1A, 0xEC,
+  0x35, 0x60, 0x90, 0x35, 0x04, 0x60, 0x35, 0x70, 0x1A, 0x06, 0xA9, 0x00, 0x04, 0x06, 0x0E, 0xF6,
+  0x35, 0x60, 0x8F, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24,
+  0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09,
+  0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01,
+  0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00,
+  0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96,
+  0x00, 0x92, 0x00, 0x04, 0x04, 0x24, 0xFA, 0x35, 0x51, 0x90, 0x35, 0x05, 0x36, 0x35, 0x42, 0xB8,
+  0x0B, 0x02, 0xA8, 0x00, 0x04, 0x01, 0x07, 0x77, 0x35, 0x6E, 0x8F, 0x35, 0x05, 0x36, 0x35, 0x95,
+  0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35,
+  0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44,
+  0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05,
+  0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35,
+  0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x92, 0x00, 0x05, 0x01, 0x0C, 0x06, 0x53,
+  0x35, 0x34, 0x90, 0x35, 0x04, 0x60, 0x35, 0xBE, 0x0E, 0x1B, 0xA7, 0x00, 0x04, 0x06, 0x0D, 0x2C,
+  0x35, 0x44, 0x90, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24,
+  0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09,
+  0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01,
+  0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00,
+  0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96,
+  0x00, 0x93, 0x00, 0x04, 0x06, 0x0D, 0xF8, 0x35, 0x60, 0x90, 0x35, 0x05, 0x36, 0x35, 0x4F, 0xCF,
+  0x0B, 0x02, 0xA6, 0x00, 0x04, 0x03, 0x0A, 0x66, 0x35, 0x44, 0x90, 0x35, 0x05, 0x36, 0x35, 0x95,
+  0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35,
+  0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44,
+  0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05,
+  0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35,
+  0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x93, 0x00, 0x04, 0x05, 0x0D, 0x56, 0x35,
+  0x44, 0x91, 0x35, 0x04, 0x60, 0x35, 0x3C, 0xA4, 0x1B, 0xA5, 0x00, 0x04, 0x1B, 0x1A, 0xA1, 0x35,
+  0x44, 0x91, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97,
+  0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91,
+  0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00,
+  0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04,
+  0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00,
+  0x93, 0x00, 0x05, 0x01, 0x0B, 0xCF, 0x4F, 0x35, 0x36, 0x90, 0x35, 0x00, 0x51, 0x80, 0x35, 0x02,
+  0x3D, 0x24, 0x06, 0xA3, 0x00, 0x05, 0x03, 0x0B, 0xD8, 0xFB, 0x35, 0x34, 0x91, 0x35, 0x05, 0x36,
+  0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04,
+  0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35,
+  0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E,
+  0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44,
+  0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x94, 0x00, 0x04, 0x06, 0x0D,
+  0xF8, 0x35, 0x60, 0x91, 0x35, 0x05, 0x44, 0x35, 0x3A, 0x07, 0x00, 0x02, 0xA2, 0x00, 0x04, 0x06,
+  0x1A, 0xE7, 0x35, 0x60, 0x92, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04,
+  0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05,
+  0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00,
+  0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01,
+  0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09,
+  0x03, 0x96, 0x00, 0x94, 0x00, 0x04, 0x05, 0x18, 0xF2, 0x35, 0x6E, 0x92, 0x35, 0x04, 0x33, 0x35,
+  0xF9, 0x0E, 0x06, 0xA1, 0x00, 0x04, 0xA7, 0xA4, 0xB6, 0x35, 0x44, 0x93, 0x35, 0x05, 0x36, 0x35,
+  0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60,
+  0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04,
+  0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35,
+  0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E,
+  0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x95, 0x00, 0x04, 0x01, 0x0B, 0x3A,
+  0x35, 0x6E, 0x92, 0x35, 0x04, 0x44, 0x35, 0xD7, 0xA4, 0x1B, 0x9F, 0x00, 0x02, 0x99, 0x0E, 0x83,
+  0x80, 0x35, 0x00, 0x51, 0x93, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04,
+  0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05,
+  0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00,
+  0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01,
+  0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09,
+  0x03, 0x96, 0x00, 0x95, 0x00, 0x04, 0x06, 0x1A, 0xA5, 0x35, 0x60, 0x92, 0x35, 0x00, 0x51, 0x80,
+  0x35, 0x03, 0xD3, 0xA4, 0x1B, 0x01, 0x9C, 0x00, 0x05, 0xA7, 0x0E, 0xD0, 0x33, 0x35, 0x6E, 0x94,
+  0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51,
+  0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35,
+  0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2,
+  0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18,
+  0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x95, 0x00,
+  0x05, 0x01, 0x07, 0x17, 0xFB, 0x35, 0x34, 0x92, 0x35, 0x00, 0x34, 0x80, 0x35, 0x03, 0x9E, 0xA4,
+  0x03, 0x05, 0x99, 0x00, 0x06, 0x04, 0x05, 0xA4, 0xAC, 0x44, 0x35, 0x44, 0x95, 0x35, 0x05, 0x36,
+  0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04,
+  0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35,
+  0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E,
+  0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44,
+  0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x96, 0x00, 0x04, 0x06, 0x0E,
+  0x5D, 0x35, 0x33, 0x93, 0x35, 0x00, 0x34, 0x80, 0x35, 0x04, 0xE5, 0x24, 0x09, 0x1B, 0x01, 0x95,
+  0x00, 0x04, 0x01, 0x1B, 0x09, 0x4B, 0xA6, 0x80, 0x35, 0x00, 0x44, 0x96, 0x35, 0x05, 0x36, 0x35,
+  0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60,
+  0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04,
+  0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35,
+  0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E,
+  0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x96, 0x00, 0x05, 0x01, 0x07, 0xCE,
+  0xFC, 0x35, 0x34, 0x93, 0x35, 0x08, 0x36, 0x6E, 0x35, 0xC1, 0x91, 0x0E, 0x00, 0x06, 0x01, 0x91,
+  0x00, 0x05, 0x02, 0x06, 0x0C, 0x0E, 0x10, 0x3B, 0x80, 0x35, 0x00, 0x6E, 0x97, 0x35, 0x05, 0x36,
+  0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04,
+  0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35,
+  0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E,
+  0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44,
+  0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x97, 0x00, 0x04, 0x06, 0x1A,
+  0xA5, 0x35, 0x60, 0x95, 0x35, 0x09, 0x60, 0x35, 0x9B, 0xF7, 0x00, 0x1A, 0x07, 0x06, 0x05, 0x01,
+  0x8B, 0x00, 0x0A, 0x02, 0x05, 0x06, 0x0B, 0x0E, 0x1B, 0xF6, 0x85, 0x35, 0x60, 0x51, 0x98, 0x35,
+  0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F,
+  0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51,
+  0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35,
+  0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A,
+  0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x99, 0x00, 0x03,
+  0x0B, 0xC0, 0x35, 0x44, 0x95, 0x35, 0x00, 0x60, 0x80, 0x35, 0x06, 0xDD, 0x9A, 0x17, 0x0E, 0x24,
+  0x07, 0x05, 0x80, 0x06, 0x01, 0x05, 0x04, 0x81, 0x03, 0x01, 0x04, 0x05, 0x80, 0x06, 0x01, 0x03,
+  0x0B, 0x80, 0x0D, 0x02, 0x27, 0xFD, 0xF5, 0x80, 0x35, 0x00, 0x60, 0x9A, 0x35, 0x05, 0x36, 0x35,
+  0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60,
+  0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04,
+  0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35,
+  0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E,
+  0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x98, 0x00, 0x04, 0x05, 0x18, 0xF1,
+  0x35, 0x34, 0x96, 0x35, 0x01, 0x36, 0x60, 0x80, 0x35, 0x08, 0x39, 0x98, 0x86, 0xE1, 0x4B, 0x0E,
+  0x0D, 0x24, 0x0A, 0x80, 0x09, 0x09, 0x0A, 0x24, 0x18, 0x1A, 0x0E, 0x0A, 0x2A, 0x56, 0xE7, 0x5B,
+  0x80, 0x35, 0x01, 0x60, 0x36, 0x9B, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00,
+  0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00,
+  0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98,
+  0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00,
+  0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8,
+  0x09, 0x03, 0x96, 0x00, 0x99, 0x00, 0x04, 0x06, 0x0E, 0x71, 0x35, 0x33, 0x97, 0x35, 0x01, 0x6E,
+  0x60, 0x81, 0x35, 0x0E, 0xB4, 0x8B, 0xFE, 0xC5, 0x49, 0x20, 0x15, 0x1D, 0x1E, 0x68, 0xA3, 0xB6,
+  0xB1, 0x76, 0xC6, 0x81, 0x35, 0x01, 0x60, 0x34, 0x9D, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B,
+  0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A,
+  0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B,
+  0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35,
+  0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51,
+  0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x99, 0x00, 0x05, 0x01, 0x0C, 0x05, 0xA9, 0x35, 0x44,
+  0x98, 0x35, 0x02, 0x34, 0x60, 0x34, 0x83, 0x35, 0x03, 0x51, 0x52, 0x5C, 0x60, 0x84, 0x35, 0x02,
+  0x44, 0x60, 0x51, 0x9F, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05,
+  0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03,
+  0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05,
+  0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98,
+  0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03,
+  0x96, 0x00, 0x9A, 0x00, 0x02, 0xA0, 0x24, 0xFA, 0x80, 0x35, 0x00, 0x36, 0x9A, 0x35, 0x04, 0x34,
+  0xBD, 0x60, 0x44, 0x36, 0x83, 0x35, 0x00, 0x6E, 0x80, 0x60, 0x01, 0x44, 0x51, 0xA2, 0x35, 0x05,
+  0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35,
+  0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E,
+  0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E,
+  0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35,
+  0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x9B, 0x00, 0x04, 0x1B,
+  0x0E, 0xD1, 0x35, 0x60, 0x9F, 0x35, 0x82, 0x51, 0xA8, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B,
+  0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A,
+  0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B,
+  0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35,
+  0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51,
+  0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x9C, 0x00, 0x04, 0xA0, 0x0D, 0xEB, 0x35, 0x33, 0xCC,
+  0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51,
+  0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35,
+  0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2,
+  0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18,
+  0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x9C, 0x00,
+  0x05, 0x01, 0x00, 0x0A, 0xE2, 0x35, 0x37, 0xB7, 0x35, 0x80, 0x51, 0x90, 0x35, 0x05, 0x36, 0x35,
+  0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60,
+  0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04,
+  0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35,
+  0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E,
+  0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x9D, 0x00, 0x05, 0x04, 0x07, 0x00,
+  0x76, 0x35, 0x37, 0xB5, 0x35, 0x00, 0x51, 0x80, 0x35, 0x00, 0x51, 0x8F, 0x35, 0x05, 0x36, 0x35,
+  0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60,
+  0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04,
+  0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35,
+  0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E,
+  0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x9E, 0x00, 0x05, 0x05, 0x0B, 0x05,
+  0x73, 0x35, 0x33, 0xB3, 0x35, 0x00, 0x36, 0x80, 0x35, 0x02, 0x5B, 0x35, 0x51, 0x8E, 0x35, 0x05,
+  0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35,
+  0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E,
+  0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E,
+  0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35,
+  0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0x9F, 0x00, 0x06, 0x05,
+  0x0B, 0x01, 0xEF, 0x35, 0x60, 0x51, 0xB0, 0x35, 0x06, 0x34, 0x51, 0x35, 0x55, 0x3B, 0x35, 0x44,
+  0x8E, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35,
+  0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B,
+  0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01,
+  0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05,
+  0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0xA0,
+  0x00, 0x03, 0x05, 0x0B, 0x09, 0x3F, 0x80, 0x35, 0x00, 0x44, 0xAE, 0x35, 0x00, 0x44, 0x80, 0x35,
+  0x04, 0xFD, 0xAD, 0x2F, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92,
+  0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE,
+  0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05,
+  0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02,
+  0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0,
+  0xC8, 0x09, 0x03, 0x96, 0x00, 0xA1, 0x00, 0x03, 0x04, 0x00, 0x0D, 0xA6, 0x80, 0x35, 0x00, 0x33,
+  0xAC, 0x35, 0x00, 0x60, 0x80, 0x35, 0x05, 0x9A, 0x0D, 0x09, 0x6D, 0x35, 0x44, 0x8E, 0x35, 0x05,
+  0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35,
+  0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E,
+  0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E,
+  0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35,
+  0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0xA2, 0x00, 0x07, 0x02,
+  0x05, 0x0E, 0xBA, 0xB4, 0x35, 0x6E, 0x44, 0xA8, 0x35, 0x0A, 0x51, 0x33, 0x35, 0x9B, 0xE3, 0x0E,
+  0x2B, 0x19, 0x6D, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00,
+  0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00,
+  0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98,
+  0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00,
+  0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8,
+  0x09, 0x03, 0x96, 0x00, 0xA4, 0x00, 0x03, 0x1B, 0x18, 0x17, 0x3F, 0x80, 0x35, 0x01, 0x33, 0x34,
+  0xA5, 0x35, 0x00, 0x60, 0x80, 0x35, 0x08, 0xDE, 0xAE, 0x0D, 0x1B, 0x04, 0x19, 0x6D, 0x35, 0x44,
+  0x8E, 0x35, 0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35,
+  0x51, 0x8F, 0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B,
+  0x35, 0x51, 0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01,
+  0xB2, 0x35, 0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05,
+  0x18, 0x8A, 0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0xA5,
+  0x00, 0x04, 0x06, 0x07, 0x0D, 0xE3, 0x62, 0x80, 0x35, 0x01, 0x60, 0x34, 0xA1, 0x35, 0x01, 0x6E,
+  0x60, 0x80, 0x35, 0x09, 0xFF, 0x0B, 0x0A, 0x06, 0x00, 0x04, 0x19, 0x6D, 0x35, 0x44, 0x8E, 0x35,
+  0x05, 0x36, 0x35, 0x95, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x04, 0x05, 0x24, 0x97, 0x35, 0x51, 0x8F,
+  0x35, 0x04, 0x60, 0x35, 0x98, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x03, 0x09, 0x91, 0x9B, 0x35, 0x51,
+  0x8E, 0x35, 0x04, 0x44, 0x35, 0x3B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01, 0x00, 0x01, 0xB2, 0x35,
+  0x6E, 0x8E, 0x35, 0x05, 0x6E, 0x35, 0xDD, 0x02, 0x00, 0x01, 0x98, 0x00, 0x04, 0x05, 0x18, 0x8A,
+  0x35, 0x44, 0x8E, 0x35, 0x05, 0x51, 0x35, 0xF0, 0xC8, 0x09, 0x03, 0x96, 0x00, 0xA6, 0x00, 0x05,
+  0x02, 0x06, 0x4B, 0x00, 0xEC, 0x39, 0x80, 0x35, 0x02, 0xBD, 0x44, 0x51, 0x9C, 0x35, 0x01, 0x44,
+  0x60, 0x80, 0x35, 0x04, 0xE4, 0xFA, 0x0E, 0x00, 0x05, 0x80, 0x00, 0x04, 0x04, 0x19, 0xBC, 0x35,
+  0x33, 0x8E, 0x34, 0x05, 0x44, 0x35, 0x46, 0x96, 0x0B, 0x02, 0x92, 0x00, 0x05, 0x05, 0x24, 0x8E,
+  0x35, 0x44, 0x6E, 0x8E, 0x34, 0x04, 0x37, 0x35, 0x8F, 0x1A, 0x06, 0xAE, 0x00, 0x05, 0x02, 0x09,
+  0x91, 0x85, 0x35, 0x44, 0x8E, 0x34, 0x04, 0x33, 0x35, 0x8B, 0x18, 0x05, 0x98, 0x00, 0x05, 0x01,
+  0x00, 0x01, 0x4E, 0x35, 0x60, 0x8E, 0x34, 0x05, 0x60, 0x35, 0xB2, 0x02, 0x00, 0x01, 0x98, 0x00,
+  0x04, 0x05, 0x18, 0x8B, 0x35, 0x33, 0x8E, 0x34, 0x05, 0x44, 0x35, 0x85, 0x91, 0x09, 0x03, 0x96,
+  0x00, 0xA8, 0x00, 0x05, 0x06, 0x00, 0x0E, 0x17, 0xFD, 0x9F, 0x81, 0x35, 0x02, 0x60, 0x44, 0x51,
+  0x96, 0x35, 0x02, 0x6E, 0x60, 0x51, 0x80, 0x35, 0x05, 0xAB, 0xA1, 0x0A, 0x24, 0x06, 0x01, 0x81,
+  0x00, 0x02, 0x04, 0x24, 0x72, 0x92, 0x35, 0x03, 0x85, 0xB8, 0x0B, 0x02, 0x92, 0x00, 0x02, 0x05,
+  0x24, 0x7E, 0x93, 0x35, 0x02, 0xD5, 0x0E, 0x06, 0xAE, 0x00, 0x03, 0x03, 0x09, 0x22, 0x60, 0x92,
+  0x35, 0x02, 0x4D, 0x18, 0x05, 0x98, 0x00, 0x03, 0x01, 0x00, 0x01, 0x9F, 0x92, 0x35, 0x03, 0x53,
+  0x02, 0x00, 0x01, 0x98, 0x00, 0x02, 0x05, 0x4B, 0xF4, 0x92, 0x35, 0x03, 0x44, 0x22, 0x09, 0x03,
+  0x96, 0x00, 0xA9, 0x00, 0x07, 0x01, 0x06, 0x07, 0x0E, 0x05, 0xC9, 0x4D, 0x33, 0x81, 0x35, 0x04,
+  0x44, 0x60, 0x44, 0x34, 0x51, 0x8C, 0x35, 0x04, 0x51, 0x34, 0x44, 0x60, 0x51, 0x81, 0x35, 0x05,
+  0x72, 0xC5, 0x07, 0x0D, 0x03, 0x05, 0x83, 0x00, 0x04, 0x03, 0x0A, 0xD2, 0x95, 0x41, 0x8E, 0xED,
+  0x05, 0x5A, 0xFB, 0x77, 0x23, 0x0B, 0x01, 0x92, 0x00, 0x04, 0x04, 0x19, 0xE8, 0xFC, 0x5A, 0x8F,
+  0xED, 0x04, 0xBF, 0x38, 0xFE, 0x0D, 0x06, 0xAE, 0x00, 0x05, 0x02, 0x0B, 0x6C, 0xA9, 0xCC, 0x5A,
+  0x8E, 0xED, 0x04, 0x41, 0x42, 0x3F, 0x24, 0x05, 0x9A, 0x00, 0x03, 0x01, 0x6D, 0xB9, 0xF5, 0x8E,
+  0xED, 0x03, 0xF5, 0xB9, 0x80, 0x02, 0x9A, 0x00, 0x04, 0x05, 0x24, 0x3F, 0x42, 0x41, 0x8E, 0xED,
+  0x05, 0x5A, 0xCC, 0xA9, 0x6C, 0x0B, 0x02, 0x96, 0x00, 0xAB, 0x00, 0x08, 0x01, 0x06, 0x00, 0x0D,
+  0x24, 0x11, 0xF7, 0x7B, 0x92, 0x83, 0x35, 0x00, 0x6E, 0x83, 0x60, 0x81, 0x44, 0x82, 0x60, 0x00,
+  0x6E, 0x83, 0x35, 0x06, 0xA9, 0x4C, 0xEA, 0x0A, 0x0D, 0x00, 0x06, 0x87, 0x00, 0x02, 0xA7, 0xE1,
+  0x28, 0x8E, 0xE1, 0x03, 0x28, 0xE1, 0x28, 0x01, 0x96, 0x00, 0x00, 0x03, 0x91, 0xE1, 0x02, 0x28,
+  0xE0, 0x06, 0xB2, 0x00, 0x01, 0x01, 0x28, 0x90, 0xE1, 0x02, 0x28, 0xE1, 0x1B, 0x9D, 0x00, 0x02,
+  0x2B, 0xE1, 0x28, 0x8E, 0xE1, 0x02, 0x28, 0xE1, 0x2B, 0x9D, 0x00, 0x02, 0x1B, 0xE1, 0x28, 0x90,
+  0xE1, 0x01, 0x28, 0x01, 0x98, 0x00, 0xAD, 0x00, 0x0B, 0x01, 0x06, 0x05, 0x09, 0x0E, 0x24, 0x6C,
+  0x2C, 0x67, 0x7B, 0xCC, 0x44, 0x8C, 0x35, 0x09, 0xBD, 0xF5, 0x3B, 0x65, 0x8E, 0x01, 0x0E, 0x24,
+  0x03, 0x06, 0x89, 0x00, 0x00, 0x0C, 0x93, 0x07, 0x98, 0x00, 0x93, 0x07, 0x00, 0x0C, 0xB3, 0x00,
+  0x93, 0x07, 0x00, 0x0C, 0x9D, 0x00, 0x00, 0x0C, 0x92, 0x07, 0x00, 0x0C, 0x9D, 0x00, 0x00, 0x0C,
+  0x93, 0x07, 0x99, 0x00, 0xB0, 0x00, 0x0F, 0x03, 0x06, 0x04, 0x0B, 0x0D, 0x0E, 0x24, 0x17, 0x29,
+  0xE3, 0x9E, 0xE9, 0x71, 0xE7, 0x93, 0x3B, 0x80, 0x8A, 0x0C, 0xD2, 0x54, 0xBB, 0xD1, 0xC7, 0x26,
+  0xA7, 0x18, 0x0E, 0x24, 0x00, 0x06, 0x04, 0x8B, 0x00, 0x94, 0x01, 0x98, 0x00, 0x93, 0x01, 0xB4,
+  0x00, 0x94, 0x01, 0x9D, 0x00, 0x94, 0x01, 0x9D, 0x00, 0x94, 0x01, 0x99, 0x00, 0xB3, 0x00, 0x0B,
+  0x02, 0x05, 0x06, 0x04, 0x07, 0x0A, 0x18, 0x0D, 0x0E, 0x1A, 0x0D, 0x4B, 0x81, 0x18, 0x0A, 0x0D,
+  0x1A, 0x0E, 0x1A, 0x4B, 0x0A, 0x0C, 0x05, 0x06, 0x04, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xA1, 0x00,
+  0xB7, 0x00, 0x02, 0x01, 0x03, 0x05, 0x82, 0x06, 0x82, 0x05, 0x00, 0xA0, 0x81, 0x06, 0x02, 0x05,
+  0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xA5, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00
 };
 
-/*************************** End of file ****************************/
+static const RleImage armlogo = {372, 126, 256, armlogo_palette, armlogo_data};
@@ -0,0 +1,43 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_decibel.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_decibel.c module
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_DECIBEL_H
+#define __STM32F7_DECIBEL_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "arm_math.h"
+#include "stm32f7xx_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+/**
+  * @brief  Order of the log2 polynomial, largest error in dB:
+  * 2: 0.03, 3: 0.004, 4: 0.0005, 5: 0.0001
+  */
+#ifndef DECIBEL_ORDER
+#define DECIBEL_ORDER         3
+#endif
+
+/**
+  * @brief  decibelBenchmark() is only built when DECIBEL_BENCHMARK is defined
+  * to 1, e.g. in the project options
+  */
+#ifndef DECIBEL_BENCHMARK
+#define DECIBEL_BENCHMARK     0
+#endif
+#define DECIBEL_BENCH_BINS    1024
+
+/* Exported functions ------------------------------------------------------- */
+void decibelFromMagnitude(const float32_t *magnitude, float32_t *db, uint32_t n, float32_t floor_db);
+void decibelFromPower(const float32_t *power, float32_t *db, uint32_t n, float32_t floor_db);
+#if DECIBEL_BENCHMARK
+void decibelBenchmark(float32_t cycles[2], float32_t *max_error);
+#endif
+
+#endif /* __STM32F7_DECIBEL_H */
@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_persist.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_persist.c module
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_PERSIST_H
+#define __STM32F7_PERSIST_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_envelope.h"
+
+/* Exported constants --------------------------------------------------------*/
+/**
+  * @brief  Persistence buffer start address
+  * The buffer lives in SDRAM after the waterfall ring (0xC0600000), one L8
+  * intensity byte per graph pixel, PERSIST_ROWS rows of GRAPH_WIDTH bytes.
+  */
+#define PERSIST_BUFFER        ((uint32_t)(SDRAM_DEVICE_ADDR + 0x00680000))
+#define PERSIST_ROWS          (GRAPH_VER_END_PIXEL - HEADER_HEIGHT + 1)
+
+#define PERSIST_SLOW          4				//Decay shifts, intensity loses 1/2^shift per frame
+#define PERSIST_MEDIUM        3
+#define PERSIST_FAST          1
+#define PERSIST_HEADROOM      1.25f		//Scale margin taken whenever the signal outgrows the scale
+
+#define AVERAGE_MAX_BINS      1024
+#define AVERAGE_EXPONENTIAL   0				//New average every frame, weight 1/frames for the newest
+#define AVERAGE_LINEAR        1				//New average of the last frames every frames frames
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Spectrum average, kept as power so the result can go to plotFFT()
+  *					or plotLogFFT() without biasing the noise floor in dB.
+  */
+typedef struct
+{
+	uint8_t mode;								//AVERAGE_EXPONENTIAL or AVERAGE_LINEAR
+	uint32_t num_bins;
+	uint32_t frames;						//Frames per average or time constant in frames
+	uint32_t count;							//Frames accumulated
+	float32_t power[AVERAGE_MAX_BINS];
+} Average;
+
+/* Exported functions ------------------------------------------------------- */
+void averageInit(Average *avg, uint32_t num_bins, uint8_t mode, uint32_t frames);
+int averageAdd(Average *avg, const float32_t *magnitude, float32_t *out);
+void plotPersist(float32_t * data_buffer, int num_samples, int type, uint8_t decay_shift);
+void clearPersist(void);
+
+#endif /* __STM32F7_PERSIST_H */
@@ -0,0 +1,53 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_vectorscope.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_vectorscope.c module
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_VECTORSCOPE_H
+#define __STM32F7_VECTORSCOPE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_display.h"
+
+/* Exported constants --------------------------------------------------------*/
+/**
+  * @brief  Vector scope buffer start address
+  * The buffer lives in SDRAM after the persistence buffer (0xC0680000), one L8
+  * intensity byte per graph pixel, VECTOR_ROWS rows of GRAPH_WIDTH bytes.
+  * The points go in a square of 2*VECTOR_HALF+1 pixels in the middle.
+  */
+#define VECTOR_BUFFER         ((uint32_t)(SDRAM_DEVICE_ADDR + 0x00690000))
+#define VECTOR_ROWS           (GRAPH_VER_END_PIXEL - HEADER_HEIGHT + 1)
+#define VECTOR_HALF           ((VECTOR_ROWS - 1)/2)
+
+#define VECTOR_XY             0				//Horizontal left or input, vertical right or output
+#define VECTOR_MS             1				//Rotated 45 degrees, vertical mid (L+R), horizontal side (R-L)
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+	uint8_t mode;								//VECTOR_XY or VECTOR_MS
+	int16_t range;							//Amplitude at the edges of the square
+	int32_t scale;							//Pixels per unit of amplitude, 16.16 fixed point
+	__IO int16_t top;						//Rows holding a non zero intensity,
+	__IO int16_t bottom;				//empty when top > bottom
+	uint8_t labelled;						//Labels drawn since vectorScopeInit()
+	int64_t sum_xy;							//Sums for the correlation since the last plot
+	int64_t sum_xx;
+	int64_t sum_yy;
+	float32_t correlation;			//Correlation shown by the last plot
+} VectorScope;
+
+/* Exported functions ------------------------------------------------------- */
+void vectorScopeInit(VectorScope *vs, uint8_t mode, int16_t range);
+void clearVectorScope(VectorScope *vs);
+void vectorScopeAddStereo(VectorScope *vs, const int16_t *frames, uint32_t n);
+void vectorScopeAddPair(VectorScope *vs, const int16_t *x, const int16_t *y, uint32_t n);
+void plotVectorScope(VectorScope *vs, uint8_t decay_shift);
+
+#endif /* __STM32F7_VECTORSCOPE_H */
@@ -0,0 +1,39 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_waterfall.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_waterfall.c module
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_WATERFALL_H
+#define __STM32F7_WATERFALL_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_display.h"
+
+/* Exported constants --------------------------------------------------------*/
+/**
+  * @brief  Waterfall ring start address
+  * The ring lives in SDRAM after the glyph atlas (0xC0500000), one L8 byte
+  * per pixel, every row is stored twice so the visible window is contiguous.
+  */
+#define WATERFALL_BUFFER      ((uint32_t)(SDRAM_DEVICE_ADDR + 0x00600000))
+
+#define WATERFALL_ROWS        (GRAPH_HEIGHT)
+#define WATERFALL_RING_ROWS   (WATERFALL_ROWS + 1)
+
+#define WATERFALL_RANGE_DB    60.0f			//Colour range below the peak in log mode
+#define WATERFALL_PEAK_DECAY  0.98f			//Per row decay of the tracked peak
+
+#define WATERFALL_LINEAR      0
+#define WATERFALL_LOG         1
+
+/* Exported functions ------------------------------------------------------- */
+void plotWaterfall(float32_t * data_buffer, int num_samples, int log_scale);
+void exitWaterfall(void);
+void magnitudeToPalette(const float32_t *mag, uint8_t *index, uint32_t n, float32_t floor, float32_t scale, int log_scale);
+
+#endif /* __STM32F7_WATERFALL_H */
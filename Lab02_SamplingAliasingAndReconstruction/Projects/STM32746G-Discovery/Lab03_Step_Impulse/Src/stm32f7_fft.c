@@ -0,0 +1,1112 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_fft.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides real FFTs of 32 to 4096 points, in place or
+  *					 not, with the spectrum in the packing of the CMSIS-DSP
+  *					 arm_rfft_fast_f32(), and the magnitude and power spectra for
+  *					 plotFFT() and plotLogFFT(). The tables are generated by
+  *					 Utilities/Host/fftgen.c and shared by every length, so the
+  *					 same code runs on the board and in the host build.
+  *					 The fixed point FFTs in Q15 and Q31 take the same steps with
+  *					 block floating point scaling, the Q15 butterflies use the dual
+  *					 16 bit instructions of the Cortex-M7.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_fft.h"
+#include "fft_tables.h"
+#include <string.h>
+
+#define FFT_QUARTER           (FFT_MAX_SIZE/4)		//fft_cos[k + FFT_QUARTER] is -sin
+#define FFT_LOG2_MAX_HALF     11
+
+/**
+  * @brief  Set up a real FFT
+  * @param  fft: FFT
+  * @param  fft_len: a power of 2 from FFT_MIN_SIZE to FFT_MAX_SIZE
+  * @retval HAL_OK, HAL_ERROR for a bad length
+  */
+
+HAL_StatusTypeDef fftInit(RealFft *fft, uint32_t fft_len) {
+	uint32_t log2_half = 0;
+
+	if(fft_len < FFT_MIN_SIZE || fft_len > FFT_MAX_SIZE || (fft_len & (fft_len - 1)) != 0)
+		return HAL_ERROR;
+	while((2u << log2_half) < fft_len)
+		log2_half++;
+	fft->fft_len = fft_len;
+	fft->log2_half = log2_half;
+	return HAL_OK;
+}
+
+/**
+  * @brief  In place forward complex FFT by decimation in frequency, the bins
+  *					come out in bit reversed order. Each radix-4 butterfly stores its
+  *					outputs in the order of two radix-2 stages, so one radix-2 stage
+  *					first makes up for an odd power of 2.
+  * @param  z: 2^log2_len interleaved real and imaginary values
+  * @param  log2_len: 4 to FFT_LOG2_MAX_HALF
+  * @retval none
+  */
+
+static void complexFft(float32_t *z, uint32_t log2_len) {
+	uint32_t len = 1u << log2_len, span = len, quarter, step, i, j, k;
+	float32_t *a, *b, *c, *d;
+	float32_t w1r, w1i, w2r, w2i, w3r, w3i;
+	float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i, xr, xi;
+
+	if(log2_len & 1) {
+		quarter = len/2;
+		step = FFT_MAX_SIZE/len;
+		for(i = 0; i < quarter; i++) {
+			w1r = fft_cos[i*step];
+			w1i = fft_cos[i*step + FFT_QUARTER];
+			a = &z[2*i];
+			b = &z[2*(i + quarter)];
+			xr = a[0] - b[0];
+			xi = a[1] - b[1];
+			a[0] += b[0];
+			a[1] += b[1];
+			b[0] = xr*w1r - xi*w1i;
+			b[1] = xr*w1i + xi*w1r;
+		}
+		span = quarter;
+	}
+
+	for(; span > 4; span >>= 2) {
+		quarter = span/4;
+		step = FFT_MAX_SIZE/span;
+		for(i = 0; i < quarter; i++) {
+			//The twiddles of a butterfly position are loaded once for all groups
+			k = i*step;
+			w1r = fft_cos[k];
+			w1i = fft_cos[k + FFT_QUARTER];
+			w2r = fft_cos[2*k];
+			w2i = fft_cos[2*k + FFT_QUARTER];
+			w3r = fft_cos[3*k];
+			w3i = fft_cos[3*k + FFT_QUARTER];
+			for(j = i; j < len; j += span) {
+				a = &z[2*j];
+				b = a + 2*quarter;
+				c = b + 2*quarter;
+				d = c + 2*quarter;
+				t0r = a[0] + c[0];
+				t0i = a[1] + c[1];
+				t1r = a[0] - c[0];
+				t1i = a[1] - c[1];
+				t2r = b[0] + d[0];
+				t2i = b[1] + d[1];
+				t3r = b[0] - d[0];
+				t3i = b[1] - d[1];
+				a[0] = t0r + t2r;
+				a[1] = t0i + t2i;
+				xr = t0r - t2r;
+				xi = t0i - t2i;
+				b[0] = xr*w2r - xi*w2i;
+				b[1] = xr*w2i + xi*w2r;
+				xr = t1r + t3i;
+				xi = t1i - t3r;
+				c[0] = xr*w1r - xi*w1i;
+				c[1] = xr*w1i + xi*w1r;
+				xr = t1r - t3i;
+				xi = t1i + t3r;
+				d[0] = xr*w3r - xi*w3i;
+				d[1] = xr*w3i + xi*w3r;
+			}
+		}
+	}
+
+	//Last stage, all the twiddles are 1
+	for(a = z; a < z + 2*len; a += 8) {
+		t0r = a[0] + a[4];
+		t0i = a[1] + a[5];
+		t1r = a[0] - a[4];
+		t1i = a[1] - a[5];
+		t2r = a[2] + a[6];
+		t2i = a[3] + a[7];
+		t3r = a[2] - a[6];
+		t3i = a[3] - a[7];
+		a[0] = t0r + t2r;
+		a[1] = t0i + t2i;
+		a[2] = t0r - t2r;
+		a[3] = t0i - t2i;
+		a[4] = t1r + t3i;
+		a[5] = t1i - t3r;
+		a[6] = t1r - t3i;
+		a[7] = t1i + t3r;
+	}
+}
+
+/**
+  * @brief  Put the bins of complexFft() in order
+  * @param  z: 2^log2_len interleaved real and imaginary values
+  * @param  log2_len: 4 to FFT_LOG2_MAX_HALF
+  * @param  conjugate: 1 to also negate the imaginary parts
+  * @retval none
+  */
+
+static void reorder(float32_t *z, uint32_t log2_len, uint8_t conjugate) {
+	uint32_t len = 1u << log2_len, shift = FFT_LOG2_MAX_HALF - log2_len, i, j;
+	float32_t re, im;
+
+	for(i = 0; i < len; i++) {
+		j = fft_bitrev[i << shift];
+		if(i < j) {
+			re = z[2*i];
+			im = z[2*i + 1];
+			z[2*i] = z[2*j];
+			z[2*i + 1] = conjugate ? -z[2*j + 1] : z[2*j + 1];
+			z[2*j] = re;
+			z[2*j + 1] = conjugate ? -im : im;
+		} else if(i == j && conjugate) {
+			z[2*i + 1] = -z[2*i + 1];
+		}
+	}
+}
+
+/**
+  * @brief  Real FFT or its inverse. The forward transform takes fft_len
+  *					samples and gives the packed spectrum, the inverse takes the
+  *					packed spectrum and gives the samples scaled by 1/fft_len, so
+  *					one after the other give the input back.
+  * @param  fft: FFT
+  * @param  in: fft_len values, not changed unless it is out
+  * @param  out: fft_len values, may be in
+  * @param  inverse: FFT_FORWARD or FFT_INVERSE
+  * @retval none
+  */
+
+void fftProcess(const RealFft *fft, const float32_t *in, float32_t *out, uint8_t inverse) {
+	uint32_t half = fft->fft_len/2, step = FFT_MAX_SIZE/fft->fft_len, k;
+	float32_t scale = 1.0f/fft->fft_len;
+	float32_t ar, ai, br, bi, sr, si, dr, di, wr, wi, pr, pi;
+
+	if(inverse == FFT_FORWARD) {
+		//Even samples as the real, odd samples as the imaginary parts
+		if(in != out)
+			memcpy(out, in, fft->fft_len*sizeof(float32_t));
+		complexFft(out, fft->log2_half);
+		reorder(out, fft->log2_half, 0);
+
+		//Split Z[k] into the spectra E of the even and O of the odd samples,
+		//X[k] = E + W^k O and X[half - k] = conj(E - W^k O)
+		ar = out[0];
+		ai = out[1];
+		out[0] = ar + ai;
+		out[1] = ar - ai;
+		for(k = 1; k <= half/2; k++) {
+			ar = out[2*k];
+			ai = out[2*k + 1];
+			br = out[2*(half - k)];
+			bi = -out[2*(half - k) + 1];
+			sr = 0.5f*(ar + br);
+			si = 0.5f*(ai + bi);
+			//O = (A - B)/2i
+			dr = 0.5f*(ai - bi);
+			di = -0.5f*(ar - br);
+			wr = fft_cos[k*step];
+			wi = fft_cos[k*step + FFT_QUARTER];
+			pr = dr*wr - di*wi;
+			pi = dr*wi + di*wr;
+			out[2*k] = sr + pr;
+			out[2*k + 1] = si + pi;
+			out[2*(half - k)] = sr - pr;
+			out[2*(half - k) + 1] = pi - si;
+		}
+	} else {
+		//Z[k] = E + iO from X[k] and X[half - k], conjugated and scaled so that
+		//the forward complex FFT gives the inverse
+		ar = in[0];
+		ai = in[1];
+		out[0] = scale*(ar + ai);
+		out[1] = -scale*(ar - ai);
+		for(k = 1; k <= half/2; k++) {
+			ar = in[2*k];
+			ai = in[2*k + 1];
+			br = in[2*(half - k)];
+			bi = -in[2*(half - k) + 1];
+			sr = ar + br;
+			si = ai + bi;
+			dr = ar - br;
+			di = ai - bi;
+			//(A - B) conj(W^k)
+			wr = fft_cos[k*step];
+			wi = fft_cos[k*step + FFT_QUARTER];
+			pr = dr*wr + di*wi;
+			pi = di*wr - dr*wi;
+			out[2*k] = scale*(sr - pi);
+			out[2*k + 1] = -scale*(si + pr);
+			out[2*(half - k)] = scale*(sr + pi);
+			out[2*(half - k) + 1] = scale*(si - pr);
+		}
+		complexFft(out, fft->log2_half);
+		reorder(out, fft->log2_half, 1);
+	}
+}
+
+/**
+  * @brief  Magnitudes of a packed spectrum, for plotFFT() and plotLogFFT()
+  * @param  spectrum: fft_len values from fftProcess()
+  * @param  magnitude: fft_len/2 magnitudes, bin 0 to fft_len/2 - 1, may be
+  *					spectrum
+  * @param  fft_len: length of the FFT
+  * @retval none
+  */
+
+void fftMagnitude(const float32_t *spectrum, float32_t *magnitude, uint32_t fft_len) {
+	uint32_t k;
+
+	//The real bin fft_len/2 shares the place of the imaginary part of bin 0
+	magnitude[0] = fabsf(spectrum[0]);
+	for(k = 1; k < fft_len/2; k++)
+		magnitude[k] = sqrtf(spectrum[2*k]*spectrum[2*k] + spectrum[2*k + 1]*spectrum[2*k + 1]);
+}
+
+/**
+  * @brief  Powers of a packed spectrum, e.g. for a dB scale
+  * @param  spectrum: fft_len values from fftProcess()
+  * @param  power: fft_len/2 powers, bin 0 to fft_len/2 - 1, may be spectrum
+  * @param  fft_len: length of the FFT
+  * @retval none
+  */
+
+void fftPower(const float32_t *spectrum, float32_t *power, uint32_t fft_len) {
+	uint32_t k;
+
+	power[0] = spectrum[0]*spectrum[0];
+	for(k = 1; k < fft_len/2; k++)
+		power[k] = spectrum[2*k]*spectrum[2*k] + spectrum[2*k + 1]*spectrum[2*k + 1];
+}
+
+/**
+  * @brief  Two 1.15 values from memory, real part in the low half
+  * @param  p: values
+  * @retval pair
+  */
+
+static inline uint32_t loadQ15(const int16_t *p) {
+	uint32_t pair;
+
+	memcpy(&pair, p, 4);
+	return pair;
+}
+
+/**
+  * @brief  Store two 1.15 values
+  * @param  p: destination
+  * @param  pair: real part in the low half
+  * @retval none
+  */
+
+static inline void storeQ15(int16_t *p, uint32_t pair) {
+	memcpy(p, &pair, 4);
+}
+
+/**
+  * @brief  Saturate to 1.15
+  * @param  x: value
+  * @retval -32768 to 32767
+  */
+
+static inline int32_t saturateQ15(int32_t x) {
+	if(x > 32767) return 32767;
+	if(x < -32768) return -32768;
+	return x;
+}
+
+/**
+  * @brief  Saturate to 1.31
+  * @param  x: value
+  * @retval INT32_MIN to INT32_MAX
+  */
+
+static inline int32_t saturateQ31(int64_t x) {
+	if(x > INT32_MAX) return INT32_MAX;
+	if(x < INT32_MIN) return INT32_MIN;
+	return (int32_t)x;
+}
+
+#if !(defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+/**
+  * @brief  The parts of a pair and back, for the builds without the DSP
+  *					instructions
+  */
+
+static inline int32_t lowQ15(uint32_t x) {
+	return (int16_t)x;
+}
+
+static inline int32_t highQ15(uint32_t x) {
+	return (int16_t)(x >> 16);
+}
+
+static inline uint32_t packQ15(int32_t re, int32_t im) {
+	return (uint16_t)saturateQ15(re) | ((uint32_t)(uint16_t)saturateQ15(im) << 16);
+}
+#endif
+
+/**
+  * @brief  a + b on both halves, halved when halve is 1 (SHADD16) or
+  *					saturated (QADD16)
+  */
+
+static inline uint32_t addQ15(uint32_t a, uint32_t b, uint32_t halve) {
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+	return halve ? __SHADD16(a, b) : __QADD16(a, b);
+#else
+	return packQ15((lowQ15(a) + lowQ15(b)) >> halve, (highQ15(a) + highQ15(b)) >> halve);
+#endif
+}
+
+/**
+  * @brief  a - b, as addQ15()
+  */
+
+static inline uint32_t subQ15(uint32_t a, uint32_t b, uint32_t halve) {
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+	return halve ? __SHSUB16(a, b) : __QSUB16(a, b);
+#else
+	return packQ15((lowQ15(a) - lowQ15(b)) >> halve, (highQ15(a) - highQ15(b)) >> halve);
+#endif
+}
+
+/**
+  * @brief  a - jb, as addQ15() (SHSAX, QSAX)
+  */
+
+static inline uint32_t subJQ15(uint32_t a, uint32_t b, uint32_t halve) {
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+	return halve ? __SHSAX(a, b) : __QSAX(a, b);
+#else
+	return packQ15((lowQ15(a) + highQ15(b)) >> halve, (highQ15(a) - lowQ15(b)) >> halve);
+#endif
+}
+
+/**
+  * @brief  a + jb, as addQ15() (SHASX, QASX)
+  */
+
+static inline uint32_t addJQ15(uint32_t a, uint32_t b, uint32_t halve) {
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+	return halve ? __SHASX(a, b) : __QASX(a, b);
+#else
+	return packQ15((lowQ15(a) - highQ15(b)) >> halve, (highQ15(a) + lowQ15(b)) >> halve);
+#endif
+}
+
+/**
+  * @brief  x times the twiddle w, rounded, with both products of each part
+  *					in one dual multiply (SMLSD, SMLADX)
+  * @param  x: pair
+  * @param  w: cos in the low half, -sin in the high half
+  * @param  saturate: 1 when the result can leave the range, FFT_SCALE_FIXED
+  * @retval pair
+  */
+
+static inline uint32_t twiddleQ15(uint32_t x, uint32_t w, uint32_t saturate) {
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+	int32_t re = __SMLSD(x, w, 0x4000), im = __SMLADX(x, w, 0x4000);
+
+	if(saturate)
+		return __PKHBT(__SSAT(re >> 15, 16), __SSAT(im >> 15, 16), 16);
+	return __PKHBT(re >> 15, im, 1);
+#else
+	int32_t re = lowQ15(x)*lowQ15(w) - highQ15(x)*highQ15(w) + 0x4000;
+	int32_t im = lowQ15(x)*highQ15(w) + highQ15(x)*lowQ15(w) + 0x4000;
+
+	(void)saturate;
+	return packQ15(re >> 15, im >> 15);
+#endif
+}
+
+/**
+  * @brief  Bits of headroom left in a block, from the OR of x ^ (x << 1)
+  *					over its pairs. The low bit of the high half also sees the sign
+  *					of the low half, so 14 is the most reported.
+  * @param  bits: OR of the pairs
+  * @retval bits every value can be shifted left by
+  */
+
+static uint32_t headroomQ15(uint32_t bits) {
+	bits = ((bits >> 16) | bits) << 16;
+	return (bits & 0xFFFC0000) ? __CLZ(bits) : 14;
+}
+
+/**
+  * @brief  Bits of headroom left in a block of 1.31 values
+  * @param  bits: OR of x ^ (x << 1) over the values
+  * @retval bits every value can be shifted left by
+  */
+
+static uint32_t headroomQ31(uint32_t bits) {
+	return (bits & 0xFFFFFFFC) ? __CLZ(bits) : 30;
+}
+
+/**
+  * @brief  x ^ (x << 1) of a 1.31 value, ORed over a block for headroomQ31()
+  */
+
+static inline uint32_t signBitsQ31(int32_t x) {
+	return (uint32_t)x ^ ((uint32_t)x << 1);
+}
+
+/**
+  * @brief  Right shift before a stage, FFT_SCALE_BLOCK shifts just enough
+  *					that the largest growth of the stage fits in the headroom
+  * @param  headroom: bits of headroom of the block
+  * @param  growth: bits the stage can grow by, 3 for a radix-4 stage with
+  *					twiddles, 2 otherwise
+  * @param  radix_bits: log2 of the radix, the shift of FFT_SCALE_FIXED
+  * @param  first: 1 for the first stage, FFT_SCALE_FIXED shifts one more bit
+  *					there so that a rotated part can't pass full scale
+  * @param  scaling: FFT_SCALE_BLOCK or FFT_SCALE_FIXED
+  * @retval shift
+  */
+
+static uint32_t stageShift(uint32_t headroom, uint32_t growth, uint32_t radix_bits, uint32_t first, uint8_t scaling) {
+	if(scaling == FFT_SCALE_FIXED)
+		return radix_bits + first;
+	return (headroom >= growth) ? 0 : growth - headroom;
+}
+
+/**
+  * @brief  The stages of complexFft() in 1.15, a radix-2 stage for an odd
+  *					power of 2, the radix-4 stages with twiddles, then the last one.
+  *					Each butterfly works on the real and imaginary parts together
+  *					with the dual 16 bit instructions. A radix-4 butterfly can grow
+  *					a part by 4*sqrt(2), so with FFT_SCALE_BLOCK it needs 3 bits of
+  *					headroom; each stage shifts by what is missing by halving its
+  *					adds, the first level for one bit, both for two, the inputs as
+  *					well for three.
+  * @param  z: 2^log2_len interleaved real and imaginary values, the bins come
+  *					out in bit reversed order
+  * @param  log2_len: 4 to FFT_LOG2_MAX_HALF
+  * @param  scaling: FFT_SCALE_BLOCK or FFT_SCALE_FIXED
+  * @param  bits: OR of x ^ (x << 1) over the input, then over the output
+  * @retval bits the output was shifted right by
+  */
+
+static int32_t complexFftQ15(int16_t *z, uint32_t log2_len, uint8_t scaling, uint32_t *bits) {
+	uint32_t len = 1u << log2_len, span = len, quarter, step, shift, i, j, k;
+	uint32_t a, b, c, d, t0, t1, t2, t3, w1, w2, w3, y, h1, h2, out;
+	uint32_t saturate = (scaling == FFT_SCALE_FIXED);
+	int32_t exponent = 0;
+	int16_t *p;
+
+	if(log2_len & 1) {
+		shift = stageShift(headroomQ15(*bits), 2, 1, 1, scaling);
+		h1 = (shift >= 1);
+		quarter = len/2;
+		step = FFT_MAX_SIZE/len;
+		out = 0;
+		for(i = 0; i < quarter; i++) {
+			p = &z[2*i];
+			a = loadQ15(p);
+			b = loadQ15(p + 2*quarter);
+			if(shift == 2) {
+				a = addQ15(a, 0, 1);
+				b = addQ15(b, 0, 1);
+			}
+			y = addQ15(a, b, h1);
+			storeQ15(p, y);
+			out |= y ^ (y << 1);
+			y = twiddleQ15(subQ15(a, b, h1), fft_twiddle_q15[i*step], saturate);
+			storeQ15(p + 2*quarter, y);
+			out |= y ^ (y << 1);
+		}
+		exponent += shift;
+		*bits = out;
+		span = quarter;
+	}
+
+	for(; span > 4; span >>= 2) {
+		shift = stageShift(headroomQ15(*bits), 3, 2, span == len, scaling);
+		h1 = (shift >= 1);
+		h2 = (shift >= 2);
+		quarter = span/4;
+		step = FFT_MAX_SIZE/span;
+		out = 0;
+		for(i = 0; i < quarter; i++) {
+			k = i*step;
+			w1 = fft_twiddle_q15[k];
+			w2 = fft_twiddle_q15[2*k];
+			w3 = fft_twiddle_q15[3*k];
+			for(j = i; j < len; j += span) {
+				p = &z[2*j];
+				a = loadQ15(p);
+				b = loadQ15(p + 2*quarter);
+				c = loadQ15(p + 4*quarter);
+				d = loadQ15(p + 6*quarter);
+				if(shift == 3) {
+					a = addQ15(a, 0, 1);
+					b = addQ15(b, 0, 1);
+					c = addQ15(c, 0, 1);
+					d = addQ15(d, 0, 1);
+				}
+				t0 = addQ15(a, c, h1);
+				t1 = subQ15(a, c, h1);
+				t2 = addQ15(b, d, h1);
+				t3 = subQ15(b, d, h1);
+				y = addQ15(t0, t2, h2);
+				storeQ15(p, y);
+				out |= y ^ (y << 1);
+				y = twiddleQ15(subQ15(t0, t2, h2), w2, saturate);
+				storeQ15(p + 2*quarter, y);
+				out |= y ^ (y << 1);
+				y = twiddleQ15(subJQ15(t1, t3, h2), w1, saturate);
+				storeQ15(p + 4*quarter, y);
+				out |= y ^ (y << 1);
+				y = twiddleQ15(addJQ15(t1, t3, h2), w3, saturate);
+				storeQ15(p + 6*quarter, y);
+				out |= y ^ (y << 1);
+			}
+		}
+		exponent += shift;
+		*bits = out;
+	}
+
+	//Last stage, all the twiddles are 1 and a part grows by 4 at most
+	shift = stageShift(headroomQ15(*bits), 2, 2, 0, scaling);
+	h1 = (shift >= 1);
+	h2 = (shift >= 2);
+	out = 0;
+	for(p = z; p < z + 2*len; p += 8) {
+		a = loadQ15(p);
+		b = loadQ15(p + 2);
+		c = loadQ15(p + 4);
+		d = loadQ15(p + 6);
+		t0 = addQ15(a, c, h1);
+		t1 = subQ15(a, c, h1);
+		t2 = addQ15(b, d, h1);
+		t3 = subQ15(b, d, h1);
+		y = addQ15(t0, t2, h2);
+		storeQ15(p, y);
+		out |= y ^ (y << 1);
+		y = subQ15(t0, t2, h2);
+		storeQ15(p + 2, y);
+		out |= y ^ (y << 1);
+		y = subJQ15(t1, t3, h2);
+		storeQ15(p + 4, y);
+		out |= y ^ (y << 1);
+		y = addJQ15(t1, t3, h2);
+		storeQ15(p + 6, y);
+		out |= y ^ (y << 1);
+	}
+	*bits = out;
+	return exponent + shift;
+}
+
+/**
+  * @brief  Put the bins of complexFftQ15() in order
+  * @param  z: 2^log2_len interleaved real and imaginary values
+  * @param  log2_len: 4 to FFT_LOG2_MAX_HALF
+  * @retval none
+  */
+
+static void reorderQ15(int16_t *z, uint32_t log2_len) {
+	uint32_t len = 1u << log2_len, shift = FFT_LOG2_MAX_HALF - log2_len, i, j, x;
+
+	for(i = 0; i < len; i++) {
+		j = fft_bitrev[i << shift];
+		if(i < j) {
+			x = loadQ15(&z[2*i]);
+			storeQ15(&z[2*i], loadQ15(&z[2*j]));
+			storeQ15(&z[2*j], x);
+		}
+	}
+}
+
+/**
+  * @brief  x times the twiddle w in 1.31, rounded
+  * @param  p: destination of the real and imaginary parts
+  * @param  xr: real part of x
+  * @param  xi: imaginary part of x
+  * @param  w: the real part of the twiddle, the imaginary part is
+  *					FFT_QUARTER entries further on
+  * @param  saturate: 1 when the result can leave the range, FFT_SCALE_FIXED
+  * @retval x ^ (x << 1) of both parts
+  */
+
+static inline uint32_t twiddleQ31(int32_t *p, int32_t xr, int32_t xi, const int32_t *w, uint32_t saturate) {
+	int32_t wr = w[0], wi = w[FFT_QUARTER];
+	int64_t re = ((int64_t)xr*wr - (int64_t)xi*wi + (1 << 30)) >> 31;
+	int64_t im = ((int64_t)xr*wi + (int64_t)xi*wr + (1 << 30)) >> 31;
+
+	if(saturate) {
+		p[0] = saturateQ31(re);
+		p[1] = saturateQ31(im);
+	} else {
+		p[0] = (int32_t)re;
+		p[1] = (int32_t)im;
+	}
+	return signBitsQ31(p[0]) | signBitsQ31(p[1]);
+}
+
+/**
+  * @brief  The stages of complexFft() in 1.31, as complexFftQ15() a part at
+  *					a time, the inputs of a stage are shifted before the adds
+  * @param  z: 2^log2_len interleaved real and imaginary values, the bins come
+  *					out in bit reversed order
+  * @param  log2_len: 4 to FFT_LOG2_MAX_HALF
+  * @param  scaling: FFT_SCALE_BLOCK or FFT_SCALE_FIXED
+  * @param  bits: OR of x ^ (x << 1) over the input, then over the output
+  * @retval bits the output was shifted right by
+  */
+
+static int32_t complexFftQ31(int32_t *z, uint32_t log2_len, uint8_t scaling, uint32_t *bits) {
+	uint32_t len = 1u << log2_len, span = len, quarter, step, shift, i, j, k, out;
+	uint32_t saturate = (scaling == FFT_SCALE_FIXED);
+	int32_t ar, ai, br, bi, cr, ci, dr, di, t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+	int32_t exponent = 0, *a, *b, *c, *d;
+
+	if(log2_len & 1) {
+		shift = stageShift(headroomQ31(*bits), 2, 1, 1, scaling);
+		quarter = len/2;
+		step = FFT_MAX_SIZE/len;
+		out = 0;
+		for(i = 0; i < quarter; i++) {
+			a = &z[2*i];
+			b = &z[2*(i + quarter)];
+			ar = a[0] >> shift;
+			ai = a[1] >> shift;
+			br = b[0] >> shift;
+			bi = b[1] >> shift;
+			a[0] = ar + br;
+			a[1] = ai + bi;
+			out |= signBitsQ31(a[0]) | signBitsQ31(a[1]);
+			out |= twiddleQ31(b, ar - br, ai - bi, &fft_cos_q31[i*step], saturate);
+		}
+		exponent += shift;
+		*bits = out;
+		span = quarter;
+	}
+
+	for(; span > 4; span >>= 2) {
+		shift = stageShift(headroomQ31(*bits), 3, 2, span == len, scaling);
+		quarter = span/4;
+		step = FFT_MAX_SIZE/span;
+		out = 0;
+		for(i = 0; i < quarter; i++) {
+			k = i*step;
+			for(j = i; j < len; j += span) {
+				a = &z[2*j];
+				b = a + 2*quarter;
+				c = b + 2*quarter;
+				d = c + 2*quarter;
+				ar = a[0] >> shift;
+				ai = a[1] >> shift;
+				br = b[0] >> shift;
+				bi = b[1] >> shift;
+				cr = c[0] >> shift;
+				ci = c[1] >> shift;
+				dr = d[0] >> shift;
+				di = d[1] >> shift;
+				t0r = ar + cr;
+				t0i = ai + ci;
+				t1r = ar - cr;
+				t1i = ai - ci;
+				t2r = br + dr;
+				t2i = bi + di;
+				t3r = br - dr;
+				t3i = bi - di;
+				a[0] = t0r + t2r;
+				a[1] = t0i + t2i;
+				out |= signBitsQ31(a[0]) | signBitsQ31(a[1]);
+				out |= twiddleQ31(b, t0r - t2r, t0i - t2i, &fft_cos_q31[2*k], saturate);
+				out |= twiddleQ31(c, t1r + t3i, t1i - t3r, &fft_cos_q31[k], saturate);
+				out |= twiddleQ31(d, t1r - t3i, t1i + t3r, &fft_cos_q31[3*k], saturate);
+			}
+		}
+		exponent += shift;
+		*bits = out;
+	}
+
+	//Last stage, all the twiddles are 1
+	shift = stageShift(headroomQ31(*bits), 2, 2, 0, scaling);
+	out = 0;
+	for(a = z; a < z + 2*len; a += 8) {
+		ar = a[0] >> shift;
+		ai = a[1] >> shift;
+		br = a[2] >> shift;
+		bi = a[3] >> shift;
+		cr = a[4] >> shift;
+		ci = a[5] >> shift;
+		dr = a[6] >> shift;
+		di = a[7] >> shift;
+		t0r = ar + cr;
+		t0i = ai + ci;
+		t1r = ar - cr;
+		t1i = ai - ci;
+		t2r = br + dr;
+		t2i = bi + di;
+		t3r = br - dr;
+		t3i = bi - di;
+		a[0] = t0r + t2r;
+		a[1] = t0i + t2i;
+		a[2] = t0r - t2r;
+		a[3] = t0i - t2i;
+		a[4] = t1r + t3i;
+		a[5] = t1i - t3r;
+		a[6] = t1r - t3i;
+		a[7] = t1i + t3r;
+		for(i = 0; i < 8; i++)
+			out |= signBitsQ31(a[i]);
+	}
+	*bits = out;
+	return exponent + shift;
+}
+
+/**
+  * @brief  Put the bins of complexFftQ31() in order
+  * @param  z: 2^log2_len interleaved real and imaginary values
+  * @param  log2_len: 4 to FFT_LOG2_MAX_HALF
+  * @retval none
+  */
+
+static void reorderQ31(int32_t *z, uint32_t log2_len) {
+	uint32_t len = 1u << log2_len, shift = FFT_LOG2_MAX_HALF - log2_len, i, j;
+	int32_t re, im;
+
+	for(i = 0; i < len; i++) {
+		j = fft_bitrev[i << shift];
+		if(i < j) {
+			re = z[2*i];
+			im = z[2*i + 1];
+			z[2*i] = z[2*j];
+			z[2*i + 1] = z[2*j + 1];
+			z[2*j] = re;
+			z[2*j + 1] = im;
+		}
+	}
+}
+
+/**
+  * @brief  Split the ordered complex FFT of half the length into the packed
+  *					spectrum of the real signal, as in fftProcess(). The values are
+  *					shifted first if the split could overflow, it grows a part by
+  *					1 + sqrt(2) at most.
+  * @param  z: fft_len values, in place
+  * @param  fft_len: real samples
+  * @param  scaling: FFT_SCALE_BLOCK or FFT_SCALE_FIXED
+  * @param  bits: OR of x ^ (x << 1) over z
+  * @retval bits the spectrum was shifted right by
+  */
+
+static int32_t splitQ15(int16_t *z, uint32_t fft_len, uint8_t scaling, uint32_t bits) {
+	uint32_t half = fft_len/2, step = FFT_MAX_SIZE/fft_len, shift, k, w;
+	int32_t ar, ai, br, bi, sr, si, dr, di, wr, wi, pr, pi;
+
+	shift = stageShift(headroomQ15(bits), 2, 1, 0, scaling);
+	ar = z[0] >> shift;
+	ai = z[1] >> shift;
+	z[0] = (int16_t)saturateQ15(ar + ai);
+	z[1] = (int16_t)saturateQ15(ar - ai);
+	for(k = 1; k <= half/2; k++) {
+		ar = z[2*k] >> shift;
+		ai = z[2*k + 1] >> shift;
+		br = z[2*(half - k)] >> shift;
+		bi = -(z[2*(half - k) + 1] >> shift);
+		sr = (ar + br) >> 1;
+		si = (ai + bi) >> 1;
+		dr = (ai - bi) >> 1;
+		di = (br - ar) >> 1;
+		w = fft_twiddle_q15[k*step];
+		wr = (int16_t)w;
+		wi = (int16_t)(w >> 16);
+		pr = (dr*wr - di*wi + 0x4000) >> 15;
+		pi = (dr*wi + di*wr + 0x4000) >> 15;
+		z[2*k] = (int16_t)saturateQ15(sr + pr);
+		z[2*k + 1] = (int16_t)saturateQ15(si + pi);
+		z[2*(half - k)] = (int16_t)saturateQ15(sr - pr);
+		z[2*(half - k) + 1] = (int16_t)saturateQ15(pi - si);
+	}
+	return shift;
+}
+
+/**
+  * @brief  splitQ15() in 1.31
+  * @param  z: fft_len values, in place
+  * @param  fft_len: real samples
+  * @param  scaling: FFT_SCALE_BLOCK or FFT_SCALE_FIXED
+  * @param  bits: OR of x ^ (x << 1) over z
+  * @retval bits the spectrum was shifted right by
+  */
+
+static int32_t splitQ31(int32_t *z, uint32_t fft_len, uint8_t scaling, uint32_t bits) {
+	uint32_t half = fft_len/2, step = FFT_MAX_SIZE/fft_len, shift, k;
+	int64_t ar, ai, br, bi, sr, si, dr, di, pr, pi, wr, wi;
+
+	shift = stageShift(headroomQ31(bits), 2, 1, 0, scaling);
+	ar = z[0] >> shift;
+	ai = z[1] >> shift;
+	z[0] = saturateQ31(ar + ai);
+	z[1] = saturateQ31(ar - ai);
+	for(k = 1; k <= half/2; k++) {
+		ar = z[2*k] >> shift;
+		ai = z[2*k + 1] >> shift;
+		br = z[2*(half - k)] >> shift;
+		bi = -(int64_t)(z[2*(half - k) + 1] >> shift);
+		sr = (ar + br) >> 1;
+		si = (ai + bi) >> 1;
+		dr = (ai - bi) >> 1;
+		di = (br - ar) >> 1;
+		wr = fft_cos_q31[k*step];
+		wi = fft_cos_q31[k*step + FFT_QUARTER];
+		pr = (dr*wr - di*wi + (1 << 30)) >> 31;
+		pi = (dr*wi + di*wr + (1 << 30)) >> 31;
+		z[2*k] = saturateQ31(sr + pr);
+		z[2*k + 1] = saturateQ31(si + pi);
+		z[2*(half - k)] = saturateQ31(sr - pr);
+		z[2*(half - k) + 1] = saturateQ31(pi - si);
+	}
+	return shift;
+}
+
+/**
+  * @brief  In place complex FFT in 1.15 with the bins in order
+  * @param  z: len interleaved real and imaginary values, word aligned
+  * @param  len: a power of 2 from FFT_MIN_SIZE/2 to FFT_MAX_SIZE/2
+  * @param  scaling: FFT_SCALE_BLOCK or FFT_SCALE_FIXED
+  * @retval exponent, the spectrum is z times 2^exponent, log2(len) + 1
+  *					for FFT_SCALE_FIXED
+  */
+
+int32_t fftComplexQ15(int16_t *z, uint32_t len, uint8_t scaling) {
+	uint32_t log2_len = 31 - __CLZ(len), bits = 0, i, x;
+	int32_t exponent;
+
+	for(i = 0; i < len; i++) {
+		x = loadQ15(&z[2*i]);
+		bits |= x ^ (x << 1);
+	}
+	exponent = complexFftQ15(z, log2_len, scaling, &bits);
+	reorderQ15(z, log2_len);
+	return exponent;
+}
+
+/**
+  * @brief  In place complex FFT in 1.31 with the bins in order
+  * @param  z: len interleaved real and imaginary values
+  * @param  len: a power of 2 from FFT_MIN_SIZE/2 to FFT_MAX_SIZE/2
+  * @param  scaling: FFT_SCALE_BLOCK or FFT_SCALE_FIXED
+  * @retval exponent, the spectrum is z times 2^exponent
+  */
+
+int32_t fftComplexQ31(int32_t *z, uint32_t len, uint8_t scaling) {
+	uint32_t log2_len = 31 - __CLZ(len), bits = 0, i;
+	int32_t exponent;
+
+	for(i = 0; i < 2*len; i++)
+		bits |= signBitsQ31(z[i]);
+	exponent = complexFftQ31(z, log2_len, scaling, &bits);
+	reorderQ31(z, log2_len);
+	return exponent;
+}
+
+/**
+  * @brief  Real FFT in 1.15, the spectrum in the packing of fftProcess()
+  * @param  fft: FFT
+  * @param  in: fft_len samples, not changed unless it is out, word aligned
+  * @param  out: fft_len values, may be in, word aligned
+  * @param  scaling: FFT_SCALE_BLOCK or FFT_SCALE_FIXED
+  * @retval exponent, the spectrum is out times 2^exponent, log2(fft_len) + 1
+  *					for FFT_SCALE_FIXED
+  */
+
+int32_t fftProcessQ15(const RealFft *fft, const int16_t *in, int16_t *out, uint8_t scaling) {
+	uint32_t half = fft->fft_len/2, bits = 0, i, x;
+	int32_t exponent;
+
+	//Even samples as the real, odd samples as the imaginary parts
+	for(i = 0; i < half; i++) {
+		x = loadQ15(&in[2*i]);
+		storeQ15(&out[2*i], x);
+		bits |= x ^ (x << 1);
+	}
+	exponent = complexFftQ15(out, fft->log2_half, scaling, &bits);
+	reorderQ15(out, fft->log2_half);
+	return exponent + splitQ15(out, fft->fft_len, scaling, bits);
+}
+
+/**
+  * @brief  Real FFT in 1.31, the spectrum in the packing of fftProcess()
+  * @param  fft: FFT
+  * @param  in: fft_len samples, not changed unless it is out
+  * @param  out: fft_len values, may be in
+  * @param  scaling: FFT_SCALE_BLOCK or FFT_SCALE_FIXED
+  * @retval exponent, the spectrum is out times 2^exponent
+  */
+
+int32_t fftProcessQ31(const RealFft *fft, const int32_t *in, int32_t *out, uint8_t scaling) {
+	uint32_t bits = 0, i;
+	int32_t exponent;
+
+	for(i = 0; i < fft->fft_len; i++) {
+		out[i] = in[i];
+		bits |= signBitsQ31(in[i]);
+	}
+	exponent = complexFftQ31(out, fft->log2_half, scaling, &bits);
+	reorderQ31(out, fft->log2_half);
+	return exponent + splitQ31(out, fft->fft_len, scaling, bits);
+}
+
+#if FFT_BENCHMARK
+//Cycle counter, the host build times with a clock instead
+#ifndef FFT_CYCLES
+#define FFT_CYCLES()          (DWT->CYCCNT)
+#endif
+
+#define FFT_BENCH_RUNS        8					//Transforms timed for each entry
+
+static float32_t bench_signal[FFT_MAX_SIZE];
+static float32_t bench_spectrum[FFT_MAX_SIZE];
+
+/**
+  * @brief  Compare FFT_BENCH_BINS bins of bench_spectrum with a DFT of
+  *					bench_signal in double precision
+  * @param  len: length of the FFT
+  * @retval bin power over error power in dB
+  */
+
+static float32_t benchSnr(uint32_t len) {
+	uint32_t n, k, b;
+	float64_t re, im, wr, wi, rot_r, rot_i, t, signal = 0, error = 0;
+
+	for(b = 0; b < FFT_BENCH_BINS; b++) {
+		k = b*(len/2)/FFT_BENCH_BINS;
+		//PI is a float, the angle needs all the digits
+		rot_r = cos(6.283185307179586*k/len);
+		rot_i = -sin(6.283185307179586*k/len);
+		wr = 1;
+		wi = 0;
+		re = 0;
+		im = 0;
+		for(n = 0; n < len; n++) {
+			re += bench_signal[n]*wr;
+			im += bench_signal[n]*wi;
+			t = wr*rot_r - wi*rot_i;
+			wi = wr*rot_i + wi*rot_r;
+			wr = t;
+		}
+		signal += re*re + im*im;
+		re -= bench_spectrum[2*k];
+		im -= (k == 0) ? 0 : bench_spectrum[2*k + 1];
+		error += re*re + im*im;
+	}
+	return (float32_t)(10.0*log10(signal/error));
+}
+
+/**
+  * @brief  Measure the forward and inverse FFTs of 64 to 4096 points and
+  *					compare FFT_BENCH_BINS bins of the forward one with a DFT in
+  *					double precision
+  * @param  cycles: cycles per transform, forward then inverse, by length
+  * @param  snr: bin power over error power in dB, by length
+  * @retval none
+  */
+
+void fftBenchmark(float32_t cycles[2][FFT_BENCH_SIZES], float32_t snr[FFT_BENCH_SIZES]) {
+	RealFft fft;
+	uint32_t s, i, n, len, seed = 1, start, total;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	for(s = 0; s < FFT_BENCH_SIZES; s++) {
+		len = 64u << s;
+		fftInit(&fft, len);
+		for(n = 0; n < len; n++) {
+			seed = seed*1664525u + 1013904223u;
+			bench_signal[n] = (float32_t)(int32_t)seed/2147483648.0f;
+		}
+
+		total = 0;
+		for(i = 0; i < FFT_BENCH_RUNS; i++) {
+			memcpy(bench_spectrum, bench_signal, len*sizeof(float32_t));
+			start = FFT_CYCLES();
+			fftProcess(&fft, bench_spectrum, bench_spectrum, FFT_FORWARD);
+			total += FFT_CYCLES() - start;
+		}
+		cycles[FFT_FORWARD][s] = (float32_t)total/FFT_BENCH_RUNS;
+
+		snr[s] = benchSnr(len);
+
+		total = 0;
+		for(i = 0; i < FFT_BENCH_RUNS; i++) {
+			start = FFT_CYCLES();
+			fftProcess(&fft, bench_spectrum, bench_signal, FFT_INVERSE);
+			total += FFT_CYCLES() - start;
+		}
+		cycles[FFT_INVERSE][s] = (float32_t)total/FFT_BENCH_RUNS;
+	}
+}
+
+static int32_t bench_q31[FFT_MAX_SIZE];
+static int32_t bench_fixed[FFT_MAX_SIZE];
+
+/**
+  * @brief  Measure the real fixed point FFTs of 64 to 4096 points of noise at
+  *					-18 dBFS, a typical level from the codec, and compare them with
+  *					a DFT of the same samples in double precision
+  * @param  cycles: cycles per transform with FFT_SCALE_BLOCK, FFT_Q15 then
+  *					FFT_Q31, by length
+  * @param  snr: bin power over error power in dB by format, scaling
+  *					(FFT_SCALE_BLOCK, FFT_SCALE_FIXED) and length
+  * @retval none
+  */
+
+void fftBenchmarkFixed(float32_t cycles[2][FFT_BENCH_SIZES], float32_t snr[2][2][FFT_BENCH_SIZES]) {
+	RealFft fft;
+	int16_t *q15 = (int16_t *)bench_fixed;
+	uint32_t s, format, scaling, i, n, len, seed = 1, start, total;
+	int32_t exponent = 0;
+	float32_t one;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	for(s = 0; s < FFT_BENCH_SIZES; s++) {
+		len = 64u << s;
+		fftInit(&fft, len);
+		for(n = 0; n < len; n++) {
+			seed = seed*1664525u + 1013904223u;
+			bench_q31[n] = (int32_t)seed >> 3;
+		}
+
+		for(format = FFT_Q15; format <= FFT_Q31; format++) {
+			one = (format == FFT_Q15) ? 32768.0f : 2147483648.0f;
+			for(n = 0; n < len; n++)
+				bench_signal[n] = (format == FFT_Q15) ? (bench_q31[n] >> 16)/one : bench_q31[n]/one;
+			for(scaling = FFT_SCALE_BLOCK; scaling <= FFT_SCALE_FIXED; scaling++) {
+				total = 0;
+				for(i = 0; i < FFT_BENCH_RUNS; i++) {
+					for(n = 0; n < len; n++) {
+						if(format == FFT_Q15)
+							q15[n] = (int16_t)(bench_q31[n] >> 16);
+						else
+							bench_fixed[n] = bench_q31[n];
+					}
+					start = FFT_CYCLES();
+					if(format == FFT_Q15)
+						exponent = fftProcessQ15(&fft, q15, q15, scaling);
+					else
+						exponent = fftProcessQ31(&fft, bench_fixed, bench_fixed, scaling);
+					total += FFT_CYCLES() - start;
+				}
+				if(scaling == FFT_SCALE_BLOCK)
+					cycles[format][s] = (float32_t)total/FFT_BENCH_RUNS;
+				for(n = 0; n < len; n++)
+					bench_spectrum[n] = ldexpf((format == FFT_Q15) ? q15[n] : (float32_t)bench_fixed[n], exponent)/one;
+				snr[format][scaling][s] = benchSnr(len);
+			}
+		}
+	}
+}
+#endif /* FFT_BENCHMARK */
@@ -0,0 +1,106 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_conv.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_conv.c module
+  *
+  *          Drop-in use in the half-buffer callback of a DMA loop, a long
+  *          impulse response on the left slot of the interleaved buffer:
+  *
+  *          static Convolver conv;
+  *          convInit(&conv, BLOCK, NUM_TAPS, (float32_t *)CONV_SDRAM_BUFFER);
+  *          BSP_QSPI_Init();
+  *          convLoadResponse(&conv, BSP_QSPI_Read, IR_ADDRESS, NUM_TAPS);
+  *          ...
+  *          void process_half(int16_t *buf, uint32_t ns)
+  *          {
+  *            convProcessQ15(&conv, buf, buf, 2);     //ns/2 == BLOCK
+  *          }
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_CONV_H
+#define __STM32F7_CONV_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "arm_math.h"
+#include "stm32f7_fft.h"
+#include "stm32f7xx_hal.h"
+#include "stm32746g_discovery_sdram.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define CONV_MIN_BLOCK        16				//The FFT is twice the block, 32 to 4096
+#define CONV_MAX_BLOCK        2048
+
+/**
+  * @brief  Floats of memory for a convolver, the impulse response spectra,
+  * the spectra of as many past input blocks, two FFT buffers and the last
+  * input block
+  */
+#define CONV_PARTITIONS(block, taps) (((taps) + (block) - 1)/(block))
+#define CONV_MEMORY(block, taps)     ((4*CONV_PARTITIONS(block, taps) + 5)*(block))
+
+/**
+  * @brief  SDRAM left for long responses, between the graph layer frame buffer
+  * and the logo layer frame buffer (0xC0400000). 16 bytes per tap, 16384 taps
+  * take 256 KB.
+  */
+#define CONV_SDRAM_BUFFER     ((uint32_t)(SDRAM_DEVICE_ADDR + 0x00100000))
+#define CONV_SDRAM_SIZE       0x00300000
+
+/**
+  * @brief  convBenchmark() is only built when CONV_BENCHMARK is defined to 1,
+  * e.g. in the project options. It needs FIR_MAX_TAPS (stm32f7_fir.h) taps.
+  */
+#ifndef CONV_BENCHMARK
+#define CONV_BENCHMARK        0
+#endif
+#define CONV_BENCH_TAPS       7					//256, 512, ... 16384 taps
+#define CONV_DIRECT           0
+#define CONV_PARTITIONED      1
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Reads size bytes at address of a flash or card into data,
+  * BSP_QSPI_Read() or convReadSd()
+  * @retval 0 when it worked
+  */
+typedef uint8_t (*ConvRead)(uint8_t *data, uint32_t address, uint32_t size);
+
+/**
+  * @brief  Uniformly partitioned overlap-save convolver
+  * The response is cut into blocks of the input block size, each held as the
+  * spectrum of the block padded to twice its length. The spectra of the last
+  * input frames are kept the same way, every block multiplies them with the
+  * response spectra and accumulates, one inverse FFT gives the output. The
+  * output of a block comes out of the same call, the latency is one block.
+  */
+typedef struct
+{
+	uint32_t block;							//Samples per call
+	uint32_t partitions;
+	uint32_t fft_len;						//2*block
+	uint32_t current;						//Delay line slot of the newest input spectrum
+	RealFft fft;
+	float32_t *response;				//partitions spectra of fft_len floats
+	float32_t *delay_line;			//partitions spectra of fft_len floats
+	float32_t *work;						//FFT sized
+	float32_t *accumulator;			//FFT sized
+	float32_t *frame;						//Last input block
+} Convolver;
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef convInit(Convolver *conv, uint32_t block, uint32_t num_taps, float32_t *memory);
+void convReset(Convolver *conv);
+HAL_StatusTypeDef convSetResponse(Convolver *conv, const float32_t *response, uint32_t num_taps);
+HAL_StatusTypeDef convLoadResponse(Convolver *conv, ConvRead read, uint32_t address, uint32_t num_taps);
+uint8_t convReadSd(uint8_t *data, uint32_t address, uint32_t size);
+void convProcess(Convolver *conv, const float32_t *in, float32_t *out, uint32_t stride);
+void convProcessQ15(Convolver *conv, const int16_t *in, int16_t *out, uint32_t stride);
+#if CONV_BENCHMARK
+void convBenchmark(uint32_t block, float32_t cycles[2][CONV_BENCH_TAPS]);
+#endif
+
+#endif /* __STM32F7_CONV_H */
@@ -0,0 +1,58 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_eye.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_eye.c module
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_EYE_H
+#define __STM32F7_EYE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_display.h"
+
+/* Exported constants --------------------------------------------------------*/
+/**
+  * @brief  Eye diagram buffers
+  * The hit counts (one uint16_t per graph pixel) and the L8 image drawn from
+  * them live in SDRAM between the glyph atlas (0xC0500000) and the waterfall
+  * ring (0xC0600000).
+  */
+#define EYE_BUFFER            ((uint32_t)(SDRAM_DEVICE_ADDR + 0x00520000))
+#define EYE_IMAGE             ((uint32_t)(SDRAM_DEVICE_ADDR + 0x00540000))
+#define EYE_ROWS              (GRAPH_VER_END_PIXEL - HEADER_HEIGHT + 1)
+
+#define EYE_MAX_PERIOD        64				//Most samples per chip
+#define EYE_LINE_COLUMNS      16				//Most hit map columns a sample's line crosses
+#define EYE_HALVE_HITS        0x8000		//plotEye() halves the counts from here
+#define EYE_HIST_BINS         GRAPH_WIDTH	//One amplitude bin per graph column
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+	uint32_t period;							//Samples per chip, the eye is two chips wide
+	int16_t range;								//Amplitude at the top and bottom of the graph
+	int32_t row_scale;						//Rows per unit of amplitude, 16.16 fixed point
+	int32_t bin_scale;						//Histogram bins per unit of amplitude, 16.16 fixed point
+	uint32_t columns;							//Hit map columns, stretched over the graph width
+	uint16_t column[2*EYE_MAX_PERIOD + 1];	//First hit map column of each phase
+	uint32_t phase;								//Phase of the next sample, 0 to 2*period-1
+	uint8_t has_last;
+	int16_t last_row;							//Row of the previous sample
+	uint16_t max_hits;						//Largest count in the eye
+	uint32_t samples;							//Samples added since eyeClear()
+	uint32_t hist[EYE_HIST_BINS];
+	uint32_t hist_max;
+} Eye;
+
+/* Exported functions ------------------------------------------------------- */
+void eyeInit(Eye *eye, uint32_t period, int16_t range);
+void eyeClear(Eye *eye);
+void eyeAddBlock(Eye *eye, const int16_t *data, uint32_t n);
+void plotEye(Eye *eye);
+void plotHistogram(Eye *eye);
+
+#endif /* __STM32F7_EYE_H */
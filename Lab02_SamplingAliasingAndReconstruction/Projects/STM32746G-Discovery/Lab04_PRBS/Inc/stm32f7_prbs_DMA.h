@@ -26,6 +26,7 @@
 #include "stm32f7_display.h"
 #include "wm8994.h"
 #include "stm32f7_prbs.h"
+#include "stm32f7_eye.h"
 
 /* Exported types ------------------------------------------------------------*/
 /* Exported constants --------------------------------------------------------*/
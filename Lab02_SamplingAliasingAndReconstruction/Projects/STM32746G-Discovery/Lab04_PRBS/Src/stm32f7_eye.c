@@ -0,0 +1,305 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_eye.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides an eye diagram and an amplitude histogram for
+  *					 the PRBS lab. eyeAddBlock() takes the samples block by block:
+  *					 every sample is folded modulo two chip periods and the line from
+  *					 the previous sample is counted into a hit map of at most
+  *					 EYE_LINE_COLUMNS columns a phase, so a sample costs one
+  *					 histogram bin and at most EYE_LINE_COLUMNS counts whatever the
+  *					 period. plotEye() halves the counts when they grow large and
+  *					 stretches the hit map over the graph width, and plotEye() and
+  *					 plotHistogram() colour map the graph area with one DMA2D
+  *					 transfer.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_eye.h"
+
+#define EYE_VIEW_NONE         0
+#define EYE_VIEW_EYE          1
+#define EYE_VIEW_HISTOGRAM    2
+
+extern LTDC_HandleTypeDef hLtdcHandler;
+extern int update_flag;
+
+static DMA2D_HandleTypeDef hDma2dEye;
+static uint32_t eye_clut[256];
+static int eye_view = EYE_VIEW_NONE;
+
+/**
+  * @brief  Density colours, the background for no hit then light blue - blue - red
+  * @param  none
+  * @retval none
+  */
+
+static void buildPalette(void) {
+	static const uint8_t anchors[][4] = {
+		//index, red, green, blue
+		{1, 160, 200, 255},
+		{96, 0, 64, 255},
+		{176, 128, 0, 192},
+		{255, 255, 0, 0},
+	};
+	uint32_t i, a = 0, span, pos, red, green, blue;
+
+	eye_clut[0] = BACKGROUND_COLOUR;
+	for(i = 1; i < 256; i++) {
+		if(i > anchors[a + 1][0]) a++;
+		span = anchors[a + 1][0] - anchors[a][0];
+		pos = i - anchors[a][0];
+		red = (anchors[a][1]*(span - pos) + anchors[a + 1][1]*pos)/span;
+		green = (anchors[a][2]*(span - pos) + anchors[a + 1][2]*pos)/span;
+		blue = (anchors[a][3]*(span - pos) + anchors[a + 1][3]*pos)/span;
+		eye_clut[i] = 0xFF000000u | (red << 16) | (green << 8) | blue;
+	}
+}
+
+/**
+  * @brief  Set up an eye diagram and histogram, both start empty
+  * @param  eye: eye diagram
+  * @param  period: samples per chip, 1 to EYE_MAX_PERIOD
+  * @param  range: amplitude at the edges of the graph
+  * @retval none
+  */
+
+void eyeInit(Eye *eye, uint32_t period, int16_t range) {
+	uint32_t i;
+
+	if(period < 1) period = 1;
+	if(period > EYE_MAX_PERIOD) period = EYE_MAX_PERIOD;
+	if(range < 1) range = 1;
+	eye->period = period;
+	eye->range = range;
+	eye->row_scale = ((EYE_ROWS/2) << 16)/range;
+	eye->bin_scale = ((EYE_HIST_BINS/2) << 16)/range;
+
+	//Short periods get fewer columns than the graph, so no line crosses more than EYE_LINE_COLUMNS
+	eye->columns = 2*period*EYE_LINE_COLUMNS;
+	if(eye->columns > GRAPH_WIDTH) eye->columns = GRAPH_WIDTH;
+	for(i = 0; i <= 2*period; i++)
+		eye->column[i] = i*eye->columns/(2*period);
+
+	buildPalette();
+	eyeClear(eye);
+}
+
+/**
+  * @brief  Forget every sample added so far
+  * @param  eye: eye diagram
+  * @retval none
+  */
+
+void eyeClear(Eye *eye) {
+	memset((void *)EYE_BUFFER, 0, GRAPH_WIDTH*EYE_ROWS*sizeof(uint16_t));
+	memset(eye->hist, 0, sizeof(eye->hist));
+	eye->phase = 0;
+	eye->has_last = 0;
+	eye->max_hits = 0;
+	eye->samples = 0;
+	eye->hist_max = 0;
+}
+
+/**
+  * @brief  Halve every count so the eye keeps accumulating without saturating
+  * @param  eye: eye diagram
+  * @retval none
+  */
+
+static void halveHits(Eye *eye) {
+	uint32_t *pair = (uint32_t *)EYE_BUFFER;
+	uint32_t i;
+
+	//Two counts per word
+	for(i = 0; i < GRAPH_WIDTH*EYE_ROWS/2; i++)
+		pair[i] = (pair[i] >> 1) & 0x7FFF7FFFu;
+	eye->max_hits >>= 1;
+}
+
+/**
+  * @brief  Add a block of samples, e.g. one half of the DMA buffer. The blocks
+  *					must follow each other, the phase carries on from the last block.
+  *					Each sample counts one histogram bin and at most EYE_LINE_COLUMNS
+  *					hit map cells.
+  * @param  eye: eye diagram
+  * @param  data: samples
+  * @param  n: number of samples
+  * @retval none
+  */
+
+void eyeAddBlock(Eye *eye, const int16_t *data, uint32_t n) {
+	uint16_t *hits = (uint16_t *)EYE_BUFFER;
+	uint16_t *hit;
+	uint32_t i, c, c0, c1, phase = eye->phase, eye_len = 2*eye->period;
+	int32_t value, row, bin, step, acc;
+
+	for(i = 0; i < n; i++) {
+		value = data[i];
+
+		//Histogram bin over -range to range, outliers go to the edge bins
+		bin = EYE_HIST_BINS/2 + (int32_t)(((int64_t)value*eye->bin_scale) >> 16);
+		if(bin < 0) bin = 0;
+		if(bin >= EYE_HIST_BINS) bin = EYE_HIST_BINS - 1;
+		if(++eye->hist[bin] > eye->hist_max) eye->hist_max = eye->hist[bin];
+
+		row = EYE_ROWS/2 - (int32_t)(((int64_t)value*eye->row_scale) >> 16);
+		if(row < 0) row = 0;
+		if(row >= EYE_ROWS) row = EYE_ROWS - 1;
+
+		//Line from the previous sample across the columns of its phase, EYE_LINE_COLUMNS at most
+		if(eye->has_last) {
+			c0 = eye->column[(phase == 0) ? eye_len - 1 : phase - 1];
+			c1 = eye->column[(phase == 0) ? eye_len : phase];
+			step = ((row - eye->last_row) << 16)/(int32_t)(c1 - c0);
+			acc = (eye->last_row << 16) + 0x8000;
+			for(c = c0; c < c1; c++, acc += step) {
+				hit = &hits[(acc >> 16)*GRAPH_WIDTH + c];
+				if(*hit < 0xFFFF) (*hit)++;
+				if(*hit > eye->max_hits) eye->max_hits = *hit;
+			}
+		}
+		eye->last_row = row;
+		eye->has_last = 1;
+		if(++phase == eye_len) phase = 0;
+	}
+	eye->phase = phase;
+	eye->samples += n;
+}
+
+/**
+  * @brief  Copy the L8 image to the graph area through the density colours
+  * @param  none
+  * @retval none
+  */
+
+static void drawImage(void) {
+	uint32_t address, bytes_per_pixel, xsize = BSP_LCD_GetXSize();
+	DMA2D_CLUTCfgTypeDef clut;
+
+	if(hLtdcHandler.LayerCfg[LTDC_ACTIVE_LAYER].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) {
+		hDma2dEye.Init.ColorMode = DMA2D_OUTPUT_RGB565;
+		bytes_per_pixel = 2;
+	} else {
+		hDma2dEye.Init.ColorMode = DMA2D_OUTPUT_ARGB8888;
+		bytes_per_pixel = 4;
+	}
+	hDma2dEye.Instance = DMA2D;
+	hDma2dEye.Init.Mode = DMA2D_M2M_PFC;
+	hDma2dEye.Init.OutputOffset = xsize - GRAPH_WIDTH;
+	hDma2dEye.LayerCfg[1].InputColorMode = DMA2D_INPUT_L8;
+	hDma2dEye.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+	hDma2dEye.LayerCfg[1].InputAlpha = 0xFF;
+	hDma2dEye.LayerCfg[1].InputOffset = 0;
+	if(HAL_DMA2D_Init(&hDma2dEye) != HAL_OK || HAL_DMA2D_ConfigLayer(&hDma2dEye, 1) != HAL_OK)
+		return;
+
+	clut.pCLUT = eye_clut;
+	clut.CLUTColorMode = DMA2D_CCM_ARGB8888;
+	clut.Size = 255;
+	if(HAL_DMA2D_CLUTStartLoad(&hDma2dEye, &clut, 1) != HAL_OK)
+		return;
+	HAL_DMA2D_PollForTransfer(&hDma2dEye, 10);
+
+	SCB_CleanDCache_by_Addr((uint32_t *)EYE_IMAGE, GRAPH_WIDTH*EYE_ROWS);
+	address = hLtdcHandler.LayerCfg[LTDC_ACTIVE_LAYER].FBStartAdress +
+						bytes_per_pixel*(xsize*HEADER_HEIGHT + FIRST_DATA_PIXEL);
+	if(HAL_DMA2D_Start(&hDma2dEye, EYE_IMAGE, address, GRAPH_WIDTH, EYE_ROWS) != HAL_OK)
+		return;
+	HAL_DMA2D_PollForTransfer(&hDma2dEye, 20);
+}
+
+/**
+  * @brief  Start drawing another view, the labels of the last one are rubbed out
+  * @param  view: EYE_VIEW_EYE or EYE_VIEW_HISTOGRAM
+  * @retval none
+  */
+
+static void switchView(int view) {
+	if(eye_view == view)
+		return;
+	eye_view = view;
+	clearLabels();
+	update_flag = 1;
+}
+
+/**
+  * @brief  Draw the eye diagram, the colour shows how often a pixel was crossed.
+  *					Counts from EYE_HALVE_HITS up are halved first, so they saturate
+  *					only if 0xFFFF - EYE_HALVE_HITS samples come between two plots.
+  * @param  eye: eye diagram
+  * @retval none
+  */
+
+void plotEye(Eye *eye) {
+	const uint16_t *hits = (const uint16_t *)EYE_BUFFER;
+	uint8_t *image = (uint8_t *)EYE_IMAGE;
+	uint32_t x, y, index, count;
+	float32_t scale;
+
+	switchView(EYE_VIEW_EYE);
+	while(eye->max_hits >= EYE_HALVE_HITS)
+		halveHits(eye);
+
+	//Square root of the density so rare paths still show
+	scale = (eye->max_hits > 0) ? 65025.0f/eye->max_hits : 0;
+	for(y = 0; y < EYE_ROWS; y++) {
+		for(x = 0; x < GRAPH_WIDTH; x++) {
+			count = hits[y*GRAPH_WIDTH + x*eye->columns/GRAPH_WIDTH];
+			if(count == 0) {
+				image[y*GRAPH_WIDTH + x] = 0;
+			} else {
+				index = (uint32_t)sqrtf(count*scale);
+				image[y*GRAPH_WIDTH + x] = (index < 1) ? 1 : (index > 255) ? 255 : index;
+			}
+		}
+	}
+	drawImage();
+
+	drawAxes(GRAPH_YCENTRE, HEADER_HEIGHT, GRAPH_VER_END_PIXEL, eye->range, -eye->range, 0,
+					 2*eye->period, FIRST_DATA_PIXEL + GRAPH_WIDTH, WAVE);
+}
+
+/**
+  * @brief  Draw the amplitude histogram, one bar per amplitude bin
+  * @param  eye: eye diagram
+  * @retval none
+  */
+
+void plotHistogram(Eye *eye) {
+	uint8_t *image = (uint8_t *)EYE_IMAGE;
+	uint32_t x, y, height, index;
+	char axes_value[LABEL_MAX_LEN + 1];
+
+	switchView(EYE_VIEW_HISTOGRAM);
+
+	//Bars from the bottom, coloured by their height like the eye density
+	for(x = 0; x < EYE_HIST_BINS; x++) {
+		height = 0;
+		index = 0;
+		if(eye->hist[x] > 0) {
+			height = (uint32_t)(((uint64_t)eye->hist[x]*EYE_ROWS + eye->hist_max - 1)/eye->hist_max);
+			index = 1 + (uint32_t)((uint64_t)eye->hist[x]*254/eye->hist_max);
+		}
+		for(y = 0; y < EYE_ROWS; y++)
+			image[y*GRAPH_WIDTH + x] = (y + height >= EYE_ROWS) ? index : 0;
+	}
+	drawImage();
+
+	BSP_LCD_SetFont(&Font12);
+	BSP_LCD_SetTextColor(TEXT_COLOUR);
+	BSP_LCD_SetBackColor(BACKGROUND_COLOUR);
+	drawLabel(0, 0, "samples", LEFT_MODE);
+	formatInt(axes_value, eye->hist_max);
+	drawLabel(0, HEADER_HEIGHT, axes_value, LEFT_MODE);
+	drawLabel(0, GRAPH_VER_END_PIXEL - 12, "0", LEFT_MODE);
+	drawLabel(20, GRAPH_VER_END_PIXEL - 15, "sample value", RIGHT_MODE);
+
+	formatInt(axes_value, -eye->range);
+	drawLabel(FIRST_DATA_PIXEL, GRAPH_VER_END_PIXEL+2, axes_value, LEFT_MODE);
+	drawLabel(FIRST_DATA_PIXEL + GRAPH_WIDTH/2 - 3, GRAPH_VER_END_PIXEL+2, "0", LEFT_MODE);
+	formatInt(axes_value, eye->range);
+	drawLabel(FIRST_DATA_PIXEL + GRAPH_WIDTH, GRAPH_VER_END_PIXEL+2, axes_value, LEFT_MODE);
+}
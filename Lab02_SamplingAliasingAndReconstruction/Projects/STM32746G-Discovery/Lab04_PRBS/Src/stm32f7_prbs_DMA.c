@@ -9,9 +9,23 @@
 #define AUDIO_FREQ      48000
 #define BUF_LEN         128 
 
+/* Eye diagram, the codec always plays the raw chips */
+#define CHIP_SAMPLES    1       // Samples per PRBS chip, 1 = a new chip every sample
+#define CHANNEL_SHIFT   0       // One pole low-pass channel y += (x - y)/2^CHANNEL_SHIFT in front of the eye, 0 = no channel
+#define EYE_RANGE       10000   // Amplitude at the top and bottom of the graph
+#define RING_LEN        1024u   // Samples waiting for the eye, power of 2
+#define PLOT_PERIOD     100     // Milliseconds between two redraws
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 static int16_t stereo_buf[BUF_LEN * 2];
+static int16_t ring[RING_LEN];
+static volatile uint32_t ring_write = 0;
+static uint32_t ring_read = 0;
+static int16_t chip;
+static uint32_t chip_left = 0;
+static int32_t channel = 0;
+static Eye eye;
 
 /* Private function prototypes -----------------------------------------------*/
 static void MPU_Config(void);
@@ -22,13 +36,22 @@ static void CPU_CACHE_Enable(void);
 /* Private functions ---------------------------------------------------------*/
 static void update_buffer(int start, int end)
 {
+  uint32_t write = ring_write;
+
   for (int i = start; i < end; i++) {
-      int16_t s = prbs(8000); 
-			//  int16_t s = prand();
-      stereo_buf[2*i] = s;
-      stereo_buf[2*i+1] = s;
-      plotSamplesIntr(s,128);
+      if (chip_left == 0) {
+        chip = prbs(8000);
+			  //  chip = prand();
+        chip_left = CHIP_SAMPLES;
+      }
+      chip_left--;
+      stereo_buf[2*i] = chip;
+      stereo_buf[2*i+1] = chip;
+      /* Only the eye sees the channel */
+      channel += (chip - channel) >> CHANNEL_SHIFT;
+      ring[write++ & (RING_LEN - 1)] = (int16_t)channel;
   }
+  ring_write = write;
 }
 
 void BSP_AUDIO_OUT_HalfTransfer_CallBack(void)
@@ -55,6 +78,7 @@ int main(void)
   SystemClock_Config();
 	
 	stm32f7_LCD_init(AUDIO_FREQ, SOURCE_FILE_NAME, GRAPH);
+	eyeInit(&eye, CHIP_SAMPLES, EYE_RANGE);
 
   update_buffer(0, BUF_LEN);
 
@@ -68,9 +92,36 @@ int main(void)
 	if ((BSP_AUDIO_OUT_Play((uint16_t*)stereo_buf, BUF_LEN * sizeof(int16_t))) != AUDIO_OK) {
 		Error_Handler();
 	}
-  /* Infinite loop */
+  /* Infinite loop, the eye is fed from the ring and redrawn every PLOT_PERIOD ms */
+  int histogram = 0;
+  uint32_t last_plot = HAL_GetTick();
   while (1)
   {
+    uint32_t write = ring_write;
+    /* Samples overwritten while the button was held or the graph drawn are skipped */
+    if (write - ring_read > RING_LEN)
+      ring_read = write - RING_LEN;
+    while (ring_read != write)
+    {
+      uint32_t offset = ring_read & (RING_LEN - 1);
+      uint32_t n = write - ring_read;
+      if (n > RING_LEN - offset) n = RING_LEN - offset;
+      eyeAddBlock(&eye, &ring[offset], n);
+      ring_read += n;
+    }
+
+    /* The user button switches between the eye diagram and the histogram */
+    if (CheckForUserInput())
+      histogram = !histogram;
+
+    if (HAL_GetTick() - last_plot >= PLOT_PERIOD)
+    {
+      last_plot = HAL_GetTick();
+      if (histogram)
+        plotHistogram(&eye);
+      else
+        plotEye(&eye);
+    }
   }
 }
 
@@ -0,0 +1,170 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_render.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides the render scheduler. The LTDC line interrupt
+  *					 at the start of vertical blanking decides when the next frame
+  *					 is due, at a fixed frame rate whatever the speed of the main
+  *					 loop. A frame the main loop is too busy to take, or one that
+  *					 would take more than the CPU budget, is dropped rather than
+  *					 queued. The live plot functions draw only between
+  *					 renderBegin() and renderEnd(), which also time each frame.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_render.h"
+
+extern LTDC_HandleTypeDef hLtdcHandler;
+
+static RenderStats render_stats;
+static uint8_t render_running = 0;			//Frames only drawn when due once renderInit() is called
+static __IO uint8_t render_due = 0;			//Set by the line interrupt, taken by renderBegin()
+static uint32_t render_line;						//First line of the vertical blanking
+static uint32_t render_period;					//Cycles per frame at the target rate
+static uint32_t render_next;						//Cycle count the next frame is due at
+static uint32_t render_last_start;			//Start of the last frame
+static uint32_t render_last_cycles = 0;	//Length of the last frame
+static uint32_t render_start;
+static uint32_t render_depth = 0;				//renderBegin() calls not ended yet
+static uint32_t window_start;						//Frames counted for the fps since window_start
+static uint32_t window_frames = 0;
+
+/**
+  * @brief  Start the render scheduler
+  * @param  fps: frames per second, 1 to RENDER_MAX_FPS
+  * @param  budget: percent of the CPU the frames may take, 1 to 100
+  * @retval none
+  */
+
+void renderInit(uint32_t fps, uint32_t budget) {
+	if(fps < 1) fps = 1;
+	if(fps > RENDER_MAX_FPS) fps = RENDER_MAX_FPS;
+	if(budget < 1) budget = 1;
+	if(budget > 100) budget = 100;
+
+	//The cycle counter times the frames
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	render_stats.target_fps = fps;
+	render_stats.budget = budget;
+	render_stats.frames = 0;
+	render_stats.dropped = 0;
+	render_stats.fps = 0;
+	render_stats.render_us = 0;
+	render_stats.max_render_us = 0;
+	render_period = SystemCoreClock/fps;
+	render_next = DWT->CYCCNT;
+	render_last_start = render_next - render_period;
+	render_last_cycles = 0;
+	render_due = 0;
+	window_start = render_next;
+	window_frames = 0;
+
+	render_line = hLtdcHandler.Init.AccumulatedActiveH + 1;
+	HAL_NVIC_SetPriority(LTDC_IRQn, RENDER_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(LTDC_IRQn);
+	render_running = 1;
+	HAL_LTDC_ProgramLineEvent(&hLtdcHandler, render_line);
+}
+
+/**
+  * @brief  Line event, once per panel refresh at the start of vertical blanking
+  * @param  hltdc: LTDC handle
+  * @retval none
+  */
+
+void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef *hltdc) {
+	uint32_t now = DWT->CYCCNT;
+
+	//The HAL turns the line interrupt off before calling back. It is turned on
+	//again in the registers, HAL_LTDC_ProgramLineEvent() would return HAL_BUSY
+	//and leave it off for good when the interrupt lands inside a HAL_LTDC call
+	//of the main loop, e.g. the address change of plotWaterfall()
+	hltdc->Instance->LIPCR = render_line;
+	__HAL_LTDC_ENABLE_IT(hltdc, LTDC_IT_LI);
+	if((int32_t)(now - render_next) < 0)
+		return;
+
+	if(render_due) {
+		//The main loop did not take the last frame, it is busy with the DSP
+		render_stats.dropped++;
+	} else if((uint64_t)render_last_cycles*100 > (uint64_t)render_stats.budget*(now - render_last_start)) {
+		//The last frame was too long for the budget, skip until it is paid for
+		render_stats.dropped++;
+	} else {
+		render_due = 1;
+	}
+
+	//Start again from now after a stall rather than catching up
+	render_next += render_period;
+	if((int32_t)(now - render_next) >= 0)
+		render_next = now + render_period;
+}
+
+/**
+  * @brief  Start a frame if one is due, calls can nest, e.g. a plot function
+  *					inside a frame the application started itself
+  * @param  none
+  * @retval 1 when the caller draws now and then calls renderEnd(), 0 when no
+  *					frame is due and nothing is drawn. Before renderInit() every
+  *					call draws.
+  */
+
+int renderBegin(void) {
+	if(render_depth > 0) {
+		render_depth++;
+		return 1;
+	}
+	if(render_running) {
+		if(!render_due)
+			return 0;
+		render_due = 0;
+	}
+	render_depth = 1;
+	render_start = DWT->CYCCNT;
+	return 1;
+}
+
+/**
+  * @brief  End the frame started by renderBegin() and time it
+  * @param  none
+  * @retval none
+  */
+
+void renderEnd(void) {
+	uint32_t now, elapsed;
+
+	if(render_depth == 0 || --render_depth > 0)
+		return;
+
+	now = DWT->CYCCNT;
+	render_last_start = render_start;
+	render_last_cycles = now - render_start;
+	render_stats.render_us = render_last_cycles/(SystemCoreClock/1000000u);
+	if(render_stats.render_us > render_stats.max_render_us)
+		render_stats.max_render_us = render_stats.render_us;
+	render_stats.frames++;
+
+	//Frame rate over about one second
+	window_frames++;
+	elapsed = now - window_start;
+	if(elapsed >= SystemCoreClock) {
+		render_stats.fps = (float32_t)window_frames*SystemCoreClock/elapsed;
+		window_start = now;
+		window_frames = 0;
+	}
+}
+
+/**
+  * @brief  Get the frame counts and times
+  * @param  stats: copy of the statistics
+  * @retval none
+  */
+
+void renderGetStats(RenderStats *stats) {
+	*stats = render_stats;
+}
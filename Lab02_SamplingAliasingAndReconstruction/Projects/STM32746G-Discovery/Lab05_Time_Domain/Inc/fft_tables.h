@@ -0,0 +1,1733 @@
+/**
+  ******************************************************************************
+  * @file    fft_tables.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Twiddle and bit reversal tables of stm32f7_fft.c for real FFTs
+  *          of up to 4096 points. Generated by Utilities/Host/fftgen.c,
+  *          don't edit.
+  ******************************************************************************
+  */
+
+//cos(2*pi*k/4096), -sin(2*pi*k/4096) is 1024 entries further on
+static float32_t fft_cos[4096] FFT_TABLE_SECTION = {
+  1.000000000e+00f, 9.999988235e-01f, 9.999952938e-01f, 9.999894111e-01f, 9.999811753e-01f, 9.999705864e-01f,
+  9.999576446e-01f, 9.999423497e-01f, 9.999247018e-01f, 9.999047011e-01f, 9.998823475e-01f, 9.998576410e-01f,
+  9.998305818e-01f, 9.998011699e-01f, 9.997694054e-01f, 9.997352883e-01f, 9.996988187e-01f, 9.996599967e-01f,
+  9.996188225e-01f, 9.995752960e-01f, 9.995294175e-01f, 9.994811870e-01f, 9.994306046e-01f, 9.993776704e-01f,
+  9.993223846e-01f, 9.992647473e-01f, 9.992047586e-01f, 9.991424187e-01f, 9.990777278e-01f, 9.990106859e-01f,
+  9.989412932e-01f, 9.988695499e-01f, 9.987954562e-01f, 9.987190122e-01f, 9.986402182e-01f, 9.985590742e-01f,
+  9.984755806e-01f, 9.983897374e-01f, 9.983015449e-01f, 9.982110034e-01f, 9.981181129e-01f, 9.980228738e-01f,
+  9.979252862e-01f, 9.978253504e-01f, 9.977230666e-01f, 9.976184351e-01f, 9.975114561e-01f, 9.974021299e-01f,
+  9.972904567e-01f, 9.971764367e-01f, 9.970600703e-01f, 9.969413578e-01f, 9.968202993e-01f, 9.966968952e-01f,
+  9.965711458e-01f, 9.964430514e-01f, 9.963126122e-01f, 9.961798286e-01f, 9.960447009e-01f, 9.959072294e-01f,
+  9.957674145e-01f, 9.956252564e-01f, 9.954807555e-01f, 9.953339121e-01f, 9.951847267e-01f, 9.950331994e-01f,
+  9.948793308e-01f, 9.947231211e-01f, 9.945645707e-01f, 9.944036801e-01f, 9.942404495e-01f, 9.940748793e-01f,
+  9.939069700e-01f, 9.937367219e-01f, 9.935641355e-01f, 9.933892111e-01f, 9.932119492e-01f, 9.930323502e-01f,
+  9.928504145e-01f, 9.926661424e-01f, 9.924795346e-01f, 9.922905913e-01f, 9.920993131e-01f, 9.919057004e-01f,
+  9.917097537e-01f, 9.915114733e-01f, 9.913108598e-01f, 9.911079137e-01f, 9.909026354e-01f, 9.906950254e-01f,
+  9.904850843e-01f, 9.902728124e-01f, 9.900582103e-01f, 9.898412785e-01f, 9.896220175e-01f, 9.894004278e-01f,
+  9.891765100e-01f, 9.889502645e-01f, 9.887216920e-01f, 9.884907929e-01f, 9.882575677e-01f, 9.880220171e-01f,
+  9.877841416e-01f, 9.875439418e-01f, 9.873014182e-01f, 9.870565713e-01f, 9.868094018e-01f, 9.865599103e-01f,
+  9.863080972e-01f, 9.860539633e-01f, 9.857975092e-01f, 9.855387353e-01f, 9.852776424e-01f, 9.850142310e-01f,
+  9.847485018e-01f, 9.844804554e-01f, 9.842100924e-01f, 9.839374134e-01f, 9.836624192e-01f, 9.833851103e-01f,
+  9.831054874e-01f, 9.828235512e-01f, 9.825393023e-01f, 9.822527414e-01f, 9.819638691e-01f, 9.816726862e-01f,
+  9.813791933e-01f, 9.810833912e-01f, 9.807852804e-01f, 9.804848618e-01f, 9.801821360e-01f, 9.798771037e-01f,
+  9.795697657e-01f, 9.792601226e-01f, 9.789481753e-01f, 9.786339244e-01f, 9.783173707e-01f, 9.779985149e-01f,
+  9.776773578e-01f, 9.773539001e-01f, 9.770281427e-01f, 9.767000861e-01f, 9.763697313e-01f, 9.760370790e-01f,
+  9.757021300e-01f, 9.753648851e-01f, 9.750253451e-01f, 9.746835107e-01f, 9.743393828e-01f, 9.739929622e-01f,
+  9.736442497e-01f, 9.732932461e-01f, 9.729399522e-01f, 9.725843689e-01f, 9.722264971e-01f, 9.718663375e-01f,
+  9.715038910e-01f, 9.711391584e-01f, 9.707721407e-01f, 9.704028387e-01f, 9.700312532e-01f, 9.696573851e-01f,
+  9.692812354e-01f, 9.689028048e-01f, 9.685220943e-01f, 9.681391047e-01f, 9.677538371e-01f, 9.673662922e-01f,
+  9.669764710e-01f, 9.665843745e-01f, 9.661900034e-01f, 9.657933589e-01f, 9.653944417e-01f, 9.649932529e-01f,
+  9.645897933e-01f, 9.641840640e-01f, 9.637760658e-01f, 9.633657998e-01f, 9.629532669e-01f, 9.625384680e-01f,
+  9.621214043e-01f, 9.617020765e-01f, 9.612804858e-01f, 9.608566331e-01f, 9.604305194e-01f, 9.600021457e-01f,
+  9.595715131e-01f, 9.591386225e-01f, 9.587034749e-01f, 9.582660714e-01f, 9.578264130e-01f, 9.573845008e-01f,
+  9.569403357e-01f, 9.564939189e-01f, 9.560452513e-01f, 9.555943341e-01f, 9.551411683e-01f, 9.546857549e-01f,
+  9.542280951e-01f, 9.537681899e-01f, 9.533060404e-01f, 9.528416476e-01f, 9.523750127e-01f, 9.519061368e-01f,
+  9.514350210e-01f, 9.509616663e-01f, 9.504860739e-01f, 9.500082450e-01f, 9.495281806e-01f, 9.490458819e-01f,
+  9.485613499e-01f, 9.480745859e-01f, 9.475855910e-01f, 9.470943664e-01f, 9.466009131e-01f, 9.461052324e-01f,
+  9.456073254e-01f, 9.451071933e-01f, 9.446048373e-01f, 9.441002585e-01f, 9.435934582e-01f, 9.430844375e-01f,
+  9.425731976e-01f, 9.420597398e-01f, 9.415440652e-01f, 9.410261751e-01f, 9.405060706e-01f, 9.399837530e-01f,
+  9.394592236e-01f, 9.389324835e-01f, 9.384035341e-01f, 9.378723764e-01f, 9.373390119e-01f, 9.368034417e-01f,
+  9.362656672e-01f, 9.357256895e-01f, 9.351835099e-01f, 9.346391298e-01f, 9.340925504e-01f, 9.335437730e-01f,
+  9.329927988e-01f, 9.324396293e-01f, 9.318842656e-01f, 9.313267091e-01f, 9.307669611e-01f, 9.302050229e-01f,
+  9.296408958e-01f, 9.290745813e-01f, 9.285060805e-01f, 9.279353948e-01f, 9.273625257e-01f, 9.267874743e-01f,
+  9.262102421e-01f, 9.256308305e-01f, 9.250492408e-01f, 9.244654743e-01f, 9.238795325e-01f, 9.232914167e-01f,
+  9.227011283e-01f, 9.221086687e-01f, 9.215140393e-01f, 9.209172415e-01f, 9.203182767e-01f, 9.197171463e-01f,
+  9.191138517e-01f, 9.185083943e-01f, 9.179007756e-01f, 9.172909970e-01f, 9.166790599e-01f, 9.160649658e-01f,
+  9.154487161e-01f, 9.148303122e-01f, 9.142097557e-01f, 9.135870479e-01f, 9.129621904e-01f, 9.123351846e-01f,
+  9.117060320e-01f, 9.110747341e-01f, 9.104412923e-01f, 9.098057081e-01f, 9.091679831e-01f, 9.085281187e-01f,
+  9.078861165e-01f, 9.072419779e-01f, 9.065957045e-01f, 9.059472978e-01f, 9.052967593e-01f, 9.046440906e-01f,
+  9.039892931e-01f, 9.033323685e-01f, 9.026733182e-01f, 9.020121439e-01f, 9.013488470e-01f, 9.006834292e-01f,
+  9.000158920e-01f, 8.993462370e-01f, 8.986744657e-01f, 8.980005797e-01f, 8.973245807e-01f, 8.966464702e-01f,
+  8.959662498e-01f, 8.952839210e-01f, 8.945994856e-01f, 8.939129451e-01f, 8.932243012e-01f, 8.925335554e-01f,
+  8.918407094e-01f, 8.911457648e-01f, 8.904487232e-01f, 8.897495864e-01f, 8.890483559e-01f, 8.883450333e-01f,
+  8.876396204e-01f, 8.869321188e-01f, 8.862225301e-01f, 8.855108561e-01f, 8.847970984e-01f, 8.840812587e-01f,
+  8.833633387e-01f, 8.826433400e-01f, 8.819212643e-01f, 8.811971135e-01f, 8.804708891e-01f, 8.797425928e-01f,
+  8.790122264e-01f, 8.782797917e-01f, 8.775452902e-01f, 8.768087238e-01f, 8.760700942e-01f, 8.753294031e-01f,
+  8.745866523e-01f, 8.738418435e-01f, 8.730949784e-01f, 8.723460589e-01f, 8.715950867e-01f, 8.708420635e-01f,
+  8.700869911e-01f, 8.693298713e-01f, 8.685707060e-01f, 8.678094968e-01f, 8.670462455e-01f, 8.662809540e-01f,
+  8.655136241e-01f, 8.647442575e-01f, 8.639728561e-01f, 8.631994217e-01f, 8.624239561e-01f, 8.616464611e-01f,
+  8.608669386e-01f, 8.600853904e-01f, 8.593018184e-01f, 8.585162243e-01f, 8.577286100e-01f, 8.569389774e-01f,
+  8.561473284e-01f, 8.553536647e-01f, 8.545579884e-01f, 8.537603011e-01f, 8.529606049e-01f, 8.521589016e-01f,
+  8.513551931e-01f, 8.505494813e-01f, 8.497417680e-01f, 8.489320552e-01f, 8.481203448e-01f, 8.473066387e-01f,
+  8.464909388e-01f, 8.456732470e-01f, 8.448535652e-01f, 8.440318955e-01f, 8.432082396e-01f, 8.423825996e-01f,
+  8.415549774e-01f, 8.407253750e-01f, 8.398937942e-01f, 8.390602371e-01f, 8.382247056e-01f, 8.373872016e-01f,
+  8.365477272e-01f, 8.357062844e-01f, 8.348628750e-01f, 8.340175011e-01f, 8.331701647e-01f, 8.323208678e-01f,
+  8.314696123e-01f, 8.306164003e-01f, 8.297612338e-01f, 8.289041148e-01f, 8.280450453e-01f, 8.271840273e-01f,
+  8.263210628e-01f, 8.254561540e-01f, 8.245893028e-01f, 8.237205112e-01f, 8.228497814e-01f, 8.219771153e-01f,
+  8.211025150e-01f, 8.202259826e-01f, 8.193475201e-01f, 8.184671296e-01f, 8.175848132e-01f, 8.167005729e-01f,
+  8.158144108e-01f, 8.149263291e-01f, 8.140363297e-01f, 8.131444148e-01f, 8.122505866e-01f, 8.113548470e-01f,
+  8.104571983e-01f, 8.095576424e-01f, 8.086561816e-01f, 8.077528179e-01f, 8.068475535e-01f, 8.059403906e-01f,
+  8.050313311e-01f, 8.041203774e-01f, 8.032075315e-01f, 8.022927955e-01f, 8.013761717e-01f, 8.004576622e-01f,
+  7.995372691e-01f, 7.986149946e-01f, 7.976908409e-01f, 7.967648102e-01f, 7.958369046e-01f, 7.949071263e-01f,
+  7.939754776e-01f, 7.930419605e-01f, 7.921065773e-01f, 7.911693302e-01f, 7.902302214e-01f, 7.892892532e-01f,
+  7.883464276e-01f, 7.874017470e-01f, 7.864552136e-01f, 7.855068296e-01f, 7.845565972e-01f, 7.836045186e-01f,
+  7.826505962e-01f, 7.816948321e-01f, 7.807372286e-01f, 7.797777879e-01f, 7.788165124e-01f, 7.778534042e-01f,
+  7.768884657e-01f, 7.759216990e-01f, 7.749531066e-01f, 7.739826906e-01f, 7.730104534e-01f, 7.720363972e-01f,
+  7.710605243e-01f, 7.700828370e-01f, 7.691033376e-01f, 7.681220285e-01f, 7.671389119e-01f, 7.661539902e-01f,
+  7.651672656e-01f, 7.641787405e-01f, 7.631884173e-01f, 7.621962981e-01f, 7.612023855e-01f, 7.602066817e-01f,
+  7.592091890e-01f, 7.582099098e-01f, 7.572088465e-01f, 7.562060014e-01f, 7.552013769e-01f, 7.541949753e-01f,
+  7.531867990e-01f, 7.521768504e-01f, 7.511651319e-01f, 7.501516458e-01f, 7.491363945e-01f, 7.481193805e-01f,
+  7.471006060e-01f, 7.460800735e-01f, 7.450577854e-01f, 7.440337442e-01f, 7.430079521e-01f, 7.419804117e-01f,
+  7.409511254e-01f, 7.399200955e-01f, 7.388873245e-01f, 7.378528148e-01f, 7.368165689e-01f, 7.357785892e-01f,
+  7.347388781e-01f, 7.336974381e-01f, 7.326542717e-01f, 7.316093812e-01f, 7.305627692e-01f, 7.295144381e-01f,
+  7.284643904e-01f, 7.274126286e-01f, 7.263591551e-01f, 7.253039724e-01f, 7.242470830e-01f, 7.231884893e-01f,
+  7.221281939e-01f, 7.210661993e-01f, 7.200025080e-01f, 7.189371224e-01f, 7.178700451e-01f, 7.168012785e-01f,
+  7.157308253e-01f, 7.146586879e-01f, 7.135848688e-01f, 7.125093706e-01f, 7.114321957e-01f, 7.103533469e-01f,
+  7.092728264e-01f, 7.081906370e-01f, 7.071067812e-01f, 7.060212614e-01f, 7.049340804e-01f, 7.038452405e-01f,
+  7.027547445e-01f, 7.016625947e-01f, 7.005687939e-01f, 6.994733446e-01f, 6.983762494e-01f, 6.972775108e-01f,
+  6.961771315e-01f, 6.950751140e-01f, 6.939714609e-01f, 6.928661748e-01f, 6.917592584e-01f, 6.906507141e-01f,
+  6.895405447e-01f, 6.884287528e-01f, 6.873153409e-01f, 6.862003117e-01f, 6.850836678e-01f, 6.839654118e-01f,
+  6.828455464e-01f, 6.817240742e-01f, 6.806009978e-01f, 6.794763199e-01f, 6.783500431e-01f, 6.772221701e-01f,
+  6.760927036e-01f, 6.749616461e-01f, 6.738290004e-01f, 6.726947691e-01f, 6.715589548e-01f, 6.704215604e-01f,
+  6.692825883e-01f, 6.681420414e-01f, 6.669999223e-01f, 6.658562337e-01f, 6.647109782e-01f, 6.635641586e-01f,
+  6.624157776e-01f, 6.612658378e-01f, 6.601143421e-01f, 6.589612930e-01f, 6.578066933e-01f, 6.566505457e-01f,
+  6.554928530e-01f, 6.543336178e-01f, 6.531728430e-01f, 6.520105311e-01f, 6.508466850e-01f, 6.496813074e-01f,
+  6.485144010e-01f, 6.473459686e-01f, 6.461760130e-01f, 6.450045368e-01f, 6.438315429e-01f, 6.426570340e-01f,
+  6.414810128e-01f, 6.403034822e-01f, 6.391244449e-01f, 6.379439036e-01f, 6.367618612e-01f, 6.355783205e-01f,
+  6.343932842e-01f, 6.332067551e-01f, 6.320187359e-01f, 6.308292296e-01f, 6.296382389e-01f, 6.284457666e-01f,
+  6.272518155e-01f, 6.260563884e-01f, 6.248594881e-01f, 6.236611175e-01f, 6.224612794e-01f, 6.212599765e-01f,
+  6.200572118e-01f, 6.188529880e-01f, 6.176473079e-01f, 6.164401745e-01f, 6.152315906e-01f, 6.140215589e-01f,
+  6.128100824e-01f, 6.115971639e-01f, 6.103828063e-01f, 6.091670123e-01f, 6.079497850e-01f, 6.067311270e-01f,
+  6.055110414e-01f, 6.042895309e-01f, 6.030665985e-01f, 6.018422471e-01f, 6.006164794e-01f, 5.993892984e-01f,
+  5.981607070e-01f, 5.969307081e-01f, 5.956993045e-01f, 5.944664992e-01f, 5.932322950e-01f, 5.919966950e-01f,
+  5.907597019e-01f, 5.895213186e-01f, 5.882815482e-01f, 5.870403935e-01f, 5.857978575e-01f, 5.845539430e-01f,
+  5.833086529e-01f, 5.820619903e-01f, 5.808139581e-01f, 5.795645591e-01f, 5.783137964e-01f, 5.770616729e-01f,
+  5.758081914e-01f, 5.745533550e-01f, 5.732971667e-01f, 5.720396293e-01f, 5.707807459e-01f, 5.695205193e-01f,
+  5.682589527e-01f, 5.669960488e-01f, 5.657318108e-01f, 5.644662415e-01f, 5.631993440e-01f, 5.619311212e-01f,
+  5.606615762e-01f, 5.593907119e-01f, 5.581185312e-01f, 5.568450373e-01f, 5.555702330e-01f, 5.542941215e-01f,
+  5.530167056e-01f, 5.517379884e-01f, 5.504579729e-01f, 5.491766622e-01f, 5.478940592e-01f, 5.466101669e-01f,
+  5.453249884e-01f, 5.440385267e-01f, 5.427507849e-01f, 5.414617659e-01f, 5.401714727e-01f, 5.388799085e-01f,
+  5.375870763e-01f, 5.362929791e-01f, 5.349976199e-01f, 5.337010018e-01f, 5.324031279e-01f, 5.311040012e-01f,
+  5.298036247e-01f, 5.285020015e-01f, 5.271991348e-01f, 5.258950275e-01f, 5.245896827e-01f, 5.232831035e-01f,
+  5.219752929e-01f, 5.206662541e-01f, 5.193559902e-01f, 5.180445041e-01f, 5.167317990e-01f, 5.154178780e-01f,
+  5.141027442e-01f, 5.127864006e-01f, 5.114688504e-01f, 5.101500967e-01f, 5.088301425e-01f, 5.075089911e-01f,
+  5.061866453e-01f, 5.048631085e-01f, 5.035383837e-01f, 5.022124740e-01f, 5.008853826e-01f, 4.995571125e-01f,
+  4.982276670e-01f, 4.968970490e-01f, 4.955652618e-01f, 4.942323085e-01f, 4.928981922e-01f, 4.915629161e-01f,
+  4.902264833e-01f, 4.888888969e-01f, 4.875501601e-01f, 4.862102761e-01f, 4.848692480e-01f, 4.835270789e-01f,
+  4.821837721e-01f, 4.808393306e-01f, 4.794937577e-01f, 4.781470564e-01f, 4.767992301e-01f, 4.754502817e-01f,
+  4.741002147e-01f, 4.727490320e-01f, 4.713967368e-01f, 4.700433325e-01f, 4.686888220e-01f, 4.673332087e-01f,
+  4.659764958e-01f, 4.646186863e-01f, 4.632597836e-01f, 4.618997907e-01f, 4.605387110e-01f, 4.591765475e-01f,
+  4.578133036e-01f, 4.564489824e-01f, 4.550835871e-01f, 4.537171210e-01f, 4.523495872e-01f, 4.509809890e-01f,
+  4.496113297e-01f, 4.482406123e-01f, 4.468688402e-01f, 4.454960165e-01f, 4.441221446e-01f, 4.427472276e-01f,
+  4.413712687e-01f, 4.399942713e-01f, 4.386162385e-01f, 4.372371737e-01f, 4.358570799e-01f, 4.344759606e-01f,
+  4.330938189e-01f, 4.317106580e-01f, 4.303264813e-01f, 4.289412921e-01f, 4.275550934e-01f, 4.261678887e-01f,
+  4.247796812e-01f, 4.233904741e-01f, 4.220002708e-01f, 4.206090744e-01f, 4.192168884e-01f, 4.178237158e-01f,
+  4.164295601e-01f, 4.150344245e-01f, 4.136383122e-01f, 4.122412267e-01f, 4.108431711e-01f, 4.094441487e-01f,
+  4.080441629e-01f, 4.066432169e-01f, 4.052413140e-01f, 4.038384576e-01f, 4.024346509e-01f, 4.010298972e-01f,
+  3.996241998e-01f, 3.982175622e-01f, 3.968099874e-01f, 3.954014789e-01f, 3.939920401e-01f, 3.925816741e-01f,
+  3.911703843e-01f, 3.897581741e-01f, 3.883450467e-01f, 3.869310055e-01f, 3.855160538e-01f, 3.841001950e-01f,
+  3.826834324e-01f, 3.812657692e-01f, 3.798472089e-01f, 3.784277548e-01f, 3.770074102e-01f, 3.755861785e-01f,
+  3.741640630e-01f, 3.727410670e-01f, 3.713171940e-01f, 3.698924471e-01f, 3.684668300e-01f, 3.670403457e-01f,
+  3.656129978e-01f, 3.641847896e-01f, 3.627557244e-01f, 3.613258056e-01f, 3.598950365e-01f, 3.584634206e-01f,
+  3.570309612e-01f, 3.555976617e-01f, 3.541635254e-01f, 3.527285558e-01f, 3.512927561e-01f, 3.498561298e-01f,
+  3.484186802e-01f, 3.469804108e-01f, 3.455413250e-01f, 3.441014260e-01f, 3.426607173e-01f, 3.412192023e-01f,
+  3.397768844e-01f, 3.383337670e-01f, 3.368898534e-01f, 3.354451471e-01f, 3.339996514e-01f, 3.325533699e-01f,
+  3.311063058e-01f, 3.296584625e-01f, 3.282098436e-01f, 3.267604523e-01f, 3.253102922e-01f, 3.238593665e-01f,
+  3.224076788e-01f, 3.209552324e-01f, 3.195020308e-01f, 3.180480774e-01f, 3.165933756e-01f, 3.151379288e-01f,
+  3.136817404e-01f, 3.122248139e-01f, 3.107671527e-01f, 3.093087603e-01f, 3.078496400e-01f, 3.063897954e-01f,
+  3.049292297e-01f, 3.034679466e-01f, 3.020059493e-01f, 3.005432414e-01f, 2.990798263e-01f, 2.976157074e-01f,
+  2.961508882e-01f, 2.946853722e-01f, 2.932191627e-01f, 2.917522632e-01f, 2.902846773e-01f, 2.888164082e-01f,
+  2.873474595e-01f, 2.858778347e-01f, 2.844075372e-01f, 2.829365705e-01f, 2.814649379e-01f, 2.799926431e-01f,
+  2.785196894e-01f, 2.770460803e-01f, 2.755718193e-01f, 2.740969099e-01f, 2.726213554e-01f, 2.711451595e-01f,
+  2.696683256e-01f, 2.681908571e-01f, 2.667127575e-01f, 2.652340303e-01f, 2.637546790e-01f, 2.622747070e-01f,
+  2.607941179e-01f, 2.593129151e-01f, 2.578311022e-01f, 2.563486825e-01f, 2.548656596e-01f, 2.533820370e-01f,
+  2.518978182e-01f, 2.504130066e-01f, 2.489276057e-01f, 2.474416192e-01f, 2.459550503e-01f, 2.444679027e-01f,
+  2.429801799e-01f, 2.414918853e-01f, 2.400030224e-01f, 2.385135948e-01f, 2.370236060e-01f, 2.355330594e-01f,
+  2.340419586e-01f, 2.325503070e-01f, 2.310581083e-01f, 2.295653658e-01f, 2.280720832e-01f, 2.265782638e-01f,
+  2.250839114e-01f, 2.235890292e-01f, 2.220936210e-01f, 2.205976901e-01f, 2.191012402e-01f, 2.176042746e-01f,
+  2.161067971e-01f, 2.146088110e-01f, 2.131103199e-01f, 2.116113274e-01f, 2.101118369e-01f, 2.086118520e-01f,
+  2.071113762e-01f, 2.056104131e-01f, 2.041089661e-01f, 2.026070388e-01f, 2.011046348e-01f, 1.996017576e-01f,
+  1.980984107e-01f, 1.965945977e-01f, 1.950903220e-01f, 1.935855873e-01f, 1.920803970e-01f, 1.905747548e-01f,
+  1.890686641e-01f, 1.875621286e-01f, 1.860551517e-01f, 1.845477369e-01f, 1.830398880e-01f, 1.815316083e-01f,
+  1.800229014e-01f, 1.785137709e-01f, 1.770042204e-01f, 1.754942534e-01f, 1.739838734e-01f, 1.724730840e-01f,
+  1.709618888e-01f, 1.694502912e-01f, 1.679382950e-01f, 1.664259035e-01f, 1.649131205e-01f, 1.633999494e-01f,
+  1.618863938e-01f, 1.603724572e-01f, 1.588581433e-01f, 1.573434556e-01f, 1.558283977e-01f, 1.543129730e-01f,
+  1.527971853e-01f, 1.512810380e-01f, 1.497645347e-01f, 1.482476790e-01f, 1.467304745e-01f, 1.452129247e-01f,
+  1.436950332e-01f, 1.421768035e-01f, 1.406582393e-01f, 1.391393442e-01f, 1.376201216e-01f, 1.361005752e-01f,
+  1.345807085e-01f, 1.330605252e-01f, 1.315400287e-01f, 1.300192227e-01f, 1.284981108e-01f, 1.269766965e-01f,
+  1.254549834e-01f, 1.239329751e-01f, 1.224106752e-01f, 1.208880872e-01f, 1.193652148e-01f, 1.178420615e-01f,
+  1.163186309e-01f, 1.147949266e-01f, 1.132709522e-01f, 1.117467112e-01f, 1.102222073e-01f, 1.086974440e-01f,
+  1.071724250e-01f, 1.056471537e-01f, 1.041216339e-01f, 1.025958690e-01f, 1.010698628e-01f, 9.954361866e-02f,
+  9.801714033e-02f, 9.649043136e-02f, 9.496349533e-02f, 9.343633585e-02f, 9.190895650e-02f, 9.038136088e-02f,
+  8.885355258e-02f, 8.732553521e-02f, 8.579731234e-02f, 8.426888759e-02f, 8.274026455e-02f, 8.121144681e-02f,
+  7.968243797e-02f, 7.815324163e-02f, 7.662386139e-02f, 7.509430085e-02f, 7.356456360e-02f, 7.203465325e-02f,
+  7.050457339e-02f, 6.897432763e-02f, 6.744391956e-02f, 6.591335280e-02f, 6.438263093e-02f, 6.285175756e-02f,
+  6.132073630e-02f, 5.978957075e-02f, 5.825826450e-02f, 5.672682117e-02f, 5.519524435e-02f, 5.366353765e-02f,
+  5.213170468e-02f, 5.059974904e-02f, 4.906767433e-02f, 4.753548416e-02f, 4.600318213e-02f, 4.447077185e-02f,
+  4.293825693e-02f, 4.140564098e-02f, 3.987292759e-02f, 3.834012037e-02f, 3.680722294e-02f, 3.527423890e-02f,
+  3.374117185e-02f, 3.220802541e-02f, 3.067480318e-02f, 2.914150876e-02f, 2.760814578e-02f, 2.607471783e-02f,
+  2.454122852e-02f, 2.300768147e-02f, 2.147408028e-02f, 1.994042855e-02f, 1.840672991e-02f, 1.687298795e-02f,
+  1.533920628e-02f, 1.380538853e-02f, 1.227153829e-02f, 1.073765917e-02f, 9.203754782e-03f, 7.669828740e-03f,
+  6.135884649e-03f, 4.601926120e-03f, 3.067956763e-03f, 1.533980186e-03f, 6.123233996e-17f, -1.533980186e-03f,
+  -3.067956763e-03f, -4.601926120e-03f, -6.135884649e-03f, -7.669828740e-03f, -9.203754782e-03f, -1.073765917e-02f,
+  -1.227153829e-02f, -1.380538853e-02f, -1.533920628e-02f, -1.687298795e-02f, -1.840672991e-02f, -1.994042855e-02f,
+  -2.147408028e-02f, -2.300768147e-02f, -2.454122852e-02f, -2.607471783e-02f, -2.760814578e-02f, -2.914150876e-02f,
+  -3.067480318e-02f, -3.220802541e-02f, -3.374117185e-02f, -3.527423890e-02f, -3.680722294e-02f, -3.834012037e-02f,
+  -3.987292759e-02f, -4.140564098e-02f, -4.293825693e-02f, -4.447077185e-02f, -4.600318213e-02f, -4.753548416e-02f,
+  -4.906767433e-02f, -5.059974904e-02f, -5.213170468e-02f, -5.366353765e-02f, -5.519524435e-02f, -5.672682117e-02f,
+  -5.825826450e-02f, -5.978957075e-02f, -6.132073630e-02f, -6.285175756e-02f, -6.438263093e-02f, -6.591335280e-02f,
+  -6.744391956e-02f, -6.897432763e-02f, -7.050457339e-02f, -7.203465325e-02f, -7.356456360e-02f, -7.509430085e-02f,
+  -7.662386139e-02f, -7.815324163e-02f, -7.968243797e-02f, -8.121144681e-02f, -8.274026455e-02f, -8.426888759e-02f,
+  -8.579731234e-02f, -8.732553521e-02f, -8.885355258e-02f, -9.038136088e-02f, -9.190895650e-02f, -9.343633585e-02f,
+  -9.496349533e-02f, -9.649043136e-02f, -9.801714033e-02f, -9.954361866e-02f, -1.010698628e-01f, -1.025958690e-01f,
+  -1.041216339e-01f, -1.056471537e-01f, -1.071724250e-01f, -1.086974440e-01f, -1.102222073e-01f, -1.117467112e-01f,
+  -1.132709522e-01f, -1.147949266e-01f, -1.163186309e-01f, -1.178420615e-01f, -1.193652148e-01f, -1.208880872e-01f,
+  -1.224106752e-01f, -1.239329751e-01f, -1.254549834e-01f, -1.269766965e-01f, -1.284981108e-01f, -1.300192227e-01f,
+  -1.315400287e-01f, -1.330605252e-01f, -1.345807085e-01f, -1.361005752e-01f, -1.376201216e-01f, -1.391393442e-01f,
+  -1.406582393e-01f, -1.421768035e-01f, -1.436950332e-01f, -1.452129247e-01f, -1.467304745e-01f, -1.482476790e-01f,
+  -1.497645347e-01f, -1.512810380e-01f, -1.527971853e-01f, -1.543129730e-01f, -1.558283977e-01f, -1.573434556e-01f,
+  -1.588581433e-01f, -1.603724572e-01f, -1.618863938e-01f, -1.633999494e-01f, -1.649131205e-01f, -1.664259035e-01f,
+  -1.679382950e-01f, -1.694502912e-01f, -1.709618888e-01f, -1.724730840e-01f, -1.739838734e-01f, -1.754942534e-01f,
+  -1.770042204e-01f, -1.785137709e-01f, -1.800229014e-01f, -1.815316083e-01f, -1.830398880e-01f, -1.845477369e-01f,
+  -1.860551517e-01f, -1.875621286e-01f, -1.890686641e-01f, -1.905747548e-01f, -1.920803970e-01f, -1.935855873e-01f,
+  -1.950903220e-01f, -1.965945977e-01f, -1.980984107e-01f, -1.996017576e-01f, -2.011046348e-01f, -2.026070388e-01f,
+  -2.041089661e-01f, -2.056104131e-01f, -2.071113762e-01f, -2.086118520e-01f, -2.101118369e-01f, -2.116113274e-01f,
+  -2.131103199e-01f, -2.146088110e-01f, -2.161067971e-01f, -2.176042746e-01f, -2.191012402e-01f, -2.205976901e-01f,
+  -2.220936210e-01f, -2.235890292e-01f, -2.250839114e-01f, -2.265782638e-01f, -2.280720832e-01f, -2.295653658e-01f,
+  -2.310581083e-01f, -2.325503070e-01f, -2.340419586e-01f, -2.355330594e-01f, -2.370236060e-01f, -2.385135948e-01f,
+  -2.400030224e-01f, -2.414918853e-01f, -2.429801799e-01f, -2.444679027e-01f, -2.459550503e-01f, -2.474416192e-01f,
+  -2.489276057e-01f, -2.504130066e-01f, -2.518978182e-01f, -2.533820370e-01f, -2.548656596e-01f, -2.563486825e-01f,
+  -2.578311022e-01f, -2.593129151e-01f, -2.607941179e-01f, -2.622747070e-01f, -2.637546790e-01f, -2.652340303e-01f,
+  -2.667127575e-01f, -2.681908571e-01f, -2.696683256e-01f, -2.711451595e-01f, -2.726213554e-01f, -2.740969099e-01f,
+  -2.755718193e-01f, -2.770460803e-01f, -2.785196894e-01f, -2.799926431e-01f, -2.814649379e-01f, -2.829365705e-01f,
+  -2.844075372e-01f, -2.858778347e-01f, -2.873474595e-01f, -2.888164082e-01f, -2.902846773e-01f, -2.917522632e-01f,
+  -2.932191627e-01f, -2.946853722e-01f, -2.961508882e-01f, -2.976157074e-01f, -2.990798263e-01f, -3.005432414e-01f,
+  -3.020059493e-01f, -3.034679466e-01f, -3.049292297e-01f, -3.063897954e-01f, -3.078496400e-01f, -3.093087603e-01f,
+  -3.107671527e-01f, -3.122248139e-01f, -3.136817404e-01f, -3.151379288e-01f, -3.165933756e-01f, -3.180480774e-01f,
+  -3.195020308e-01f, -3.209552324e-01f, -3.224076788e-01f, -3.238593665e-01f, -3.253102922e-01f, -3.267604523e-01f,
+  -3.282098436e-01f, -3.296584625e-01f, -3.311063058e-01f, -3.325533699e-01f, -3.339996514e-01f, -3.354451471e-01f,
+  -3.368898534e-01f, -3.383337670e-01f, -3.397768844e-01f, -3.412192023e-01f, -3.426607173e-01f, -3.441014260e-01f,
+  -3.455413250e-01f, -3.469804108e-01f, -3.484186802e-01f, -3.498561298e-01f, -3.512927561e-01f, -3.527285558e-01f,
+  -3.541635254e-01f, -3.555976617e-01f, -3.570309612e-01f, -3.584634206e-01f, -3.598950365e-01f, -3.613258056e-01f,
+  -3.627557244e-01f, -3.641847896e-01f, -3.656129978e-01f, -3.670403457e-01f, -3.684668300e-01f, -3.698924471e-01f,
+  -3.713171940e-01f, -3.727410670e-01f, -3.741640630e-01f, -3.755861785e-01f, -3.770074102e-01f, -3.784277548e-01f,
+  -3.798472089e-01f, -3.812657692e-01f, -3.826834324e-01f, -3.841001950e-01f, -3.855160538e-01f, -3.869310055e-01f,
+  -3.883450467e-01f, -3.897581741e-01f, -3.911703843e-01f, -3.925816741e-01f, -3.939920401e-01f, -3.954014789e-01f,
+  -3.968099874e-01f, -3.982175622e-01f, -3.996241998e-01f, -4.010298972e-01f, -4.024346509e-01f, -4.038384576e-01f,
+  -4.052413140e-01f, -4.066432169e-01f, -4.080441629e-01f, -4.094441487e-01f, -4.108431711e-01f, -4.122412267e-01f,
+  -4.136383122e-01f, -4.150344245e-01f, -4.164295601e-01f, -4.178237158e-01f, -4.192168884e-01f, -4.206090744e-01f,
+  -4.220002708e-01f, -4.233904741e-01f, -4.247796812e-01f, -4.261678887e-01f, -4.275550934e-01f, -4.289412921e-01f,
+  -4.303264813e-01f, -4.317106580e-01f, -4.330938189e-01f, -4.344759606e-01f, -4.358570799e-01f, -4.372371737e-01f,
+  -4.386162385e-01f, -4.399942713e-01f, -4.413712687e-01f, -4.427472276e-01f, -4.441221446e-01f, -4.454960165e-01f,
+  -4.468688402e-01f, -4.482406123e-01f, -4.496113297e-01f, -4.509809890e-01f, -4.523495872e-01f, -4.537171210e-01f,
+  -4.550835871e-01f, -4.564489824e-01f, -4.578133036e-01f, -4.591765475e-01f, -4.605387110e-01f, -4.618997907e-01f,
+  -4.632597836e-01f, -4.646186863e-01f, -4.659764958e-01f, -4.673332087e-01f, -4.686888220e-01f, -4.700433325e-01f,
+  -4.713967368e-01f, -4.727490320e-01f, -4.741002147e-01f, -4.754502817e-01f, -4.767992301e-01f, -4.781470564e-01f,
+  -4.794937577e-01f, -4.808393306e-01f, -4.821837721e-01f, -4.835270789e-01f, -4.848692480e-01f, -4.862102761e-01f,
+  -4.875501601e-01f, -4.888888969e-01f, -4.902264833e-01f, -4.915629161e-01f, -4.928981922e-01f, -4.942323085e-01f,
+  -4.955652618e-01f, -4.968970490e-01f, -4.982276670e-01f, -4.995571125e-01f, -5.008853826e-01f, -5.022124740e-01f,
+  -5.035383837e-01f, -5.048631085e-01f, -5.061866453e-01f, -5.075089911e-01f, -5.088301425e-01f, -5.101500967e-01f,
+  -5.114688504e-01f, -5.127864006e-01f, -5.141027442e-01f, -5.154178780e-01f, -5.167317990e-01f, -5.180445041e-01f,
+  -5.193559902e-01f, -5.206662541e-01f, -5.219752929e-01f, -5.232831035e-01f, -5.245896827e-01f, -5.258950275e-01f,
+  -5.271991348e-01f, -5.285020015e-01f, -5.298036247e-01f, -5.311040012e-01f, -5.324031279e-01f, -5.337010018e-01f,
+  -5.349976199e-01f, -5.362929791e-01f, -5.375870763e-01f, -5.388799085e-01f, -5.401714727e-01f, -5.414617659e-01f,
+  -5.427507849e-01f, -5.440385267e-01f, -5.453249884e-01f, -5.466101669e-01f, -5.478940592e-01f, -5.491766622e-01f,
+  -5.504579729e-01f, -5.517379884e-01f, -5.530167056e-01f, -5.542941215e-01f, -5.555702330e-01f, -5.568450373e-01f,
+  -5.581185312e-01f, -5.593907119e-01f, -5.606615762e-01f, -5.619311212e-01f, -5.631993440e-01f, -5.644662415e-01f,
+  -5.657318108e-01f, -5.669960488e-01f, -5.682589527e-01f, -5.695205193e-01f, -5.707807459e-01f, -5.720396293e-01f,
+  -5.732971667e-01f, -5.745533550e-01f, -5.758081914e-01f, -5.770616729e-01f, -5.783137964e-01f, -5.795645591e-01f,
+  -5.808139581e-01f, -5.820619903e-01f, -5.833086529e-01f, -5.845539430e-01f, -5.857978575e-01f, -5.870403935e-01f,
+  -5.882815482e-01f, -5.895213186e-01f, -5.907597019e-01f, -5.919966950e-01f, -5.932322950e-01f, -5.944664992e-01f,
+  -5.956993045e-01f, -5.969307081e-01f, -5.981607070e-01f, -5.993892984e-01f, -6.006164794e-01f, -6.018422471e-01f,
+  -6.030665985e-01f, -6.042895309e-01f, -6.055110414e-01f, -6.067311270e-01f, -6.079497850e-01f, -6.091670123e-01f,
+  -6.103828063e-01f, -6.115971639e-01f, -6.128100824e-01f, -6.140215589e-01f, -6.152315906e-01f, -6.164401745e-01f,
+  -6.176473079e-01f, -6.188529880e-01f, -6.200572118e-01f, -6.212599765e-01f, -6.224612794e-01f, -6.236611175e-01f,
+  -6.248594881e-01f, -6.260563884e-01f, -6.272518155e-01f, -6.284457666e-01f, -6.296382389e-01f, -6.308292296e-01f,
+  -6.320187359e-01f, -6.332067551e-01f, -6.343932842e-01f, -6.355783205e-01f, -6.367618612e-01f, -6.379439036e-01f,
+  -6.391244449e-01f, -6.403034822e-01f, -6.414810128e-01f, -6.426570340e-01f, -6.438315429e-01f, -6.450045368e-01f,
+  -6.461760130e-01f, -6.473459686e-01f, -6.485144010e-01f, -6.496813074e-01f, -6.508466850e-01f, -6.520105311e-01f,
+  -6.531728430e-01f, -6.543336178e-01f, -6.554928530e-01f, -6.566505457e-01f, -6.578066933e-01f, -6.589612930e-01f,
+  -6.601143421e-01f, -6.612658378e-01f, -6.624157776e-01f, -6.635641586e-01f, -6.647109782e-01f, -6.658562337e-01f,
+  -6.669999223e-01f, -6.681420414e-01f, -6.692825883e-01f, -6.704215604e-01f, -6.715589548e-01f, -6.726947691e-01f,
+  -6.738290004e-01f, -6.749616461e-01f, -6.760927036e-01f, -6.772221701e-01f, -6.783500431e-01f, -6.794763199e-01f,
+  -6.806009978e-01f, -6.817240742e-01f, -6.828455464e-01f, -6.839654118e-01f, -6.850836678e-01f, -6.862003117e-01f,
+  -6.873153409e-01f, -6.884287528e-01f, -6.895405447e-01f, -6.906507141e-01f, -6.917592584e-01f, -6.928661748e-01f,
+  -6.939714609e-01f, -6.950751140e-01f, -6.961771315e-01f, -6.972775108e-01f, -6.983762494e-01f, -6.994733446e-01f,
+  -7.005687939e-01f, -7.016625947e-01f, -7.027547445e-01f, -7.038452405e-01f, -7.049340804e-01f, -7.060212614e-01f,
+  -7.071067812e-01f, -7.081906370e-01f, -7.092728264e-01f, -7.103533469e-01f, -7.114321957e-01f, -7.125093706e-01f,
+  -7.135848688e-01f, -7.146586879e-01f, -7.157308253e-01f, -7.168012785e-01f, -7.178700451e-01f, -7.189371224e-01f,
+  -7.200025080e-01f, -7.210661993e-01f, -7.221281939e-01f, -7.231884893e-01f, -7.242470830e-01f, -7.253039724e-01f,
+  -7.263591551e-01f, -7.274126286e-01f, -7.284643904e-01f, -7.295144381e-01f, -7.305627692e-01f, -7.316093812e-01f,
+  -7.326542717e-01f, -7.336974381e-01f, -7.347388781e-01f, -7.357785892e-01f, -7.368165689e-01f, -7.378528148e-01f,
+  -7.388873245e-01f, -7.399200955e-01f, -7.409511254e-01f, -7.419804117e-01f, -7.430079521e-01f, -7.440337442e-01f,
+  -7.450577854e-01f, -7.460800735e-01f, -7.471006060e-01f, -7.481193805e-01f, -7.491363945e-01f, -7.501516458e-01f,
+  -7.511651319e-01f, -7.521768504e-01f, -7.531867990e-01f, -7.541949753e-01f, -7.552013769e-01f, -7.562060014e-01f,
+  -7.572088465e-01f, -7.582099098e-01f, -7.592091890e-01f, -7.602066817e-01f, -7.612023855e-01f, -7.621962981e-01f,
+  -7.631884173e-01f, -7.641787405e-01f, -7.651672656e-01f, -7.661539902e-01f, -7.671389119e-01f, -7.681220285e-01f,
+  -7.691033376e-01f, -7.700828370e-01f, -7.710605243e-01f, -7.720363972e-01f, -7.730104534e-01f, -7.739826906e-01f,
+  -7.749531066e-01f, -7.759216990e-01f, -7.768884657e-01f, -7.778534042e-01f, -7.788165124e-01f, -7.797777879e-01f,
+  -7.807372286e-01f, -7.816948321e-01f, -7.826505962e-01f, -7.836045186e-01f, -7.845565972e-01f, -7.855068296e-01f,
+  -7.864552136e-01f, -7.874017470e-01f, -7.883464276e-01f, -7.892892532e-01f, -7.902302214e-01f, -7.911693302e-01f,
+  -7.921065773e-01f, -7.930419605e-01f, -7.939754776e-01f, -7.949071263e-01f, -7.958369046e-01f, -7.967648102e-01f,
+  -7.976908409e-01f, -7.986149946e-01f, -7.995372691e-01f, -8.004576622e-01f, -8.013761717e-01f, -8.022927955e-01f,
+  -8.032075315e-01f, -8.041203774e-01f, -8.050313311e-01f, -8.059403906e-01f, -8.068475535e-01f, -8.077528179e-01f,
+  -8.086561816e-01f, -8.095576424e-01f, -8.104571983e-01f, -8.113548470e-01f, -8.122505866e-01f, -8.131444148e-01f,
+  -8.140363297e-01f, -8.149263291e-01f, -8.158144108e-01f, -8.167005729e-01f, -8.175848132e-01f, -8.184671296e-01f,
+  -8.193475201e-01f, -8.202259826e-01f, -8.211025150e-01f, -8.219771153e-01f, -8.228497814e-01f, -8.237205112e-01f,
+  -8.245893028e-01f, -8.254561540e-01f, -8.263210628e-01f, -8.271840273e-01f, -8.280450453e-01f, -8.289041148e-01f,
+  -8.297612338e-01f, -8.306164003e-01f, -8.314696123e-01f, -8.323208678e-01f, -8.331701647e-01f, -8.340175011e-01f,
+  -8.348628750e-01f, -8.357062844e-01f, -8.365477272e-01f, -8.373872016e-01f, -8.382247056e-01f, -8.390602371e-01f,
+  -8.398937942e-01f, -8.407253750e-01f, -8.415549774e-01f, -8.423825996e-01f, -8.432082396e-01f, -8.440318955e-01f,
+  -8.448535652e-01f, -8.456732470e-01f, -8.464909388e-01f, -8.473066387e-01f, -8.481203448e-01f, -8.489320552e-01f,
+  -8.497417680e-01f, -8.505494813e-01f, -8.513551931e-01f, -8.521589016e-01f, -8.529606049e-01f, -8.537603011e-01f,
+  -8.545579884e-01f, -8.553536647e-01f, -8.561473284e-01f, -8.569389774e-01f, -8.577286100e-01f, -8.585162243e-01f,
+  -8.593018184e-01f, -8.600853904e-01f, -8.608669386e-01f, -8.616464611e-01f, -8.624239561e-01f, -8.631994217e-01f,
+  -8.639728561e-01f, -8.647442575e-01f, -8.655136241e-01f, -8.662809540e-01f, -8.670462455e-01f, -8.678094968e-01f,
+  -8.685707060e-01f, -8.693298713e-01f, -8.700869911e-01f, -8.708420635e-01f, -8.715950867e-01f, -8.723460589e-01f,
+  -8.730949784e-01f, -8.738418435e-01f, -8.745866523e-01f, -8.753294031e-01f, -8.760700942e-01f, -8.768087238e-01f,
+  -8.775452902e-01f, -8.782797917e-01f, -8.790122264e-01f, -8.797425928e-01f, -8.804708891e-01f, -8.811971135e-01f,
+  -8.819212643e-01f, -8.826433400e-01f, -8.833633387e-01f, -8.840812587e-01f, -8.847970984e-01f, -8.855108561e-01f,
+  -8.862225301e-01f, -8.869321188e-01f, -8.876396204e-01f, -8.883450333e-01f, -8.890483559e-01f, -8.897495864e-01f,
+  -8.904487232e-01f, -8.911457648e-01f, -8.918407094e-01f, -8.925335554e-01f, -8.932243012e-01f, -8.939129451e-01f,
+  -8.945994856e-01f, -8.952839210e-01f, -8.959662498e-01f, -8.966464702e-01f, -8.973245807e-01f, -8.980005797e-01f,
+  -8.986744657e-01f, -8.993462370e-01f, -9.000158920e-01f, -9.006834292e-01f, -9.013488470e-01f, -9.020121439e-01f,
+  -9.026733182e-01f, -9.033323685e-01f, -9.039892931e-01f, -9.046440906e-01f, -9.052967593e-01f, -9.059472978e-01f,
+  -9.065957045e-01f, -9.072419779e-01f, -9.078861165e-01f, -9.085281187e-01f, -9.091679831e-01f, -9.098057081e-01f,
+  -9.104412923e-01f, -9.110747341e-01f, -9.117060320e-01f, -9.123351846e-01f, -9.129621904e-01f, -9.135870479e-01f,
+  -9.142097557e-01f, -9.148303122e-01f, -9.154487161e-01f, -9.160649658e-01f, -9.166790599e-01f, -9.172909970e-01f,
+  -9.179007756e-01f, -9.185083943e-01f, -9.191138517e-01f, -9.197171463e-01f, -9.203182767e-01f, -9.209172415e-01f,
+  -9.215140393e-01f, -9.221086687e-01f, -9.227011283e-01f, -9.232914167e-01f, -9.238795325e-01f, -9.244654743e-01f,
+  -9.250492408e-01f, -9.256308305e-01f, -9.262102421e-01f, -9.267874743e-01f, -9.273625257e-01f, -9.279353948e-01f,
+  -9.285060805e-01f, -9.290745813e-01f, -9.296408958e-01f, -9.302050229e-01f, -9.307669611e-01f, -9.313267091e-01f,
+  -9.318842656e-01f, -9.324396293e-01f, -9.329927988e-01f, -9.335437730e-01f, -9.340925504e-01f, -9.346391298e-01f,
+  -9.351835099e-01f, -9.357256895e-01f, -9.362656672e-01f, -9.368034417e-01f, -9.373390119e-01f, -9.378723764e-01f,
+  -9.384035341e-01f, -9.389324835e-01f, -9.394592236e-01f, -9.399837530e-01f, -9.405060706e-01f, -9.410261751e-01f,
+  -9.415440652e-01f, -9.420597398e-01f, -9.425731976e-01f, -9.430844375e-01f, -9.435934582e-01f, -9.441002585e-01f,
+  -9.446048373e-01f, -9.451071933e-01f, -9.456073254e-01f, -9.461052324e-01f, -9.466009131e-01f, -9.470943664e-01f,
+  -9.475855910e-01f, -9.480745859e-01f, -9.485613499e-01f, -9.490458819e-01f, -9.495281806e-01f, -9.500082450e-01f,
+  -9.504860739e-01f, -9.509616663e-01f, -9.514350210e-01f, -9.519061368e-01f, -9.523750127e-01f, -9.528416476e-01f,
+  -9.533060404e-01f, -9.537681899e-01f, -9.542280951e-01f, -9.546857549e-01f, -9.551411683e-01f, -9.555943341e-01f,
+  -9.560452513e-01f, -9.564939189e-01f, -9.569403357e-01f, -9.573845008e-01f, -9.578264130e-01f, -9.582660714e-01f,
+  -9.587034749e-01f, -9.591386225e-01f, -9.595715131e-01f, -9.600021457e-01f, -9.604305194e-01f, -9.608566331e-01f,
+  -9.612804858e-01f, -9.617020765e-01f, -9.621214043e-01f, -9.625384680e-01f, -9.629532669e-01f, -9.633657998e-01f,
+  -9.637760658e-01f, -9.641840640e-01f, -9.645897933e-01f, -9.649932529e-01f, -9.653944417e-01f, -9.657933589e-01f,
+  -9.661900034e-01f, -9.665843745e-01f, -9.669764710e-01f, -9.673662922e-01f, -9.677538371e-01f, -9.681391047e-01f,
+  -9.685220943e-01f, -9.689028048e-01f, -9.692812354e-01f, -9.696573851e-01f, -9.700312532e-01f, -9.704028387e-01f,
+  -9.707721407e-01f, -9.711391584e-01f, -9.715038910e-01f, -9.718663375e-01f, -9.722264971e-01f, -9.725843689e-01f,
+  -9.729399522e-01f, -9.732932461e-01f, -9.736442497e-01f, -9.739929622e-01f, -9.743393828e-01f, -9.746835107e-01f,
+  -9.750253451e-01f, -9.753648851e-01f, -9.757021300e-01f, -9.760370790e-01f, -9.763697313e-01f, -9.767000861e-01f,
+  -9.770281427e-01f, -9.773539001e-01f, -9.776773578e-01f, -9.779985149e-01f, -9.783173707e-01f, -9.786339244e-01f,
+  -9.789481753e-01f, -9.792601226e-01f, -9.795697657e-01f, -9.798771037e-01f, -9.801821360e-01f, -9.804848618e-01f,
+  -9.807852804e-01f, -9.810833912e-01f, -9.813791933e-01f, -9.816726862e-01f, -9.819638691e-01f, -9.822527414e-01f,
+  -9.825393023e-01f, -9.828235512e-01f, -9.831054874e-01f, -9.833851103e-01f, -9.836624192e-01f, -9.839374134e-01f,
+  -9.842100924e-01f, -9.844804554e-01f, -9.847485018e-01f, -9.850142310e-01f, -9.852776424e-01f, -9.855387353e-01f,
+  -9.857975092e-01f, -9.860539633e-01f, -9.863080972e-01f, -9.865599103e-01f, -9.868094018e-01f, -9.870565713e-01f,
+  -9.873014182e-01f, -9.875439418e-01f, -9.877841416e-01f, -9.880220171e-01f, -9.882575677e-01f, -9.884907929e-01f,
+  -9.887216920e-01f, -9.889502645e-01f, -9.891765100e-01f, -9.894004278e-01f, -9.896220175e-01f, -9.898412785e-01f,
+  -9.900582103e-01f, -9.902728124e-01f, -9.904850843e-01f, -9.906950254e-01f, -9.909026354e-01f, -9.911079137e-01f,
+  -9.913108598e-01f, -9.915114733e-01f, -9.917097537e-01f, -9.919057004e-01f, -9.920993131e-01f, -9.922905913e-01f,
+  -9.924795346e-01f, -9.926661424e-01f, -9.928504145e-01f, -9.930323502e-01f, -9.932119492e-01f, -9.933892111e-01f,
+  -9.935641355e-01f, -9.937367219e-01f, -9.939069700e-01f, -9.940748793e-01f, -9.942404495e-01f, -9.944036801e-01f,
+  -9.945645707e-01f, -9.947231211e-01f, -9.948793308e-01f, -9.950331994e-01f, -9.951847267e-01f, -9.953339121e-01f,
+  -9.954807555e-01f, -9.956252564e-01f, -9.957674145e-01f, -9.959072294e-01f, -9.960447009e-01f, -9.961798286e-01f,
+  -9.963126122e-01f, -9.964430514e-01f, -9.965711458e-01f, -9.966968952e-01f, -9.968202993e-01f, -9.969413578e-01f,
+  -9.970600703e-01f, -9.971764367e-01f, -9.972904567e-01f, -9.974021299e-01f, -9.975114561e-01f, -9.976184351e-01f,
+  -9.977230666e-01f, -9.978253504e-01f, -9.979252862e-01f, -9.980228738e-01f, -9.981181129e-01f, -9.982110034e-01f,
+  -9.983015449e-01f, -9.983897374e-01f, -9.984755806e-01f, -9.985590742e-01f, -9.986402182e-01f, -9.987190122e-01f,
+  -9.987954562e-01f, -9.988695499e-01f, -9.989412932e-01f, -9.990106859e-01f, -9.990777278e-01f, -9.991424187e-01f,
+  -9.992047586e-01f, -9.992647473e-01f, -9.993223846e-01f, -9.993776704e-01f, -9.994306046e-01f, -9.994811870e-01f,
+  -9.995294175e-01f, -9.995752960e-01f, -9.996188225e-01f, -9.996599967e-01f, -9.996988187e-01f, -9.997352883e-01f,
+  -9.997694054e-01f, -9.998011699e-01f, -9.998305818e-01f, -9.998576410e-01f, -9.998823475e-01f, -9.999047011e-01f,
+  -9.999247018e-01f, -9.999423497e-01f, -9.999576446e-01f, -9.999705864e-01f, -9.999811753e-01f, -9.999894111e-01f,
+  -9.999952938e-01f, -9.999988235e-01f, -1.000000000e+00f, -9.999988235e-01f, -9.999952938e-01f, -9.999894111e-01f,
+  -9.999811753e-01f, -9.999705864e-01f, -9.999576446e-01f, -9.999423497e-01f, -9.999247018e-01f, -9.999047011e-01f,
+  -9.998823475e-01f, -9.998576410e-01f, -9.998305818e-01f, -9.998011699e-01f, -9.997694054e-01f, -9.997352883e-01f,
+  -9.996988187e-01f, -9.996599967e-01f, -9.996188225e-01f, -9.995752960e-01f, -9.995294175e-01f, -9.994811870e-01f,
+  -9.994306046e-01f, -9.993776704e-01f, -9.993223846e-01f, -9.992647473e-01f, -9.992047586e-01f, -9.991424187e-01f,
+  -9.990777278e-01f, -9.990106859e-01f, -9.989412932e-01f, -9.988695499e-01f, -9.987954562e-01f, -9.987190122e-01f,
+  -9.986402182e-01f, -9.985590742e-01f, -9.984755806e-01f, -9.983897374e-01f, -9.983015449e-01f, -9.982110034e-01f,
+  -9.981181129e-01f, -9.980228738e-01f, -9.979252862e-01f, -9.978253504e-01f, -9.977230666e-01f, -9.976184351e-01f,
+  -9.975114561e-01f, -9.974021299e-01f, -9.972904567e-01f, -9.971764367e-01f, -9.970600703e-01f, -9.969413578e-01f,
+  -9.968202993e-01f, -9.966968952e-01f, -9.965711458e-01f, -9.964430514e-01f, -9.963126122e-01f, -9.961798286e-01f,
+  -9.960447009e-01f, -9.959072294e-01f, -9.957674145e-01f, -9.956252564e-01f, -9.954807555e-01f, -9.953339121e-01f,
+  -9.951847267e-01f, -9.950331994e-01f, -9.948793308e-01f, -9.947231211e-01f, -9.945645707e-01f, -9.944036801e-01f,
+  -9.942404495e-01f, -9.940748793e-01f, -9.939069700e-01f, -9.937367219e-01f, -9.935641355e-01f, -9.933892111e-01f,
+  -9.932119492e-01f, -9.930323502e-01f, -9.928504145e-01f, -9.926661424e-01f, -9.924795346e-01f, -9.922905913e-01f,
+  -9.920993131e-01f, -9.919057004e-01f, -9.917097537e-01f, -9.915114733e-01f, -9.913108598e-01f, -9.911079137e-01f,
+  -9.909026354e-01f, -9.906950254e-01f, -9.904850843e-01f, -9.902728124e-01f, -9.900582103e-01f, -9.898412785e-01f,
+  -9.896220175e-01f, -9.894004278e-01f, -9.891765100e-01f, -9.889502645e-01f, -9.887216920e-01f, -9.884907929e-01f,
+  -9.882575677e-01f, -9.880220171e-01f, -9.877841416e-01f, -9.875439418e-01f, -9.873014182e-01f, -9.870565713e-01f,
+  -9.868094018e-01f, -9.865599103e-01f, -9.863080972e-01f, -9.860539633e-01f, -9.857975092e-01f, -9.855387353e-01f,
+  -9.852776424e-01f, -9.850142310e-01f, -9.847485018e-01f, -9.844804554e-01f, -9.842100924e-01f, -9.839374134e-01f,
+  -9.836624192e-01f, -9.833851103e-01f, -9.831054874e-01f, -9.828235512e-01f, -9.825393023e-01f, -9.822527414e-01f,
+  -9.819638691e-01f, -9.816726862e-01f, -9.813791933e-01f, -9.810833912e-01f, -9.807852804e-01f, -9.804848618e-01f,
+  -9.801821360e-01f, -9.798771037e-01f, -9.795697657e-01f, -9.792601226e-01f, -9.789481753e-01f, -9.786339244e-01f,
+  -9.783173707e-01f, -9.779985149e-01f, -9.776773578e-01f, -9.773539001e-01f, -9.770281427e-01f, -9.767000861e-01f,
+  -9.763697313e-01f, -9.760370790e-01f, -9.757021300e-01f, -9.753648851e-01f, -9.750253451e-01f, -9.746835107e-01f,
+  -9.743393828e-01f, -9.739929622e-01f, -9.736442497e-01f, -9.732932461e-01f, -9.729399522e-01f, -9.725843689e-01f,
+  -9.722264971e-01f, -9.718663375e-01f, -9.715038910e-01f, -9.711391584e-01f, -9.707721407e-01f, -9.704028387e-01f,
+  -9.700312532e-01f, -9.696573851e-01f, -9.692812354e-01f, -9.689028048e-01f, -9.685220943e-01f, -9.681391047e-01f,
+  -9.677538371e-01f, -9.673662922e-01f, -9.669764710e-01f, -9.665843745e-01f, -9.661900034e-01f, -9.657933589e-01f,
+  -9.653944417e-01f, -9.649932529e-01f, -9.645897933e-01f, -9.641840640e-01f, -9.637760658e-01f, -9.633657998e-01f,
+  -9.629532669e-01f, -9.625384680e-01f, -9.621214043e-01f, -9.617020765e-01f, -9.612804858e-01f, -9.608566331e-01f,
+  -9.604305194e-01f, -9.600021457e-01f, -9.595715131e-01f, -9.591386225e-01f, -9.587034749e-01f, -9.582660714e-01f,
+  -9.578264130e-01f, -9.573845008e-01f, -9.569403357e-01f, -9.564939189e-01f, -9.560452513e-01f, -9.555943341e-01f,
+  -9.551411683e-01f, -9.546857549e-01f, -9.542280951e-01f, -9.537681899e-01f, -9.533060404e-01f, -9.528416476e-01f,
+  -9.523750127e-01f, -9.519061368e-01f, -9.514350210e-01f, -9.509616663e-01f, -9.504860739e-01f, -9.500082450e-01f,
+  -9.495281806e-01f, -9.490458819e-01f, -9.485613499e-01f, -9.480745859e-01f, -9.475855910e-01f, -9.470943664e-01f,
+  -9.466009131e-01f, -9.461052324e-01f, -9.456073254e-01f, -9.451071933e-01f, -9.446048373e-01f, -9.441002585e-01f,
+  -9.435934582e-01f, -9.430844375e-01f, -9.425731976e-01f, -9.420597398e-01f, -9.415440652e-01f, -9.410261751e-01f,
+  -9.405060706e-01f, -9.399837530e-01f, -9.394592236e-01f, -9.389324835e-01f, -9.384035341e-01f, -9.378723764e-01f,
+  -9.373390119e-01f, -9.368034417e-01f, -9.362656672e-01f, -9.357256895e-01f, -9.351835099e-01f, -9.346391298e-01f,
+  -9.340925504e-01f, -9.335437730e-01f, -9.329927988e-01f, -9.324396293e-01f, -9.318842656e-01f, -9.313267091e-01f,
+  -9.307669611e-01f, -9.302050229e-01f, -9.296408958e-01f, -9.290745813e-01f, -9.285060805e-01f, -9.279353948e-01f,
+  -9.273625257e-01f, -9.267874743e-01f, -9.262102421e-01f, -9.256308305e-01f, -9.250492408e-01f, -9.244654743e-01f,
+  -9.238795325e-01f, -9.232914167e-01f, -9.227011283e-01f, -9.221086687e-01f, -9.215140393e-01f, -9.209172415e-01f,
+  -9.203182767e-01f, -9.197171463e-01f, -9.191138517e-01f, -9.185083943e-01f, -9.179007756e-01f, -9.172909970e-01f,
+  -9.166790599e-01f, -9.160649658e-01f, -9.154487161e-01f, -9.148303122e-01f, -9.142097557e-01f, -9.135870479e-01f,
+  -9.129621904e-01f, -9.123351846e-01f, -9.117060320e-01f, -9.110747341e-01f, -9.104412923e-01f, -9.098057081e-01f,
+  -9.091679831e-01f, -9.085281187e-01f, -9.078861165e-01f, -9.072419779e-01f, -9.065957045e-01f, -9.059472978e-01f,
+  -9.052967593e-01f, -9.046440906e-01f, -9.039892931e-01f, -9.033323685e-01f, -9.026733182e-01f, -9.020121439e-01f,
+  -9.013488470e-01f, -9.006834292e-01f, -9.000158920e-01f, -8.993462370e-01f, -8.986744657e-01f, -8.980005797e-01f,
+  -8.973245807e-01f, -8.966464702e-01f, -8.959662498e-01f, -8.952839210e-01f, -8.945994856e-01f, -8.939129451e-01f,
+  -8.932243012e-01f, -8.925335554e-01f, -8.918407094e-01f, -8.911457648e-01f, -8.904487232e-01f, -8.897495864e-01f,
+  -8.890483559e-01f, -8.883450333e-01f, -8.876396204e-01f, -8.869321188e-01f, -8.862225301e-01f, -8.855108561e-01f,
+  -8.847970984e-01f, -8.840812587e-01f, -8.833633387e-01f, -8.826433400e-01f, -8.819212643e-01f, -8.811971135e-01f,
+  -8.804708891e-01f, -8.797425928e-01f, -8.790122264e-01f, -8.782797917e-01f, -8.775452902e-01f, -8.768087238e-01f,
+  -8.760700942e-01f, -8.753294031e-01f, -8.745866523e-01f, -8.738418435e-01f, -8.730949784e-01f, -8.723460589e-01f,
+  -8.715950867e-01f, -8.708420635e-01f, -8.700869911e-01f, -8.693298713e-01f, -8.685707060e-01f, -8.678094968e-01f,
+  -8.670462455e-01f, -8.662809540e-01f, -8.655136241e-01f, -8.647442575e-01f, -8.639728561e-01f, -8.631994217e-01f,
+  -8.624239561e-01f, -8.616464611e-01f, -8.608669386e-01f, -8.600853904e-01f, -8.593018184e-01f, -8.585162243e-01f,
+  -8.577286100e-01f, -8.569389774e-01f, -8.561473284e-01f, -8.553536647e-01f, -8.545579884e-01f, -8.537603011e-01f,
+  -8.529606049e-01f, -8.521589016e-01f, -8.513551931e-01f, -8.505494813e-01f, -8.497417680e-01f, -8.489320552e-01f,
+  -8.481203448e-01f, -8.473066387e-01f, -8.464909388e-01f, -8.456732470e-01f, -8.448535652e-01f, -8.440318955e-01f,
+  -8.432082396e-01f, -8.423825996e-01f, -8.415549774e-01f, -8.407253750e-01f, -8.398937942e-01f, -8.390602371e-01f,
+  -8.382247056e-01f, -8.373872016e-01f, -8.365477272e-01f, -8.357062844e-01f, -8.348628750e-01f, -8.340175011e-01f,
+  -8.331701647e-01f, -8.323208678e-01f, -8.314696123e-01f, -8.306164003e-01f, -8.297612338e-01f, -8.289041148e-01f,
+  -8.280450453e-01f, -8.271840273e-01f, -8.263210628e-01f, -8.254561540e-01f, -8.245893028e-01f, -8.237205112e-01f,
+  -8.228497814e-01f, -8.219771153e-01f, -8.211025150e-01f, -8.202259826e-01f, -8.193475201e-01f, -8.184671296e-01f,
+  -8.175848132e-01f, -8.167005729e-01f, -8.158144108e-01f, -8.149263291e-01f, -8.140363297e-01f, -8.131444148e-01f,
+  -8.122505866e-01f, -8.113548470e-01f, -8.104571983e-01f, -8.095576424e-01f, -8.086561816e-01f, -8.077528179e-01f,
+  -8.068475535e-01f, -8.059403906e-01f, -8.050313311e-01f, -8.041203774e-01f, -8.032075315e-01f, -8.022927955e-01f,
+  -8.013761717e-01f, -8.004576622e-01f, -7.995372691e-01f, -7.986149946e-01f, -7.976908409e-01f, -7.967648102e-01f,
+  -7.958369046e-01f, -7.949071263e-01f, -7.939754776e-01f, -7.930419605e-01f, -7.921065773e-01f, -7.911693302e-01f,
+  -7.902302214e-01f, -7.892892532e-01f, -7.883464276e-01f, -7.874017470e-01f, -7.864552136e-01f, -7.855068296e-01f,
+  -7.845565972e-01f, -7.836045186e-01f, -7.826505962e-01f, -7.816948321e-01f, -7.807372286e-01f, -7.797777879e-01f,
+  -7.788165124e-01f, -7.778534042e-01f, -7.768884657e-01f, -7.759216990e-01f, -7.749531066e-01f, -7.739826906e-01f,
+  -7.730104534e-01f, -7.720363972e-01f, -7.710605243e-01f, -7.700828370e-01f, -7.691033376e-01f, -7.681220285e-01f,
+  -7.671389119e-01f, -7.661539902e-01f, -7.651672656e-01f, -7.641787405e-01f, -7.631884173e-01f, -7.621962981e-01f,
+  -7.612023855e-01f, -7.602066817e-01f, -7.592091890e-01f, -7.582099098e-01f, -7.572088465e-01f, -7.562060014e-01f,
+  -7.552013769e-01f, -7.541949753e-01f, -7.531867990e-01f, -7.521768504e-01f, -7.511651319e-01f, -7.501516458e-01f,
+  -7.491363945e-01f, -7.481193805e-01f, -7.471006060e-01f, -7.460800735e-01f, -7.450577854e-01f, -7.440337442e-01f,
+  -7.430079521e-01f, -7.419804117e-01f, -7.409511254e-01f, -7.399200955e-01f, -7.388873245e-01f, -7.378528148e-01f,
+  -7.368165689e-01f, -7.357785892e-01f, -7.347388781e-01f, -7.336974381e-01f, -7.326542717e-01f, -7.316093812e-01f,
+  -7.305627692e-01f, -7.295144381e-01f, -7.284643904e-01f, -7.274126286e-01f, -7.263591551e-01f, -7.253039724e-01f,
+  -7.242470830e-01f, -7.231884893e-01f, -7.221281939e-01f, -7.210661993e-01f, -7.200025080e-01f, -7.189371224e-01f,
+  -7.178700451e-01f, -7.168012785e-01f, -7.157308253e-01f, -7.146586879e-01f, -7.135848688e-01f, -7.125093706e-01f,
+  -7.114321957e-01f, -7.103533469e-01f, -7.092728264e-01f, -7.081906370e-01f, -7.071067812e-01f, -7.060212614e-01f,
+  -7.049340804e-01f, -7.038452405e-01f, -7.027547445e-01f, -7.016625947e-01f, -7.005687939e-01f, -6.994733446e-01f,
+  -6.983762494e-01f, -6.972775108e-01f, -6.961771315e-01f, -6.950751140e-01f, -6.939714609e-01f, -6.928661748e-01f,
+  -6.917592584e-01f, -6.906507141e-01f, -6.895405447e-01f, -6.884287528e-01f, -6.873153409e-01f, -6.862003117e-01f,
+  -6.850836678e-01f, -6.839654118e-01f, -6.828455464e-01f, -6.817240742e-01f, -6.806009978e-01f, -6.794763199e-01f,
+  -6.783500431e-01f, -6.772221701e-01f, -6.760927036e-01f, -6.749616461e-01f, -6.738290004e-01f, -6.726947691e-01f,
+  -6.715589548e-01f, -6.704215604e-01f, -6.692825883e-01f, -6.681420414e-01f, -6.669999223e-01f, -6.658562337e-01f,
+  -6.647109782e-01f, -6.635641586e-01f, -6.624157776e-01f, -6.612658378e-01f, -6.601143421e-01f, -6.589612930e-01f,
+  -6.578066933e-01f, -6.566505457e-01f, -6.554928530e-01f, -6.543336178e-01f, -6.531728430e-01f, -6.520105311e-01f,
+  -6.508466850e-01f, -6.496813074e-01f, -6.485144010e-01f, -6.473459686e-01f, -6.461760130e-01f, -6.450045368e-01f,
+  -6.438315429e-01f, -6.426570340e-01f, -6.414810128e-01f, -6.403034822e-01f, -6.391244449e-01f, -6.379439036e-01f,
+  -6.367618612e-01f, -6.355783205e-01f, -6.343932842e-01f, -6.332067551e-01f, -6.320187359e-01f, -6.308292296e-01f,
+  -6.296382389e-01f, -6.284457666e-01f, -6.272518155e-01f, -6.260563884e-01f, -6.248594881e-01f, -6.236611175e-01f,
+  -6.224612794e-01f, -6.212599765e-01f, -6.200572118e-01f, -6.188529880e-01f, -6.176473079e-01f, -6.164401745e-01f,
+  -6.152315906e-01f, -6.140215589e-01f, -6.128100824e-01f, -6.115971639e-01f, -6.103828063e-01f, -6.091670123e-01f,
+  -6.079497850e-01f, -6.067311270e-01f, -6.055110414e-01f, -6.042895309e-01f, -6.030665985e-01f, -6.018422471e-01f,
+  -6.006164794e-01f, -5.993892984e-01f, -5.981607070e-01f, -5.969307081e-01f, -5.956993045e-01f, -5.944664992e-01f,
+  -5.932322950e-01f, -5.919966950e-01f, -5.907597019e-01f, -5.895213186e-01f, -5.882815482e-01f, -5.870403935e-01f,
+  -5.857978575e-01f, -5.845539430e-01f, -5.833086529e-01f, -5.820619903e-01f, -5.808139581e-01f, -5.795645591e-01f,
+  -5.783137964e-01f, -5.770616729e-01f, -5.758081914e-01f, -5.745533550e-01f, -5.732971667e-01f, -5.720396293e-01f,
+  -5.707807459e-01f, -5.695205193e-01f, -5.682589527e-01f, -5.669960488e-01f, -5.657318108e-01f, -5.644662415e-01f,
+  -5.631993440e-01f, -5.619311212e-01f, -5.606615762e-01f, -5.593907119e-01f, -5.581185312e-01f, -5.568450373e-01f,
+  -5.555702330e-01f, -5.542941215e-01f, -5.530167056e-01f, -5.517379884e-01f, -5.504579729e-01f, -5.491766622e-01f,
+  -5.478940592e-01f, -5.466101669e-01f, -5.453249884e-01f, -5.440385267e-01f, -5.427507849e-01f, -5.414617659e-01f,
+  -5.401714727e-01f, -5.388799085e-01f, -5.375870763e-01f, -5.362929791e-01f, -5.349976199e-01f, -5.337010018e-01f,
+  -5.324031279e-01f, -5.311040012e-01f, -5.298036247e-01f, -5.285020015e-01f, -5.271991348e-01f, -5.258950275e-01f,
+  -5.245896827e-01f, -5.232831035e-01f, -5.219752929e-01f, -5.206662541e-01f, -5.193559902e-01f, -5.180445041e-01f,
+  -5.167317990e-01f, -5.154178780e-01f, -5.141027442e-01f, -5.127864006e-01f, -5.114688504e-01f, -5.101500967e-01f,
+  -5.088301425e-01f, -5.075089911e-01f, -5.061866453e-01f, -5.048631085e-01f, -5.035383837e-01f, -5.022124740e-01f,
+  -5.008853826e-01f, -4.995571125e-01f, -4.982276670e-01f, -4.968970490e-01f, -4.955652618e-01f, -4.942323085e-01f,
+  -4.928981922e-01f, -4.915629161e-01f, -4.902264833e-01f, -4.888888969e-01f, -4.875501601e-01f, -4.862102761e-01f,
+  -4.848692480e-01f, -4.835270789e-01f, -4.821837721e-01f, -4.808393306e-01f, -4.794937577e-01f, -4.781470564e-01f,
+  -4.767992301e-01f, -4.754502817e-01f, -4.741002147e-01f, -4.727490320e-01f, -4.713967368e-01f, -4.700433325e-01f,
+  -4.686888220e-01f, -4.673332087e-01f, -4.659764958e-01f, -4.646186863e-01f, -4.632597836e-01f, -4.618997907e-01f,
+  -4.605387110e-01f, -4.591765475e-01f, -4.578133036e-01f, -4.564489824e-01f, -4.550835871e-01f, -4.537171210e-01f,
+  -4.523495872e-01f, -4.509809890e-01f, -4.496113297e-01f, -4.482406123e-01f, -4.468688402e-01f, -4.454960165e-01f,
+  -4.441221446e-01f, -4.427472276e-01f, -4.413712687e-01f, -4.399942713e-01f, -4.386162385e-01f, -4.372371737e-01f,
+  -4.358570799e-01f, -4.344759606e-01f, -4.330938189e-01f, -4.317106580e-01f, -4.303264813e-01f, -4.289412921e-01f,
+  -4.275550934e-01f, -4.261678887e-01f, -4.247796812e-01f, -4.233904741e-01f, -4.220002708e-01f, -4.206090744e-01f,
+  -4.192168884e-01f, -4.178237158e-01f, -4.164295601e-01f, -4.150344245e-01f, -4.136383122e-01f, -4.122412267e-01f,
+  -4.108431711e-01f, -4.094441487e-01f, -4.080441629e-01f, -4.066432169e-01f, -4.052413140e-01f, -4.038384576e-01f,
+  -4.024346509e-01f, -4.010298972e-01f, -3.996241998e-01f, -3.982175622e-01f, -3.968099874e-01f, -3.954014789e-01f,
+  -3.939920401e-01f, -3.925816741e-01f, -3.911703843e-01f, -3.897581741e-01f, -3.883450467e-01f, -3.869310055e-01f,
+  -3.855160538e-01f, -3.841001950e-01f, -3.826834324e-01f, -3.812657692e-01f, -3.798472089e-01f, -3.784277548e-01f,
+  -3.770074102e-01f, -3.755861785e-01f, -3.741640630e-01f, -3.727410670e-01f, -3.713171940e-01f, -3.698924471e-01f,
+  -3.684668300e-01f, -3.670403457e-01f, -3.656129978e-01f, -3.641847896e-01f, -3.627557244e-01f, -3.613258056e-01f,
+  -3.598950365e-01f, -3.584634206e-01f, -3.570309612e-01f, -3.555976617e-01f, -3.541635254e-01f, -3.527285558e-01f,
+  -3.512927561e-01f, -3.498561298e-01f, -3.484186802e-01f, -3.469804108e-01f, -3.455413250e-01f, -3.441014260e-01f,
+  -3.426607173e-01f, -3.412192023e-01f, -3.397768844e-01f, -3.383337670e-01f, -3.368898534e-01f, -3.354451471e-01f,
+  -3.339996514e-01f, -3.325533699e-01f, -3.311063058e-01f, -3.296584625e-01f, -3.282098436e-01f, -3.267604523e-01f,
+  -3.253102922e-01f, -3.238593665e-01f, -3.224076788e-01f, -3.209552324e-01f, -3.195020308e-01f, -3.180480774e-01f,
+  -3.165933756e-01f, -3.151379288e-01f, -3.136817404e-01f, -3.122248139e-01f, -3.107671527e-01f, -3.093087603e-01f,
+  -3.078496400e-01f, -3.063897954e-01f, -3.049292297e-01f, -3.034679466e-01f, -3.020059493e-01f, -3.005432414e-01f,
+  -2.990798263e-01f, -2.976157074e-01f, -2.961508882e-01f, -2.946853722e-01f, -2.932191627e-01f, -2.917522632e-01f,
+  -2.902846773e-01f, -2.888164082e-01f, -2.873474595e-01f, -2.858778347e-01f, -2.844075372e-01f, -2.829365705e-01f,
+  -2.814649379e-01f, -2.799926431e-01f, -2.785196894e-01f, -2.770460803e-01f, -2.755718193e-01f, -2.740969099e-01f,
+  -2.726213554e-01f, -2.711451595e-01f, -2.696683256e-01f, -2.681908571e-01f, -2.667127575e-01f, -2.652340303e-01f,
+  -2.637546790e-01f, -2.622747070e-01f, -2.607941179e-01f, -2.593129151e-01f, -2.578311022e-01f, -2.563486825e-01f,
+  -2.548656596e-01f, -2.533820370e-01f, -2.518978182e-01f, -2.504130066e-01f, -2.489276057e-01f, -2.474416192e-01f,
+  -2.459550503e-01f, -2.444679027e-01f, -2.429801799e-01f, -2.414918853e-01f, -2.400030224e-01f, -2.385135948e-01f,
+  -2.370236060e-01f, -2.355330594e-01f, -2.340419586e-01f, -2.325503070e-01f, -2.310581083e-01f, -2.295653658e-01f,
+  -2.280720832e-01f, -2.265782638e-01f, -2.250839114e-01f, -2.235890292e-01f, -2.220936210e-01f, -2.205976901e-01f,
+  -2.191012402e-01f, -2.176042746e-01f, -2.161067971e-01f, -2.146088110e-01f, -2.131103199e-01f, -2.116113274e-01f,
+  -2.101118369e-01f, -2.086118520e-01f, -2.071113762e-01f, -2.056104131e-01f, -2.041089661e-01f, -2.026070388e-01f,
+  -2.011046348e-01f, -1.996017576e-01f, -1.980984107e-01f, -1.965945977e-01f, -1.950903220e-01f, -1.935855873e-01f,
+  -1.920803970e-01f, -1.905747548e-01f, -1.890686641e-01f, -1.875621286e-01f, -1.860551517e-01f, -1.845477369e-01f,
+  -1.830398880e-01f, -1.815316083e-01f, -1.800229014e-01f, -1.785137709e-01f, -1.770042204e-01f, -1.754942534e-01f,
+  -1.739838734e-01f, -1.724730840e-01f, -1.709618888e-01f, -1.694502912e-01f, -1.679382950e-01f, -1.664259035e-01f,
+  -1.649131205e-01f, -1.633999494e-01f, -1.618863938e-01f, -1.603724572e-01f, -1.588581433e-01f, -1.573434556e-01f,
+  -1.558283977e-01f, -1.543129730e-01f, -1.527971853e-01f, -1.512810380e-01f, -1.497645347e-01f, -1.482476790e-01f,
+  -1.467304745e-01f, -1.452129247e-01f, -1.436950332e-01f, -1.421768035e-01f, -1.406582393e-01f, -1.391393442e-01f,
+  -1.376201216e-01f, -1.361005752e-01f, -1.345807085e-01f, -1.330605252e-01f, -1.315400287e-01f, -1.300192227e-01f,
+  -1.284981108e-01f, -1.269766965e-01f, -1.254549834e-01f, -1.239329751e-01f, -1.224106752e-01f, -1.208880872e-01f,
+  -1.193652148e-01f, -1.178420615e-01f, -1.163186309e-01f, -1.147949266e-01f, -1.132709522e-01f, -1.117467112e-01f,
+  -1.102222073e-01f, -1.086974440e-01f, -1.071724250e-01f, -1.056471537e-01f, -1.041216339e-01f, -1.025958690e-01f,
+  -1.010698628e-01f, -9.954361866e-02f, -9.801714033e-02f, -9.649043136e-02f, -9.496349533e-02f, -9.343633585e-02f,
+  -9.190895650e-02f, -9.038136088e-02f, -8.885355258e-02f, -8.732553521e-02f, -8.579731234e-02f, -8.426888759e-02f,
+  -8.274026455e-02f, -8.121144681e-02f, -7.968243797e-02f, -7.815324163e-02f, -7.662386139e-02f, -7.509430085e-02f,
+  -7.356456360e-02f, -7.203465325e-02f, -7.050457339e-02f, -6.897432763e-02f, -6.744391956e-02f, -6.591335280e-02f,
+  -6.438263093e-02f, -6.285175756e-02f, -6.132073630e-02f, -5.978957075e-02f, -5.825826450e-02f, -5.672682117e-02f,
+  -5.519524435e-02f, -5.366353765e-02f, -5.213170468e-02f, -5.059974904e-02f, -4.906767433e-02f, -4.753548416e-02f,
+  -4.600318213e-02f, -4.447077185e-02f, -4.293825693e-02f, -4.140564098e-02f, -3.987292759e-02f, -3.834012037e-02f,
+  -3.680722294e-02f, -3.527423890e-02f, -3.374117185e-02f, -3.220802541e-02f, -3.067480318e-02f, -2.914150876e-02f,
+  -2.760814578e-02f, -2.607471783e-02f, -2.454122852e-02f, -2.300768147e-02f, -2.147408028e-02f, -1.994042855e-02f,
+  -1.840672991e-02f, -1.687298795e-02f, -1.533920628e-02f, -1.380538853e-02f, -1.227153829e-02f, -1.073765917e-02f,
+  -9.203754782e-03f, -7.669828740e-03f, -6.135884649e-03f, -4.601926120e-03f, -3.067956763e-03f, -1.533980186e-03f,
+  -1.836970199e-16f, 1.533980186e-03f, 3.067956763e-03f, 4.601926120e-03f, 6.135884649e-03f, 7.669828740e-03f,
+  9.203754782e-03f, 1.073765917e-02f, 1.227153829e-02f, 1.380538853e-02f, 1.533920628e-02f, 1.687298795e-02f,
+  1.840672991e-02f, 1.994042855e-02f, 2.147408028e-02f, 2.300768147e-02f, 2.454122852e-02f, 2.607471783e-02f,
+  2.760814578e-02f, 2.914150876e-02f, 3.067480318e-02f, 3.220802541e-02f, 3.374117185e-02f, 3.527423890e-02f,
+  3.680722294e-02f, 3.834012037e-02f, 3.987292759e-02f, 4.140564098e-02f, 4.293825693e-02f, 4.447077185e-02f,
+  4.600318213e-02f, 4.753548416e-02f, 4.906767433e-02f, 5.059974904e-02f, 5.213170468e-02f, 5.366353765e-02f,
+  5.519524435e-02f, 5.672682117e-02f, 5.825826450e-02f, 5.978957075e-02f, 6.132073630e-02f, 6.285175756e-02f,
+  6.438263093e-02f, 6.591335280e-02f, 6.744391956e-02f, 6.897432763e-02f, 7.050457339e-02f, 7.203465325e-02f,
+  7.356456360e-02f, 7.509430085e-02f, 7.662386139e-02f, 7.815324163e-02f, 7.968243797e-02f, 8.121144681e-02f,
+  8.274026455e-02f, 8.426888759e-02f, 8.579731234e-02f, 8.732553521e-02f, 8.885355258e-02f, 9.038136088e-02f,
+  9.190895650e-02f, 9.343633585e-02f, 9.496349533e-02f, 9.649043136e-02f, 9.801714033e-02f, 9.954361866e-02f,
+  1.010698628e-01f, 1.025958690e-01f, 1.041216339e-01f, 1.056471537e-01f, 1.071724250e-01f, 1.086974440e-01f,
+  1.102222073e-01f, 1.117467112e-01f, 1.132709522e-01f, 1.147949266e-01f, 1.163186309e-01f, 1.178420615e-01f,
+  1.193652148e-01f, 1.208880872e-01f, 1.224106752e-01f, 1.239329751e-01f, 1.254549834e-01f, 1.269766965e-01f,
+  1.284981108e-01f, 1.300192227e-01f, 1.315400287e-01f, 1.330605252e-01f, 1.345807085e-01f, 1.361005752e-01f,
+  1.376201216e-01f, 1.391393442e-01f, 1.406582393e-01f, 1.421768035e-01f, 1.436950332e-01f, 1.452129247e-01f,
+  1.467304745e-01f, 1.482476790e-01f, 1.497645347e-01f, 1.512810380e-01f, 1.527971853e-01f, 1.543129730e-01f,
+  1.558283977e-01f, 1.573434556e-01f, 1.588581433e-01f, 1.603724572e-01f, 1.618863938e-01f, 1.633999494e-01f,
+  1.649131205e-01f, 1.664259035e-01f, 1.679382950e-01f, 1.694502912e-01f, 1.709618888e-01f, 1.724730840e-01f,
+  1.739838734e-01f, 1.754942534e-01f, 1.770042204e-01f, 1.785137709e-01f, 1.800229014e-01f, 1.815316083e-01f,
+  1.830398880e-01f, 1.845477369e-01f, 1.860551517e-01f, 1.875621286e-01f, 1.890686641e-01f, 1.905747548e-01f,
+  1.920803970e-01f, 1.935855873e-01f, 1.950903220e-01f, 1.965945977e-01f, 1.980984107e-01f, 1.996017576e-01f,
+  2.011046348e-01f, 2.026070388e-01f, 2.041089661e-01f, 2.056104131e-01f, 2.071113762e-01f, 2.086118520e-01f,
+  2.101118369e-01f, 2.116113274e-01f, 2.131103199e-01f, 2.146088110e-01f, 2.161067971e-01f, 2.176042746e-01f,
+  2.191012402e-01f, 2.205976901e-01f, 2.220936210e-01f, 2.235890292e-01f, 2.250839114e-01f, 2.265782638e-01f,
+  2.280720832e-01f, 2.295653658e-01f, 2.310581083e-01f, 2.325503070e-01f, 2.340419586e-01f, 2.355330594e-01f,
+  2.370236060e-01f, 2.385135948e-01f, 2.400030224e-01f, 2.414918853e-01f, 2.429801799e-01f, 2.444679027e-01f,
+  2.459550503e-01f, 2.474416192e-01f, 2.489276057e-01f, 2.504130066e-01f, 2.518978182e-01f, 2.533820370e-01f,
+  2.548656596e-01f, 2.563486825e-01f, 2.578311022e-01f, 2.593129151e-01f, 2.607941179e-01f, 2.622747070e-01f,
+  2.637546790e-01f, 2.652340303e-01f, 2.667127575e-01f, 2.681908571e-01f, 2.696683256e-01f, 2.711451595e-01f,
+  2.726213554e-01f, 2.740969099e-01f, 2.755718193e-01f, 2.770460803e-01f, 2.785196894e-01f, 2.799926431e-01f,
+  2.814649379e-01f, 2.829365705e-01f, 2.844075372e-01f, 2.858778347e-01f, 2.873474595e-01f, 2.888164082e-01f,
+  2.902846773e-01f, 2.917522632e-01f, 2.932191627e-01f, 2.946853722e-01f, 2.961508882e-01f, 2.976157074e-01f,
+  2.990798263e-01f, 3.005432414e-01f, 3.020059493e-01f, 3.034679466e-01f, 3.049292297e-01f, 3.063897954e-01f,
+  3.078496400e-01f, 3.093087603e-01f, 3.107671527e-01f, 3.122248139e-01f, 3.136817404e-01f, 3.151379288e-01f,
+  3.165933756e-01f, 3.180480774e-01f, 3.195020308e-01f, 3.209552324e-01f, 3.224076788e-01f, 3.238593665e-01f,
+  3.253102922e-01f, 3.267604523e-01f, 3.282098436e-01f, 3.296584625e-01f, 3.311063058e-01f, 3.325533699e-01f,
+  3.339996514e-01f, 3.354451471e-01f, 3.368898534e-01f, 3.383337670e-01f, 3.397768844e-01f, 3.412192023e-01f,
+  3.426607173e-01f, 3.441014260e-01f, 3.455413250e-01f, 3.469804108e-01f, 3.484186802e-01f, 3.498561298e-01f,
+  3.512927561e-01f, 3.527285558e-01f, 3.541635254e-01f, 3.555976617e-01f, 3.570309612e-01f, 3.584634206e-01f,
+  3.598950365e-01f, 3.613258056e-01f, 3.627557244e-01f, 3.641847896e-01f, 3.656129978e-01f, 3.670403457e-01f,
+  3.684668300e-01f, 3.698924471e-01f, 3.713171940e-01f, 3.727410670e-01f, 3.741640630e-01f, 3.755861785e-01f,
+  3.770074102e-01f, 3.784277548e-01f, 3.798472089e-01f, 3.812657692e-01f, 3.826834324e-01f, 3.841001950e-01f,
+  3.855160538e-01f, 3.869310055e-01f, 3.883450467e-01f, 3.897581741e-01f, 3.911703843e-01f, 3.925816741e-01f,
+  3.939920401e-01f, 3.954014789e-01f, 3.968099874e-01f, 3.982175622e-01f, 3.996241998e-01f, 4.010298972e-01f,
+  4.024346509e-01f, 4.038384576e-01f, 4.052413140e-01f, 4.066432169e-01f, 4.080441629e-01f, 4.094441487e-01f,
+  4.108431711e-01f, 4.122412267e-01f, 4.136383122e-01f, 4.150344245e-01f, 4.164295601e-01f, 4.178237158e-01f,
+  4.192168884e-01f, 4.206090744e-01f, 4.220002708e-01f, 4.233904741e-01f, 4.247796812e-01f, 4.261678887e-01f,
+  4.275550934e-01f, 4.289412921e-01f, 4.303264813e-01f, 4.317106580e-01f, 4.330938189e-01f, 4.344759606e-01f,
+  4.358570799e-01f, 4.372371737e-01f, 4.386162385e-01f, 4.399942713e-01f, 4.413712687e-01f, 4.427472276e-01f,
+  4.441221446e-01f, 4.454960165e-01f, 4.468688402e-01f, 4.482406123e-01f, 4.496113297e-01f, 4.509809890e-01f,
+  4.523495872e-01f, 4.537171210e-01f, 4.550835871e-01f, 4.564489824e-01f, 4.578133036e-01f, 4.591765475e-01f,
+  4.605387110e-01f, 4.618997907e-01f, 4.632597836e-01f, 4.646186863e-01f, 4.659764958e-01f, 4.673332087e-01f,
+  4.686888220e-01f, 4.700433325e-01f, 4.713967368e-01f, 4.727490320e-01f, 4.741002147e-01f, 4.754502817e-01f,
+  4.767992301e-01f, 4.781470564e-01f, 4.794937577e-01f, 4.808393306e-01f, 4.821837721e-01f, 4.835270789e-01f,
+  4.848692480e-01f, 4.862102761e-01f, 4.875501601e-01f, 4.888888969e-01f, 4.902264833e-01f, 4.915629161e-01f,
+  4.928981922e-01f, 4.942323085e-01f, 4.955652618e-01f, 4.968970490e-01f, 4.982276670e-01f, 4.995571125e-01f,
+  5.008853826e-01f, 5.022124740e-01f, 5.035383837e-01f, 5.048631085e-01f, 5.061866453e-01f, 5.075089911e-01f,
+  5.088301425e-01f, 5.101500967e-01f, 5.114688504e-01f, 5.127864006e-01f, 5.141027442e-01f, 5.154178780e-01f,
+  5.167317990e-01f, 5.180445041e-01f, 5.193559902e-01f, 5.206662541e-01f, 5.219752929e-01f, 5.232831035e-01f,
+  5.245896827e-01f, 5.258950275e-01f, 5.271991348e-01f, 5.285020015e-01f, 5.298036247e-01f, 5.311040012e-01f,
+  5.324031279e-01f, 5.337010018e-01f, 5.349976199e-01f, 5.362929791e-01f, 5.375870763e-01f, 5.388799085e-01f,
+  5.401714727e-01f, 5.414617659e-01f, 5.427507849e-01f, 5.440385267e-01f, 5.453249884e-01f, 5.466101669e-01f,
+  5.478940592e-01f, 5.491766622e-01f, 5.504579729e-01f, 5.517379884e-01f, 5.530167056e-01f, 5.542941215e-01f,
+  5.555702330e-01f, 5.568450373e-01f, 5.581185312e-01f, 5.593907119e-01f, 5.606615762e-01f, 5.619311212e-01f,
+  5.631993440e-01f, 5.644662415e-01f, 5.657318108e-01f, 5.669960488e-01f, 5.682589527e-01f, 5.695205193e-01f,
+  5.707807459e-01f, 5.720396293e-01f, 5.732971667e-01f, 5.745533550e-01f, 5.758081914e-01f, 5.770616729e-01f,
+  5.783137964e-01f, 5.795645591e-01f, 5.808139581e-01f, 5.820619903e-01f, 5.833086529e-01f, 5.845539430e-01f,
+  5.857978575e-01f, 5.870403935e-01f, 5.882815482e-01f, 5.895213186e-01f, 5.907597019e-01f, 5.919966950e-01f,
+  5.932322950e-01f, 5.944664992e-01f, 5.956993045e-01f, 5.969307081e-01f, 5.981607070e-01f, 5.993892984e-01f,
+  6.006164794e-01f, 6.018422471e-01f, 6.030665985e-01f, 6.042895309e-01f, 6.055110414e-01f, 6.067311270e-01f,
+  6.079497850e-01f, 6.091670123e-01f, 6.103828063e-01f, 6.115971639e-01f, 6.128100824e-01f, 6.140215589e-01f,
+  6.152315906e-01f, 6.164401745e-01f, 6.176473079e-01f, 6.188529880e-01f, 6.200572118e-01f, 6.212599765e-01f,
+  6.224612794e-01f, 6.236611175e-01f, 6.248594881e-01f, 6.260563884e-01f, 6.272518155e-01f, 6.284457666e-01f,
+  6.296382389e-01f, 6.308292296e-01f, 6.320187359e-01f, 6.332067551e-01f, 6.343932842e-01f, 6.355783205e-01f,
+  6.367618612e-01f, 6.379439036e-01f, 6.391244449e-01f, 6.403034822e-01f, 6.414810128e-01f, 6.426570340e-01f,
+  6.438315429e-01f, 6.450045368e-01f, 6.461760130e-01f, 6.473459686e-01f, 6.485144010e-01f, 6.496813074e-01f,
+  6.508466850e-01f, 6.520105311e-01f, 6.531728430e-01f, 6.543336178e-01f, 6.554928530e-01f, 6.566505457e-01f,
+  6.578066933e-01f, 6.589612930e-01f, 6.601143421e-01f, 6.612658378e-01f, 6.624157776e-01f, 6.635641586e-01f,
+  6.647109782e-01f, 6.658562337e-01f, 6.669999223e-01f, 6.681420414e-01f, 6.692825883e-01f, 6.704215604e-01f,
+  6.715589548e-01f, 6.726947691e-01f, 6.738290004e-01f, 6.749616461e-01f, 6.760927036e-01f, 6.772221701e-01f,
+  6.783500431e-01f, 6.794763199e-01f, 6.806009978e-01f, 6.817240742e-01f, 6.828455464e-01f, 6.839654118e-01f,
+  6.850836678e-01f, 6.862003117e-01f, 6.873153409e-01f, 6.884287528e-01f, 6.895405447e-01f, 6.906507141e-01f,
+  6.917592584e-01f, 6.928661748e-01f, 6.939714609e-01f, 6.950751140e-01f, 6.961771315e-01f, 6.972775108e-01f,
+  6.983762494e-01f, 6.994733446e-01f, 7.005687939e-01f, 7.016625947e-01f, 7.027547445e-01f, 7.038452405e-01f,
+  7.049340804e-01f, 7.060212614e-01f, 7.071067812e-01f, 7.081906370e-01f, 7.092728264e-01f, 7.103533469e-01f,
+  7.114321957e-01f, 7.125093706e-01f, 7.135848688e-01f, 7.146586879e-01f, 7.157308253e-01f, 7.168012785e-01f,
+  7.178700451e-01f, 7.189371224e-01f, 7.200025080e-01f, 7.210661993e-01f, 7.221281939e-01f, 7.231884893e-01f,
+  7.242470830e-01f, 7.253039724e-01f, 7.263591551e-01f, 7.274126286e-01f, 7.284643904e-01f, 7.295144381e-01f,
+  7.305627692e-01f, 7.316093812e-01f, 7.326542717e-01f, 7.336974381e-01f, 7.347388781e-01f, 7.357785892e-01f,
+  7.368165689e-01f, 7.378528148e-01f, 7.388873245e-01f, 7.399200955e-01f, 7.409511254e-01f, 7.419804117e-01f,
+  7.430079521e-01f, 7.440337442e-01f, 7.450577854e-01f, 7.460800735e-01f, 7.471006060e-01f, 7.481193805e-01f,
+  7.491363945e-01f, 7.501516458e-01f, 7.511651319e-01f, 7.521768504e-01f, 7.531867990e-01f, 7.541949753e-01f,
+  7.552013769e-01f, 7.562060014e-01f, 7.572088465e-01f, 7.582099098e-01f, 7.592091890e-01f, 7.602066817e-01f,
+  7.612023855e-01f, 7.621962981e-01f, 7.631884173e-01f, 7.641787405e-01f, 7.651672656e-01f, 7.661539902e-01f,
+  7.671389119e-01f, 7.681220285e-01f, 7.691033376e-01f, 7.700828370e-01f, 7.710605243e-01f, 7.720363972e-01f,
+  7.730104534e-01f, 7.739826906e-01f, 7.749531066e-01f, 7.759216990e-01f, 7.768884657e-01f, 7.778534042e-01f,
+  7.788165124e-01f, 7.797777879e-01f, 7.807372286e-01f, 7.816948321e-01f, 7.826505962e-01f, 7.836045186e-01f,
+  7.845565972e-01f, 7.855068296e-01f, 7.864552136e-01f, 7.874017470e-01f, 7.883464276e-01f, 7.892892532e-01f,
+  7.902302214e-01f, 7.911693302e-01f, 7.921065773e-01f, 7.930419605e-01f, 7.939754776e-01f, 7.949071263e-01f,
+  7.958369046e-01f, 7.967648102e-01f, 7.976908409e-01f, 7.986149946e-01f, 7.995372691e-01f, 8.004576622e-01f,
+  8.013761717e-01f, 8.022927955e-01f, 8.032075315e-01f, 8.041203774e-01f, 8.050313311e-01f, 8.059403906e-01f,
+  8.068475535e-01f, 8.077528179e-01f, 8.086561816e-01f, 8.095576424e-01f, 8.104571983e-01f, 8.113548470e-01f,
+  8.122505866e-01f, 8.131444148e-01f, 8.140363297e-01f, 8.149263291e-01f, 8.158144108e-01f, 8.167005729e-01f,
+  8.175848132e-01f, 8.184671296e-01f, 8.193475201e-01f, 8.202259826e-01f, 8.211025150e-01f, 8.219771153e-01f,
+  8.228497814e-01f, 8.237205112e-01f, 8.245893028e-01f, 8.254561540e-01f, 8.263210628e-01f, 8.271840273e-01f,
+  8.280450453e-01f, 8.289041148e-01f, 8.297612338e-01f, 8.306164003e-01f, 8.314696123e-01f, 8.323208678e-01f,
+  8.331701647e-01f, 8.340175011e-01f, 8.348628750e-01f, 8.357062844e-01f, 8.365477272e-01f, 8.373872016e-01f,
+  8.382247056e-01f, 8.390602371e-01f, 8.398937942e-01f, 8.407253750e-01f, 8.415549774e-01f, 8.423825996e-01f,
+  8.432082396e-01f, 8.440318955e-01f, 8.448535652e-01f, 8.456732470e-01f, 8.464909388e-01f, 8.473066387e-01f,
+  8.481203448e-01f, 8.489320552e-01f, 8.497417680e-01f, 8.505494813e-01f, 8.513551931e-01f, 8.521589016e-01f,
+  8.529606049e-01f, 8.537603011e-01f, 8.545579884e-01f, 8.553536647e-01f, 8.561473284e-01f, 8.569389774e-01f,
+  8.577286100e-01f, 8.585162243e-01f, 8.593018184e-01f, 8.600853904e-01f, 8.608669386e-01f, 8.616464611e-01f,
+  8.624239561e-01f, 8.631994217e-01f, 8.639728561e-01f, 8.647442575e-01f, 8.655136241e-01f, 8.662809540e-01f,
+  8.670462455e-01f, 8.678094968e-01f, 8.685707060e-01f, 8.693298713e-01f, 8.700869911e-01f, 8.708420635e-01f,
+  8.715950867e-01f, 8.723460589e-01f, 8.730949784e-01f, 8.738418435e-01f, 8.745866523e-01f, 8.753294031e-01f,
+  8.760700942e-01f, 8.768087238e-01f, 8.775452902e-01f, 8.782797917e-01f, 8.790122264e-01f, 8.797425928e-01f,
+  8.804708891e-01f, 8.811971135e-01f, 8.819212643e-01f, 8.826433400e-01f, 8.833633387e-01f, 8.840812587e-01f,
+  8.847970984e-01f, 8.855108561e-01f, 8.862225301e-01f, 8.869321188e-01f, 8.876396204e-01f, 8.883450333e-01f,
+  8.890483559e-01f, 8.897495864e-01f, 8.904487232e-01f, 8.911457648e-01f, 8.918407094e-01f, 8.925335554e-01f,
+  8.932243012e-01f, 8.939129451e-01f, 8.945994856e-01f, 8.952839210e-01f, 8.959662498e-01f, 8.966464702e-01f,
+  8.973245807e-01f, 8.980005797e-01f, 8.986744657e-01f, 8.993462370e-01f, 9.000158920e-01f, 9.006834292e-01f,
+  9.013488470e-01f, 9.020121439e-01f, 9.026733182e-01f, 9.033323685e-01f, 9.039892931e-01f, 9.046440906e-01f,
+  9.052967593e-01f, 9.059472978e-01f, 9.065957045e-01f, 9.072419779e-01f, 9.078861165e-01f, 9.085281187e-01f,
+  9.091679831e-01f, 9.098057081e-01f, 9.104412923e-01f, 9.110747341e-01f, 9.117060320e-01f, 9.123351846e-01f,
+  9.129621904e-01f, 9.135870479e-01f, 9.142097557e-01f, 9.148303122e-01f, 9.154487161e-01f, 9.160649658e-01f,
+  9.166790599e-01f, 9.172909970e-01f, 9.179007756e-01f, 9.185083943e-01f, 9.191138517e-01f, 9.197171463e-01f,
+  9.203182767e-01f, 9.209172415e-01f, 9.215140393e-01f, 9.221086687e-01f, 9.227011283e-01f, 9.232914167e-01f,
+  9.238795325e-01f, 9.244654743e-01f, 9.250492408e-01f, 9.256308305e-01f, 9.262102421e-01f, 9.267874743e-01f,
+  9.273625257e-01f, 9.279353948e-01f, 9.285060805e-01f, 9.290745813e-01f, 9.296408958e-01f, 9.302050229e-01f,
+  9.307669611e-01f, 9.313267091e-01f, 9.318842656e-01f, 9.324396293e-01f, 9.329927988e-01f, 9.335437730e-01f,
+  9.340925504e-01f, 9.346391298e-01f, 9.351835099e-01f, 9.357256895e-01f, 9.362656672e-01f, 9.368034417e-01f,
+  9.373390119e-01f, 9.378723764e-01f, 9.384035341e-01f, 9.389324835e-01f, 9.394592236e-01f, 9.399837530e-01f,
+  9.405060706e-01f, 9.410261751e-01f, 9.415440652e-01f, 9.420597398e-01f, 9.425731976e-01f, 9.430844375e-01f,
+  9.435934582e-01f, 9.441002585e-01f, 9.446048373e-01f, 9.451071933e-01f, 9.456073254e-01f, 9.461052324e-01f,
+  9.466009131e-01f, 9.470943664e-01f, 9.475855910e-01f, 9.480745859e-01f, 9.485613499e-01f, 9.490458819e-01f,
+  9.495281806e-01f, 9.500082450e-01f, 9.504860739e-01f, 9.509616663e-01f, 9.514350210e-01f, 9.519061368e-01f,
+  9.523750127e-01f, 9.528416476e-01f, 9.533060404e-01f, 9.537681899e-01f, 9.542280951e-01f, 9.546857549e-01f,
+  9.551411683e-01f, 9.555943341e-01f, 9.560452513e-01f, 9.564939189e-01f, 9.569403357e-01f, 9.573845008e-01f,
+  9.578264130e-01f, 9.582660714e-01f, 9.587034749e-01f, 9.591386225e-01f, 9.595715131e-01f, 9.600021457e-01f,
+  9.604305194e-01f, 9.608566331e-01f, 9.612804858e-01f, 9.617020765e-01f, 9.621214043e-01f, 9.625384680e-01f,
+  9.629532669e-01f, 9.633657998e-01f, 9.637760658e-01f, 9.641840640e-01f, 9.645897933e-01f, 9.649932529e-01f,
+  9.653944417e-01f, 9.657933589e-01f, 9.661900034e-01f, 9.665843745e-01f, 9.669764710e-01f, 9.673662922e-01f,
+  9.677538371e-01f, 9.681391047e-01f, 9.685220943e-01f, 9.689028048e-01f, 9.692812354e-01f, 9.696573851e-01f,
+  9.700312532e-01f, 9.704028387e-01f, 9.707721407e-01f, 9.711391584e-01f, 9.715038910e-01f, 9.718663375e-01f,
+  9.722264971e-01f, 9.725843689e-01f, 9.729399522e-01f, 9.732932461e-01f, 9.736442497e-01f, 9.739929622e-01f,
+  9.743393828e-01f, 9.746835107e-01f, 9.750253451e-01f, 9.753648851e-01f, 9.757021300e-01f, 9.760370790e-01f,
+  9.763697313e-01f, 9.767000861e-01f, 9.770281427e-01f, 9.773539001e-01f, 9.776773578e-01f, 9.779985149e-01f,
+  9.783173707e-01f, 9.786339244e-01f, 9.789481753e-01f, 9.792601226e-01f, 9.795697657e-01f, 9.798771037e-01f,
+  9.801821360e-01f, 9.804848618e-01f, 9.807852804e-01f, 9.810833912e-01f, 9.813791933e-01f, 9.816726862e-01f,
+  9.819638691e-01f, 9.822527414e-01f, 9.825393023e-01f, 9.828235512e-01f, 9.831054874e-01f, 9.833851103e-01f,
+  9.836624192e-01f, 9.839374134e-01f, 9.842100924e-01f, 9.844804554e-01f, 9.847485018e-01f, 9.850142310e-01f,
+  9.852776424e-01f, 9.855387353e-01f, 9.857975092e-01f, 9.860539633e-01f, 9.863080972e-01f, 9.865599103e-01f,
+  9.868094018e-01f, 9.870565713e-01f, 9.873014182e-01f, 9.875439418e-01f, 9.877841416e-01f, 9.880220171e-01f,
+  9.882575677e-01f, 9.884907929e-01f, 9.887216920e-01f, 9.889502645e-01f, 9.891765100e-01f, 9.894004278e-01f,
+  9.896220175e-01f, 9.898412785e-01f, 9.900582103e-01f, 9.902728124e-01f, 9.904850843e-01f, 9.906950254e-01f,
+  9.909026354e-01f, 9.911079137e-01f, 9.913108598e-01f, 9.915114733e-01f, 9.917097537e-01f, 9.919057004e-01f,
+  9.920993131e-01f, 9.922905913e-01f, 9.924795346e-01f, 9.926661424e-01f, 9.928504145e-01f, 9.930323502e-01f,
+  9.932119492e-01f, 9.933892111e-01f, 9.935641355e-01f, 9.937367219e-01f, 9.939069700e-01f, 9.940748793e-01f,
+  9.942404495e-01f, 9.944036801e-01f, 9.945645707e-01f, 9.947231211e-01f, 9.948793308e-01f, 9.950331994e-01f,
+  9.951847267e-01f, 9.953339121e-01f, 9.954807555e-01f, 9.956252564e-01f, 9.957674145e-01f, 9.959072294e-01f,
+  9.960447009e-01f, 9.961798286e-01f, 9.963126122e-01f, 9.964430514e-01f, 9.965711458e-01f, 9.966968952e-01f,
+  9.968202993e-01f, 9.969413578e-01f, 9.970600703e-01f, 9.971764367e-01f, 9.972904567e-01f, 9.974021299e-01f,
+  9.975114561e-01f, 9.976184351e-01f, 9.977230666e-01f, 9.978253504e-01f, 9.979252862e-01f, 9.980228738e-01f,
+  9.981181129e-01f, 9.982110034e-01f, 9.983015449e-01f, 9.983897374e-01f, 9.984755806e-01f, 9.985590742e-01f,
+  9.986402182e-01f, 9.987190122e-01f, 9.987954562e-01f, 9.988695499e-01f, 9.989412932e-01f, 9.990106859e-01f,
+  9.990777278e-01f, 9.991424187e-01f, 9.992047586e-01f, 9.992647473e-01f, 9.993223846e-01f, 9.993776704e-01f,
+  9.994306046e-01f, 9.994811870e-01f, 9.995294175e-01f, 9.995752960e-01f, 9.996188225e-01f, 9.996599967e-01f,
+  9.996988187e-01f, 9.997352883e-01f, 9.997694054e-01f, 9.998011699e-01f, 9.998305818e-01f, 9.998576410e-01f,
+  9.998823475e-01f, 9.999047011e-01f, 9.999247018e-01f, 9.999423497e-01f, 9.999576446e-01f, 9.999705864e-01f,
+  9.999811753e-01f, 9.999894111e-01f, 9.999952938e-01f, 9.999988235e-01f
+};
+
+//fft_cos in 1.31, const so it stays in flash
+static const int32_t fft_cos_q31[4096] = {
+   2147483647,  2147481121,  2147473542,  2147460908,  2147443222,  2147420483,  2147392690,  2147359845,
+   2147321946,  2147278995,  2147230991,  2147177934,  2147119825,  2147056664,  2146988450,  2146915184,
+   2146836866,  2146753497,  2146665076,  2146571603,  2146473080,  2146369505,  2146260881,  2146147205,
+   2146028480,  2145904705,  2145775880,  2145642006,  2145503083,  2145359112,  2145210092,  2145056025,
+   2144896910,  2144732748,  2144563539,  2144389283,  2144209982,  2144025635,  2143836244,  2143641807,
+   2143442326,  2143237802,  2143028234,  2142813624,  2142593971,  2142369276,  2142139541,  2141904764,
+   2141664948,  2141420092,  2141170197,  2140915264,  2140655293,  2140390284,  2140120240,  2139845159,
+   2139565043,  2139279892,  2138989708,  2138694490,  2138394240,  2138088958,  2137778644,  2137463301,
+   2137142927,  2136817525,  2136487095,  2136151637,  2135811153,  2135465642,  2135115107,  2134759548,
+   2134398966,  2134033361,  2133662734,  2133287087,  2132906420,  2132520734,  2132130030,  2131734309,
+   2131333572,  2130927819,  2130517052,  2130101272,  2129680480,  2129254676,  2128823862,  2128388038,
+   2127947206,  2127501367,  2127050522,  2126594672,  2126133817,  2125667960,  2125197100,  2124721240,
+   2124240380,  2123754522,  2123263666,  2122767814,  2122266967,  2121761126,  2121250292,  2120734467,
+   2120213651,  2119687847,  2119157054,  2118621275,  2118080511,  2117534762,  2116984031,  2116428319,
+   2115867626,  2115301954,  2114731305,  2114155680,  2113575080,  2112989506,  2112398960,  2111803444,
+   2111202959,  2110597505,  2109987085,  2109371700,  2108751352,  2108126041,  2107495770,  2106860540,
+   2106220352,  2105575208,  2104925109,  2104270057,  2103610054,  2102945101,  2102275199,  2101600350,
+   2100920556,  2100235819,  2099546139,  2098851519,  2098151960,  2097447464,  2096738032,  2096023667,
+   2095304370,  2094580142,  2093850985,  2093116901,  2092377892,  2091633960,  2090885105,  2090131331,
+   2089372638,  2088609029,  2087840505,  2087067068,  2086288720,  2085505463,  2084717298,  2083924228,
+   2083126254,  2082323379,  2081515603,  2080702930,  2079885360,  2079062896,  2078235540,  2077403294,
+   2076566160,  2075724139,  2074877233,  2074025446,  2073168777,  2072307231,  2071440808,  2070569511,
+   2069693342,  2068812302,  2067926394,  2067035621,  2066139983,  2065239484,  2064334124,  2063423908,
+   2062508835,  2061588910,  2060664133,  2059734508,  2058800036,  2057860719,  2056916560,  2055967560,
+   2055013723,  2054055050,  2053091544,  2052123207,  2051150040,  2050172048,  2049189231,  2048201592,
+   2047209133,  2046211857,  2045209767,  2044202863,  2043191150,  2042174628,  2041153301,  2040127172,
+   2039096241,  2038060512,  2037019988,  2035974670,  2034924562,  2033869665,  2032809982,  2031745516,
+   2030676269,  2029602243,  2028523442,  2027439867,  2026351522,  2025258408,  2024160529,  2023057887,
+   2021950484,  2020838323,  2019721407,  2018599739,  2017473321,  2016342155,  2015206245,  2014065592,
+   2012920201,  2011770073,  2010615210,  2009455617,  2008291295,  2007122248,  2005948478,  2004769987,
+   2003586779,  2002398857,  2001206222,  2000008879,  1998806829,  1997600076,  1996388622,  1995172471,
+   1993951625,  1992726087,  1991495860,  1990260946,  1989021350,  1987777073,  1986528118,  1985274489,
+   1984016189,  1982753220,  1981485585,  1980213288,  1978936331,  1977654717,  1976368450,  1975077532,
+   1973781967,  1972481757,  1971176906,  1969867417,  1968553292,  1967234535,  1965911148,  1964583136,
+   1963250501,  1961913246,  1960571375,  1959224890,  1957873796,  1956518093,  1955157788,  1953792881,
+   1952423377,  1951049279,  1949670589,  1948287312,  1946899451,  1945507008,  1944109987,  1942708392,
+   1941302225,  1939891490,  1938476190,  1937056329,  1935631910,  1934202936,  1932769411,  1931331338,
+   1929888720,  1928441561,  1926989864,  1925533633,  1924072871,  1922607581,  1921137767,  1919663432,
+   1918184581,  1916701216,  1915213340,  1913720958,  1912224073,  1910722688,  1909216806,  1907706433,
+   1906191570,  1904672222,  1903148392,  1901620084,  1900087301,  1898550047,  1897008325,  1895462140,
+   1893911494,  1892356392,  1890796837,  1889232832,  1887664383,  1886091491,  1884514161,  1882932397,
+   1881346202,  1879755580,  1878160535,  1876561070,  1874957189,  1873348897,  1871736196,  1870119091,
+   1868497586,  1866871683,  1865241388,  1863606704,  1861967634,  1860324183,  1858676355,  1857024153,
+   1855367581,  1853706643,  1852041343,  1850371686,  1848697674,  1847019312,  1845336604,  1843649553,
+   1841958164,  1840262441,  1838562388,  1836858008,  1835149306,  1833436286,  1831718951,  1829997307,
+   1828271356,  1826541103,  1824806552,  1823067707,  1821324572,  1819577151,  1817825449,  1816069469,
+   1814309216,  1812544694,  1810775906,  1809002858,  1807225553,  1805443995,  1803658189,  1801868139,
+   1800073849,  1798275323,  1796472565,  1794665580,  1792854372,  1791038946,  1789219305,  1787395453,
+   1785567396,  1783735137,  1781898681,  1780058032,  1778213194,  1776364172,  1774510970,  1772653593,
+   1770792044,  1768926328,  1767056450,  1765182414,  1763304224,  1761421885,  1759535401,  1757644777,
+   1755750017,  1753851126,  1751948107,  1750040966,  1748129707,  1746214334,  1744294853,  1742371267,
+   1740443581,  1738511799,  1736575927,  1734635968,  1732691928,  1730743810,  1728791620,  1726835361,
+   1724875040,  1722910659,  1720942225,  1718969740,  1716993211,  1715012642,  1713028037,  1711039401,
+   1709046739,  1707050055,  1705049355,  1703044642,  1701035922,  1699023199,  1697006479,  1694985765,
+   1692961062,  1690932376,  1688899711,  1686863072,  1684822463,  1682777890,  1680729357,  1678676870,
+   1676620432,  1674560049,  1672495725,  1670427466,  1668355276,  1666279161,  1664199124,  1662115172,
+   1660027308,  1657935539,  1655839867,  1653740300,  1651636841,  1649529496,  1647418269,  1645303166,
+   1643184191,  1641061349,  1638934646,  1636804087,  1634669676,  1632531418,  1630389319,  1628243383,
+   1626093616,  1623940023,  1621782608,  1619621377,  1617456335,  1615287487,  1613114838,  1610938393,
+   1608758157,  1606574136,  1604386335,  1602194758,  1599999411,  1597800299,  1595597428,  1593390801,
+   1591180426,  1588966306,  1586748447,  1584526854,  1582301533,  1580072489,  1577839726,  1575603251,
+   1573363068,  1571119183,  1568871601,  1566620327,  1564365367,  1562106725,  1559844408,  1557578421,
+   1555308768,  1553035455,  1550758488,  1548477872,  1546193612,  1543905714,  1541614183,  1539319024,
+   1537020244,  1534717846,  1532411837,  1530102222,  1527789007,  1525472197,  1523151797,  1520827813,
+   1518500250,  1516169114,  1513834411,  1511496145,  1509154322,  1506808949,  1504460029,  1502107570,
+   1499751576,  1497392053,  1495029006,  1492662441,  1490292364,  1487918781,  1485541696,  1483161115,
+   1480777044,  1478389489,  1475998456,  1473603949,  1471205974,  1468804538,  1466399645,  1463991302,
+   1461579514,  1459164286,  1456745625,  1454323536,  1451898025,  1449469098,  1447036760,  1444601017,
+   1442161874,  1439719338,  1437273414,  1434824109,  1432371426,  1429915374,  1427455956,  1424993180,
+   1422527051,  1420057574,  1417584755,  1415108601,  1412629117,  1410146309,  1407660183,  1405170745,
+   1402678000,  1400181954,  1397682613,  1395179984,  1392674072,  1390164882,  1387652422,  1385136696,
+   1382617710,  1380095472,  1377569986,  1375041258,  1372509294,  1369974101,  1367435685,  1364894050,
+   1362349204,  1359801152,  1357249901,  1354695455,  1352137822,  1349577007,  1347013017,  1344445857,
+   1341875533,  1339302052,  1336725419,  1334145641,  1331562723,  1328976672,  1326387494,  1323795195,
+   1321199781,  1318601257,  1315999631,  1313394909,  1310787095,  1308176198,  1305562222,  1302945174,
+   1300325060,  1297701886,  1295075659,  1292446384,  1289814068,  1287178717,  1284540337,  1281898935,
+   1279254516,  1276607086,  1273956653,  1271303222,  1268646800,  1265987392,  1263325005,  1260659646,
+   1257991320,  1255320034,  1252645794,  1249968606,  1247288478,  1244605414,  1241919421,  1239230506,
+   1236538675,  1233843935,  1231146291,  1228445750,  1225742318,  1223036002,  1220326809,  1217614743,
+   1214899813,  1212182024,  1209461382,  1206737894,  1204011567,  1201282407,  1198550419,  1195815612,
+   1193077991,  1190337562,  1187594332,  1184848308,  1182099496,  1179347902,  1176593533,  1173836395,
+   1171076495,  1168313840,  1165548435,  1162780288,  1160009405,  1157235792,  1154459456,  1151680403,
+   1148898640,  1146114174,  1143327011,  1140537158,  1137744621,  1134949406,  1132151521,  1129350972,
+   1126547765,  1123741908,  1120933406,  1118122267,  1115308496,  1112492101,  1109673089,  1106851465,
+   1104027237,  1101200410,  1098370993,  1095538991,  1092704411,  1089867259,  1087027544,  1084185270,
+   1081340445,  1078493076,  1075643169,  1072790730,  1069935768,  1067078288,  1064218296,  1061355801,
+   1058490808,  1055623324,  1052753357,  1049880912,  1047005996,  1044128617,  1041248781,  1038366495,
+   1035481766,  1032594600,  1029705004,  1026812985,  1023918550,  1021021705,  1018122458,  1015220816,
+   1012316784,  1009410370,  1006501581,  1003590424,  1000676905,   997761031,   994842810,   991922248,
+    988999351,   986074127,   983146583,   980216726,   977284562,   974350098,   971413342,   968474300,
+    965532978,   962589385,   959643527,   956695411,   953745043,   950792431,   947837582,   944880503,
+    941921200,   938959681,   935995952,   933030021,   930061894,   927091579,   924119082,   921144411,
+    918167572,   915188572,   912207419,   909224120,   906238681,   903251110,   900261413,   897269597,
+    894275671,   891279640,   888281512,   885281293,   882278992,   879274614,   876268167,   873259659,
+    870249095,   867236484,   864221832,   861205147,   858186435,   855165703,   852142959,   849118210,
+    846091463,   843062726,   840032004,   836999305,   833964638,   830928007,   827889422,   824848888,
+    821806413,   818762005,   815715670,   812667415,   809617249,   806565177,   803511207,   800455346,
+    797397602,   794337982,   791276492,   788213141,   785147934,   782080880,   779011986,   775941259,
+    772868706,   769794334,   766718151,   763640164,   760560380,   757478806,   754395449,   751310318,
+    748223418,   745134758,   742044345,   738952186,   735858287,   732762657,   729665303,   726566232,
+    723465451,   720362968,   717258790,   714152924,   711045377,   707936158,   704825272,   701712728,
+    698598533,   695482694,   692365218,   689246113,   686125387,   683003045,   679879097,   676753549,
+    673626408,   670497682,   667367379,   664235505,   661102068,   657967075,   654830535,   651692453,
+    648552838,   645411696,   642269036,   639124865,   635979190,   632832018,   629683357,   626533215,
+    623381598,   620228514,   617073971,   613917975,   610760536,   607601658,   604441352,   601279623,
+    598116479,   594951927,   591785976,   588618632,   585449903,   582279796,   579108320,   575935480,
+    572761285,   569585743,   566408860,   563230645,   560051104,   556870245,   553688076,   550504604,
+    547319836,   544133781,   540946445,   537757837,   534567963,   531376831,   528184449,   524990824,
+    521795963,   518599875,   515402566,   512204045,   509004318,   505803394,   502601279,   499397982,
+    496193509,   492987869,   489781069,   486573117,   483364019,   480153784,   476942419,   473729932,
+    470516330,   467301622,   464085813,   460868912,   457650927,   454431865,   451211734,   447990541,
+    444768294,   441545000,   438320667,   435095303,   431868915,   428641511,   425413098,   422183684,
+    418953276,   415721883,   412489512,   409256170,   406021865,   402786604,   399550396,   396313247,
+    393075166,   389836160,   386596237,   383355404,   380113669,   376871039,   373627523,   370383128,
+    367137861,   363891730,   360644742,   357396906,   354148230,   350898719,   347648383,   344397230,
+    341145265,   337892498,   334638936,   331384586,   328129457,   324873555,   321616889,   318359466,
+    315101295,   311842381,   308582734,   305322361,   302061269,   298799466,   295536961,   292273760,
+    289009871,   285745302,   282480061,   279214155,   275947592,   272680379,   269412525,   266144038,
+    262874923,   259605191,   256334847,   253063900,   249792358,   246520228,   243247518,   239974235,
+    236700388,   233425984,   230151030,   226875535,   223599506,   220322951,   217045878,   213768293,
+    210490206,   207211624,   203932553,   200653003,   197372981,   194092495,   190811551,   187530159,
+    184248325,   180966058,   177683365,   174400254,   171116733,   167832808,   164548489,   161263783,
+    157978697,   154693240,   151407418,   148121241,   144834714,   141547847,   138260647,   134973122,
+    131685278,   128397125,   125108670,   121819921,   118530885,   115241570,   111951983,   108662134,
+    105372028,   102081675,    98791081,    95500255,    92209205,    88917937,    85626460,    82334782,
+     79042909,    75750851,    72458615,    69166208,    65873638,    62580914,    59288042,    55995030,
+     52701887,    49408620,    46115236,    42821744,    39528151,    36234466,    32940695,    29646846,
+     26352928,    23058947,    19764913,    16470832,    13176712,     9882561,     6588387,     3294197,
+            0,    -3294197,    -6588387,    -9882561,   -13176712,   -16470832,   -19764913,   -23058947,
+    -26352928,   -29646846,   -32940695,   -36234466,   -39528151,   -42821744,   -46115236,   -49408620,
+    -52701887,   -55995030,   -59288042,   -62580914,   -65873638,   -69166208,   -72458615,   -75750851,
+    -79042909,   -82334782,   -85626460,   -88917937,   -92209205,   -95500255,   -98791081,  -102081675,
+   -105372028,  -108662134,  -111951983,  -115241570,  -118530885,  -121819921,  -125108670,  -128397125,
+   -131685278,  -134973122,  -138260647,  -141547847,  -144834714,  -148121241,  -151407418,  -154693240,
+   -157978697,  -161263783,  -164548489,  -167832808,  -171116733,  -174400254,  -177683365,  -180966058,
+   -184248325,  -187530159,  -190811551,  -194092495,  -197372981,  -200653003,  -203932553,  -207211624,
+   -210490206,  -213768293,  -217045878,  -220322951,  -223599506,  -226875535,  -230151030,  -233425984,
+   -236700388,  -239974235,  -243247518,  -246520228,  -249792358,  -253063900,  -256334847,  -259605191,
+   -262874923,  -266144038,  -269412525,  -272680379,  -275947592,  -279214155,  -282480061,  -285745302,
+   -289009871,  -292273760,  -295536961,  -298799466,  -302061269,  -305322361,  -308582734,  -311842381,
+   -315101295,  -318359466,  -321616889,  -324873555,  -328129457,  -331384586,  -334638936,  -337892498,
+   -341145265,  -344397230,  -347648383,  -350898719,  -354148230,  -357396906,  -360644742,  -363891730,
+   -367137861,  -370383128,  -373627523,  -376871039,  -380113669,  -383355404,  -386596237,  -389836160,
+   -393075166,  -396313247,  -399550396,  -402786604,  -406021865,  -409256170,  -412489512,  -415721883,
+   -418953276,  -422183684,  -425413098,  -428641511,  -431868915,  -435095303,  -438320667,  -441545000,
+   -444768294,  -447990541,  -451211734,  -454431865,  -457650927,  -460868912,  -464085813,  -467301622,
+   -470516330,  -473729932,  -476942419,  -480153784,  -483364019,  -486573117,  -489781069,  -492987869,
+   -496193509,  -499397982,  -502601279,  -505803394,  -509004318,  -512204045,  -515402566,  -518599875,
+   -521795963,  -524990824,  -528184449,  -531376831,  -534567963,  -537757837,  -540946445,  -544133781,
+   -547319836,  -550504604,  -553688076,  -556870245,  -560051104,  -563230645,  -566408860,  -569585743,
+   -572761285,  -575935480,  -579108320,  -582279796,  -585449903,  -588618632,  -591785976,  -594951927,
+   -598116479,  -601279623,  -604441352,  -607601658,  -610760536,  -613917975,  -617073971,  -620228514,
+   -623381598,  -626533215,  -629683357,  -632832018,  -635979190,  -639124865,  -642269036,  -645411696,
+   -648552838,  -651692453,  -654830535,  -657967075,  -661102068,  -664235505,  -667367379,  -670497682,
+   -673626408,  -676753549,  -679879097,  -683003045,  -686125387,  -689246113,  -692365218,  -695482694,
+   -698598533,  -701712728,  -704825272,  -707936158,  -711045377,  -714152924,  -717258790,  -720362968,
+   -723465451,  -726566232,  -729665303,  -732762657,  -735858287,  -738952186,  -742044345,  -745134758,
+   -748223418,  -751310318,  -754395449,  -757478806,  -760560380,  -763640164,  -766718151,  -769794334,
+   -772868706,  -775941259,  -779011986,  -782080880,  -785147934,  -788213141,  -791276492,  -794337982,
+   -797397602,  -800455346,  -803511207,  -806565177,  -809617249,  -812667415,  -815715670,  -818762005,
+   -821806413,  -824848888,  -827889422,  -830928007,  -833964638,  -836999305,  -840032004,  -843062726,
+   -846091463,  -849118210,  -852142959,  -855165703,  -858186435,  -861205147,  -864221832,  -867236484,
+   -870249095,  -873259659,  -876268167,  -879274614,  -882278992,  -885281293,  -888281512,  -891279640,
+   -894275671,  -897269597,  -900261413,  -903251110,  -906238681,  -909224120,  -912207419,  -915188572,
+   -918167572,  -921144411,  -924119082,  -927091579,  -930061894,  -933030021,  -935995952,  -938959681,
+   -941921200,  -944880503,  -947837582,  -950792431,  -953745043,  -956695411,  -959643527,  -962589385,
+   -965532978,  -968474300,  -971413342,  -974350098,  -977284562,  -980216726,  -983146583,  -986074127,
+   -988999351,  -991922248,  -994842810,  -997761031, -1000676905, -1003590424, -1006501581, -1009410370,
+  -1012316784, -1015220816, -1018122458, -1021021705, -1023918550, -1026812985, -1029705004, -1032594600,
+  -1035481766, -1038366495, -1041248781, -1044128617, -1047005996, -1049880912, -1052753357, -1055623324,
+  -1058490808, -1061355801, -1064218296, -1067078288, -1069935768, -1072790730, -1075643169, -1078493076,
+  -1081340445, -1084185270, -1087027544, -1089867259, -1092704411, -1095538991, -1098370993, -1101200410,
+  -1104027237, -1106851465, -1109673089, -1112492101, -1115308496, -1118122267, -1120933406, -1123741908,
+  -1126547765, -1129350972, -1132151521, -1134949406, -1137744621, -1140537158, -1143327011, -1146114174,
+  -1148898640, -1151680403, -1154459456, -1157235792, -1160009405, -1162780288, -1165548435, -1168313840,
+  -1171076495, -1173836395, -1176593533, -1179347902, -1182099496, -1184848308, -1187594332, -1190337562,
+  -1193077991, -1195815612, -1198550419, -1201282407, -1204011567, -1206737894, -1209461382, -1212182024,
+  -1214899813, -1217614743, -1220326809, -1223036002, -1225742318, -1228445750, -1231146291, -1233843935,
+  -1236538675, -1239230506, -1241919421, -1244605414, -1247288478, -1249968606, -1252645794, -1255320034,
+  -1257991320, -1260659646, -1263325005, -1265987392, -1268646800, -1271303222, -1273956653, -1276607086,
+  -1279254516, -1281898935, -1284540337, -1287178717, -1289814068, -1292446384, -1295075659, -1297701886,
+  -1300325060, -1302945174, -1305562222, -1308176198, -1310787095, -1313394909, -1315999631, -1318601257,
+  -1321199781, -1323795195, -1326387494, -1328976672, -1331562723, -1334145641, -1336725419, -1339302052,
+  -1341875533, -1344445857, -1347013017, -1349577007, -1352137822, -1354695455, -1357249901, -1359801152,
+  -1362349204, -1364894050, -1367435685, -1369974101, -1372509294, -1375041258, -1377569986, -1380095472,
+  -1382617710, -1385136696, -1387652422, -1390164882, -1392674072, -1395179984, -1397682613, -1400181954,
+  -1402678000, -1405170745, -1407660183, -1410146309, -1412629117, -1415108601, -1417584755, -1420057574,
+  -1422527051, -1424993180, -1427455956, -1429915374, -1432371426, -1434824109, -1437273414, -1439719338,
+  -1442161874, -1444601017, -1447036760, -1449469098, -1451898025, -1454323536, -1456745625, -1459164286,
+  -1461579514, -1463991302, -1466399645, -1468804538, -1471205974, -1473603949, -1475998456, -1478389489,
+  -1480777044, -1483161115, -1485541696, -1487918781, -1490292364, -1492662441, -1495029006, -1497392053,
+  -1499751576, -1502107570, -1504460029, -1506808949, -1509154322, -1511496145, -1513834411, -1516169114,
+  -1518500250, -1520827813, -1523151797, -1525472197, -1527789007, -1530102222, -1532411837, -1534717846,
+  -1537020244, -1539319024, -1541614183, -1543905714, -1546193612, -1548477872, -1550758488, -1553035455,
+  -1555308768, -1557578421, -1559844408, -1562106725, -1564365367, -1566620327, -1568871601, -1571119183,
+  -1573363068, -1575603251, -1577839726, -1580072489, -1582301533, -1584526854, -1586748447, -1588966306,
+  -1591180426, -1593390801, -1595597428, -1597800299, -1599999411, -1602194758, -1604386335, -1606574136,
+  -1608758157, -1610938393, -1613114838, -1615287487, -1617456335, -1619621377, -1621782608, -1623940023,
+  -1626093616, -1628243383, -1630389319, -1632531418, -1634669676, -1636804087, -1638934646, -1641061349,
+  -1643184191, -1645303166, -1647418269, -1649529496, -1651636841, -1653740300, -1655839867, -1657935539,
+  -1660027308, -1662115172, -1664199124, -1666279161, -1668355276, -1670427466, -1672495725, -1674560049,
+  -1676620432, -1678676870, -1680729357, -1682777890, -1684822463, -1686863072, -1688899711, -1690932376,
+  -1692961062, -1694985765, -1697006479, -1699023199, -1701035922, -1703044642, -1705049355, -1707050055,
+  -1709046739, -1711039401, -1713028037, -1715012642, -1716993211, -1718969740, -1720942225, -1722910659,
+  -1724875040, -1726835361, -1728791620, -1730743810, -1732691928, -1734635968, -1736575927, -1738511799,
+  -1740443581, -1742371267, -1744294853, -1746214334, -1748129707, -1750040966, -1751948107, -1753851126,
+  -1755750017, -1757644777, -1759535401, -1761421885, -1763304224, -1765182414, -1767056450, -1768926328,
+  -1770792044, -1772653593, -1774510970, -1776364172, -1778213194, -1780058032, -1781898681, -1783735137,
+  -1785567396, -1787395453, -1789219305, -1791038946, -1792854372, -1794665580, -1796472565, -1798275323,
+  -1800073849, -1801868139, -1803658189, -1805443995, -1807225553, -1809002858, -1810775906, -1812544694,
+  -1814309216, -1816069469, -1817825449, -1819577151, -1821324572, -1823067707, -1824806552, -1826541103,
+  -1828271356, -1829997307, -1831718951, -1833436286, -1835149306, -1836858008, -1838562388, -1840262441,
+  -1841958164, -1843649553, -1845336604, -1847019312, -1848697674, -1850371686, -1852041343, -1853706643,
+  -1855367581, -1857024153, -1858676355, -1860324183, -1861967634, -1863606704, -1865241388, -1866871683,
+  -1868497586, -1870119091, -1871736196, -1873348897, -1874957189, -1876561070, -1878160535, -1879755580,
+  -1881346202, -1882932397, -1884514161, -1886091491, -1887664383, -1889232832, -1890796837, -1892356392,
+  -1893911494, -1895462140, -1897008325, -1898550047, -1900087301, -1901620084, -1903148392, -1904672222,
+  -1906191570, -1907706433, -1909216806, -1910722688, -1912224073, -1913720958, -1915213340, -1916701216,
+  -1918184581, -1919663432, -1921137767, -1922607581, -1924072871, -1925533633, -1926989864, -1928441561,
+  -1929888720, -1931331338, -1932769411, -1934202936, -1935631910, -1937056329, -1938476190, -1939891490,
+  -1941302225, -1942708392, -1944109987, -1945507008, -1946899451, -1948287312, -1949670589, -1951049279,
+  -1952423377, -1953792881, -1955157788, -1956518093, -1957873796, -1959224890, -1960571375, -1961913246,
+  -1963250501, -1964583136, -1965911148, -1967234535, -1968553292, -1969867417, -1971176906, -1972481757,
+  -1973781967, -1975077532, -1976368450, -1977654717, -1978936331, -1980213288, -1981485585, -1982753220,
+  -1984016189, -1985274489, -1986528118, -1987777073, -1989021350, -1990260946, -1991495860, -1992726087,
+  -1993951625, -1995172471, -1996388622, -1997600076, -1998806829, -2000008879, -2001206222, -2002398857,
+  -2003586779, -2004769987, -2005948478, -2007122248, -2008291295, -2009455617, -2010615210, -2011770073,
+  -2012920201, -2014065592, -2015206245, -2016342155, -2017473321, -2018599739, -2019721407, -2020838323,
+  -2021950484, -2023057887, -2024160529, -2025258408, -2026351522, -2027439867, -2028523442, -2029602243,
+  -2030676269, -2031745516, -2032809982, -2033869665, -2034924562, -2035974670, -2037019988, -2038060512,
+  -2039096241, -2040127172, -2041153301, -2042174628, -2043191150, -2044202863, -2045209767, -2046211857,
+  -2047209133, -2048201592, -2049189231, -2050172048, -2051150040, -2052123207, -2053091544, -2054055050,
+  -2055013723, -2055967560, -2056916560, -2057860719, -2058800036, -2059734508, -2060664133, -2061588910,
+  -2062508835, -2063423908, -2064334124, -2065239484, -2066139983, -2067035621, -2067926394, -2068812302,
+  -2069693342, -2070569511, -2071440808, -2072307231, -2073168777, -2074025446, -2074877233, -2075724139,
+  -2076566160, -2077403294, -2078235540, -2079062896, -2079885360, -2080702930, -2081515603, -2082323379,
+  -2083126254, -2083924228, -2084717298, -2085505463, -2086288720, -2087067068, -2087840505, -2088609029,
+  -2089372638, -2090131331, -2090885105, -2091633960, -2092377892, -2093116901, -2093850985, -2094580142,
+  -2095304370, -2096023667, -2096738032, -2097447464, -2098151960, -2098851519, -2099546139, -2100235819,
+  -2100920556, -2101600350, -2102275199, -2102945101, -2103610054, -2104270057, -2104925109, -2105575208,
+  -2106220352, -2106860540, -2107495770, -2108126041, -2108751352, -2109371700, -2109987085, -2110597505,
+  -2111202959, -2111803444, -2112398960, -2112989506, -2113575080, -2114155680, -2114731305, -2115301954,
+  -2115867626, -2116428319, -2116984031, -2117534762, -2118080511, -2118621275, -2119157054, -2119687847,
+  -2120213651, -2120734467, -2121250292, -2121761126, -2122266967, -2122767814, -2123263666, -2123754522,
+  -2124240380, -2124721240, -2125197100, -2125667960, -2126133817, -2126594672, -2127050522, -2127501367,
+  -2127947206, -2128388038, -2128823862, -2129254676, -2129680480, -2130101272, -2130517052, -2130927819,
+  -2131333572, -2131734309, -2132130030, -2132520734, -2132906420, -2133287087, -2133662734, -2134033361,
+  -2134398966, -2134759548, -2135115107, -2135465642, -2135811153, -2136151637, -2136487095, -2136817525,
+  -2137142927, -2137463301, -2137778644, -2138088958, -2138394240, -2138694490, -2138989708, -2139279892,
+  -2139565043, -2139845159, -2140120240, -2140390284, -2140655293, -2140915264, -2141170197, -2141420092,
+  -2141664948, -2141904764, -2142139541, -2142369276, -2142593971, -2142813624, -2143028234, -2143237802,
+  -2143442326, -2143641807, -2143836244, -2144025635, -2144209982, -2144389283, -2144563539, -2144732748,
+  -2144896910, -2145056025, -2145210092, -2145359112, -2145503083, -2145642006, -2145775880, -2145904705,
+  -2146028480, -2146147205, -2146260881, -2146369505, -2146473080, -2146571603, -2146665076, -2146753497,
+  -2146836866, -2146915184, -2146988450, -2147056664, -2147119825, -2147177934, -2147230991, -2147278995,
+  -2147321946, -2147359845, -2147392690, -2147420483, -2147443222, -2147460908, -2147473542, -2147481121,
+  -2147483647, -2147481121, -2147473542, -2147460908, -2147443222, -2147420483, -2147392690, -2147359845,
+  -2147321946, -2147278995, -2147230991, -2147177934, -2147119825, -2147056664, -2146988450, -2146915184,
+  -2146836866, -2146753497, -2146665076, -2146571603, -2146473080, -2146369505, -2146260881, -2146147205,
+  -2146028480, -2145904705, -2145775880, -2145642006, -2145503083, -2145359112, -2145210092, -2145056025,
+  -2144896910, -2144732748, -2144563539, -2144389283, -2144209982, -2144025635, -2143836244, -2143641807,
+  -2143442326, -2143237802, -2143028234, -2142813624, -2142593971, -2142369276, -2142139541, -2141904764,
+  -2141664948, -2141420092, -2141170197, -2140915264, -2140655293, -2140390284, -2140120240, -2139845159,
+  -2139565043, -2139279892, -2138989708, -2138694490, -2138394240, -2138088958, -2137778644, -2137463301,
+  -2137142927, -2136817525, -2136487095, -2136151637, -2135811153, -2135465642, -2135115107, -2134759548,
+  -2134398966, -2134033361, -2133662734, -2133287087, -2132906420, -2132520734, -2132130030, -2131734309,
+  -2131333572, -2130927819, -2130517052, -2130101272, -2129680480, -2129254676, -2128823862, -2128388038,
+  -2127947206, -2127501367, -2127050522, -2126594672, -2126133817, -2125667960, -2125197100, -2124721240,
+  -2124240380, -2123754522, -2123263666, -2122767814, -2122266967, -2121761126, -2121250292, -2120734467,
+  -2120213651, -2119687847, -2119157054, -2118621275, -2118080511, -2117534762, -2116984031, -2116428319,
+  -2115867626, -2115301954, -2114731305, -2114155680, -2113575080, -2112989506, -2112398960, -2111803444,
+  -2111202959, -2110597505, -2109987085, -2109371700, -2108751352, -2108126041, -2107495770, -2106860540,
+  -2106220352, -2105575208, -2104925109, -2104270057, -2103610054, -2102945101, -2102275199, -2101600350,
+  -2100920556, -2100235819, -2099546139, -2098851519, -2098151960, -2097447464, -2096738032, -2096023667,
+  -2095304370, -2094580142, -2093850985, -2093116901, -2092377892, -2091633960, -2090885105, -2090131331,
+  -2089372638, -2088609029, -2087840505, -2087067068, -2086288720, -2085505463, -2084717298, -2083924228,
+  -2083126254, -2082323379, -2081515603, -2080702930, -2079885360, -2079062896, -2078235540, -2077403294,
+  -2076566160, -2075724139, -2074877233, -2074025446, -2073168777, -2072307231, -2071440808, -2070569511,
+  -2069693342, -2068812302, -2067926394, -2067035621, -2066139983, -2065239484, -2064334124, -2063423908,
+  -2062508835, -2061588910, -2060664133, -2059734508, -2058800036, -2057860719, -2056916560, -2055967560,
+  -2055013723, -2054055050, -2053091544, -2052123207, -2051150040, -2050172048, -2049189231, -2048201592,
+  -2047209133, -2046211857, -2045209767, -2044202863, -2043191150, -2042174628, -2041153301, -2040127172,
+  -2039096241, -2038060512, -2037019988, -2035974670, -2034924562, -2033869665, -2032809982, -2031745516,
+  -2030676269, -2029602243, -2028523442, -2027439867, -2026351522, -2025258408, -2024160529, -2023057887,
+  -2021950484, -2020838323, -2019721407, -2018599739, -2017473321, -2016342155, -2015206245, -2014065592,
+  -2012920201, -2011770073, -2010615210, -2009455617, -2008291295, -2007122248, -2005948478, -2004769987,
+  -2003586779, -2002398857, -2001206222, -2000008879, -1998806829, -1997600076, -1996388622, -1995172471,
+  -1993951625, -1992726087, -1991495860, -1990260946, -1989021350, -1987777073, -1986528118, -1985274489,
+  -1984016189, -1982753220, -1981485585, -1980213288, -1978936331, -1977654717, -1976368450, -1975077532,
+  -1973781967, -1972481757, -1971176906, -1969867417, -1968553292, -1967234535, -1965911148, -1964583136,
+  -1963250501, -1961913246, -1960571375, -1959224890, -1957873796, -1956518093, -1955157788, -1953792881,
+  -1952423377, -1951049279, -1949670589, -1948287312, -1946899451, -1945507008, -1944109987, -1942708392,
+  -1941302225, -1939891490, -1938476190, -1937056329, -1935631910, -1934202936, -1932769411, -1931331338,
+  -1929888720, -1928441561, -1926989864, -1925533633, -1924072871, -1922607581, -1921137767, -1919663432,
+  -1918184581, -1916701216, -1915213340, -1913720958, -1912224073, -1910722688, -1909216806, -1907706433,
+  -1906191570, -1904672222, -1903148392, -1901620084, -1900087301, -1898550047, -1897008325, -1895462140,
+  -1893911494, -1892356392, -1890796837, -1889232832, -1887664383, -1886091491, -1884514161, -1882932397,
+  -1881346202, -1879755580, -1878160535, -1876561070, -1874957189, -1873348897, -1871736196, -1870119091,
+  -1868497586, -1866871683, -1865241388, -1863606704, -1861967634, -1860324183, -1858676355, -1857024153,
+  -1855367581, -1853706643, -1852041343, -1850371686, -1848697674, -1847019312, -1845336604, -1843649553,
+  -1841958164, -1840262441, -1838562388, -1836858008, -1835149306, -1833436286, -1831718951, -1829997307,
+  -1828271356, -1826541103, -1824806552, -1823067707, -1821324572, -1819577151, -1817825449, -1816069469,
+  -1814309216, -1812544694, -1810775906, -1809002858, -1807225553, -1805443995, -1803658189, -1801868139,
+  -1800073849, -1798275323, -1796472565, -1794665580, -1792854372, -1791038946, -1789219305, -1787395453,
+  -1785567396, -1783735137, -1781898681, -1780058032, -1778213194, -1776364172, -1774510970, -1772653593,
+  -1770792044, -1768926328, -1767056450, -1765182414, -1763304224, -1761421885, -1759535401, -1757644777,
+  -1755750017, -1753851126, -1751948107, -1750040966, -1748129707, -1746214334, -1744294853, -1742371267,
+  -1740443581, -1738511799, -1736575927, -1734635968, -1732691928, -1730743810, -1728791620, -1726835361,
+  -1724875040, -1722910659, -1720942225, -1718969740, -1716993211, -1715012642, -1713028037, -1711039401,
+  -1709046739, -1707050055, -1705049355, -1703044642, -1701035922, -1699023199, -1697006479, -1694985765,
+  -1692961062, -1690932376, -1688899711, -1686863072, -1684822463, -1682777890, -1680729357, -1678676870,
+  -1676620432, -1674560049, -1672495725, -1670427466, -1668355276, -1666279161, -1664199124, -1662115172,
+  -1660027308, -1657935539, -1655839867, -1653740300, -1651636841, -1649529496, -1647418269, -1645303166,
+  -1643184191, -1641061349, -1638934646, -1636804087, -1634669676, -1632531418, -1630389319, -1628243383,
+  -1626093616, -1623940023, -1621782608, -1619621377, -1617456335, -1615287487, -1613114838, -1610938393,
+  -1608758157, -1606574136, -1604386335, -1602194758, -1599999411, -1597800299, -1595597428, -1593390801,
+  -1591180426, -1588966306, -1586748447, -1584526854, -1582301533, -1580072489, -1577839726, -1575603251,
+  -1573363068, -1571119183, -1568871601, -1566620327, -1564365367, -1562106725, -1559844408, -1557578421,
+  -1555308768, -1553035455, -1550758488, -1548477872, -1546193612, -1543905714, -1541614183, -1539319024,
+  -1537020244, -1534717846, -1532411837, -1530102222, -1527789007, -1525472197, -1523151797, -1520827813,
+  -1518500250, -1516169114, -1513834411, -1511496145, -1509154322, -1506808949, -1504460029, -1502107570,
+  -1499751576, -1497392053, -1495029006, -1492662441, -1490292364, -1487918781, -1485541696, -1483161115,
+  -1480777044, -1478389489, -1475998456, -1473603949, -1471205974, -1468804538, -1466399645, -1463991302,
+  -1461579514, -1459164286, -1456745625, -1454323536, -1451898025, -1449469098, -1447036760, -1444601017,
+  -1442161874, -1439719338, -1437273414, -1434824109, -1432371426, -1429915374, -1427455956, -1424993180,
+  -1422527051, -1420057574, -1417584755, -1415108601, -1412629117, -1410146309, -1407660183, -1405170745,
+  -1402678000, -1400181954, -1397682613, -1395179984, -1392674072, -1390164882, -1387652422, -1385136696,
+  -1382617710, -1380095472, -1377569986, -1375041258, -1372509294, -1369974101, -1367435685, -1364894050,
+  -1362349204, -1359801152, -1357249901, -1354695455, -1352137822, -1349577007, -1347013017, -1344445857,
+  -1341875533, -1339302052, -1336725419, -1334145641, -1331562723, -1328976672, -1326387494, -1323795195,
+  -1321199781, -1318601257, -1315999631, -1313394909, -1310787095, -1308176198, -1305562222, -1302945174,
+  -1300325060, -1297701886, -1295075659, -1292446384, -1289814068, -1287178717, -1284540337, -1281898935,
+  -1279254516, -1276607086, -1273956653, -1271303222, -1268646800, -1265987392, -1263325005, -1260659646,
+  -1257991320, -1255320034, -1252645794, -1249968606, -1247288478, -1244605414, -1241919421, -1239230506,
+  -1236538675, -1233843935, -1231146291, -1228445750, -1225742318, -1223036002, -1220326809, -1217614743,
+  -1214899813, -1212182024, -1209461382, -1206737894, -1204011567, -1201282407, -1198550419, -1195815612,
+  -1193077991, -1190337562, -1187594332, -1184848308, -1182099496, -1179347902, -1176593533, -1173836395,
+  -1171076495, -1168313840, -1165548435, -1162780288, -1160009405, -1157235792, -1154459456, -1151680403,
+  -1148898640, -1146114174, -1143327011, -1140537158, -1137744621, -1134949406, -1132151521, -1129350972,
+  -1126547765, -1123741908, -1120933406, -1118122267, -1115308496, -1112492101, -1109673089, -1106851465,
+  -1104027237, -1101200410, -1098370993, -1095538991, -1092704411, -1089867259, -1087027544, -1084185270,
+  -1081340445, -1078493076, -1075643169, -1072790730, -1069935768, -1067078288, -1064218296, -1061355801,
+  -1058490808, -1055623324, -1052753357, -1049880912, -1047005996, -1044128617, -1041248781, -1038366495,
+  -1035481766, -1032594600, -1029705004, -1026812985, -1023918550, -1021021705, -1018122458, -1015220816,
+  -1012316784, -1009410370, -1006501581, -1003590424, -1000676905,  -997761031,  -994842810,  -991922248,
+   -988999351,  -986074127,  -983146583,  -980216726,  -977284562,  -974350098,  -971413342,  -968474300,
+   -965532978,  -962589385,  -959643527,  -956695411,  -953745043,  -950792431,  -947837582,  -944880503,
+   -941921200,  -938959681,  -935995952,  -933030021,  -930061894,  -927091579,  -924119082,  -921144411,
+   -918167572,  -915188572,  -912207419,  -909224120,  -906238681,  -903251110,  -900261413,  -897269597,
+   -894275671,  -891279640,  -888281512,  -885281293,  -882278992,  -879274614,  -876268167,  -873259659,
+   -870249095,  -867236484,  -864221832,  -861205147,  -858186435,  -855165703,  -852142959,  -849118210,
+   -846091463,  -843062726,  -840032004,  -836999305,  -833964638,  -830928007,  -827889422,  -824848888,
+   -821806413,  -818762005,  -815715670,  -812667415,  -809617249,  -806565177,  -803511207,  -800455346,
+   -797397602,  -794337982,  -791276492,  -788213141,  -785147934,  -782080880,  -779011986,  -775941259,
+   -772868706,  -769794334,  -766718151,  -763640164,  -760560380,  -757478806,  -754395449,  -751310318,
+   -748223418,  -745134758,  -742044345,  -738952186,  -735858287,  -732762657,  -729665303,  -726566232,
+   -723465451,  -720362968,  -717258790,  -714152924,  -711045377,  -707936158,  -704825272,  -701712728,
+   -698598533,  -695482694,  -692365218,  -689246113,  -686125387,  -683003045,  -679879097,  -676753549,
+   -673626408,  -670497682,  -667367379,  -664235505,  -661102068,  -657967075,  -654830535,  -651692453,
+   -648552838,  -645411696,  -642269036,  -639124865,  -635979190,  -632832018,  -629683357,  -626533215,
+   -623381598,  -620228514,  -617073971,  -613917975,  -610760536,  -607601658,  -604441352,  -601279623,
+   -598116479,  -594951927,  -591785976,  -588618632,  -585449903,  -582279796,  -579108320,  -575935480,
+   -572761285,  -569585743,  -566408860,  -563230645,  -560051104,  -556870245,  -553688076,  -550504604,
+   -547319836,  -544133781,  -540946445,  -537757837,  -534567963,  -531376831,  -528184449,  -524990824,
+   -521795963,  -518599875,  -515402566,  -512204045,  -509004318,  -505803394,  -502601279,  -499397982,
+   -496193509,  -492987869,  -489781069,  -486573117,  -483364019,  -480153784,  -476942419,  -473729932,
+   -470516330,  -467301622,  -464085813,  -460868912,  -457650927,  -454431865,  -451211734,  -447990541,
+   -444768294,  -441545000,  -438320667,  -435095303,  -431868915,  -428641511,  -425413098,  -422183684,
+   -418953276,  -415721883,  -412489512,  -409256170,  -406021865,  -402786604,  -399550396,  -396313247,
+   -393075166,  -389836160,  -386596237,  -383355404,  -380113669,  -376871039,  -373627523,  -370383128,
+   -367137861,  -363891730,  -360644742,  -357396906,  -354148230,  -350898719,  -347648383,  -344397230,
+   -341145265,  -337892498,  -334638936,  -331384586,  -328129457,  -324873555,  -321616889,  -318359466,
+   -315101295,  -311842381,  -308582734,  -305322361,  -302061269,  -298799466,  -295536961,  -292273760,
+   -289009871,  -285745302,  -282480061,  -279214155,  -275947592,  -272680379,  -269412525,  -266144038,
+   -262874923,  -259605191,  -256334847,  -253063900,  -249792358,  -246520228,  -243247518,  -239974235,
+   -236700388,  -233425984,  -230151030,  -226875535,  -223599506,  -220322951,  -217045878,  -213768293,
+   -210490206,  -207211624,  -203932553,  -200653003,  -197372981,  -194092495,  -190811551,  -187530159,
+   -184248325,  -180966058,  -177683365,  -174400254,  -171116733,  -167832808,  -164548489,  -161263783,
+   -157978697,  -154693240,  -151407418,  -148121241,  -144834714,  -141547847,  -138260647,  -134973122,
+   -131685278,  -128397125,  -125108670,  -121819921,  -118530885,  -115241570,  -111951983,  -108662134,
+   -105372028,  -102081675,   -98791081,   -95500255,   -92209205,   -88917937,   -85626460,   -82334782,
+    -79042909,   -75750851,   -72458615,   -69166208,   -65873638,   -62580914,   -59288042,   -55995030,
+    -52701887,   -49408620,   -46115236,   -42821744,   -39528151,   -36234466,   -32940695,   -29646846,
+    -26352928,   -23058947,   -19764913,   -16470832,   -13176712,    -9882561,    -6588387,    -3294197,
+            0,     3294197,     6588387,     9882561,    13176712,    16470832,    19764913,    23058947,
+     26352928,    29646846,    32940695,    36234466,    39528151,    42821744,    46115236,    49408620,
+     52701887,    55995030,    59288042,    62580914,    65873638,    69166208,    72458615,    75750851,
+     79042909,    82334782,    85626460,    88917937,    92209205,    95500255,    98791081,   102081675,
+    105372028,   108662134,   111951983,   115241570,   118530885,   121819921,   125108670,   128397125,
+    131685278,   134973122,   138260647,   141547847,   144834714,   148121241,   151407418,   154693240,
+    157978697,   161263783,   164548489,   167832808,   171116733,   174400254,   177683365,   180966058,
+    184248325,   187530159,   190811551,   194092495,   197372981,   200653003,   203932553,   207211624,
+    210490206,   213768293,   217045878,   220322951,   223599506,   226875535,   230151030,   233425984,
+    236700388,   239974235,   243247518,   246520228,   249792358,   253063900,   256334847,   259605191,
+    262874923,   266144038,   269412525,   272680379,   275947592,   279214155,   282480061,   285745302,
+    289009871,   292273760,   295536961,   298799466,   302061269,   305322361,   308582734,   311842381,
+    315101295,   318359466,   321616889,   324873555,   328129457,   331384586,   334638936,   337892498,
+    341145265,   344397230,   347648383,   350898719,   354148230,   357396906,   360644742,   363891730,
+    367137861,   370383128,   373627523,   376871039,   380113669,   383355404,   386596237,   389836160,
+    393075166,   396313247,   399550396,   402786604,   406021865,   409256170,   412489512,   415721883,
+    418953276,   422183684,   425413098,   428641511,   431868915,   435095303,   438320667,   441545000,
+    444768294,   447990541,   451211734,   454431865,   457650927,   460868912,   464085813,   467301622,
+    470516330,   473729932,   476942419,   480153784,   483364019,   486573117,   489781069,   492987869,
+    496193509,   499397982,   502601279,   505803394,   509004318,   512204045,   515402566,   518599875,
+    521795963,   524990824,   528184449,   531376831,   534567963,   537757837,   540946445,   544133781,
+    547319836,   550504604,   553688076,   556870245,   560051104,   563230645,   566408860,   569585743,
+    572761285,   575935480,   579108320,   582279796,   585449903,   588618632,   591785976,   594951927,
+    598116479,   601279623,   604441352,   607601658,   610760536,   613917975,   617073971,   620228514,
+    623381598,   626533215,   629683357,   632832018,   635979190,   639124865,   642269036,   645411696,
+    648552838,   651692453,   654830535,   657967075,   661102068,   664235505,   667367379,   670497682,
+    673626408,   676753549,   679879097,   683003045,   686125387,   689246113,   692365218,   695482694,
+    698598533,   701712728,   704825272,   707936158,   711045377,   714152924,   717258790,   720362968,
+    723465451,   726566232,   729665303,   732762657,   735858287,   738952186,   742044345,   745134758,
+    748223418,   751310318,   754395449,   757478806,   760560380,   763640164,   766718151,   769794334,
+    772868706,   775941259,   779011986,   782080880,   785147934,   788213141,   791276492,   794337982,
+    797397602,   800455346,   803511207,   806565177,   809617249,   812667415,   815715670,   818762005,
+    821806413,   824848888,   827889422,   830928007,   833964638,   836999305,   840032004,   843062726,
+    846091463,   849118210,   852142959,   855165703,   858186435,   861205147,   864221832,   867236484,
+    870249095,   873259659,   876268167,   879274614,   882278992,   885281293,   888281512,   891279640,
+    894275671,   897269597,   900261413,   903251110,   906238681,   909224120,   912207419,   915188572,
+    918167572,   921144411,   924119082,   927091579,   930061894,   933030021,   935995952,   938959681,
+    941921200,   944880503,   947837582,   950792431,   953745043,   956695411,   959643527,   962589385,
+    965532978,   968474300,   971413342,   974350098,   977284562,   980216726,   983146583,   986074127,
+    988999351,   991922248,   994842810,   997761031,  1000676905,  1003590424,  1006501581,  1009410370,
+   1012316784,  1015220816,  1018122458,  1021021705,  1023918550,  1026812985,  1029705004,  1032594600,
+   1035481766,  1038366495,  1041248781,  1044128617,  1047005996,  1049880912,  1052753357,  1055623324,
+   1058490808,  1061355801,  1064218296,  1067078288,  1069935768,  1072790730,  1075643169,  1078493076,
+   1081340445,  1084185270,  1087027544,  1089867259,  1092704411,  1095538991,  1098370993,  1101200410,
+   1104027237,  1106851465,  1109673089,  1112492101,  1115308496,  1118122267,  1120933406,  1123741908,
+   1126547765,  1129350972,  1132151521,  1134949406,  1137744621,  1140537158,  1143327011,  1146114174,
+   1148898640,  1151680403,  1154459456,  1157235792,  1160009405,  1162780288,  1165548435,  1168313840,
+   1171076495,  1173836395,  1176593533,  1179347902,  1182099496,  1184848308,  1187594332,  1190337562,
+   1193077991,  1195815612,  1198550419,  1201282407,  1204011567,  1206737894,  1209461382,  1212182024,
+   1214899813,  1217614743,  1220326809,  1223036002,  1225742318,  1228445750,  1231146291,  1233843935,
+   1236538675,  1239230506,  1241919421,  1244605414,  1247288478,  1249968606,  1252645794,  1255320034,
+   1257991320,  1260659646,  1263325005,  1265987392,  1268646800,  1271303222,  1273956653,  1276607086,
+   1279254516,  1281898935,  1284540337,  1287178717,  1289814068,  1292446384,  1295075659,  1297701886,
+   1300325060,  1302945174,  1305562222,  1308176198,  1310787095,  1313394909,  1315999631,  1318601257,
+   1321199781,  1323795195,  1326387494,  1328976672,  1331562723,  1334145641,  1336725419,  1339302052,
+   1341875533,  1344445857,  1347013017,  1349577007,  1352137822,  1354695455,  1357249901,  1359801152,
+   1362349204,  1364894050,  1367435685,  1369974101,  1372509294,  1375041258,  1377569986,  1380095472,
+   1382617710,  1385136696,  1387652422,  1390164882,  1392674072,  1395179984,  1397682613,  1400181954,
+   1402678000,  1405170745,  1407660183,  1410146309,  1412629117,  1415108601,  1417584755,  1420057574,
+   1422527051,  1424993180,  1427455956,  1429915374,  1432371426,  1434824109,  1437273414,  1439719338,
+   1442161874,  1444601017,  1447036760,  1449469098,  1451898025,  1454323536,  1456745625,  1459164286,
+   1461579514,  1463991302,  1466399645,  1468804538,  1471205974,  1473603949,  1475998456,  1478389489,
+   1480777044,  1483161115,  1485541696,  1487918781,  1490292364,  1492662441,  1495029006,  1497392053,
+   1499751576,  1502107570,  1504460029,  1506808949,  1509154322,  1511496145,  1513834411,  1516169114,
+   1518500250,  1520827813,  1523151797,  1525472197,  1527789007,  1530102222,  1532411837,  1534717846,
+   1537020244,  1539319024,  1541614183,  1543905714,  1546193612,  1548477872,  1550758488,  1553035455,
+   1555308768,  1557578421,  1559844408,  1562106725,  1564365367,  1566620327,  1568871601,  1571119183,
+   1573363068,  1575603251,  1577839726,  1580072489,  1582301533,  1584526854,  1586748447,  1588966306,
+   1591180426,  1593390801,  1595597428,  1597800299,  1599999411,  1602194758,  1604386335,  1606574136,
+   1608758157,  1610938393,  1613114838,  1615287487,  1617456335,  1619621377,  1621782608,  1623940023,
+   1626093616,  1628243383,  1630389319,  1632531418,  1634669676,  1636804087,  1638934646,  1641061349,
+   1643184191,  1645303166,  1647418269,  1649529496,  1651636841,  1653740300,  1655839867,  1657935539,
+   1660027308,  1662115172,  1664199124,  1666279161,  1668355276,  1670427466,  1672495725,  1674560049,
+   1676620432,  1678676870,  1680729357,  1682777890,  1684822463,  1686863072,  1688899711,  1690932376,
+   1692961062,  1694985765,  1697006479,  1699023199,  1701035922,  1703044642,  1705049355,  1707050055,
+   1709046739,  1711039401,  1713028037,  1715012642,  1716993211,  1718969740,  1720942225,  1722910659,
+   1724875040,  1726835361,  1728791620,  1730743810,  1732691928,  1734635968,  1736575927,  1738511799,
+   1740443581,  1742371267,  1744294853,  1746214334,  1748129707,  1750040966,  1751948107,  1753851126,
+   1755750017,  1757644777,  1759535401,  1761421885,  1763304224,  1765182414,  1767056450,  1768926328,
+   1770792044,  1772653593,  1774510970,  1776364172,  1778213194,  1780058032,  1781898681,  1783735137,
+   1785567396,  1787395453,  1789219305,  1791038946,  1792854372,  1794665580,  1796472565,  1798275323,
+   1800073849,  1801868139,  1803658189,  1805443995,  1807225553,  1809002858,  1810775906,  1812544694,
+   1814309216,  1816069469,  1817825449,  1819577151,  1821324572,  1823067707,  1824806552,  1826541103,
+   1828271356,  1829997307,  1831718951,  1833436286,  1835149306,  1836858008,  1838562388,  1840262441,
+   1841958164,  1843649553,  1845336604,  1847019312,  1848697674,  1850371686,  1852041343,  1853706643,
+   1855367581,  1857024153,  1858676355,  1860324183,  1861967634,  1863606704,  1865241388,  1866871683,
+   1868497586,  1870119091,  1871736196,  1873348897,  1874957189,  1876561070,  1878160535,  1879755580,
+   1881346202,  1882932397,  1884514161,  1886091491,  1887664383,  1889232832,  1890796837,  1892356392,
+   1893911494,  1895462140,  1897008325,  1898550047,  1900087301,  1901620084,  1903148392,  1904672222,
+   1906191570,  1907706433,  1909216806,  1910722688,  1912224073,  1913720958,  1915213340,  1916701216,
+   1918184581,  1919663432,  1921137767,  1922607581,  1924072871,  1925533633,  1926989864,  1928441561,
+   1929888720,  1931331338,  1932769411,  1934202936,  1935631910,  1937056329,  1938476190,  1939891490,
+   1941302225,  1942708392,  1944109987,  1945507008,  1946899451,  1948287312,  1949670589,  1951049279,
+   1952423377,  1953792881,  1955157788,  1956518093,  1957873796,  1959224890,  1960571375,  1961913246,
+   1963250501,  1964583136,  1965911148,  1967234535,  1968553292,  1969867417,  1971176906,  1972481757,
+   1973781967,  1975077532,  1976368450,  1977654717,  1978936331,  1980213288,  1981485585,  1982753220,
+   1984016189,  1985274489,  1986528118,  1987777073,  1989021350,  1990260946,  1991495860,  1992726087,
+   1993951625,  1995172471,  1996388622,  1997600076,  1998806829,  2000008879,  2001206222,  2002398857,
+   2003586779,  2004769987,  2005948478,  2007122248,  2008291295,  2009455617,  2010615210,  2011770073,
+   2012920201,  2014065592,  2015206245,  2016342155,  2017473321,  2018599739,  2019721407,  2020838323,
+   2021950484,  2023057887,  2024160529,  2025258408,  2026351522,  2027439867,  2028523442,  2029602243,
+   2030676269,  2031745516,  2032809982,  2033869665,  2034924562,  2035974670,  2037019988,  2038060512,
+   2039096241,  2040127172,  2041153301,  2042174628,  2043191150,  2044202863,  2045209767,  2046211857,
+   2047209133,  2048201592,  2049189231,  2050172048,  2051150040,  2052123207,  2053091544,  2054055050,
+   2055013723,  2055967560,  2056916560,  2057860719,  2058800036,  2059734508,  2060664133,  2061588910,
+   2062508835,  2063423908,  2064334124,  2065239484,  2066139983,  2067035621,  2067926394,  2068812302,
+   2069693342,  2070569511,  2071440808,  2072307231,  2073168777,  2074025446,  2074877233,  2075724139,
+   2076566160,  2077403294,  2078235540,  2079062896,  2079885360,  2080702930,  2081515603,  2082323379,
+   2083126254,  2083924228,  2084717298,  2085505463,  2086288720,  2087067068,  2087840505,  2088609029,
+   2089372638,  2090131331,  2090885105,  2091633960,  2092377892,  2093116901,  2093850985,  2094580142,
+   2095304370,  2096023667,  2096738032,  2097447464,  2098151960,  2098851519,  2099546139,  2100235819,
+   2100920556,  2101600350,  2102275199,  2102945101,  2103610054,  2104270057,  2104925109,  2105575208,
+   2106220352,  2106860540,  2107495770,  2108126041,  2108751352,  2109371700,  2109987085,  2110597505,
+   2111202959,  2111803444,  2112398960,  2112989506,  2113575080,  2114155680,  2114731305,  2115301954,
+   2115867626,  2116428319,  2116984031,  2117534762,  2118080511,  2118621275,  2119157054,  2119687847,
+   2120213651,  2120734467,  2121250292,  2121761126,  2122266967,  2122767814,  2123263666,  2123754522,
+   2124240380,  2124721240,  2125197100,  2125667960,  2126133817,  2126594672,  2127050522,  2127501367,
+   2127947206,  2128388038,  2128823862,  2129254676,  2129680480,  2130101272,  2130517052,  2130927819,
+   2131333572,  2131734309,  2132130030,  2132520734,  2132906420,  2133287087,  2133662734,  2134033361,
+   2134398966,  2134759548,  2135115107,  2135465642,  2135811153,  2136151637,  2136487095,  2136817525,
+   2137142927,  2137463301,  2137778644,  2138088958,  2138394240,  2138694490,  2138989708,  2139279892,
+   2139565043,  2139845159,  2140120240,  2140390284,  2140655293,  2140915264,  2141170197,  2141420092,
+   2141664948,  2141904764,  2142139541,  2142369276,  2142593971,  2142813624,  2143028234,  2143237802,
+   2143442326,  2143641807,  2143836244,  2144025635,  2144209982,  2144389283,  2144563539,  2144732748,
+   2144896910,  2145056025,  2145210092,  2145359112,  2145503083,  2145642006,  2145775880,  2145904705,
+   2146028480,  2146147205,  2146260881,  2146369505,  2146473080,  2146571603,  2146665076,  2146753497,
+   2146836866,  2146915184,  2146988450,  2147056664,  2147119825,  2147177934,  2147230991,  2147278995,
+   2147321946,  2147359845,  2147392690,  2147420483,  2147443222,  2147460908,  2147473542,  2147481121
+};
+
+//cos(2*pi*k/4096) in the low and -sin in the high half, 1.15, in flash
+static const uint32_t fft_twiddle_q15[3072] = {
+  0x00007FFF, 0xFFCE7FFF, 0xFF9B7FFF, 0xFF697FFF, 0xFF377FFF, 0xFF057FFF, 0xFED27FFF, 0xFEA07FFE,
+  0xFE6E7FFE, 0xFE3C7FFD, 0xFE097FFC, 0xFDD77FFB, 0xFDA57FFA, 0xFD737FF9, 0xFD407FF8, 0xFD0E7FF7,
+  0xFCDC7FF6, 0xFCAA7FF5, 0xFC777FF4, 0xFC457FF2, 0xFC137FF1, 0xFBE17FEF, 0xFBAE7FED, 0xFB7C7FEC,
+  0xFB4A7FEA, 0xFB187FE8, 0xFAE57FE6, 0xFAB37FE4, 0xFA817FE2, 0xFA4F7FE0, 0xFA1D7FDD, 0xF9EA7FDB,
+  0xF9B87FD9, 0xF9867FD6, 0xF9547FD3, 0xF9227FD1, 0xF8EF7FCE, 0xF8BD7FCB, 0xF88B7FC8, 0xF8597FC5,
+  0xF8277FC2, 0xF7F47FBF, 0xF7C27FBC, 0xF7907FB9, 0xF75E7FB5, 0xF72C7FB2, 0xF6FA7FAE, 0xF6C87FAB,
+  0xF6957FA7, 0xF6637FA3, 0xF6317FA0, 0xF5FF7F9C, 0xF5CD7F98, 0xF59B7F94, 0xF5697F90, 0xF5377F8B,
+  0xF5057F87, 0xF4D37F83, 0xF4A07F7E, 0xF46E7F7A, 0xF43C7F75, 0xF40A7F71, 0xF3D87F6C, 0xF3A67F67,
+  0xF3747F62, 0xF3427F5D, 0xF3107F58, 0xF2DE7F53, 0xF2AC7F4E, 0xF27A7F49, 0xF2487F43, 0xF2167F3E,
+  0xF1E47F38, 0xF1B27F33, 0xF1807F2D, 0xF14E7F27, 0xF11C7F22, 0xF0EB7F1C, 0xF0B97F16, 0xF0877F10,
+  0xF0557F0A, 0xF0237F03, 0xEFF17EFD, 0xEFBF7EF7, 0xEF8D7EF0, 0xEF5C7EEA, 0xEF2A7EE3, 0xEEF87EDD,
+  0xEEC67ED6, 0xEE947ECF, 0xEE627EC8, 0xEE317EC1, 0xEDFF7EBA, 0xEDCD7EB3, 0xED9B7EAC, 0xED6A7EA5,
+  0xED387E9D, 0xED067E96, 0xECD57E8E, 0xECA37E87, 0xEC717E7F, 0xEC3F7E78, 0xEC0E7E70, 0xEBDC7E68,
+  0xEBAB7E60, 0xEB797E58, 0xEB477E50, 0xEB167E48, 0xEAE47E3F, 0xEAB37E37, 0xEA817E2F, 0xEA4F7E26,
+  0xEA1E7E1E, 0xE9EC7E15, 0xE9BB7E0C, 0xE9897E03, 0xE9587DFB, 0xE9267DF2, 0xE8F57DE9, 0xE8C47DE0,
+  0xE8927DD6, 0xE8617DCD, 0xE82F7DC4, 0xE7FE7DBA, 0xE7CD7DB1, 0xE79B7DA7, 0xE76A7D9E, 0xE7397D94,
+  0xE7077D8A, 0xE6D67D81, 0xE6A57D77, 0xE6737D6D, 0xE6427D63, 0xE6117D58, 0xE5E07D4E, 0xE5AF7D44,
+  0xE57D7D3A, 0xE54C7D2F, 0xE51B7D25, 0xE4EA7D1A, 0xE4B97D0F, 0xE4887D05, 0xE4577CFA, 0xE4267CEF,
+  0xE3F47CE4, 0xE3C37CD9, 0xE3927CCE, 0xE3617CC2, 0xE3307CB7, 0xE2FF7CAC, 0xE2CF7CA0, 0xE29E7C95,
+  0xE26D7C89, 0xE23C7C7E, 0xE20B7C72, 0xE1DA7C66, 0xE1A97C5A, 0xE1787C4E, 0xE1487C42, 0xE1177C36,
+  0xE0E67C2A, 0xE0B57C1E, 0xE0857C11, 0xE0547C05, 0xE0237BF9, 0xDFF27BEC, 0xDFC27BDF, 0xDF917BD3,
+  0xDF617BC6, 0xDF307BB9, 0xDEFF7BAC, 0xDECF7B9F, 0xDE9E7B92, 0xDE6E7B85, 0xDE3D7B78, 0xDE0D7B6A,
+  0xDDDC7B5D, 0xDDAC7B50, 0xDD7C7B42, 0xDD4B7B34, 0xDD1B7B27, 0xDCEA7B19, 0xDCBA7B0B, 0xDC8A7AFD,
+  0xDC597AEF, 0xDC297AE1, 0xDBF97AD3, 0xDBC97AC5, 0xDB997AB7, 0xDB687AA8, 0xDB387A9A, 0xDB087A8C,
+  0xDAD87A7D, 0xDAA87A6E, 0xDA787A60, 0xDA487A51, 0xDA187A42, 0xD9E87A33, 0xD9B87A24, 0xD9887A15,
+  0xD9587A06, 0xD92879F7, 0xD8F879E7, 0xD8C879D8, 0xD89879C9, 0xD86979B9, 0xD83979AA, 0xD809799A,
+  0xD7D9798A, 0xD7AA797A, 0xD77A796A, 0xD74A795B, 0xD71B794A, 0xD6EB793A, 0xD6BB792A, 0xD68C791A,
+  0xD65C790A, 0xD62D78F9, 0xD5FD78E9, 0xD5CE78D8, 0xD59E78C8, 0xD56F78B7, 0xD53F78A6, 0xD5107895,
+  0xD4E17885, 0xD4B17874, 0xD4827863, 0xD4537851, 0xD4247840, 0xD3F4782F, 0xD3C5781E, 0xD396780C,
+  0xD36777FB, 0xD33877E9, 0xD30977D8, 0xD2DA77C6, 0xD2AB77B4, 0xD27C77A2, 0xD24D7790, 0xD21E777E,
+  0xD1EF776C, 0xD1C0775A, 0xD1917748, 0xD1627736, 0xD1347723, 0xD1057711, 0xD0D676FE, 0xD0A776EC,
+  0xD07976D9, 0xD04A76C7, 0xD01B76B4, 0xCFED76A1, 0xCFBE768E, 0xCF90767B, 0xCF617668, 0xCF337655,
+  0xCF047642, 0xCED6762E, 0xCEA7761B, 0xCE797608, 0xCE4B75F4, 0xCE1C75E1, 0xCDEE75CD, 0xCDC075B9,
+  0xCD9275A6, 0xCD637592, 0xCD35757E, 0xCD07756A, 0xCCD97556, 0xCCAB7542, 0xCC7D752D, 0xCC4F7519,
+  0xCC217505, 0xCBF374F0, 0xCBC574DC, 0xCB9774C7, 0xCB6974B3, 0xCB3C749E, 0xCB0E7489, 0xCAE07475,
+  0xCAB27460, 0xCA85744B, 0xCA577436, 0xCA297421, 0xC9FC740B, 0xC9CE73F6, 0xC9A173E1, 0xC97373CB,
+  0xC94673B6, 0xC91873A0, 0xC8EB738B, 0xC8BE7375, 0xC890735F, 0xC863734A, 0xC8367334, 0xC809731E,
+  0xC7DB7308, 0xC7AE72F2, 0xC78172DC, 0xC75472C5, 0xC72772AF, 0xC6FA7299, 0xC6CD7282, 0xC6A0726C,
+  0xC6737255, 0xC646723F, 0xC6197228, 0xC5ED7211, 0xC5C071FA, 0xC59371E3, 0xC56671CC, 0xC53A71B5,
+  0xC50D719E, 0xC4E07187, 0xC4B47170, 0xC4877158, 0xC45B7141, 0xC42E712A, 0xC4027112, 0xC3D670FA,
+  0xC3A970E3, 0xC37D70CB, 0xC35170B3, 0xC324709B, 0xC2F87083, 0xC2CC706B, 0xC2A07053, 0xC274703B,
+  0xC2487023, 0xC21C700B, 0xC1F06FF2, 0xC1C46FDA, 0xC1986FC2, 0xC16C6FA9, 0xC1406F90, 0xC1146F78,
+  0xC0E96F5F, 0xC0BD6F46, 0xC0916F2D, 0xC0666F14, 0xC03A6EFB, 0xC00F6EE2, 0xBFE36EC9, 0xBFB86EB0,
+  0xBF8C6E97, 0xBF616E7D, 0xBF356E64, 0xBF0A6E4A, 0xBEDF6E31, 0xBEB36E17, 0xBE886DFE, 0xBE5D6DE4,
+  0xBE326DCA, 0xBE076DB0, 0xBDDC6D96, 0xBDB16D7C, 0xBD866D62, 0xBD5B6D48, 0xBD306D2E, 0xBD056D14,
+  0xBCDA6CF9, 0xBCAF6CDF, 0xBC856CC4, 0xBC5A6CAA, 0xBC2F6C8F, 0xBC056C75, 0xBBDA6C5A, 0xBBB06C3F,
+  0xBB856C24, 0xBB5B6C09, 0xBB306BEE, 0xBB066BD3, 0xBADC6BB8, 0xBAB16B9D, 0xBA876B82, 0xBA5D6B66,
+  0xBA336B4B, 0xBA096B30, 0xB9DF6B14, 0xB9B56AF8, 0xB98B6ADD, 0xB9616AC1, 0xB9376AA5, 0xB90D6A89,
+  0xB8E36A6E, 0xB8B96A52, 0xB8906A36, 0xB8666A1A, 0xB83C69FD, 0xB81369E1, 0xB7E969C5, 0xB7C069A9,
+  0xB796698C, 0xB76D6970, 0xB7436953, 0xB71A6937, 0xB6F1691A, 0xB6C768FD, 0xB69E68E0, 0xB67568C4,
+  0xB64C68A7, 0xB623688A, 0xB5FA686D, 0xB5D16850, 0xB5A86832, 0xB57F6815, 0xB55667F8, 0xB52D67DA,
+  0xB50567BD, 0xB4DC67A0, 0xB4B36782, 0xB48B6764, 0xB4626747, 0xB4396729, 0xB411670B, 0xB3E966ED,
+  0xB3C066D0, 0xB39866B2, 0xB36F6693, 0xB3476675, 0xB31F6657, 0xB2F76639, 0xB2CF661B, 0xB2A765FC,
+  0xB27F65DE, 0xB25765C0, 0xB22F65A1, 0xB2076582, 0xB1DF6564, 0xB1B76545, 0xB18F6526, 0xB1686507,
+  0xB14064E9, 0xB11864CA, 0xB0F164AB, 0xB0C9648B, 0xB0A2646C, 0xB07B644D, 0xB053642E, 0xB02C640F,
+  0xB00563EF, 0xAFDD63D0, 0xAFB663B0, 0xAF8F6391, 0xAF686371, 0xAF416351, 0xAF1A6332, 0xAEF36312,
+  0xAECC62F2, 0xAEA562D2, 0xAE7F62B2, 0xAE586292, 0xAE316272, 0xAE0B6252, 0xADE46232, 0xADBD6211,
+  0xAD9761F1, 0xAD7061D1, 0xAD4A61B0, 0xAD246190, 0xACFD616F, 0xACD7614E, 0xACB1612E, 0xAC8B610D,
+  0xAC6560EC, 0xAC3F60CB, 0xAC1960AA, 0xABF36089, 0xABCD6068, 0xABA76047, 0xAB816026, 0xAB5C6005,
+  0xAB365FE4, 0xAB105FC2, 0xAAEB5FA1, 0xAAC55F80, 0xAAA05F5E, 0xAA7A5F3C, 0xAA555F1B, 0xAA305EF9,
+  0xAA0A5ED7, 0xA9E55EB6, 0xA9C05E94, 0xA99B5E72, 0xA9765E50, 0xA9515E2E, 0xA92C5E0C, 0xA9075DEA,
+  0xA8E25DC8, 0xA8BD5DA5, 0xA8995D83, 0xA8745D61, 0xA84F5D3E, 0xA82B5D1C, 0xA8065CF9, 0xA7E25CD7,
+  0xA7BD5CB4, 0xA7995C91, 0xA7745C6F, 0xA7505C4C, 0xA72C5C29, 0xA7085C06, 0xA6E45BE3, 0xA6C05BC0,
+  0xA69C5B9D, 0xA6785B7A, 0xA6545B57, 0xA6305B34, 0xA60C5B10, 0xA5E85AED, 0xA5C55AC9, 0xA5A15AA6,
+  0xA57E5A82, 0xA55A5A5F, 0xA5375A3B, 0xA5135A18, 0xA4F059F4, 0xA4CC59D0, 0xA4A959AC, 0xA4865988,
+  0xA4635964, 0xA4405940, 0xA41D591C, 0xA3FA58F8, 0xA3D758D4, 0xA3B458B0, 0xA391588C, 0xA36F5867,
+  0xA34C5843, 0xA329581E, 0xA30757FA, 0xA2E457D5, 0xA2C257B1, 0xA29F578C, 0xA27D5767, 0xA25B5743,
+  0xA238571E, 0xA21656F9, 0xA1F456D4, 0xA1D256AF, 0xA1B0568A, 0xA18E5665, 0xA16C5640, 0xA14A561B,
+  0xA12955F6, 0xA10755D0, 0xA0E555AB, 0xA0C45586, 0xA0A25560, 0xA080553B, 0xA05F5515, 0xA03E54F0,
+  0xA01C54CA, 0x9FFB54A4, 0x9FDA547F, 0x9FB95459, 0x9F985433, 0x9F77540D, 0x9F5653E7, 0x9F3553C1,
+  0x9F14539B, 0x9EF35375, 0x9ED2534F, 0x9EB25329, 0x9E915303, 0x9E7052DC, 0x9E5052B6, 0x9E2F5290,
+  0x9E0F5269, 0x9DEF5243, 0x9DCE521C, 0x9DAE51F5, 0x9D8E51CF, 0x9D6E51A8, 0x9D4E5181, 0x9D2E515B,
+  0x9D0E5134, 0x9CEE510D, 0x9CCE50E6, 0x9CAF50BF, 0x9C8F5098, 0x9C6F5071, 0x9C50504A, 0x9C305023,
+  0x9C114FFB, 0x9BF14FD4, 0x9BD24FAD, 0x9BB34F85, 0x9B944F5E, 0x9B754F37, 0x9B554F0F, 0x9B364EE8,
+  0x9B174EC0, 0x9AF94E98, 0x9ADA4E71, 0x9ABB4E49, 0x9A9C4E21, 0x9A7E4DF9, 0x9A5F4DD1, 0x9A404DA9,
+  0x9A224D81, 0x9A044D59, 0x99E54D31, 0x99C74D09, 0x99A94CE1, 0x998B4CB9, 0x996D4C91, 0x994E4C68,
+  0x99304C40, 0x99134C17, 0x98F54BEF, 0x98D74BC7, 0x98B94B9E, 0x989C4B75, 0x987E4B4D, 0x98604B24,
+  0x98434AFB, 0x98264AD3, 0x98084AAA, 0x97EB4A81, 0x97CE4A58, 0x97B04A2F, 0x97934A06, 0x977649DD,
+  0x975949B4, 0x973C498B, 0x97204962, 0x97034939, 0x96E6490F, 0x96C948E6, 0x96AD48BD, 0x96904893,
+  0x9674486A, 0x96574840, 0x963B4817, 0x961F47ED, 0x960347C4, 0x95E6479A, 0x95CA4770, 0x95AE4747,
+  0x9592471D, 0x957746F3, 0x955B46C9, 0x953F469F, 0x95234675, 0x9508464B, 0x94EC4621, 0x94D045F7,
+  0x94B545CD, 0x949A45A3, 0x947E4579, 0x9463454F, 0x94484524, 0x942D44FA, 0x941244D0, 0x93F744A5,
+  0x93DC447B, 0x93C14450, 0x93A64426, 0x938B43FB, 0x937143D1, 0x935643A6, 0x933C437B, 0x93214351,
+  0x93074326, 0x92EC42FB, 0x92D242D0, 0x92B842A5, 0x929E427A, 0x9284424F, 0x926A4224, 0x925041F9,
+  0x923641CE, 0x921C41A3, 0x92024178, 0x91E9414D, 0x91CF4121, 0x91B640F6, 0x919C40CB, 0x9183409F,
+  0x91694074, 0x91504048, 0x9137401D, 0x911E3FF1, 0x91053FC6, 0x90EC3F9A, 0x90D33F6F, 0x90BA3F43,
+  0x90A13F17, 0x90883EEC, 0x90703EC0, 0x90573E94, 0x903E3E68, 0x90263E3C, 0x900E3E10, 0x8FF53DE4,
+  0x8FDD3DB8, 0x8FC53D8C, 0x8FAD3D60, 0x8F953D34, 0x8F7D3D08, 0x8F653CDC, 0x8F4D3CAF, 0x8F353C83,
+  0x8F1D3C57, 0x8F063C2A, 0x8EEE3BFE, 0x8ED63BD2, 0x8EBF3BA5, 0x8EA83B79, 0x8E903B4C, 0x8E793B20,
+  0x8E623AF3, 0x8E4B3AC6, 0x8E343A9A, 0x8E1D3A6D, 0x8E063A40, 0x8DEF3A13, 0x8DD839E7, 0x8DC139BA,
+  0x8DAB398D, 0x8D943960, 0x8D7E3933, 0x8D673906, 0x8D5138D9, 0x8D3B38AC, 0x8D24387F, 0x8D0E3852,
+  0x8CF83825, 0x8CE237F7, 0x8CCC37CA, 0x8CB6379D, 0x8CA13770, 0x8C8B3742, 0x8C753715, 0x8C6036E8,
+  0x8C4A36BA, 0x8C35368D, 0x8C1F365F, 0x8C0A3632, 0x8BF53604, 0x8BDF35D7, 0x8BCA35A9, 0x8BB5357B,
+  0x8BA0354E, 0x8B8B3520, 0x8B7734F2, 0x8B6234C4, 0x8B4D3497, 0x8B393469, 0x8B24343B, 0x8B10340D,
+  0x8AFB33DF, 0x8AE733B1, 0x8AD33383, 0x8ABE3355, 0x8AAA3327, 0x8A9632F9, 0x8A8232CB, 0x8A6E329D,
+  0x8A5A326E, 0x8A473240, 0x8A333212, 0x8A1F31E4, 0x8A0C31B5, 0x89F83187, 0x89E53159, 0x89D2312A,
+  0x89BE30FC, 0x89AB30CD, 0x8998309F, 0x89853070, 0x89723042, 0x895F3013, 0x894C2FE5, 0x89392FB6,
+  0x89272F87, 0x89142F59, 0x89022F2A, 0x88EF2EFB, 0x88DD2ECC, 0x88CA2E9E, 0x88B82E6F, 0x88A62E40,
+  0x88942E11, 0x88822DE2, 0x88702DB3, 0x885E2D84, 0x884C2D55, 0x883A2D26, 0x88282CF7, 0x88172CC8,
+  0x88052C99, 0x87F42C6A, 0x87E22C3B, 0x87D12C0C, 0x87C02BDC, 0x87AF2BAD, 0x879D2B7E, 0x878C2B4F,
+  0x877B2B1F, 0x876B2AF0, 0x875A2AC1, 0x87492A91, 0x87382A62, 0x87282A32, 0x87172A03, 0x870729D3,
+  0x86F629A4, 0x86E62974, 0x86D62945, 0x86C62915, 0x86B628E5, 0x86A528B6, 0x86962886, 0x86862856,
+  0x86762827, 0x866627F7, 0x865627C7, 0x86472797, 0x86372768, 0x86282738, 0x86192708, 0x860926D8,
+  0x85FA26A8, 0x85EB2678, 0x85DC2648, 0x85CD2618, 0x85BE25E8, 0x85AF25B8, 0x85A02588, 0x85922558,
+  0x85832528, 0x857424F8, 0x856624C8, 0x85582498, 0x85492467, 0x853B2437, 0x852D2407, 0x851F23D7,
+  0x851123A7, 0x85032376, 0x84F52346, 0x84E72316, 0x84D922E5, 0x84CC22B5, 0x84BE2284, 0x84B02254,
+  0x84A32224, 0x849621F3, 0x848821C3, 0x847B2192, 0x846E2162, 0x84612131, 0x84542101, 0x844720D0,
+  0x843A209F, 0x842D206F, 0x8421203E, 0x8414200E, 0x84071FDD, 0x83FB1FAC, 0x83EF1F7B, 0x83E21F4B,
+  0x83D61F1A, 0x83CA1EE9, 0x83BE1EB8, 0x83B21E88, 0x83A61E57, 0x839A1E26, 0x838E1DF5, 0x83821DC4,
+  0x83771D93, 0x836B1D62, 0x83601D31, 0x83541D01, 0x83491CD0, 0x833E1C9F, 0x83321C6E, 0x83271C3D,
+  0x831C1C0C, 0x83111BDA, 0x83061BA9, 0x82FB1B78, 0x82F11B47, 0x82E61B16, 0x82DB1AE5, 0x82D11AB4,
+  0x82C61A83, 0x82BC1A51, 0x82B21A20, 0x82A819EF, 0x829D19BE, 0x8293198D, 0x8289195B, 0x827F192A,
+  0x827618F9, 0x826C18C7, 0x82621896, 0x82591865, 0x824F1833, 0x82461802, 0x823C17D1, 0x8233179F,
+  0x822A176E, 0x8220173C, 0x8217170B, 0x820E16DA, 0x820516A8, 0x81FD1677, 0x81F41645, 0x81EB1614,
+  0x81E215E2, 0x81DA15B1, 0x81D1157F, 0x81C9154D, 0x81C1151C, 0x81B814EA, 0x81B014B9, 0x81A81487,
+  0x81A01455, 0x81981424, 0x819013F2, 0x818813C1, 0x8181138F, 0x8179135D, 0x8172132B, 0x816A12FA,
+  0x816312C8, 0x815B1296, 0x81541265, 0x814D1233, 0x81461201, 0x813F11CF, 0x8138119E, 0x8131116C,
+  0x812A113A, 0x81231108, 0x811D10D6, 0x811610A4, 0x81101073, 0x81091041, 0x8103100F, 0x80FD0FDD,
+  0x80F60FAB, 0x80F00F79, 0x80EA0F47, 0x80E40F15, 0x80DE0EE4, 0x80D90EB2, 0x80D30E80, 0x80CD0E4E,
+  0x80C80E1C, 0x80C20DEA, 0x80BD0DB8, 0x80B70D86, 0x80B20D54, 0x80AD0D22, 0x80A80CF0, 0x80A30CBE,
+  0x809E0C8C, 0x80990C5A, 0x80940C28, 0x808F0BF6, 0x808B0BC4, 0x80860B92, 0x80820B60, 0x807D0B2D,
+  0x80790AFB, 0x80750AC9, 0x80700A97, 0x806C0A65, 0x80680A33, 0x80640A01, 0x806009CF, 0x805D099D,
+  0x8059096B, 0x80550938, 0x80520906, 0x804E08D4, 0x804B08A2, 0x80470870, 0x8044083E, 0x8041080C,
+  0x803E07D9, 0x803B07A7, 0x80380775, 0x80350743, 0x80320711, 0x802F06DE, 0x802D06AC, 0x802A067A,
+  0x80270648, 0x80250616, 0x802305E3, 0x802005B1, 0x801E057F, 0x801C054D, 0x801A051B, 0x801804E8,
+  0x801604B6, 0x80140484, 0x80130452, 0x8011041F, 0x800F03ED, 0x800E03BB, 0x800C0389, 0x800B0356,
+  0x800A0324, 0x800902F2, 0x800802C0, 0x8007028D, 0x8006025B, 0x80050229, 0x800401F7, 0x800301C4,
+  0x80020192, 0x80020160, 0x8001012E, 0x800100FB, 0x800100C9, 0x80010097, 0x80010065, 0x80010032,
+  0x80010000, 0x8001FFCE, 0x8001FF9B, 0x8001FF69, 0x8001FF37, 0x8001FF05, 0x8001FED2, 0x8002FEA0,
+  0x8002FE6E, 0x8003FE3C, 0x8004FE09, 0x8005FDD7, 0x8006FDA5, 0x8007FD73, 0x8008FD40, 0x8009FD0E,
+  0x800AFCDC, 0x800BFCAA, 0x800CFC77, 0x800EFC45, 0x800FFC13, 0x8011FBE1, 0x8013FBAE, 0x8014FB7C,
+  0x8016FB4A, 0x8018FB18, 0x801AFAE5, 0x801CFAB3, 0x801EFA81, 0x8020FA4F, 0x8023FA1D, 0x8025F9EA,
+  0x8027F9B8, 0x802AF986, 0x802DF954, 0x802FF922, 0x8032F8EF, 0x8035F8BD, 0x8038F88B, 0x803BF859,
+  0x803EF827, 0x8041F7F4, 0x8044F7C2, 0x8047F790, 0x804BF75E, 0x804EF72C, 0x8052F6FA, 0x8055F6C8,
+  0x8059F695, 0x805DF663, 0x8060F631, 0x8064F5FF, 0x8068F5CD, 0x806CF59B, 0x8070F569, 0x8075F537,
+  0x8079F505, 0x807DF4D3, 0x8082F4A0, 0x8086F46E, 0x808BF43C, 0x808FF40A, 0x8094F3D8, 0x8099F3A6,
+  0x809EF374, 0x80A3F342, 0x80A8F310, 0x80ADF2DE, 0x80B2F2AC, 0x80B7F27A, 0x80BDF248, 0x80C2F216,
+  0x80C8F1E4, 0x80CDF1B2, 0x80D3F180, 0x80D9F14E, 0x80DEF11C, 0x80E4F0EB, 0x80EAF0B9, 0x80F0F087,
+  0x80F6F055, 0x80FDF023, 0x8103EFF1, 0x8109EFBF, 0x8110EF8D, 0x8116EF5C, 0x811DEF2A, 0x8123EEF8,
+  0x812AEEC6, 0x8131EE94, 0x8138EE62, 0x813FEE31, 0x8146EDFF, 0x814DEDCD, 0x8154ED9B, 0x815BED6A,
+  0x8163ED38, 0x816AED06, 0x8172ECD5, 0x8179ECA3, 0x8181EC71, 0x8188EC3F, 0x8190EC0E, 0x8198EBDC,
+  0x81A0EBAB, 0x81A8EB79, 0x81B0EB47, 0x81B8EB16, 0x81C1EAE4, 0x81C9EAB3, 0x81D1EA81, 0x81DAEA4F,
+  0x81E2EA1E, 0x81EBE9EC, 0x81F4E9BB, 0x81FDE989, 0x8205E958, 0x820EE926, 0x8217E8F5, 0x8220E8C4,
+  0x822AE892, 0x8233E861, 0x823CE82F, 0x8246E7FE, 0x824FE7CD, 0x8259E79B, 0x8262E76A, 0x826CE739,
+  0x8276E707, 0x827FE6D6, 0x8289E6A5, 0x8293E673, 0x829DE642, 0x82A8E611, 0x82B2E5E0, 0x82BCE5AF,
+  0x82C6E57D, 0x82D1E54C, 0x82DBE51B, 0x82E6E4EA, 0x82F1E4B9, 0x82FBE488, 0x8306E457, 0x8311E426,
+  0x831CE3F4, 0x8327E3C3, 0x8332E392, 0x833EE361, 0x8349E330, 0x8354E2FF, 0x8360E2CF, 0x836BE29E,
+  0x8377E26D, 0x8382E23C, 0x838EE20B, 0x839AE1DA, 0x83A6E1A9, 0x83B2E178, 0x83BEE148, 0x83CAE117,
+  0x83D6E0E6, 0x83E2E0B5, 0x83EFE085, 0x83FBE054, 0x8407E023, 0x8414DFF2, 0x8421DFC2, 0x842DDF91,
+  0x843ADF61, 0x8447DF30, 0x8454DEFF, 0x8461DECF, 0x846EDE9E, 0x847BDE6E, 0x8488DE3D, 0x8496DE0D,
+  0x84A3DDDC, 0x84B0DDAC, 0x84BEDD7C, 0x84CCDD4B, 0x84D9DD1B, 0x84E7DCEA, 0x84F5DCBA, 0x8503DC8A,
+  0x8511DC59, 0x851FDC29, 0x852DDBF9, 0x853BDBC9, 0x8549DB99, 0x8558DB68, 0x8566DB38, 0x8574DB08,
+  0x8583DAD8, 0x8592DAA8, 0x85A0DA78, 0x85AFDA48, 0x85BEDA18, 0x85CDD9E8, 0x85DCD9B8, 0x85EBD988,
+  0x85FAD958, 0x8609D928, 0x8619D8F8, 0x8628D8C8, 0x8637D898, 0x8647D869, 0x8656D839, 0x8666D809,
+  0x8676D7D9, 0x8686D7AA, 0x8696D77A, 0x86A5D74A, 0x86B6D71B, 0x86C6D6EB, 0x86D6D6BB, 0x86E6D68C,
+  0x86F6D65C, 0x8707D62D, 0x8717D5FD, 0x8728D5CE, 0x8738D59E, 0x8749D56F, 0x875AD53F, 0x876BD510,
+  0x877BD4E1, 0x878CD4B1, 0x879DD482, 0x87AFD453, 0x87C0D424, 0x87D1D3F4, 0x87E2D3C5, 0x87F4D396,
+  0x8805D367, 0x8817D338, 0x8828D309, 0x883AD2DA, 0x884CD2AB, 0x885ED27C, 0x8870D24D, 0x8882D21E,
+  0x8894D1EF, 0x88A6D1C0, 0x88B8D191, 0x88CAD162, 0x88DDD134, 0x88EFD105, 0x8902D0D6, 0x8914D0A7,
+  0x8927D079, 0x8939D04A, 0x894CD01B, 0x895FCFED, 0x8972CFBE, 0x8985CF90, 0x8998CF61, 0x89ABCF33,
+  0x89BECF04, 0x89D2CED6, 0x89E5CEA7, 0x89F8CE79, 0x8A0CCE4B, 0x8A1FCE1C, 0x8A33CDEE, 0x8A47CDC0,
+  0x8A5ACD92, 0x8A6ECD63, 0x8A82CD35, 0x8A96CD07, 0x8AAACCD9, 0x8ABECCAB, 0x8AD3CC7D, 0x8AE7CC4F,
+  0x8AFBCC21, 0x8B10CBF3, 0x8B24CBC5, 0x8B39CB97, 0x8B4DCB69, 0x8B62CB3C, 0x8B77CB0E, 0x8B8BCAE0,
+  0x8BA0CAB2, 0x8BB5CA85, 0x8BCACA57, 0x8BDFCA29, 0x8BF5C9FC, 0x8C0AC9CE, 0x8C1FC9A1, 0x8C35C973,
+  0x8C4AC946, 0x8C60C918, 0x8C75C8EB, 0x8C8BC8BE, 0x8CA1C890, 0x8CB6C863, 0x8CCCC836, 0x8CE2C809,
+  0x8CF8C7DB, 0x8D0EC7AE, 0x8D24C781, 0x8D3BC754, 0x8D51C727, 0x8D67C6FA, 0x8D7EC6CD, 0x8D94C6A0,
+  0x8DABC673, 0x8DC1C646, 0x8DD8C619, 0x8DEFC5ED, 0x8E06C5C0, 0x8E1DC593, 0x8E34C566, 0x8E4BC53A,
+  0x8E62C50D, 0x8E79C4E0, 0x8E90C4B4, 0x8EA8C487, 0x8EBFC45B, 0x8ED6C42E, 0x8EEEC402, 0x8F06C3D6,
+  0x8F1DC3A9, 0x8F35C37D, 0x8F4DC351, 0x8F65C324, 0x8F7DC2F8, 0x8F95C2CC, 0x8FADC2A0, 0x8FC5C274,
+  0x8FDDC248, 0x8FF5C21C, 0x900EC1F0, 0x9026C1C4, 0x903EC198, 0x9057C16C, 0x9070C140, 0x9088C114,
+  0x90A1C0E9, 0x90BAC0BD, 0x90D3C091, 0x90ECC066, 0x9105C03A, 0x911EC00F, 0x9137BFE3, 0x9150BFB8,
+  0x9169BF8C, 0x9183BF61, 0x919CBF35, 0x91B6BF0A, 0x91CFBEDF, 0x91E9BEB3, 0x9202BE88, 0x921CBE5D,
+  0x9236BE32, 0x9250BE07, 0x926ABDDC, 0x9284BDB1, 0x929EBD86, 0x92B8BD5B, 0x92D2BD30, 0x92ECBD05,
+  0x9307BCDA, 0x9321BCAF, 0x933CBC85, 0x9356BC5A, 0x9371BC2F, 0x938BBC05, 0x93A6BBDA, 0x93C1BBB0,
+  0x93DCBB85, 0x93F7BB5B, 0x9412BB30, 0x942DBB06, 0x9448BADC, 0x9463BAB1, 0x947EBA87, 0x949ABA5D,
+  0x94B5BA33, 0x94D0BA09, 0x94ECB9DF, 0x9508B9B5, 0x9523B98B, 0x953FB961, 0x955BB937, 0x9577B90D,
+  0x9592B8E3, 0x95AEB8B9, 0x95CAB890, 0x95E6B866, 0x9603B83C, 0x961FB813, 0x963BB7E9, 0x9657B7C0,
+  0x9674B796, 0x9690B76D, 0x96ADB743, 0x96C9B71A, 0x96E6B6F1, 0x9703B6C7, 0x9720B69E, 0x973CB675,
+  0x9759B64C, 0x9776B623, 0x9793B5FA, 0x97B0B5D1, 0x97CEB5A8, 0x97EBB57F, 0x9808B556, 0x9826B52D,
+  0x9843B505, 0x9860B4DC, 0x987EB4B3, 0x989CB48B, 0x98B9B462, 0x98D7B439, 0x98F5B411, 0x9913B3E9,
+  0x9930B3C0, 0x994EB398, 0x996DB36F, 0x998BB347, 0x99A9B31F, 0x99C7B2F7, 0x99E5B2CF, 0x9A04B2A7,
+  0x9A22B27F, 0x9A40B257, 0x9A5FB22F, 0x9A7EB207, 0x9A9CB1DF, 0x9ABBB1B7, 0x9ADAB18F, 0x9AF9B168,
+  0x9B17B140, 0x9B36B118, 0x9B55B0F1, 0x9B75B0C9, 0x9B94B0A2, 0x9BB3B07B, 0x9BD2B053, 0x9BF1B02C,
+  0x9C11B005, 0x9C30AFDD, 0x9C50AFB6, 0x9C6FAF8F, 0x9C8FAF68, 0x9CAFAF41, 0x9CCEAF1A, 0x9CEEAEF3,
+  0x9D0EAECC, 0x9D2EAEA5, 0x9D4EAE7F, 0x9D6EAE58, 0x9D8EAE31, 0x9DAEAE0B, 0x9DCEADE4, 0x9DEFADBD,
+  0x9E0FAD97, 0x9E2FAD70, 0x9E50AD4A, 0x9E70AD24, 0x9E91ACFD, 0x9EB2ACD7, 0x9ED2ACB1, 0x9EF3AC8B,
+  0x9F14AC65, 0x9F35AC3F, 0x9F56AC19, 0x9F77ABF3, 0x9F98ABCD, 0x9FB9ABA7, 0x9FDAAB81, 0x9FFBAB5C,
+  0xA01CAB36, 0xA03EAB10, 0xA05FAAEB, 0xA080AAC5, 0xA0A2AAA0, 0xA0C4AA7A, 0xA0E5AA55, 0xA107AA30,
+  0xA129AA0A, 0xA14AA9E5, 0xA16CA9C0, 0xA18EA99B, 0xA1B0A976, 0xA1D2A951, 0xA1F4A92C, 0xA216A907,
+  0xA238A8E2, 0xA25BA8BD, 0xA27DA899, 0xA29FA874, 0xA2C2A84F, 0xA2E4A82B, 0xA307A806, 0xA329A7E2,
+  0xA34CA7BD, 0xA36FA799, 0xA391A774, 0xA3B4A750, 0xA3D7A72C, 0xA3FAA708, 0xA41DA6E4, 0xA440A6C0,
+  0xA463A69C, 0xA486A678, 0xA4A9A654, 0xA4CCA630, 0xA4F0A60C, 0xA513A5E8, 0xA537A5C5, 0xA55AA5A1,
+  0xA57EA57E, 0xA5A1A55A, 0xA5C5A537, 0xA5E8A513, 0xA60CA4F0, 0xA630A4CC, 0xA654A4A9, 0xA678A486,
+  0xA69CA463, 0xA6C0A440, 0xA6E4A41D, 0xA708A3FA, 0xA72CA3D7, 0xA750A3B4, 0xA774A391, 0xA799A36F,
+  0xA7BDA34C, 0xA7E2A329, 0xA806A307, 0xA82BA2E4, 0xA84FA2C2, 0xA874A29F, 0xA899A27D, 0xA8BDA25B,
+  0xA8E2A238, 0xA907A216, 0xA92CA1F4, 0xA951A1D2, 0xA976A1B0, 0xA99BA18E, 0xA9C0A16C, 0xA9E5A14A,
+  0xAA0AA129, 0xAA30A107, 0xAA55A0E5, 0xAA7AA0C4, 0xAAA0A0A2, 0xAAC5A080, 0xAAEBA05F, 0xAB10A03E,
+  0xAB36A01C, 0xAB5C9FFB, 0xAB819FDA, 0xABA79FB9, 0xABCD9F98, 0xABF39F77, 0xAC199F56, 0xAC3F9F35,
+  0xAC659F14, 0xAC8B9EF3, 0xACB19ED2, 0xACD79EB2, 0xACFD9E91, 0xAD249E70, 0xAD4A9E50, 0xAD709E2F,
+  0xAD979E0F, 0xADBD9DEF, 0xADE49DCE, 0xAE0B9DAE, 0xAE319D8E, 0xAE589D6E, 0xAE7F9D4E, 0xAEA59D2E,
+  0xAECC9D0E, 0xAEF39CEE, 0xAF1A9CCE, 0xAF419CAF, 0xAF689C8F, 0xAF8F9C6F, 0xAFB69C50, 0xAFDD9C30,
+  0xB0059C11, 0xB02C9BF1, 0xB0539BD2, 0xB07B9BB3, 0xB0A29B94, 0xB0C99B75, 0xB0F19B55, 0xB1189B36,
+  0xB1409B17, 0xB1689AF9, 0xB18F9ADA, 0xB1B79ABB, 0xB1DF9A9C, 0xB2079A7E, 0xB22F9A5F, 0xB2579A40,
+  0xB27F9A22, 0xB2A79A04, 0xB2CF99E5, 0xB2F799C7, 0xB31F99A9, 0xB347998B, 0xB36F996D, 0xB398994E,
+  0xB3C09930, 0xB3E99913, 0xB41198F5, 0xB43998D7, 0xB46298B9, 0xB48B989C, 0xB4B3987E, 0xB4DC9860,
+  0xB5059843, 0xB52D9826, 0xB5569808, 0xB57F97EB, 0xB5A897CE, 0xB5D197B0, 0xB5FA9793, 0xB6239776,
+  0xB64C9759, 0xB675973C, 0xB69E9720, 0xB6C79703, 0xB6F196E6, 0xB71A96C9, 0xB74396AD, 0xB76D9690,
+  0xB7969674, 0xB7C09657, 0xB7E9963B, 0xB813961F, 0xB83C9603, 0xB86695E6, 0xB89095CA, 0xB8B995AE,
+  0xB8E39592, 0xB90D9577, 0xB937955B, 0xB961953F, 0xB98B9523, 0xB9B59508, 0xB9DF94EC, 0xBA0994D0,
+  0xBA3394B5, 0xBA5D949A, 0xBA87947E, 0xBAB19463, 0xBADC9448, 0xBB06942D, 0xBB309412, 0xBB5B93F7,
+  0xBB8593DC, 0xBBB093C1, 0xBBDA93A6, 0xBC05938B, 0xBC2F9371, 0xBC5A9356, 0xBC85933C, 0xBCAF9321,
+  0xBCDA9307, 0xBD0592EC, 0xBD3092D2, 0xBD5B92B8, 0xBD86929E, 0xBDB19284, 0xBDDC926A, 0xBE079250,
+  0xBE329236, 0xBE5D921C, 0xBE889202, 0xBEB391E9, 0xBEDF91CF, 0xBF0A91B6, 0xBF35919C, 0xBF619183,
+  0xBF8C9169, 0xBFB89150, 0xBFE39137, 0xC00F911E, 0xC03A9105, 0xC06690EC, 0xC09190D3, 0xC0BD90BA,
+  0xC0E990A1, 0xC1149088, 0xC1409070, 0xC16C9057, 0xC198903E, 0xC1C49026, 0xC1F0900E, 0xC21C8FF5,
+  0xC2488FDD, 0xC2748FC5, 0xC2A08FAD, 0xC2CC8F95, 0xC2F88F7D, 0xC3248F65, 0xC3518F4D, 0xC37D8F35,
+  0xC3A98F1D, 0xC3D68F06, 0xC4028EEE, 0xC42E8ED6, 0xC45B8EBF, 0xC4878EA8, 0xC4B48E90, 0xC4E08E79,
+  0xC50D8E62, 0xC53A8E4B, 0xC5668E34, 0xC5938E1D, 0xC5C08E06, 0xC5ED8DEF, 0xC6198DD8, 0xC6468DC1,
+  0xC6738DAB, 0xC6A08D94, 0xC6CD8D7E, 0xC6FA8D67, 0xC7278D51, 0xC7548D3B, 0xC7818D24, 0xC7AE8D0E,
+  0xC7DB8CF8, 0xC8098CE2, 0xC8368CCC, 0xC8638CB6, 0xC8908CA1, 0xC8BE8C8B, 0xC8EB8C75, 0xC9188C60,
+  0xC9468C4A, 0xC9738C35, 0xC9A18C1F, 0xC9CE8C0A, 0xC9FC8BF5, 0xCA298BDF, 0xCA578BCA, 0xCA858BB5,
+  0xCAB28BA0, 0xCAE08B8B, 0xCB0E8B77, 0xCB3C8B62, 0xCB698B4D, 0xCB978B39, 0xCBC58B24, 0xCBF38B10,
+  0xCC218AFB, 0xCC4F8AE7, 0xCC7D8AD3, 0xCCAB8ABE, 0xCCD98AAA, 0xCD078A96, 0xCD358A82, 0xCD638A6E,
+  0xCD928A5A, 0xCDC08A47, 0xCDEE8A33, 0xCE1C8A1F, 0xCE4B8A0C, 0xCE7989F8, 0xCEA789E5, 0xCED689D2,
+  0xCF0489BE, 0xCF3389AB, 0xCF618998, 0xCF908985, 0xCFBE8972, 0xCFED895F, 0xD01B894C, 0xD04A8939,
+  0xD0798927, 0xD0A78914, 0xD0D68902, 0xD10588EF, 0xD13488DD, 0xD16288CA, 0xD19188B8, 0xD1C088A6,
+  0xD1EF8894, 0xD21E8882, 0xD24D8870, 0xD27C885E, 0xD2AB884C, 0xD2DA883A, 0xD3098828, 0xD3388817,
+  0xD3678805, 0xD39687F4, 0xD3C587E2, 0xD3F487D1, 0xD42487C0, 0xD45387AF, 0xD482879D, 0xD4B1878C,
+  0xD4E1877B, 0xD510876B, 0xD53F875A, 0xD56F8749, 0xD59E8738, 0xD5CE8728, 0xD5FD8717, 0xD62D8707,
+  0xD65C86F6, 0xD68C86E6, 0xD6BB86D6, 0xD6EB86C6, 0xD71B86B6, 0xD74A86A5, 0xD77A8696, 0xD7AA8686,
+  0xD7D98676, 0xD8098666, 0xD8398656, 0xD8698647, 0xD8988637, 0xD8C88628, 0xD8F88619, 0xD9288609,
+  0xD95885FA, 0xD98885EB, 0xD9B885DC, 0xD9E885CD, 0xDA1885BE, 0xDA4885AF, 0xDA7885A0, 0xDAA88592,
+  0xDAD88583, 0xDB088574, 0xDB388566, 0xDB688558, 0xDB998549, 0xDBC9853B, 0xDBF9852D, 0xDC29851F,
+  0xDC598511, 0xDC8A8503, 0xDCBA84F5, 0xDCEA84E7, 0xDD1B84D9, 0xDD4B84CC, 0xDD7C84BE, 0xDDAC84B0,
+  0xDDDC84A3, 0xDE0D8496, 0xDE3D8488, 0xDE6E847B, 0xDE9E846E, 0xDECF8461, 0xDEFF8454, 0xDF308447,
+  0xDF61843A, 0xDF91842D, 0xDFC28421, 0xDFF28414, 0xE0238407, 0xE05483FB, 0xE08583EF, 0xE0B583E2,
+  0xE0E683D6, 0xE11783CA, 0xE14883BE, 0xE17883B2, 0xE1A983A6, 0xE1DA839A, 0xE20B838E, 0xE23C8382,
+  0xE26D8377, 0xE29E836B, 0xE2CF8360, 0xE2FF8354, 0xE3308349, 0xE361833E, 0xE3928332, 0xE3C38327,
+  0xE3F4831C, 0xE4268311, 0xE4578306, 0xE48882FB, 0xE4B982F1, 0xE4EA82E6, 0xE51B82DB, 0xE54C82D1,
+  0xE57D82C6, 0xE5AF82BC, 0xE5E082B2, 0xE61182A8, 0xE642829D, 0xE6738293, 0xE6A58289, 0xE6D6827F,
+  0xE7078276, 0xE739826C, 0xE76A8262, 0xE79B8259, 0xE7CD824F, 0xE7FE8246, 0xE82F823C, 0xE8618233,
+  0xE892822A, 0xE8C48220, 0xE8F58217, 0xE926820E, 0xE9588205, 0xE98981FD, 0xE9BB81F4, 0xE9EC81EB,
+  0xEA1E81E2, 0xEA4F81DA, 0xEA8181D1, 0xEAB381C9, 0xEAE481C1, 0xEB1681B8, 0xEB4781B0, 0xEB7981A8,
+  0xEBAB81A0, 0xEBDC8198, 0xEC0E8190, 0xEC3F8188, 0xEC718181, 0xECA38179, 0xECD58172, 0xED06816A,
+  0xED388163, 0xED6A815B, 0xED9B8154, 0xEDCD814D, 0xEDFF8146, 0xEE31813F, 0xEE628138, 0xEE948131,
+  0xEEC6812A, 0xEEF88123, 0xEF2A811D, 0xEF5C8116, 0xEF8D8110, 0xEFBF8109, 0xEFF18103, 0xF02380FD,
+  0xF05580F6, 0xF08780F0, 0xF0B980EA, 0xF0EB80E4, 0xF11C80DE, 0xF14E80D9, 0xF18080D3, 0xF1B280CD,
+  0xF1E480C8, 0xF21680C2, 0xF24880BD, 0xF27A80B7, 0xF2AC80B2, 0xF2DE80AD, 0xF31080A8, 0xF34280A3,
+  0xF374809E, 0xF3A68099, 0xF3D88094, 0xF40A808F, 0xF43C808B, 0xF46E8086, 0xF4A08082, 0xF4D3807D,
+  0xF5058079, 0xF5378075, 0xF5698070, 0xF59B806C, 0xF5CD8068, 0xF5FF8064, 0xF6318060, 0xF663805D,
+  0xF6958059, 0xF6C88055, 0xF6FA8052, 0xF72C804E, 0xF75E804B, 0xF7908047, 0xF7C28044, 0xF7F48041,
+  0xF827803E, 0xF859803B, 0xF88B8038, 0xF8BD8035, 0xF8EF8032, 0xF922802F, 0xF954802D, 0xF986802A,
+  0xF9B88027, 0xF9EA8025, 0xFA1D8023, 0xFA4F8020, 0xFA81801E, 0xFAB3801C, 0xFAE5801A, 0xFB188018,
+  0xFB4A8016, 0xFB7C8014, 0xFBAE8013, 0xFBE18011, 0xFC13800F, 0xFC45800E, 0xFC77800C, 0xFCAA800B,
+  0xFCDC800A, 0xFD0E8009, 0xFD408008, 0xFD738007, 0xFDA58006, 0xFDD78005, 0xFE098004, 0xFE3C8003,
+  0xFE6E8002, 0xFEA08002, 0xFED28001, 0xFF058001, 0xFF378001, 0xFF698001, 0xFF9B8001, 0xFFCE8001,
+  0x00008001, 0x00328001, 0x00658001, 0x00978001, 0x00C98001, 0x00FB8001, 0x012E8001, 0x01608002,
+  0x01928002, 0x01C48003, 0x01F78004, 0x02298005, 0x025B8006, 0x028D8007, 0x02C08008, 0x02F28009,
+  0x0324800A, 0x0356800B, 0x0389800C, 0x03BB800E, 0x03ED800F, 0x041F8011, 0x04528013, 0x04848014,
+  0x04B68016, 0x04E88018, 0x051B801A, 0x054D801C, 0x057F801E, 0x05B18020, 0x05E38023, 0x06168025,
+  0x06488027, 0x067A802A, 0x06AC802D, 0x06DE802F, 0x07118032, 0x07438035, 0x07758038, 0x07A7803B,
+  0x07D9803E, 0x080C8041, 0x083E8044, 0x08708047, 0x08A2804B, 0x08D4804E, 0x09068052, 0x09388055,
+  0x096B8059, 0x099D805D, 0x09CF8060, 0x0A018064, 0x0A338068, 0x0A65806C, 0x0A978070, 0x0AC98075,
+  0x0AFB8079, 0x0B2D807D, 0x0B608082, 0x0B928086, 0x0BC4808B, 0x0BF6808F, 0x0C288094, 0x0C5A8099,
+  0x0C8C809E, 0x0CBE80A3, 0x0CF080A8, 0x0D2280AD, 0x0D5480B2, 0x0D8680B7, 0x0DB880BD, 0x0DEA80C2,
+  0x0E1C80C8, 0x0E4E80CD, 0x0E8080D3, 0x0EB280D9, 0x0EE480DE, 0x0F1580E4, 0x0F4780EA, 0x0F7980F0,
+  0x0FAB80F6, 0x0FDD80FD, 0x100F8103, 0x10418109, 0x10738110, 0x10A48116, 0x10D6811D, 0x11088123,
+  0x113A812A, 0x116C8131, 0x119E8138, 0x11CF813F, 0x12018146, 0x1233814D, 0x12658154, 0x1296815B,
+  0x12C88163, 0x12FA816A, 0x132B8172, 0x135D8179, 0x138F8181, 0x13C18188, 0x13F28190, 0x14248198,
+  0x145581A0, 0x148781A8, 0x14B981B0, 0x14EA81B8, 0x151C81C1, 0x154D81C9, 0x157F81D1, 0x15B181DA,
+  0x15E281E2, 0x161481EB, 0x164581F4, 0x167781FD, 0x16A88205, 0x16DA820E, 0x170B8217, 0x173C8220,
+  0x176E822A, 0x179F8233, 0x17D1823C, 0x18028246, 0x1833824F, 0x18658259, 0x18968262, 0x18C7826C,
+  0x18F98276, 0x192A827F, 0x195B8289, 0x198D8293, 0x19BE829D, 0x19EF82A8, 0x1A2082B2, 0x1A5182BC,
+  0x1A8382C6, 0x1AB482D1, 0x1AE582DB, 0x1B1682E6, 0x1B4782F1, 0x1B7882FB, 0x1BA98306, 0x1BDA8311,
+  0x1C0C831C, 0x1C3D8327, 0x1C6E8332, 0x1C9F833E, 0x1CD08349, 0x1D018354, 0x1D318360, 0x1D62836B,
+  0x1D938377, 0x1DC48382, 0x1DF5838E, 0x1E26839A, 0x1E5783A6, 0x1E8883B2, 0x1EB883BE, 0x1EE983CA,
+  0x1F1A83D6, 0x1F4B83E2, 0x1F7B83EF, 0x1FAC83FB, 0x1FDD8407, 0x200E8414, 0x203E8421, 0x206F842D,
+  0x209F843A, 0x20D08447, 0x21018454, 0x21318461, 0x2162846E, 0x2192847B, 0x21C38488, 0x21F38496,
+  0x222484A3, 0x225484B0, 0x228484BE, 0x22B584CC, 0x22E584D9, 0x231684E7, 0x234684F5, 0x23768503,
+  0x23A78511, 0x23D7851F, 0x2407852D, 0x2437853B, 0x24678549, 0x24988558, 0x24C88566, 0x24F88574,
+  0x25288583, 0x25588592, 0x258885A0, 0x25B885AF, 0x25E885BE, 0x261885CD, 0x264885DC, 0x267885EB,
+  0x26A885FA, 0x26D88609, 0x27088619, 0x27388628, 0x27688637, 0x27978647, 0x27C78656, 0x27F78666,
+  0x28278676, 0x28568686, 0x28868696, 0x28B686A5, 0x28E586B6, 0x291586C6, 0x294586D6, 0x297486E6,
+  0x29A486F6, 0x29D38707, 0x2A038717, 0x2A328728, 0x2A628738, 0x2A918749, 0x2AC1875A, 0x2AF0876B,
+  0x2B1F877B, 0x2B4F878C, 0x2B7E879D, 0x2BAD87AF, 0x2BDC87C0, 0x2C0C87D1, 0x2C3B87E2, 0x2C6A87F4,
+  0x2C998805, 0x2CC88817, 0x2CF78828, 0x2D26883A, 0x2D55884C, 0x2D84885E, 0x2DB38870, 0x2DE28882,
+  0x2E118894, 0x2E4088A6, 0x2E6F88B8, 0x2E9E88CA, 0x2ECC88DD, 0x2EFB88EF, 0x2F2A8902, 0x2F598914,
+  0x2F878927, 0x2FB68939, 0x2FE5894C, 0x3013895F, 0x30428972, 0x30708985, 0x309F8998, 0x30CD89AB,
+  0x30FC89BE, 0x312A89D2, 0x315989E5, 0x318789F8, 0x31B58A0C, 0x31E48A1F, 0x32128A33, 0x32408A47,
+  0x326E8A5A, 0x329D8A6E, 0x32CB8A82, 0x32F98A96, 0x33278AAA, 0x33558ABE, 0x33838AD3, 0x33B18AE7,
+  0x33DF8AFB, 0x340D8B10, 0x343B8B24, 0x34698B39, 0x34978B4D, 0x34C48B62, 0x34F28B77, 0x35208B8B,
+  0x354E8BA0, 0x357B8BB5, 0x35A98BCA, 0x35D78BDF, 0x36048BF5, 0x36328C0A, 0x365F8C1F, 0x368D8C35,
+  0x36BA8C4A, 0x36E88C60, 0x37158C75, 0x37428C8B, 0x37708CA1, 0x379D8CB6, 0x37CA8CCC, 0x37F78CE2,
+  0x38258CF8, 0x38528D0E, 0x387F8D24, 0x38AC8D3B, 0x38D98D51, 0x39068D67, 0x39338D7E, 0x39608D94,
+  0x398D8DAB, 0x39BA8DC1, 0x39E78DD8, 0x3A138DEF, 0x3A408E06, 0x3A6D8E1D, 0x3A9A8E34, 0x3AC68E4B,
+  0x3AF38E62, 0x3B208E79, 0x3B4C8E90, 0x3B798EA8, 0x3BA58EBF, 0x3BD28ED6, 0x3BFE8EEE, 0x3C2A8F06,
+  0x3C578F1D, 0x3C838F35, 0x3CAF8F4D, 0x3CDC8F65, 0x3D088F7D, 0x3D348F95, 0x3D608FAD, 0x3D8C8FC5,
+  0x3DB88FDD, 0x3DE48FF5, 0x3E10900E, 0x3E3C9026, 0x3E68903E, 0x3E949057, 0x3EC09070, 0x3EEC9088,
+  0x3F1790A1, 0x3F4390BA, 0x3F6F90D3, 0x3F9A90EC, 0x3FC69105, 0x3FF1911E, 0x401D9137, 0x40489150,
+  0x40749169, 0x409F9183, 0x40CB919C, 0x40F691B6, 0x412191CF, 0x414D91E9, 0x41789202, 0x41A3921C,
+  0x41CE9236, 0x41F99250, 0x4224926A, 0x424F9284, 0x427A929E, 0x42A592B8, 0x42D092D2, 0x42FB92EC,
+  0x43269307, 0x43519321, 0x437B933C, 0x43A69356, 0x43D19371, 0x43FB938B, 0x442693A6, 0x445093C1,
+  0x447B93DC, 0x44A593F7, 0x44D09412, 0x44FA942D, 0x45249448, 0x454F9463, 0x4579947E, 0x45A3949A,
+  0x45CD94B5, 0x45F794D0, 0x462194EC, 0x464B9508, 0x46759523, 0x469F953F, 0x46C9955B, 0x46F39577,
+  0x471D9592, 0x474795AE, 0x477095CA, 0x479A95E6, 0x47C49603, 0x47ED961F, 0x4817963B, 0x48409657,
+  0x486A9674, 0x48939690, 0x48BD96AD, 0x48E696C9, 0x490F96E6, 0x49399703, 0x49629720, 0x498B973C,
+  0x49B49759, 0x49DD9776, 0x4A069793, 0x4A2F97B0, 0x4A5897CE, 0x4A8197EB, 0x4AAA9808, 0x4AD39826,
+  0x4AFB9843, 0x4B249860, 0x4B4D987E, 0x4B75989C, 0x4B9E98B9, 0x4BC798D7, 0x4BEF98F5, 0x4C179913,
+  0x4C409930, 0x4C68994E, 0x4C91996D, 0x4CB9998B, 0x4CE199A9, 0x4D0999C7, 0x4D3199E5, 0x4D599A04,
+  0x4D819A22, 0x4DA99A40, 0x4DD19A5F, 0x4DF99A7E, 0x4E219A9C, 0x4E499ABB, 0x4E719ADA, 0x4E989AF9,
+  0x4EC09B17, 0x4EE89B36, 0x4F0F9B55, 0x4F379B75, 0x4F5E9B94, 0x4F859BB3, 0x4FAD9BD2, 0x4FD49BF1,
+  0x4FFB9C11, 0x50239C30, 0x504A9C50, 0x50719C6F, 0x50989C8F, 0x50BF9CAF, 0x50E69CCE, 0x510D9CEE,
+  0x51349D0E, 0x515B9D2E, 0x51819D4E, 0x51A89D6E, 0x51CF9D8E, 0x51F59DAE, 0x521C9DCE, 0x52439DEF,
+  0x52699E0F, 0x52909E2F, 0x52B69E50, 0x52DC9E70, 0x53039E91, 0x53299EB2, 0x534F9ED2, 0x53759EF3,
+  0x539B9F14, 0x53C19F35, 0x53E79F56, 0x540D9F77, 0x54339F98, 0x54599FB9, 0x547F9FDA, 0x54A49FFB,
+  0x54CAA01C, 0x54F0A03E, 0x5515A05F, 0x553BA080, 0x5560A0A2, 0x5586A0C4, 0x55ABA0E5, 0x55D0A107,
+  0x55F6A129, 0x561BA14A, 0x5640A16C, 0x5665A18E, 0x568AA1B0, 0x56AFA1D2, 0x56D4A1F4, 0x56F9A216,
+  0x571EA238, 0x5743A25B, 0x5767A27D, 0x578CA29F, 0x57B1A2C2, 0x57D5A2E4, 0x57FAA307, 0x581EA329,
+  0x5843A34C, 0x5867A36F, 0x588CA391, 0x58B0A3B4, 0x58D4A3D7, 0x58F8A3FA, 0x591CA41D, 0x5940A440,
+  0x5964A463, 0x5988A486, 0x59ACA4A9, 0x59D0A4CC, 0x59F4A4F0, 0x5A18A513, 0x5A3BA537, 0x5A5FA55A,
+  0x5A82A57E, 0x5AA6A5A1, 0x5AC9A5C5, 0x5AEDA5E8, 0x5B10A60C, 0x5B34A630, 0x5B57A654, 0x5B7AA678,
+  0x5B9DA69C, 0x5BC0A6C0, 0x5BE3A6E4, 0x5C06A708, 0x5C29A72C, 0x5C4CA750, 0x5C6FA774, 0x5C91A799,
+  0x5CB4A7BD, 0x5CD7A7E2, 0x5CF9A806, 0x5D1CA82B, 0x5D3EA84F, 0x5D61A874, 0x5D83A899, 0x5DA5A8BD,
+  0x5DC8A8E2, 0x5DEAA907, 0x5E0CA92C, 0x5E2EA951, 0x5E50A976, 0x5E72A99B, 0x5E94A9C0, 0x5EB6A9E5,
+  0x5ED7AA0A, 0x5EF9AA30, 0x5F1BAA55, 0x5F3CAA7A, 0x5F5EAAA0, 0x5F80AAC5, 0x5FA1AAEB, 0x5FC2AB10,
+  0x5FE4AB36, 0x6005AB5C, 0x6026AB81, 0x6047ABA7, 0x6068ABCD, 0x6089ABF3, 0x60AAAC19, 0x60CBAC3F,
+  0x60ECAC65, 0x610DAC8B, 0x612EACB1, 0x614EACD7, 0x616FACFD, 0x6190AD24, 0x61B0AD4A, 0x61D1AD70,
+  0x61F1AD97, 0x6211ADBD, 0x6232ADE4, 0x6252AE0B, 0x6272AE31, 0x6292AE58, 0x62B2AE7F, 0x62D2AEA5,
+  0x62F2AECC, 0x6312AEF3, 0x6332AF1A, 0x6351AF41, 0x6371AF68, 0x6391AF8F, 0x63B0AFB6, 0x63D0AFDD,
+  0x63EFB005, 0x640FB02C, 0x642EB053, 0x644DB07B, 0x646CB0A2, 0x648BB0C9, 0x64ABB0F1, 0x64CAB118,
+  0x64E9B140, 0x6507B168, 0x6526B18F, 0x6545B1B7, 0x6564B1DF, 0x6582B207, 0x65A1B22F, 0x65C0B257,
+  0x65DEB27F, 0x65FCB2A7, 0x661BB2CF, 0x6639B2F7, 0x6657B31F, 0x6675B347, 0x6693B36F, 0x66B2B398,
+  0x66D0B3C0, 0x66EDB3E9, 0x670BB411, 0x6729B439, 0x6747B462, 0x6764B48B, 0x6782B4B3, 0x67A0B4DC,
+  0x67BDB505, 0x67DAB52D, 0x67F8B556, 0x6815B57F, 0x6832B5A8, 0x6850B5D1, 0x686DB5FA, 0x688AB623,
+  0x68A7B64C, 0x68C4B675, 0x68E0B69E, 0x68FDB6C7, 0x691AB6F1, 0x6937B71A, 0x6953B743, 0x6970B76D,
+  0x698CB796, 0x69A9B7C0, 0x69C5B7E9, 0x69E1B813, 0x69FDB83C, 0x6A1AB866, 0x6A36B890, 0x6A52B8B9,
+  0x6A6EB8E3, 0x6A89B90D, 0x6AA5B937, 0x6AC1B961, 0x6ADDB98B, 0x6AF8B9B5, 0x6B14B9DF, 0x6B30BA09,
+  0x6B4BBA33, 0x6B66BA5D, 0x6B82BA87, 0x6B9DBAB1, 0x6BB8BADC, 0x6BD3BB06, 0x6BEEBB30, 0x6C09BB5B,
+  0x6C24BB85, 0x6C3FBBB0, 0x6C5ABBDA, 0x6C75BC05, 0x6C8FBC2F, 0x6CAABC5A, 0x6CC4BC85, 0x6CDFBCAF,
+  0x6CF9BCDA, 0x6D14BD05, 0x6D2EBD30, 0x6D48BD5B, 0x6D62BD86, 0x6D7CBDB1, 0x6D96BDDC, 0x6DB0BE07,
+  0x6DCABE32, 0x6DE4BE5D, 0x6DFEBE88, 0x6E17BEB3, 0x6E31BEDF, 0x6E4ABF0A, 0x6E64BF35, 0x6E7DBF61,
+  0x6E97BF8C, 0x6EB0BFB8, 0x6EC9BFE3, 0x6EE2C00F, 0x6EFBC03A, 0x6F14C066, 0x6F2DC091, 0x6F46C0BD,
+  0x6F5FC0E9, 0x6F78C114, 0x6F90C140, 0x6FA9C16C, 0x6FC2C198, 0x6FDAC1C4, 0x6FF2C1F0, 0x700BC21C,
+  0x7023C248, 0x703BC274, 0x7053C2A0, 0x706BC2CC, 0x7083C2F8, 0x709BC324, 0x70B3C351, 0x70CBC37D,
+  0x70E3C3A9, 0x70FAC3D6, 0x7112C402, 0x712AC42E, 0x7141C45B, 0x7158C487, 0x7170C4B4, 0x7187C4E0,
+  0x719EC50D, 0x71B5C53A, 0x71CCC566, 0x71E3C593, 0x71FAC5C0, 0x7211C5ED, 0x7228C619, 0x723FC646,
+  0x7255C673, 0x726CC6A0, 0x7282C6CD, 0x7299C6FA, 0x72AFC727, 0x72C5C754, 0x72DCC781, 0x72F2C7AE,
+  0x7308C7DB, 0x731EC809, 0x7334C836, 0x734AC863, 0x735FC890, 0x7375C8BE, 0x738BC8EB, 0x73A0C918,
+  0x73B6C946, 0x73CBC973, 0x73E1C9A1, 0x73F6C9CE, 0x740BC9FC, 0x7421CA29, 0x7436CA57, 0x744BCA85,
+  0x7460CAB2, 0x7475CAE0, 0x7489CB0E, 0x749ECB3C, 0x74B3CB69, 0x74C7CB97, 0x74DCCBC5, 0x74F0CBF3,
+  0x7505CC21, 0x7519CC4F, 0x752DCC7D, 0x7542CCAB, 0x7556CCD9, 0x756ACD07, 0x757ECD35, 0x7592CD63,
+  0x75A6CD92, 0x75B9CDC0, 0x75CDCDEE, 0x75E1CE1C, 0x75F4CE4B, 0x7608CE79, 0x761BCEA7, 0x762ECED6,
+  0x7642CF04, 0x7655CF33, 0x7668CF61, 0x767BCF90, 0x768ECFBE, 0x76A1CFED, 0x76B4D01B, 0x76C7D04A,
+  0x76D9D079, 0x76ECD0A7, 0x76FED0D6, 0x7711D105, 0x7723D134, 0x7736D162, 0x7748D191, 0x775AD1C0,
+  0x776CD1EF, 0x777ED21E, 0x7790D24D, 0x77A2D27C, 0x77B4D2AB, 0x77C6D2DA, 0x77D8D309, 0x77E9D338,
+  0x77FBD367, 0x780CD396, 0x781ED3C5, 0x782FD3F4, 0x7840D424, 0x7851D453, 0x7863D482, 0x7874D4B1,
+  0x7885D4E1, 0x7895D510, 0x78A6D53F, 0x78B7D56F, 0x78C8D59E, 0x78D8D5CE, 0x78E9D5FD, 0x78F9D62D,
+  0x790AD65C, 0x791AD68C, 0x792AD6BB, 0x793AD6EB, 0x794AD71B, 0x795BD74A, 0x796AD77A, 0x797AD7AA,
+  0x798AD7D9, 0x799AD809, 0x79AAD839, 0x79B9D869, 0x79C9D898, 0x79D8D8C8, 0x79E7D8F8, 0x79F7D928,
+  0x7A06D958, 0x7A15D988, 0x7A24D9B8, 0x7A33D9E8, 0x7A42DA18, 0x7A51DA48, 0x7A60DA78, 0x7A6EDAA8,
+  0x7A7DDAD8, 0x7A8CDB08, 0x7A9ADB38, 0x7AA8DB68, 0x7AB7DB99, 0x7AC5DBC9, 0x7AD3DBF9, 0x7AE1DC29,
+  0x7AEFDC59, 0x7AFDDC8A, 0x7B0BDCBA, 0x7B19DCEA, 0x7B27DD1B, 0x7B34DD4B, 0x7B42DD7C, 0x7B50DDAC,
+  0x7B5DDDDC, 0x7B6ADE0D, 0x7B78DE3D, 0x7B85DE6E, 0x7B92DE9E, 0x7B9FDECF, 0x7BACDEFF, 0x7BB9DF30,
+  0x7BC6DF61, 0x7BD3DF91, 0x7BDFDFC2, 0x7BECDFF2, 0x7BF9E023, 0x7C05E054, 0x7C11E085, 0x7C1EE0B5,
+  0x7C2AE0E6, 0x7C36E117, 0x7C42E148, 0x7C4EE178, 0x7C5AE1A9, 0x7C66E1DA, 0x7C72E20B, 0x7C7EE23C,
+  0x7C89E26D, 0x7C95E29E, 0x7CA0E2CF, 0x7CACE2FF, 0x7CB7E330, 0x7CC2E361, 0x7CCEE392, 0x7CD9E3C3,
+  0x7CE4E3F4, 0x7CEFE426, 0x7CFAE457, 0x7D05E488, 0x7D0FE4B9, 0x7D1AE4EA, 0x7D25E51B, 0x7D2FE54C,
+  0x7D3AE57D, 0x7D44E5AF, 0x7D4EE5E0, 0x7D58E611, 0x7D63E642, 0x7D6DE673, 0x7D77E6A5, 0x7D81E6D6,
+  0x7D8AE707, 0x7D94E739, 0x7D9EE76A, 0x7DA7E79B, 0x7DB1E7CD, 0x7DBAE7FE, 0x7DC4E82F, 0x7DCDE861,
+  0x7DD6E892, 0x7DE0E8C4, 0x7DE9E8F5, 0x7DF2E926, 0x7DFBE958, 0x7E03E989, 0x7E0CE9BB, 0x7E15E9EC,
+  0x7E1EEA1E, 0x7E26EA4F, 0x7E2FEA81, 0x7E37EAB3, 0x7E3FEAE4, 0x7E48EB16, 0x7E50EB47, 0x7E58EB79,
+  0x7E60EBAB, 0x7E68EBDC, 0x7E70EC0E, 0x7E78EC3F, 0x7E7FEC71, 0x7E87ECA3, 0x7E8EECD5, 0x7E96ED06,
+  0x7E9DED38, 0x7EA5ED6A, 0x7EACED9B, 0x7EB3EDCD, 0x7EBAEDFF, 0x7EC1EE31, 0x7EC8EE62, 0x7ECFEE94,
+  0x7ED6EEC6, 0x7EDDEEF8, 0x7EE3EF2A, 0x7EEAEF5C, 0x7EF0EF8D, 0x7EF7EFBF, 0x7EFDEFF1, 0x7F03F023,
+  0x7F0AF055, 0x7F10F087, 0x7F16F0B9, 0x7F1CF0EB, 0x7F22F11C, 0x7F27F14E, 0x7F2DF180, 0x7F33F1B2,
+  0x7F38F1E4, 0x7F3EF216, 0x7F43F248, 0x7F49F27A, 0x7F4EF2AC, 0x7F53F2DE, 0x7F58F310, 0x7F5DF342,
+  0x7F62F374, 0x7F67F3A6, 0x7F6CF3D8, 0x7F71F40A, 0x7F75F43C, 0x7F7AF46E, 0x7F7EF4A0, 0x7F83F4D3,
+  0x7F87F505, 0x7F8BF537, 0x7F90F569, 0x7F94F59B, 0x7F98F5CD, 0x7F9CF5FF, 0x7FA0F631, 0x7FA3F663,
+  0x7FA7F695, 0x7FABF6C8, 0x7FAEF6FA, 0x7FB2F72C, 0x7FB5F75E, 0x7FB9F790, 0x7FBCF7C2, 0x7FBFF7F4,
+  0x7FC2F827, 0x7FC5F859, 0x7FC8F88B, 0x7FCBF8BD, 0x7FCEF8EF, 0x7FD1F922, 0x7FD3F954, 0x7FD6F986,
+  0x7FD9F9B8, 0x7FDBF9EA, 0x7FDDFA1D, 0x7FE0FA4F, 0x7FE2FA81, 0x7FE4FAB3, 0x7FE6FAE5, 0x7FE8FB18,
+  0x7FEAFB4A, 0x7FECFB7C, 0x7FEDFBAE, 0x7FEFFBE1, 0x7FF1FC13, 0x7FF2FC45, 0x7FF4FC77, 0x7FF5FCAA,
+  0x7FF6FCDC, 0x7FF7FD0E, 0x7FF8FD40, 0x7FF9FD73, 0x7FFAFDA5, 0x7FFBFDD7, 0x7FFCFE09, 0x7FFDFE3C,
+  0x7FFEFE6E, 0x7FFEFEA0, 0x7FFFFED2, 0x7FFFFF05, 0x7FFFFF37, 0x7FFFFF69, 0x7FFFFF9B, 0x7FFFFFCE
+};
+
+//11 bit reversed indices, shifted right for shorter FFTs
+static uint16_t fft_bitrev[2048] FFT_TABLE_SECTION = {
+     0, 1024,  512, 1536,  256, 1280,  768, 1792,  128, 1152,  640, 1664,  384, 1408,  896, 1920,
+    64, 1088,  576, 1600,  320, 1344,  832, 1856,  192, 1216,  704, 1728,  448, 1472,  960, 1984,
+    32, 1056,  544, 1568,  288, 1312,  800, 1824,  160, 1184,  672, 1696,  416, 1440,  928, 1952,
+    96, 1120,  608, 1632,  352, 1376,  864, 1888,  224, 1248,  736, 1760,  480, 1504,  992, 2016,
+    16, 1040,  528, 1552,  272, 1296,  784, 1808,  144, 1168,  656, 1680,  400, 1424,  912, 1936,
+    80, 1104,  592, 1616,  336, 1360,  848, 1872,  208, 1232,  720, 1744,  464, 1488,  976, 2000,
+    48, 1072,  560, 1584,  304, 1328,  816, 1840,  176, 1200,  688, 1712,  432, 1456,  944, 1968,
+   112, 1136,  624, 1648,  368, 1392,  880, 1904,  240, 1264,  752, 1776,  496, 1520, 1008, 2032,
+     8, 1032,  520, 1544,  264, 1288,  776, 1800,  136, 1160,  648, 1672,  392, 1416,  904, 1928,
+    72, 1096,  584, 1608,  328, 1352,  840, 1864,  200, 1224,  712, 1736,  456, 1480,  968, 1992,
+    40, 1064,  552, 1576,  296, 1320,  808, 1832,  168, 1192,  680, 1704,  424, 1448,  936, 1960,
+   104, 1128,  616, 1640,  360, 1384,  872, 1896,  232, 1256,  744, 1768,  488, 1512, 1000, 2024,
+    24, 1048,  536, 1560,  280, 1304,  792, 1816,  152, 1176,  664, 1688,  408, 1432,  920, 1944,
+    88, 1112,  600, 1624,  344, 1368,  856, 1880,  216, 1240,  728, 1752,  472, 1496,  984, 2008,
+    56, 1080,  568, 1592,  312, 1336,  824, 1848,  184, 1208,  696, 1720,  440, 1464,  952, 1976,
+   120, 1144,  632, 1656,  376, 1400,  888, 1912,  248, 1272,  760, 1784,  504, 1528, 1016, 2040,
+     4, 1028,  516, 1540,  260, 1284,  772, 1796,  132, 1156,  644, 1668,  388, 1412,  900, 1924,
+    68, 1092,  580, 1604,  324, 1348,  836, 1860,  196, 1220,  708, 1732,  452, 1476,  964, 1988,
+    36, 1060,  548, 1572,  292, 1316,  804, 1828,  164, 1188,  676, 1700,  420, 1444,  932, 1956,
+   100, 1124,  612, 1636,  356, 1380,  868, 1892,  228, 1252,  740, 1764,  484, 1508,  996, 2020,
+    20, 1044,  532, 1556,  276, 1300,  788, 1812,  148, 1172,  660, 1684,  404, 1428,  916, 1940,
+    84, 1108,  596, 1620,  340, 1364,  852, 1876,  212, 1236,  724, 1748,  468, 1492,  980, 2004,
+    52, 1076,  564, 1588,  308, 1332,  820, 1844,  180, 1204,  692, 1716,  436, 1460,  948, 1972,
+   116, 1140,  628, 1652,  372, 1396,  884, 1908,  244, 1268,  756, 1780,  500, 1524, 1012, 2036,
+    12, 1036,  524, 1548,  268, 1292,  780, 1804,  140, 1164,  652, 1676,  396, 1420,  908, 1932,
+    76, 1100,  588, 1612,  332, 1356,  844, 1868,  204, 1228,  716, 1740,  460, 1484,  972, 1996,
+    44, 1068,  556, 1580,  300, 1324,  812, 1836,  172, 1196,  684, 1708,  428, 1452,  940, 1964,
+   108, 1132,  620, 1644,  364, 1388,  876, 1900,  236, 1260,  748, 1772,  492, 1516, 1004, 2028,
+    28, 1052,  540, 1564,  284, 1308,  796, 1820,  156, 1180,  668, 1692,  412, 1436,  924, 1948,
+    92, 1116,  604, 1628,  348, 1372,  860, 1884,  220, 1244,  732, 1756,  476, 1500,  988, 2012,
+    60, 1084,  572, 1596,  316, 1340,  828, 1852,  188, 1212,  700, 1724,  444, 1468,  956, 1980,
+   124, 1148,  636, 1660,  380, 1404,  892, 1916,  252, 1276,  764, 1788,  508, 1532, 1020, 2044,
+     2, 1026,  514, 1538,  258, 1282,  770, 1794,  130, 1154,  642, 1666,  386, 1410,  898, 1922,
+    66, 1090,  578, 1602,  322, 1346,  834, 1858,  194, 1218,  706, 1730,  450, 1474,  962, 1986,
+    34, 1058,  546, 1570,  290, 1314,  802, 1826,  162, 1186,  674, 1698,  418, 1442,  930, 1954,
+    98, 1122,  610, 1634,  354, 1378,  866, 1890,  226, 1250,  738, 1762,  482, 1506,  994, 2018,
+    18, 1042,  530, 1554,  274, 1298,  786, 1810,  146, 1170,  658, 1682,  402, 1426,  914, 1938,
+    82, 1106,  594, 1618,  338, 1362,  850, 1874,  210, 1234,  722, 1746,  466, 1490,  978, 2002,
+    50, 1074,  562, 1586,  306, 1330,  818, 1842,  178, 1202,  690, 1714,  434, 1458,  946, 1970,
+   114, 1138,  626, 1650,  370, 1394,  882, 1906,  242, 1266,  754, 1778,  498, 1522, 1010, 2034,
+    10, 1034,  522, 1546,  266, 1290,  778, 1802,  138, 1162,  650, 1674,  394, 1418,  906, 1930,
+    74, 1098,  586, 1610,  330, 1354,  842, 1866,  202, 1226,  714, 1738,  458, 1482,  970, 1994,
+    42, 1066,  554, 1578,  298, 1322,  810, 1834,  170, 1194,  682, 1706,  426, 1450,  938, 1962,
+   106, 1130,  618, 1642,  362, 1386,  874, 1898,  234, 1258,  746, 1770,  490, 1514, 1002, 2026,
+    26, 1050,  538, 1562,  282, 1306,  794, 1818,  154, 1178,  666, 1690,  410, 1434,  922, 1946,
+    90, 1114,  602, 1626,  346, 1370,  858, 1882,  218, 1242,  730, 1754,  474, 1498,  986, 2010,
+    58, 1082,  570, 1594,  314, 1338,  826, 1850,  186, 1210,  698, 1722,  442, 1466,  954, 1978,
+   122, 1146,  634, 1658,  378, 1402,  890, 1914,  250, 1274,  762, 1786,  506, 1530, 1018, 2042,
+     6, 1030,  518, 1542,  262, 1286,  774, 1798,  134, 1158,  646, 1670,  390, 1414,  902, 1926,
+    70, 1094,  582, 1606,  326, 1350,  838, 1862,  198, 1222,  710, 1734,  454, 1478,  966, 1990,
+    38, 1062,  550, 1574,  294, 1318,  806, 1830,  166, 1190,  678, 1702,  422, 1446,  934, 1958,
+   102, 1126,  614, 1638,  358, 1382,  870, 1894,  230, 1254,  742, 1766,  486, 1510,  998, 2022,
+    22, 1046,  534, 1558,  278, 1302,  790, 1814,  150, 1174,  662, 1686,  406, 1430,  918, 1942,
+    86, 1110,  598, 1622,  342, 1366,  854, 1878,  214, 1238,  726, 1750,  470, 1494,  982, 2006,
+    54, 1078,  566, 1590,  310, 1334,  822, 1846,  182, 1206,  694, 1718,  438, 1462,  950, 1974,
+   118, 1142,  630, 1654,  374, 1398,  886, 1910,  246, 1270,  758, 1782,  502, 1526, 1014, 2038,
+    14, 1038,  526, 1550,  270, 1294,  782, 1806,  142, 1166,  654, 1678,  398, 1422,  910, 1934,
+    78, 1102,  590, 1614,  334, 1358,  846, 1870,  206, 1230,  718, 1742,  462, 1486,  974, 1998,
+    46, 1070,  558, 1582,  302, 1326,  814, 1838,  174, 1198,  686, 1710,  430, 1454,  942, 1966,
+   110, 1134,  622, 1646,  366, 1390,  878, 1902,  238, 1262,  750, 1774,  494, 1518, 1006, 2030,
+    30, 1054,  542, 1566,  286, 1310,  798, 1822,  158, 1182,  670, 1694,  414, 1438,  926, 1950,
+    94, 1118,  606, 1630,  350, 1374,  862, 1886,  222, 1246,  734, 1758,  478, 1502,  990, 2014,
+    62, 1086,  574, 1598,  318, 1342,  830, 1854,  190, 1214,  702, 1726,  446, 1470,  958, 1982,
+   126, 1150,  638, 1662,  382, 1406,  894, 1918,  254, 1278,  766, 1790,  510, 1534, 1022, 2046,
+     1, 1025,  513, 1537,  257, 1281,  769, 1793,  129, 1153,  641, 1665,  385, 1409,  897, 1921,
+    65, 1089,  577, 1601,  321, 1345,  833, 1857,  193, 1217,  705, 1729,  449, 1473,  961, 1985,
+    33, 1057,  545, 1569,  289, 1313,  801, 1825,  161, 1185,  673, 1697,  417, 1441,  929, 1953,
+    97, 1121,  609, 1633,  353, 1377,  865, 1889,  225, 1249,  737, 1761,  481, 1505,  993, 2017,
+    17, 1041,  529, 1553,  273, 1297,  785, 1809,  145, 1169,  657, 1681,  401, 1425,  913, 1937,
+    81, 1105,  593, 1617,  337, 1361,  849, 1873,  209, 1233,  721, 1745,  465, 1489,  977, 2001,
+    49, 1073,  561, 1585,  305, 1329,  817, 1841,  177, 1201,  689, 1713,  433, 1457,  945, 1969,
+   113, 1137,  625, 1649,  369, 1393,  881, 1905,  241, 1265,  753, 1777,  497, 1521, 1009, 2033,
+     9, 1033,  521, 1545,  265, 1289,  777, 1801,  137, 1161,  649, 1673,  393, 1417,  905, 1929,
+    73, 1097,  585, 1609,  329, 1353,  841, 1865,  201, 1225,  713, 1737,  457, 1481,  969, 1993,
+    41, 1065,  553, 1577,  297, 1321,  809, 1833,  169, 1193,  681, 1705,  425, 1449,  937, 1961,
+   105, 1129,  617, 1641,  361, 1385,  873, 1897,  233, 1257,  745, 1769,  489, 1513, 1001, 2025,
+    25, 1049,  537, 1561,  281, 1305,  793, 1817,  153, 1177,  665, 1689,  409, 1433,  921, 1945,
+    89, 1113,  601, 1625,  345, 1369,  857, 1881,  217, 1241,  729, 1753,  473, 1497,  985, 2009,
+    57, 1081,  569, 1593,  313, 1337,  825, 1849,  185, 1209,  697, 1721,  441, 1465,  953, 1977,
+   121, 1145,  633, 1657,  377, 1401,  889, 1913,  249, 1273,  761, 1785,  505, 1529, 1017, 2041,
+     5, 1029,  517, 1541,  261, 1285,  773, 1797,  133, 1157,  645, 1669,  389, 1413,  901, 1925,
+    69, 1093,  581, 1605,  325, 1349,  837, 1861,  197, 1221,  709, 1733,  453, 1477,  965, 1989,
+    37, 1061,  549, 1573,  293, 1317,  805, 1829,  165, 1189,  677, 1701,  421, 1445,  933, 1957,
+   101, 1125,  613, 1637,  357, 1381,  869, 1893,  229, 1253,  741, 1765,  485, 1509,  997, 2021,
+    21, 1045,  533, 1557,  277, 1301,  789, 1813,  149, 1173,  661, 1685,  405, 1429,  917, 1941,
+    85, 1109,  597, 1621,  341, 1365,  853, 1877,  213, 1237,  725, 1749,  469, 1493,  981, 2005,
+    53, 1077,  565, 1589,  309, 1333,  821, 1845,  181, 1205,  693, 1717,  437, 1461,  949, 1973,
+   117, 1141,  629, 1653,  373, 1397,  885, 1909,  245, 1269,  757, 1781,  501, 1525, 1013, 2037,
+    13, 1037,  525, 1549,  269, 1293,  781, 1805,  141, 1165,  653, 1677,  397, 1421,  909, 1933,
+    77, 1101,  589, 1613,  333, 1357,  845, 1869,  205, 1229,  717, 1741,  461, 1485,  973, 1997,
+    45, 1069,  557, 1581,  301, 1325,  813, 1837,  173, 1197,  685, 1709,  429, 1453,  941, 1965,
+   109, 1133,  621, 1645,  365, 1389,  877, 1901,  237, 1261,  749, 1773,  493, 1517, 1005, 2029,
+    29, 1053,  541, 1565,  285, 1309,  797, 1821,  157, 1181,  669, 1693,  413, 1437,  925, 1949,
+    93, 1117,  605, 1629,  349, 1373,  861, 1885,  221, 1245,  733, 1757,  477, 1501,  989, 2013,
+    61, 1085,  573, 1597,  317, 1341,  829, 1853,  189, 1213,  701, 1725,  445, 1469,  957, 1981,
+   125, 1149,  637, 1661,  381, 1405,  893, 1917,  253, 1277,  765, 1789,  509, 1533, 1021, 2045,
+     3, 1027,  515, 1539,  259, 1283,  771, 1795,  131, 1155,  643, 1667,  387, 1411,  899, 1923,
+    67, 1091,  579, 1603,  323, 1347,  835, 1859,  195, 1219,  707, 1731,  451, 1475,  963, 1987,
+    35, 1059,  547, 1571,  291, 1315,  803, 1827,  163, 1187,  675, 1699,  419, 1443,  931, 1955,
+    99, 1123,  611, 1635,  355, 1379,  867, 1891,  227, 1251,  739, 1763,  483, 1507,  995, 2019,
+    19, 1043,  531, 1555,  275, 1299,  787, 1811,  147, 1171,  659, 1683,  403, 1427,  915, 1939,
+    83, 1107,  595, 1619,  339, 1363,  851, 1875,  211, 1235,  723, 1747,  467, 1491,  979, 2003,
+    51, 1075,  563, 1587,  307, 1331,  819, 1843,  179, 1203,  691, 1715,  435, 1459,  947, 1971,
+   115, 1139,  627, 1651,  371, 1395,  883, 1907,  243, 1267,  755, 1779,  499, 1523, 1011, 2035,
+    11, 1035,  523, 1547,  267, 1291,  779, 1803,  139, 1163,  651, 1675,  395, 1419,  907, 1931,
+    75, 1099,  587, 1611,  331, 1355,  843, 1867,  203, 1227,  715, 1739,  459, 1483,  971, 1995,
+    43, 1067,  555, 1579,  299, 1323,  811, 1835,  171, 1195,  683, 1707,  427, 1451,  939, 1963,
+   107, 1131,  619, 1643,  363, 1387,  875, 1899,  235, 1259,  747, 1771,  491, 1515, 1003, 2027,
+    27, 1051,  539, 1563,  283, 1307,  795, 1819,  155, 1179,  667, 1691,  411, 1435,  923, 1947,
+    91, 1115,  603, 1627,  347, 1371,  859, 1883,  219, 1243,  731, 1755,  475, 1499,  987, 2011,
+    59, 1083,  571, 1595,  315, 1339,  827, 1851,  187, 1211,  699, 1723,  443, 1467,  955, 1979,
+   123, 1147,  635, 1659,  379, 1403,  891, 1915,  251, 1275,  763, 1787,  507, 1531, 1019, 2043,
+     7, 1031,  519, 1543,  263, 1287,  775, 1799,  135, 1159,  647, 1671,  391, 1415,  903, 1927,
+    71, 1095,  583, 1607,  327, 1351,  839, 1863,  199, 1223,  711, 1735,  455, 1479,  967, 1991,
+    39, 1063,  551, 1575,  295, 1319,  807, 1831,  167, 1191,  679, 1703,  423, 1447,  935, 1959,
+   103, 1127,  615, 1639,  359, 1383,  871, 1895,  231, 1255,  743, 1767,  487, 1511,  999, 2023,
+    23, 1047,  535, 1559,  279, 1303,  791, 1815,  151, 1175,  663, 1687,  407, 1431,  919, 1943,
+    87, 1111,  599, 1623,  343, 1367,  855, 1879,  215, 1239,  727, 1751,  471, 1495,  983, 2007,
+    55, 1079,  567, 1591,  311, 1335,  823, 1847,  183, 1207,  695, 1719,  439, 1463,  951, 1975,
+   119, 1143,  631, 1655,  375, 1399,  887, 1911,  247, 1271,  759, 1783,  503, 1527, 1015, 2039,
+    15, 1039,  527, 1551,  271, 1295,  783, 1807,  143, 1167,  655, 1679,  399, 1423,  911, 1935,
+    79, 1103,  591, 1615,  335, 1359,  847, 1871,  207, 1231,  719, 1743,  463, 1487,  975, 1999,
+    47, 1071,  559, 1583,  303, 1327,  815, 1839,  175, 1199,  687, 1711,  431, 1455,  943, 1967,
+   111, 1135,  623, 1647,  367, 1391,  879, 1903,  239, 1263,  751, 1775,  495, 1519, 1007, 2031,
+    31, 1055,  543, 1567,  287, 1311,  799, 1823,  159, 1183,  671, 1695,  415, 1439,  927, 1951,
+    95, 1119,  607, 1631,  351, 1375,  863, 1887,  223, 1247,  735, 1759,  479, 1503,  991, 2015,
+    63, 1087,  575, 1599,  319, 1343,  831, 1855,  191, 1215,  703, 1727,  447, 1471,  959, 1983,
+   127, 1151,  639, 1663,  383, 1407,  895, 1919,  255, 1279,  767, 1791,  511, 1535, 1023, 2047
+};
@@ -0,0 +1,101 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_fft.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_fft.c module
+  *
+  *          Spectrum of the left slot of the interleaved buffer:
+  *
+  *          static RealFft fft;
+  *          static float32_t frame[N], magnitude[N/2];
+  *          fftInit(&fft, N);
+  *          ...
+  *          for(i = 0; i < N; i++)
+  *            frame[i] = buf[2*i];
+  *          fftProcess(&fft, frame, frame, FFT_FORWARD);
+  *          fftMagnitude(frame, magnitude, N);
+  *          plotFFT(magnitude, N/2, AUTO_SCALING);
+  *
+  *          The same in Q15, the spectrum is frame_q15 times 2^exponent:
+  *
+  *          exponent = fftProcessQ15(&fft, frame_q15, frame_q15, FFT_SCALE_BLOCK);
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_FFT_H
+#define __STM32F7_FFT_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "arm_math.h"
+#include "stm32f7xx_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define FFT_MIN_SIZE          32
+#define FFT_MAX_SIZE          4096				//Size of the tables in fft_tables.h
+
+#define FFT_FORWARD           0
+#define FFT_INVERSE           1
+
+#define FFT_Q15               0
+#define FFT_Q31               1
+
+#define FFT_SCALE_BLOCK       0					//Shift a stage only when it could overflow
+#define FFT_SCALE_FIXED       1					//Halve at every radix-2 step and once more at the start
+
+/**
+  * @brief  The twiddle and bit reversal tables (20 KB) are initialised data
+  * rather than const so they are copied to RAM at startup instead of being
+  * read from flash. MDK-ARM/STM32746G_Discovery.sct of each project lists
+  * the .dtcm section first in the RAM region, whose first 64 KB at
+  * 0x20000000 are the DTCM.
+  */
+#ifndef FFT_TABLE_SECTION
+#define FFT_TABLE_SECTION     __attribute__((section(".dtcm"), aligned(8)))
+#endif
+
+/**
+  * @brief  fftBenchmark() is only built when FFT_BENCHMARK is defined to 1,
+  * e.g. in the project options
+  */
+#ifndef FFT_BENCHMARK
+#define FFT_BENCHMARK         0
+#endif
+#define FFT_BENCH_SIZES       7					//64, 128, ... 4096 points
+#define FFT_BENCH_BINS        64				//Bins checked against the DFT
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Real FFT of fft_len points
+  * The even samples are the real and the odd samples the imaginary parts of
+  * a complex FFT of half the length, radix-4 with one radix-2 stage when the
+  * half length is an odd power of 2, then split into the spectrum of the real
+  * signal. The spectrum has the packing of arm_rfft_fast_f32(): bin 0, the
+  * real bin fft_len/2, then the real and imaginary parts of bins 1 up.
+  * The fixed point FFTs use the same packing and keep one exponent for the
+  * whole block: with FFT_SCALE_BLOCK each stage is shifted right only as far
+  * as its growth needs from the headroom left by the one before, so quiet
+  * signals keep their low bits, with FFT_SCALE_FIXED every stage is shifted.
+  */
+typedef struct
+{
+	uint32_t fft_len;						//Real samples
+	uint32_t log2_half;					//log2(fft_len/2)
+} RealFft;
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef fftInit(RealFft *fft, uint32_t fft_len);
+void fftProcess(const RealFft *fft, const float32_t *in, float32_t *out, uint8_t inverse);
+void fftMagnitude(const float32_t *spectrum, float32_t *magnitude, uint32_t fft_len);
+void fftPower(const float32_t *spectrum, float32_t *power, uint32_t fft_len);
+int32_t fftComplexQ15(int16_t *z, uint32_t len, uint8_t scaling);
+int32_t fftComplexQ31(int32_t *z, uint32_t len, uint8_t scaling);
+int32_t fftProcessQ15(const RealFft *fft, const int16_t *in, int16_t *out, uint8_t scaling);
+int32_t fftProcessQ31(const RealFft *fft, const int32_t *in, int32_t *out, uint8_t scaling);
+#if FFT_BENCHMARK
+void fftBenchmark(float32_t cycles[2][FFT_BENCH_SIZES], float32_t snr[FFT_BENCH_SIZES]);
+void fftBenchmarkFixed(float32_t cycles[2][FFT_BENCH_SIZES], float32_t snr[2][2][FFT_BENCH_SIZES]);
+#endif
+
+#endif /* __STM32F7_FFT_H */
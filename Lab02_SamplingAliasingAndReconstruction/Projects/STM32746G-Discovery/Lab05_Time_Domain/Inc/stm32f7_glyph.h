@@ -0,0 +1,46 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_glyph.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_glyph.c module
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_GLYPH_H
+#define __STM32F7_GLYPH_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32746g_discovery_lcd.h"
+#include "stm32f7xx_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+/**
+  * @brief  Glyph atlas start address
+  * The atlas lives in SDRAM after the logo layer frame buffer (0xC0400000),
+  * one A8 byte per font pixel, glyphs stored one after the other.
+  */
+#define GLYPH_ATLAS_BUFFER    ((uint32_t)(SDRAM_DEVICE_ADDR + 0x00500000))
+
+#define GLYPH_FIRST_CHAR      ' '
+#define GLYPH_LAST_CHAR       '~'
+#define GLYPH_NUM_CHARS       (GLYPH_LAST_CHAR - GLYPH_FIRST_CHAR + 1)
+
+#define LABEL_CACHE_SIZE      16
+#define LABEL_MAX_LEN         24
+
+/* Exported functions ------------------------------------------------------- */
+void initGlyphAtlas(void);
+void drawString(uint32_t layer, uint16_t Xpos, uint16_t Ypos, const char *text, Text_AlignModeTypdef Mode);
+void drawLabel(uint16_t Xpos, uint16_t Ypos, const char *text, Text_AlignModeTypdef Mode);
+void invalidateLabels(void);
+void forgetLabels(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+void clearLabels(void);
+void setLabelLayer(uint32_t layer);
+
+int formatInt(char *buf, int32_t value);
+int formatFixed(char *buf, int32_t value, uint8_t decimals);
+int formatFloat(char *buf, float value, uint8_t decimals);
+
+#endif /* __STM32F7_GLYPH_H */
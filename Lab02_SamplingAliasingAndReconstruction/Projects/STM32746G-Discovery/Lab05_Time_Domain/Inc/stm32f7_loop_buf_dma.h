@@ -24,6 +24,7 @@
 #include "stm32f7xx_hal.h"
 #include "stm32746g_discovery_audio.h"
 #include "stm32f7_display.h"
+#include "stm32f7_scope.h"
 #include "wm8994.h"
 
 /* Exported types ------------------------------------------------------------*/
@@ -0,0 +1,94 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_resample.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_resample.c module
+  *
+  *          Capture at 48 kHz and process at 8 kHz, the left slot of the
+  *          interleaved buffer in place:
+  *
+  *          #define TAPS 128                   //Per phase, one phase for 1/6
+  *          static float32_t prototype[1*TAPS];
+  *          static int16_t coeffs[1*TAPS], state[2*TAPS];
+  *          static ResampleQ15 down;
+  *          resampleDesign(prototype, 1, 6, TAPS);
+  *          resampleInitQ15(&down, 1, 6, TAPS, prototype, coeffs, state);
+  *          ...
+  *          void process_half(int16_t *buf, uint32_t ns)
+  *          {
+  *            n8k = resampleProcessQ15(&down, buf, buf, ns/2, 2, 2);
+  *          }
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_RESAMPLE_H
+#define __STM32F7_RESAMPLE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "arm_math.h"
+#include "stm32f7xx_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define RESAMPLE_MAX_FACTOR   256				//Largest L or M
+#define RESAMPLE_MAX_TAPS     256				//Largest number of taps per phase
+
+#define RESAMPLE_Q15          0
+#define RESAMPLE_F32          1
+
+/**
+  * @brief  Most outputs from n inputs, for sizing the output buffer
+  */
+#define RESAMPLE_MAX_OUTPUTS(n, up, down) (((n)*(up) + (down) - 1)/(down))
+
+/**
+  * @brief  resampleBenchmark() is only built when RESAMPLE_BENCHMARK is
+  * defined to 1, e.g. in the project options
+  */
+#ifndef RESAMPLE_BENCHMARK
+#define RESAMPLE_BENCHMARK    0
+#endif
+#define RESAMPLE_BENCH_RATIOS 4					//48k to 8k, 8k to 48k, 48k to 32k, 32k to 48k
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Polyphase resampler by up/down (L/M)
+  * The prototype low pass runs at up times the input rate, with taps per
+  * phase times up taps. Only the outputs that are kept are computed, each
+  * from one phase of taps coefficients, the phases are stored one after the
+  * other. The history is written twice like the FIR filters of stm32f7_fir.c.
+  */
+typedef struct
+{
+	uint32_t up;								//L
+	uint32_t down;							//M
+	uint32_t taps;							//Taps per phase
+	uint32_t index;							//Where the newest input is, counts down
+	uint32_t phase;							//Phase of the next output, up or more for a later input
+	int16_t *coeffs;						//up phases of taps
+	int16_t *state;							//2*taps samples
+} ResampleQ15;
+
+typedef struct
+{
+	uint32_t up;
+	uint32_t down;
+	uint32_t taps;
+	uint32_t index;
+	uint32_t phase;
+	float32_t *coeffs;
+	float32_t *state;
+} ResampleF32;
+
+/* Exported functions ------------------------------------------------------- */
+void resampleDesign(float32_t *prototype, uint32_t up, uint32_t down, uint32_t taps);
+HAL_StatusTypeDef resampleInitQ15(ResampleQ15 *rs, uint32_t up, uint32_t down, uint32_t taps, const float32_t *prototype, int16_t *coeffs, int16_t *state);
+HAL_StatusTypeDef resampleInitF32(ResampleF32 *rs, uint32_t up, uint32_t down, uint32_t taps, const float32_t *prototype, float32_t *coeffs, float32_t *state);
+uint32_t resampleProcessQ15(ResampleQ15 *rs, const int16_t *in, int16_t *out, uint32_t n, uint32_t in_stride, uint32_t out_stride);
+uint32_t resampleProcessF32(ResampleF32 *rs, const float32_t *in, float32_t *out, uint32_t n, uint32_t in_stride, uint32_t out_stride);
+#if RESAMPLE_BENCHMARK
+void resampleBenchmark(uint32_t taps, float32_t cycles[2][RESAMPLE_BENCH_RATIOS]);
+#endif
+
+#endif /* __STM32F7_RESAMPLE_H */
@@ -0,0 +1,76 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_scope.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_scope.c module
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_SCOPE_H
+#define __STM32F7_SCOPE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_display.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define SCOPE_RING_LEN        1024u		//Pre-trigger history, power of 2
+#define SCOPE_MAX_FRAME       512u		//Longest frame, no more than SCOPE_RING_LEN
+
+//Trigger types
+#define SCOPE_RISING          0				//x goes from below level-hysteresis to level or above
+#define SCOPE_FALLING         1				//x goes from above level+hysteresis to level or below
+#define SCOPE_LEVEL           2				//x is at level or above
+
+//Modes
+#define SCOPE_AUTO            0				//Free-run after auto_timeout samples without a trigger
+#define SCOPE_NORMAL          1				//Only triggered frames
+#define SCOPE_SINGLE          2				//One triggered frame, then stop until scopeArm()
+
+//States
+#define SCOPE_HOLDOFF         0				//Filling the pre-trigger history / holdoff
+#define SCOPE_ARMED           1				//Looking for the trigger
+#define SCOPE_CAPTURE         2				//Collecting the samples after the trigger
+#define SCOPE_STOPPED         3				//Single frame taken
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+	//Settings
+	uint8_t mode;
+	uint8_t trigger;
+	int16_t level;
+	int16_t hysteresis;
+	uint32_t frame_len;				//Samples per frame
+	uint32_t pre_trigger;			//Samples before the trigger in each frame
+	uint32_t holdoff;					//Minimum samples from one trigger to the next
+	uint32_t auto_timeout;		//Samples to wait for a trigger in SCOPE_AUTO mode
+
+	//Trigger engine
+	uint8_t state;
+	uint8_t edge_armed;				//Hysteresis band has been left on the arming side
+	uint32_t write;						//Next ring index
+	uint32_t history;					//Samples in the ring, up to SCOPE_RING_LEN
+	uint32_t since_trigger;		//Samples after the last trigger sample
+	uint32_t waiting;					//Samples searched since armed
+	uint32_t trigger_pos;			//Ring index of the trigger sample
+	uint32_t post_left;				//Samples still to collect after the trigger
+	uint32_t dropped;					//Frames lost because the last one wasn't drawn yet
+	int16_t ring[SCOPE_RING_LEN];
+
+	//Frame handed to the render side
+	volatile uint8_t frame_ready;
+	uint8_t frame_triggered;	//0 = forced by the auto timeout
+	int16_t frame[SCOPE_MAX_FRAME];
+} Scope;
+
+/* Exported functions ------------------------------------------------------- */
+void scopeInit(Scope *scope, uint32_t frame_len, uint32_t pre_trigger);
+void scopeSetTrigger(Scope *scope, uint8_t trigger, int16_t level, int16_t hysteresis);
+void scopeSetMode(Scope *scope, uint8_t mode, uint32_t holdoff, uint32_t auto_timeout);
+void scopeArm(Scope *scope);
+void scopeAddBlock(Scope *scope, const int16_t *data, uint32_t n);
+void plotScope(Scope *scope);
+
+#endif /* __STM32F7_SCOPE_H */
@@ -0,0 +1,92 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_tone.h
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   Header for stm32f7_tone.c module
+  *
+  *          The eight DTMF tones of the left slot of the interleaved buffer,
+  *          measured every 10 ms at 48 kHz:
+  *
+  *          static const float32_t dtmf[8] = {697, 770, 852, 941, 1209, 1336, 1477, 1633};
+  *          static ToneBank bank;
+  *          static float32_t memory[TONE_MEMORY(8, 480)];
+  *          toneInit(&bank, TONE_GOERTZEL, 480, 48000, dtmf, 8, memory);
+  *          ...
+  *          void process_half(int16_t *buf, uint32_t ns)
+  *          {
+  *            if(toneProcessQ15(&bank, buf, ns/2, 2))
+  *              ...                                //bank.magnitude[0..7]
+  *          }
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F7_TONE_H
+#define __STM32F7_TONE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "arm_math.h"
+#include "stm32f7xx_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define TONE_MAX_DETECTORS    64
+
+#define TONE_GOERTZEL         0					//A result per frame, about 2 operations per sample
+#define TONE_SLIDING          1					//A result after every block, about 8 operations per sample
+
+/**
+  * @brief  The sliding DFT forgets its rounding errors with a time constant of
+  * 1/TONE_SLIDING_LEAK frames, its window tapers by that much from the newest
+  * to the oldest sample
+  */
+#define TONE_SLIDING_LEAK     0.01f
+
+/**
+  * @brief  Floats of memory for a bank, coefficients, state and results for
+  * each detector and a frame of history for TONE_SLIDING
+  */
+#define TONE_MEMORY(num_tones, frame_len) (10*(num_tones) + (frame_len))
+
+/**
+  * @brief  toneBenchmark() is only built when TONE_BENCHMARK is defined to 1,
+  * e.g. in the project options
+  */
+#ifndef TONE_BENCHMARK
+#define TONE_BENCHMARK        0
+#endif
+#define TONE_BENCH_DETECTORS  32
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Bank of single frequency DFTs over frames of frame_len samples
+  * The frequencies need not fall on the bins of a frame_len point FFT, each
+  * detector is the DFT at its own frequency. Results are amplitudes, 1.0 for
+  * a full scale sine, and the phase of the cosine at the first sample of the
+  * frame, in radians. Tones closer than fs/frame_len are not told apart.
+  */
+typedef struct
+{
+	uint8_t method;							//TONE_GOERTZEL or TONE_SLIDING
+	uint32_t num_tones;
+	uint32_t frame_len;
+	uint32_t count;							//Samples into the frame or the history
+	float32_t scale;						//Amplitude per unit of DFT
+	float32_t leak;							//Weight of the oldest sample of the sliding window
+	float32_t *coeffs;					//6 per detector
+	float32_t *state;						//2 per detector
+	float32_t *magnitude;				//Amplitude per detector
+	float32_t *phase;						//Phase per detector
+	float32_t *history;					//frame_len samples for TONE_SLIDING
+} ToneBank;
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef toneInit(ToneBank *bank, uint8_t method, uint32_t frame_len, float32_t fs, const float32_t *frequencies, uint32_t num_tones, float32_t *memory);
+void toneReset(ToneBank *bank);
+int toneProcessQ15(ToneBank *bank, const int16_t *data, uint32_t n, uint32_t stride);
+int toneProcessF32(ToneBank *bank, const float32_t *data, uint32_t n, uint32_t stride);
+#if TONE_BENCHMARK
+void toneBenchmark(float32_t cycles[2]);
+#endif
+
+#endif /* __STM32F7_TONE_H */
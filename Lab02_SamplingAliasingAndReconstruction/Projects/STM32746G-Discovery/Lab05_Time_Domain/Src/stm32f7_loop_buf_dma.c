@@ -14,13 +14,18 @@
 
 #define BUF_LEN         512u
 
+/* Oscilloscope: one sample per graph column, a quarter of them before the trigger */
+#define SCOPE_FRAME     GRAPH_WIDTH
+#define SCOPE_PRE       (GRAPH_WIDTH/4)
+
 #define HALF_READY      1
 #define FULL_READY      2
 
 /* Private variables ---------------------------------------------------------*/
 volatile static uint8_t buffer_ready;
-static float32_t buffer[BUF_LEN];
+static int16_t mono_buffer[BUF_LEN/2];
 static int16_t audio_buffer[BUF_LEN];
+static Scope scope;
 
 /* Private function prototypes -----------------------------------------------*/
 static void MPU_Config(void);
@@ -44,10 +49,11 @@ void process_half(int16_t *buf, uint32_t ns)
 	uint32_t j = 0;
 	for (uint32_t i = 0; i < ns; i += 2) /* Process only the left-slot samples (mono). Switch to i++ if the input is true stereo. */
 	{
-		int16_t x = buf[i];
-		buffer[j++] = (float32_t)x;
+		mono_buffer[j++] = buf[i];
 	}
-	plotWaveNoAutoScale(buffer, j);
+	//Trigger detection runs on every block, only complete frames are drawn
+	scopeAddBlock(&scope, mono_buffer, j);
+	plotScope(&scope);
 }
 
 
@@ -66,6 +72,11 @@ int main(void)
 	
 	stm32f7_LCD_init(AUDIO_FREQ, SOURCE_FILE_NAME, GRAPH);
 	
+	//Rising edge through 0 with 256 of hysteresis, free-running when there is no signal
+	scopeInit(&scope, SCOPE_FRAME, SCOPE_PRE);
+	scopeSetTrigger(&scope, SCOPE_RISING, 0, 256);
+	scopeSetMode(&scope, SCOPE_AUTO, SCOPE_FRAME, AUDIO_FREQ/10);
+	
 	BSP_LED_Init(LED1);
    
   if (BSP_AUDIO_IN_InitEx(INPUT_DEVICE_INPUT_LINE_1, AUDIO_FREQ, AUDIO_IN_BIT_RES, AUDIO_IN_CHANNEL_NBR) != AUDIO_OK)
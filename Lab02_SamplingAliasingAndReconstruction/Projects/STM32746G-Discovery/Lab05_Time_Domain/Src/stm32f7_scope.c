@@ -0,0 +1,306 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_scope.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides a triggered oscilloscope for the time-domain lab.
+  *					 scopeAddBlock() runs in the DMA block path: it keeps a ring of
+  *					 pre-trigger history and looks for the trigger, then hands over a
+  *					 complete frame. plotScope() only draws complete frames.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_scope.h"
+
+#define SCOPE_YSCALE 270		//Same vertical scale as plotWaveNoAutoScale()
+
+static float32_t scope_plot[SCOPE_MAX_FRAME];
+
+/**
+  * @brief  Copy samples into the pre-trigger ring
+  * @param  scope: oscilloscope
+  * @param  data: samples
+  * @param  n: number of samples
+  * @retval none
+  */
+
+static void pushSamples(Scope *scope, const int16_t *data, uint32_t n) {
+	uint32_t first;
+
+	//Saturate rather than wrap, only "at least holdoff" matters
+	if(scope->since_trigger < 0x80000000u) scope->since_trigger += n;
+	scope->history += n;
+	if(scope->history > SCOPE_RING_LEN) scope->history = SCOPE_RING_LEN;
+
+	//Only the newest SCOPE_RING_LEN samples matter
+	if(n > SCOPE_RING_LEN) {
+		scope->write = (scope->write + n - SCOPE_RING_LEN) & (SCOPE_RING_LEN - 1);
+		data += n - SCOPE_RING_LEN;
+		n = SCOPE_RING_LEN;
+	}
+	first = SCOPE_RING_LEN - scope->write;
+	if(first > n) first = n;
+	memcpy(&scope->ring[scope->write], data, first*sizeof(int16_t));
+	memcpy(&scope->ring[0], data + first, (n - first)*sizeof(int16_t));
+	scope->write = (scope->write + n) & (SCOPE_RING_LEN - 1);
+}
+
+/**
+  * @brief  Look for the trigger, the hysteresis state carries over between blocks
+  * @param  scope: oscilloscope
+  * @param  data: samples
+  * @param  n: number of samples
+  * @retval index of the trigger sample, n if there is none
+  */
+
+static uint32_t findTrigger(Scope *scope, const int16_t *data, uint32_t n) {
+	uint32_t i = 0;
+	int32_t level = scope->level;
+	int32_t arm;
+
+	switch(scope->trigger) {
+		case SCOPE_RISING:
+			arm = level - scope->hysteresis;
+			while(i < n) {
+				//Wait until the signal has been below the hysteresis band
+				if(!scope->edge_armed) {
+					while(i < n && data[i] >= arm) i++;
+					if(i == n) break;
+					scope->edge_armed = 1;
+				}
+				while(i < n && data[i] < level) i++;
+				if(i < n) return i;
+			}
+			break;
+
+		case SCOPE_FALLING:
+			arm = level + scope->hysteresis;
+			while(i < n) {
+				if(!scope->edge_armed) {
+					while(i < n && data[i] <= arm) i++;
+					if(i == n) break;
+					scope->edge_armed = 1;
+				}
+				while(i < n && data[i] > level) i++;
+				if(i < n) return i;
+			}
+			break;
+
+		case SCOPE_LEVEL:
+			while(i < n && data[i] < level) i++;
+			break;
+	}
+	return i;
+}
+
+/**
+  * @brief  Copy the captured frame out of the ring for the render side
+  * @param  scope: oscilloscope
+  * @retval none
+  */
+
+static void completeFrame(Scope *scope) {
+	uint32_t start, first;
+
+	if(scope->frame_ready) {
+		//The previous frame hasn't been drawn, drop this one
+		scope->dropped++;
+	} else {
+		start = (scope->trigger_pos - scope->pre_trigger) & (SCOPE_RING_LEN - 1);
+		first = SCOPE_RING_LEN - start;
+		if(first > scope->frame_len) first = scope->frame_len;
+		memcpy(scope->frame, &scope->ring[start], first*sizeof(int16_t));
+		memcpy(scope->frame + first, &scope->ring[0], (scope->frame_len - first)*sizeof(int16_t));
+		scope->frame_ready = 1;
+	}
+	scope->state = (scope->mode == SCOPE_SINGLE) ? SCOPE_STOPPED : SCOPE_HOLDOFF;
+}
+
+/**
+  * @brief  Initialise the oscilloscope, rising edge trigger at 0 in SCOPE_AUTO mode
+  * @param  scope: oscilloscope
+  * @param  frame_len: samples per frame, up to SCOPE_MAX_FRAME
+  * @param  pre_trigger: samples before the trigger in each frame, less than frame_len
+  * @retval none
+  */
+
+void scopeInit(Scope *scope, uint32_t frame_len, uint32_t pre_trigger) {
+	memset(scope, 0, sizeof(Scope));
+
+	if(frame_len > SCOPE_MAX_FRAME) frame_len = SCOPE_MAX_FRAME;
+	if(frame_len == 0) frame_len = 1;
+	if(pre_trigger >= frame_len) pre_trigger = frame_len - 1;
+
+	scope->frame_len = frame_len;
+	scope->pre_trigger = pre_trigger;
+	scopeSetTrigger(scope, SCOPE_RISING, 0, 256);
+	scopeSetMode(scope, SCOPE_AUTO, frame_len, 4*frame_len);
+}
+
+/**
+  * @brief  Change the trigger
+  * @param  scope: oscilloscope
+  * @param  trigger: SCOPE_RISING, SCOPE_FALLING or SCOPE_LEVEL
+  * @param  level: trigger level
+  * @param  hysteresis: distance the signal has to go to the other side of the level
+	*											before the next edge, ignored by SCOPE_LEVEL
+  * @retval none
+  */
+
+void scopeSetTrigger(Scope *scope, uint8_t trigger, int16_t level, int16_t hysteresis) {
+	scope->trigger = trigger;
+	scope->level = level;
+	scope->hysteresis = (hysteresis < 0) ? 0 : hysteresis;
+	scope->edge_armed = 0;
+}
+
+/**
+  * @brief  Change the mode and re-arm the trigger
+  * @param  scope: oscilloscope
+  * @param  mode: SCOPE_AUTO, SCOPE_NORMAL or SCOPE_SINGLE
+  * @param  holdoff: minimum samples from one trigger to the next
+  * @param  auto_timeout: samples to wait for a trigger in SCOPE_AUTO mode
+  * @retval none
+  */
+
+void scopeSetMode(Scope *scope, uint8_t mode, uint32_t holdoff, uint32_t auto_timeout) {
+	scope->mode = mode;
+	scope->holdoff = holdoff;
+	scope->auto_timeout = (auto_timeout == 0) ? 1 : auto_timeout;
+	scopeArm(scope);
+}
+
+/**
+  * @brief  Look for the next trigger, takes another frame in SCOPE_SINGLE mode
+  * @param  scope: oscilloscope
+  * @retval none
+  */
+
+void scopeArm(Scope *scope) {
+	scope->state = SCOPE_HOLDOFF;
+	scope->since_trigger = scope->holdoff;
+	scope->edge_armed = 0;
+	scope->waiting = 0;
+}
+
+/**
+  * @brief  Feed a block of samples to the trigger engine, call it from the DMA block path
+  * @param  scope: oscilloscope
+  * @param  data: samples
+  * @param  n: number of samples
+  * @retval none
+  */
+
+void scopeAddBlock(Scope *scope, const int16_t *data, uint32_t n) {
+	uint32_t need, hold, take, idx;
+
+	while(n > 0) {
+		switch(scope->state) {
+			case SCOPE_HOLDOFF:
+				//Enough history for the pre-trigger part and the holdoff has passed
+				need = (scope->history < scope->pre_trigger) ? scope->pre_trigger - scope->history : 0;
+				hold = (scope->since_trigger < scope->holdoff) ? scope->holdoff - scope->since_trigger : 0;
+				need = (need > hold) ? need : hold;
+				take = (need > n) ? n : need;
+				pushSamples(scope, data, take);
+				data += take;
+				n -= take;
+				if(take == need) {
+					scope->state = SCOPE_ARMED;
+					scope->edge_armed = 0;
+					scope->waiting = 0;
+				}
+				break;
+
+			case SCOPE_ARMED:
+				take = n;
+				if(scope->mode == SCOPE_AUTO && take > scope->auto_timeout - scope->waiting)
+					take = scope->auto_timeout - scope->waiting;
+
+				idx = findTrigger(scope, data, take);
+				if(idx < take) {
+					//Triggered, the trigger sample is the first sample of the post-trigger part
+					pushSamples(scope, data, idx + 1);
+					data += idx + 1;
+					n -= idx + 1;
+					scope->trigger_pos = (scope->write - 1) & (SCOPE_RING_LEN - 1);
+					scope->post_left = scope->frame_len - scope->pre_trigger - 1;
+					scope->frame_triggered = 1;
+				} else {
+					pushSamples(scope, data, take);
+					data += take;
+					n -= take;
+					scope->waiting += take;
+					if(scope->mode != SCOPE_AUTO || scope->waiting < scope->auto_timeout)
+						break;
+					//No trigger in time, free-run from the next sample
+					scope->trigger_pos = scope->write;
+					scope->post_left = scope->frame_len - scope->pre_trigger;
+					scope->frame_triggered = 0;
+				}
+				scope->since_trigger = 0;
+				scope->state = SCOPE_CAPTURE;
+				if(scope->post_left == 0) completeFrame(scope);
+				break;
+
+			case SCOPE_CAPTURE:
+				take = (scope->post_left < n) ? scope->post_left : n;
+				pushSamples(scope, data, take);
+				data += take;
+				n -= take;
+				scope->post_left -= take;
+				if(scope->post_left == 0) completeFrame(scope);
+				break;
+
+			default:
+				//Stopped, keep the history up to date for the next scopeArm()
+				pushSamples(scope, data, n);
+				n = 0;
+				break;
+		}
+	}
+}
+
+/**
+  * @brief  Draw the last complete frame if there is a new one,
+	*					with the trigger position and level marked in IMAGINARY_COLOUR
+  * @param  scope: oscilloscope
+  * @retval none
+  */
+
+void plotScope(Scope *scope) {
+	uint32_t i;
+	int ylevel;
+
+	if(!scope->frame_ready)
+		return;
+
+	for(i = 0; i < scope->frame_len; i++)
+		scope_plot[i] = scope->frame[i];
+
+	plotWaveNoAutoScale(scope_plot, scope->frame_len);
+
+	BSP_LCD_SetTextColor(IMAGINARY_COLOUR);
+	//Trigger position at the top of the graph
+	BSP_LCD_DrawVLine(FIRST_DATA_PIXEL + scope->pre_trigger*GRAPH_WIDTH/scope->frame_len, HEADER_HEIGHT, 6);
+
+	//Trigger level on the right of the graph
+	ylevel = GRAPH_YCENTRE - scope->level/SCOPE_YSCALE;
+	if(ylevel >= HEADER_HEIGHT && ylevel <= GRAPH_VER_END_PIXEL) {
+		BSP_LCD_SetTextColor(BACKGROUND_COLOUR);
+		BSP_LCD_FillRect(FIRST_DATA_PIXEL + GRAPH_WIDTH + 1, HEADER_HEIGHT, 6, GRAPH_HEIGHT);
+		BSP_LCD_SetTextColor(IMAGINARY_COLOUR);
+		BSP_LCD_DrawHLine(FIRST_DATA_PIXEL + GRAPH_WIDTH + 1, ylevel, 6);
+	}
+
+	BSP_LCD_SetFont(&Font12);
+	BSP_LCD_SetTextColor(TEXT_COLOUR);
+	BSP_LCD_SetBackColor(BACKGROUND_COLOUR);
+	if(scope->mode == SCOPE_SINGLE)
+		drawLabel(20, HEADER_HEIGHT + 30, "Single", RIGHT_MODE);
+	else
+		drawLabel(20, HEADER_HEIGHT + 30, scope->frame_triggered ? "Trig'd" : "Auto", RIGHT_MODE);
+
+	scope->frame_ready = 0;
+}
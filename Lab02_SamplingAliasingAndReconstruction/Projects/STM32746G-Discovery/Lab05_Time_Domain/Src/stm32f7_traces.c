@@ -0,0 +1,239 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7_traces.c
+  * @author  Arm University Program
+  * @date    Summer 2025
+  * @brief   This file provides a plot of several buffers on one graph, e.g.
+  *					 the input and the output of an effect. All traces share one
+  *					 scale. The whole graph is composed off screen with every trace,
+  *					 one L8 byte per pixel, and DMA2D copies it through its CLUT to
+  *					 the graph layer in one transfer, so the graph is never seen
+  *					 cleared and a frame costs about the same as one trace.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f7_traces.h"
+#include <string.h>
+
+#define COLUMN_HEIGHT (GRAPH_VER_END_PIXEL + 2)		//Same area as the plotWave() clear
+
+extern LTDC_HandleTypeDef hLtdcHandler;
+extern int stop;
+
+static Envelope trace_envelope[TRACE_MAX];
+static int16_t trace_top[TRACE_MAX][GRAPH_WIDTH];			//Pixel extent of each trace in each column,
+static int16_t trace_bottom[TRACE_MAX][GRAPH_WIDTH];	//empty when top > bottom
+
+static DMA2D_HandleTypeDef hDma2dTraces;
+
+//Background then the colour of each trace, cache line aligned for the clean before DMA2D loads it
+static uint32_t trace_clut[TRACE_MAX + 1] __attribute__((aligned(32)));
+
+/**
+  * @brief  Pixel row of a value, limited to the graph area
+  */
+
+static int16_t valueToRow(float32_t value, float32_t yscalefactor) {
+	int y = GRAPH_YCENTRE - (int)(value*yscalefactor);
+
+	if(y < HEADER_HEIGHT) y = HEADER_HEIGHT;
+	if(y > GRAPH_VER_END_PIXEL) y = GRAPH_VER_END_PIXEL;
+	return y;
+}
+
+/**
+  * @brief  Turn the envelope of a trace into the pixel extent of each column
+  * @param  env: envelope of the trace
+  * @param  style: TRACE_BARS, TRACE_LINE or TRACE_DOTS
+  * @param  yscalefactor: pixels per unit
+  * @param  top: top pixel of each column
+  * @param  bottom: bottom pixel of each column
+  * @retval none
+  */
+
+static void traceExtents(const Envelope *env, uint8_t style, float32_t yscalefactor, int16_t *top, int16_t *bottom) {
+	int i, next = -1, last = -1;
+	int16_t ymax, ymin;
+	float32_t value;
+
+	for(i = 0; i < GRAPH_WIDTH; i++) {
+		top[i] = 1;
+		bottom[i] = 0;
+
+		if(env->min[i] <= env->max[i]) {
+			ymax = valueToRow(env->max[i], yscalefactor);
+			ymin = valueToRow(env->min[i], yscalefactor);
+			last = i;
+		} else if(style == TRACE_LINE && last >= 0) {
+			//Fewer samples than columns, the line crosses the columns between two samples
+			if(next <= i)
+				for(next = i + 1; next < GRAPH_WIDTH && env->min[next] > env->max[next]; next++);
+			if(next >= GRAPH_WIDTH)
+				continue;
+			value = env->max[last] + (env->max[next] - env->max[last])*(i - last)/(next - last);
+			ymax = ymin = valueToRow(value, yscalefactor);
+		} else {
+			continue;
+		}
+
+		switch(style) {
+			case TRACE_BARS:
+				if(ymax > GRAPH_YCENTRE) ymax = GRAPH_YCENTRE;
+				if(ymin < GRAPH_YCENTRE) ymin = GRAPH_YCENTRE;
+				break;
+			case TRACE_LINE:
+				//Stretch to the previous column so the line has no gaps
+				if(i > 0 && top[i - 1] <= bottom[i - 1]) {
+					if(ymax > bottom[i - 1]) ymax = bottom[i - 1];
+					if(ymin < top[i - 1]) ymin = top[i - 1];
+				}
+				break;
+			default:
+				break;
+		}
+		top[i] = ymax;
+		bottom[i] = ymin;
+	}
+}
+
+/**
+  * @brief  Compose the graph from all the traces
+  * @param  graph: GRAPH_WIDTH x COLUMN_HEIGHT L8 pixels from the top of the
+  *					screen, 0 for the background and t + 1 for trace t
+  * @param  traces: traces, later traces are drawn over earlier ones
+  * @param  num_traces: number of traces
+  * @retval none
+  */
+
+static void composeGraph(uint8_t *graph, const Trace *traces, int num_traces) {
+	int t, x, y, top, bottom;
+	uint8_t index;
+
+	memset(graph, 0, GRAPH_WIDTH*COLUMN_HEIGHT);
+	for(t = 0; t < num_traces; t++) {
+		index = t + 1;
+		for(x = 0; x < GRAPH_WIDTH; x++) {
+			top = trace_top[t][x];
+			bottom = trace_bottom[t][x];
+			if(top > bottom)
+				continue;
+			if(traces[t].style == TRACE_DOTS) {
+				//Two pixel dots at the ends of the column extent
+				graph[top*GRAPH_WIDTH + x] = index;
+				if(top < GRAPH_VER_END_PIXEL) graph[(top + 1)*GRAPH_WIDTH + x] = index;
+				graph[bottom*GRAPH_WIDTH + x] = index;
+				if(bottom > HEADER_HEIGHT) graph[(bottom - 1)*GRAPH_WIDTH + x] = index;
+			} else {
+				for(y = top; y <= bottom; y++)
+					graph[y*GRAPH_WIDTH + x] = index;
+			}
+		}
+	}
+}
+
+/**
+  * @brief  Plot column envelopes on the graph
+  * @param  envelopes: one envelope per trace
+  * @param  traces: colour and style of each trace, the data is not read
+  * @param  num_traces: number of traces, up to TRACE_MAX
+  * @param  max: largest value of all the traces
+  * @param  min: smallest value of all the traces
+  * @param  size: number of samples shown on the x axis
+  * @retval none
+  */
+
+void plotEnvelopes(const Envelope *envelopes, const Trace *traces, int num_traces, float32_t max, float32_t min, int size) {
+	DMA2D_CLUTCfgTypeDef clut;
+	int t;
+	int16_t ymax, ymin;
+	float32_t biggestmag, yscalefactor;
+	uint32_t address, bytes_per_pixel, xsize = BSP_LCD_GetXSize();
+
+	if(num_traces > TRACE_MAX) num_traces = TRACE_MAX;
+	if(num_traces < 1)
+		return;
+
+	//Same scale as plotWave(), the biggest magnitude is 100 pixels from the centre
+	if(max*max > min*min) biggestmag = max; else biggestmag = -min;
+	if(biggestmag == 0) biggestmag = 1;
+	yscalefactor = 100/biggestmag;
+	ymin = GRAPH_YCENTRE - min*yscalefactor;
+	ymax = GRAPH_YCENTRE - max*yscalefactor;
+
+	for(t = 0; t < num_traces; t++)
+		traceExtents(&envelopes[t], traces[t].style, yscalefactor, trace_top[t], trace_bottom[t]);
+
+	composeGraph((uint8_t *)TRACE_BUFFER, traces, num_traces);
+	SCB_CleanDCache_by_Addr((uint32_t *)TRACE_BUFFER, GRAPH_WIDTH*COLUMN_HEIGHT);
+
+	//DMA2D converts the L8 graph through the trace colours into the graph layer format
+	if(hLtdcHandler.LayerCfg[LTDC_ACTIVE_LAYER].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) {
+		hDma2dTraces.Init.ColorMode = DMA2D_OUTPUT_RGB565;
+		bytes_per_pixel = 2;
+	} else {
+		hDma2dTraces.Init.ColorMode = DMA2D_OUTPUT_ARGB8888;
+		bytes_per_pixel = 4;
+	}
+	hDma2dTraces.Instance = DMA2D;
+	hDma2dTraces.Init.Mode = DMA2D_M2M_PFC;
+	hDma2dTraces.Init.OutputOffset = xsize - GRAPH_WIDTH;
+	hDma2dTraces.LayerCfg[1].InputColorMode = DMA2D_INPUT_L8;
+	hDma2dTraces.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+	hDma2dTraces.LayerCfg[1].InputAlpha = 0xFF;
+	hDma2dTraces.LayerCfg[1].InputOffset = 0;
+	if(HAL_DMA2D_Init(&hDma2dTraces) != HAL_OK || HAL_DMA2D_ConfigLayer(&hDma2dTraces, 1) != HAL_OK)
+		return;
+
+	trace_clut[0] = BACKGROUND_COLOUR;
+	for(t = 0; t < num_traces; t++)
+		trace_clut[t + 1] = traces[t].colour;
+	SCB_CleanDCache_by_Addr(trace_clut, sizeof(trace_clut));
+	clut.pCLUT = trace_clut;
+	clut.CLUTColorMode = DMA2D_CCM_ARGB8888;
+	clut.Size = num_traces;
+	if(HAL_DMA2D_CLUTStartLoad(&hDma2dTraces, &clut, 1) != HAL_OK)
+		return;
+	HAL_DMA2D_PollForTransfer(&hDma2dTraces, 10);
+
+	address = hLtdcHandler.LayerCfg[LTDC_ACTIVE_LAYER].FBStartAdress + bytes_per_pixel*FIRST_DATA_PIXEL;
+	if(HAL_DMA2D_Start(&hDma2dTraces, TRACE_BUFFER, address, GRAPH_WIDTH, COLUMN_HEIGHT) != HAL_OK)
+		return;
+	HAL_DMA2D_PollForTransfer(&hDma2dTraces, 10);
+
+	drawAxes(GRAPH_YCENTRE, ymax, ymin, max, min, 0, size, FIRST_DATA_PIXEL + GRAPH_WIDTH, WAVE);
+}
+
+/**
+  * @brief  Plot several buffers on one graph with a shared scale
+  * @param  traces: buffers with their colour and style, later traces are drawn over earlier ones
+  * @param  num_traces: number of traces, up to TRACE_MAX
+  * @param  live: static data = 0, live data = 1
+  * @retval none
+  */
+
+void plotTraces(const Trace *traces, int num_traces, int live) {
+	int t;
+	float32_t max = 0, min = 0, trace_max, trace_min;
+
+	if(num_traces > TRACE_MAX) num_traces = TRACE_MAX;
+	if(num_traces < 1)
+		return;
+
+	//Whenever user push the button or live data is needed, the traces will be drawn,
+	//Otherwise, the graph will only be drawn once
+	if(!(stop == 0 || CheckForUserInput() == 1 || live == 1))
+		return;
+	stop = 1;
+
+	//One pass over each buffer for the column envelopes and the shared range
+	for(t = 0; t < num_traces; t++) {
+		envelopeInit(&trace_envelope[t], traces[t].num_samples);
+		envelopeAddF32(&trace_envelope[t], traces[t].data, traces[t].num_samples);
+		envelopeRange(&trace_envelope[t], &trace_min, &trace_max);
+		if(t == 0 || trace_max > max) max = trace_max;
+		if(t == 0 || trace_min < min) min = trace_min;
+	}
+
+	plotEnvelopes(trace_envelope, traces, num_traces, max, min, traces[0].num_samples);
+}